@@ -1,7 +1,29 @@
 import { expect } from 'chai'
 import { base16, base64 } from 'rfc4648'
 import { utf8 } from './utf8'
-import { pbkdf2, scrypt, secp256k1 } from 'react-native-fast-crypto'
+import {
+  address,
+  aes,
+  argon2,
+  argon2id,
+  bip39,
+  chacha20poly1305,
+  ed25519,
+  keyHandles,
+  multisig,
+  musig,
+  pbkdf2,
+  pipeline,
+  PipelineStep,
+  pool,
+  random,
+  records,
+  scrypt,
+  secp256k1,
+  silentPayments,
+  slip10,
+  stats
+} from 'react-native-fast-crypto'
 
 export interface Tests {
   [name: string]: () => Promise<void>
@@ -85,6 +107,1010 @@ export const tests: Tests = {
     )
   },
 
+  'secp256k1 coalesced calls': async () => {
+    // Calls made together should match calls made one at a time,
+    // including the fallbacks for invalid keys:
+    const privateKey = base16.parse(
+      '0d5a06c12ed605cdcd809b88f3299efda6bcb46f3c844d7003d7c9926adfa010'
+    )
+    const tweak = base16.parse(
+      'a0f24d30c336181342c875be8e1df4c29e25278282f7add9142c71c76c316c8a'
+    )
+    const badKey = new Uint8Array(32)
+    const badTweak = new Uint8Array(32).fill(0xff)
+
+    const publicKeys = await Promise.all(
+      [privateKey, badKey, privateKey].map(
+        async (key, i) => await secp256k1.publicKeyCreate(key, i !== 2)
+      )
+    )
+    expect(base16.stringify(publicKeys[0]).toLowerCase()).equals(
+      '0360d95711e2135138641efd5cc09155ceba79c3f00f7babc98a070e17ad12d51c'
+    )
+    expect(publicKeys[1].length).equals(0)
+    expect(publicKeys[2]).deep.equals(
+      await secp256k1.publicKeyCreate(privateKey, false)
+    )
+
+    const tweaked = await Promise.all(
+      [tweak, badTweak].map(
+        async item => await secp256k1.privateKeyTweakAdd(privateKey, item)
+      )
+    )
+    expect(base16.stringify(tweaked[0]).toLowerCase()).equals(
+      'ae4c53f1f20c1de110491147814793c044e1dbf1bf7bfb4918043b59d7110c9a'
+    )
+    expect(tweaked[1]).deep.equals(privateKey)
+  },
+
+  ecdsaSign: async () => {
+    const privateKey = base16.parse(
+      '0d5a06c12ed605cdcd809b88f3299efda6bcb46f3c844d7003d7c9926adfa010'
+    )
+    const publicKey = base16.parse(
+      '0360d95711e2135138641efd5cc09155ceba79c3f00f7babc98a070e17ad12d51c'
+    )
+    const msgHash = base16.parse(
+      'a0f24d30c336181342c875be8e1df4c29e25278282f7add9142c71c76c316c8a'
+    )
+
+    // Compact signatures:
+    const sig = await secp256k1.ecdsaSign(msgHash, privateKey)
+    expect(sig.length).equals(64)
+    expect(await secp256k1.ecdsaVerify(sig, msgHash, publicKey)).equals(true)
+    const badSig = Uint8Array.from(sig)
+    badSig[10] ^= 1
+    expect(await secp256k1.ecdsaVerify(badSig, msgHash, publicKey)).equals(
+      false
+    )
+
+    // DER signatures:
+    const derSig = await secp256k1.ecdsaSign(msgHash, privateKey, true)
+    expect(derSig[0]).equals(0x30)
+    expect(
+      await secp256k1.ecdsaVerify(derSig, msgHash, publicKey, true)
+    ).equals(true)
+  },
+
+  'ecdsaVerifyBatch benchmark': async () => {
+    const count = 2000
+    const privateKey = base16.parse(
+      '0d5a06c12ed605cdcd809b88f3299efda6bcb46f3c844d7003d7c9926adfa010'
+    )
+    const publicKey = await secp256k1.publicKeyCreate(privateKey, true)
+
+    const msgHashes: Uint8Array[] = []
+    const sigs: Uint8Array[] = []
+    for (let i = 0; i < count; ++i) {
+      const msgHash = new Uint8Array(32).fill(i & 0xff)
+      msgHash[0] = i >> 8
+      msgHashes.push(msgHash)
+      sigs.push(await secp256k1.ecdsaSign(msgHash, privateKey))
+    }
+    const publicKeys = msgHashes.map(() => publicKey)
+
+    for (const threads of [1, 2, 4, 8]) {
+      const start = Date.now()
+      const results = await secp256k1.ecdsaVerifyBatch(
+        sigs,
+        msgHashes,
+        publicKeys,
+        threads
+      )
+      const elapsed = Math.max(1, Date.now() - start)
+      console.log(
+        `ecdsaVerifyBatch: ${threads} threads, ${Math.round(
+          (1000 * count) / elapsed
+        )} signatures/s`
+      )
+      expect(results.every(valid => valid)).equals(true)
+    }
+  },
+
+  schnorrSign: async () => {
+    // From the BIP340 test vectors:
+    const privateKey = base16.parse(
+      '0000000000000000000000000000000000000000000000000000000000000003'
+    )
+    const msg = new Uint8Array(32)
+    const auxRand = new Uint8Array(32)
+    const publicKey = await secp256k1.xOnlyPublicKeyCreate(privateKey)
+    expect(base16.stringify(publicKey)).equals(
+      'F9308A019258C31049344F85F89D5229B531C845836F99B08601F113BCE036F9'
+    )
+
+    const sig = await secp256k1.schnorrSign(msg, privateKey, auxRand)
+    expect(base16.stringify(sig)).equals(
+      'E907831F80848D1069A5371B402410364BDF1C5F8307B0084C55F1CE2DCA8215' +
+        '25F66A4A85EA8B71E482A74F382D2CE5EBEEE8FDB2172F477DF4900D310536C0'
+    )
+    expect(await secp256k1.schnorrVerify(sig, msg, publicKey)).equals(true)
+    sig[0] ^= 1
+    expect(await secp256k1.schnorrVerify(sig, msg, publicKey)).equals(false)
+  },
+
+  taprootTweak: async () => {
+    // From the BIP86 test vectors:
+    const internalKey = base16.parse(
+      'cc8a4bc64d897bddc5fbc2f670f7a8ba0b386779106cf1223c6fc5d7cd6fc115'
+    )
+    const { publicKey } = await secp256k1.taprootTweakPublicKey(internalKey)
+    expect(base16.stringify(publicKey).toLowerCase()).equals(
+      'a60869f0dbcf1dc659c9cecbaf8050135ea9e8cdc487053f1dc6880949dc684c'
+    )
+
+    // The tweaked private key should match the tweaked public key:
+    const privateKey = base16.parse(
+      '0d5a06c12ed605cdcd809b88f3299efda6bcb46f3c844d7003d7c9926adfa010'
+    )
+    const merkleRoot = new Uint8Array(32).fill(7)
+    const [tweaked] = await secp256k1.taprootTweakPublicKeyBatch(
+      [await secp256k1.xOnlyPublicKeyCreate(privateKey)],
+      [merkleRoot]
+    )
+    const tweakedPrivateKey = await secp256k1.taprootTweakPrivateKey(
+      privateKey,
+      merkleRoot
+    )
+    expect(
+      base16.stringify(await secp256k1.xOnlyPublicKeyCreate(tweakedPrivateKey))
+    ).equals(base16.stringify(tweaked.publicKey))
+  },
+
+  'schnorrVerifyBatch benchmark': async () => {
+    const count = 2000
+    const privateKeys: Uint8Array[] = []
+    const msgs: Uint8Array[] = []
+    for (let i = 0; i < count; ++i) {
+      const privateKey = new Uint8Array(32).fill(1)
+      privateKey[30] = i >> 8
+      privateKey[31] = i & 0xff
+      privateKeys.push(privateKey)
+      msgs.push(new Uint8Array(32).fill(i & 0xff))
+    }
+    const publicKeys = await secp256k1.xOnlyPublicKeyCreateBatch(privateKeys)
+    const sigs = await secp256k1.schnorrSignBatch(msgs, privateKeys)
+
+    for (const threads of [1, 2, 4, 8]) {
+      const start = Date.now()
+      const results = await secp256k1.schnorrVerifyBatch(
+        sigs,
+        msgs,
+        publicKeys,
+        threads
+      )
+      const elapsed = Math.max(1, Date.now() - start)
+      console.log(
+        `schnorrVerifyBatch: ${threads} threads, ${Math.round(
+          (1000 * count) / elapsed
+        )} signatures/s`
+      )
+      expect(results.every(valid => valid)).equals(true)
+    }
+  },
+
+  ecdsaRecover: async () => {
+    const privateKey = base16.parse(
+      '4c0883a69102937d6231471b5dbb6204fe5129617082792ae468d01a3f362318'
+    )
+    const msgHash = base16.parse(
+      'a0f24d30c336181342c875be8e1df4c29e25278282f7add9142c71c76c316c8a'
+    )
+    const sig = await secp256k1.ecdsaSignRecoverable(msgHash, privateKey)
+    expect(sig.length).equals(65)
+
+    const publicKey = await secp256k1.ecdsaRecover(sig, msgHash)
+    expect(base16.stringify(publicKey)).equals(
+      base16.stringify(await secp256k1.publicKeyCreate(privateKey, true))
+    )
+
+    // Ethereum-style `v` values should work too:
+    const ethSig = Uint8Array.from(sig)
+    ethSig[64] += 27
+    const [address, bad] = await secp256k1.ecdsaRecoverBatch(
+      [ethSig, new Uint8Array(65)],
+      [msgHash, msgHash],
+      'address'
+    )
+    expect(base16.stringify(address ?? new Uint8Array(0))).equals(
+      '2C7536E3605D9C16A7A3D7B1898E529396A65C23'
+    )
+    expect(bad).equals(undefined)
+  },
+
+  ecdh: async () => {
+    const privateKeyA = base16.parse(
+      '0d5a06c12ed605cdcd809b88f3299efda6bcb46f3c844d7003d7c9926adfa010'
+    )
+    const privateKeyB = base16.parse(
+      '4c0883a69102937d6231471b5dbb6204fe5129617082792ae468d01a3f362318'
+    )
+    const secretA = await secp256k1.ecdh(
+      privateKeyA,
+      await secp256k1.publicKeyCreate(privateKeyB, true)
+    )
+    const secretB = await secp256k1.ecdh(
+      privateKeyB,
+      await secp256k1.publicKeyCreate(privateKeyA, false)
+    )
+    expect(base16.stringify(secretA)).equals(base16.stringify(secretB))
+  },
+
+  keyHandles: async () => {
+    const privateKey = new Uint8Array(32).fill(1)
+    const tweak1 = new Uint8Array(32).fill(2)
+    const tweak2 = new Uint8Array(32).fill(3)
+
+    // Chained tweaks should match the one-shot functions:
+    const privateHandle = await keyHandles.fromPrivateKey(privateKey)
+    const child = await keyHandles.tweakAdd(privateHandle, tweak1)
+    const grandchild = await keyHandles.tweakAdd(child, tweak2)
+    const expectedPrivate = await secp256k1.privateKeyTweakAdd(
+      await secp256k1.privateKeyTweakAdd(privateKey, tweak1),
+      tweak2
+    )
+    expect(base16.stringify(await keyHandles.serialize(grandchild))).equals(
+      base16.stringify(expectedPrivate)
+    )
+
+    const publicHandle = await keyHandles.fromPublicKey(
+      await secp256k1.publicKeyCreate(privateKey, true)
+    )
+    const publicChild = await keyHandles.tweakAdd(
+      await keyHandles.tweakAdd(publicHandle, tweak1),
+      tweak2
+    )
+    const fromPrivate = await keyHandles.publicKey(grandchild)
+    expect(base16.stringify(await keyHandles.serialize(publicChild))).equals(
+      base16.stringify(await keyHandles.serialize(fromPrivate))
+    )
+    expect(
+      base16.stringify(await keyHandles.serialize(publicChild, false))
+    ).equals(
+      base16.stringify(await secp256k1.publicKeyCreate(expectedPrivate, false))
+    )
+
+    // P + P should be the public key for 2 * k:
+    const sum = await keyHandles.combine([publicHandle, publicHandle])
+    const doubled = await secp256k1.privateKeyTweakAdd(privateKey, privateKey)
+    expect(base16.stringify(await keyHandles.serialize(sum))).equals(
+      base16.stringify(await secp256k1.publicKeyCreate(doubled, true))
+    )
+
+    await keyHandles.release(publicHandle)
+    let released = false
+    await keyHandles.serialize(publicHandle).catch(() => {
+      released = true
+    })
+    expect(released).equals(true)
+  },
+
+  'multisig.deriveScriptHashes': async () => {
+    // Computed with an independent reference implementation:
+    const xpubs = [
+      '1111111111111111111111111111111111111111111111111111111111111111031b84c5567b126440995d3ed5aaba0565d71e1834604819ff9c17f5e9d5dd078f',
+      '2222222222222222222222222222222222222222222222222222222222222222024d4b6cd1361032ca9bd2aeb9d900aa4d45d9ead80ac9423374c451a7254d0766',
+      '333333333333333333333333333333333333333333333333333333333333333302531fe6068134503d2723133227c867ac8fa6c83c537e9a44c3c5bdbdcb1fe337'
+    ].map(hex => {
+      const data = base16.parse(hex)
+      return { chainCode: data.subarray(0, 32), publicKey: data.subarray(32) }
+    })
+
+    const p2sh = await multisig.deriveScriptHashes({
+      xpubs,
+      m: 2,
+      scriptType: 'p2sh',
+      startIndex: 0,
+      count: 2
+    })
+    expect(
+      p2sh.map(hash => base16.stringify(hash).toLowerCase())
+    ).deep.equals([
+      'eafddddc92a38c86f443be139210759c9151dd0f',
+      '787e50bf8e94eb384098c9a13f23d7c8c165810c'
+    ])
+
+    // Cosigner order should not matter:
+    const [p2wsh] = await multisig.deriveScriptHashes({
+      xpubs: xpubs.slice().reverse(),
+      m: 2,
+      scriptType: 'p2wsh',
+      startIndex: 1,
+      count: 1
+    })
+    expect(base16.stringify(p2wsh).toLowerCase()).equals(
+      '5f0cc5196f28dfadff78bbb09788af4c4a0babf3c8ae10de2c595e77f1feed84'
+    )
+
+    const [nested] = await multisig.deriveScriptHashes({
+      xpubs,
+      m: 2,
+      scriptType: 'p2sh-p2wsh',
+      startIndex: 0,
+      count: 1
+    })
+    expect(base16.stringify(nested).toLowerCase()).equals(
+      '695b77797fe053e759afb8a3beebaecf8ae95d5a'
+    )
+  },
+
+  'musig round trip': async () => {
+    const privateKeys = [new Uint8Array(32).fill(1), new Uint8Array(32).fill(2)]
+    const publicKeys = await Promise.all(
+      privateKeys.map(key => secp256k1.publicKeyCreate(key, true))
+    )
+    const msg = new Uint8Array(32).fill(3)
+
+    const { aggregateKey, keyaggCache } = await musig.keyAgg(publicKeys)
+    const [batchKey] = await musig.keyAggBatch([publicKeys.slice().reverse()])
+    expect(base16.stringify(batchKey)).equals(base16.stringify(aggregateKey))
+
+    const nonces = await Promise.all(
+      privateKeys.map(
+        async (privateKey, i) =>
+          await musig.nonceGen({
+            sessionRand: new Uint8Array(32).fill(10 + i),
+            publicKey: publicKeys[i],
+            privateKey,
+            msg,
+            keyaggCache
+          })
+      )
+    )
+    const aggnonce = await musig.nonceAgg(nonces.map(nonce => nonce.pubnonce))
+    const partialSigs = await Promise.all(
+      privateKeys.map(
+        async (privateKey, i) =>
+          await musig.partialSign(
+            nonces[i].nonceHandle,
+            privateKey,
+            keyaggCache,
+            aggnonce,
+            msg
+          )
+      )
+    )
+    expect(
+      await musig.partialVerify(
+        partialSigs[0],
+        nonces[0].pubnonce,
+        publicKeys[0],
+        keyaggCache,
+        aggnonce,
+        msg
+      )
+    ).equals(true)
+    expect(
+      await musig.partialVerify(
+        partialSigs[0],
+        nonces[1].pubnonce,
+        publicKeys[1],
+        keyaggCache,
+        aggnonce,
+        msg
+      )
+    ).equals(false)
+
+    const sig = await musig.partialSigAgg(
+      partialSigs,
+      keyaggCache,
+      aggnonce,
+      msg
+    )
+    expect(await secp256k1.schnorrVerify(sig, msg, aggregateKey)).equals(true)
+
+    // Signing used up the nonce, so it cannot sign a second message:
+    const reused = await musig
+      .partialSign(
+        nonces[0].nonceHandle,
+        privateKeys[0],
+        keyaggCache,
+        aggnonce,
+        new Uint8Array(32).fill(4)
+      )
+      .catch(e => e)
+    expect(reused).instanceOf(Error)
+  },
+
+  'silentPayments.scan': async () => {
+    // Computed with an independent reference implementation:
+    const decoy = base16.parse(
+      '2f8bde4d1a07209355b4a7250a5c5128e88b84bddc619ab7cba8d569b240efe4'
+    )
+    const matches = await silentPayments.scan({
+      scanKey: base16.parse(
+        '0000000000001100000000000000000000000000000000000000000000003039'
+      ),
+      spendPublicKey: base16.parse(
+        '031a2ba72e511590bbfb6d026de8c24c8578ac30071bcc2a09e3c2b00c1e59a514'
+      ),
+      labels: [
+        base16.parse(
+          '02f752d6abaaa506da79e3f82f6a2fe61b31eb2c6168cc1a56302c93a0bf8ed7d6'
+        )
+      ],
+      txs: [
+        {
+          tweak: base16.parse(
+            '03fdd710db98f3ab83780ec5e97bcea1df2bd85b46574356c88a867a7057ec2b96'
+          ),
+          inputHash: base16.parse(
+            '5af32bd37ad3ca2ebef3b51136d5ec5a6a8f0b8f8033ccf05d6516f4c12379ec'
+          ),
+          outputs: [
+            decoy,
+            base16.parse(
+              '50645d6b85cc299fb7025093715a503d56639afa7de195867a24f3b011b15a80'
+            ),
+            base16.parse(
+              'd14313e12b7da74f08bf1215d4b7d3f28c31e03e110f9c6ed233d244a216723e'
+            )
+          ]
+        },
+        {
+          tweak: base16.parse(
+            '03fdd710db98f3ab83780ec5e97bcea1df2bd85b46574356c88a867a7057ec2b96'
+          ),
+          inputHash: new Uint8Array(32).fill(1),
+          outputs: [decoy]
+        }
+      ]
+    })
+
+    expect(
+      matches.map(match => ({
+        ...match,
+        tweak: base16.stringify(match.tweak).toLowerCase()
+      }))
+    ).deep.equals([
+      {
+        txIndex: 0,
+        outputIndex: 2,
+        labelIndex: -1,
+        tweak:
+          '4b9d4dc270c4a7f6cefe1a75db2ad627c21337929c5720a7de0bdf251267b497'
+      },
+      {
+        txIndex: 0,
+        outputIndex: 1,
+        labelIndex: 0,
+        tweak:
+          '113bee57cfd6f260600d3cc6daf96d9348825fe37f82fcc6344529c4085dd348'
+      }
+    ])
+  },
+
+  'aes.cbc': async () => {
+    // From NIST SP 800-38A, F.2.5:
+    const key = base16.parse(
+      '603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4'
+    )
+    const iv = base16.parse('000102030405060708090a0b0c0d0e0f')
+    const data = base16.parse(
+      '6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51'
+    )
+
+    const raw = await aes.cbcEncrypt(key, iv, data, { padding: false })
+    expect(base16.stringify(raw).toLowerCase()).equals(
+      'f58c4c04d6e5f1ba779eabfb5f7bfbd69cfc4e967edb808d679f777bc6702c7d'
+    )
+
+    const padded = await aes.cbcEncrypt(key, iv, data)
+    expect(base16.stringify(padded).toLowerCase()).equals(
+      'f58c4c04d6e5f1ba779eabfb5f7bfbd69cfc4e967edb808d679f777bc6702c7d3a3aa5e0213db1a9901f9036cf5102d2'
+    )
+    expect(await aes.cbcDecrypt(key, iv, padded)).deep.equals(data)
+  },
+
+  'aes.gcm': async () => {
+    // From the GCM specification, test case 16:
+    const key = base16.parse(
+      'feffe9928665731c6d6a8f9467308308feffe9928665731c6d6a8f9467308308'
+    )
+    const iv = base16.parse('cafebabefacedbaddecaf888')
+    const aad = base16.parse('feedfacedeadbeeffeedfacedeadbeefabaddad2')
+    const data = base16.parse(
+      'd9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a721c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39'
+    )
+
+    const sealed = await aes.gcmEncrypt(key, iv, data, aad)
+    expect(base16.stringify(sealed).toLowerCase()).equals(
+      '522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa8cb08e48590dbb3da7b08b1056828838c5f61e6393ba7a0abcc9f662' +
+        '76fc6ece0f4e1768cddf8853bb2d551b'
+    )
+    expect(await aes.gcmDecrypt(key, iv, sealed, aad)).deep.equals(data)
+
+    sealed[0] ^= 1
+    const error = await aes.gcmDecrypt(key, iv, sealed, aad).catch(e => e)
+    expect(error).instanceOf(Error)
+  },
+
+  'aes benchmark': async () => {
+    const size = 1 << 20
+    const key = new Uint8Array(32).fill(1)
+    const data = new Uint8Array(size).fill(2)
+
+    for (const implementation of ['bitsliced', 'aesni', 'armv8'] as const) {
+      if (!(await aes.setImplementation(implementation))) continue
+      const iv = new Uint8Array(16)
+      const start = Date.now()
+      const sealed = await aes.gcmEncrypt(key, iv.subarray(0, 12), data)
+      const middle = Date.now()
+      const ciphertext = await aes.cbcEncrypt(key, iv, data)
+      await aes.cbcDecrypt(key, iv, ciphertext)
+      const end = Date.now()
+
+      const rate = (ms: number): number =>
+        Math.round((1000 * size) / (1 << 20) / Math.max(1, ms))
+      console.log(
+        `aes ${implementation}: GCM ${rate(middle - start)} MB/s, ` +
+          `CBC round trip ${rate(end - middle)} MB/s`
+      )
+      expect(sealed.length).equals(size + 16)
+    }
+    await aes.setImplementation('auto')
+    expect(await aes.getImplementation()).not.equals('auto')
+  },
+
+  bip39: async () => {
+    // From https://github.com/trezor/python-mnemonic/blob/master/vectors.json
+    const mnemonic =
+      'scissors invite lock maple supreme raw rapid void congress muscle digital elegant little brisk hair mango congress clump'
+    const out = await bip39.mnemonicToSeed(
+      utf8.parse(mnemonic),
+      utf8.parse('TREZOR')
+    )
+    expect(base16.stringify(out.seed).toLowerCase()).equals(
+      '7b4a10be9d98e6cba265566db7f136718e1398c71cb581e1b2f464cac1ceedf4f3e274dc270003c670ad8d02c4558b2f8e39edea2775c9e232c7cb798b069e88'
+    )
+    expect(base16.stringify(out.chainCode).toLowerCase()).equals(
+      'fc9e966f7b063366c65d23c2b75cc0fab48a9c09e7812c6d99901f47bc79e0b9'
+    )
+    expect(base16.stringify(out.privateKey).toLowerCase()).equals(
+      '6d7c8d14d5e949647c9a3bf85344f9e40e82bff96789965acbf83bb66a7f9e5d'
+    )
+
+    // Full-width letters normalize to the same passphrase:
+    const batch = await bip39.mnemonicToSeedBatch(utf8.parse(mnemonic), [
+      utf8.parse('ＴＲＥＺＯＲ'),
+      utf8.parse('')
+    ])
+    expect(batch.map(item => item.status)).deep.equals(['ok', 'ok'])
+    expect(batch[0].seed).deep.equals(out.seed)
+    expect(batch[1].seed).not.deep.equals(out.seed)
+
+    const badChecksum = await bip39.mnemonicToSeedBatch(
+      utf8.parse(mnemonic.replace(/clump$/, 'club')),
+      [utf8.parse('TREZOR')]
+    )
+    expect(badChecksum[0].status).equals('bad-checksum')
+  },
+
+  address: async () => {
+    // From BIP173, BIP350, and the CashAddr specification:
+    const hash = base16.parse('751E76E8199196D454941C45D1B3A323F1433BD6')
+    const taproot = base16.parse(
+      '79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798'
+    )
+    expect(
+      await address.encodeBatch([hash, taproot], {
+        format: 'segwit',
+        prefix: 'bc',
+        version: 1
+      })
+    ).deep.equals([
+      undefined,
+      'bc1p0xlxvlhemja6c4dqv22uapctqupfhlxm9h8z3k2e72q4k9hcz7vqzk5jj0'
+    ])
+    const segwit = await address.decode(
+      'BC1QW508D6QEJXTDG4Y5R3ZARVARY0C5XW7KV8F3T4',
+      { format: 'segwit', prefix: 'bc' }
+    )
+    expect(segwit.version).equals(0)
+    expect(segwit.payload).deep.equals(hash)
+
+    const p2pkh = base16.parse('77BFF20C60E522DFAA3350C39B030A5D004E839A')
+    expect(
+      await address.encode(p2pkh, {
+        format: 'base58check',
+        prefix: new Uint8Array([0])
+      })
+    ).equals('1BvBMSEYstWetqTFn5Au4m4GFg7xJaNVN2')
+
+    const cashaddr = base16.parse('76A04053BDA0A88BDA5177B86A15C3B29F559873')
+    expect(
+      await address.encode(cashaddr, {
+        format: 'cashaddr',
+        prefix: 'bitcoincash'
+      })
+    ).equals('bitcoincash:qpm2qsznhks23z7629mms6s4cwef74vcwvy22gdx6a')
+
+    // The prefix is optional, but the checksum and network have to match:
+    const decoded = await address.decodeBatch(
+      [
+        'qpm2qsznhks23z7629mms6s4cwef74vcwvy22gdx6a',
+        'bitcoincash:qpm2qsznhks23z7629mms6s4cwef74vcwvy22gdx6b',
+        'bchtest:pr6m7j9njldwwzlg9v7v53unlr4jkmx6eyvwc0uz5t'
+      ],
+      { format: 'cashaddr', prefix: 'bitcoincash' }
+    )
+    expect(decoded[0]).deep.equals({ version: 0, payload: cashaddr })
+    expect(decoded.slice(1)).deep.equals([undefined, undefined])
+  },
+
+  random: async () => {
+    const a = await random.bytes(64)
+    const b = await random.bytes(64)
+    expect(a.length).equals(64)
+    expect(a).not.deep.equals(b)
+
+    // The public keys have to match the ones made from the private keys:
+    const keys = await random.generateKeys('secp256k1', 3)
+    for (const { privateKey, publicKey } of keys) {
+      expect(publicKey).deep.equals(
+        await secp256k1.publicKeyCreate(privateKey, true)
+      )
+    }
+    expect(keys[0].privateKey).not.deep.equals(keys[1].privateKey)
+    const [edKey] = await random.generateKeys('ed25519', 1)
+    expect(edKey.publicKey).deep.equals(
+      await ed25519.publicKeyCreate(edKey.privateKey)
+    )
+  },
+
+  pool: async () => {
+    expect(await pool.configure('background', { threads: 0 })).equals(false)
+    expect(await pool.configure('background', { threads: 2 })).equals(true)
+
+    // Interactive calls should not wait behind a slow background call:
+    const order: string[] = []
+    const slow = (async () => {
+      await scrypt(utf8.parse('slow'), utf8.parse('salt'), 32768, 8, 1, 32)
+      order.push('scrypt')
+    })()
+    const privateKey = base16.parse(
+      '0000000000000000000000000000000000000000000000000000000000000001'
+    )
+    await secp256k1.publicKeyCreate(privateKey, true)
+    order.push('publicKeyCreate')
+    await slow
+    expect(order).deep.equals(['publicKeyCreate', 'scrypt'])
+  },
+
+  chacha20poly1305: async () => {
+    // From RFC 8439, section 2.8.2:
+    const key = base16.parse(
+      '808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f'
+    )
+    const nonce = base16.parse('070000004041424344454647')
+    const aad = base16.parse('50515253c0c1c2c3c4c5c6c7')
+    const data = utf8.parse(
+      "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, sunscreen would be it."
+    )
+
+    const sealed = await chacha20poly1305.encrypt(key, nonce, data, aad)
+    expect(base16.stringify(sealed).toLowerCase()).equals(
+      'd31a8d34648e60db7b86afbc53ef7ec2a4aded51296e08fea9e2b5a736ee62d63dbea45e8ca9671282fafb69da92728b1a71de0a9e060b2905d6a5b67ecd3b3692ddbd7f2d778b8c9803aee328091b58fab324e4fad675945585808b4831d7bc3ff4def08e4b7a9de576d26586cec64b6116' +
+        '1ae10b594f09e26a7e902ecbd0600691'
+    )
+    expect(await chacha20poly1305.decrypt(key, nonce, sealed, aad)).deep.equals(
+      data
+    )
+  },
+
+  'chacha20poly1305 streams': async () => {
+    // From draft-irtf-cfrg-xchacha, appendix A.3.1:
+    const key = base16.parse(
+      '808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f'
+    )
+    const nonce = base16.parse(
+      '404142434445464748494a4b4c4d4e4f5051525354555657'
+    )
+    const aad = base16.parse('50515253c0c1c2c3c4c5c6c7')
+    const data = utf8.parse(
+      "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, sunscreen would be it."
+    )
+
+    // Uneven chunks should give the same result as a single call:
+    const encryptor = await chacha20poly1305.createEncryptStream(
+      key,
+      nonce,
+      aad
+    )
+    let hex = ''
+    for (const [start, end] of [
+      [0, 1],
+      [1, 65],
+      [65, 114]
+    ]) {
+      hex += base16.stringify(await encryptor.update(data.subarray(start, end)))
+    }
+    const tag = await encryptor.final()
+    const ciphertext = base16.parse(hex)
+    expect(base16.stringify(tag).toLowerCase()).equals(
+      'c0875924c1c7987947deafd8780acf49'
+    )
+    const sealed = await chacha20poly1305.encrypt(key, nonce, data, aad)
+    expect(base16.stringify(sealed)).equals(hex + base16.stringify(tag))
+
+    const decryptor = await chacha20poly1305.createDecryptStream(
+      key,
+      nonce,
+      aad
+    )
+    const head = await decryptor.update(ciphertext.subarray(0, 100))
+    const tail = await decryptor.update(ciphertext.subarray(100))
+    await decryptor.final(tag)
+    expect(base16.stringify(head) + base16.stringify(tail)).equals(
+      base16.stringify(data)
+    )
+
+    // A bad tag fails the stream:
+    const tampered = await chacha20poly1305.createDecryptStream(key, nonce)
+    await tampered.update(ciphertext)
+    const error = await tampered.final(tag).catch(e => e)
+    expect(error).instanceOf(Error)
+  },
+
+  'chacha20 benchmark': async () => {
+    const size = 1 << 20
+    const key = new Uint8Array(32).fill(1)
+    const nonce = new Uint8Array(24)
+    const data = new Uint8Array(size).fill(2)
+
+    for (const implementation of [
+      'portable',
+      'sse2',
+      'avx2',
+      'neon'
+    ] as const) {
+      if (!(await chacha20poly1305.setImplementation(implementation))) continue
+      const start = Date.now()
+      const sealed = await chacha20poly1305.encrypt(key, nonce, data)
+      const elapsed = Math.max(1, Date.now() - start)
+      console.log(
+        `chacha20poly1305 ${implementation}: ${Math.round(
+          (1000 * size) / (1 << 20) / elapsed
+        )} MB/s`
+      )
+      expect(sealed.length).equals(size + 16)
+    }
+    await chacha20poly1305.setImplementation('auto')
+    expect(await chacha20poly1305.getImplementation()).not.equals('auto')
+  },
+
+  'records.decryptBatch': async () => {
+    // Generated with OpenSSL, under scrypt('password', 'NaCl', 16, 1, 1):
+    const password = utf8.parse('password')
+    const salt = utf8.parse('NaCl')
+    const key = base16.parse(
+      'aec6b7483ed26e08802b41f4032086a0e886be7ac48fcfd92ff0cef8109752f4' +
+        'ac74b077263256a65a99701b7a304d46611c8aa391e799ce10a27753e7e9c09a'
+    )
+    const hello = base16.parse(
+      '000102030405060708090a0b0c0d0e0fca07a34f149522e2b5438fd2486417c2' +
+        '9c42ab75beb408dbd55ac01505988776a59e6b41f990faa927e4f3058d25f777'
+    )
+    const empty = base16.parse(
+      '101112131415161718191a1b1c1d1e1f9fc3db8d8ce8c1136cf46f1c1fedc77a' +
+        '84678b2ce062cfb5fd13292dae5f7e498463d809837b5981d9f17b7249739bbf'
+    )
+    const tampered = hello.slice()
+    tampered[63] ^= 1
+    // A valid MAC over a block with bad padding:
+    const badPadding = base16.parse(
+      '00000000000000000000000000000000960600e5e9d3d63a829e9bc3a589c3f8' +
+        '6dfc8e063a7eec0a773567bbe41127921a5aa7c3b1dc8a9582ff7996f71fbb23'
+    )
+    const batch = [hello, empty, tampered, new Uint8Array(40), badPadding]
+
+    for (const recordKey of [key, { password, salt, N: 16, r: 1, p: 1 }]) {
+      const out = await records.decryptBatch({
+        key: recordKey,
+        records: batch
+      })
+      expect(out.map(record => record.status)).deep.equals([
+        'ok',
+        'ok',
+        'bad-mac',
+        'bad-length',
+        'bad-padding'
+      ])
+      expect(utf8.stringify(out[0].data)).equals('hello')
+      expect(out[1].data.length).equals(0)
+      expect(out[2].data.length).equals(0)
+    }
+
+    // Bad scrypt parameters are not the same as a wrong password:
+    const badKdf = await records.decryptBatch({
+      key: { password, salt, N: 15, r: 1, p: 1 },
+      records: batch
+    })
+    expect(badKdf.map(record => record.status)).deep.equals(
+      batch.map(() => 'kdf-failed')
+    )
+  },
+
+  'pipeline.run': async () => {
+    // The same login chain as the records test, in one native call:
+    const steps: PipelineStep[] = [
+      {
+        op: 'scrypt',
+        out: 'key',
+        password: 'password',
+        salt: 'salt',
+        N: 16,
+        r: 1,
+        p: 1,
+        size: 64
+      },
+      { op: 'slice', out: 'aesKey', data: 'key', start: 0, length: 32 },
+      { op: 'slice', out: 'macKey', data: 'key', start: 32, length: 32 },
+      { op: 'slice', out: 'signed', data: 'record', start: 0, length: 32 },
+      { op: 'slice', out: 'mac', data: 'record', start: 32, length: 32 },
+      { op: 'hmacSha256', out: 'expected', key: 'macKey', data: 'signed' },
+      { op: 'verify', actual: 'mac', expected: 'expected' },
+      { op: 'slice', out: 'iv', data: 'record', start: 0, length: 16 },
+      { op: 'slice', out: 'data', data: 'record', start: 16, length: 16 },
+      {
+        op: 'aesCbcDecrypt',
+        out: 'plaintext',
+        key: 'aesKey',
+        iv: 'iv',
+        data: 'data'
+      }
+    ]
+    const record = base16.parse(
+      '000102030405060708090a0b0c0d0e0fca07a34f149522e2b5438fd2486417c2' +
+        '9c42ab75beb408dbd55ac01505988776a59e6b41f990faa927e4f3058d25f777'
+    )
+    const inputs = {
+      password: utf8.parse('password'),
+      salt: utf8.parse('NaCl'),
+      record
+    }
+
+    const key = await pipeline.run({ inputs, steps, output: 'key' })
+    expect(key.status).equals('ok')
+    expect(key.data).deep.equals(
+      await scrypt(inputs.password, inputs.salt, 16, 1, 1, 64)
+    )
+
+    const out = await pipeline.run({ inputs, steps, output: 'plaintext' })
+    expect(out.status).equals('ok')
+    expect(utf8.stringify(out.data)).equals('hello')
+
+    // A tampered record stops at the MAC check:
+    const tampered = record.slice()
+    tampered[63] ^= 1
+    const failed = await pipeline.run({
+      inputs: { ...inputs, record: tampered },
+      steps,
+      output: 'plaintext'
+    })
+    expect(failed.status).equals('mismatch')
+    expect(failed.step).equals(6)
+    expect(failed.data.length).equals(0)
+
+    // A bad Argon2id step fails the check before the scrypt step runs,
+    // rather than with 'kdf-failed' after it:
+    const badArgon2 = await pipeline.run({
+      inputs,
+      steps: [
+        steps[0],
+        {
+          op: 'argon2id',
+          out: 'stretched',
+          password: 'key',
+          salt: 'salt',
+          t: 1,
+          m: 4,
+          p: 1,
+          size: 32
+        }
+      ],
+      output: 'stretched'
+    })
+    expect(badArgon2.status).equals('bad-step')
+    expect(badArgon2.step).equals(1)
+  },
+
+  stats: async () => {
+    await stats.reset()
+    const tracing = await stats.traceStart(100)
+    await scrypt(new Uint8Array(8), new Uint8Array(8), 1024, 8, 1, 32)
+    const json = await stats.traceStop()
+    const snapshot = await stats.snapshot()
+
+    // Release builds keep no stats, but still report the right shape:
+    const { calls, histogram } = snapshot.ops.scrypt
+    expect(tracing).equals(snapshot.enabled)
+    expect(histogram.length).equals(32)
+    if (!snapshot.enabled) {
+      expect(calls).equals(0)
+      expect(json).equals('')
+      return
+    }
+    expect(calls).equals(1)
+    expect(histogram.reduce((a, b) => a + b)).equals(1)
+    expect(snapshot.secureMemory.peak).at.least(1024 * 8 * 128)
+    expect(JSON.parse(json).traceEvents[0].name).equals('scrypt')
+  },
+
+  ed25519: async () => {
+    // From the RFC 8032 test vectors:
+    const privateKey = base16.parse(
+      '9d61b19deffd5a60ba844af492ec2cc44449c5697b326919703bac031cae7f60'
+    )
+    const msg = new Uint8Array(0)
+    const publicKey = await ed25519.publicKeyCreate(privateKey)
+    expect(base16.stringify(publicKey).toLowerCase()).equals(
+      'd75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a'
+    )
+
+    const sig = await ed25519.sign(msg, privateKey)
+    expect(base16.stringify(sig).toLowerCase()).equals(
+      'e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e06522490155' +
+        '5fb8821590a33bacc61e39701cf9b46bd25bf5f0595bbe24655141438e7a100b'
+    )
+    expect(await ed25519.verify(sig, msg, publicKey)).equals(true)
+
+    // Mix in a longer message and a tampered signature:
+    const long = new Uint8Array(1000).fill(7)
+    const longSig = await ed25519.sign(long, privateKey)
+    const tampered = sig.slice()
+    tampered[0] ^= 1
+    const results = await ed25519.verifyBatch(
+      [sig, longSig, tampered],
+      [msg, long, msg],
+      [publicKey, publicKey, publicKey]
+    )
+    expect(results).deep.equals([true, true, false])
+  },
+
+  'slip10.ed25519Derive': async () => {
+    // From the SLIP-0010 test vectors:
+    const seed = base16.parse('000102030405060708090A0B0C0D0E0F')
+    const key = await slip10.ed25519Derive(seed, "m/0'/1'")
+    expect(base16.stringify(key.privateKey).toLowerCase()).equals(
+      'b1d0bad404bf35da785a64ca1ac54b2617211d2777696fbffaf208f746ae84f2'
+    )
+    expect(base16.stringify(key.publicKey).toLowerCase()).equals(
+      '1932a5270f335bed617d5b935c80aedb1a35bd9fc1e31acafd5372c30f5c1187'
+    )
+
+    const keys = await slip10.ed25519DeriveBatch(seed, [[], [0x80000000]])
+    expect(keys.map(item => base16.stringify(item.publicKey))).deep.equals([
+      'A4B2856BFEC510ABAB89753FAC1AC0E1112364E7D250545963F135F2A33188ED',
+      '8C8A13DF77A28F3445213A0F432FDE644ACAA215FC72DCDF300D5EFAA85D350C'
+    ])
+  },
+
+  argon2id: async () => {
+    // From the reference implementation's command-line tool:
+    for (const implementation of [
+      'portable',
+      'ssse3',
+      'avx2',
+      'neon'
+    ] as const) {
+      if (!(await argon2.setImplementation(implementation))) continue
+      const out = await argon2id(
+        utf8.parse('password'),
+        utf8.parse('somesalt'),
+        2,
+        256,
+        2,
+        32
+      )
+      expect(base16.stringify(out).toLowerCase()).equals(
+        '6d093c501fd5999645e0ea3bf620d7b8be7fd2db59c20d9fff9539da2bf57037'
+      )
+    }
+    await argon2.setImplementation('auto')
+    expect(await argon2.getImplementation()).not.equals('auto')
+  },
+
   scrypt: async () => {
     // Edge username hash:
     const out = await scrypt(
@@ -0,0 +1,170 @@
+package co.airbitz.fastcrypto;
+
+import java.lang.management.ManagementFactory;
+import java.lang.management.ThreadMXBean;
+import java.nio.ByteBuffer;
+import java.security.SecureRandom;
+import java.util.Base64;
+
+/**
+ * Compares the string-based JNI bridge with the byte[] / direct ByteBuffer one. Each operation
+ * runs three ways:
+ *
+ * <ul>
+ *   <li>string: the old natives, which take and return hex or base64 strings.
+ *   <li>bytes: the new natives, including the conversions the React Native module still does.
+ *   <li>bytes (reused): the new natives on pre-decoded, reused buffers.
+ * </ul>
+ *
+ * Run it with `npm run bench-jni`.
+ */
+public class BridgeBench {
+  private static final RNFastCryptoModule module = new RNFastCryptoModule();
+
+  // Keeps the JIT from discarding results:
+  private static volatile int sink;
+
+  private interface Task {
+    int run();
+  }
+
+  public static void main(String[] args) {
+    SecureRandom random = new SecureRandom();
+    byte[] privateKey = new byte[32];
+    byte[] tweak = new byte[32];
+    random.nextBytes(privateKey);
+    random.nextBytes(tweak);
+    byte[] publicKey = new byte[33];
+    if (module.secp256k1EcPubkeyCreateIntoJNI(privateKey, 1, publicKey) != 33) {
+      throw new IllegalStateException("Cannot create a public key");
+    }
+
+    String privateKeyHex = Bytes.toHex(privateKey, 32);
+    String publicKeyHex = Bytes.toHex(publicKey, 33);
+    String tweakHex = Bytes.toHex(tweak, 32);
+    byte[] out = new byte[65];
+
+    // The two bridges must agree before timing them:
+    check(
+        module.secp256k1EcPubkeyCreateJNI(privateKeyHex, 0),
+        Bytes.toHex(out, module.secp256k1EcPubkeyCreateIntoJNI(privateKey, 0, out)));
+    module.secp256k1EcPrivkeyTweakAddIntoJNI(privateKey, tweak, out);
+    check(module.secp256k1EcPrivkeyTweakAddJNI(privateKeyHex, tweakHex), Bytes.toHex(out, 32));
+    check(
+        module.secp256k1EcPubkeyTweakAddJNI(publicKeyHex, tweakHex, 1),
+        Bytes.toHex(out, module.secp256k1EcPubkeyTweakAddIntoJNI(publicKey, tweak, 1, out)));
+
+    System.out.printf("%-40s %12s %12s%n", "operation", "ns/op", "heap B/op");
+
+    bench(
+        "pubkeyCreate string",
+        () -> module.secp256k1EcPubkeyCreateJNI(privateKeyHex, 1).length());
+    bench(
+        "pubkeyCreate bytes",
+        () -> {
+          byte[] key = Bytes.fromHex(privateKeyHex);
+          byte[] result = new byte[65];
+          return Bytes.toHex(result, module.secp256k1EcPubkeyCreateIntoJNI(key, 1, result))
+              .length();
+        });
+    bench(
+        "pubkeyCreate bytes (reused)",
+        () -> module.secp256k1EcPubkeyCreateIntoJNI(privateKey, 1, out));
+
+    bench(
+        "privkeyTweakAdd string",
+        () -> module.secp256k1EcPrivkeyTweakAddJNI(privateKeyHex, tweakHex).length());
+    bench(
+        "privkeyTweakAdd bytes",
+        () -> {
+          byte[] result = new byte[32];
+          module.secp256k1EcPrivkeyTweakAddIntoJNI(
+              Bytes.fromHex(privateKeyHex), Bytes.fromHex(tweakHex), result);
+          return Bytes.toHex(result, 32).length();
+        });
+    bench(
+        "privkeyTweakAdd bytes (reused)",
+        () -> module.secp256k1EcPrivkeyTweakAddIntoJNI(privateKey, tweak, out) ? 1 : 0);
+
+    bench(
+        "pubkeyTweakAdd string",
+        () -> module.secp256k1EcPubkeyTweakAddJNI(publicKeyHex, tweakHex, 1).length());
+    bench(
+        "pubkeyTweakAdd bytes",
+        () -> {
+          byte[] result = new byte[33];
+          int length =
+              module.secp256k1EcPubkeyTweakAddIntoJNI(
+                  Bytes.fromHex(publicKeyHex), Bytes.fromHex(tweakHex), 1, result);
+          return Bytes.toHex(result, length).length();
+        });
+    bench(
+        "pubkeyTweakAdd bytes (reused)",
+        () -> module.secp256k1EcPubkeyTweakAddIntoJNI(publicKey, tweak, 1, out));
+
+    // Tiny scrypt parameters, so the bridge dominates:
+    byte[] passwd = new byte[64];
+    byte[] salt = new byte[32];
+    random.nextBytes(passwd);
+    random.nextBytes(salt);
+    String passwd64 = Base64.getEncoder().encodeToString(passwd);
+    String salt64 = Base64.getEncoder().encodeToString(salt);
+    ByteBuffer passwdBuffer = Bytes.direct(passwd);
+    ByteBuffer saltBuffer = Bytes.direct(salt);
+    ByteBuffer outBuffer = ByteBuffer.allocateDirect(32);
+
+    bench("scrypt(N=16) string", () -> module.scryptJNI(passwd64, salt64, 16, 1, 1, 32).length());
+    bench(
+        "scrypt(N=16) bytes",
+        () -> {
+          ByteBuffer p = Bytes.direct(Base64.getDecoder().decode(passwd64));
+          ByteBuffer s = Bytes.direct(Base64.getDecoder().decode(salt64));
+          ByteBuffer o = ByteBuffer.allocateDirect(32);
+          module.scryptIntoJNI(p, p.capacity(), s, s.capacity(), 16, 1, 1, o, 32);
+          byte[] result = new byte[32];
+          o.get(result);
+          return Base64.getEncoder().encodeToString(result).length();
+        });
+    bench(
+        "scrypt(N=16) bytes (reused)",
+        () ->
+            module.scryptIntoJNI(passwdBuffer, 64, saltBuffer, 32, 16, 1, 1, outBuffer, 32)
+                ? 1
+                : 0);
+  }
+
+  private static void check(String expected, String actual) {
+    if (!expected.equals(actual)) {
+      throw new IllegalStateException("Bridges disagree: " + expected + " != " + actual);
+    }
+  }
+
+  /** Warms up, then times a task for about a second. */
+  private static void bench(String name, Task task) {
+    ThreadMXBean threads = ManagementFactory.getThreadMXBean();
+    com.sun.management.ThreadMXBean heap =
+        threads instanceof com.sun.management.ThreadMXBean
+            ? (com.sun.management.ThreadMXBean) threads
+            : null;
+    long threadId = Thread.currentThread().getId();
+
+    for (int i = 0; i < 20000; ++i) sink += task.run();
+
+    long iterations = 0;
+    long allocated = heap != null ? heap.getThreadAllocatedBytes(threadId) : 0;
+    long start = System.nanoTime();
+    long elapsed;
+    do {
+      for (int i = 0; i < 1000; ++i) sink += task.run();
+      iterations += 1000;
+      elapsed = System.nanoTime() - start;
+    } while (elapsed < 1000000000L);
+    allocated = heap != null ? heap.getThreadAllocatedBytes(threadId) - allocated : -1;
+
+    System.out.printf(
+        "%-40s %12d %12s%n",
+        name,
+        elapsed / iterations,
+        allocated < 0 ? "n/a" : Long.toString(allocated / iterations));
+  }
+}
@@ -0,0 +1,42 @@
+package co.airbitz.fastcrypto;
+
+import java.nio.ByteBuffer;
+
+/**
+ * A desktop stand-in for the React Native module. JNI binds native methods by class and method
+ * name, so declaring the same natives here lets a desktop JVM load the real libfastcrypto without
+ * React Native or the Android SDK.
+ */
+public class RNFastCryptoModule {
+  static {
+    System.loadLibrary("fastcrypto");
+  }
+
+  public native String scryptJNI(String passwd, String salt, int N, int r, int p, int size);
+
+  public native String secp256k1EcPubkeyCreateJNI(String privateKeyHex, int compressed);
+
+  public native String secp256k1EcPrivkeyTweakAddJNI(String privateKeyHex, String tweakHex);
+
+  public native String secp256k1EcPubkeyTweakAddJNI(
+      String publicKeyHex, String tweakHex, int compressed);
+
+  public native boolean scryptIntoJNI(
+      ByteBuffer passwd,
+      int passwdLen,
+      ByteBuffer salt,
+      int saltLen,
+      int N,
+      int r,
+      int p,
+      ByteBuffer out,
+      int size);
+
+  public native int secp256k1EcPubkeyCreateIntoJNI(byte[] privateKey, int compressed, byte[] out);
+
+  public native boolean secp256k1EcPrivkeyTweakAddIntoJNI(
+      byte[] privateKey, byte[] tweak, byte[] out);
+
+  public native int secp256k1EcPubkeyTweakAddIntoJNI(
+      byte[] publicKey, byte[] tweak, int compressed, byte[] out);
+}
@@ -0,0 +1,26 @@
+#include <ReactCommon/CallInvokerHolder.h>
+#include <fbjni/fbjni.h>
+#include <jni.h>
+#include <jsi/jsi.h>
+
+#include "jsi/jsi-bindings.h"
+
+using namespace facebook;
+
+extern "C" JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *vm, void *) {
+    return jni::initialize(vm, [] {});
+}
+
+extern "C" JNIEXPORT void JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoJsiModule_nativeInstall(JNIEnv *env, jclass clazz,
+                                                                jlong jlRuntime,
+                                                                jobject joCallInvokerHolder) {
+    jsi::Runtime *runtime = reinterpret_cast<jsi::Runtime *>(jlRuntime);
+    jni::alias_ref<react::CallInvokerHolder::javaobject> holder{
+        static_cast<react::CallInvokerHolder::javaobject>(joCallInvokerHolder)};
+    std::shared_ptr<react::CallInvoker> callInvoker = holder->cthis()->getCallInvoker();
+
+    fastcrypto::installJsi(*runtime, [callInvoker](std::function<void()> callback) {
+        callInvoker->invokeAsync(std::move(callback));
+    });
+}
@@ -0,0 +1,37 @@
+package co.airbitz.fastcrypto;
+
+import java.nio.ByteBuffer;
+
+/**
+ * Conversions between the strings the React Native bridge speaks and the buffers our native
+ * methods take, using the vectorized codecs in libfastcrypto. This class has no Android
+ * dependencies, so the desktop JNI benchmark can use it.
+ */
+final class Bytes {
+  // The codecs live in the native core, next to the crypto they feed:
+  static {
+    System.loadLibrary("fastcrypto");
+  }
+
+  private Bytes() {}
+
+  /** Decodes base64, with or without padding, throwing IllegalArgumentException if it is invalid. */
+  static native byte[] fromBase64(String text);
+
+  /** Encodes bytes as padded base64, with no line breaks. */
+  static native String toBase64(byte[] data);
+
+  /** Decodes upper or lower-case hex, returning null if the string is not valid hex. */
+  static native byte[] fromHex(String hex);
+
+  /** Encodes the first `length` bytes as lower-case hex. */
+  static native String toHex(byte[] data, int length);
+
+  /** Copies bytes into a new direct buffer, which native code can read in place. */
+  static ByteBuffer direct(byte[] data) {
+    ByteBuffer out = ByteBuffer.allocateDirect(data.length);
+    out.put(data);
+    out.flip();
+    return out;
+  }
+}
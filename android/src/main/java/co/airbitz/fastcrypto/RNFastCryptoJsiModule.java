@@ -0,0 +1,43 @@
+package co.airbitz.fastcrypto;
+
+import com.facebook.react.bridge.JavaScriptContextHolder;
+import com.facebook.react.bridge.ReactApplicationContext;
+import com.facebook.react.bridge.ReactContextBaseJavaModule;
+import com.facebook.react.bridge.ReactMethod;
+import com.facebook.react.turbomodule.core.CallInvokerHolderImpl;
+
+/**
+ * Installs the JSI bindings from src/jsi, which let JavaScript pass ArrayBuffers straight to the
+ * native code instead of base64 strings over the bridge.
+ */
+public class RNFastCryptoJsiModule extends ReactContextBaseJavaModule {
+
+  static {
+    System.loadLibrary("fastcrypto");
+    System.loadLibrary("fastcryptojsi");
+  }
+
+  private static native void nativeInstall(long runtime, CallInvokerHolderImpl callInvokerHolder);
+
+  public RNFastCryptoJsiModule(ReactApplicationContext reactContext) {
+    super(reactContext);
+  }
+
+  @Override
+  public String getName() {
+    return "RNFastCryptoJsi";
+  }
+
+  /** Returns false if there is no JSI runtime to install into, such as under remote debugging. */
+  @ReactMethod(isBlockingSynchronousMethod = true)
+  public boolean install() {
+    ReactApplicationContext context = getReactApplicationContext();
+    JavaScriptContextHolder jsContext = context.getJavaScriptContextHolder();
+    if (jsContext == null || jsContext.get() == 0) return false;
+
+    CallInvokerHolderImpl callInvokerHolder =
+        (CallInvokerHolderImpl) context.getCatalystInstance().getJSCallInvokerHolder();
+    nativeInstall(jsContext.get(), callInvokerHolder);
+    return true;
+  }
+}
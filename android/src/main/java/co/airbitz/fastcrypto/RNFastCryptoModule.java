@@ -1,10 +1,11 @@
 package co.airbitz.fastcrypto;
 
-import android.util.Base64;
 import com.facebook.react.bridge.Promise;
 import com.facebook.react.bridge.ReactApplicationContext;
 import com.facebook.react.bridge.ReactContextBaseJavaModule;
 import com.facebook.react.bridge.ReactMethod;
+import com.facebook.react.bridge.ReadableArray;
+import java.nio.ByteBuffer;
 import javax.crypto.SecretKeyFactory;
 import javax.crypto.spec.PBEKeySpec;
 
@@ -24,6 +25,210 @@ public class RNFastCryptoModule extends ReactContextBaseJavaModule {
   public native String secp256k1EcPubkeyTweakAddJNI(
       String publicKeyHex, String tweakHex, int compressed);
 
+  public native boolean scryptIntoJNI(
+      ByteBuffer passwd,
+      int passwdLen,
+      ByteBuffer salt,
+      int saltLen,
+      int N,
+      int r,
+      int p,
+      ByteBuffer out,
+      int size);
+
+  public native int secp256k1EcPubkeyCreateIntoJNI(byte[] privateKey, int compressed, byte[] out);
+
+  public native boolean secp256k1EcPrivkeyTweakAddIntoJNI(
+      byte[] privateKey, byte[] tweak, byte[] out);
+
+  public native int secp256k1EcPubkeyTweakAddIntoJNI(
+      byte[] publicKey, byte[] tweak, int compressed, byte[] out);
+
+  public native byte[] secp256k1EcPubkeyCreateBatchJNI(
+      byte[] privateKeys, int count, int compressed, int threads);
+
+  public native byte[] secp256k1EcPrivkeyTweakAddBatchJNI(
+      byte[] privateKeys, byte[] tweaks, int count, int threads);
+
+  public native byte[] secp256k1EcdsaSignJNI(byte[] privateKey, byte[] msgHash, int der);
+
+  public native boolean secp256k1EcdsaVerifyJNI(
+      byte[] sig, int der, byte[] msgHash, byte[] publicKey, int strict);
+
+  public native byte[] secp256k1EcdsaVerifyBatchJNI(
+      byte[] sigs, byte[] msgHashes, byte[] publicKeys, int count, int strict, int threads);
+
+  public native byte[] secp256k1XonlyPubkeyCreateBatchJNI(
+      byte[] privateKeys, int count, int threads);
+
+  public native byte[] secp256k1TaprootTweakPubkeyBatchJNI(
+      byte[] internalKeys, byte[] merkleRoots, int count, int threads);
+
+  public native byte[] secp256k1TaprootTweakPrivkeyBatchJNI(
+      byte[] privateKeys, byte[] merkleRoots, int count, int threads);
+
+  public native byte[] secp256k1SchnorrSignBatchJNI(
+      byte[] privateKeys, byte[] msgs, byte[] auxRands, int count, int threads);
+
+  public native byte[] secp256k1SchnorrVerifyBatchJNI(
+      byte[] sigs, byte[] msgs, byte[] publicKeys, int count, int threads);
+
+  public native byte[] secp256k1EcdsaSignRecoverableBatchJNI(
+      byte[] privateKeys, byte[] msgHashes, int count, int threads);
+
+  public native byte[] secp256k1EcdsaRecoverBatchJNI(
+      byte[] sigs, byte[] msgHashes, int count, int format, int threads);
+
+  public native byte[] secp256k1EcdhJNI(byte[] privateKey, byte[] publicKey);
+
+  public native byte[] silentPaymentsScanJNI(
+      byte[] scanKey,
+      byte[] spendPublicKey,
+      byte[] labels,
+      byte[] tweaks,
+      byte[] inputHashes,
+      byte[] outputKeys,
+      byte[] outputCounts,
+      int threads);
+
+  public native byte[] musigPubkeyAggJNI(byte[] publicKeys, int sort);
+
+  public native byte[] musigPubkeyAggBatchJNI(
+      byte[] publicKeySets, int keysPerSet, int setCount, int sort, int threads);
+
+  public native byte[] musigPubkeyTweakAddJNI(byte[] keyaggCache, byte[] tweak, int xonly);
+
+  public native byte[] musigNonceGenJNI(
+      byte[] sessionRand, byte[] privateKey, byte[] publicKey, byte[] msg, byte[] keyaggCache);
+
+  public native byte[] musigNonceAggJNI(byte[] pubnonces);
+
+  public native byte[] musigPartialSignJNI(
+      int nonceHandle, byte[] privateKey, byte[] keyaggCache, byte[] aggnonce, byte[] msg);
+
+  public native void musigNonceReleaseJNI(int nonceHandle);
+
+  public native boolean musigPartialVerifyJNI(
+      byte[] partialSig,
+      byte[] pubnonce,
+      byte[] publicKey,
+      byte[] keyaggCache,
+      byte[] aggnonce,
+      byte[] msg);
+
+  public native byte[] musigPartialSigAggJNI(
+      byte[] partialSigs, byte[] keyaggCache, byte[] aggnonce, byte[] msg);
+
+  public native int secp256k1PubkeyHandleCreateJNI(byte[] publicKey);
+
+  public native int secp256k1PrivkeyHandleCreateJNI(byte[] privateKey);
+
+  public native int secp256k1HandlePubkeyJNI(int handle);
+
+  public native int secp256k1HandleTweakAddJNI(int handle, byte[] tweak);
+
+  public native int secp256k1HandleCombineJNI(int[] handles);
+
+  public native byte[] secp256k1HandleSerializeJNI(int handle, int compressed);
+
+  public native void secp256k1HandleReleaseJNI(int handle);
+
+  public native byte[] multisigDeriveBatchJNI(
+      byte[] xpubs, int m, int startIndex, int count, int scriptType, int threads);
+
+  public native byte[] aes256CbcEncryptJNI(byte[] key, byte[] iv, byte[] data, int pad);
+
+  public native byte[] aes256CbcDecryptJNI(byte[] key, byte[] iv, byte[] data, int pad);
+
+  public native byte[] aes256GcmEncryptJNI(byte[] key, byte[] iv, byte[] aad, byte[] data);
+
+  public native byte[] aes256GcmDecryptJNI(byte[] key, byte[] iv, byte[] aad, byte[] data);
+
+  public native boolean aesSetImplementationJNI(int implementation);
+
+  public native int aesGetImplementationJNI();
+
+  public native byte[] chacha20Poly1305EncryptJNI(
+      byte[] key, byte[] nonce, byte[] aad, byte[] data);
+
+  public native byte[] chacha20Poly1305DecryptJNI(
+      byte[] key, byte[] nonce, byte[] aad, byte[] data);
+
+  public native int chacha20Poly1305StreamCreateJNI(
+      byte[] key, byte[] nonce, byte[] aad, int decrypt);
+
+  public native byte[] chacha20Poly1305StreamUpdateJNI(int stream, byte[] data);
+
+  public native byte[] chacha20Poly1305StreamFinalJNI(int stream, byte[] tag);
+
+  public native void chacha20Poly1305StreamReleaseJNI(int stream);
+
+  public native boolean chacha20SetImplementationJNI(int implementation);
+
+  public native int chacha20GetImplementationJNI();
+
+  public native byte[] recordsDecryptBatchJNI(
+      byte[] key, byte[] records, byte[] recordLens, int threads);
+
+  public native byte[] recordsDecryptBatchScryptJNI(
+      byte[] password,
+      byte[] salt,
+      int N,
+      int r,
+      int p,
+      byte[] records,
+      byte[] recordLens,
+      int threads);
+
+  public native byte[] ed25519PubkeyCreateBatchJNI(byte[] privateKeys, int count, int threads);
+
+  public native byte[] ed25519SignJNI(byte[] privateKey, byte[] msg);
+
+  public native byte[] ed25519VerifyBatchJNI(
+      byte[] sigs, byte[] msgs, byte[] msgLens, byte[] publicKeys, int threads);
+
+  public native byte[] slip10Ed25519DeriveBatchJNI(
+      byte[] seed, byte[] paths, byte[] pathLens, int threads);
+
+  public native byte[] argon2idJNI(
+      byte[] password, byte[] salt, int t, int m, int p, int threads, int size);
+
+  public native boolean argon2SetImplementationJNI(int implementation);
+
+  public native int argon2GetImplementationJNI();
+
+  public native byte[] bip39MnemonicToSeedBatchJNI(
+      byte[] mnemonic, byte[] passphrases, byte[] passphraseLens, byte[] wordlist, int threads);
+
+  public native String addressEncodeBatchJNI(
+      int format, byte[] prefix, int version, byte[] payloads, byte[] payloadLens, int threads);
+
+  public native byte[] addressDecodeBatchJNI(
+      int format, byte[] prefix, String addresses, int threads);
+
+  public native byte[] randomBytesJNI(int size);
+
+  public native byte[] keysGenerateBatchJNI(int keyType, int count, int threads);
+
+  public native boolean poolSubmitJNI(int priority, Runnable task);
+
+  public native boolean poolConfigureJNI(int priority, int threads, int queueLimit, int[] cpus);
+
+  public native byte[] pipelineRunJNI(
+      byte[] steps, byte[] inputs, byte[] inputLens, int outputSlot);
+
+  public native byte[] statsSnapshotJNI();
+
+  public native void statsResetJNI();
+
+  public native boolean traceStartJNI(int maxEvents);
+
+  public native String traceStopJNI();
+
+  // Priority classes for the native worker pool, from native-crypto.h:
+  private static final int INTERACTIVE = 0;
+  private static final int BACKGROUND = 1;
+
   private final ReactApplicationContext reactContext;
 
   public RNFastCryptoModule(ReactApplicationContext reactContext) {
@@ -36,70 +241,1364 @@ public class RNFastCryptoModule extends ReactContextBaseJavaModule {
     return "RNFastCrypto";
   }
 
+  /**
+   * Runs a method body on the native worker pool, so slow crypto never holds up the React Native
+   * thread, and background work never holds up interactive work.
+   */
+  private void submit(int priority, Promise promise, Runnable task) {
+    if (!poolSubmitJNI(priority, task)) promise.reject("Err", "Too many pending calls");
+  }
+
   @ReactMethod
   public void pbkdf2Sha512(
       String data64, String salt64, int iterations, int keyLength, Promise promise) {
-    try {
-      byte[] data = Base64.decode(data64, Base64.DEFAULT);
-      byte[] salt = Base64.decode(salt64, Base64.DEFAULT);
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] data = Bytes.fromBase64(data64);
+            byte[] salt = Bytes.fromBase64(salt64);
 
-      // Pack our arguments into an object:
-      char[] dataChars = new String(data, "UTF-8").toCharArray();
-      PBEKeySpec keySpec = new PBEKeySpec(dataChars, salt, iterations, 8 * keyLength);
+            // Pack our arguments into an object:
+            char[] dataChars = new String(data, "UTF-8").toCharArray();
+            PBEKeySpec keySpec = new PBEKeySpec(dataChars, salt, iterations, 8 * keyLength);
 
-      SecretKeyFactory secretKeyFactory = SecretKeyFactory.getInstance("PBKDF2WithHmacSHA512");
-      byte[] out = secretKeyFactory.generateSecret(keySpec).getEncoded();
-      promise.resolve(Base64.encodeToString(out, Base64.NO_WRAP));
-    } catch (Exception e) {
-      promise.reject(e);
-    }
+            SecretKeyFactory secretKeyFactory =
+                SecretKeyFactory.getInstance("PBKDF2WithHmacSHA512");
+            byte[] out = secretKeyFactory.generateSecret(keySpec).getEncoded();
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject(e);
+          }
+        });
   }
 
   @ReactMethod
   public void scrypt(
       String passwd, String salt, Integer N, Integer r, Integer p, Integer size, Promise promise) {
-    try {
-      String reply = scryptJNI(passwd, salt, N, r, p, size); // test response from JNI
-      promise.resolve(reply);
-    } catch (Exception e) {
-      promise.reject("Err", e);
-    }
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            ByteBuffer passwdBuffer = Bytes.direct(Bytes.fromBase64(passwd));
+            ByteBuffer saltBuffer = Bytes.direct(Bytes.fromBase64(salt));
+            ByteBuffer outBuffer = ByteBuffer.allocateDirect(size);
+            boolean success =
+                scryptIntoJNI(
+                    passwdBuffer,
+                    passwdBuffer.capacity(),
+                    saltBuffer,
+                    saltBuffer.capacity(),
+                    N,
+                    r,
+                    p,
+                    outBuffer,
+                    size);
+            if (!success) throw new IllegalArgumentException("Invalid scrypt parameters");
+            byte[] out = new byte[size];
+            outBuffer.get(out);
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
   }
 
   @ReactMethod
   public void secp256k1EcPubkeyCreate(String privateKeyHex, Boolean compressed, Promise promise) {
-    int iCompressed = compressed ? 1 : 0;
-    try {
-      String reply =
-          secp256k1EcPubkeyCreateJNI(privateKeyHex, iCompressed); // test response from JNI
-      promise.resolve(reply);
-    } catch (Exception e) {
-      promise.reject("Err", e);
-    }
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          int iCompressed = compressed ? 1 : 0;
+          try {
+            byte[] privateKey = Bytes.fromHex(privateKeyHex);
+            byte[] publicKey = new byte[65];
+            int length =
+                privateKey == null
+                    ? 0
+                    : secp256k1EcPubkeyCreateIntoJNI(privateKey, iCompressed, publicKey);
+            promise.resolve(Bytes.toHex(publicKey, length));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
   }
 
   @ReactMethod
   public void secp256k1EcPrivkeyTweakAdd(String privateKeyHex, String tweakHex, Promise promise) {
-    try {
-      String reply =
-          secp256k1EcPrivkeyTweakAddJNI(privateKeyHex, tweakHex); // test response from JNI
-      promise.resolve(reply);
-    } catch (Exception e) {
-      promise.reject("Err", e);
-    }
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            // An invalid key or tweak gives back the original key:
+            byte[] privateKey = Bytes.fromHex(privateKeyHex);
+            byte[] tweak = Bytes.fromHex(tweakHex);
+            byte[] out = new byte[32];
+            boolean success =
+                privateKey != null
+                    && tweak != null
+                    && secp256k1EcPrivkeyTweakAddIntoJNI(privateKey, tweak, out);
+            promise.resolve(success ? Bytes.toHex(out, out.length) : privateKeyHex);
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
   }
 
   @ReactMethod
   public void secp256k1EcPubkeyTweakAdd(
       String publicKeyHex, String tweakHex, Boolean compressed, Promise promise) {
-    int iCompressed = compressed ? 1 : 0;
-    try {
-      String reply =
-          secp256k1EcPubkeyTweakAddJNI(
-              publicKeyHex, tweakHex, iCompressed); // test response from JNI
-      promise.resolve(reply);
-    } catch (Exception e) {
-      promise.reject("Err", e);
-    }
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            // Only compressed keys are supported:
+            byte[] publicKey = Bytes.fromHex(publicKeyHex);
+            byte[] tweak = Bytes.fromHex(tweakHex);
+            byte[] out = new byte[33];
+            int length =
+                compressed && publicKey != null && publicKey.length == 33 && tweak != null
+                    ? secp256k1EcPubkeyTweakAddIntoJNI(publicKey, tweak, 1, out)
+                    : 0;
+            promise.resolve(Bytes.toHex(out, length));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1EcPubkeyCreateBatch(
+      String privateKeys64, Integer count, Boolean compressed, Integer threads, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                secp256k1EcPubkeyCreateBatchJNI(
+                    Bytes.fromBase64(privateKeys64), count, compressed ? 1 : 0, threads);
+            if (out == null) throw new IllegalArgumentException("Invalid batch layout");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1EcPrivkeyTweakAddBatch(
+      String privateKeys64, String tweaks64, Integer count, Integer threads, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                secp256k1EcPrivkeyTweakAddBatchJNI(
+                    Bytes.fromBase64(privateKeys64), Bytes.fromBase64(tweaks64), count, threads);
+            if (out == null) throw new IllegalArgumentException("Invalid batch layout");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1EcdsaSign(
+      String privateKey64, String msgHash64, Boolean der, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] sig =
+                secp256k1EcdsaSignJNI(
+                    Bytes.fromBase64(privateKey64),
+                    Bytes.fromBase64(msgHash64),
+                    der ? 1 : 0);
+            if (sig == null) throw new IllegalArgumentException("Invalid private key");
+            promise.resolve(Bytes.toBase64(sig));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1EcdsaVerify(
+      String sig64,
+      Boolean der,
+      String msgHash64,
+      String publicKey64,
+      Boolean strict,
+      Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            boolean reply =
+                secp256k1EcdsaVerifyJNI(
+                    Bytes.fromBase64(sig64),
+                    der ? 1 : 0,
+                    Bytes.fromBase64(msgHash64),
+                    Bytes.fromBase64(publicKey64),
+                    strict ? 1 : 0);
+            promise.resolve(reply);
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1EcdsaVerifyBatch(
+      String sigs64,
+      String msgHashes64,
+      String publicKeys64,
+      Integer count,
+      Boolean strict,
+      Integer threads,
+      Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] results =
+                secp256k1EcdsaVerifyBatchJNI(
+                    Bytes.fromBase64(sigs64),
+                    Bytes.fromBase64(msgHashes64),
+                    Bytes.fromBase64(publicKeys64),
+                    count,
+                    strict ? 1 : 0,
+                    threads);
+            if (results == null) throw new IllegalArgumentException("Invalid batch layout");
+            promise.resolve(Bytes.toBase64(results));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1XonlyPubkeyCreateBatch(
+      String privateKeys64, Integer count, Integer threads, Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] publicKeys =
+                secp256k1XonlyPubkeyCreateBatchJNI(
+                    Bytes.fromBase64(privateKeys64), count, threads);
+            if (publicKeys == null) throw new IllegalArgumentException("Invalid private key");
+            promise.resolve(Bytes.toBase64(publicKeys));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1TaprootTweakPubkeyBatch(
+      String internalKeys64, String merkleRoots64, Integer count, Integer threads, Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                secp256k1TaprootTweakPubkeyBatchJNI(
+                    Bytes.fromBase64(internalKeys64),
+                    Bytes.fromBase64(merkleRoots64),
+                    count,
+                    threads);
+            if (out == null) throw new IllegalArgumentException("Invalid internal key");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1TaprootTweakPrivkeyBatch(
+      String privateKeys64, String merkleRoots64, Integer count, Integer threads, Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                secp256k1TaprootTweakPrivkeyBatchJNI(
+                    Bytes.fromBase64(privateKeys64),
+                    Bytes.fromBase64(merkleRoots64),
+                    count,
+                    threads);
+            if (out == null) throw new IllegalArgumentException("Invalid private key");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1SchnorrSignBatch(
+      String privateKeys64,
+      String msgs64,
+      String auxRands64,
+      Integer count,
+      Integer threads,
+      Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] sigs =
+                secp256k1SchnorrSignBatchJNI(
+                    Bytes.fromBase64(privateKeys64),
+                    Bytes.fromBase64(msgs64),
+                    Bytes.fromBase64(auxRands64),
+                    count,
+                    threads);
+            if (sigs == null) throw new IllegalArgumentException("Invalid private key");
+            promise.resolve(Bytes.toBase64(sigs));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1SchnorrVerifyBatch(
+      String sigs64,
+      String msgs64,
+      String publicKeys64,
+      Integer count,
+      Integer threads,
+      Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] results =
+                secp256k1SchnorrVerifyBatchJNI(
+                    Bytes.fromBase64(sigs64),
+                    Bytes.fromBase64(msgs64),
+                    Bytes.fromBase64(publicKeys64),
+                    count,
+                    threads);
+            if (results == null) throw new IllegalArgumentException("Invalid batch layout");
+            promise.resolve(Bytes.toBase64(results));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1EcdsaSignRecoverableBatch(
+      String privateKeys64, String msgHashes64, Integer count, Integer threads, Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] sigs =
+                secp256k1EcdsaSignRecoverableBatchJNI(
+                    Bytes.fromBase64(privateKeys64),
+                    Bytes.fromBase64(msgHashes64),
+                    count,
+                    threads);
+            if (sigs == null) throw new IllegalArgumentException("Invalid private key");
+            promise.resolve(Bytes.toBase64(sigs));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1EcdsaRecoverBatch(
+      String sigs64,
+      String msgHashes64,
+      Integer count,
+      Integer format,
+      Integer threads,
+      Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                secp256k1EcdsaRecoverBatchJNI(
+                    Bytes.fromBase64(sigs64),
+                    Bytes.fromBase64(msgHashes64),
+                    count,
+                    format,
+                    threads);
+            if (out == null) throw new IllegalArgumentException("Invalid batch layout");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1Ecdh(String privateKey64, String publicKey64, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] secret =
+                secp256k1EcdhJNI(
+                    Bytes.fromBase64(privateKey64),
+                    Bytes.fromBase64(publicKey64));
+            if (secret == null) throw new IllegalArgumentException("Invalid key");
+            promise.resolve(Bytes.toBase64(secret));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void silentPaymentsScan(
+      String scanKey64,
+      String spendPublicKey64,
+      String labels64,
+      String tweaks64,
+      String inputHashes64,
+      String outputKeys64,
+      String outputCounts64,
+      Integer threads,
+      Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] matches =
+                silentPaymentsScanJNI(
+                    Bytes.fromBase64(scanKey64),
+                    Bytes.fromBase64(spendPublicKey64),
+                    Bytes.fromBase64(labels64),
+                    Bytes.fromBase64(tweaks64),
+                    Bytes.fromBase64(inputHashes64),
+                    Bytes.fromBase64(outputKeys64),
+                    Bytes.fromBase64(outputCounts64),
+                    threads);
+            if (matches == null) throw new IllegalArgumentException("Invalid scan layout");
+            promise.resolve(Bytes.toBase64(matches));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void musigPubkeyAgg(String publicKeys64, Boolean sort, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out = musigPubkeyAggJNI(Bytes.fromBase64(publicKeys64), sort ? 1 : 0);
+            if (out == null) throw new IllegalArgumentException("Invalid public key");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void musigPubkeyAggBatch(
+      String publicKeySets64,
+      Integer keysPerSet,
+      Integer setCount,
+      Boolean sort,
+      Integer threads,
+      Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                musigPubkeyAggBatchJNI(
+                    Bytes.fromBase64(publicKeySets64),
+                    keysPerSet,
+                    setCount,
+                    sort ? 1 : 0,
+                    threads);
+            if (out == null) throw new IllegalArgumentException("Invalid public key");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void musigPubkeyTweakAdd(
+      String keyaggCache64, String tweak64, Boolean xonly, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                musigPubkeyTweakAddJNI(
+                    Bytes.fromBase64(keyaggCache64),
+                    Bytes.fromBase64(tweak64),
+                    xonly ? 1 : 0);
+            if (out == null) throw new IllegalArgumentException("Invalid tweak");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void musigNonceGen(
+      String sessionRand64,
+      String privateKey64,
+      String publicKey64,
+      String msg64,
+      String keyaggCache64,
+      Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                musigNonceGenJNI(
+                    Bytes.fromBase64(sessionRand64),
+                    Bytes.fromBase64(privateKey64),
+                    Bytes.fromBase64(publicKey64),
+                    Bytes.fromBase64(msg64),
+                    Bytes.fromBase64(keyaggCache64));
+            if (out == null) throw new IllegalArgumentException("Invalid nonce inputs");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void musigNonceAgg(String pubnonces64, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out = musigNonceAggJNI(Bytes.fromBase64(pubnonces64));
+            if (out == null) throw new IllegalArgumentException("Invalid public nonce");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void musigPartialSign(
+      Integer nonceHandle,
+      String privateKey64,
+      String keyaggCache64,
+      String aggnonce64,
+      String msg64,
+      Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                musigPartialSignJNI(
+                    nonceHandle,
+                    Bytes.fromBase64(privateKey64),
+                    Bytes.fromBase64(keyaggCache64),
+                    Bytes.fromBase64(aggnonce64),
+                    Bytes.fromBase64(msg64));
+            if (out == null) throw new IllegalArgumentException("Cannot create partial signature");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void musigNonceRelease(Integer nonceHandle, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          musigNonceReleaseJNI(nonceHandle);
+          promise.resolve(null);
+        });
+  }
+
+  @ReactMethod
+  public void musigPartialVerify(
+      String partialSig64,
+      String pubnonce64,
+      String publicKey64,
+      String keyaggCache64,
+      String aggnonce64,
+      String msg64,
+      Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            boolean reply =
+                musigPartialVerifyJNI(
+                    Bytes.fromBase64(partialSig64),
+                    Bytes.fromBase64(pubnonce64),
+                    Bytes.fromBase64(publicKey64),
+                    Bytes.fromBase64(keyaggCache64),
+                    Bytes.fromBase64(aggnonce64),
+                    Bytes.fromBase64(msg64));
+            promise.resolve(reply);
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void musigPartialSigAgg(
+      String partialSigs64,
+      String keyaggCache64,
+      String aggnonce64,
+      String msg64,
+      Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                musigPartialSigAggJNI(
+                    Bytes.fromBase64(partialSigs64),
+                    Bytes.fromBase64(keyaggCache64),
+                    Bytes.fromBase64(aggnonce64),
+                    Bytes.fromBase64(msg64));
+            if (out == null) throw new IllegalArgumentException("Cannot aggregate signatures");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1KeyHandleCreate(String key64, Boolean isPrivate, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] key = Bytes.fromBase64(key64);
+            int handle =
+                isPrivate
+                    ? secp256k1PrivkeyHandleCreateJNI(key)
+                    : secp256k1PubkeyHandleCreateJNI(key);
+            if (handle == 0) throw new IllegalArgumentException("Invalid key");
+            promise.resolve(handle);
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1KeyHandlePublicKey(Integer handle, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            int out = secp256k1HandlePubkeyJNI(handle);
+            if (out == 0) throw new IllegalArgumentException("Invalid private key handle");
+            promise.resolve(out);
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1KeyHandleTweakAdd(Integer handle, String tweak64, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            int out = secp256k1HandleTweakAddJNI(handle, Bytes.fromBase64(tweak64));
+            if (out == 0) throw new IllegalArgumentException("Invalid key handle or tweak");
+            promise.resolve(out);
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1KeyHandleCombine(ReadableArray handles, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            int[] items = new int[handles.size()];
+            for (int i = 0; i < items.length; ++i) items[i] = handles.getInt(i);
+            int out = secp256k1HandleCombineJNI(items);
+            if (out == 0) throw new IllegalArgumentException("Invalid public key handles");
+            promise.resolve(out);
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1KeyHandleSerialize(Integer handle, Boolean compressed, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out = secp256k1HandleSerializeJNI(handle, compressed ? 1 : 0);
+            if (out == null) throw new IllegalArgumentException("Invalid key handle");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void secp256k1KeyHandleRelease(Integer handle, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          secp256k1HandleReleaseJNI(handle);
+          promise.resolve(null);
+        });
+  }
+
+  @ReactMethod
+  public void multisigDeriveBatch(
+      String xpubs64,
+      Integer m,
+      Integer startIndex,
+      Integer count,
+      Integer scriptType,
+      Integer threads,
+      Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                multisigDeriveBatchJNI(
+                    Bytes.fromBase64(xpubs64), m, startIndex, count, scriptType, threads);
+            if (out == null) throw new IllegalArgumentException("Cannot derive multisig scripts");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void aes256CbcEncrypt(
+      String key64, String iv64, String data64, Boolean pad, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                aes256CbcEncryptJNI(
+                    Bytes.fromBase64(key64),
+                    Bytes.fromBase64(iv64),
+                    Bytes.fromBase64(data64),
+                    pad ? 1 : 0);
+            if (out == null) throw new IllegalArgumentException("Cannot encrypt");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void aes256CbcDecrypt(
+      String key64, String iv64, String data64, Boolean pad, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                aes256CbcDecryptJNI(
+                    Bytes.fromBase64(key64),
+                    Bytes.fromBase64(iv64),
+                    Bytes.fromBase64(data64),
+                    pad ? 1 : 0);
+            if (out == null) throw new IllegalArgumentException("Cannot decrypt");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void aes256GcmEncrypt(
+      String key64, String iv64, String aad64, String data64, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                aes256GcmEncryptJNI(
+                    Bytes.fromBase64(key64),
+                    Bytes.fromBase64(iv64),
+                    Bytes.fromBase64(aad64),
+                    Bytes.fromBase64(data64));
+            if (out == null) throw new IllegalArgumentException("Cannot encrypt");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void aes256GcmDecrypt(
+      String key64, String iv64, String aad64, String data64, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                aes256GcmDecryptJNI(
+                    Bytes.fromBase64(key64),
+                    Bytes.fromBase64(iv64),
+                    Bytes.fromBase64(aad64),
+                    Bytes.fromBase64(data64));
+            if (out == null) throw new IllegalArgumentException("Cannot decrypt");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void aesSetImplementation(Integer implementation, Promise promise) {
+    promise.resolve(aesSetImplementationJNI(implementation));
+  }
+
+  @ReactMethod
+  public void aesGetImplementation(Promise promise) {
+    promise.resolve(aesGetImplementationJNI());
+  }
+
+  @ReactMethod
+  public void chacha20Poly1305Encrypt(
+      String key64, String nonce64, String aad64, String data64, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                chacha20Poly1305EncryptJNI(
+                    Bytes.fromBase64(key64),
+                    Bytes.fromBase64(nonce64),
+                    Bytes.fromBase64(aad64),
+                    Bytes.fromBase64(data64));
+            if (out == null) throw new IllegalArgumentException("Cannot encrypt");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void chacha20Poly1305Decrypt(
+      String key64, String nonce64, String aad64, String data64, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                chacha20Poly1305DecryptJNI(
+                    Bytes.fromBase64(key64),
+                    Bytes.fromBase64(nonce64),
+                    Bytes.fromBase64(aad64),
+                    Bytes.fromBase64(data64));
+            if (out == null) throw new IllegalArgumentException("Cannot decrypt");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void chacha20Poly1305StreamCreate(
+      String key64, String nonce64, String aad64, Boolean decrypt, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            int stream =
+                chacha20Poly1305StreamCreateJNI(
+                    Bytes.fromBase64(key64),
+                    Bytes.fromBase64(nonce64),
+                    Bytes.fromBase64(aad64),
+                    decrypt ? 1 : 0);
+            if (stream == 0) throw new IllegalArgumentException("Cannot open stream");
+            promise.resolve(stream);
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void chacha20Poly1305StreamUpdate(Integer stream, String data64, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                chacha20Poly1305StreamUpdateJNI(stream, Bytes.fromBase64(data64));
+            if (out == null) throw new IllegalArgumentException("Invalid stream");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void chacha20Poly1305StreamFinal(Integer stream, String tag64, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out = chacha20Poly1305StreamFinalJNI(stream, Bytes.fromBase64(tag64));
+            if (out == null) throw new IllegalArgumentException("Invalid stream or tag");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void chacha20Poly1305StreamRelease(Integer stream, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          chacha20Poly1305StreamReleaseJNI(stream);
+          promise.resolve(null);
+        });
+  }
+
+  @ReactMethod
+  public void chacha20SetImplementation(Integer implementation, Promise promise) {
+    promise.resolve(chacha20SetImplementationJNI(implementation));
+  }
+
+  @ReactMethod
+  public void chacha20GetImplementation(Promise promise) {
+    promise.resolve(chacha20GetImplementationJNI());
+  }
+
+  @ReactMethod
+  public void recordsDecryptBatch(
+      String key64, String records64, String recordLens64, Integer threads, Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                recordsDecryptBatchJNI(
+                    Bytes.fromBase64(key64),
+                    Bytes.fromBase64(records64),
+                    Bytes.fromBase64(recordLens64),
+                    threads);
+            if (out == null) throw new IllegalArgumentException("Invalid record layout");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void recordsDecryptBatchScrypt(
+      String password64,
+      String salt64,
+      Integer N,
+      Integer r,
+      Integer p,
+      String records64,
+      String recordLens64,
+      Integer threads,
+      Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                recordsDecryptBatchScryptJNI(
+                    Bytes.fromBase64(password64),
+                    Bytes.fromBase64(salt64),
+                    N,
+                    r,
+                    p,
+                    Bytes.fromBase64(records64),
+                    Bytes.fromBase64(recordLens64),
+                    threads);
+            if (out == null) throw new IllegalArgumentException("Invalid record layout");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void ed25519PubkeyCreateBatch(
+      String privateKeys64, Integer count, Integer threads, Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] publicKeys =
+                ed25519PubkeyCreateBatchJNI(Bytes.fromBase64(privateKeys64), count, threads);
+            if (publicKeys == null) throw new IllegalArgumentException("Invalid private key");
+            promise.resolve(Bytes.toBase64(publicKeys));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void ed25519Sign(String privateKey64, String msg64, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] sig =
+                ed25519SignJNI(
+                    Bytes.fromBase64(privateKey64), Bytes.fromBase64(msg64));
+            if (sig == null) throw new IllegalArgumentException("Invalid private key");
+            promise.resolve(Bytes.toBase64(sig));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void ed25519VerifyBatch(
+      String sigs64,
+      String msgs64,
+      String msgLens64,
+      String publicKeys64,
+      Integer threads,
+      Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] results =
+                ed25519VerifyBatchJNI(
+                    Bytes.fromBase64(sigs64),
+                    Bytes.fromBase64(msgs64),
+                    Bytes.fromBase64(msgLens64),
+                    Bytes.fromBase64(publicKeys64),
+                    threads);
+            if (results == null) throw new IllegalArgumentException("Invalid batch layout");
+            promise.resolve(Bytes.toBase64(results));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void slip10Ed25519DeriveBatch(
+      String seed64, String paths64, String pathLens64, Integer threads, Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] keys =
+                slip10Ed25519DeriveBatchJNI(
+                    Bytes.fromBase64(seed64),
+                    Bytes.fromBase64(paths64),
+                    Bytes.fromBase64(pathLens64),
+                    threads);
+            if (keys == null) throw new IllegalArgumentException("Invalid derivation path");
+            promise.resolve(Bytes.toBase64(keys));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void argon2id(
+      String password64,
+      String salt64,
+      Integer t,
+      Integer m,
+      Integer p,
+      Integer threads,
+      Integer size,
+      Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                argon2idJNI(
+                    Bytes.fromBase64(password64),
+                    Bytes.fromBase64(salt64),
+                    t,
+                    m,
+                    p,
+                    threads,
+                    size);
+            if (out == null) throw new IllegalArgumentException("Invalid Argon2 parameters");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void argon2SetImplementation(Integer implementation, Promise promise) {
+    promise.resolve(argon2SetImplementationJNI(implementation));
+  }
+
+  @ReactMethod
+  public void argon2GetImplementation(Promise promise) {
+    promise.resolve(argon2GetImplementationJNI());
+  }
+
+  @ReactMethod
+  public void bip39MnemonicToSeedBatch(
+      String mnemonic64,
+      String passphrases64,
+      String passphraseLens64,
+      String wordlist64,
+      Integer threads,
+      Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                bip39MnemonicToSeedBatchJNI(
+                    Bytes.fromBase64(mnemonic64),
+                    Bytes.fromBase64(passphrases64),
+                    Bytes.fromBase64(passphraseLens64),
+                    Bytes.fromBase64(wordlist64),
+                    threads);
+            if (out == null) throw new IllegalArgumentException("Invalid passphrase layout");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void addressEncodeBatch(
+      Integer format,
+      String prefix64,
+      Integer version,
+      String payloads64,
+      String payloadLens64,
+      Integer threads,
+      Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            String out =
+                addressEncodeBatchJNI(
+                    format,
+                    Bytes.fromBase64(prefix64),
+                    version,
+                    Bytes.fromBase64(payloads64),
+                    Bytes.fromBase64(payloadLens64),
+                    threads);
+            if (out == null) throw new IllegalArgumentException("Invalid payload layout");
+            promise.resolve(out);
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void addressDecodeBatch(
+      Integer format, String prefix64, String addresses, Integer threads, Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                addressDecodeBatchJNI(
+                    format, Bytes.fromBase64(prefix64), addresses, threads);
+            if (out == null) throw new IllegalArgumentException("Invalid addresses");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void randomBytes(Integer size, Promise promise) {
+    submit(
+        INTERACTIVE,
+        promise,
+        () -> {
+          try {
+            byte[] out = randomBytesJNI(size);
+            if (out == null) throw new IllegalArgumentException("Cannot generate random bytes");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void keysGenerateBatch(Integer keyType, Integer count, Integer threads, Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] out = keysGenerateBatchJNI(keyType, count, threads);
+            if (out == null) throw new IllegalArgumentException("Cannot generate keys");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void poolConfigure(
+      Integer priority, Integer threads, Integer queueLimit, ReadableArray cpus, Promise promise) {
+    int[] cpuList = new int[cpus.size()];
+    for (int i = 0; i < cpuList.length; ++i) cpuList[i] = cpus.getInt(i);
+    promise.resolve(poolConfigureJNI(priority, threads, queueLimit, cpuList));
+  }
+
+  @ReactMethod
+  public void pipelineRun(
+      String steps64, String inputs64, String inputLens64, Integer outputSlot, Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          try {
+            byte[] out =
+                pipelineRunJNI(
+                    Bytes.fromBase64(steps64),
+                    Bytes.fromBase64(inputs64),
+                    Bytes.fromBase64(inputLens64),
+                    outputSlot);
+            if (out == null) throw new IllegalArgumentException("Invalid pipeline layout");
+            promise.resolve(Bytes.toBase64(out));
+          } catch (Exception e) {
+            promise.reject("Err", e);
+          }
+        });
+  }
+
+  @ReactMethod
+  public void statsSnapshot(Promise promise) {
+    promise.resolve(Bytes.toBase64(statsSnapshotJNI()));
+  }
+
+  @ReactMethod
+  public void statsReset(Promise promise) {
+    statsResetJNI();
+    promise.resolve(null);
+  }
+
+  @ReactMethod
+  public void traceStart(Integer maxEvents, Promise promise) {
+    promise.resolve(traceStartJNI(maxEvents));
+  }
+
+  @ReactMethod
+  public void traceStop(Promise promise) {
+    submit(
+        BACKGROUND,
+        promise,
+        () -> {
+          promise.resolve(traceStopJNI());
+        });
   }
 }
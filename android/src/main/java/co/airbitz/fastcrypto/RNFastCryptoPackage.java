@@ -12,7 +12,8 @@ import java.util.List;
 public class RNFastCryptoPackage implements ReactPackage {
   @Override
   public List<NativeModule> createNativeModules(ReactApplicationContext reactContext) {
-    return Arrays.<NativeModule>asList(new RNFastCryptoModule(reactContext));
+    return Arrays.<NativeModule>asList(
+        new RNFastCryptoModule(reactContext), new RNFastCryptoJsiModule(reactContext));
   }
 
   public List<Class<? extends JavaScriptModule>> createJSModules() {
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+/*
+ * Measures base64 and hex throughput for each codec implementation this
+ * CPU can run, at a few message sizes typical of the bridge traffic.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "encoding/codec.h"
+
+static const struct {
+	const char * name;
+	int impl;
+} impls[] = {
+	{ "portable", CODEC_IMPL_PORTABLE },
+	{ "ssse3", CODEC_IMPL_SSSE3 },
+	{ "avx2", CODEC_IMPL_AVX2 },
+	{ "neon", CODEC_IMPL_NEON },
+};
+
+static const size_t sizes[] = { 32, 1024, 65536 };
+
+/* Aim for about this much data per measurement. */
+#define BENCH_BYTES	(256 * 1024 * 1024)
+
+static double
+now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((double)ts.tv_sec + (double)ts.tv_nsec / 1e9);
+}
+
+static void
+report(const char * impl, const char * what, size_t size, size_t bytes,
+    double seconds)
+{
+
+	printf("%-8s  %-13s  %6zu  %9.1f MB/s\n", impl, what, size,
+	    (double)bytes / seconds / 1e6);
+}
+
+static int
+bench(const char * impl, size_t size)
+{
+	uint8_t * raw, * back;
+	char * text;
+	size_t rounds = BENCH_BYTES / size;
+	size_t i, outlen;
+	double start;
+
+	if (((raw = malloc(size)) == NULL) ||
+	    ((back = malloc(BASE64_DECODED_MAX(BASE64_ENCODED_LEN(size)))) ==
+	    NULL) ||
+	    ((text = malloc(BASE64_ENCODED_LEN(size) + 2 * size)) == NULL)) {
+		fprintf(stderr, "Out of memory\n");
+		return (-1);
+	}
+	for (i = 0; i < size; i++)
+		raw[i] = (uint8_t)(i * 131 + 7);
+
+	start = now();
+	for (i = 0; i < rounds; i++)
+		Base64_Encode(raw, size, text);
+	report(impl, "base64 encode", size, rounds * size, now() - start);
+
+	start = now();
+	for (i = 0; i < rounds; i++) {
+		if (Base64_Decode(text, BASE64_ENCODED_LEN(size), back,
+		    &outlen, NULL))
+			goto err;
+	}
+	report(impl, "base64 decode", size, rounds * size, now() - start);
+	if ((outlen != size) || memcmp(raw, back, size))
+		goto err;
+
+	start = now();
+	for (i = 0; i < rounds; i++)
+		Hex_Encode(raw, size, text);
+	report(impl, "hex encode", size, rounds * size, now() - start);
+
+	start = now();
+	for (i = 0; i < rounds; i++) {
+		if (Hex_Decode(text, 2 * size, back, NULL))
+			goto err;
+	}
+	report(impl, "hex decode", size, rounds * size, now() - start);
+	if (memcmp(raw, back, size))
+		goto err;
+
+	free(text);
+	free(back);
+	free(raw);
+	return (0);
+
+err:
+	fprintf(stderr, "%s: round trip failed at %zu bytes\n", impl, size);
+	free(text);
+	free(back);
+	free(raw);
+	return (-1);
+}
+
+int
+main(void)
+{
+	size_t i, j;
+
+	for (i = 0; i < sizeof(impls) / sizeof(impls[0]); i++) {
+		if (Codec_SetImplementation(impls[i].impl)) {
+			printf("%-8s  not available\n", impls[i].name);
+			continue;
+		}
+		for (j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++) {
+			if (bench(impls[i].name, sizes[j]))
+				exit(1);
+		}
+	}
+	return (0);
+}
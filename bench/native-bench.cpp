@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+/*
+ * Times the native core on the host: scrypt across a sweep of cost
+ * parameters, PBKDF2, the hash functions, and the secp256k1 key and
+ * signature calls. Results go to stdout as JSON or CSV, so runs from
+ * different commits can be saved and compared.
+ *
+ * Usage: native-bench [--format json|csv] [--output file] [--warmup n]
+ *                     [--reps n] [--filter text] [--quick] [--list]
+ */
+
+#include "native-crypto.h"
+
+extern "C" {
+#include "hash/blake2b.h"
+#include "hash/keccak.h"
+#include "hash/ripemd160.h"
+#include "hash/sha512.h"
+#include "scrypt/sha256.h"
+}
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+// Calls quicker than this run in batches, so the clock's own
+// overhead stays out of the numbers:
+const double minSampleNs = 200000;
+
+struct Benchmark {
+    std::string name;
+    std::string params;
+    // Input bytes per call, for throughput, or 0:
+    size_t bytes;
+    // Left out by --quick:
+    bool slow;
+    std::function<void()> run;
+};
+
+struct Options {
+    std::string format = "json";
+    std::string output;
+    std::string filter;
+    unsigned warmup = 3;
+    unsigned reps = 30;
+    bool quick = false;
+    bool list = false;
+};
+
+struct Result {
+    const Benchmark *bench;
+    size_t batch;
+    // Nanoseconds per call, one entry per sample:
+    std::vector<double> samples;
+};
+
+static double elapsedNs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+/**
+ * Returns the given percentile of some samples, using the nearest rank.
+ */
+static double percentile(const std::vector<double> &sorted, double p)
+{
+    size_t rank = (size_t) (p / 100 * sorted.size() + 0.5);
+    return sorted[std::min(sorted.size() - 1, rank == 0 ? 0 : rank - 1)];
+}
+
+static std::vector<uint8_t> pattern(size_t size, uint8_t seed)
+{
+    std::vector<uint8_t> out(size);
+    for (size_t i = 0; i < size; ++i) out[i] = (uint8_t) (i * 131 + seed);
+    return out;
+}
+
+static std::string sizeName(size_t size)
+{
+    return size >= 1024 ? std::to_string(size / 1024) + "KiB" : std::to_string(size) + "B";
+}
+
+static void addScrypt(std::vector<Benchmark> &benches)
+{
+    static const struct {
+        uint64_t N;
+        uint32_t r;
+        uint32_t p;
+        bool slow;
+    } sweep[] = {
+        { 1024, 8, 1, false },
+        { 4096, 8, 1, false },
+        { 16384, 8, 1, false },
+        { 32768, 8, 1, true },
+        { 65536, 8, 1, true },
+        { 16384, 1, 1, false },
+        { 16384, 16, 1, true },
+        { 16384, 8, 4, true },
+    };
+    for (const auto &cost : sweep) {
+        char params[64];
+        snprintf(params, sizeof(params), "N=%llu r=%u p=%u",
+            (unsigned long long) cost.N, cost.r, cost.p);
+        uint64_t N = cost.N;
+        uint32_t r = cost.r, p = cost.p;
+        benches.push_back({ "scrypt", params, 0, cost.slow, [N, r, p]() {
+            static const uint8_t passwd[] = "correct horse battery staple";
+            static const uint8_t salt[32] = { 1 };
+            uint8_t out[32];
+            fast_crypto_scrypt(passwd, sizeof(passwd) - 1, salt, sizeof(salt), N, r, p, out, sizeof(out));
+        } });
+    }
+}
+
+static void addPbkdf2(std::vector<Benchmark> &benches)
+{
+    static const uint8_t passwd[] = "scissors invite lock maple supreme raw rapid void";
+    static const uint8_t salt[] = "mnemonicTREZOR";
+
+    // BIP39 seeds use 2048 rounds of HMAC-SHA512:
+    for (uint64_t rounds : { 1, 2048 }) {
+        benches.push_back({ "pbkdf2-sha256", "c=" + std::to_string(rounds) + " len=32", 0, false, [rounds]() {
+            uint8_t out[32];
+            PBKDF2_SHA256(passwd, sizeof(passwd) - 1, salt, sizeof(salt) - 1, rounds, out, sizeof(out));
+        } });
+        benches.push_back({ "pbkdf2-sha512", "c=" + std::to_string(rounds) + " len=64", 0, false, [rounds]() {
+            uint8_t out[64];
+            PBKDF2_SHA512(passwd, sizeof(passwd) - 1, salt, sizeof(salt) - 1, rounds, out, sizeof(out));
+        } });
+    }
+}
+
+static void addHashes(std::vector<Benchmark> &benches)
+{
+    for (size_t size : { (size_t) 32, (size_t) 1024, (size_t) 65536 }) {
+        // Shared by the lambdas, and freed when the process exits:
+        const uint8_t *data = (new std::vector<uint8_t>(pattern(size, 7)))->data();
+        std::string params = sizeName(size);
+
+        benches.push_back({ "sha256", params, size, false, [data, size]() {
+            SHA256_CTX ctx;
+            unsigned char hash[32];
+            SHA256_Init(&ctx);
+            SHA256_Update(&ctx, data, size);
+            SHA256_Final(hash, &ctx);
+        } });
+        benches.push_back({ "sha512", params, size, false, [data, size]() {
+            SHA512_CTX ctx;
+            unsigned char hash[64];
+            SHA512_Init(&ctx);
+            SHA512_Update(&ctx, data, size);
+            SHA512_Final(hash, &ctx);
+        } });
+        benches.push_back({ "hmac-sha512", params, size, false, [data, size]() {
+            unsigned char mac[64];
+            HMAC_SHA512(data, 32, data, size, mac);
+        } });
+        benches.push_back({ "keccak256", params, size, false, [data, size]() {
+            uint8_t hash[32];
+            fast_crypto_keccak256(data, size, hash);
+        } });
+        benches.push_back({ "ripemd160", params, size, false, [data, size]() {
+            unsigned char hash[20];
+            RIPEMD160(data, size, hash);
+        } });
+        benches.push_back({ "hash160", params, size, false, [data, size]() {
+            unsigned char hash[20];
+            HASH160(data, size, hash);
+        } });
+        benches.push_back({ "blake2b", params, size, false, [data, size]() {
+            uint8_t hash[64];
+            BLAKE2b(data, size, hash, sizeof(hash));
+        } });
+    }
+}
+
+static void addSecp256k1(std::vector<Benchmark> &benches)
+{
+    // Fixed keys, so every run does the same work:
+    static uint8_t privateKey[32], tweak[32], msgHash[32];
+    static uint8_t publicKey[33], xonlyPublicKey[32];
+    static uint8_t ecdsaSig[64], schnorrSig[64];
+    for (int i = 0; i < 32; ++i) {
+        privateKey[i] = (uint8_t) (i + 1);
+        tweak[i] = (uint8_t) (0x40 + i);
+        msgHash[i] = (uint8_t) (0xa0 + i);
+    }
+    size_t sigLen;
+    if (fast_crypto_secp256k1_pubkey_create(privateKey, 1, publicKey) != sizeof(publicKey) ||
+        !fast_crypto_secp256k1_xonly_pubkey_create(privateKey, xonlyPublicKey) ||
+        !fast_crypto_secp256k1_ecdsa_sign(privateKey, msgHash, ecdsaSig, &sigLen, 0) ||
+        !fast_crypto_secp256k1_schnorr_sign(privateKey, msgHash, NULL, schnorrSig)) {
+        fprintf(stderr, "Could not set up the secp256k1 keys\n");
+        exit(1);
+    }
+
+    benches.push_back({ "secp256k1-pubkey-create", "compressed", 0, false, []() {
+        uint8_t out[33];
+        fast_crypto_secp256k1_pubkey_create(privateKey, 1, out);
+    } });
+    benches.push_back({ "secp256k1-pubkey-create", "uncompressed", 0, false, []() {
+        uint8_t out[65];
+        fast_crypto_secp256k1_pubkey_create(privateKey, 0, out);
+    } });
+    // The hex calls the bridges used to make:
+    benches.push_back({ "secp256k1-pubkey-create", "hex", 0, false, []() {
+        char out[2 * 33 + 1];
+        fast_crypto_secp256k1_ec_pubkey_create(
+            "0102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f20", out, 1);
+    } });
+    benches.push_back({ "secp256k1-privkey-tweak-add", "", 0, false, []() {
+        uint8_t out[32];
+        fast_crypto_secp256k1_privkey_tweak_add(privateKey, tweak, out);
+    } });
+    benches.push_back({ "secp256k1-pubkey-tweak-add", "compressed", 0, false, []() {
+        uint8_t out[33];
+        fast_crypto_secp256k1_pubkey_tweak_add(publicKey, sizeof(publicKey), tweak, 1, out);
+    } });
+    benches.push_back({ "secp256k1-ecdsa-sign", "compact", 0, false, []() {
+        uint8_t sig[64];
+        size_t len;
+        fast_crypto_secp256k1_ecdsa_sign(privateKey, msgHash, sig, &len, 0);
+    } });
+    benches.push_back({ "secp256k1-ecdsa-verify", "compact", 0, false, []() {
+        fast_crypto_secp256k1_ecdsa_verify(ecdsaSig, sizeof(ecdsaSig), 0, msgHash,
+            publicKey, sizeof(publicKey), 1);
+    } });
+    benches.push_back({ "secp256k1-schnorr-sign", "", 0, false, []() {
+        uint8_t sig[64];
+        fast_crypto_secp256k1_schnorr_sign(privateKey, msgHash, NULL, sig);
+    } });
+    benches.push_back({ "secp256k1-schnorr-verify", "", 0, false, []() {
+        fast_crypto_secp256k1_schnorr_verify(schnorrSig, msgHash, xonlyPublicKey);
+    } });
+
+    // One key derivation's worth of public keys, on every core:
+    const size_t count = 1000;
+    const uint8_t *keys = (new std::vector<uint8_t>(pattern(32 * count, 1)))->data();
+    benches.push_back({ "secp256k1-pubkey-create-batch", "count=1000 threads=auto", 0, true, [keys, count]() {
+        std::vector<uint8_t> out(33 * count), results(count);
+        fast_crypto_secp256k1_pubkey_create_batch(keys, count, 1, 0, out.data(), results.data());
+    } });
+}
+
+static Result measure(const Benchmark &bench, const Options &opts)
+{
+    // The warmup calls also decide how many calls go in a sample:
+    double fastest = 0;
+    for (unsigned i = 0; i < std::max(1u, opts.warmup); ++i) {
+        Clock::time_point start = Clock::now();
+        bench.run();
+        double ns = elapsedNs(start);
+        if (i == 0 || ns < fastest) fastest = ns;
+    }
+
+    Result result;
+    result.bench = &bench;
+    result.batch = fastest >= minSampleNs ? 1 : (size_t) (minSampleNs / std::max(fastest, 1.0)) + 1;
+    for (unsigned i = 0; i < opts.reps; ++i) {
+        Clock::time_point start = Clock::now();
+        for (size_t j = 0; j < result.batch; ++j) bench.run();
+        result.samples.push_back(elapsedNs(start) / result.batch);
+    }
+    std::sort(result.samples.begin(), result.samples.end());
+    return result;
+}
+
+static void printJson(const std::vector<Result> &results, const Options &opts)
+{
+    // Builds with FAST_CRYPTO_STATS run a little slower:
+    fast_crypto_op_stats op;
+    int stats = fast_crypto_get_stats(&op, 1);
+
+    printf("{\n  \"host\": {\"threads\": %u, \"compiler\": \"%s\", \"stats\": %s},\n",
+        std::thread::hardware_concurrency(), __VERSION__, stats ? "true" : "false");
+    printf("  \"warmup\": %u,\n  \"reps\": %u,\n  \"benchmarks\": [", opts.warmup, opts.reps);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result &result = results[i];
+        const std::vector<double> &s = result.samples;
+        double mean = 0;
+        for (double ns : s) mean += ns / s.size();
+
+        printf("%s\n    {\"name\": \"%s\", \"params\": \"%s\", \"batch\": %zu, ",
+            i == 0 ? "" : ",", result.bench->name.c_str(), result.bench->params.c_str(), result.batch);
+        printf("\"minNs\": %.1f, \"meanNs\": %.1f, \"p50Ns\": %.1f, \"p90Ns\": %.1f, "
+            "\"p99Ns\": %.1f, \"maxNs\": %.1f, \"opsPerSec\": %.1f",
+            s.front(), mean, percentile(s, 50), percentile(s, 90), percentile(s, 99), s.back(),
+            1e9 / percentile(s, 50));
+        if (result.bench->bytes != 0) {
+            printf(", \"mbPerSec\": %.1f", result.bench->bytes / percentile(s, 50) * 1e3);
+        }
+        printf("}");
+    }
+    printf("\n  ]\n}\n");
+}
+
+static void printCsv(const std::vector<Result> &results)
+{
+    printf("name,params,batch,min_ns,mean_ns,p50_ns,p90_ns,p99_ns,max_ns,ops_per_sec,mb_per_sec\n");
+    for (const Result &result : results) {
+        const std::vector<double> &s = result.samples;
+        double mean = 0;
+        for (double ns : s) mean += ns / s.size();
+
+        printf("%s,%s,%zu,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,",
+            result.bench->name.c_str(), result.bench->params.c_str(), result.batch,
+            s.front(), mean, percentile(s, 50), percentile(s, 90), percentile(s, 99), s.back(),
+            1e9 / percentile(s, 50));
+        if (result.bench->bytes != 0) printf("%.1f", result.bench->bytes / percentile(s, 50) * 1e3);
+        printf("\n");
+    }
+}
+
+static void usage()
+{
+    fprintf(stderr,
+        "Usage: native-bench [--format json|csv] [--output file] [--warmup n]\n"
+        "                    [--reps n] [--filter text] [--quick] [--list]\n");
+    exit(2);
+}
+
+static Options parseOptions(int argc, char **argv)
+{
+    Options opts;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (arg == "--quick") {
+            opts.quick = true;
+        } else if (arg == "--list") {
+            opts.list = true;
+        } else if (value == NULL) {
+            usage();
+        } else if (arg == "--format") {
+            opts.format = value;
+            if (opts.format != "json" && opts.format != "csv") usage();
+            ++i;
+        } else if (arg == "--output") {
+            opts.output = value;
+            ++i;
+        } else if (arg == "--warmup") {
+            opts.warmup = (unsigned) atoi(value);
+            ++i;
+        } else if (arg == "--reps") {
+            opts.reps = (unsigned) atoi(value);
+            if (opts.reps == 0) usage();
+            ++i;
+        } else if (arg == "--filter") {
+            opts.filter = value;
+            ++i;
+        } else {
+            usage();
+        }
+    }
+    return opts;
+}
+
+int main(int argc, char **argv)
+{
+    Options opts = parseOptions(argc, argv);
+
+    std::vector<Benchmark> benches;
+    addScrypt(benches);
+    addPbkdf2(benches);
+    addHashes(benches);
+    addSecp256k1(benches);
+
+    std::vector<Result> results;
+    for (const Benchmark &bench : benches) {
+        std::string label = bench.params.empty() ? bench.name : bench.name + " " + bench.params;
+        if (opts.quick && bench.slow) continue;
+        if (label.find(opts.filter) == std::string::npos) continue;
+        if (opts.list) {
+            printf("%s\n", label.c_str());
+            continue;
+        }
+
+        // Progress goes to stderr, so stdout stays machine-readable:
+        fprintf(stderr, "%s...\n", label.c_str());
+        results.push_back(measure(bench, opts));
+    }
+    if (opts.list) return 0;
+
+    if (!opts.output.empty() && freopen(opts.output.c_str(), "w", stdout) == NULL) {
+        fprintf(stderr, "Cannot write %s\n", opts.output.c_str());
+        return 1;
+    }
+    if (opts.format == "csv") {
+        printCsv(results);
+    } else {
+        printJson(results, opts);
+    }
+    return 0;
+}
@@ -0,0 +1,410 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+/*
+ * Loads the native API from many threads at once, the way a busy app's
+ * bridge calls do: a mix of scrypt, public key creation, tweaks, and
+ * hashing. Runs the mix with 1, 2, 4, ... up to the requested number of
+ * threads, and reports throughput, tail latency, and memory use for
+ * each. Every result is checked against a single-threaded answer, and
+ * the ThreadSanitizer build reports any data races it sees.
+ *
+ * Usage: native-stress [--threads n] [--ops n] [--scrypt-n n]
+ *                      [--format json|csv]
+ */
+
+#include "native-crypto.h"
+
+extern "C" {
+#include "scrypt/sha256.h"
+}
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+enum Workload {
+    SCRYPT,
+    PUBKEY_CREATE,
+    PUBKEY_CREATE_HEX,
+    PRIVKEY_TWEAK_ADD,
+    PUBKEY_TWEAK_ADD,
+    PUBKEY_CREATE_BATCH,
+    KECCAK256,
+    SHA256,
+    WORKLOADS
+};
+
+static const struct {
+    const char *name;
+    // Out of every 100 calls:
+    unsigned weight;
+} workloads[WORKLOADS] = {
+    { "scrypt", 4 },
+    { "pubkey-create", 20 },
+    { "pubkey-create-hex", 10 },
+    { "privkey-tweak-add", 20 },
+    { "pubkey-tweak-add", 15 },
+    { "pubkey-create-batch", 1 },
+    { "keccak256", 15 },
+    { "sha256", 15 },
+};
+
+// Distinct inputs per workload, so threads are not all
+// computing the same thing at the same moment:
+const size_t variants = 8;
+const size_t batchCount = 64;
+const size_t hashBytes = 1024;
+const size_t maxOutput = batchCount * 33;
+
+struct Options {
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    unsigned ops = 2000;
+    uint64_t scryptN = 1024;
+    std::string format = "json";
+};
+
+struct Inputs {
+    uint8_t privateKeys[variants][32];
+    uint8_t tweaks[variants][32];
+    uint8_t publicKeys[variants][33];
+    char privateKeysHex[variants][65];
+    uint8_t batchKeys[batchCount * 32];
+    uint8_t data[variants][hashBytes];
+};
+
+struct Output {
+    size_t length;
+    uint8_t bytes[maxOutput];
+};
+
+struct Round {
+    unsigned threads;
+    double seconds;
+    size_t mismatches;
+    size_t rss;
+    size_t peakRss;
+    size_t secureInUse;
+    // Microseconds per call, sorted:
+    std::vector<double> latencies[WORKLOADS];
+};
+
+static Options opts;
+static Inputs inputs;
+static Output expected[WORKLOADS][variants];
+
+static std::string toHex(const uint8_t *data, size_t length)
+{
+    static const char digits[] = "0123456789abcdef";
+    std::string out;
+    for (size_t i = 0; i < length; ++i) {
+        out += digits[data[i] >> 4];
+        out += digits[data[i] & 15];
+    }
+    return out;
+}
+
+static void setUpInputs()
+{
+    for (size_t v = 0; v < variants; ++v) {
+        for (size_t i = 0; i < 32; ++i) {
+            inputs.privateKeys[v][i] = (uint8_t) (v * 32 + i + 1);
+            inputs.tweaks[v][i] = (uint8_t) (0x80 ^ (v * 7 + i));
+        }
+        for (size_t i = 0; i < hashBytes; ++i) inputs.data[v][i] = (uint8_t) (i * 131 + v);
+        if (fast_crypto_secp256k1_pubkey_create(inputs.privateKeys[v], 1, inputs.publicKeys[v]) != 33) {
+            fprintf(stderr, "Could not set up the secp256k1 keys\n");
+            exit(1);
+        }
+        strcpy(inputs.privateKeysHex[v], toHex(inputs.privateKeys[v], 32).c_str());
+    }
+    for (size_t i = 0; i < sizeof(inputs.batchKeys); ++i) inputs.batchKeys[i] = (uint8_t) (i % 251 + 1);
+}
+
+/**
+ * Makes one call, writing whatever it returns into `out`.
+ */
+static void run(int workload, size_t v, Output &out)
+{
+    switch (workload) {
+    case SCRYPT:
+        out.length = 32;
+        fast_crypto_scrypt(inputs.data[v], 16, inputs.tweaks[v], 32, opts.scryptN, 8, 1,
+            out.bytes, out.length);
+        break;
+    case PUBKEY_CREATE:
+        out.length = fast_crypto_secp256k1_pubkey_create(inputs.privateKeys[v], 1, out.bytes);
+        break;
+    case PUBKEY_CREATE_HEX: {
+        char hex[2 * 33 + 1];
+        fast_crypto_secp256k1_ec_pubkey_create(inputs.privateKeysHex[v], hex, 1);
+        out.length = strlen(hex);
+        memcpy(out.bytes, hex, out.length);
+        break;
+    }
+    case PRIVKEY_TWEAK_ADD:
+        out.length = fast_crypto_secp256k1_privkey_tweak_add(inputs.privateKeys[v],
+            inputs.tweaks[v], out.bytes) ? 32 : 0;
+        break;
+    case PUBKEY_TWEAK_ADD:
+        out.length = fast_crypto_secp256k1_pubkey_tweak_add(inputs.publicKeys[v], 33,
+            inputs.tweaks[v], 1, out.bytes);
+        break;
+    case PUBKEY_CREATE_BATCH: {
+        uint8_t results[batchCount];
+        out.length = batchCount * 33;
+        fast_crypto_secp256k1_pubkey_create_batch(inputs.batchKeys, batchCount, 1, 2,
+            out.bytes, results);
+        break;
+    }
+    case KECCAK256:
+        out.length = 32;
+        fast_crypto_keccak256(inputs.data[v], hashBytes, out.bytes);
+        break;
+    case SHA256: {
+        SHA256_CTX ctx;
+        out.length = 32;
+        SHA256_Init(&ctx);
+        SHA256_Update(&ctx, inputs.data[v], hashBytes);
+        SHA256_Final(out.bytes, &ctx);
+        break;
+    }
+    }
+}
+
+/**
+ * Picks each call's workload from a fixed per-thread sequence,
+ * so every run with the same options does the same work.
+ */
+struct Picker {
+    uint64_t state;
+
+    explicit Picker(unsigned thread): state(0x9e3779b97f4a7c15ull * (thread + 1)) {}
+
+    int next(size_t &variant) {
+        // xorshift64*:
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        uint64_t r = state * 0x2545f4914f6cdd1dull;
+        variant = (size_t) (r >> 32) % variants;
+        unsigned roll = (unsigned) (r % 100);
+        for (int w = 0; w < WORKLOADS; ++w) {
+            if (roll < workloads[w].weight) return w;
+            roll -= workloads[w].weight;
+        }
+        return SHA256;
+    }
+};
+
+struct Worker {
+    std::vector<double> latencies[WORKLOADS];
+    size_t mismatches = 0;
+};
+
+static void work(unsigned thread, Worker *worker)
+{
+    Picker picker(thread);
+    Output out;
+    for (unsigned i = 0; i < opts.ops; ++i) {
+        size_t v;
+        int workload = picker.next(v);
+        Clock::time_point start = Clock::now();
+        run(workload, v, out);
+        worker->latencies[workload].push_back(
+            std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+
+        const Output &want = expected[workload][v];
+        if (out.length != want.length || memcmp(out.bytes, want.bytes, out.length) != 0) {
+            ++worker->mismatches;
+        }
+    }
+}
+
+/**
+ * Returns the resident set size in bytes, or 0 where we cannot tell.
+ */
+static size_t currentRss()
+{
+#if defined(__linux__)
+    FILE *file = fopen("/proc/self/statm", "r");
+    if (file == NULL) return 0;
+    unsigned long size = 0, resident = 0;
+    int fields = fscanf(file, "%lu %lu", &size, &resident);
+    fclose(file);
+    return fields == 2 ? resident * (size_t) sysconf(_SC_PAGESIZE) : 0;
+#else
+    return 0;
+#endif
+}
+
+static size_t peakRss()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+    return (size_t) usage.ru_maxrss;
+#else
+    return (size_t) usage.ru_maxrss * 1024;
+#endif
+}
+
+static Round runRound(unsigned threads)
+{
+    std::vector<Worker> workers(threads);
+    std::vector<std::thread> pool;
+
+    Clock::time_point start = Clock::now();
+    for (unsigned t = 0; t < threads; ++t) pool.emplace_back(work, t, &workers[t]);
+    for (std::thread &thread : pool) thread.join();
+
+    Round round;
+    round.threads = threads;
+    round.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    round.mismatches = 0;
+    for (const Worker &worker : workers) {
+        round.mismatches += worker.mismatches;
+        for (int w = 0; w < WORKLOADS; ++w) {
+            round.latencies[w].insert(round.latencies[w].end(),
+                worker.latencies[w].begin(), worker.latencies[w].end());
+        }
+    }
+    for (int w = 0; w < WORKLOADS; ++w) std::sort(round.latencies[w].begin(), round.latencies[w].end());
+
+    fast_crypto_secure_memory_stats memory;
+    fast_crypto_get_secure_memory_stats(&memory);
+    round.rss = currentRss();
+    // The kernel updates the peak lazily:
+    round.peakRss = std::max(peakRss(), round.rss);
+    round.secureInUse = memory.inUse;
+    return round;
+}
+
+/**
+ * Returns the given percentile of some sorted samples, using the nearest rank.
+ */
+static double percentile(const std::vector<double> &sorted, double p)
+{
+    if (sorted.empty()) return 0;
+    size_t rank = (size_t) (p / 100 * sorted.size() + 0.5);
+    return sorted[std::min(sorted.size() - 1, rank == 0 ? 0 : rank - 1)];
+}
+
+static void printJson(const std::vector<Round> &rounds)
+{
+    printf("{\n  \"cpus\": %u,\n  \"opsPerThread\": %u,\n  \"scryptN\": %llu,\n  \"rounds\": [",
+        std::thread::hardware_concurrency(), opts.ops, (unsigned long long) opts.scryptN);
+    for (size_t i = 0; i < rounds.size(); ++i) {
+        const Round &round = rounds[i];
+        double opsPerSec = round.threads * opts.ops / round.seconds;
+        double baseline = opts.ops / rounds[0].seconds * round.threads / rounds[0].threads;
+
+        printf("%s\n    {\"threads\": %u, \"seconds\": %.3f, \"opsPerSec\": %.1f, \"scaling\": %.2f, ",
+            i == 0 ? "" : ",", round.threads, round.seconds, opsPerSec, opsPerSec / baseline);
+        printf("\"mismatches\": %zu, \"rssBytes\": %zu, \"peakRssBytes\": %zu, \"secureInUseBytes\": %zu,\n",
+            round.mismatches, round.rss, round.peakRss, round.secureInUse);
+        printf("     \"workloads\": [");
+        for (int w = 0; w < WORKLOADS; ++w) {
+            const std::vector<double> &l = round.latencies[w];
+            printf("%s\n       {\"name\": \"%s\", \"calls\": %zu, \"p50Us\": %.1f, \"p99Us\": %.1f, "
+                "\"p999Us\": %.1f, \"maxUs\": %.1f}",
+                w == 0 ? "" : ",", workloads[w].name, l.size(), percentile(l, 50), percentile(l, 99),
+                percentile(l, 99.9), l.empty() ? 0 : l.back());
+        }
+        printf("\n     ]}");
+    }
+    printf("\n  ]\n}\n");
+}
+
+static void printCsv(const std::vector<Round> &rounds)
+{
+    printf("threads,seconds,ops_per_sec,mismatches,rss_bytes,peak_rss_bytes,workload,calls,"
+        "p50_us,p99_us,p999_us,max_us\n");
+    for (const Round &round : rounds) {
+        for (int w = 0; w < WORKLOADS; ++w) {
+            const std::vector<double> &l = round.latencies[w];
+            printf("%u,%.3f,%.1f,%zu,%zu,%zu,%s,%zu,%.1f,%.1f,%.1f,%.1f\n",
+                round.threads, round.seconds, round.threads * opts.ops / round.seconds,
+                round.mismatches, round.rss, round.peakRss, workloads[w].name, l.size(),
+                percentile(l, 50), percentile(l, 99), percentile(l, 99.9), l.empty() ? 0 : l.back());
+        }
+    }
+}
+
+static void usage()
+{
+    fprintf(stderr,
+        "Usage: native-stress [--threads n] [--ops n] [--scrypt-n n]\n"
+        "                     [--format json|csv]\n");
+    exit(2);
+}
+
+static void parseOptions(int argc, char **argv)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) usage();
+        const char *value = argv[++i];
+        if (arg == "--threads") {
+            opts.threads = (unsigned) atoi(value);
+            if (opts.threads == 0) usage();
+        } else if (arg == "--ops") {
+            opts.ops = (unsigned) atoi(value);
+            if (opts.ops == 0) usage();
+        } else if (arg == "--scrypt-n") {
+            opts.scryptN = strtoull(value, NULL, 10);
+            if (opts.scryptN < 2 || (opts.scryptN & (opts.scryptN - 1)) != 0) usage();
+        } else if (arg == "--format") {
+            opts.format = value;
+            if (opts.format != "json" && opts.format != "csv") usage();
+        } else {
+            usage();
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    parseOptions(argc, argv);
+
+    // The answers every thread should get:
+    setUpInputs();
+    for (int w = 0; w < WORKLOADS; ++w) {
+        for (size_t v = 0; v < variants; ++v) run(w, v, expected[w][v]);
+    }
+
+    std::vector<Round> rounds;
+    size_t mismatches = 0;
+    for (unsigned threads = 1;; threads = std::min(2 * threads, opts.threads)) {
+        // Progress goes to stderr, so stdout stays machine-readable:
+        fprintf(stderr, "%u threads...\n", threads);
+        rounds.push_back(runRound(threads));
+        mismatches += rounds.back().mismatches;
+        if (threads == opts.threads) break;
+    }
+
+    if (opts.format == "csv") {
+        printCsv(rounds);
+    } else {
+        printJson(rounds);
+    }
+    if (mismatches != 0) {
+        fprintf(stderr, "%zu calls returned the wrong answer under load\n", mismatches);
+        return 1;
+    }
+    return 0;
+}
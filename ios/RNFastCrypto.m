@@ -6,14 +6,110 @@
 #import <Foundation/Foundation.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
-@implementation RNFastCrypto
+/**
+ * Decodes base64 from the bridge using the shared native codec,
+ * returning nil if the string is not valid base64.
+ */
+static NSMutableData *fromBase64(NSString *text)
+{
+  if (text == nil) return nil;
+  const char *chars = text.UTF8String;
+  size_t length = strlen(chars);
+  NSMutableData *out =
+    [NSMutableData dataWithLength:BASE64_DECODED_MAX_LENGTH(length)];
+  size_t outLength = 0;
+  if (!fast_crypto_base64_decode(chars, length, out.mutableBytes, &outLength,
+                                 NULL)) {
+    return nil;
+  }
+  out.length = outLength;
+  return out;
+}
 
-- (dispatch_queue_t)methodQueue
+/**
+ * Encodes bytes as padded base64 for the bridge using the shared native
+ * codec.
+ */
+static NSString *toBase64(NSData *data)
 {
-  return dispatch_get_main_queue();
+  NSMutableData *out =
+    [NSMutableData dataWithLength:BASE64_ENCODED_LENGTH(data.length) + 1];
+  fast_crypto_base64_encode(data.bytes, data.length, out.mutableBytes);
+  return [NSString stringWithUTF8String:out.bytes];
 }
 
+/**
+ * Runs a block queued by `submit` on a worker pool thread.
+ */
+static void runBlock(void *context)
+{
+  @autoreleasepool {
+    void (^block)(void) = (__bridge_transfer void (^)(void))context;
+    block();
+  }
+}
+
+/**
+ * Runs a method body on the native worker pool, so crypto never blocks
+ * the UI, and background work never holds up interactive work.
+ */
+static void submit(int priority, RCTPromiseRejectBlock reject, void (^block)(void))
+{
+  void *context = (__bridge_retained void *)[block copy];
+  if (!fast_crypto_pool_submit(priority, runBlock, context)) {
+    CFBridgingRelease(context);
+    reject(@"Err", @"Too many pending calls", nil);
+  }
+}
+
+/**
+ * Checks that the little-endian 32-bit lengths of some back-to-back items
+ * cover the packed data exactly.
+ */
+static BOOL checkPackedLens(NSData *items, NSData *itemLens)
+{
+  if (itemLens.length % 4 != 0) return NO;
+  const uint32_t *lens = itemLens.bytes;
+  size_t total = 0;
+  for (size_t i = 0; i < itemLens.length / 4; ++i) total += lens[i];
+  return total == items.length;
+}
+
+/**
+ * Packs each record's status byte, little-endian 32-bit plaintext length,
+ * and plaintext back-to-back, then wipes the plaintexts.
+ */
+static NSString *packRecords(NSData *recordLens, NSMutableData *plaintexts,
+                             NSData *plaintextLens, NSData *statuses)
+{
+  size_t count = statuses.length;
+  const uint32_t *lens = recordLens.bytes;
+  const uint32_t *outLens = plaintextLens.bytes;
+  const uint8_t *codes = statuses.bytes;
+  size_t size = 0;
+  for (size_t i = 0; i < count; ++i) size += 5 + outLens[i];
+
+  NSMutableData *out = [NSMutableData dataWithLength:size];
+  uint8_t *item = out.mutableBytes;
+  const uint8_t *plaintext = plaintexts.bytes;
+  for (size_t i = 0; i < count; ++i) {
+    item[0] = codes[i];
+    memcpy(item + 1, &outLens[i], 4);
+    if (outLens[i] != 0) memcpy(item + 5, plaintext, outLens[i]);
+    item += 5 + outLens[i];
+    plaintext += lens[i];
+  }
+
+  NSString *result = toBase64(out);
+  memset(plaintexts.mutableBytes, 0, plaintexts.length);
+  memset(out.mutableBytes, 0, out.length);
+  return result;
+}
+
+@implementation RNFastCrypto
+
 RCT_EXPORT_MODULE()
 
 RCT_REMAP_METHOD(
@@ -25,23 +121,25 @@ RCT_REMAP_METHOD(
   resolver:(RCTPromiseResolveBlock)resolve
   rejecter:(RCTPromiseRejectBlock)reject
 ) {
-  NSData *data = [[NSData alloc] initWithBase64EncodedString:data64 options:0];
-  NSData *salt = [[NSData alloc] initWithBase64EncodedString:salt64 options:0];
-  NSMutableData *out = [NSMutableData dataWithLength:size];
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *data = fromBase64(data64);
+    NSData *salt = fromBase64(salt64);
+    NSMutableData *out = [NSMutableData dataWithLength:size];
 
-  CCKeyDerivationPBKDF(
-    kCCPBKDF2,
-    data.bytes,
-    data.length,
-    salt.bytes,
-    salt.length,
-    kCCPRFHmacAlgSHA512,
-    iterations,
-    out.mutableBytes,
-    size
-  );
+    CCKeyDerivationPBKDF(
+      kCCPBKDF2,
+      data.bytes,
+      data.length,
+      salt.bytes,
+      salt.length,
+      kCCPRFHmacAlgSHA512,
+      iterations,
+      out.mutableBytes,
+      size
+    );
 
-  resolve([out base64EncodedStringWithOptions:0]);
+    resolve(toBase64(out));
+  });
 }
 
 RCT_REMAP_METHOD(scrypt, scrypt:(NSString *)passwd
@@ -54,23 +152,29 @@ RCT_REMAP_METHOD(scrypt, scrypt:(NSString *)passwd
                  resolver:(RCTPromiseResolveBlock)resolve
                  rejecter:(RCTPromiseRejectBlock)reject)
 {
-  NSData *passwdData = [[NSData alloc] initWithBase64EncodedString:passwd options:0];
-  NSData *saltData = [[NSData alloc] initWithBase64EncodedString:salt options:0];
-  char *rawPasswd = (char *)[passwdData bytes];
-  char *rawSalt = (char *)[saltData bytes];
-  size_t passwdlen = [passwdData length];
-  size_t saltlen = [saltData length];
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *passwdData = fromBase64(passwd);
+    NSData *saltData = fromBase64(salt);
+    char *rawPasswd = (char *)[passwdData bytes];
+    char *rawSalt = (char *)[saltData bytes];
+    size_t passwdlen = [passwdData length];
+    size_t saltlen = [saltData length];
 
-  uint8_t *buffer = malloc(sizeof(char) * size);
-  fast_crypto_scrypt(rawPasswd, passwdlen, rawSalt, saltlen, N, r, p, buffer, size);
+    uint8_t *buffer = malloc(sizeof(char) * size);
+    if (!fast_crypto_scrypt(rawPasswd, passwdlen, rawSalt, saltlen, N, r, p, buffer, size)) {
+      free(buffer);
+      reject(@"Err", @"Invalid scrypt parameters", nil);
+      return;
+    }
 
-  NSData *data = [NSData dataWithBytes:buffer length:size];
-  NSString *str = [data base64EncodedStringWithOptions:0];
-  free(buffer);
+    NSData *data = [NSData dataWithBytes:buffer length:size];
+    NSString *str = toBase64(data);
+    free(buffer);
 
-  // Already initialized
-  resolve(str);
-  //    callback(@[[NSNull null], str]);
+    // Already initialized
+    resolve(str);
+    //    callback(@[[NSNull null], str]);
+  });
 }
 
 RCT_REMAP_METHOD(secp256k1EcPubkeyCreate,
@@ -79,11 +183,13 @@ RCT_REMAP_METHOD(secp256k1EcPubkeyCreate,
                  resolver:(RCTPromiseResolveBlock)resolve
                  rejecter:(RCTPromiseRejectBlock)reject)
 {
-  // Hex with a null terminator is 2 * bytes + 1:
-  char szPublicKeyHex[2 * DECOMPRESSED_PUBKEY_LENGTH + 1];
-  fast_crypto_secp256k1_ec_pubkey_create([privateKeyHex UTF8String], szPublicKeyHex, compressed);
-  NSString *publicKeyHex = [NSString stringWithUTF8String:szPublicKeyHex];
-  resolve(publicKeyHex);
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    // Hex with a null terminator is 2 * bytes + 1:
+    char szPublicKeyHex[2 * DECOMPRESSED_PUBKEY_LENGTH + 1];
+    fast_crypto_secp256k1_ec_pubkey_create([privateKeyHex UTF8String], szPublicKeyHex, compressed);
+    NSString *publicKeyHex = [NSString stringWithUTF8String:szPublicKeyHex];
+    resolve(publicKeyHex);
+  });
 }
 
 RCT_REMAP_METHOD(secp256k1EcPrivkeyTweakAdd,
@@ -92,14 +198,16 @@ RCT_REMAP_METHOD(secp256k1EcPrivkeyTweakAdd,
                  resolver:(RCTPromiseResolveBlock)resolve
                  rejecter:(RCTPromiseRejectBlock)reject)
 {
-  int privateKeyHexLen = [privateKeyHex length] + 1;
-  char szPrivateKeyHex[privateKeyHexLen];
-  const char *szPrivateKeyHexConst = [privateKeyHex UTF8String];
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    int privateKeyHexLen = [privateKeyHex length] + 1;
+    char szPrivateKeyHex[privateKeyHexLen];
+    const char *szPrivateKeyHexConst = [privateKeyHex UTF8String];
 
-  strcpy(szPrivateKeyHex, szPrivateKeyHexConst);
-  fast_crypto_secp256k1_ec_privkey_tweak_add(szPrivateKeyHex, [tweakHex UTF8String]);
-  NSString *privateKeyTweakedHex = [NSString stringWithUTF8String:szPrivateKeyHex];
-  resolve(privateKeyTweakedHex);
+    strcpy(szPrivateKeyHex, szPrivateKeyHexConst);
+    fast_crypto_secp256k1_ec_privkey_tweak_add(szPrivateKeyHex, [tweakHex UTF8String]);
+    NSString *privateKeyTweakedHex = [NSString stringWithUTF8String:szPrivateKeyHex];
+    resolve(privateKeyTweakedHex);
+  });
 }
 
 RCT_REMAP_METHOD(secp256k1EcPubkeyTweakAdd,
@@ -109,15 +217,1766 @@ RCT_REMAP_METHOD(secp256k1EcPubkeyTweakAdd,
                  resolver:(RCTPromiseResolveBlock)resolve
                  rejecter:(RCTPromiseRejectBlock)reject)
 {
-  int publicKeyHexLen = [publicKeyHex length] + 1;
-  char szPublicKeyHex[publicKeyHexLen];
-  const char *szPublicKeyHexConst = [publicKeyHex UTF8String];
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    int publicKeyHexLen = [publicKeyHex length] + 1;
+    char szPublicKeyHex[publicKeyHexLen];
+    const char *szPublicKeyHexConst = [publicKeyHex UTF8String];
 
-  strcpy(szPublicKeyHex, szPublicKeyHexConst);
-  fast_crypto_secp256k1_ec_pubkey_tweak_add(szPublicKeyHex, [tweakHex UTF8String], compressed);
-  NSString *publicKeyTweakedHex = [NSString stringWithUTF8String:szPublicKeyHex];
-  resolve(publicKeyTweakedHex);
+    strcpy(szPublicKeyHex, szPublicKeyHexConst);
+    fast_crypto_secp256k1_ec_pubkey_tweak_add(szPublicKeyHex, [tweakHex UTF8String], compressed);
+    NSString *publicKeyTweakedHex = [NSString stringWithUTF8String:szPublicKeyHex];
+    resolve(publicKeyTweakedHex);
+  });
 }
 
-@end
+RCT_REMAP_METHOD(secp256k1EcPubkeyCreateBatch,
+                 secp256k1EcPubkeyCreateBatch:(NSString *)privateKeys64
+                 count:(NSUInteger)count
+                 compressed:(BOOL)compressed
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSMutableData *privateKeys = fromBase64(privateKeys64);
+    if (count == 0 || privateKeys.length != count * SECRET_KEY_LENGTH) {
+      reject(@"Err", @"Invalid batch layout", nil);
+      return;
+    }
+
+    // The result bytes come first, followed by the public keys:
+    size_t publicKeyLen = compressed ? COMPRESSED_PUBKEY_LENGTH : DECOMPRESSED_PUBKEY_LENGTH;
+    NSMutableData *out = [NSMutableData dataWithLength:count * (1 + publicKeyLen)];
+    uint8_t *bytes = out.mutableBytes;
+    fast_crypto_secp256k1_pubkey_create_batch(
+      privateKeys.bytes, count, compressed, (unsigned)threads, bytes + count, bytes
+    );
+    memset(privateKeys.mutableBytes, 0, privateKeys.length);
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1EcPrivkeyTweakAddBatch,
+                 secp256k1EcPrivkeyTweakAddBatch:(NSString *)privateKeys64
+                 tweaks:(NSString *)tweaks64
+                 count:(NSUInteger)count
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSMutableData *privateKeys = fromBase64(privateKeys64);
+    NSData *tweaks = fromBase64(tweaks64);
+    if (count == 0 || privateKeys.length != count * SECRET_KEY_LENGTH ||
+        tweaks.length != count * SECRET_KEY_LENGTH) {
+      reject(@"Err", @"Invalid batch layout", nil);
+      return;
+    }
+
+    // The result bytes come first, followed by the private keys:
+    NSMutableData *out = [NSMutableData dataWithLength:count * (1 + SECRET_KEY_LENGTH)];
+    uint8_t *bytes = out.mutableBytes;
+    fast_crypto_secp256k1_privkey_tweak_add_batch(
+      privateKeys.bytes, tweaks.bytes, count, (unsigned)threads, bytes + count, bytes
+    );
+    memset(privateKeys.mutableBytes, 0, privateKeys.length);
+    NSString *result = toBase64(out);
+    memset(bytes, 0, out.length);
+    resolve(result);
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1EcdsaSign,
+                 secp256k1EcdsaSign:(NSString *)privateKey64
+                 msgHash:(NSString *)msgHash64
+                 der:(BOOL)der
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *privateKey = fromBase64(privateKey64);
+    NSData *msgHash = fromBase64(msgHash64);
+    if (privateKey.length != SECRET_KEY_LENGTH || msgHash.length != MESSAGE_HASH_LENGTH) {
+      reject(@"Err", @"Invalid private key or message hash length", nil);
+      return;
+    }
+
+    uint8_t sig[ECDSA_DER_SIGNATURE_MAX_LENGTH];
+    size_t sigLen = 0;
+    if (!fast_crypto_secp256k1_ecdsa_sign(privateKey.bytes, msgHash.bytes, sig, &sigLen, der)) {
+      reject(@"Err", @"Invalid private key", nil);
+      return;
+    }
+    NSData *out = [NSData dataWithBytes:sig length:sigLen];
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1EcdsaVerify,
+                 secp256k1EcdsaVerify:(NSString *)sig64
+                 der:(BOOL)der
+                 msgHash:(NSString *)msgHash64
+                 publicKey:(NSString *)publicKey64
+                 strict:(BOOL)strict
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *sig = fromBase64(sig64);
+    NSData *msgHash = fromBase64(msgHash64);
+    NSData *publicKey = fromBase64(publicKey64);
+    if (msgHash.length != MESSAGE_HASH_LENGTH) {
+      resolve(@NO);
+      return;
+    }
+
+    int valid = fast_crypto_secp256k1_ecdsa_verify(
+      sig.bytes, sig.length, der,
+      msgHash.bytes,
+      publicKey.bytes, publicKey.length,
+      strict
+    );
+    resolve(valid ? @YES : @NO);
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1EcdsaVerifyBatch,
+                 secp256k1EcdsaVerifyBatch:(NSString *)sigs64
+                 msgHashes:(NSString *)msgHashes64
+                 publicKeys:(NSString *)publicKeys64
+                 count:(NSUInteger)count
+                 strict:(BOOL)strict
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *sigs = fromBase64(sigs64);
+    NSData *msgHashes = fromBase64(msgHashes64);
+    NSData *publicKeys = fromBase64(publicKeys64);
+    if (
+      count == 0 ||
+      sigs.length != count * ECDSA_COMPACT_SIGNATURE_LENGTH ||
+      msgHashes.length != count * MESSAGE_HASH_LENGTH ||
+      publicKeys.length % count != 0
+    ) {
+      reject(@"Err", @"Invalid batch layout", nil);
+      return;
+    }
+
+    NSMutableData *results = [NSMutableData dataWithLength:count];
+    fast_crypto_secp256k1_ecdsa_verify_batch(
+      sigs.bytes,
+      msgHashes.bytes,
+      publicKeys.bytes, publicKeys.length / count,
+      count,
+      strict,
+      (unsigned)threads,
+      results.mutableBytes
+    );
+    resolve(toBase64(results));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1XonlyPubkeyCreateBatch,
+                 secp256k1XonlyPubkeyCreateBatch:(NSString *)privateKeys64
+                 count:(NSUInteger)count
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *privateKeys = fromBase64(privateKeys64);
+    if (count == 0 || privateKeys.length != count * SECRET_KEY_LENGTH) {
+      reject(@"Err", @"Invalid batch layout", nil);
+      return;
+    }
+
+    NSMutableData *publicKeys = [NSMutableData dataWithLength:count * XONLY_PUBKEY_LENGTH];
+    size_t created = fast_crypto_secp256k1_xonly_pubkey_create_batch(
+      privateKeys.bytes, count, (unsigned)threads, publicKeys.mutableBytes
+    );
+    if (created != count) {
+      reject(@"Err", @"Invalid private key", nil);
+      return;
+    }
+    resolve(toBase64(publicKeys));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1TaprootTweakPubkeyBatch,
+                 secp256k1TaprootTweakPubkeyBatch:(NSString *)internalKeys64
+                 merkleRoots:(NSString *)merkleRoots64
+                 count:(NSUInteger)count
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *internalKeys = fromBase64(internalKeys64);
+    NSData *merkleRoots = fromBase64(merkleRoots64);
+    if (
+      count == 0 ||
+      internalKeys.length != count * XONLY_PUBKEY_LENGTH ||
+      (merkleRoots.length != 0 && merkleRoots.length != count * 32)
+    ) {
+      reject(@"Err", @"Invalid batch layout", nil);
+      return;
+    }
+
+    // The output keys come first, followed by one parity byte per key:
+    NSMutableData *out = [NSMutableData dataWithLength:count * (XONLY_PUBKEY_LENGTH + 1)];
+    uint8_t *outputKeys = out.mutableBytes;
+    size_t tweaked = fast_crypto_secp256k1_taproot_tweak_pubkey_batch(
+      internalKeys.bytes,
+      merkleRoots.length != 0 ? merkleRoots.bytes : NULL,
+      count,
+      (unsigned)threads,
+      outputKeys,
+      outputKeys + count * XONLY_PUBKEY_LENGTH
+    );
+    if (tweaked != count) {
+      reject(@"Err", @"Invalid internal key", nil);
+      return;
+    }
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1TaprootTweakPrivkeyBatch,
+                 secp256k1TaprootTweakPrivkeyBatch:(NSString *)privateKeys64
+                 merkleRoots:(NSString *)merkleRoots64
+                 count:(NSUInteger)count
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *privateKeys = fromBase64(privateKeys64);
+    NSData *merkleRoots = fromBase64(merkleRoots64);
+    if (
+      count == 0 ||
+      privateKeys.length != count * SECRET_KEY_LENGTH ||
+      (merkleRoots.length != 0 && merkleRoots.length != count * 32)
+    ) {
+      reject(@"Err", @"Invalid batch layout", nil);
+      return;
+    }
+
+    NSMutableData *out = [NSMutableData dataWithLength:count * SECRET_KEY_LENGTH];
+    size_t tweaked = fast_crypto_secp256k1_taproot_tweak_privkey_batch(
+      privateKeys.bytes,
+      merkleRoots.length != 0 ? merkleRoots.bytes : NULL,
+      count,
+      (unsigned)threads,
+      out.mutableBytes
+    );
+    if (tweaked != count) {
+      reject(@"Err", @"Invalid private key", nil);
+      return;
+    }
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1SchnorrSignBatch,
+                 secp256k1SchnorrSignBatch:(NSString *)privateKeys64
+                 msgs:(NSString *)msgs64
+                 auxRands:(NSString *)auxRands64
+                 count:(NSUInteger)count
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *privateKeys = fromBase64(privateKeys64);
+    NSData *msgs = fromBase64(msgs64);
+    NSData *auxRands = fromBase64(auxRands64);
+    if (
+      count == 0 ||
+      privateKeys.length != count * SECRET_KEY_LENGTH ||
+      msgs.length != count * MESSAGE_HASH_LENGTH ||
+      (auxRands.length != 0 && auxRands.length != count * 32)
+    ) {
+      reject(@"Err", @"Invalid batch layout", nil);
+      return;
+    }
+
+    NSMutableData *sigs = [NSMutableData dataWithLength:count * SCHNORR_SIGNATURE_LENGTH];
+    size_t created = fast_crypto_secp256k1_schnorr_sign_batch(
+      privateKeys.bytes,
+      msgs.bytes,
+      auxRands.length != 0 ? auxRands.bytes : NULL,
+      count,
+      (unsigned)threads,
+      sigs.mutableBytes
+    );
+    if (created != count) {
+      reject(@"Err", @"Invalid private key", nil);
+      return;
+    }
+    resolve(toBase64(sigs));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1SchnorrVerifyBatch,
+                 secp256k1SchnorrVerifyBatch:(NSString *)sigs64
+                 msgs:(NSString *)msgs64
+                 publicKeys:(NSString *)publicKeys64
+                 count:(NSUInteger)count
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *sigs = fromBase64(sigs64);
+    NSData *msgs = fromBase64(msgs64);
+    NSData *publicKeys = fromBase64(publicKeys64);
+    if (
+      count == 0 ||
+      sigs.length != count * SCHNORR_SIGNATURE_LENGTH ||
+      msgs.length != count * MESSAGE_HASH_LENGTH ||
+      publicKeys.length != count * XONLY_PUBKEY_LENGTH
+    ) {
+      reject(@"Err", @"Invalid batch layout", nil);
+      return;
+    }
+
+    NSMutableData *results = [NSMutableData dataWithLength:count];
+    fast_crypto_secp256k1_schnorr_verify_batch(
+      sigs.bytes,
+      msgs.bytes,
+      publicKeys.bytes,
+      count,
+      (unsigned)threads,
+      results.mutableBytes
+    );
+    resolve(toBase64(results));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1EcdsaSignRecoverableBatch,
+                 secp256k1EcdsaSignRecoverableBatch:(NSString *)privateKeys64
+                 msgHashes:(NSString *)msgHashes64
+                 count:(NSUInteger)count
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *privateKeys = fromBase64(privateKeys64);
+    NSData *msgHashes = fromBase64(msgHashes64);
+    if (
+      count == 0 ||
+      privateKeys.length != count * SECRET_KEY_LENGTH ||
+      msgHashes.length != count * MESSAGE_HASH_LENGTH
+    ) {
+      reject(@"Err", @"Invalid batch layout", nil);
+      return;
+    }
+
+    NSMutableData *sigs = [NSMutableData dataWithLength:count * RECOVERABLE_SIGNATURE_LENGTH];
+    size_t created = fast_crypto_secp256k1_ecdsa_sign_recoverable_batch(
+      privateKeys.bytes, msgHashes.bytes, count, (unsigned)threads, sigs.mutableBytes
+    );
+    if (created != count) {
+      reject(@"Err", @"Invalid private key", nil);
+      return;
+    }
+    resolve(toBase64(sigs));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1EcdsaRecoverBatch,
+                 secp256k1EcdsaRecoverBatch:(NSString *)sigs64
+                 msgHashes:(NSString *)msgHashes64
+                 count:(NSUInteger)count
+                 format:(NSInteger)format
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *sigs = fromBase64(sigs64);
+    NSData *msgHashes = fromBase64(msgHashes64);
+    if (
+      count == 0 ||
+      sigs.length != count * RECOVERABLE_SIGNATURE_LENGTH ||
+      msgHashes.length != count * MESSAGE_HASH_LENGTH
+    ) {
+      reject(@"Err", @"Invalid batch layout", nil);
+      return;
+    }
+
+    size_t stride;
+    switch (format) {
+      case RECOVER_COMPRESSED_PUBKEY: stride = COMPRESSED_PUBKEY_LENGTH; break;
+      case RECOVER_UNCOMPRESSED_PUBKEY: stride = DECOMPRESSED_PUBKEY_LENGTH; break;
+      case RECOVER_ETHEREUM_ADDRESS: stride = ETHEREUM_ADDRESS_LENGTH; break;
+      default:
+        reject(@"Err", @"Invalid recovery format", nil);
+        return;
+    }
+
+    // The recovered items come first, followed by one status byte per item:
+    NSMutableData *out = [NSMutableData dataWithLength:count * (stride + 1)];
+    uint8_t *items = out.mutableBytes;
+    fast_crypto_secp256k1_ecdsa_recover_batch(
+      sigs.bytes, msgHashes.bytes, count, (int)format, (unsigned)threads,
+      items, items + count * stride
+    );
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1Ecdh,
+                 secp256k1Ecdh:(NSString *)privateKey64
+                 publicKey:(NSString *)publicKey64
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *privateKey = fromBase64(privateKey64);
+    NSData *publicKey = fromBase64(publicKey64);
+    uint8_t secret[32];
+    if (
+      privateKey.length != SECRET_KEY_LENGTH ||
+      !fast_crypto_secp256k1_ecdh(privateKey.bytes, publicKey.bytes, publicKey.length, secret)
+    ) {
+      reject(@"Err", @"Invalid key", nil);
+      return;
+    }
+    NSData *out = [NSData dataWithBytes:secret length:sizeof(secret)];
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(silentPaymentsScan,
+                 silentPaymentsScan:(NSString *)scanKey64
+                 spendPublicKey:(NSString *)spendPublicKey64
+                 labels:(NSString *)labels64
+                 tweaks:(NSString *)tweaks64
+                 inputHashes:(NSString *)inputHashes64
+                 outputKeys:(NSString *)outputKeys64
+                 outputCounts:(NSString *)outputCounts64
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *scanKey = fromBase64(scanKey64);
+    NSData *spendPublicKey = fromBase64(spendPublicKey64);
+    NSData *labels = fromBase64(labels64);
+    NSData *tweaks = fromBase64(tweaks64);
+    NSData *inputHashes = fromBase64(inputHashes64);
+    NSData *outputKeys = fromBase64(outputKeys64);
+    NSData *outputCounts = fromBase64(outputCounts64);
+
+    // The output counts arrive as little-endian 32-bit integers:
+    size_t txCount = tweaks.length / COMPRESSED_PUBKEY_LENGTH;
+    const uint32_t *counts = outputCounts.bytes;
+    size_t outputTotal = 0;
+    if (outputCounts.length == 4 * txCount) {
+      for (size_t i = 0; i < txCount; ++i) outputTotal += counts[i];
+    }
+    if (
+      outputCounts.length != 4 * txCount ||
+      scanKey.length != SECRET_KEY_LENGTH ||
+      spendPublicKey.length != COMPRESSED_PUBKEY_LENGTH ||
+      labels.length % COMPRESSED_PUBKEY_LENGTH != 0 ||
+      tweaks.length != txCount * COMPRESSED_PUBKEY_LENGTH ||
+      (inputHashes.length != 0 && inputHashes.length != txCount * 32) ||
+      outputKeys.length != outputTotal * XONLY_PUBKEY_LENGTH
+    ) {
+      reject(@"Err", @"Invalid scan layout", nil);
+      return;
+    }
+
+    // Each output can match at most once:
+    NSMutableData *matchData = [NSMutableData dataWithLength:outputTotal * sizeof(fast_crypto_silent_payment_match)];
+    fast_crypto_silent_payment_match *matches = matchData.mutableBytes;
+    size_t matchCount = fast_crypto_silent_payments_scan(
+      scanKey.bytes,
+      spendPublicKey.bytes,
+      labels.length != 0 ? labels.bytes : NULL,
+      labels.length / COMPRESSED_PUBKEY_LENGTH,
+      tweaks.bytes,
+      inputHashes.length != 0 ? inputHashes.bytes : NULL,
+      txCount,
+      outputKeys.bytes,
+      counts,
+      (unsigned)threads,
+      matches,
+      outputTotal
+    );
+
+    // Pack each match as little-endian tx index, output index,
+    // and label index, followed by the 32-byte tweak:
+    NSMutableData *out = [NSMutableData dataWithLength:matchCount * 44];
+    for (size_t i = 0; i < matchCount; ++i) {
+      uint8_t *item = (uint8_t *)out.mutableBytes + i * 44;
+      memcpy(item + 0, &matches[i].txIndex, 4);
+      memcpy(item + 4, &matches[i].outputIndex, 4);
+      memcpy(item + 8, &matches[i].labelIndex, 4);
+      memcpy(item + 12, matches[i].tweak, 32);
+    }
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(musigPubkeyAgg,
+                 musigPubkeyAgg:(NSString *)publicKeys64
+                 sort:(BOOL)sort
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *publicKeys = fromBase64(publicKeys64);
+    if (publicKeys.length == 0 || publicKeys.length % COMPRESSED_PUBKEY_LENGTH != 0) {
+      reject(@"Err", @"Invalid public key", nil);
+      return;
+    }
+
+    // The aggregate key comes first, followed by the cache:
+    NSMutableData *out = [NSMutableData dataWithLength:XONLY_PUBKEY_LENGTH + MUSIG_KEYAGG_CACHE_LENGTH];
+    uint8_t *bytes = out.mutableBytes;
+    if (!fast_crypto_musig_pubkey_agg(
+      publicKeys.bytes, publicKeys.length / COMPRESSED_PUBKEY_LENGTH,
+      sort,
+      bytes, bytes + XONLY_PUBKEY_LENGTH
+    )) {
+      reject(@"Err", @"Invalid public key", nil);
+      return;
+    }
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(musigPubkeyAggBatch,
+                 musigPubkeyAggBatch:(NSString *)publicKeySets64
+                 keysPerSet:(NSUInteger)keysPerSet
+                 setCount:(NSUInteger)setCount
+                 sort:(BOOL)sort
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *publicKeySets = fromBase64(publicKeySets64);
+    if (
+      keysPerSet == 0 || setCount == 0 ||
+      publicKeySets.length != setCount * keysPerSet * COMPRESSED_PUBKEY_LENGTH
+    ) {
+      reject(@"Err", @"Invalid batch layout", nil);
+      return;
+    }
+
+    NSMutableData *out = [NSMutableData dataWithLength:setCount * XONLY_PUBKEY_LENGTH];
+    size_t done = fast_crypto_musig_pubkey_agg_batch(
+      publicKeySets.bytes, keysPerSet, setCount,
+      sort,
+      (unsigned)threads,
+      out.mutableBytes
+    );
+    if (done != setCount) {
+      reject(@"Err", @"Invalid public key", nil);
+      return;
+    }
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(musigPubkeyTweakAdd,
+                 musigPubkeyTweakAdd:(NSString *)keyaggCache64
+                 tweak:(NSString *)tweak64
+                 xonly:(BOOL)xonly
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *keyaggCache = fromBase64(keyaggCache64);
+    NSData *tweak = fromBase64(tweak64);
+    if (keyaggCache.length != MUSIG_KEYAGG_CACHE_LENGTH || tweak.length != 32) {
+      reject(@"Err", @"Invalid tweak", nil);
+      return;
+    }
+
+    // The tweaked key comes first, followed by the updated cache:
+    NSMutableData *out = [NSMutableData dataWithLength:COMPRESSED_PUBKEY_LENGTH + MUSIG_KEYAGG_CACHE_LENGTH];
+    uint8_t *bytes = out.mutableBytes;
+    memcpy(bytes + COMPRESSED_PUBKEY_LENGTH, keyaggCache.bytes, MUSIG_KEYAGG_CACHE_LENGTH);
+    if (!fast_crypto_musig_pubkey_tweak_add(bytes + COMPRESSED_PUBKEY_LENGTH, tweak.bytes, xonly, bytes)) {
+      reject(@"Err", @"Invalid tweak", nil);
+      return;
+    }
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(musigNonceGen,
+                 musigNonceGen:(NSString *)sessionRand64
+                 privateKey:(NSString *)privateKey64
+                 publicKey:(NSString *)publicKey64
+                 msg:(NSString *)msg64
+                 keyaggCache:(NSString *)keyaggCache64
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *sessionRand = fromBase64(sessionRand64);
+    NSData *privateKey = fromBase64(privateKey64);
+    NSData *publicKey = fromBase64(publicKey64);
+    NSData *msg = fromBase64(msg64);
+    NSData *keyaggCache = fromBase64(keyaggCache64);
+    if (
+      sessionRand.length != 32 ||
+      (privateKey.length != 0 && privateKey.length != SECRET_KEY_LENGTH) ||
+      publicKey.length != COMPRESSED_PUBKEY_LENGTH ||
+      (msg.length != 0 && msg.length != MESSAGE_HASH_LENGTH) ||
+      (keyaggCache.length != 0 && keyaggCache.length != MUSIG_KEYAGG_CACHE_LENGTH)
+    ) {
+      reject(@"Err", @"Invalid nonce inputs", nil);
+      return;
+    }
+
+    // The secret nonce stays native, so this returns its little-endian
+    // 32-bit handle, followed by the public nonce:
+    NSMutableData *out = [NSMutableData dataWithLength:4 + MUSIG_PUBNONCE_LENGTH];
+    uint8_t *bytes = out.mutableBytes;
+    uint32_t handle = fast_crypto_musig_nonce_gen(
+      sessionRand.bytes,
+      privateKey.length != 0 ? privateKey.bytes : NULL,
+      publicKey.bytes,
+      msg.length != 0 ? msg.bytes : NULL,
+      keyaggCache.length != 0 ? keyaggCache.bytes : NULL,
+      bytes + 4
+    );
+    if (handle == 0) {
+      reject(@"Err", @"Invalid nonce inputs", nil);
+      return;
+    }
+    bytes[0] = handle;
+    bytes[1] = handle >> 8;
+    bytes[2] = handle >> 16;
+    bytes[3] = handle >> 24;
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(musigNonceAgg,
+                 musigNonceAgg:(NSString *)pubnonces64
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *pubnonces = fromBase64(pubnonces64);
+    uint8_t aggnonce[MUSIG_PUBNONCE_LENGTH];
+    if (
+      pubnonces.length == 0 || pubnonces.length % MUSIG_PUBNONCE_LENGTH != 0 ||
+      !fast_crypto_musig_nonce_agg(pubnonces.bytes, pubnonces.length / MUSIG_PUBNONCE_LENGTH, aggnonce)
+    ) {
+      reject(@"Err", @"Invalid public nonce", nil);
+      return;
+    }
+    NSData *out = [NSData dataWithBytes:aggnonce length:sizeof(aggnonce)];
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(musigPartialSign,
+                 musigPartialSign:(NSUInteger)nonceHandle
+                 privateKey:(NSString *)privateKey64
+                 keyaggCache:(NSString *)keyaggCache64
+                 aggnonce:(NSString *)aggnonce64
+                 msg:(NSString *)msg64
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *privateKey = fromBase64(privateKey64);
+    NSData *keyaggCache = fromBase64(keyaggCache64);
+    NSData *aggnonce = fromBase64(aggnonce64);
+    NSData *msg = fromBase64(msg64);
+    uint8_t partialSig[MUSIG_PARTIAL_SIG_LENGTH];
+    if (
+      privateKey.length != SECRET_KEY_LENGTH ||
+      keyaggCache.length != MUSIG_KEYAGG_CACHE_LENGTH ||
+      aggnonce.length != MUSIG_PUBNONCE_LENGTH ||
+      msg.length != MESSAGE_HASH_LENGTH
+    ) {
+      // Never leave a nonce behind that a retry could sign with:
+      fast_crypto_musig_nonce_release((uint32_t)nonceHandle);
+      reject(@"Err", @"Cannot create partial signature", nil);
+      return;
+    }
+    if (
+      !fast_crypto_musig_partial_sign(
+        (uint32_t)nonceHandle,
+        privateKey.bytes,
+        keyaggCache.bytes,
+        aggnonce.bytes,
+        msg.bytes,
+        partialSig
+      )
+    ) {
+      reject(@"Err", @"Cannot create partial signature", nil);
+      return;
+    }
+    NSData *out = [NSData dataWithBytes:partialSig length:sizeof(partialSig)];
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(musigNonceRelease,
+                 musigNonceRelease:(NSUInteger)nonceHandle
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    fast_crypto_musig_nonce_release((uint32_t)nonceHandle);
+    resolve(nil);
+  });
+}
+
+RCT_REMAP_METHOD(musigPartialVerify,
+                 musigPartialVerify:(NSString *)partialSig64
+                 pubnonce:(NSString *)pubnonce64
+                 publicKey:(NSString *)publicKey64
+                 keyaggCache:(NSString *)keyaggCache64
+                 aggnonce:(NSString *)aggnonce64
+                 msg:(NSString *)msg64
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *partialSig = fromBase64(partialSig64);
+    NSData *pubnonce = fromBase64(pubnonce64);
+    NSData *publicKey = fromBase64(publicKey64);
+    NSData *keyaggCache = fromBase64(keyaggCache64);
+    NSData *aggnonce = fromBase64(aggnonce64);
+    NSData *msg = fromBase64(msg64);
+    if (
+      partialSig.length != MUSIG_PARTIAL_SIG_LENGTH ||
+      pubnonce.length != MUSIG_PUBNONCE_LENGTH ||
+      publicKey.length != COMPRESSED_PUBKEY_LENGTH ||
+      keyaggCache.length != MUSIG_KEYAGG_CACHE_LENGTH ||
+      aggnonce.length != MUSIG_PUBNONCE_LENGTH ||
+      msg.length != MESSAGE_HASH_LENGTH
+    ) {
+      resolve(@NO);
+      return;
+    }
+
+    int valid = fast_crypto_musig_partial_verify(
+      partialSig.bytes,
+      pubnonce.bytes,
+      publicKey.bytes,
+      keyaggCache.bytes,
+      aggnonce.bytes,
+      msg.bytes
+    );
+    resolve(valid ? @YES : @NO);
+  });
+}
+
+RCT_REMAP_METHOD(musigPartialSigAgg,
+                 musigPartialSigAgg:(NSString *)partialSigs64
+                 keyaggCache:(NSString *)keyaggCache64
+                 aggnonce:(NSString *)aggnonce64
+                 msg:(NSString *)msg64
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *partialSigs = fromBase64(partialSigs64);
+    NSData *keyaggCache = fromBase64(keyaggCache64);
+    NSData *aggnonce = fromBase64(aggnonce64);
+    NSData *msg = fromBase64(msg64);
+    uint8_t sig[SCHNORR_SIGNATURE_LENGTH];
+    if (
+      partialSigs.length == 0 ||
+      partialSigs.length % MUSIG_PARTIAL_SIG_LENGTH != 0 ||
+      keyaggCache.length != MUSIG_KEYAGG_CACHE_LENGTH ||
+      aggnonce.length != MUSIG_PUBNONCE_LENGTH ||
+      msg.length != MESSAGE_HASH_LENGTH ||
+      !fast_crypto_musig_partial_sig_agg(
+        partialSigs.bytes, partialSigs.length / MUSIG_PARTIAL_SIG_LENGTH,
+        keyaggCache.bytes,
+        aggnonce.bytes,
+        msg.bytes,
+        sig
+      )
+    ) {
+      reject(@"Err", @"Cannot aggregate signatures", nil);
+      return;
+    }
+    NSData *out = [NSData dataWithBytes:sig length:sizeof(sig)];
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1KeyHandleCreate,
+                 secp256k1KeyHandleCreate:(NSString *)key64
+                 isPrivate:(BOOL)isPrivate
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *key = fromBase64(key64);
+    uint32_t handle = 0;
+    if (!isPrivate) {
+      handle = fast_crypto_secp256k1_pubkey_handle_create(key.bytes, key.length);
+    } else if (key.length == SECRET_KEY_LENGTH) {
+      handle = fast_crypto_secp256k1_privkey_handle_create(key.bytes);
+    }
+    if (handle == 0) {
+      reject(@"Err", @"Invalid key", nil);
+      return;
+    }
+    resolve(@(handle));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1KeyHandlePublicKey,
+                 secp256k1KeyHandlePublicKey:(NSUInteger)handle
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    uint32_t out = fast_crypto_secp256k1_handle_pubkey((uint32_t)handle);
+    if (out == 0) {
+      reject(@"Err", @"Invalid private key handle", nil);
+      return;
+    }
+    resolve(@(out));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1KeyHandleTweakAdd,
+                 secp256k1KeyHandleTweakAdd:(NSUInteger)handle
+                 tweak:(NSString *)tweak64
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *tweak = fromBase64(tweak64);
+    uint32_t out = tweak.length == 32
+      ? fast_crypto_secp256k1_handle_tweak_add((uint32_t)handle, tweak.bytes)
+      : 0;
+    if (out == 0) {
+      reject(@"Err", @"Invalid key handle or tweak", nil);
+      return;
+    }
+    resolve(@(out));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1KeyHandleCombine,
+                 secp256k1KeyHandleCombine:(NSArray<NSNumber *> *)handles
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSMutableData *items = [NSMutableData dataWithLength:handles.count * sizeof(uint32_t)];
+    uint32_t *itemBytes = items.mutableBytes;
+    for (NSUInteger i = 0; i < handles.count; ++i) {
+      itemBytes[i] = handles[i].unsignedIntValue;
+    }
+
+    uint32_t out = fast_crypto_secp256k1_handle_combine(itemBytes, handles.count);
+    if (out == 0) {
+      reject(@"Err", @"Invalid public key handles", nil);
+      return;
+    }
+    resolve(@(out));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1KeyHandleSerialize,
+                 secp256k1KeyHandleSerialize:(NSUInteger)handle
+                 compressed:(BOOL)compressed
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    uint8_t key[DECOMPRESSED_PUBKEY_LENGTH];
+    size_t keyLen = fast_crypto_secp256k1_handle_serialize((uint32_t)handle, compressed, key);
+    if (keyLen == 0) {
+      reject(@"Err", @"Invalid key handle", nil);
+      return;
+    }
+    NSData *out = [NSData dataWithBytes:key length:keyLen];
+    memset(key, 0, sizeof(key));
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(secp256k1KeyHandleRelease,
+                 secp256k1KeyHandleRelease:(NSUInteger)handle
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    fast_crypto_secp256k1_handle_release((uint32_t)handle);
+    resolve(nil);
+  });
+}
+
+RCT_REMAP_METHOD(multisigDeriveBatch,
+                 multisigDeriveBatch:(NSString *)xpubs64
+                 m:(NSUInteger)m
+                 startIndex:(NSUInteger)startIndex
+                 count:(NSUInteger)count
+                 scriptType:(NSInteger)scriptType
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *xpubs = fromBase64(xpubs64);
+    if (xpubs.length == 0 || xpubs.length % XPUB_LENGTH != 0 || count == 0) {
+      reject(@"Err", @"Invalid extended public keys", nil);
+      return;
+    }
+
+    size_t hashLen = scriptType == MULTISIG_P2WSH ? 32 : 20;
+    NSMutableData *out = [NSMutableData dataWithLength:count * hashLen];
+    size_t derived = fast_crypto_multisig_derive_batch(
+      xpubs.bytes, xpubs.length / XPUB_LENGTH,
+      m,
+      (uint32_t)startIndex, count,
+      (int)scriptType,
+      (unsigned)threads,
+      out.mutableBytes
+    );
+    if (derived != count) {
+      reject(@"Err", @"Cannot derive multisig scripts", nil);
+      return;
+    }
+    resolve(toBase64(out));
+  });
+}
 
+RCT_REMAP_METHOD(aes256CbcEncrypt,
+                 aes256CbcEncrypt:(NSString *)key64
+                 iv:(NSString *)iv64
+                 data:(NSString *)data64
+                 pad:(BOOL)pad
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *key = fromBase64(key64);
+    NSData *iv = fromBase64(iv64);
+    NSData *data = fromBase64(data64);
+    if (key.length != AES256_KEY_LENGTH || iv.length != AES_BLOCK_LENGTH) {
+      reject(@"Err", @"Invalid key or IV", nil);
+      return;
+    }
+
+    NSMutableData *out = [NSMutableData dataWithLength:data.length + AES_BLOCK_LENGTH];
+    size_t outLen;
+    if (!fast_crypto_aes256_cbc_encrypt(key.bytes, iv.bytes, data.bytes, data.length, pad,
+                                        out.mutableBytes, &outLen)) {
+      reject(@"Err", @"Cannot encrypt", nil);
+      return;
+    }
+    out.length = outLen;
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(aes256CbcDecrypt,
+                 aes256CbcDecrypt:(NSString *)key64
+                 iv:(NSString *)iv64
+                 data:(NSString *)data64
+                 pad:(BOOL)pad
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *key = fromBase64(key64);
+    NSData *iv = fromBase64(iv64);
+    NSData *data = fromBase64(data64);
+    if (key.length != AES256_KEY_LENGTH || iv.length != AES_BLOCK_LENGTH) {
+      reject(@"Err", @"Invalid key or IV", nil);
+      return;
+    }
+
+    NSMutableData *out = [NSMutableData dataWithLength:data.length];
+    size_t outLen;
+    if (!fast_crypto_aes256_cbc_decrypt(key.bytes, iv.bytes, data.bytes, data.length, pad,
+                                        out.mutableBytes, &outLen)) {
+      reject(@"Err", @"Cannot decrypt", nil);
+      return;
+    }
+    out.length = outLen;
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(aes256GcmEncrypt,
+                 aes256GcmEncrypt:(NSString *)key64
+                 iv:(NSString *)iv64
+                 aad:(NSString *)aad64
+                 data:(NSString *)data64
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *key = fromBase64(key64);
+    NSData *iv = fromBase64(iv64);
+    NSData *aad = fromBase64(aad64);
+    NSData *data = fromBase64(data64);
+    if (key.length != AES256_KEY_LENGTH || iv.length != AES_GCM_IV_LENGTH) {
+      reject(@"Err", @"Invalid key or IV", nil);
+      return;
+    }
+
+    // The tag goes after the ciphertext:
+    NSMutableData *out = [NSMutableData dataWithLength:data.length + AES_GCM_TAG_LENGTH];
+    uint8_t *bytes = out.mutableBytes;
+    fast_crypto_aes256_gcm_encrypt(
+      key.bytes, iv.bytes,
+      aad.bytes, aad.length,
+      data.bytes, data.length,
+      bytes, bytes + data.length
+    );
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(aes256GcmDecrypt,
+                 aes256GcmDecrypt:(NSString *)key64
+                 iv:(NSString *)iv64
+                 aad:(NSString *)aad64
+                 data:(NSString *)data64
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *key = fromBase64(key64);
+    NSData *iv = fromBase64(iv64);
+    NSData *aad = fromBase64(aad64);
+    NSData *data = fromBase64(data64);
+    if (key.length != AES256_KEY_LENGTH || iv.length != AES_GCM_IV_LENGTH ||
+        data.length < AES_GCM_TAG_LENGTH) {
+      reject(@"Err", @"Invalid key, IV, or data", nil);
+      return;
+    }
+
+    size_t length = data.length - AES_GCM_TAG_LENGTH;
+    NSMutableData *out = [NSMutableData dataWithLength:length];
+    const uint8_t *bytes = data.bytes;
+    if (!fast_crypto_aes256_gcm_decrypt(
+      key.bytes, iv.bytes,
+      aad.bytes, aad.length,
+      bytes, length, bytes + length,
+      out.mutableBytes
+    )) {
+      reject(@"Err", @"Cannot decrypt", nil);
+      return;
+    }
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(aesSetImplementation,
+                 aesSetImplementation:(NSInteger)implementation
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  resolve(fast_crypto_aes_set_implementation((int)implementation) ? @YES : @NO);
+}
+
+RCT_REMAP_METHOD(aesGetImplementation,
+                 aesGetImplementation:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  resolve(@(fast_crypto_aes_get_implementation()));
+}
+
+RCT_REMAP_METHOD(chacha20Poly1305Encrypt,
+                 chacha20Poly1305Encrypt:(NSString *)key64
+                 nonce:(NSString *)nonce64
+                 aad:(NSString *)aad64
+                 data:(NSString *)data64
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *key = fromBase64(key64);
+    NSData *nonce = fromBase64(nonce64);
+    NSData *aad = fromBase64(aad64);
+    NSData *data = fromBase64(data64);
+    if (key.length != CHACHA20_POLY1305_KEY_LENGTH) {
+      reject(@"Err", @"Invalid key", nil);
+      return;
+    }
+
+    // The tag goes after the ciphertext:
+    NSMutableData *out = [NSMutableData dataWithLength:data.length + CHACHA20_POLY1305_TAG_LENGTH];
+    uint8_t *bytes = out.mutableBytes;
+    if (!fast_crypto_chacha20_poly1305_encrypt(
+      key.bytes,
+      nonce.bytes, nonce.length,
+      aad.bytes, aad.length,
+      data.bytes, data.length,
+      bytes, bytes + data.length
+    )) {
+      reject(@"Err", @"Invalid nonce", nil);
+      return;
+    }
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(chacha20Poly1305Decrypt,
+                 chacha20Poly1305Decrypt:(NSString *)key64
+                 nonce:(NSString *)nonce64
+                 aad:(NSString *)aad64
+                 data:(NSString *)data64
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *key = fromBase64(key64);
+    NSData *nonce = fromBase64(nonce64);
+    NSData *aad = fromBase64(aad64);
+    NSData *data = fromBase64(data64);
+    if (key.length != CHACHA20_POLY1305_KEY_LENGTH || data.length < CHACHA20_POLY1305_TAG_LENGTH) {
+      reject(@"Err", @"Invalid key or data", nil);
+      return;
+    }
+
+    size_t length = data.length - CHACHA20_POLY1305_TAG_LENGTH;
+    NSMutableData *out = [NSMutableData dataWithLength:length];
+    const uint8_t *bytes = data.bytes;
+    if (!fast_crypto_chacha20_poly1305_decrypt(
+      key.bytes,
+      nonce.bytes, nonce.length,
+      aad.bytes, aad.length,
+      bytes, length, bytes + length,
+      out.mutableBytes
+    )) {
+      reject(@"Err", @"Cannot decrypt", nil);
+      return;
+    }
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(chacha20Poly1305StreamCreate,
+                 chacha20Poly1305StreamCreate:(NSString *)key64
+                 nonce:(NSString *)nonce64
+                 aad:(NSString *)aad64
+                 decrypt:(BOOL)decrypt
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *key = fromBase64(key64);
+    NSData *nonce = fromBase64(nonce64);
+    NSData *aad = fromBase64(aad64);
+    if (key.length != CHACHA20_POLY1305_KEY_LENGTH) {
+      reject(@"Err", @"Invalid key", nil);
+      return;
+    }
+
+    uint32_t stream = fast_crypto_chacha20_poly1305_stream_create(
+      key.bytes,
+      nonce.bytes, nonce.length,
+      aad.bytes, aad.length,
+      decrypt
+    );
+    if (stream == 0) {
+      reject(@"Err", @"Cannot open stream", nil);
+      return;
+    }
+    resolve(@(stream));
+  });
+}
+
+RCT_REMAP_METHOD(chacha20Poly1305StreamUpdate,
+                 chacha20Poly1305StreamUpdate:(NSUInteger)stream
+                 data:(NSString *)data64
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *data = fromBase64(data64);
+
+    NSMutableData *out = [NSMutableData dataWithLength:data.length];
+    if (!fast_crypto_chacha20_poly1305_stream_update(
+      (uint32_t)stream, data.bytes, data.length, out.mutableBytes
+    )) {
+      reject(@"Err", @"Invalid stream", nil);
+      return;
+    }
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(chacha20Poly1305StreamFinal,
+                 chacha20Poly1305StreamFinal:(NSUInteger)stream
+                 tag:(NSString *)tag64
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    // Decrypting streams check this tag, and encrypting streams replace it:
+    NSData *tag = fromBase64(tag64);
+    NSMutableData *out = [NSMutableData dataWithData:tag];
+    out.length = CHACHA20_POLY1305_TAG_LENGTH;
+    if (!fast_crypto_chacha20_poly1305_stream_final((uint32_t)stream, out.mutableBytes)) {
+      reject(@"Err", @"Invalid stream or tag", nil);
+      return;
+    }
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(chacha20Poly1305StreamRelease,
+                 chacha20Poly1305StreamRelease:(NSUInteger)stream
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    fast_crypto_chacha20_poly1305_stream_release((uint32_t)stream);
+    resolve(nil);
+  });
+}
+
+RCT_REMAP_METHOD(chacha20SetImplementation,
+                 chacha20SetImplementation:(NSInteger)implementation
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  resolve(fast_crypto_chacha20_set_implementation((int)implementation) ? @YES : @NO);
+}
+
+RCT_REMAP_METHOD(chacha20GetImplementation,
+                 chacha20GetImplementation:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  resolve(@(fast_crypto_chacha20_get_implementation()));
+}
+
+RCT_REMAP_METHOD(recordsDecryptBatch,
+                 recordsDecryptBatch:(NSString *)key64
+                 records:(NSString *)records64
+                 recordLens:(NSString *)recordLens64
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *key = fromBase64(key64);
+    NSData *records = fromBase64(records64);
+    NSData *recordLens = fromBase64(recordLens64);
+    if (key.length != RECORD_KEY_LENGTH || !checkPackedLens(records, recordLens)) {
+      reject(@"Err", @"Invalid record layout", nil);
+      return;
+    }
+
+    size_t count = recordLens.length / 4;
+    NSMutableData *plaintexts = [NSMutableData dataWithLength:records.length];
+    NSMutableData *plaintextLens = [NSMutableData dataWithLength:count * 4];
+    NSMutableData *statuses = [NSMutableData dataWithLength:count];
+    fast_crypto_records_decrypt_batch(
+      key.bytes,
+      records.bytes, recordLens.bytes, count, (unsigned)threads,
+      plaintexts.mutableBytes, plaintextLens.mutableBytes, statuses.mutableBytes
+    );
+    resolve(packRecords(recordLens, plaintexts, plaintextLens, statuses));
+  });
+}
+
+RCT_REMAP_METHOD(recordsDecryptBatchScrypt,
+                 recordsDecryptBatchScrypt:(NSString *)password64
+                 salt:(NSString *)salt64
+                 N:(NSUInteger)N
+                 r:(NSUInteger)r
+                 p:(NSUInteger)p
+                 records:(NSString *)records64
+                 recordLens:(NSString *)recordLens64
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *password = fromBase64(password64);
+    NSData *salt = fromBase64(salt64);
+    NSData *records = fromBase64(records64);
+    NSData *recordLens = fromBase64(recordLens64);
+    if (!checkPackedLens(records, recordLens)) {
+      reject(@"Err", @"Invalid record layout", nil);
+      return;
+    }
+
+    size_t count = recordLens.length / 4;
+    NSMutableData *plaintexts = [NSMutableData dataWithLength:records.length];
+    NSMutableData *plaintextLens = [NSMutableData dataWithLength:count * 4];
+    NSMutableData *statuses = [NSMutableData dataWithLength:count];
+    fast_crypto_records_decrypt_batch_scrypt(
+      password.bytes, password.length,
+      salt.bytes, salt.length,
+      N, (uint32_t)r, (uint32_t)p,
+      records.bytes, recordLens.bytes, count, (unsigned)threads,
+      plaintexts.mutableBytes, plaintextLens.mutableBytes, statuses.mutableBytes
+    );
+    resolve(packRecords(recordLens, plaintexts, plaintextLens, statuses));
+  });
+}
+
+RCT_REMAP_METHOD(ed25519PubkeyCreateBatch,
+                 ed25519PubkeyCreateBatch:(NSString *)privateKeys64
+                 count:(NSUInteger)count
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *privateKeys = fromBase64(privateKeys64);
+    if (count == 0 || privateKeys.length != count * ED25519_PRIVKEY_LENGTH) {
+      reject(@"Err", @"Invalid private key", nil);
+      return;
+    }
+
+    NSMutableData *publicKeys = [NSMutableData dataWithLength:count * ED25519_PUBKEY_LENGTH];
+    fast_crypto_ed25519_pubkey_create_batch(
+      privateKeys.bytes,
+      count,
+      (unsigned)threads,
+      publicKeys.mutableBytes
+    );
+    resolve(toBase64(publicKeys));
+  });
+}
+
+RCT_REMAP_METHOD(ed25519Sign,
+                 ed25519Sign:(NSString *)privateKey64
+                 msg:(NSString *)msg64
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    NSData *privateKey = fromBase64(privateKey64);
+    NSData *msg = fromBase64(msg64);
+    if (privateKey.length != ED25519_PRIVKEY_LENGTH) {
+      reject(@"Err", @"Invalid private key", nil);
+      return;
+    }
+
+    uint8_t sig[ED25519_SIGNATURE_LENGTH];
+    fast_crypto_ed25519_sign(privateKey.bytes, msg.bytes, msg.length, sig);
+    resolve(toBase64([NSData dataWithBytes:sig length:sizeof(sig)]));
+  });
+}
+
+RCT_REMAP_METHOD(ed25519VerifyBatch,
+                 ed25519VerifyBatch:(NSString *)sigs64
+                 msgs:(NSString *)msgs64
+                 msgLens:(NSString *)msgLens64
+                 publicKeys:(NSString *)publicKeys64
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *sigs = fromBase64(sigs64);
+    NSData *msgs = fromBase64(msgs64);
+    NSData *msgLens = fromBase64(msgLens64);
+    NSData *publicKeys = fromBase64(publicKeys64);
+    size_t count = msgLens.length / 4;
+    if (
+      count == 0 ||
+      !checkPackedLens(msgs, msgLens) ||
+      sigs.length != count * ED25519_SIGNATURE_LENGTH ||
+      publicKeys.length != count * ED25519_PUBKEY_LENGTH
+    ) {
+      reject(@"Err", @"Invalid batch layout", nil);
+      return;
+    }
+
+    NSMutableData *results = [NSMutableData dataWithLength:count];
+    fast_crypto_ed25519_verify_batch(
+      sigs.bytes,
+      msgs.bytes,
+      msgLens.bytes,
+      publicKeys.bytes,
+      count,
+      (unsigned)threads,
+      results.mutableBytes
+    );
+    resolve(toBase64(results));
+  });
+}
+
+RCT_REMAP_METHOD(slip10Ed25519DeriveBatch,
+                 slip10Ed25519DeriveBatch:(NSString *)seed64
+                 paths:(NSString *)paths64
+                 pathLens:(NSString *)pathLens64
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *seed = fromBase64(seed64);
+    NSData *paths = fromBase64(paths64);
+    NSData *pathLens = fromBase64(pathLens64);
+    size_t count = pathLens.length / 4;
+    const uint32_t *lens = pathLens.bytes;
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) total += lens[i];
+    if (count == 0 || pathLens.length % 4 != 0 || paths.length != total * 4) {
+      reject(@"Err", @"Invalid batch layout", nil);
+      return;
+    }
+
+    // The private keys come first, followed by the public keys:
+    NSMutableData *out =
+      [NSMutableData dataWithLength:count * (ED25519_PRIVKEY_LENGTH + ED25519_PUBKEY_LENGTH)];
+    uint8_t *keys = out.mutableBytes;
+    size_t derived = fast_crypto_slip10_ed25519_derive_batch(
+      seed.bytes, seed.length,
+      paths.bytes, lens, count, (unsigned)threads,
+      keys, keys + count * ED25519_PRIVKEY_LENGTH
+    );
+    if (derived != count) {
+      reject(@"Err", @"Invalid derivation path", nil);
+      return;
+    }
+    NSString *result = toBase64(out);
+    memset(out.mutableBytes, 0, out.length);
+    resolve(result);
+  });
+}
+
+RCT_REMAP_METHOD(argon2id,
+                 argon2id:(NSString *)password64
+                 salt:(NSString *)salt64
+                 t:(NSUInteger)t
+                 m:(NSUInteger)m
+                 p:(NSUInteger)p
+                 threads:(NSUInteger)threads
+                 size:(NSUInteger)size
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *password = fromBase64(password64);
+    NSData *salt = fromBase64(salt64);
+
+    NSMutableData *out = [NSMutableData dataWithLength:size];
+    if (!fast_crypto_argon2id(
+      password.bytes, password.length,
+      salt.bytes, salt.length,
+      (uint32_t)t, (uint32_t)m, (uint32_t)p, (unsigned)threads,
+      out.mutableBytes, size
+    )) {
+      reject(@"Err", @"Invalid Argon2 parameters", nil);
+      return;
+    }
+    NSString *result = toBase64(out);
+    memset(out.mutableBytes, 0, out.length);
+    resolve(result);
+  });
+}
+
+RCT_REMAP_METHOD(argon2SetImplementation,
+                 argon2SetImplementation:(NSInteger)implementation
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  resolve(fast_crypto_argon2_set_implementation((int)implementation) ? @YES : @NO);
+}
+
+RCT_REMAP_METHOD(argon2GetImplementation,
+                 argon2GetImplementation:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  resolve(@(fast_crypto_argon2_get_implementation()));
+}
+
+RCT_REMAP_METHOD(bip39MnemonicToSeedBatch,
+                 bip39MnemonicToSeedBatch:(NSString *)mnemonic64
+                 passphrases:(NSString *)passphrases64
+                 passphraseLens:(NSString *)passphraseLens64
+                 wordlist:(NSString *)wordlist64
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *mnemonic = fromBase64(mnemonic64);
+    NSData *passphrases = fromBase64(passphrases64);
+    NSData *passphraseLens = fromBase64(passphraseLens64);
+    NSData *wordlist = fromBase64(wordlist64);
+    if (!checkPackedLens(passphrases, passphraseLens)) {
+      reject(@"Err", @"Invalid passphrase layout", nil);
+      return;
+    }
+
+    // The statuses come first, followed by the seeds and the master keys:
+    size_t count = passphraseLens.length / 4;
+    NSMutableData *out =
+      [NSMutableData dataWithLength:count * (1 + BIP39_SEED_LENGTH + XPRV_LENGTH)];
+    uint8_t *bytes = out.mutableBytes;
+    fast_crypto_bip39_mnemonic_to_seed_batch(
+      mnemonic.bytes, mnemonic.length,
+      passphrases.bytes, passphraseLens.bytes, count,
+      wordlist.length == 0 ? NULL : wordlist.bytes, wordlist.length, (unsigned)threads,
+      bytes + count, bytes + count * (1 + BIP39_SEED_LENGTH), bytes
+    );
+    NSString *result = toBase64(out);
+    memset(out.mutableBytes, 0, out.length);
+    resolve(result);
+  });
+}
+
+RCT_REMAP_METHOD(addressEncodeBatch,
+                 addressEncodeBatch:(NSInteger)format
+                 prefix:(NSString *)prefix64
+                 version:(NSUInteger)version
+                 payloads:(NSString *)payloads64
+                 payloadLens:(NSString *)payloadLens64
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *prefix = fromBase64(prefix64);
+    NSData *payloads = fromBase64(payloads64);
+    NSData *payloadLens = fromBase64(payloadLens64);
+    if (!checkPackedLens(payloads, payloadLens)) {
+      reject(@"Err", @"Invalid payload layout", nil);
+      return;
+    }
+
+    size_t count = payloadLens.length / 4;
+    NSMutableData *addresses = [NSMutableData dataWithLength:count * ADDRESS_MAX_LENGTH];
+    fast_crypto_address_encode_batch(
+      (int)format, prefix.bytes, prefix.length, (uint32_t)version,
+      payloads.bytes, payloadLens.bytes, count, (unsigned)threads,
+      addresses.mutableBytes
+    );
+
+    // Addresses are plain ASCII, so they go back as one newline-separated string:
+    NSMutableString *out = [NSMutableString stringWithCapacity:count * 64];
+    for (size_t i = 0; i < count; ++i) {
+      if (i > 0) [out appendString:@"\n"];
+      [out appendString:@((const char *)addresses.bytes + i * ADDRESS_MAX_LENGTH)];
+    }
+    resolve(out);
+  });
+}
+
+RCT_REMAP_METHOD(addressDecodeBatch,
+                 addressDecodeBatch:(NSInteger)format
+                 prefix:(NSString *)prefix64
+                 addresses:(NSString *)addresses
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *prefix = fromBase64(prefix64);
+
+    // The addresses arrive as one newline-separated string:
+    const char *text = addresses.UTF8String;
+    size_t textLen = strlen(text);
+    NSMutableData *packed = [NSMutableData dataWithCapacity:textLen];
+    NSMutableData *addressLens = [NSMutableData data];
+    size_t start = 0;
+    for (size_t i = 0; i <= textLen; ++i) {
+      if (i == textLen || text[i] == '\n') {
+        uint32_t len = (uint32_t)(i - start);
+        [packed appendBytes:text + start length:len];
+        [addressLens appendBytes:&len length:sizeof(len)];
+        start = i + 1;
+      }
+    }
+
+    size_t count = addressLens.length / 4;
+    NSMutableData *payloads = [NSMutableData dataWithLength:count * ADDRESS_PAYLOAD_MAX_LENGTH];
+    NSMutableData *payloadLens = [NSMutableData dataWithLength:count * sizeof(uint32_t)];
+    NSMutableData *versions = [NSMutableData dataWithLength:count * sizeof(int32_t)];
+    fast_crypto_address_decode_batch(
+      (int)format, prefix.bytes, prefix.length, packed.bytes, addressLens.bytes, count,
+      (unsigned)threads, payloads.mutableBytes, payloadLens.mutableBytes, versions.mutableBytes
+    );
+
+    // Each address packs its version byte (0xff if it failed),
+    // its payload length byte, and its payload:
+    const uint32_t *lens = payloadLens.bytes;
+    const int32_t *ids = versions.bytes;
+    NSMutableData *out = [NSMutableData dataWithCapacity:count * 34];
+    for (size_t i = 0; i < count; ++i) {
+      uint8_t header[2] = { ids[i] < 0 ? 0xff : (uint8_t)ids[i], (uint8_t)lens[i] };
+      [out appendBytes:header length:sizeof(header)];
+      [out appendBytes:(const uint8_t *)payloads.bytes + i * ADDRESS_PAYLOAD_MAX_LENGTH
+                length:lens[i]];
+    }
+    resolve(toBase64(out));
+  });
+}
+
+RCT_REMAP_METHOD(randomBytes,
+                 randomBytes:(NSInteger)size
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_INTERACTIVE, reject, ^{
+    if (size < 0) {
+      reject(@"Err", @"Cannot generate random bytes", nil);
+      return;
+    }
+    NSMutableData *out = [NSMutableData dataWithLength:size];
+    if (!fast_crypto_random_bytes(out.mutableBytes, out.length)) {
+      reject(@"Err", @"Cannot generate random bytes", nil);
+      return;
+    }
+    NSString *result = toBase64(out);
+    memset(out.mutableBytes, 0, out.length);
+    resolve(result);
+  });
+}
+
+RCT_REMAP_METHOD(keysGenerateBatch,
+                 keysGenerateBatch:(NSInteger)keyType
+                 count:(NSUInteger)count
+                 threads:(NSUInteger)threads
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    size_t publicKeyLen =
+      keyType == KEYGEN_SECP256K1_COMPRESSED ? COMPRESSED_PUBKEY_LENGTH :
+      keyType == KEYGEN_SECP256K1_UNCOMPRESSED ? DECOMPRESSED_PUBKEY_LENGTH :
+      XONLY_PUBKEY_LENGTH;
+
+    // The private keys come first, followed by the public keys:
+    NSMutableData *keys = [NSMutableData dataWithLength:count * (SECRET_KEY_LENGTH + publicKeyLen)];
+    uint8_t *bytes = keys.mutableBytes;
+    size_t generated = fast_crypto_keys_generate_batch(
+      (int)keyType, count, (unsigned)threads, bytes, bytes + count * SECRET_KEY_LENGTH
+    );
+    NSString *result =
+      count > 0 && generated == count ? toBase64(keys) : nil;
+    memset(keys.mutableBytes, 0, keys.length);
+    if (result == nil) {
+      reject(@"Err", @"Cannot generate keys", nil);
+      return;
+    }
+    resolve(result);
+  });
+}
+
+RCT_REMAP_METHOD(poolConfigure,
+                 poolConfigure:(NSInteger)priority
+                 threads:(NSInteger)threads
+                 queueLimit:(NSInteger)queueLimit
+                 cpus:(NSArray<NSNumber *> *)cpus
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  if (threads <= 0 || queueLimit <= 0) {
+    resolve(@NO);
+    return;
+  }
+  NSMutableData *cpuList = [NSMutableData dataWithLength:cpus.count * sizeof(int)];
+  int *cpuItems = cpuList.mutableBytes;
+  for (NSUInteger i = 0; i < cpus.count; ++i) {
+    cpuItems[i] = cpus[i].intValue;
+  }
+  int success = fast_crypto_pool_configure((int)priority, (unsigned)threads,
+                                           (size_t)queueLimit, cpuItems, cpus.count);
+  resolve(success ? @YES : @NO);
+}
+
+RCT_REMAP_METHOD(pipelineRun,
+                 pipelineRun:(NSString *)steps64
+                 inputs:(NSString *)inputs64
+                 inputLens:(NSString *)inputLens64
+                 outputSlot:(NSInteger)outputSlot
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    NSData *steps = fromBase64(steps64);
+    NSMutableData *inputs = fromBase64(inputs64);
+    NSData *inputLens = fromBase64(inputLens64);
+    if (steps == nil || inputs == nil || steps.length % PIPELINE_STEP_LENGTH != 0 ||
+        outputSlot < 0 || !checkPackedLens(inputs, inputLens)) {
+      reject(@"Err", @"Invalid pipeline layout", nil);
+      return;
+    }
+    size_t stepCount = steps.length / PIPELINE_STEP_LENGTH;
+    size_t inputCount = inputLens.length / 4;
+
+    // The status byte and little-endian 32-bit step index come first,
+    // followed by the output:
+    size_t outSize, outLen = 0, failedStep;
+    int status = fast_crypto_pipeline_check(
+      steps.bytes, stepCount, inputLens.bytes, inputCount, (unsigned)outputSlot,
+      &outSize, &failedStep
+    );
+    NSMutableData *out = [NSMutableData dataWithLength:5 + (status == PIPELINE_OK ? outSize : 0)];
+    uint8_t *bytes = out.mutableBytes;
+    if (status == PIPELINE_OK) {
+      status = fast_crypto_pipeline_run(
+        steps.bytes, stepCount, inputs.bytes, inputLens.bytes, inputCount,
+        (unsigned)outputSlot, bytes + 5, &outLen, &failedStep
+      );
+    }
+    memset(inputs.mutableBytes, 0, inputs.length);
+    uint32_t step = (uint32_t)failedStep;
+    bytes[0] = (uint8_t)status;
+    memcpy(bytes + 1, &step, 4);
+
+    NSString *result = toBase64([NSData dataWithBytesNoCopy:bytes length:5 + outLen freeWhenDone:NO]);
+    memset(bytes, 0, out.length);
+    resolve(result);
+  });
+}
+
+RCT_REMAP_METHOD(statsSnapshot,
+                 statsSnapshotWithResolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  NSMutableData *out = [NSMutableData dataWithLength:STATS_SNAPSHOT_LENGTH];
+  fast_crypto_stats_snapshot(out.mutableBytes);
+  resolve(toBase64(out));
+}
+
+RCT_REMAP_METHOD(statsReset,
+                 statsResetWithResolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  fast_crypto_reset_stats();
+  resolve(nil);
+}
+
+RCT_REMAP_METHOD(traceStart,
+                 traceStart:(NSInteger)maxEvents
+                 resolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  BOOL started = maxEvents > 0 && fast_crypto_trace_start((size_t)maxEvents);
+  resolve(@(started));
+}
+
+RCT_REMAP_METHOD(traceStop,
+                 traceStopWithResolver:(RCTPromiseResolveBlock)resolve
+                 rejecter:(RCTPromiseRejectBlock)reject)
+{
+  submit(POOL_PRIORITY_BACKGROUND, reject, ^{
+    // The first call stops the trace, so the second sees the same events:
+    NSMutableData *json = [NSMutableData dataWithLength:fast_crypto_trace_stop(NULL, 0) + 1];
+    fast_crypto_trace_stop(json.mutableBytes, json.length);
+    resolve([NSString stringWithUTF8String:json.bytes]);
+  });
+}
+
+@end
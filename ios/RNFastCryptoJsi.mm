@@ -0,0 +1,41 @@
+#import <React/RCTBridge+Private.h>
+#import <React/RCTBridgeModule.h>
+#import <ReactCommon/CallInvoker.h>
+#import <jsi/jsi.h>
+
+#include "../src/jsi/jsi-bindings.h"
+
+/**
+ * Installs the JSI bindings from src/jsi, which let JavaScript pass
+ * ArrayBuffers straight to the native code instead of base64 strings
+ * over the bridge.
+ */
+@interface RNFastCryptoJsi : NSObject <RCTBridgeModule>
+
+@end
+
+@implementation RNFastCryptoJsi
+
+@synthesize bridge = _bridge;
+
+RCT_EXPORT_MODULE()
+
+/**
+ * Returns NO if there is no JSI runtime to install into,
+ * such as under remote debugging.
+ */
+RCT_EXPORT_BLOCKING_SYNCHRONOUS_METHOD(install)
+{
+  RCTCxxBridge *cxxBridge = (RCTCxxBridge *)self.bridge;
+  if (cxxBridge == nil || cxxBridge.runtime == nil) return @NO;
+
+  std::shared_ptr<facebook::react::CallInvoker> callInvoker = cxxBridge.jsCallInvoker;
+  fastcrypto::installJsi(
+    *(facebook::jsi::Runtime *)cxxBridge.runtime,
+    [callInvoker](std::function<void()> callback) {
+      callInvoker->invokeAsync(std::move(callback));
+    });
+  return @YES;
+}
+
+@end
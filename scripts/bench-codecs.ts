@@ -0,0 +1,37 @@
+// Run this script as `node -r sucrase/register ./scripts/bench-codecs.ts`
+//
+// It will:
+// - Build the base64 & hex codecs and their benchmark for the desktop.
+// - Report the throughput of each implementation this CPU can run.
+//
+
+import { mkdir } from 'fs/promises'
+import { join } from 'path'
+
+import { loudExec, tmpPath } from './utils/common'
+import { srcPath } from './utils/native-sources'
+
+const benchPath = join(__dirname, '../bench')
+
+async function main(): Promise<void> {
+  const working = join(tmpPath, 'desktop')
+  await mkdir(working, { recursive: true })
+
+  console.log('Building the codec benchmark for the desktop')
+  const program = join(working, 'codec-bench')
+  await loudExec('cc', [
+    '-O2',
+    `-o${program}`,
+    `-I${srcPath}`,
+    join(benchPath, 'codec-bench.c'),
+    ...['encoding/codec.c', 'encoding/codec_arm.c', 'encoding/codec_x86.c'].map(
+      source => join(srcPath, source)
+    )
+  ])
+  await loudExec(program, [])
+}
+
+main().catch((error: unknown) => {
+  console.log(error)
+  process.exitCode = 1
+})
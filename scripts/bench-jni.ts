@@ -0,0 +1,101 @@
+// Run this script as `node -r sucrase/register ./scripts/bench-jni.ts`
+//
+// It will:
+// - Download libsecp256k1.
+// - Build libfastcrypto.so for the desktop, using the JDK in JAVA_HOME.
+// - Run the JNI bridge benchmark in android/bench on the desktop JVM.
+//
+
+import { mkdir } from 'fs/promises'
+import { cpus } from 'os'
+import { join } from 'path'
+
+import { loudExec, tmpPath } from './utils/common'
+import {
+  defines,
+  getSecp256k1,
+  includePaths,
+  secp256k1Options,
+  sources,
+  srcPath
+} from './utils/native-sources'
+
+const benchPath = join(__dirname, '../android/bench')
+const javaPath = join(__dirname, '../android/src/main/java/co/airbitz/fastcrypto')
+
+async function main(): Promise<void> {
+  const javaHome = process.env.JAVA_HOME
+  if (javaHome == null) throw new Error('Please set JAVA_HOME')
+
+  await mkdir(tmpPath, { recursive: true })
+  await getSecp256k1()
+  const working = join(tmpPath, 'desktop')
+
+  // Build libsecp256k1 with CMake:
+  await loudExec('cmake', [
+    // Source directory:
+    `-S${join(tmpPath, 'libsecp256k1')}`,
+    // Build directory:
+    `-B${join(working, 'libsecp256k1')}`,
+    // Build options:
+    `-DCMAKE_BUILD_TYPE=Release`,
+    `-DCMAKE_INSTALL_PREFIX=${working}`,
+    `-DCMAKE_INSTALL_LIBDIR=lib`,
+    `-DCMAKE_POSITION_INDEPENDENT_CODE=ON`,
+    // libsecp256k1 options:
+    ...secp256k1Options
+  ])
+  await loudExec('cmake', [
+    '--build',
+    join(working, 'libsecp256k1'),
+    '--target',
+    'install',
+    '--',
+    `-j${cpus().length}`
+  ])
+
+  // Build the library:
+  console.log('Linking libfastcrypto.so for the desktop')
+  await loudExec('c++', [
+    '-shared',
+    '-fPIC',
+    '-O2',
+    `-o${join(working, 'libfastcrypto.so')}`,
+    ...includePaths.map(path => `-I${join(tmpPath, path)}`),
+    `-I${join(javaHome, 'include')}`,
+    `-I${join(javaHome, 'include/linux')}`,
+    ...defines,
+    ...[...sources, 'jni/jni.cpp'].flatMap(source => [
+      '-x',
+      source.endsWith('.c') ? 'c' : 'c++',
+      join(srcPath, source)
+    ]),
+    '-x',
+    'none',
+    join(working, 'lib/libsecp256k1.a'),
+    '-lpthread',
+    `-Wl,--version-script=${join(srcPath, 'jni/exports.map')}`,
+    '-Wl,--no-undefined'
+  ])
+
+  // Build and run the benchmark:
+  const classesPath = join(working, 'classes')
+  await loudExec(join(javaHome, 'bin/javac'), [
+    '-d',
+    classesPath,
+    join(benchPath, 'co/airbitz/fastcrypto/BridgeBench.java'),
+    join(benchPath, 'co/airbitz/fastcrypto/RNFastCryptoModule.java'),
+    join(javaPath, 'Bytes.java')
+  ])
+  await loudExec(join(javaHome, 'bin/java'), [
+    `-Djava.library.path=${working}`,
+    '-cp',
+    classesPath,
+    'co.airbitz.fastcrypto.BridgeBench'
+  ])
+}
+
+main().catch((error: unknown) => {
+  console.log(error)
+  process.exitCode = 1
+})
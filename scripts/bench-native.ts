@@ -0,0 +1,25 @@
+// Run this script as `node -r sucrase/register ./scripts/bench-native.ts`
+//
+// It will:
+// - Build the native core and its benchmark for the desktop with CMake.
+// - Time scrypt, PBKDF2, the hashes, and the secp256k1 calls.
+//
+// Any arguments go to the benchmark, so
+// `npm run bench-native -- --format csv --output bench.csv`
+// saves a run for later comparison.
+//
+
+import { loudExec } from './utils/common'
+import { buildHostTarget } from './utils/host-build'
+
+async function main(): Promise<void> {
+  const program = await buildHostTarget('native-bench')
+
+  // Run from here, so relative output paths work:
+  await loudExec(program, process.argv.slice(2), { cwd: process.cwd() })
+}
+
+main().catch((error: unknown) => {
+  console.log(error)
+  process.exitCode = 1
+})
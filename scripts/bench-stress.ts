@@ -0,0 +1,28 @@
+// Run this script as `node -r sucrase/register ./scripts/bench-stress.ts`
+//
+// It will:
+// - Build the native core and its load test for the desktop with CMake.
+// - Run a mix of scrypt, key, tweak, and hash calls from 1 to N threads.
+// - Report throughput, tail latency, and memory use at each step.
+//
+// Any arguments go to the load test, such as `-- --threads 8`.
+// Set FAST_CRYPTO_TSAN=1 to run it under ThreadSanitizer,
+// which fails on the first data race.
+//
+
+import { loudExec } from './utils/common'
+import { buildHostTarget } from './utils/host-build'
+
+async function main(): Promise<void> {
+  const program = await buildHostTarget('native-stress')
+  const { FAST_CRYPTO_TSAN, TSAN_OPTIONS } = process.env
+  if (FAST_CRYPTO_TSAN === '1' && TSAN_OPTIONS == null) {
+    process.env.TSAN_OPTIONS = 'halt_on_error=1 second_deadlock_stack=1'
+  }
+  await loudExec(program, process.argv.slice(2), { cwd: process.cwd() })
+}
+
+main().catch((error: unknown) => {
+  console.log(error)
+  process.exitCode = 1
+})
@@ -13,8 +13,14 @@ import { join } from 'path'
 import { getNdkPath } from './utils/android-tools'
 import { getRepo, loudExec, quietExec, tmpPath } from './utils/common'
 import { getObjcopyPath } from './utils/ios-tools'
-
-const srcPath = join(__dirname, '../src')
+import {
+  defines,
+  getSecp256k1,
+  includePaths,
+  secp256k1Options,
+  sources,
+  srcPath
+} from './utils/native-sources'
 
 async function main(): Promise<void> {
   await mkdir(tmpPath, { recursive: true })
@@ -33,12 +39,7 @@ async function main(): Promise<void> {
 }
 
 async function downloadSources(): Promise<void> {
-  // libsecp256k1 0.6.0:
-  await getRepo(
-    'libsecp256k1',
-    'https://github.com/bitcoin-core/secp256k1.git',
-    '0cdc758a56360bf58a851fe91085a327ec97685a'
-  )
+  await getSecp256k1()
 
   // ios-cmake 4.5.0:
   await getRepo(
@@ -48,16 +49,6 @@ async function downloadSources(): Promise<void> {
   )
 }
 
-// Compiler options:
-const includePaths: string[] = ['libsecp256k1/include']
-
-// Source list (from src/):
-const sources: string[] = [
-  'native-crypto.cpp',
-  'scrypt/crypto_scrypt.c',
-  'scrypt/sha256.c'
-]
-
 interface AndroidPlatform {
   arch: string
   triple: string
@@ -111,8 +102,7 @@ async function buildAndroid(platform: AndroidPlatform): Promise<void> {
     `-DCMAKE_SYSTEM_NAME=Android`,
     `-DCMAKE_SYSTEM_VERSION=23`,
     // libsecp256k1 options:
-    `-DSECP256K1_ECMULT_WINDOW_SIZE=12`,
-    `-DSECP256K1_DISABLE_SHARED=ON`
+    ...secp256k1Options
   ])
   await loudExec('cmake', [
     '--build',
@@ -141,12 +131,12 @@ async function buildAndroid(platform: AndroidPlatform): Promise<void> {
     `-o${join(outPath, 'libfastcrypto.so')}`,
     join(working, 'lib/libsecp256k1.a'),
     ...includePaths.map(path => `-I${join(tmpPath, path)}`),
+    ...defines,
     ...jniSources.flatMap(source => [
       '-x',
       source.endsWith('.c') ? 'c' : 'c++',
       join(srcPath, source)
     ]),
-    '-llog',
     `-Wl,--version-script=${join(srcPath, 'jni/exports.map')}`,
     '-Wl,--no-undefined',
     '-Wl,-z,max-page-size=16384'
@@ -179,8 +169,7 @@ async function buildIos(platform: IosPlatform): Promise<void> {
     `-DPLATFORM=${cmakePlatform}`,
     `-GXcode`,
     // libsecp256k1 options:
-    `-DSECP256K1_ECMULT_WINDOW_SIZE=12`,
-    `-DSECP256K1_DISABLE_SHARED=ON`
+    ...secp256k1Options
   ])
   await loudExec('cmake', [
     '--build',
@@ -207,6 +196,7 @@ async function buildIos(platform: IosPlatform): Promise<void> {
   ]
   const cflags = [
     ...includePaths.map(path => `-I${join(tmpPath, path)}`),
+    ...defines,
     '-miphoneos-version-min=13.0',
     '-O2',
     '-Werror=partial-availability'
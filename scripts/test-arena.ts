@@ -0,0 +1,36 @@
+// Run this script as `node -r sucrase/register ./scripts/test-arena.ts`
+//
+// It will:
+// - Build the secure memory arena and its tests for the desktop.
+// - Check zeroing, wiping, reuse, and the guard pages.
+//
+
+import { mkdir } from 'fs/promises'
+import { join } from 'path'
+
+import { loudExec, tmpPath } from './utils/common'
+import { srcPath } from './utils/native-sources'
+
+const testPath = join(__dirname, '../test')
+
+async function main(): Promise<void> {
+  const working = join(tmpPath, 'desktop')
+  await mkdir(working, { recursive: true })
+
+  console.log('Building the secure memory arena tests for the desktop')
+  const program = join(working, 'arena-check')
+  await loudExec('cc', [
+    '-O2',
+    `-o${program}`,
+    `-I${srcPath}`,
+    join(testPath, 'arena-check.c'),
+    join(srcPath, 'arena/arena.c'),
+    '-lpthread'
+  ])
+  await loudExec(program, [])
+}
+
+main().catch((error: unknown) => {
+  console.log(error)
+  process.exitCode = 1
+})
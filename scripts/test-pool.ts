@@ -0,0 +1,38 @@
+// Run this script as `node -r sucrase/register ./scripts/test-pool.ts`
+//
+// It will:
+// - Build the native worker pool and its tests for the desktop.
+// - Check queue limits, ordering, and resizing.
+// - Measure how long interactive tasks wait under background load.
+//
+
+import { mkdir } from 'fs/promises'
+import { join } from 'path'
+
+import { loudExec, tmpPath } from './utils/common'
+import { srcPath } from './utils/native-sources'
+
+const testPath = join(__dirname, '../test')
+
+async function main(): Promise<void> {
+  const working = join(tmpPath, 'desktop')
+  await mkdir(working, { recursive: true })
+
+  console.log('Building the worker pool tests for the desktop')
+  const program = join(working, 'pool-latency')
+  await loudExec('c++', [
+    '-std=c++11',
+    '-O2',
+    `-o${program}`,
+    `-I${srcPath}`,
+    join(testPath, 'pool-latency.cpp'),
+    join(srcPath, 'pool/pool.cpp'),
+    '-lpthread'
+  ])
+  await loudExec(program, [])
+}
+
+main().catch((error: unknown) => {
+  console.log(error)
+  process.exitCode = 1
+})
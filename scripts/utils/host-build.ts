@@ -0,0 +1,43 @@
+import { mkdir } from 'fs/promises'
+import { cpus } from 'os'
+import { join } from 'path'
+
+import { loudExec, tmpPath } from './common'
+import { getSecp256k1 } from './native-sources'
+
+/**
+ * Builds one target from the top-level CMakeLists.txt for the desktop,
+ * and returns the path to the program.
+ * Set FAST_CRYPTO_STATS=1 for the call counters,
+ * or FAST_CRYPTO_TSAN=1 for a ThreadSanitizer build.
+ */
+export async function buildHostTarget(target: string): Promise<string> {
+  await mkdir(tmpPath, { recursive: true })
+  await getSecp256k1()
+
+  const tsan = process.env.FAST_CRYPTO_TSAN === '1'
+  const stats = process.env.FAST_CRYPTO_STATS === '1'
+  const working = join(tmpPath, tsan ? 'desktop/tsan' : 'desktop/host')
+
+  console.log(`Building ${target} for the desktop`)
+  await loudExec('cmake', [
+    // Source directory:
+    `-S${join(__dirname, '../..')}`,
+    // Build directory:
+    `-B${working}`,
+    // Build options:
+    `-DCMAKE_BUILD_TYPE=${tsan ? 'RelWithDebInfo' : 'Release'}`,
+    `-DFAST_CRYPTO_STATS=${stats ? 'ON' : 'OFF'}`,
+    `-DFAST_CRYPTO_TSAN=${tsan ? 'ON' : 'OFF'}`,
+    `-DSECP256K1_SOURCE_DIR=${join(tmpPath, 'libsecp256k1')}`
+  ])
+  await loudExec('cmake', [
+    '--build',
+    working,
+    '--target',
+    target,
+    '--',
+    `-j${cpus().length}`
+  ])
+  return join(working, target)
+}
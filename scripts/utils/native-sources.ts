@@ -0,0 +1,68 @@
+import { join } from 'path'
+
+import { getRepo } from './common'
+
+export const srcPath = join(__dirname, '../../src')
+
+/**
+ * Downloads libsecp256k1 0.6.0.
+ */
+export async function getSecp256k1(): Promise<void> {
+  await getRepo(
+    'libsecp256k1',
+    'https://github.com/bitcoin-core/secp256k1.git',
+    '0cdc758a56360bf58a851fe91085a327ec97685a'
+  )
+}
+
+// Compiler options:
+export const includePaths: string[] = ['libsecp256k1/include']
+
+// Set FAST_CRYPTO_STATS=1 to build the call counters and tracing:
+export const defines: string[] =
+  process.env.FAST_CRYPTO_STATS === '1' ? ['-DFAST_CRYPTO_STATS=1'] : []
+
+// libsecp256k1 CMake options:
+export const secp256k1Options: string[] = [
+  `-DSECP256K1_ECMULT_WINDOW_SIZE=12`,
+  `-DSECP256K1_DISABLE_SHARED=ON`,
+  `-DSECP256K1_ENABLE_MODULE_ECDH=ON`,
+  `-DSECP256K1_ENABLE_MODULE_EXTRAKEYS=ON`,
+  `-DSECP256K1_ENABLE_MODULE_MUSIG=ON`,
+  `-DSECP256K1_ENABLE_MODULE_RECOVERY=ON`,
+  `-DSECP256K1_ENABLE_MODULE_SCHNORRSIG=ON`
+]
+
+// Source list (from src/):
+export const sources: string[] = [
+  'native-crypto.cpp',
+  'arena/arena.c',
+  'argon2/argon2.c',
+  'argon2/argon2_arm.c',
+  'argon2/argon2_x86.c',
+  'bip39/bip39.c',
+  'bip39/nfkd.c',
+  'cipher/aes.c',
+  'cipher/aes_arm.c',
+  'cipher/aes_x86.c',
+  'cipher/chacha20.c',
+  'cipher/chacha20_arm.c',
+  'cipher/chacha20_x86.c',
+  'cipher/chacha20poly1305.c',
+  'cipher/poly1305.c',
+  'curve/ed25519.c',
+  'encoding/base58.c',
+  'encoding/bech32.c',
+  'encoding/codec.c',
+  'encoding/codec_arm.c',
+  'encoding/codec_x86.c',
+  'hash/blake2b.c',
+  'hash/keccak.c',
+  'hash/ripemd160.c',
+  'hash/sha512.c',
+  'pool/pool.cpp',
+  'random/drbg.c',
+  'scrypt/crypto_scrypt.c',
+  'scrypt/sha256.c',
+  'stats/stats.cpp'
+]
@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <sys/mman.h>
+
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "arena.h"
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+/* Large blocks are aligned to this many bytes. */
+#define LARGE_ALIGN	64
+
+struct cached {
+	uint8_t * base;		/* Start of the mapping, past its guard page. */
+	size_t len;		/* Usable length of the mapping. */
+};
+
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t once = PTHREAD_ONCE_INIT;
+static size_t pagesize;
+
+/* Free blocks of each class, linked through their first word. */
+static void * freelists[ARENA_CLASSES];
+
+static struct cached cache[ARENA_CACHE_SLOTS];
+static size_t cachedbytes;
+
+static struct arena_stats stats;
+
+static void
+init(void)
+{
+	long size = sysconf(_SC_PAGESIZE);
+
+	pagesize = (size > 0) ? (size_t)size : 4096;
+}
+
+/**
+ * roundup(len, to):
+ * Round len up to a multiple of the power of two to, or return 0 if
+ * the result would overflow.
+ */
+static size_t
+roundup(size_t len, size_t to)
+{
+
+	if (len > SIZE_MAX - (to - 1))
+		return (0);
+	return ((len + to - 1) & ~(to - 1));
+}
+
+/**
+ * classof(size):
+ * Return the smallest size class that holds size bytes.
+ */
+static unsigned
+classof(size_t size)
+{
+	unsigned c = 0;
+
+	while (((size_t)ARENA_MIN_CLASS << c) < size)
+		c++;
+	return (c);
+}
+
+/**
+ * mapguarded(len, locked):
+ * Map len bytes, a multiple of the page size, between two guard pages,
+ * and try to lock them into RAM. Return the usable start of the
+ * mapping, or NULL. Must be called without the mutex held, since
+ * locking faults in every page; *locked says whether that worked.
+ */
+static uint8_t *
+mapguarded(size_t len, int * locked)
+{
+	uint8_t * base;
+
+	if (len > SIZE_MAX - 2 * pagesize)
+		return (NULL);
+	base = mmap(NULL, len + 2 * pagesize, PROT_NONE,
+	    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (base == MAP_FAILED)
+		return (NULL);
+	if (mprotect(base + pagesize, len, PROT_READ | PROT_WRITE)) {
+		munmap(base, len + 2 * pagesize);
+		return (NULL);
+	}
+#ifdef MADV_DONTDUMP
+	/* Keep secrets out of core dumps, too. */
+	madvise(base + pagesize, len, MADV_DONTDUMP);
+#endif
+	*locked = (mlock(base + pagesize, len) == 0);
+	return (base + pagesize);
+}
+
+/**
+ * unmapguarded(base, len):
+ * Unmap a mapping from mapguarded, guard pages and all.
+ */
+static void
+unmapguarded(uint8_t * base, size_t len)
+{
+
+	munmap(base - pagesize, len + 2 * pagesize);
+}
+
+/**
+ * release(base, len):
+ * Unlock a mapping from mapguarded and give its pages back to the
+ * system, keeping only the address range and guard pages. The pages
+ * read as zero when next touched.
+ */
+static void
+release(uint8_t * base, size_t len)
+{
+
+	munlock(base, len);
+	madvise(base, len, MADV_DONTNEED);
+}
+
+/**
+ * counted(len, locked):
+ * Record a new mapping of len usable bytes. Must be called with the
+ * mutex held.
+ */
+static void
+counted(size_t len, int locked)
+{
+
+	stats.maps++;
+	stats.mapped += len + 2 * pagesize;
+	if (!locked)
+		stats.unlocked++;
+}
+
+static void *
+allocsmall(size_t size)
+{
+	unsigned c = classof(size);
+	size_t blocksize = (size_t)ARENA_MIN_CLASS << c;
+	uint8_t * slab;
+	void * block;
+	size_t i;
+	int locked;
+
+	pthread_mutex_lock(&mutex);
+	if (freelists[c] == NULL) {
+		pthread_mutex_unlock(&mutex);
+		if ((slab = mapguarded(ARENA_SLAB_SIZE, &locked)) == NULL)
+			return (NULL);
+		pthread_mutex_lock(&mutex);
+		counted(ARENA_SLAB_SIZE, locked);
+
+		/* Push rather than replace, since another thread may have
+		 * refilled the list meanwhile. */
+		for (i = ARENA_SLAB_SIZE; i > 0; i -= blocksize) {
+			memcpy(slab + i - blocksize, &freelists[c],
+			    sizeof(void *));
+			freelists[c] = slab + i - blocksize;
+		}
+	}
+	block = freelists[c];
+	memcpy(&freelists[c], block, sizeof(void *));
+	memset(block, 0, sizeof(void *));
+	stats.allocs++;
+	stats.inuse += blocksize;
+	if (stats.peak < stats.inuse)
+		stats.peak = stats.inuse;
+	pthread_mutex_unlock(&mutex);
+
+	return (block);
+}
+
+static void *
+alloclarge(size_t size)
+{
+	size_t len, used;
+	uint8_t * base = NULL;
+	unsigned i;
+	int locked, fresh = 0;
+
+	if (((len = roundup(size, pagesize)) == 0) ||
+	    ((used = roundup(size, LARGE_ALIGN)) == 0))
+		return (NULL);
+
+	pthread_mutex_lock(&mutex);
+	for (i = 0; i < ARENA_CACHE_SLOTS; i++) {
+		if ((cache[i].base != NULL) && (cache[i].len == len)) {
+			base = cache[i].base;
+			cache[i].base = NULL;
+			cachedbytes -= len;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&mutex);
+
+	if (base == NULL) {
+		if ((base = mapguarded(len, &locked)) == NULL)
+			return (NULL);
+		fresh = 1;
+	} else {
+		/* Cached mappings were released, so fault them back in. */
+		locked = (mlock(base, len) == 0);
+	}
+
+	pthread_mutex_lock(&mutex);
+	if (fresh)
+		counted(len, locked);
+	else if (!locked)
+		stats.unlocked++;
+	stats.allocs++;
+	stats.inuse += len;
+	if (stats.peak < stats.inuse)
+		stats.peak = stats.inuse;
+	pthread_mutex_unlock(&mutex);
+
+	/* End the block as close to the guard page as alignment allows. */
+	return (base + len - used);
+}
+
+void *
+Arena_Alloc(size_t size)
+{
+
+	pthread_once(&once, init);
+	if (size == 0)
+		size = 1;
+	if (size <= ARENA_MAX_CLASS)
+		return (allocsmall(size));
+	return (alloclarge(size));
+}
+
+void
+Arena_Free(void * ptr, size_t size)
+{
+	uint8_t * base;
+	size_t len, blocksize;
+	unsigned i;
+
+	if (ptr == NULL)
+		return;
+	if (size == 0)
+		size = 1;
+
+	if (size <= ARENA_MAX_CLASS) {
+		/* Wipe the whole block, so it comes back zeroed. */
+		blocksize = (size_t)ARENA_MIN_CLASS << classof(size);
+		memset(ptr, 0, blocksize);
+
+		pthread_mutex_lock(&mutex);
+		memcpy(ptr, &freelists[classof(size)], sizeof(void *));
+		freelists[classof(size)] = ptr;
+		stats.frees++;
+		stats.inuse -= blocksize;
+		pthread_mutex_unlock(&mutex);
+		return;
+	}
+
+	/* The rest of the mapping was never handed out, so is still zero. */
+	memset(ptr, 0, size);
+	len = roundup(size, pagesize);
+	base = (uint8_t *)ptr + roundup(size, LARGE_ALIGN) - len;
+
+	/*
+	 * Release the pages before the mapping can reach the cache, since
+	 * another thread may take it from there as soon as it lands.
+	 */
+	if (len <= ARENA_CACHE_LIMIT)
+		release(base, len);
+
+	pthread_mutex_lock(&mutex);
+	stats.frees++;
+	stats.inuse -= len;
+	if (len <= ARENA_CACHE_LIMIT - cachedbytes) {
+		for (i = 0; i < ARENA_CACHE_SLOTS; i++) {
+			if (cache[i].base == NULL) {
+				cache[i].base = base;
+				cache[i].len = len;
+				cachedbytes += len;
+				base = NULL;
+				break;
+			}
+		}
+	}
+	if (base != NULL) {
+		stats.unmaps++;
+		stats.mapped -= len + 2 * pagesize;
+	}
+	pthread_mutex_unlock(&mutex);
+
+	if (base != NULL)
+		unmapguarded(base, len);
+}
+
+void
+Arena_GetStats(struct arena_stats * out)
+{
+
+	pthread_mutex_lock(&mutex);
+	*out = stats;
+	pthread_mutex_unlock(&mutex);
+}
+
+void
+Arena_ResetPeak(void)
+{
+
+	pthread_mutex_lock(&mutex);
+	stats.peak = stats.inuse;
+	pthread_mutex_unlock(&mutex);
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _ARENA_H_
+#define _ARENA_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/*
+ * Blocks come in power-of-two size classes from ARENA_MIN_CLASS to
+ * ARENA_MAX_CLASS bytes, carved out of ARENA_SLAB_SIZE-byte slabs.
+ * Bigger requests get a mapping of their own. Every slab and mapping
+ * sits between two inaccessible guard pages, and is locked into RAM
+ * where the system allows it.
+ */
+#define ARENA_MIN_CLASS		32
+#define ARENA_MAX_CLASS		16384
+#define ARENA_CLASSES		10
+#define ARENA_SLAB_SIZE		65536
+
+/*
+ * Released mappings stay around for requests of the same size, up to
+ * this many of them and this many bytes in total, so repeated key
+ * stretching skips the mmap and guard page setup. Cached mappings are
+ * unlocked and their pages given back, so they hold only address space.
+ */
+#define ARENA_CACHE_SLOTS	8
+#define ARENA_CACHE_LIMIT	(64 * 1024 * 1024)
+
+struct arena_stats {
+	uint64_t allocs;	/* Successful Arena_Alloc calls. */
+	uint64_t frees;		/* Arena_Free calls. */
+	uint64_t maps;		/* Slabs and mappings taken from the system. */
+	uint64_t unmaps;	/* Mappings given back to the system. */
+	uint64_t unlocked;	/* Mappings the system would not lock. */
+	size_t inuse;		/* Bytes allocated and not yet freed. */
+	size_t peak;		/* Most bytes in use since Arena_ResetPeak. */
+	size_t mapped;		/* Bytes mapped, including guard pages. */
+};
+
+/**
+ * Arena_Alloc(size):
+ * Return size bytes of zeroed memory, or NULL if the system is out of
+ * memory. Small blocks are aligned to their size class, and large ones
+ * to 64 bytes. Large blocks end within 64 bytes of their trailing guard
+ * page, so overruns fault instead of corrupting a neighbour.
+ */
+void *	Arena_Alloc(size_t);
+
+/**
+ * Arena_Free(ptr, size):
+ * Wipe and release memory from Arena_Alloc, where size is the size it
+ * was allocated with. Does nothing if ptr is NULL.
+ */
+void	Arena_Free(void *, size_t);
+
+/**
+ * Arena_GetStats(stats):
+ * Store the arena's counters in stats.
+ */
+void	Arena_GetStats(struct arena_stats *);
+
+/**
+ * Arena_ResetPeak():
+ * Start tracking the peak from the bytes in use right now.
+ */
+void	Arena_ResetPeak(void);
+
+#endif /* !_ARENA_H_ */
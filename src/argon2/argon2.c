@@ -0,0 +1,416 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../hash/blake2b.h"
+#include "../scrypt/sysendian.h"
+
+#include "argon2.h"
+#include "argon2_impl.h"
+
+#define ARGON2_VERSION	0x13
+#define ARGON2_TYPE_ID	2
+#define ARGON2_QWORDS	128
+
+typedef void (*argon2_fill_fn)(const uint64_t *, const uint64_t *,
+    uint64_t *, int);
+
+#define ROTR64(x, n) (((x) >> (n)) | ((x) << (64 - (n))))
+
+/* The BLAKE2b addition, with an extra product of the low halves. */
+#define BLAMKA(x, y)							\
+	((x) + (y) + 2 * (uint64_t)(uint32_t)(x) * (uint32_t)(y))
+
+#define GB(a, b, c, d) do {						\
+	a = BLAMKA(a, b); d = ROTR64(d ^ a, 32);			\
+	c = BLAMKA(c, d); b = ROTR64(b ^ c, 24);			\
+	a = BLAMKA(a, b); d = ROTR64(d ^ a, 16);			\
+	c = BLAMKA(c, d); b = ROTR64(b ^ c, 63);			\
+} while (0)
+
+#define ROUND(v0, v1, v2, v3, v4, v5, v6, v7,				\
+    v8, v9, v10, v11, v12, v13, v14, v15) do {				\
+	GB(v0, v4, v8, v12); GB(v1, v5, v9, v13);			\
+	GB(v2, v6, v10, v14); GB(v3, v7, v11, v15);			\
+	GB(v0, v5, v10, v15); GB(v1, v6, v11, v12);			\
+	GB(v2, v7, v8, v13); GB(v3, v4, v9, v14);			\
+} while (0)
+
+/**
+ * argon2_portable_fill(prev, ref, next, with_xor):
+ * The portable block compression, with the same contract as the
+ * kernels in argon2_impl.h.
+ */
+static void
+argon2_portable_fill(const uint64_t prev[128], const uint64_t ref[128],
+    uint64_t next[128], int with_xor)
+{
+	uint64_t r[ARGON2_QWORDS];
+	uint64_t z[ARGON2_QWORDS];
+	uint64_t * v;
+	int i;
+
+	for (i = 0; i < ARGON2_QWORDS; i++)
+		r[i] = prev[i] ^ ref[i];
+	memcpy(z, r, sizeof(z));
+
+	/* Rows of 16 words, then columns of 2-word pairs. */
+	for (i = 0; i < 8; i++) {
+		v = &z[16 * i];
+		ROUND(v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7],
+		    v[8], v[9], v[10], v[11], v[12], v[13], v[14], v[15]);
+	}
+	for (i = 0; i < 8; i++) {
+		v = &z[2 * i];
+		ROUND(v[0], v[1], v[16], v[17], v[32], v[33], v[48], v[49],
+		    v[64], v[65], v[80], v[81], v[96], v[97], v[112], v[113]);
+	}
+
+	if (with_xor) {
+		for (i = 0; i < ARGON2_QWORDS; i++)
+			next[i] ^= z[i] ^ r[i];
+	} else {
+		for (i = 0; i < ARGON2_QWORDS; i++)
+			next[i] = z[i] ^ r[i];
+	}
+
+	/* Clean the stack. */
+	memset(r, 0, sizeof(r));
+	memset(z, 0, sizeof(z));
+}
+
+/* Implementation selection. */
+static int argon2_forced = ARGON2_IMPL_AUTO;
+
+static int
+argon2_available(int impl)
+{
+
+	switch (impl) {
+	case ARGON2_IMPL_PORTABLE:
+		return (1);
+	case ARGON2_IMPL_SSSE3:
+		return (argon2_ssse3_available());
+	case ARGON2_IMPL_AVX2:
+		return (argon2_avx2_available());
+	case ARGON2_IMPL_NEON:
+		return (argon2_neon_available());
+	default:
+		return (0);
+	}
+}
+
+int
+Argon2_SetImplementation(int impl)
+{
+
+	if (impl != ARGON2_IMPL_AUTO && !argon2_available(impl))
+		return (-1);
+	__atomic_store_n(&argon2_forced, impl, __ATOMIC_RELAXED);
+	return (0);
+}
+
+int
+Argon2_GetImplementation(void)
+{
+	int impl = __atomic_load_n(&argon2_forced, __ATOMIC_RELAXED);
+
+	if (impl != ARGON2_IMPL_AUTO)
+		return (impl);
+	if (argon2_avx2_available())
+		return (ARGON2_IMPL_AVX2);
+	if (argon2_ssse3_available())
+		return (ARGON2_IMPL_SSSE3);
+	if (argon2_neon_available())
+		return (ARGON2_IMPL_NEON);
+	return (ARGON2_IMPL_PORTABLE);
+}
+
+static argon2_fill_fn
+argon2_fill_for(int impl)
+{
+
+	switch (impl) {
+	case ARGON2_IMPL_SSSE3:
+		return (argon2_ssse3_fill);
+	case ARGON2_IMPL_AVX2:
+		return (argon2_avx2_fill);
+	case ARGON2_IMPL_NEON:
+		return (argon2_neon_fill);
+	default:
+		return (argon2_portable_fill);
+	}
+}
+
+/**
+ * argon2_hprime(out, outlen, in, inlen):
+ * The variable-length hash H' from RFC 9106, section 3.3.
+ */
+static void
+argon2_hprime(uint8_t * out, size_t outlen, const uint8_t * in, size_t inlen)
+{
+	BLAKE2B_CTX ctx;
+	uint8_t lenbuf[4];
+	uint8_t v[64];
+
+	le32enc(lenbuf, (uint32_t)outlen);
+	if (outlen <= 64) {
+		BLAKE2b_Init(&ctx, outlen);
+		BLAKE2b_Update(&ctx, lenbuf, sizeof(lenbuf));
+		BLAKE2b_Update(&ctx, in, inlen);
+		BLAKE2b_Final(out, &ctx);
+		return;
+	}
+
+	/* Chain 64-byte hashes, keeping the first half of each. */
+	BLAKE2b_Init(&ctx, 64);
+	BLAKE2b_Update(&ctx, lenbuf, sizeof(lenbuf));
+	BLAKE2b_Update(&ctx, in, inlen);
+	BLAKE2b_Final(v, &ctx);
+	for (; outlen > 64; out += 32, outlen -= 32) {
+		memcpy(out, v, 32);
+		BLAKE2b(v, 64, v, 64);
+	}
+	memcpy(out, v, outlen);
+
+	/* Clean the stack. */
+	memset(v, 0, sizeof(v));
+}
+
+size_t
+Argon2id_Blocks(uint32_t m, uint32_t p)
+{
+
+	if (p < 1 || p > 0xffffff || m < 8 * p)
+		return (0);
+
+	/* Round down to a whole number of segments per lane. */
+	return ((size_t)(m / (ARGON2_SYNC_POINTS * p)) *
+	    ARGON2_SYNC_POINTS * p);
+}
+
+/**
+ * argon2_update32(ctx, in, len):
+ * Hash a 32-bit length, followed by the input it describes.
+ */
+static void
+argon2_update32(BLAKE2B_CTX * ctx, const uint8_t * in, size_t len)
+{
+	uint8_t lenbuf[4];
+
+	le32enc(lenbuf, (uint32_t)len);
+	BLAKE2b_Update(ctx, lenbuf, sizeof(lenbuf));
+	if (len > 0)
+		BLAKE2b_Update(ctx, in, len);
+}
+
+int
+Argon2id_Init(ARGON2_CTX * ctx, const uint8_t * passwd, size_t passwdlen,
+    const uint8_t * salt, size_t saltlen, const uint8_t * secret,
+    size_t secretlen, const uint8_t * ad, size_t adlen, uint32_t t,
+    uint32_t m, uint32_t p, size_t taglen, uint64_t * memory)
+{
+	BLAKE2B_CTX hctx;
+	uint8_t params[24];
+	uint8_t seed[72];
+	uint8_t block[ARGON2_BLOCK_SIZE];
+	size_t nblocks = Argon2id_Blocks(m, p);
+	uint64_t * b;
+	uint32_t lane;
+	int i, j;
+
+	/* Check the parameters, as RFC 9106 section 3.1 limits them. */
+	if (nblocks == 0 || t < 1 || taglen < 4 || taglen > 0xffffffff ||
+	    saltlen < 8 || saltlen > 0xffffffff ||
+	    passwdlen > 0xffffffff || secretlen > 0xffffffff ||
+	    adlen > 0xffffffff)
+		return (-1);
+
+	ctx->memory = memory;
+	ctx->passes = t;
+	ctx->lanes = p;
+	ctx->lanelen = (uint32_t)(nblocks / p);
+	ctx->seglen = ctx->lanelen / ARGON2_SYNC_POINTS;
+	ctx->taglen = taglen;
+	ctx->impl = Argon2_GetImplementation();
+
+	/* H0 covers every parameter and input. */
+	le32enc(&params[0], p);
+	le32enc(&params[4], (uint32_t)taglen);
+	le32enc(&params[8], m);
+	le32enc(&params[12], t);
+	le32enc(&params[16], ARGON2_VERSION);
+	le32enc(&params[20], ARGON2_TYPE_ID);
+	BLAKE2b_Init(&hctx, 64);
+	BLAKE2b_Update(&hctx, params, sizeof(params));
+	argon2_update32(&hctx, passwd, passwdlen);
+	argon2_update32(&hctx, salt, saltlen);
+	argon2_update32(&hctx, secret, secretlen);
+	argon2_update32(&hctx, ad, adlen);
+	BLAKE2b_Final(seed, &hctx);
+
+	/* The first two blocks of each lane come straight from H0. */
+	for (lane = 0; lane < p; lane++) {
+		for (i = 0; i < 2; i++) {
+			le32enc(&seed[64], (uint32_t)i);
+			le32enc(&seed[68], lane);
+			argon2_hprime(block, sizeof(block), seed, sizeof(seed));
+			b = &memory[((size_t)lane * ctx->lanelen + i) *
+			    ARGON2_QWORDS];
+			for (j = 0; j < ARGON2_QWORDS; j++)
+				b[j] = le64dec(&block[8 * j]);
+		}
+	}
+
+	/* Clean the stack. */
+	memset(seed, 0, sizeof(seed));
+	memset(block, 0, sizeof(block));
+	return (0);
+}
+
+/**
+ * argon2_next_addresses(fill, input, addresses):
+ * Bump the counter in the input block and compute the next 128
+ * data-independent reference addresses from it.
+ */
+static void
+argon2_next_addresses(argon2_fill_fn fill, uint64_t input[128],
+    uint64_t addresses[128])
+{
+	static const uint64_t zero[ARGON2_QWORDS];
+
+	input[6]++;
+	fill(zero, input, addresses, 0);
+	fill(zero, addresses, addresses, 0);
+}
+
+/**
+ * argon2_ref_index(ctx, pass, slice, index, rand, samelane):
+ * Map the low 32 bits of a pseudo-random word onto a block in the
+ * reference lane that is already filled, as RFC 9106 section 3.4.2
+ * describes.
+ */
+static uint32_t
+argon2_ref_index(const ARGON2_CTX * ctx, uint32_t pass, uint32_t slice,
+    uint32_t index, uint32_t rand, int samelane)
+{
+	uint64_t size, x, y;
+	uint32_t start;
+
+	/*
+	 * The reference area is everything filled so far, less the last
+	 * segment of the current pass. The current lane also includes its
+	 * own blocks from this segment, except the one just before.
+	 */
+	if (pass == 0)
+		size = (uint64_t)slice * ctx->seglen;
+	else
+		size = ctx->lanelen - ctx->seglen;
+	if (samelane)
+		size = size + index - 1;
+	else if (index == 0)
+		size -= 1;
+
+	/* Bias the choice toward recent blocks. */
+	x = ((uint64_t)rand * rand) >> 32;
+	y = (size * x) >> 32;
+	start = 0;
+	if (pass != 0 && slice != ARGON2_SYNC_POINTS - 1)
+		start = (slice + 1) * ctx->seglen;
+	return ((uint32_t)((start + size - 1 - y) % ctx->lanelen));
+}
+
+void
+Argon2id_FillSegment(const ARGON2_CTX * ctx, uint32_t pass, uint32_t slice,
+    uint32_t lane)
+{
+	uint64_t input[ARGON2_QWORDS];
+	uint64_t addresses[ARGON2_QWORDS];
+	argon2_fill_fn fill = argon2_fill_for(ctx->impl);
+	uint64_t * lanemem = &ctx->memory[(size_t)lane * ctx->lanelen *
+	    ARGON2_QWORDS];
+	const uint64_t * ref;
+	uint64_t rand;
+	uint32_t index, curr, prev, reflane;
+	int independent = (pass == 0 && slice < ARGON2_SYNC_POINTS / 2);
+
+	/* Argon2id picks references like Argon2i for the first half pass. */
+	if (independent) {
+		memset(input, 0, sizeof(input));
+		input[0] = pass;
+		input[1] = lane;
+		input[2] = slice;
+		input[3] = (uint64_t)ctx->lanelen * ctx->lanes;
+		input[4] = ctx->passes;
+		input[5] = ARGON2_TYPE_ID;
+	}
+
+	/* The first two blocks of each lane are already done. */
+	index = (pass == 0 && slice == 0) ? 2 : 0;
+	if (independent && index != 0)
+		argon2_next_addresses(fill, input, addresses);
+
+	curr = slice * ctx->seglen + index;
+	prev = (curr == 0) ? ctx->lanelen - 1 : curr - 1;
+	for (; index < ctx->seglen; index++, prev = curr++) {
+		if (independent) {
+			if (index % ARGON2_QWORDS == 0)
+				argon2_next_addresses(fill, input, addresses);
+			rand = addresses[index % ARGON2_QWORDS];
+		} else {
+			rand = lanemem[(size_t)prev * ARGON2_QWORDS];
+		}
+
+		/* The first slice of the first pass stays in its own lane. */
+		reflane = (uint32_t)((rand >> 32) % ctx->lanes);
+		if (pass == 0 && slice == 0)
+			reflane = lane;
+		ref = &ctx->memory[((size_t)reflane * ctx->lanelen +
+		    argon2_ref_index(ctx, pass, slice, index, (uint32_t)rand,
+		    reflane == lane)) * ARGON2_QWORDS];
+
+		fill(&lanemem[(size_t)prev * ARGON2_QWORDS], ref,
+		    &lanemem[(size_t)curr * ARGON2_QWORDS], pass != 0);
+	}
+
+	/* Clean the stack. */
+	if (independent) {
+		memset(input, 0, sizeof(input));
+		memset(addresses, 0, sizeof(addresses));
+	}
+}
+
+void
+Argon2id_Final(ARGON2_CTX * ctx, uint8_t * tag)
+{
+	uint64_t acc[ARGON2_QWORDS];
+	uint8_t block[ARGON2_BLOCK_SIZE];
+	const uint64_t * last;
+	uint32_t lane;
+	int i;
+
+	/* XOR together the last block of every lane. */
+	memset(acc, 0, sizeof(acc));
+	for (lane = 0; lane < ctx->lanes; lane++) {
+		last = &ctx->memory[((size_t)lane * ctx->lanelen +
+		    ctx->lanelen - 1) * ARGON2_QWORDS];
+		for (i = 0; i < ARGON2_QWORDS; i++)
+			acc[i] ^= last[i];
+	}
+	for (i = 0; i < ARGON2_QWORDS; i++)
+		le64enc(&block[8 * i], acc[i]);
+	argon2_hprime(tag, ctx->taglen, block, sizeof(block));
+
+	/* Clean the memory, stack, and context. */
+	memset(ctx->memory, 0, (size_t)ctx->lanes * ctx->lanelen *
+	    ARGON2_BLOCK_SIZE);
+	memset(acc, 0, sizeof(acc));
+	memset(block, 0, sizeof(block));
+	memset(ctx, 0, sizeof(*ctx));
+}
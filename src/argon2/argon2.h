@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _ARGON2_H_
+#define _ARGON2_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/* Block compression implementations, for Argon2_SetImplementation. */
+#define ARGON2_IMPL_AUTO	0
+#define ARGON2_IMPL_PORTABLE	1
+#define ARGON2_IMPL_SSSE3	2
+#define ARGON2_IMPL_AVX2	3
+#define ARGON2_IMPL_NEON	4
+
+/* Memory is counted in 1 KiB blocks of 128 64-bit words. */
+#define ARGON2_BLOCK_SIZE	1024
+#define ARGON2_SYNC_POINTS	4
+
+/*
+ * Argon2id, as specified in RFC 9106 (version 0x13). The caller owns
+ * the memory and drives the passes, so it can spread lanes across
+ * threads: within each pass, every slice of every lane has to finish
+ * before any lane starts the next slice.
+ */
+typedef struct Argon2Context {
+	uint64_t * memory;
+	uint32_t passes;
+	uint32_t lanes;
+	uint32_t lanelen;
+	uint32_t seglen;
+	size_t taglen;
+	int impl;
+} ARGON2_CTX;
+
+/**
+ * Argon2_SetImplementation(impl):
+ * Force a particular implementation for contexts created after this
+ * call, or go back to picking the fastest with ARGON2_IMPL_AUTO.
+ * Return 0 on success, or -1 if this CPU lacks the implementation.
+ */
+int	Argon2_SetImplementation(int);
+
+/**
+ * Argon2_GetImplementation():
+ * Return the implementation new contexts will use.
+ */
+int	Argon2_GetImplementation(void);
+
+/**
+ * Argon2id_Blocks(m, p):
+ * Return the number of blocks Argon2id uses for m KiB of memory
+ * across p lanes, or 0 if the parameters are invalid. The memory
+ * handed to Argon2id_Init must hold this many blocks.
+ */
+size_t	Argon2id_Blocks(uint32_t, uint32_t);
+
+/**
+ * Argon2id_Init(ctx, passwd, passwdlen, salt, saltlen, secret, secretlen,
+ *     ad, adlen, t, m, p, taglen, memory):
+ * Hash the inputs and fill the first two blocks of each lane, for t
+ * passes over m KiB across p lanes and a taglen-byte tag. The secret
+ * and associated data may be empty. The memory works at any 8-byte
+ * alignment, but is fastest on a 64-byte boundary.
+ * Return 0 on success, or -1 if the parameters are invalid.
+ */
+int	Argon2id_Init(ARGON2_CTX *, const uint8_t *, size_t, const uint8_t *,
+    size_t, const uint8_t *, size_t, const uint8_t *, size_t, uint32_t,
+    uint32_t, uint32_t, size_t, uint64_t *);
+
+/**
+ * Argon2id_FillSegment(ctx, pass, slice, lane):
+ * Fill one slice of one lane. Different lanes of the same slice may
+ * run at the same time.
+ */
+void	Argon2id_FillSegment(const ARGON2_CTX *, uint32_t, uint32_t,
+    uint32_t);
+
+/**
+ * Argon2id_Final(ctx, tag):
+ * Output the tag once every pass is done, then wipe the memory and
+ * clear the context.
+ */
+void	Argon2id_Final(ARGON2_CTX *, uint8_t *);
+
+#endif /* !_ARGON2_H_ */
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "argon2_impl.h"
+
+#if defined(__ARM_NEON)
+
+#include <arm_neon.h>
+
+/*
+ * NEON is part of the baseline on arm64, and every Android armv7 ABI
+ * we build for, so this needs no runtime check. Like the SSSE3
+ * kernel, this holds a 16-word row in 8 registers of 2 words.
+ */
+
+/* x + y + 2 * lo32(x) * lo32(y), in each 64-bit lane. */
+#define BLAMKA(x, y)							\
+	vaddq_u64(vaddq_u64(x, y),					\
+	    vshlq_n_u64(vmull_u32(vmovn_u64(x), vmovn_u64(y)), 1))
+#define ROTR(x, n) vsriq_n_u64(vshlq_n_u64(x, 64 - (n)), x, n)
+#define ROTR32(x) vreinterpretq_u64_u32(vrev64q_u32(vreinterpretq_u32_u64(x)))
+
+#define GB(a, b, c, d) do {						\
+	a = BLAMKA(a, b); d = veorq_u64(d, a); d = ROTR32(d);		\
+	c = BLAMKA(c, d); b = veorq_u64(b, c); b = ROTR(b, 24);		\
+	a = BLAMKA(a, b); d = veorq_u64(d, a); d = ROTR(d, 16);		\
+	c = BLAMKA(c, d); b = veorq_u64(b, c); b = ROTR(b, 63);		\
+} while (0)
+
+/* Words (a1, b0) of the pair (a0, a1), (b0, b1). */
+#define SHIFT(a, b) vextq_u64(a, b, 1)
+
+#define ROUND(v0, v1, v2, v3, v4, v5, v6, v7) do {			\
+	uint64x2_t t0, t1;						\
+	GB(v0, v2, v4, v6);						\
+	GB(v1, v3, v5, v7);						\
+	t0 = SHIFT(v2, v3); t1 = SHIFT(v3, v2);				\
+	v2 = t0; v3 = t1;						\
+	t0 = v4; v4 = v5; v5 = t0;					\
+	t0 = SHIFT(v7, v6); t1 = SHIFT(v6, v7);				\
+	v6 = t0; v7 = t1;						\
+	GB(v0, v2, v4, v6);						\
+	GB(v1, v3, v5, v7);						\
+	t0 = SHIFT(v3, v2); t1 = SHIFT(v2, v3);				\
+	v2 = t0; v3 = t1;						\
+	t0 = v4; v4 = v5; v5 = t0;					\
+	t0 = SHIFT(v6, v7); t1 = SHIFT(v7, v6);				\
+	v6 = t0; v7 = t1;						\
+} while (0)
+
+int
+argon2_neon_available(void)
+{
+
+	return (1);
+}
+
+void
+argon2_neon_fill(const uint64_t prev[128], const uint64_t ref[128],
+    uint64_t next[128], int with_xor)
+{
+	uint64x2_t r[64], z[64];
+	int i;
+
+	for (i = 0; i < 64; i++) {
+		r[i] = veorq_u64(vld1q_u64(&prev[2 * i]),
+		    vld1q_u64(&ref[2 * i]));
+		z[i] = r[i];
+	}
+
+	/* Rows are 8 neighbouring registers, columns every 8th one. */
+	for (i = 0; i < 8; i++)
+		ROUND(z[8 * i], z[8 * i + 1], z[8 * i + 2], z[8 * i + 3],
+		    z[8 * i + 4], z[8 * i + 5], z[8 * i + 6], z[8 * i + 7]);
+	for (i = 0; i < 8; i++)
+		ROUND(z[i], z[i + 8], z[i + 16], z[i + 24],
+		    z[i + 32], z[i + 40], z[i + 48], z[i + 56]);
+
+	/* Read all of next before writing, in case it is also ref. */
+	for (i = 0; i < 64; i++) {
+		z[i] = veorq_u64(z[i], r[i]);
+		if (with_xor)
+			z[i] = veorq_u64(z[i], vld1q_u64(&next[2 * i]));
+	}
+	for (i = 0; i < 64; i++)
+		vst1q_u64(&next[2 * i], z[i]);
+
+	/* Clean the stack. */
+	memset(r, 0, sizeof(r));
+	memset(z, 0, sizeof(z));
+}
+
+#else
+
+int
+argon2_neon_available(void)
+{
+
+	return (0);
+}
+
+void
+argon2_neon_fill(const uint64_t prev[128], const uint64_t ref[128],
+    uint64_t next[128], int with_xor)
+{
+
+	(void)prev;
+	(void)ref;
+	(void)next;
+	(void)with_xor;
+}
+
+#endif
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _ARGON2_IMPL_H_
+#define _ARGON2_IMPL_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/*
+ * Block compression kernels. Each computes G(prev, ref) into next, or
+ * XORs it into next when with_xor is set, as passes after the first do.
+ * The ref and next blocks may be the same. The *_available functions
+ * report whether this CPU can run the kernel; kernels for other
+ * architectures are stubs.
+ */
+
+int	argon2_ssse3_available(void);
+int	argon2_avx2_available(void);
+int	argon2_neon_available(void);
+
+void	argon2_ssse3_fill(const uint64_t [128], const uint64_t [128],
+    uint64_t [128], int);
+void	argon2_avx2_fill(const uint64_t [128], const uint64_t [128],
+    uint64_t [128], int);
+void	argon2_neon_fill(const uint64_t [128], const uint64_t [128],
+    uint64_t [128], int);
+
+#endif /* !_ARGON2_IMPL_H_ */
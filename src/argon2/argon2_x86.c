@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "argon2_impl.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+/* Only these functions use the extensions, so the rest of the library
+ * still runs on older CPUs. */
+#define ARGON2_SSSE3_TARGET __attribute__((target("ssse3")))
+#define ARGON2_AVX2_TARGET __attribute__((target("avx2")))
+
+int
+argon2_ssse3_available(void)
+{
+	static int available = -1;
+	unsigned int a, b, c, d;
+	int result = __atomic_load_n(&available, __ATOMIC_RELAXED);
+
+	if (result < 0) {
+		result = __get_cpuid(1, &a, &b, &c, &d) && (c & bit_SSSE3);
+		__atomic_store_n(&available, result, __ATOMIC_RELAXED);
+	}
+	return (result);
+}
+
+int
+argon2_avx2_available(void)
+{
+	static int available = -1;
+	unsigned int a, b, c, d, xcr0, xcr0_hi;
+	int result = __atomic_load_n(&available, __ATOMIC_RELAXED);
+
+	if (result < 0) {
+		result = 0;
+
+		/* The OS has to save the YMM registers, as well. */
+		if (__get_cpuid(1, &a, &b, &c, &d) && (c & bit_OSXSAVE) &&
+		    (c & bit_AVX) && __get_cpuid_max(0, NULL) >= 7) {
+			__asm__ ("xgetbv" : "=a" (xcr0), "=d" (xcr0_hi) : "c" (0));
+			__cpuid_count(7, 0, a, b, c, d);
+			result = ((xcr0 & 6) == 6) && (b & bit_AVX2);
+		}
+		__atomic_store_n(&available, result, __ATOMIC_RELAXED);
+	}
+	return (result);
+}
+
+/*
+ * Both kernels run the BlaMka rounds on whole vectors of words. The
+ * SSSE3 one holds a 16-word row in 8 registers of 2 words, and
+ * shifts words across register pairs for the diagonal step. The AVX2
+ * one holds a row in 4 registers of 4 words, and rotates words within
+ * each register instead.
+ */
+
+#define GB(ADD, XOR, ROTR32, ROTR24, ROTR16, ROTR63, a, b, c, d) do {	\
+	a = ADD(a, b); d = XOR(d, a); d = ROTR32(d);			\
+	c = ADD(c, d); b = XOR(b, c); b = ROTR24(b);			\
+	a = ADD(a, b); d = XOR(d, a); d = ROTR16(d);			\
+	c = ADD(c, d); b = XOR(b, c); b = ROTR63(b);			\
+} while (0)
+
+/* x + y + 2 * lo32(x) * lo32(y), in each 64-bit lane. */
+#define SSE_BLAMKA(x, y)						\
+	_mm_add_epi64(_mm_add_epi64(x, y),				\
+	    _mm_slli_epi64(_mm_mul_epu32(x, y), 1))
+#define SSE_ROTR32(x) _mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1))
+#define SSE_ROTR24(x) _mm_shuffle_epi8(x, r24)
+#define SSE_ROTR16(x) _mm_shuffle_epi8(x, r16)
+#define SSE_ROTR63(x)							\
+	_mm_xor_si128(_mm_srli_epi64(x, 63), _mm_add_epi64(x, x))
+#define SSE_GB(a, b, c, d)						\
+	GB(SSE_BLAMKA, _mm_xor_si128, SSE_ROTR32, SSE_ROTR24,		\
+	    SSE_ROTR16, SSE_ROTR63, a, b, c, d)
+
+/* Words (a1, b0) of the pair (a0, a1), (b0, b1). */
+#define SSE_SHIFT(a, b) _mm_alignr_epi8(b, a, 8)
+
+#define SSE_ROUND(v0, v1, v2, v3, v4, v5, v6, v7) do {			\
+	__m128i t0, t1;							\
+	SSE_GB(v0, v2, v4, v6);						\
+	SSE_GB(v1, v3, v5, v7);						\
+	t0 = SSE_SHIFT(v2, v3); t1 = SSE_SHIFT(v3, v2);			\
+	v2 = t0; v3 = t1;						\
+	t0 = v4; v4 = v5; v5 = t0;					\
+	t0 = SSE_SHIFT(v7, v6); t1 = SSE_SHIFT(v6, v7);			\
+	v6 = t0; v7 = t1;						\
+	SSE_GB(v0, v2, v4, v6);						\
+	SSE_GB(v1, v3, v5, v7);						\
+	t0 = SSE_SHIFT(v3, v2); t1 = SSE_SHIFT(v2, v3);			\
+	v2 = t0; v3 = t1;						\
+	t0 = v4; v4 = v5; v5 = t0;					\
+	t0 = SSE_SHIFT(v6, v7); t1 = SSE_SHIFT(v7, v6);			\
+	v6 = t0; v7 = t1;						\
+} while (0)
+
+ARGON2_SSSE3_TARGET void
+argon2_ssse3_fill(const uint64_t prev[128], const uint64_t ref[128],
+    uint64_t next[128], int with_xor)
+{
+	const __m128i r16 = _mm_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1,
+	    10, 11, 12, 13, 14, 15, 8, 9);
+	const __m128i r24 = _mm_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2,
+	    11, 12, 13, 14, 15, 8, 9, 10);
+	__m128i r[64], z[64];
+	int i;
+
+	for (i = 0; i < 64; i++) {
+		r[i] = _mm_xor_si128(
+		    _mm_loadu_si128((const __m128i *)&prev[2 * i]),
+		    _mm_loadu_si128((const __m128i *)&ref[2 * i]));
+		z[i] = r[i];
+	}
+
+	/* Rows are 8 neighbouring registers, columns every 8th one. */
+	for (i = 0; i < 8; i++)
+		SSE_ROUND(z[8 * i], z[8 * i + 1], z[8 * i + 2], z[8 * i + 3],
+		    z[8 * i + 4], z[8 * i + 5], z[8 * i + 6], z[8 * i + 7]);
+	for (i = 0; i < 8; i++)
+		SSE_ROUND(z[i], z[i + 8], z[i + 16], z[i + 24],
+		    z[i + 32], z[i + 40], z[i + 48], z[i + 56]);
+
+	/* Read all of next before writing, in case it is also ref. */
+	for (i = 0; i < 64; i++) {
+		z[i] = _mm_xor_si128(z[i], r[i]);
+		if (with_xor)
+			z[i] = _mm_xor_si128(z[i],
+			    _mm_loadu_si128((const __m128i *)&next[2 * i]));
+	}
+	for (i = 0; i < 64; i++)
+		_mm_storeu_si128((__m128i *)&next[2 * i], z[i]);
+
+	/* Clean the stack. */
+	memset(r, 0, sizeof(r));
+	memset(z, 0, sizeof(z));
+}
+
+#define AVX2_BLAMKA(x, y)						\
+	_mm256_add_epi64(_mm256_add_epi64(x, y),			\
+	    _mm256_slli_epi64(_mm256_mul_epu32(x, y), 1))
+#define AVX2_ROTR32(x) _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1))
+#define AVX2_ROTR24(x) _mm256_shuffle_epi8(x, r24)
+#define AVX2_ROTR16(x) _mm256_shuffle_epi8(x, r16)
+#define AVX2_ROTR63(x)							\
+	_mm256_xor_si256(_mm256_srli_epi64(x, 63), _mm256_add_epi64(x, x))
+#define AVX2_GB(a, b, c, d)						\
+	GB(AVX2_BLAMKA, _mm256_xor_si256, AVX2_ROTR32, AVX2_ROTR24,	\
+	    AVX2_ROTR16, AVX2_ROTR63, a, b, c, d)
+
+/* One round over a row held in a, b, c, d. */
+#define AVX2_ROUND(a, b, c, d) do {					\
+	AVX2_GB(a, b, c, d);						\
+	b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(0, 3, 2, 1));	\
+	c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));	\
+	d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(2, 1, 0, 3));	\
+	AVX2_GB(a, b, c, d);						\
+	b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(2, 1, 0, 3));	\
+	c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));	\
+	d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(0, 3, 2, 1));	\
+} while (0)
+
+ARGON2_AVX2_TARGET void
+argon2_avx2_fill(const uint64_t prev[128], const uint64_t ref[128],
+    uint64_t next[128], int with_xor)
+{
+	const __m256i r16 = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1,
+	    10, 11, 12, 13, 14, 15, 8, 9, 2, 3, 4, 5, 6, 7, 0, 1,
+	    10, 11, 12, 13, 14, 15, 8, 9);
+	const __m256i r24 = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2,
+	    11, 12, 13, 14, 15, 8, 9, 10, 3, 4, 5, 6, 7, 0, 1, 2,
+	    11, 12, 13, 14, 15, 8, 9, 10);
+	__m256i r[32], z[32], c[8], e[8];
+	int i, k;
+
+	for (i = 0; i < 32; i++) {
+		r[i] = _mm256_xor_si256(
+		    _mm256_loadu_si256((const __m256i *)&prev[4 * i]),
+		    _mm256_loadu_si256((const __m256i *)&ref[4 * i]));
+		z[i] = r[i];
+	}
+
+	for (i = 0; i < 8; i++)
+		AVX2_ROUND(z[4 * i], z[4 * i + 1], z[4 * i + 2], z[4 * i + 3]);
+
+	/*
+	 * Register 4k + j holds the word pairs of columns 2j and 2j + 1
+	 * from row k. Gather each column into row form, with the even
+	 * column in c and the odd one in e, then scatter them back.
+	 */
+	for (i = 0; i < 4; i++) {
+		for (k = 0; k < 4; k++) {
+			c[k] = _mm256_permute2x128_si256(z[8 * k + i],
+			    z[8 * k + 4 + i], 0x20);
+			e[k] = _mm256_permute2x128_si256(z[8 * k + i],
+			    z[8 * k + 4 + i], 0x31);
+		}
+		AVX2_ROUND(c[0], c[1], c[2], c[3]);
+		AVX2_ROUND(e[0], e[1], e[2], e[3]);
+		for (k = 0; k < 4; k++) {
+			z[8 * k + i] = _mm256_permute2x128_si256(c[k], e[k],
+			    0x20);
+			z[8 * k + 4 + i] = _mm256_permute2x128_si256(c[k],
+			    e[k], 0x31);
+		}
+	}
+
+	/* Read all of next before writing, in case it is also ref. */
+	for (i = 0; i < 32; i++) {
+		z[i] = _mm256_xor_si256(z[i], r[i]);
+		if (with_xor)
+			z[i] = _mm256_xor_si256(z[i],
+			    _mm256_loadu_si256((const __m256i *)&next[4 * i]));
+	}
+	for (i = 0; i < 32; i++)
+		_mm256_storeu_si256((__m256i *)&next[4 * i], z[i]);
+
+	/* Clean the stack. */
+	memset(r, 0, sizeof(r));
+	memset(z, 0, sizeof(z));
+	memset(c, 0, sizeof(c));
+	memset(e, 0, sizeof(e));
+}
+
+#else
+
+int
+argon2_ssse3_available(void)
+{
+
+	return (0);
+}
+
+int
+argon2_avx2_available(void)
+{
+
+	return (0);
+}
+
+void
+argon2_ssse3_fill(const uint64_t prev[128], const uint64_t ref[128],
+    uint64_t next[128], int with_xor)
+{
+
+	(void)prev;
+	(void)ref;
+	(void)next;
+	(void)with_xor;
+}
+
+void
+argon2_avx2_fill(const uint64_t prev[128], const uint64_t ref[128],
+    uint64_t next[128], int with_xor)
+{
+
+	(void)prev;
+	(void)ref;
+	(void)next;
+	(void)with_xor;
+}
+
+#endif
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _BIP39_H_
+#define _BIP39_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/* Every BIP39 wordlist has this many words, so each one encodes 11 bits. */
+#define BIP39_WORDLIST_LENGTH	2048
+
+/**
+ * BIP39_EnglishIndex(word, len):
+ * Return the index of word[0 .. len - 1] in the BIP39 English wordlist,
+ * or -1 if it is not there.
+ */
+int	BIP39_EnglishIndex(const uint8_t *, size_t);
+
+#endif /* !_BIP39_H_ */
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "nfkd.h"
+#include "nfkd_table.h"
+
+/* Hangul syllables decompose arithmetically, as in Unicode section 3.12. */
+#define HANGUL_S	0xac00
+#define HANGUL_L	0x1100
+#define HANGUL_V	0x1161
+#define HANGUL_T	0x11a7
+#define HANGUL_TCOUNT	28
+#define HANGUL_NCOUNT	588
+#define HANGUL_SCOUNT	11172
+
+/**
+ * utf8_decode(in, len, cp):
+ * Decode the UTF-8 sequence at the start of in[0 .. len - 1] into cp.
+ * Return its length, or 0 if it is not valid UTF-8.
+ */
+static size_t
+utf8_decode(const uint8_t * in, size_t len, uint32_t * cp)
+{
+	uint32_t c;
+	size_t n, i;
+
+	if (in[0] < 0x80) {
+		*cp = in[0];
+		return (1);
+	} else if ((in[0] & 0xe0) == 0xc0) {
+		n = 2;
+		c = in[0] & 0x1f;
+	} else if ((in[0] & 0xf0) == 0xe0) {
+		n = 3;
+		c = in[0] & 0x0f;
+	} else if ((in[0] & 0xf8) == 0xf0) {
+		n = 4;
+		c = in[0] & 0x07;
+	} else {
+		return (0);
+	}
+	if (len < n)
+		return (0);
+	for (i = 1; i < n; i++) {
+		if ((in[i] & 0xc0) != 0x80)
+			return (0);
+		c = (c << 6) | (in[i] & 0x3f);
+	}
+
+	/* Reject overlong forms, surrogates, and anything past U+10FFFF. */
+	if ((n == 2 && c < 0x80) || (n == 3 && c < 0x800) ||
+	    (n == 4 && c < 0x10000) || (c >= 0xd800 && c <= 0xdfff) ||
+	    c > 0x10ffff)
+		return (0);
+
+	*cp = c;
+	return (n);
+}
+
+/**
+ * utf8_encode(cp, out):
+ * Write cp to out as UTF-8, and return its length.
+ */
+static size_t
+utf8_encode(uint32_t cp, uint8_t * out)
+{
+
+	if (cp < 0x80) {
+		out[0] = (uint8_t)cp;
+		return (1);
+	} else if (cp < 0x800) {
+		out[0] = (uint8_t)(0xc0 | (cp >> 6));
+		out[1] = (uint8_t)(0x80 | (cp & 0x3f));
+		return (2);
+	} else if (cp < 0x10000) {
+		out[0] = (uint8_t)(0xe0 | (cp >> 12));
+		out[1] = (uint8_t)(0x80 | ((cp >> 6) & 0x3f));
+		out[2] = (uint8_t)(0x80 | (cp & 0x3f));
+		return (3);
+	}
+	out[0] = (uint8_t)(0xf0 | (cp >> 18));
+	out[1] = (uint8_t)(0x80 | ((cp >> 12) & 0x3f));
+	out[2] = (uint8_t)(0x80 | ((cp >> 6) & 0x3f));
+	out[3] = (uint8_t)(0x80 | (cp & 0x3f));
+	return (4);
+}
+
+/**
+ * nfkd_ccc_of(cp):
+ * Return the canonical combining class of cp.
+ */
+static uint8_t
+nfkd_ccc_of(uint32_t cp)
+{
+	size_t lo = 0, hi = sizeof(nfkd_ccc) / sizeof(nfkd_ccc[0]), mid;
+
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (cp < nfkd_ccc[mid].first)
+			hi = mid;
+		else if (cp > nfkd_ccc[mid].last)
+			lo = mid + 1;
+		else
+			return (nfkd_ccc[mid].ccc);
+	}
+	return (0);
+}
+
+/**
+ * nfkd_find(cp):
+ * Return the index of cp in nfkd_cps, or -1 if it has no compatibility
+ * decomposition.
+ */
+static long
+nfkd_find(uint32_t cp)
+{
+	size_t lo = 0, hi = sizeof(nfkd_cps) / sizeof(nfkd_cps[0]), mid;
+
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (cp < nfkd_cps[mid])
+			hi = mid;
+		else if (cp > nfkd_cps[mid])
+			lo = mid + 1;
+		else
+			return ((long)mid);
+	}
+	return (-1);
+}
+
+/**
+ * nfkd_decompose(cp, out):
+ * Write the full decomposition of cp to out as UTF-8, if out is not NULL.
+ * Return its length.
+ */
+static size_t
+nfkd_decompose(uint32_t cp, uint8_t * out)
+{
+	uint8_t buf[12];
+	const uint8_t * src = buf;
+	size_t len, s;
+	long i;
+
+	if (cp >= HANGUL_S && cp < HANGUL_S + HANGUL_SCOUNT) {
+		s = cp - HANGUL_S;
+		len = utf8_encode(HANGUL_L + s / HANGUL_NCOUNT, buf);
+		len += utf8_encode(HANGUL_V + (s % HANGUL_NCOUNT) /
+		    HANGUL_TCOUNT, &buf[len]);
+		if (s % HANGUL_TCOUNT != 0)
+			len += utf8_encode(HANGUL_T + s % HANGUL_TCOUNT,
+			    &buf[len]);
+	} else if (cp >= 0xa0 && (i = nfkd_find(cp)) >= 0) {
+		/* Nothing below U+00A0 decomposes. */
+		src = &nfkd_utf8[nfkd_offsets[i]];
+		len = nfkd_offsets[i + 1] - nfkd_offsets[i];
+	} else {
+		len = utf8_encode(cp, buf);
+	}
+
+	if (out != NULL)
+		memcpy(out, src, len);
+	return (len);
+}
+
+/**
+ * nfkd_reorder(buf, len):
+ * Put each run of combining marks in buf[0 .. len - 1] into canonical
+ * order, by moving every mark back past any earlier mark with a higher
+ * combining class. This is a stable insertion sort, and the runs in real
+ * text are only a few marks long.
+ */
+static void
+nfkd_reorder(uint8_t * buf, size_t len)
+{
+	uint8_t tmp[4];
+	uint32_t cp;
+	uint8_t ccc;
+	size_t pos, cur, prev, n, m;
+
+	for (pos = 0; pos < len; pos += n) {
+		n = utf8_decode(&buf[pos], len - pos, &cp);
+		if ((ccc = nfkd_ccc_of(cp)) == 0)
+			continue;
+
+		for (cur = pos; cur > 0; cur = prev) {
+			/* Find the character before this one. */
+			for (prev = cur - 1; (buf[prev] & 0xc0) == 0x80; prev--)
+				continue;
+			m = utf8_decode(&buf[prev], cur - prev, &cp);
+			if (nfkd_ccc_of(cp) <= ccc)
+				break;
+
+			/* Swap the two characters. */
+			memcpy(tmp, &buf[cur], n);
+			memmove(&buf[prev + n], &buf[prev], m);
+			memcpy(&buf[prev], tmp, n);
+		}
+	}
+}
+
+size_t
+NFKD_Length(const uint8_t * in, size_t inlen)
+{
+	uint32_t cp;
+	size_t pos, n, len = 0;
+
+	for (pos = 0; pos < inlen; pos += n) {
+		if ((n = utf8_decode(&in[pos], inlen - pos, &cp)) == 0)
+			return ((size_t)(-1));
+		len += nfkd_decompose(cp, NULL);
+	}
+	return (len);
+}
+
+void
+NFKD(const uint8_t * in, size_t inlen, uint8_t * out)
+{
+	uint32_t cp;
+	size_t pos, n, len = 0;
+
+	for (pos = 0; pos < inlen; pos += n) {
+		n = utf8_decode(&in[pos], inlen - pos, &cp);
+		len += nfkd_decompose(cp, &out[len]);
+	}
+	nfkd_reorder(out, len);
+}
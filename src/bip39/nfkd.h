@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _NFKD_H_
+#define _NFKD_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/**
+ * NFKD_Length(in, inlen):
+ * Return the length of the Unicode NFKD form of the UTF-8 text in
+ * in[0 .. inlen - 1], or (size_t)(-1) if it is not valid UTF-8.
+ */
+size_t	NFKD_Length(const uint8_t *, size_t);
+
+/**
+ * NFKD(in, inlen, out):
+ * Write the Unicode NFKD form of the valid UTF-8 text in in[0 .. inlen - 1]
+ * to out, which must hold NFKD_Length(in, inlen) bytes.
+ */
+void	NFKD(const uint8_t *, size_t, uint8_t *);
+
+#endif /* !_NFKD_H_ */
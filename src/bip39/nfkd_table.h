@@ -0,0 +1,3249 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+/*
+ * Generated from the Unicode 14.0.0 character database. Hangul syllables
+ * are left out, since nfkd.c decomposes them arithmetically.
+ */
+
+#ifndef _NFKD_TABLE_H_
+#define _NFKD_TABLE_H_
+
+#include <stdint.h>
+
+/* Code points with a compatibility decomposition, in ascending order. */
+static const uint32_t nfkd_cps[5795] = {
+	0x000a0, 0x000a8, 0x000aa, 0x000af, 0x000b2, 0x000b3, 0x000b4, 0x000b5,
+	0x000b8, 0x000b9, 0x000ba, 0x000bc, 0x000bd, 0x000be, 0x000c0, 0x000c1,
+	0x000c2, 0x000c3, 0x000c4, 0x000c5, 0x000c7, 0x000c8, 0x000c9, 0x000ca,
+	0x000cb, 0x000cc, 0x000cd, 0x000ce, 0x000cf, 0x000d1, 0x000d2, 0x000d3,
+	0x000d4, 0x000d5, 0x000d6, 0x000d9, 0x000da, 0x000db, 0x000dc, 0x000dd,
+	0x000e0, 0x000e1, 0x000e2, 0x000e3, 0x000e4, 0x000e5, 0x000e7, 0x000e8,
+	0x000e9, 0x000ea, 0x000eb, 0x000ec, 0x000ed, 0x000ee, 0x000ef, 0x000f1,
+	0x000f2, 0x000f3, 0x000f4, 0x000f5, 0x000f6, 0x000f9, 0x000fa, 0x000fb,
+	0x000fc, 0x000fd, 0x000ff, 0x00100, 0x00101, 0x00102, 0x00103, 0x00104,
+	0x00105, 0x00106, 0x00107, 0x00108, 0x00109, 0x0010a, 0x0010b, 0x0010c,
+	0x0010d, 0x0010e, 0x0010f, 0x00112, 0x00113, 0x00114, 0x00115, 0x00116,
+	0x00117, 0x00118, 0x00119, 0x0011a, 0x0011b, 0x0011c, 0x0011d, 0x0011e,
+	0x0011f, 0x00120, 0x00121, 0x00122, 0x00123, 0x00124, 0x00125, 0x00128,
+	0x00129, 0x0012a, 0x0012b, 0x0012c, 0x0012d, 0x0012e, 0x0012f, 0x00130,
+	0x00132, 0x00133, 0x00134, 0x00135, 0x00136, 0x00137, 0x00139, 0x0013a,
+	0x0013b, 0x0013c, 0x0013d, 0x0013e, 0x0013f, 0x00140, 0x00143, 0x00144,
+	0x00145, 0x00146, 0x00147, 0x00148, 0x00149, 0x0014c, 0x0014d, 0x0014e,
+	0x0014f, 0x00150, 0x00151, 0x00154, 0x00155, 0x00156, 0x00157, 0x00158,
+	0x00159, 0x0015a, 0x0015b, 0x0015c, 0x0015d, 0x0015e, 0x0015f, 0x00160,
+	0x00161, 0x00162, 0x00163, 0x00164, 0x00165, 0x00168, 0x00169, 0x0016a,
+	0x0016b, 0x0016c, 0x0016d, 0x0016e, 0x0016f, 0x00170, 0x00171, 0x00172,
+	0x00173, 0x00174, 0x00175, 0x00176, 0x00177, 0x00178, 0x00179, 0x0017a,
+	0x0017b, 0x0017c, 0x0017d, 0x0017e, 0x0017f, 0x001a0, 0x001a1, 0x001af,
+	0x001b0, 0x001c4, 0x001c5, 0x001c6, 0x001c7, 0x001c8, 0x001c9, 0x001ca,
+	0x001cb, 0x001cc, 0x001cd, 0x001ce, 0x001cf, 0x001d0, 0x001d1, 0x001d2,
+	0x001d3, 0x001d4, 0x001d5, 0x001d6, 0x001d7, 0x001d8, 0x001d9, 0x001da,
+	0x001db, 0x001dc, 0x001de, 0x001df, 0x001e0, 0x001e1, 0x001e2, 0x001e3,
+	0x001e6, 0x001e7, 0x001e8, 0x001e9, 0x001ea, 0x001eb, 0x001ec, 0x001ed,
+	0x001ee, 0x001ef, 0x001f0, 0x001f1, 0x001f2, 0x001f3, 0x001f4, 0x001f5,
+	0x001f8, 0x001f9, 0x001fa, 0x001fb, 0x001fc, 0x001fd, 0x001fe, 0x001ff,
+	0x00200, 0x00201, 0x00202, 0x00203, 0x00204, 0x00205, 0x00206, 0x00207,
+	0x00208, 0x00209, 0x0020a, 0x0020b, 0x0020c, 0x0020d, 0x0020e, 0x0020f,
+	0x00210, 0x00211, 0x00212, 0x00213, 0x00214, 0x00215, 0x00216, 0x00217,
+	0x00218, 0x00219, 0x0021a, 0x0021b, 0x0021e, 0x0021f, 0x00226, 0x00227,
+	0x00228, 0x00229, 0x0022a, 0x0022b, 0x0022c, 0x0022d, 0x0022e, 0x0022f,
+	0x00230, 0x00231, 0x00232, 0x00233, 0x002b0, 0x002b1, 0x002b2, 0x002b3,
+	0x002b4, 0x002b5, 0x002b6, 0x002b7, 0x002b8, 0x002d8, 0x002d9, 0x002da,
+	0x002db, 0x002dc, 0x002dd, 0x002e0, 0x002e1, 0x002e2, 0x002e3, 0x002e4,
+	0x00340, 0x00341, 0x00343, 0x00344, 0x00374, 0x0037a, 0x0037e, 0x00384,
+	0x00385, 0x00386, 0x00387, 0x00388, 0x00389, 0x0038a, 0x0038c, 0x0038e,
+	0x0038f, 0x00390, 0x003aa, 0x003ab, 0x003ac, 0x003ad, 0x003ae, 0x003af,
+	0x003b0, 0x003ca, 0x003cb, 0x003cc, 0x003cd, 0x003ce, 0x003d0, 0x003d1,
+	0x003d2, 0x003d3, 0x003d4, 0x003d5, 0x003d6, 0x003f0, 0x003f1, 0x003f2,
+	0x003f4, 0x003f5, 0x003f9, 0x00400, 0x00401, 0x00403, 0x00407, 0x0040c,
+	0x0040d, 0x0040e, 0x00419, 0x00439, 0x00450, 0x00451, 0x00453, 0x00457,
+	0x0045c, 0x0045d, 0x0045e, 0x00476, 0x00477, 0x004c1, 0x004c2, 0x004d0,
+	0x004d1, 0x004d2, 0x004d3, 0x004d6, 0x004d7, 0x004da, 0x004db, 0x004dc,
+	0x004dd, 0x004de, 0x004df, 0x004e2, 0x004e3, 0x004e4, 0x004e5, 0x004e6,
+	0x004e7, 0x004ea, 0x004eb, 0x004ec, 0x004ed, 0x004ee, 0x004ef, 0x004f0,
+	0x004f1, 0x004f2, 0x004f3, 0x004f4, 0x004f5, 0x004f8, 0x004f9, 0x00587,
+	0x00622, 0x00623, 0x00624, 0x00625, 0x00626, 0x00675, 0x00676, 0x00677,
+	0x00678, 0x006c0, 0x006c2, 0x006d3, 0x00929, 0x00931, 0x00934, 0x00958,
+	0x00959, 0x0095a, 0x0095b, 0x0095c, 0x0095d, 0x0095e, 0x0095f, 0x009cb,
+	0x009cc, 0x009dc, 0x009dd, 0x009df, 0x00a33, 0x00a36, 0x00a59, 0x00a5a,
+	0x00a5b, 0x00a5e, 0x00b48, 0x00b4b, 0x00b4c, 0x00b5c, 0x00b5d, 0x00b94,
+	0x00bca, 0x00bcb, 0x00bcc, 0x00c48, 0x00cc0, 0x00cc7, 0x00cc8, 0x00cca,
+	0x00ccb, 0x00d4a, 0x00d4b, 0x00d4c, 0x00dda, 0x00ddc, 0x00ddd, 0x00dde,
+	0x00e33, 0x00eb3, 0x00edc, 0x00edd, 0x00f0c, 0x00f43, 0x00f4d, 0x00f52,
+	0x00f57, 0x00f5c, 0x00f69, 0x00f73, 0x00f75, 0x00f76, 0x00f77, 0x00f78,
+	0x00f79, 0x00f81, 0x00f93, 0x00f9d, 0x00fa2, 0x00fa7, 0x00fac, 0x00fb9,
+	0x01026, 0x010fc, 0x01b06, 0x01b08, 0x01b0a, 0x01b0c, 0x01b0e, 0x01b12,
+	0x01b3b, 0x01b3d, 0x01b40, 0x01b41, 0x01b43, 0x01d2c, 0x01d2d, 0x01d2e,
+	0x01d30, 0x01d31, 0x01d32, 0x01d33, 0x01d34, 0x01d35, 0x01d36, 0x01d37,
+	0x01d38, 0x01d39, 0x01d3a, 0x01d3c, 0x01d3d, 0x01d3e, 0x01d3f, 0x01d40,
+	0x01d41, 0x01d42, 0x01d43, 0x01d44, 0x01d45, 0x01d46, 0x01d47, 0x01d48,
+	0x01d49, 0x01d4a, 0x01d4b, 0x01d4c, 0x01d4d, 0x01d4f, 0x01d50, 0x01d51,
+	0x01d52, 0x01d53, 0x01d54, 0x01d55, 0x01d56, 0x01d57, 0x01d58, 0x01d59,
+	0x01d5a, 0x01d5b, 0x01d5c, 0x01d5d, 0x01d5e, 0x01d5f, 0x01d60, 0x01d61,
+	0x01d62, 0x01d63, 0x01d64, 0x01d65, 0x01d66, 0x01d67, 0x01d68, 0x01d69,
+	0x01d6a, 0x01d78, 0x01d9b, 0x01d9c, 0x01d9d, 0x01d9e, 0x01d9f, 0x01da0,
+	0x01da1, 0x01da2, 0x01da3, 0x01da4, 0x01da5, 0x01da6, 0x01da7, 0x01da8,
+	0x01da9, 0x01daa, 0x01dab, 0x01dac, 0x01dad, 0x01dae, 0x01daf, 0x01db0,
+	0x01db1, 0x01db2, 0x01db3, 0x01db4, 0x01db5, 0x01db6, 0x01db7, 0x01db8,
+	0x01db9, 0x01dba, 0x01dbb, 0x01dbc, 0x01dbd, 0x01dbe, 0x01dbf, 0x01e00,
+	0x01e01, 0x01e02, 0x01e03, 0x01e04, 0x01e05, 0x01e06, 0x01e07, 0x01e08,
+	0x01e09, 0x01e0a, 0x01e0b, 0x01e0c, 0x01e0d, 0x01e0e, 0x01e0f, 0x01e10,
+	0x01e11, 0x01e12, 0x01e13, 0x01e14, 0x01e15, 0x01e16, 0x01e17, 0x01e18,
+	0x01e19, 0x01e1a, 0x01e1b, 0x01e1c, 0x01e1d, 0x01e1e, 0x01e1f, 0x01e20,
+	0x01e21, 0x01e22, 0x01e23, 0x01e24, 0x01e25, 0x01e26, 0x01e27, 0x01e28,
+	0x01e29, 0x01e2a, 0x01e2b, 0x01e2c, 0x01e2d, 0x01e2e, 0x01e2f, 0x01e30,
+	0x01e31, 0x01e32, 0x01e33, 0x01e34, 0x01e35, 0x01e36, 0x01e37, 0x01e38,
+	0x01e39, 0x01e3a, 0x01e3b, 0x01e3c, 0x01e3d, 0x01e3e, 0x01e3f, 0x01e40,
+	0x01e41, 0x01e42, 0x01e43, 0x01e44, 0x01e45, 0x01e46, 0x01e47, 0x01e48,
+	0x01e49, 0x01e4a, 0x01e4b, 0x01e4c, 0x01e4d, 0x01e4e, 0x01e4f, 0x01e50,
+	0x01e51, 0x01e52, 0x01e53, 0x01e54, 0x01e55, 0x01e56, 0x01e57, 0x01e58,
+	0x01e59, 0x01e5a, 0x01e5b, 0x01e5c, 0x01e5d, 0x01e5e, 0x01e5f, 0x01e60,
+	0x01e61, 0x01e62, 0x01e63, 0x01e64, 0x01e65, 0x01e66, 0x01e67, 0x01e68,
+	0x01e69, 0x01e6a, 0x01e6b, 0x01e6c, 0x01e6d, 0x01e6e, 0x01e6f, 0x01e70,
+	0x01e71, 0x01e72, 0x01e73, 0x01e74, 0x01e75, 0x01e76, 0x01e77, 0x01e78,
+	0x01e79, 0x01e7a, 0x01e7b, 0x01e7c, 0x01e7d, 0x01e7e, 0x01e7f, 0x01e80,
+	0x01e81, 0x01e82, 0x01e83, 0x01e84, 0x01e85, 0x01e86, 0x01e87, 0x01e88,
+	0x01e89, 0x01e8a, 0x01e8b, 0x01e8c, 0x01e8d, 0x01e8e, 0x01e8f, 0x01e90,
+	0x01e91, 0x01e92, 0x01e93, 0x01e94, 0x01e95, 0x01e96, 0x01e97, 0x01e98,
+	0x01e99, 0x01e9a, 0x01e9b, 0x01ea0, 0x01ea1, 0x01ea2, 0x01ea3, 0x01ea4,
+	0x01ea5, 0x01ea6, 0x01ea7, 0x01ea8, 0x01ea9, 0x01eaa, 0x01eab, 0x01eac,
+	0x01ead, 0x01eae, 0x01eaf, 0x01eb0, 0x01eb1, 0x01eb2, 0x01eb3, 0x01eb4,
+	0x01eb5, 0x01eb6, 0x01eb7, 0x01eb8, 0x01eb9, 0x01eba, 0x01ebb, 0x01ebc,
+	0x01ebd, 0x01ebe, 0x01ebf, 0x01ec0, 0x01ec1, 0x01ec2, 0x01ec3, 0x01ec4,
+	0x01ec5, 0x01ec6, 0x01ec7, 0x01ec8, 0x01ec9, 0x01eca, 0x01ecb, 0x01ecc,
+	0x01ecd, 0x01ece, 0x01ecf, 0x01ed0, 0x01ed1, 0x01ed2, 0x01ed3, 0x01ed4,
+	0x01ed5, 0x01ed6, 0x01ed7, 0x01ed8, 0x01ed9, 0x01eda, 0x01edb, 0x01edc,
+	0x01edd, 0x01ede, 0x01edf, 0x01ee0, 0x01ee1, 0x01ee2, 0x01ee3, 0x01ee4,
+	0x01ee5, 0x01ee6, 0x01ee7, 0x01ee8, 0x01ee9, 0x01eea, 0x01eeb, 0x01eec,
+	0x01eed, 0x01eee, 0x01eef, 0x01ef0, 0x01ef1, 0x01ef2, 0x01ef3, 0x01ef4,
+	0x01ef5, 0x01ef6, 0x01ef7, 0x01ef8, 0x01ef9, 0x01f00, 0x01f01, 0x01f02,
+	0x01f03, 0x01f04, 0x01f05, 0x01f06, 0x01f07, 0x01f08, 0x01f09, 0x01f0a,
+	0x01f0b, 0x01f0c, 0x01f0d, 0x01f0e, 0x01f0f, 0x01f10, 0x01f11, 0x01f12,
+	0x01f13, 0x01f14, 0x01f15, 0x01f18, 0x01f19, 0x01f1a, 0x01f1b, 0x01f1c,
+	0x01f1d, 0x01f20, 0x01f21, 0x01f22, 0x01f23, 0x01f24, 0x01f25, 0x01f26,
+	0x01f27, 0x01f28, 0x01f29, 0x01f2a, 0x01f2b, 0x01f2c, 0x01f2d, 0x01f2e,
+	0x01f2f, 0x01f30, 0x01f31, 0x01f32, 0x01f33, 0x01f34, 0x01f35, 0x01f36,
+	0x01f37, 0x01f38, 0x01f39, 0x01f3a, 0x01f3b, 0x01f3c, 0x01f3d, 0x01f3e,
+	0x01f3f, 0x01f40, 0x01f41, 0x01f42, 0x01f43, 0x01f44, 0x01f45, 0x01f48,
+	0x01f49, 0x01f4a, 0x01f4b, 0x01f4c, 0x01f4d, 0x01f50, 0x01f51, 0x01f52,
+	0x01f53, 0x01f54, 0x01f55, 0x01f56, 0x01f57, 0x01f59, 0x01f5b, 0x01f5d,
+	0x01f5f, 0x01f60, 0x01f61, 0x01f62, 0x01f63, 0x01f64, 0x01f65, 0x01f66,
+	0x01f67, 0x01f68, 0x01f69, 0x01f6a, 0x01f6b, 0x01f6c, 0x01f6d, 0x01f6e,
+	0x01f6f, 0x01f70, 0x01f71, 0x01f72, 0x01f73, 0x01f74, 0x01f75, 0x01f76,
+	0x01f77, 0x01f78, 0x01f79, 0x01f7a, 0x01f7b, 0x01f7c, 0x01f7d, 0x01f80,
+	0x01f81, 0x01f82, 0x01f83, 0x01f84, 0x01f85, 0x01f86, 0x01f87, 0x01f88,
+	0x01f89, 0x01f8a, 0x01f8b, 0x01f8c, 0x01f8d, 0x01f8e, 0x01f8f, 0x01f90,
+	0x01f91, 0x01f92, 0x01f93, 0x01f94, 0x01f95, 0x01f96, 0x01f97, 0x01f98,
+	0x01f99, 0x01f9a, 0x01f9b, 0x01f9c, 0x01f9d, 0x01f9e, 0x01f9f, 0x01fa0,
+	0x01fa1, 0x01fa2, 0x01fa3, 0x01fa4, 0x01fa5, 0x01fa6, 0x01fa7, 0x01fa8,
+	0x01fa9, 0x01faa, 0x01fab, 0x01fac, 0x01fad, 0x01fae, 0x01faf, 0x01fb0,
+	0x01fb1, 0x01fb2, 0x01fb3, 0x01fb4, 0x01fb6, 0x01fb7, 0x01fb8, 0x01fb9,
+	0x01fba, 0x01fbb, 0x01fbc, 0x01fbd, 0x01fbe, 0x01fbf, 0x01fc0, 0x01fc1,
+	0x01fc2, 0x01fc3, 0x01fc4, 0x01fc6, 0x01fc7, 0x01fc8, 0x01fc9, 0x01fca,
+	0x01fcb, 0x01fcc, 0x01fcd, 0x01fce, 0x01fcf, 0x01fd0, 0x01fd1, 0x01fd2,
+	0x01fd3, 0x01fd6, 0x01fd7, 0x01fd8, 0x01fd9, 0x01fda, 0x01fdb, 0x01fdd,
+	0x01fde, 0x01fdf, 0x01fe0, 0x01fe1, 0x01fe2, 0x01fe3, 0x01fe4, 0x01fe5,
+	0x01fe6, 0x01fe7, 0x01fe8, 0x01fe9, 0x01fea, 0x01feb, 0x01fec, 0x01fed,
+	0x01fee, 0x01fef, 0x01ff2, 0x01ff3, 0x01ff4, 0x01ff6, 0x01ff7, 0x01ff8,
+	0x01ff9, 0x01ffa, 0x01ffb, 0x01ffc, 0x01ffd, 0x01ffe, 0x02000, 0x02001,
+	0x02002, 0x02003, 0x02004, 0x02005, 0x02006, 0x02007, 0x02008, 0x02009,
+	0x0200a, 0x02011, 0x02017, 0x02024, 0x02025, 0x02026, 0x0202f, 0x02033,
+	0x02034, 0x02036, 0x02037, 0x0203c, 0x0203e, 0x02047, 0x02048, 0x02049,
+	0x02057, 0x0205f, 0x02070, 0x02071, 0x02074, 0x02075, 0x02076, 0x02077,
+	0x02078, 0x02079, 0x0207a, 0x0207b, 0x0207c, 0x0207d, 0x0207e, 0x0207f,
+	0x02080, 0x02081, 0x02082, 0x02083, 0x02084, 0x02085, 0x02086, 0x02087,
+	0x02088, 0x02089, 0x0208a, 0x0208b, 0x0208c, 0x0208d, 0x0208e, 0x02090,
+	0x02091, 0x02092, 0x02093, 0x02094, 0x02095, 0x02096, 0x02097, 0x02098,
+	0x02099, 0x0209a, 0x0209b, 0x0209c, 0x020a8, 0x02100, 0x02101, 0x02102,
+	0x02103, 0x02105, 0x02106, 0x02107, 0x02109, 0x0210a, 0x0210b, 0x0210c,
+	0x0210d, 0x0210e, 0x0210f, 0x02110, 0x02111, 0x02112, 0x02113, 0x02115,
+	0x02116, 0x02119, 0x0211a, 0x0211b, 0x0211c, 0x0211d, 0x02120, 0x02121,
+	0x02122, 0x02124, 0x02126, 0x02128, 0x0212a, 0x0212b, 0x0212c, 0x0212d,
+	0x0212f, 0x02130, 0x02131, 0x02133, 0x02134, 0x02135, 0x02136, 0x02137,
+	0x02138, 0x02139, 0x0213b, 0x0213c, 0x0213d, 0x0213e, 0x0213f, 0x02140,
+	0x02145, 0x02146, 0x02147, 0x02148, 0x02149, 0x02150, 0x02151, 0x02152,
+	0x02153, 0x02154, 0x02155, 0x02156, 0x02157, 0x02158, 0x02159, 0x0215a,
+	0x0215b, 0x0215c, 0x0215d, 0x0215e, 0x0215f, 0x02160, 0x02161, 0x02162,
+	0x02163, 0x02164, 0x02165, 0x02166, 0x02167, 0x02168, 0x02169, 0x0216a,
+	0x0216b, 0x0216c, 0x0216d, 0x0216e, 0x0216f, 0x02170, 0x02171, 0x02172,
+	0x02173, 0x02174, 0x02175, 0x02176, 0x02177, 0x02178, 0x02179, 0x0217a,
+	0x0217b, 0x0217c, 0x0217d, 0x0217e, 0x0217f, 0x02189, 0x0219a, 0x0219b,
+	0x021ae, 0x021cd, 0x021ce, 0x021cf, 0x02204, 0x02209, 0x0220c, 0x02224,
+	0x02226, 0x0222c, 0x0222d, 0x0222f, 0x02230, 0x02241, 0x02244, 0x02247,
+	0x02249, 0x02260, 0x02262, 0x0226d, 0x0226e, 0x0226f, 0x02270, 0x02271,
+	0x02274, 0x02275, 0x02278, 0x02279, 0x02280, 0x02281, 0x02284, 0x02285,
+	0x02288, 0x02289, 0x022ac, 0x022ad, 0x022ae, 0x022af, 0x022e0, 0x022e1,
+	0x022e2, 0x022e3, 0x022ea, 0x022eb, 0x022ec, 0x022ed, 0x02329, 0x0232a,
+	0x02460, 0x02461, 0x02462, 0x02463, 0x02464, 0x02465, 0x02466, 0x02467,
+	0x02468, 0x02469, 0x0246a, 0x0246b, 0x0246c, 0x0246d, 0x0246e, 0x0246f,
+	0x02470, 0x02471, 0x02472, 0x02473, 0x02474, 0x02475, 0x02476, 0x02477,
+	0x02478, 0x02479, 0x0247a, 0x0247b, 0x0247c, 0x0247d, 0x0247e, 0x0247f,
+	0x02480, 0x02481, 0x02482, 0x02483, 0x02484, 0x02485, 0x02486, 0x02487,
+	0x02488, 0x02489, 0x0248a, 0x0248b, 0x0248c, 0x0248d, 0x0248e, 0x0248f,
+	0x02490, 0x02491, 0x02492, 0x02493, 0x02494, 0x02495, 0x02496, 0x02497,
+	0x02498, 0x02499, 0x0249a, 0x0249b, 0x0249c, 0x0249d, 0x0249e, 0x0249f,
+	0x024a0, 0x024a1, 0x024a2, 0x024a3, 0x024a4, 0x024a5, 0x024a6, 0x024a7,
+	0x024a8, 0x024a9, 0x024aa, 0x024ab, 0x024ac, 0x024ad, 0x024ae, 0x024af,
+	0x024b0, 0x024b1, 0x024b2, 0x024b3, 0x024b4, 0x024b5, 0x024b6, 0x024b7,
+	0x024b8, 0x024b9, 0x024ba, 0x024bb, 0x024bc, 0x024bd, 0x024be, 0x024bf,
+	0x024c0, 0x024c1, 0x024c2, 0x024c3, 0x024c4, 0x024c5, 0x024c6, 0x024c7,
+	0x024c8, 0x024c9, 0x024ca, 0x024cb, 0x024cc, 0x024cd, 0x024ce, 0x024cf,
+	0x024d0, 0x024d1, 0x024d2, 0x024d3, 0x024d4, 0x024d5, 0x024d6, 0x024d7,
+	0x024d8, 0x024d9, 0x024da, 0x024db, 0x024dc, 0x024dd, 0x024de, 0x024df,
+	0x024e0, 0x024e1, 0x024e2, 0x024e3, 0x024e4, 0x024e5, 0x024e6, 0x024e7,
+	0x024e8, 0x024e9, 0x024ea, 0x02a0c, 0x02a74, 0x02a75, 0x02a76, 0x02adc,
+	0x02c7c, 0x02c7d, 0x02d6f, 0x02e9f, 0x02ef3, 0x02f00, 0x02f01, 0x02f02,
+	0x02f03, 0x02f04, 0x02f05, 0x02f06, 0x02f07, 0x02f08, 0x02f09, 0x02f0a,
+	0x02f0b, 0x02f0c, 0x02f0d, 0x02f0e, 0x02f0f, 0x02f10, 0x02f11, 0x02f12,
+	0x02f13, 0x02f14, 0x02f15, 0x02f16, 0x02f17, 0x02f18, 0x02f19, 0x02f1a,
+	0x02f1b, 0x02f1c, 0x02f1d, 0x02f1e, 0x02f1f, 0x02f20, 0x02f21, 0x02f22,
+	0x02f23, 0x02f24, 0x02f25, 0x02f26, 0x02f27, 0x02f28, 0x02f29, 0x02f2a,
+	0x02f2b, 0x02f2c, 0x02f2d, 0x02f2e, 0x02f2f, 0x02f30, 0x02f31, 0x02f32,
+	0x02f33, 0x02f34, 0x02f35, 0x02f36, 0x02f37, 0x02f38, 0x02f39, 0x02f3a,
+	0x02f3b, 0x02f3c, 0x02f3d, 0x02f3e, 0x02f3f, 0x02f40, 0x02f41, 0x02f42,
+	0x02f43, 0x02f44, 0x02f45, 0x02f46, 0x02f47, 0x02f48, 0x02f49, 0x02f4a,
+	0x02f4b, 0x02f4c, 0x02f4d, 0x02f4e, 0x02f4f, 0x02f50, 0x02f51, 0x02f52,
+	0x02f53, 0x02f54, 0x02f55, 0x02f56, 0x02f57, 0x02f58, 0x02f59, 0x02f5a,
+	0x02f5b, 0x02f5c, 0x02f5d, 0x02f5e, 0x02f5f, 0x02f60, 0x02f61, 0x02f62,
+	0x02f63, 0x02f64, 0x02f65, 0x02f66, 0x02f67, 0x02f68, 0x02f69, 0x02f6a,
+	0x02f6b, 0x02f6c, 0x02f6d, 0x02f6e, 0x02f6f, 0x02f70, 0x02f71, 0x02f72,
+	0x02f73, 0x02f74, 0x02f75, 0x02f76, 0x02f77, 0x02f78, 0x02f79, 0x02f7a,
+	0x02f7b, 0x02f7c, 0x02f7d, 0x02f7e, 0x02f7f, 0x02f80, 0x02f81, 0x02f82,
+	0x02f83, 0x02f84, 0x02f85, 0x02f86, 0x02f87, 0x02f88, 0x02f89, 0x02f8a,
+	0x02f8b, 0x02f8c, 0x02f8d, 0x02f8e, 0x02f8f, 0x02f90, 0x02f91, 0x02f92,
+	0x02f93, 0x02f94, 0x02f95, 0x02f96, 0x02f97, 0x02f98, 0x02f99, 0x02f9a,
+	0x02f9b, 0x02f9c, 0x02f9d, 0x02f9e, 0x02f9f, 0x02fa0, 0x02fa1, 0x02fa2,
+	0x02fa3, 0x02fa4, 0x02fa5, 0x02fa6, 0x02fa7, 0x02fa8, 0x02fa9, 0x02faa,
+	0x02fab, 0x02fac, 0x02fad, 0x02fae, 0x02faf, 0x02fb0, 0x02fb1, 0x02fb2,
+	0x02fb3, 0x02fb4, 0x02fb5, 0x02fb6, 0x02fb7, 0x02fb8, 0x02fb9, 0x02fba,
+	0x02fbb, 0x02fbc, 0x02fbd, 0x02fbe, 0x02fbf, 0x02fc0, 0x02fc1, 0x02fc2,
+	0x02fc3, 0x02fc4, 0x02fc5, 0x02fc6, 0x02fc7, 0x02fc8, 0x02fc9, 0x02fca,
+	0x02fcb, 0x02fcc, 0x02fcd, 0x02fce, 0x02fcf, 0x02fd0, 0x02fd1, 0x02fd2,
+	0x02fd3, 0x02fd4, 0x02fd5, 0x03000, 0x03036, 0x03038, 0x03039, 0x0303a,
+	0x0304c, 0x0304e, 0x03050, 0x03052, 0x03054, 0x03056, 0x03058, 0x0305a,
+	0x0305c, 0x0305e, 0x03060, 0x03062, 0x03065, 0x03067, 0x03069, 0x03070,
+	0x03071, 0x03073, 0x03074, 0x03076, 0x03077, 0x03079, 0x0307a, 0x0307c,
+	0x0307d, 0x03094, 0x0309b, 0x0309c, 0x0309e, 0x0309f, 0x030ac, 0x030ae,
+	0x030b0, 0x030b2, 0x030b4, 0x030b6, 0x030b8, 0x030ba, 0x030bc, 0x030be,
+	0x030c0, 0x030c2, 0x030c5, 0x030c7, 0x030c9, 0x030d0, 0x030d1, 0x030d3,
+	0x030d4, 0x030d6, 0x030d7, 0x030d9, 0x030da, 0x030dc, 0x030dd, 0x030f4,
+	0x030f7, 0x030f8, 0x030f9, 0x030fa, 0x030fe, 0x030ff, 0x03131, 0x03132,
+	0x03133, 0x03134, 0x03135, 0x03136, 0x03137, 0x03138, 0x03139, 0x0313a,
+	0x0313b, 0x0313c, 0x0313d, 0x0313e, 0x0313f, 0x03140, 0x03141, 0x03142,
+	0x03143, 0x03144, 0x03145, 0x03146, 0x03147, 0x03148, 0x03149, 0x0314a,
+	0x0314b, 0x0314c, 0x0314d, 0x0314e, 0x0314f, 0x03150, 0x03151, 0x03152,
+	0x03153, 0x03154, 0x03155, 0x03156, 0x03157, 0x03158, 0x03159, 0x0315a,
+	0x0315b, 0x0315c, 0x0315d, 0x0315e, 0x0315f, 0x03160, 0x03161, 0x03162,
+	0x03163, 0x03164, 0x03165, 0x03166, 0x03167, 0x03168, 0x03169, 0x0316a,
+	0x0316b, 0x0316c, 0x0316d, 0x0316e, 0x0316f, 0x03170, 0x03171, 0x03172,
+	0x03173, 0x03174, 0x03175, 0x03176, 0x03177, 0x03178, 0x03179, 0x0317a,
+	0x0317b, 0x0317c, 0x0317d, 0x0317e, 0x0317f, 0x03180, 0x03181, 0x03182,
+	0x03183, 0x03184, 0x03185, 0x03186, 0x03187, 0x03188, 0x03189, 0x0318a,
+	0x0318b, 0x0318c, 0x0318d, 0x0318e, 0x03192, 0x03193, 0x03194, 0x03195,
+	0x03196, 0x03197, 0x03198, 0x03199, 0x0319a, 0x0319b, 0x0319c, 0x0319d,
+	0x0319e, 0x0319f, 0x03200, 0x03201, 0x03202, 0x03203, 0x03204, 0x03205,
+	0x03206, 0x03207, 0x03208, 0x03209, 0x0320a, 0x0320b, 0x0320c, 0x0320d,
+	0x0320e, 0x0320f, 0x03210, 0x03211, 0x03212, 0x03213, 0x03214, 0x03215,
+	0x03216, 0x03217, 0x03218, 0x03219, 0x0321a, 0x0321b, 0x0321c, 0x0321d,
+	0x0321e, 0x03220, 0x03221, 0x03222, 0x03223, 0x03224, 0x03225, 0x03226,
+	0x03227, 0x03228, 0x03229, 0x0322a, 0x0322b, 0x0322c, 0x0322d, 0x0322e,
+	0x0322f, 0x03230, 0x03231, 0x03232, 0x03233, 0x03234, 0x03235, 0x03236,
+	0x03237, 0x03238, 0x03239, 0x0323a, 0x0323b, 0x0323c, 0x0323d, 0x0323e,
+	0x0323f, 0x03240, 0x03241, 0x03242, 0x03243, 0x03244, 0x03245, 0x03246,
+	0x03247, 0x03250, 0x03251, 0x03252, 0x03253, 0x03254, 0x03255, 0x03256,
+	0x03257, 0x03258, 0x03259, 0x0325a, 0x0325b, 0x0325c, 0x0325d, 0x0325e,
+	0x0325f, 0x03260, 0x03261, 0x03262, 0x03263, 0x03264, 0x03265, 0x03266,
+	0x03267, 0x03268, 0x03269, 0x0326a, 0x0326b, 0x0326c, 0x0326d, 0x0326e,
+	0x0326f, 0x03270, 0x03271, 0x03272, 0x03273, 0x03274, 0x03275, 0x03276,
+	0x03277, 0x03278, 0x03279, 0x0327a, 0x0327b, 0x0327c, 0x0327d, 0x0327e,
+	0x03280, 0x03281, 0x03282, 0x03283, 0x03284, 0x03285, 0x03286, 0x03287,
+	0x03288, 0x03289, 0x0328a, 0x0328b, 0x0328c, 0x0328d, 0x0328e, 0x0328f,
+	0x03290, 0x03291, 0x03292, 0x03293, 0x03294, 0x03295, 0x03296, 0x03297,
+	0x03298, 0x03299, 0x0329a, 0x0329b, 0x0329c, 0x0329d, 0x0329e, 0x0329f,
+	0x032a0, 0x032a1, 0x032a2, 0x032a3, 0x032a4, 0x032a5, 0x032a6, 0x032a7,
+	0x032a8, 0x032a9, 0x032aa, 0x032ab, 0x032ac, 0x032ad, 0x032ae, 0x032af,
+	0x032b0, 0x032b1, 0x032b2, 0x032b3, 0x032b4, 0x032b5, 0x032b6, 0x032b7,
+	0x032b8, 0x032b9, 0x032ba, 0x032bb, 0x032bc, 0x032bd, 0x032be, 0x032bf,
+	0x032c0, 0x032c1, 0x032c2, 0x032c3, 0x032c4, 0x032c5, 0x032c6, 0x032c7,
+	0x032c8, 0x032c9, 0x032ca, 0x032cb, 0x032cc, 0x032cd, 0x032ce, 0x032cf,
+	0x032d0, 0x032d1, 0x032d2, 0x032d3, 0x032d4, 0x032d5, 0x032d6, 0x032d7,
+	0x032d8, 0x032d9, 0x032da, 0x032db, 0x032dc, 0x032dd, 0x032de, 0x032df,
+	0x032e0, 0x032e1, 0x032e2, 0x032e3, 0x032e4, 0x032e5, 0x032e6, 0x032e7,
+	0x032e8, 0x032e9, 0x032ea, 0x032eb, 0x032ec, 0x032ed, 0x032ee, 0x032ef,
+	0x032f0, 0x032f1, 0x032f2, 0x032f3, 0x032f4, 0x032f5, 0x032f6, 0x032f7,
+	0x032f8, 0x032f9, 0x032fa, 0x032fb, 0x032fc, 0x032fd, 0x032fe, 0x032ff,
+	0x03300, 0x03301, 0x03302, 0x03303, 0x03304, 0x03305, 0x03306, 0x03307,
+	0x03308, 0x03309, 0x0330a, 0x0330b, 0x0330c, 0x0330d, 0x0330e, 0x0330f,
+	0x03310, 0x03311, 0x03312, 0x03313, 0x03314, 0x03315, 0x03316, 0x03317,
+	0x03318, 0x03319, 0x0331a, 0x0331b, 0x0331c, 0x0331d, 0x0331e, 0x0331f,
+	0x03320, 0x03321, 0x03322, 0x03323, 0x03324, 0x03325, 0x03326, 0x03327,
+	0x03328, 0x03329, 0x0332a, 0x0332b, 0x0332c, 0x0332d, 0x0332e, 0x0332f,
+	0x03330, 0x03331, 0x03332, 0x03333, 0x03334, 0x03335, 0x03336, 0x03337,
+	0x03338, 0x03339, 0x0333a, 0x0333b, 0x0333c, 0x0333d, 0x0333e, 0x0333f,
+	0x03340, 0x03341, 0x03342, 0x03343, 0x03344, 0x03345, 0x03346, 0x03347,
+	0x03348, 0x03349, 0x0334a, 0x0334b, 0x0334c, 0x0334d, 0x0334e, 0x0334f,
+	0x03350, 0x03351, 0x03352, 0x03353, 0x03354, 0x03355, 0x03356, 0x03357,
+	0x03358, 0x03359, 0x0335a, 0x0335b, 0x0335c, 0x0335d, 0x0335e, 0x0335f,
+	0x03360, 0x03361, 0x03362, 0x03363, 0x03364, 0x03365, 0x03366, 0x03367,
+	0x03368, 0x03369, 0x0336a, 0x0336b, 0x0336c, 0x0336d, 0x0336e, 0x0336f,
+	0x03370, 0x03371, 0x03372, 0x03373, 0x03374, 0x03375, 0x03376, 0x03377,
+	0x03378, 0x03379, 0x0337a, 0x0337b, 0x0337c, 0x0337d, 0x0337e, 0x0337f,
+	0x03380, 0x03381, 0x03382, 0x03383, 0x03384, 0x03385, 0x03386, 0x03387,
+	0x03388, 0x03389, 0x0338a, 0x0338b, 0x0338c, 0x0338d, 0x0338e, 0x0338f,
+	0x03390, 0x03391, 0x03392, 0x03393, 0x03394, 0x03395, 0x03396, 0x03397,
+	0x03398, 0x03399, 0x0339a, 0x0339b, 0x0339c, 0x0339d, 0x0339e, 0x0339f,
+	0x033a0, 0x033a1, 0x033a2, 0x033a3, 0x033a4, 0x033a5, 0x033a6, 0x033a7,
+	0x033a8, 0x033a9, 0x033aa, 0x033ab, 0x033ac, 0x033ad, 0x033ae, 0x033af,
+	0x033b0, 0x033b1, 0x033b2, 0x033b3, 0x033b4, 0x033b5, 0x033b6, 0x033b7,
+	0x033b8, 0x033b9, 0x033ba, 0x033bb, 0x033bc, 0x033bd, 0x033be, 0x033bf,
+	0x033c0, 0x033c1, 0x033c2, 0x033c3, 0x033c4, 0x033c5, 0x033c6, 0x033c7,
+	0x033c8, 0x033c9, 0x033ca, 0x033cb, 0x033cc, 0x033cd, 0x033ce, 0x033cf,
+	0x033d0, 0x033d1, 0x033d2, 0x033d3, 0x033d4, 0x033d5, 0x033d6, 0x033d7,
+	0x033d8, 0x033d9, 0x033da, 0x033db, 0x033dc, 0x033dd, 0x033de, 0x033df,
+	0x033e0, 0x033e1, 0x033e2, 0x033e3, 0x033e4, 0x033e5, 0x033e6, 0x033e7,
+	0x033e8, 0x033e9, 0x033ea, 0x033eb, 0x033ec, 0x033ed, 0x033ee, 0x033ef,
+	0x033f0, 0x033f1, 0x033f2, 0x033f3, 0x033f4, 0x033f5, 0x033f6, 0x033f7,
+	0x033f8, 0x033f9, 0x033fa, 0x033fb, 0x033fc, 0x033fd, 0x033fe, 0x033ff,
+	0x0a69c, 0x0a69d, 0x0a770, 0x0a7f2, 0x0a7f3, 0x0a7f4, 0x0a7f8, 0x0a7f9,
+	0x0ab5c, 0x0ab5d, 0x0ab5e, 0x0ab5f, 0x0ab69, 0x0f900, 0x0f901, 0x0f902,
+	0x0f903, 0x0f904, 0x0f905, 0x0f906, 0x0f907, 0x0f908, 0x0f909, 0x0f90a,
+	0x0f90b, 0x0f90c, 0x0f90d, 0x0f90e, 0x0f90f, 0x0f910, 0x0f911, 0x0f912,
+	0x0f913, 0x0f914, 0x0f915, 0x0f916, 0x0f917, 0x0f918, 0x0f919, 0x0f91a,
+	0x0f91b, 0x0f91c, 0x0f91d, 0x0f91e, 0x0f91f, 0x0f920, 0x0f921, 0x0f922,
+	0x0f923, 0x0f924, 0x0f925, 0x0f926, 0x0f927, 0x0f928, 0x0f929, 0x0f92a,
+	0x0f92b, 0x0f92c, 0x0f92d, 0x0f92e, 0x0f92f, 0x0f930, 0x0f931, 0x0f932,
+	0x0f933, 0x0f934, 0x0f935, 0x0f936, 0x0f937, 0x0f938, 0x0f939, 0x0f93a,
+	0x0f93b, 0x0f93c, 0x0f93d, 0x0f93e, 0x0f93f, 0x0f940, 0x0f941, 0x0f942,
+	0x0f943, 0x0f944, 0x0f945, 0x0f946, 0x0f947, 0x0f948, 0x0f949, 0x0f94a,
+	0x0f94b, 0x0f94c, 0x0f94d, 0x0f94e, 0x0f94f, 0x0f950, 0x0f951, 0x0f952,
+	0x0f953, 0x0f954, 0x0f955, 0x0f956, 0x0f957, 0x0f958, 0x0f959, 0x0f95a,
+	0x0f95b, 0x0f95c, 0x0f95d, 0x0f95e, 0x0f95f, 0x0f960, 0x0f961, 0x0f962,
+	0x0f963, 0x0f964, 0x0f965, 0x0f966, 0x0f967, 0x0f968, 0x0f969, 0x0f96a,
+	0x0f96b, 0x0f96c, 0x0f96d, 0x0f96e, 0x0f96f, 0x0f970, 0x0f971, 0x0f972,
+	0x0f973, 0x0f974, 0x0f975, 0x0f976, 0x0f977, 0x0f978, 0x0f979, 0x0f97a,
+	0x0f97b, 0x0f97c, 0x0f97d, 0x0f97e, 0x0f97f, 0x0f980, 0x0f981, 0x0f982,
+	0x0f983, 0x0f984, 0x0f985, 0x0f986, 0x0f987, 0x0f988, 0x0f989, 0x0f98a,
+	0x0f98b, 0x0f98c, 0x0f98d, 0x0f98e, 0x0f98f, 0x0f990, 0x0f991, 0x0f992,
+	0x0f993, 0x0f994, 0x0f995, 0x0f996, 0x0f997, 0x0f998, 0x0f999, 0x0f99a,
+	0x0f99b, 0x0f99c, 0x0f99d, 0x0f99e, 0x0f99f, 0x0f9a0, 0x0f9a1, 0x0f9a2,
+	0x0f9a3, 0x0f9a4, 0x0f9a5, 0x0f9a6, 0x0f9a7, 0x0f9a8, 0x0f9a9, 0x0f9aa,
+	0x0f9ab, 0x0f9ac, 0x0f9ad, 0x0f9ae, 0x0f9af, 0x0f9b0, 0x0f9b1, 0x0f9b2,
+	0x0f9b3, 0x0f9b4, 0x0f9b5, 0x0f9b6, 0x0f9b7, 0x0f9b8, 0x0f9b9, 0x0f9ba,
+	0x0f9bb, 0x0f9bc, 0x0f9bd, 0x0f9be, 0x0f9bf, 0x0f9c0, 0x0f9c1, 0x0f9c2,
+	0x0f9c3, 0x0f9c4, 0x0f9c5, 0x0f9c6, 0x0f9c7, 0x0f9c8, 0x0f9c9, 0x0f9ca,
+	0x0f9cb, 0x0f9cc, 0x0f9cd, 0x0f9ce, 0x0f9cf, 0x0f9d0, 0x0f9d1, 0x0f9d2,
+	0x0f9d3, 0x0f9d4, 0x0f9d5, 0x0f9d6, 0x0f9d7, 0x0f9d8, 0x0f9d9, 0x0f9da,
+	0x0f9db, 0x0f9dc, 0x0f9dd, 0x0f9de, 0x0f9df, 0x0f9e0, 0x0f9e1, 0x0f9e2,
+	0x0f9e3, 0x0f9e4, 0x0f9e5, 0x0f9e6, 0x0f9e7, 0x0f9e8, 0x0f9e9, 0x0f9ea,
+	0x0f9eb, 0x0f9ec, 0x0f9ed, 0x0f9ee, 0x0f9ef, 0x0f9f0, 0x0f9f1, 0x0f9f2,
+	0x0f9f3, 0x0f9f4, 0x0f9f5, 0x0f9f6, 0x0f9f7, 0x0f9f8, 0x0f9f9, 0x0f9fa,
+	0x0f9fb, 0x0f9fc, 0x0f9fd, 0x0f9fe, 0x0f9ff, 0x0fa00, 0x0fa01, 0x0fa02,
+	0x0fa03, 0x0fa04, 0x0fa05, 0x0fa06, 0x0fa07, 0x0fa08, 0x0fa09, 0x0fa0a,
+	0x0fa0b, 0x0fa0c, 0x0fa0d, 0x0fa10, 0x0fa12, 0x0fa15, 0x0fa16, 0x0fa17,
+	0x0fa18, 0x0fa19, 0x0fa1a, 0x0fa1b, 0x0fa1c, 0x0fa1d, 0x0fa1e, 0x0fa20,
+	0x0fa22, 0x0fa25, 0x0fa26, 0x0fa2a, 0x0fa2b, 0x0fa2c, 0x0fa2d, 0x0fa2e,
+	0x0fa2f, 0x0fa30, 0x0fa31, 0x0fa32, 0x0fa33, 0x0fa34, 0x0fa35, 0x0fa36,
+	0x0fa37, 0x0fa38, 0x0fa39, 0x0fa3a, 0x0fa3b, 0x0fa3c, 0x0fa3d, 0x0fa3e,
+	0x0fa3f, 0x0fa40, 0x0fa41, 0x0fa42, 0x0fa43, 0x0fa44, 0x0fa45, 0x0fa46,
+	0x0fa47, 0x0fa48, 0x0fa49, 0x0fa4a, 0x0fa4b, 0x0fa4c, 0x0fa4d, 0x0fa4e,
+	0x0fa4f, 0x0fa50, 0x0fa51, 0x0fa52, 0x0fa53, 0x0fa54, 0x0fa55, 0x0fa56,
+	0x0fa57, 0x0fa58, 0x0fa59, 0x0fa5a, 0x0fa5b, 0x0fa5c, 0x0fa5d, 0x0fa5e,
+	0x0fa5f, 0x0fa60, 0x0fa61, 0x0fa62, 0x0fa63, 0x0fa64, 0x0fa65, 0x0fa66,
+	0x0fa67, 0x0fa68, 0x0fa69, 0x0fa6a, 0x0fa6b, 0x0fa6c, 0x0fa6d, 0x0fa70,
+	0x0fa71, 0x0fa72, 0x0fa73, 0x0fa74, 0x0fa75, 0x0fa76, 0x0fa77, 0x0fa78,
+	0x0fa79, 0x0fa7a, 0x0fa7b, 0x0fa7c, 0x0fa7d, 0x0fa7e, 0x0fa7f, 0x0fa80,
+	0x0fa81, 0x0fa82, 0x0fa83, 0x0fa84, 0x0fa85, 0x0fa86, 0x0fa87, 0x0fa88,
+	0x0fa89, 0x0fa8a, 0x0fa8b, 0x0fa8c, 0x0fa8d, 0x0fa8e, 0x0fa8f, 0x0fa90,
+	0x0fa91, 0x0fa92, 0x0fa93, 0x0fa94, 0x0fa95, 0x0fa96, 0x0fa97, 0x0fa98,
+	0x0fa99, 0x0fa9a, 0x0fa9b, 0x0fa9c, 0x0fa9d, 0x0fa9e, 0x0fa9f, 0x0faa0,
+	0x0faa1, 0x0faa2, 0x0faa3, 0x0faa4, 0x0faa5, 0x0faa6, 0x0faa7, 0x0faa8,
+	0x0faa9, 0x0faaa, 0x0faab, 0x0faac, 0x0faad, 0x0faae, 0x0faaf, 0x0fab0,
+	0x0fab1, 0x0fab2, 0x0fab3, 0x0fab4, 0x0fab5, 0x0fab6, 0x0fab7, 0x0fab8,
+	0x0fab9, 0x0faba, 0x0fabb, 0x0fabc, 0x0fabd, 0x0fabe, 0x0fabf, 0x0fac0,
+	0x0fac1, 0x0fac2, 0x0fac3, 0x0fac4, 0x0fac5, 0x0fac6, 0x0fac7, 0x0fac8,
+	0x0fac9, 0x0faca, 0x0facb, 0x0facc, 0x0facd, 0x0face, 0x0facf, 0x0fad0,
+	0x0fad1, 0x0fad2, 0x0fad3, 0x0fad4, 0x0fad5, 0x0fad6, 0x0fad7, 0x0fad8,
+	0x0fad9, 0x0fb00, 0x0fb01, 0x0fb02, 0x0fb03, 0x0fb04, 0x0fb05, 0x0fb06,
+	0x0fb13, 0x0fb14, 0x0fb15, 0x0fb16, 0x0fb17, 0x0fb1d, 0x0fb1f, 0x0fb20,
+	0x0fb21, 0x0fb22, 0x0fb23, 0x0fb24, 0x0fb25, 0x0fb26, 0x0fb27, 0x0fb28,
+	0x0fb29, 0x0fb2a, 0x0fb2b, 0x0fb2c, 0x0fb2d, 0x0fb2e, 0x0fb2f, 0x0fb30,
+	0x0fb31, 0x0fb32, 0x0fb33, 0x0fb34, 0x0fb35, 0x0fb36, 0x0fb38, 0x0fb39,
+	0x0fb3a, 0x0fb3b, 0x0fb3c, 0x0fb3e, 0x0fb40, 0x0fb41, 0x0fb43, 0x0fb44,
+	0x0fb46, 0x0fb47, 0x0fb48, 0x0fb49, 0x0fb4a, 0x0fb4b, 0x0fb4c, 0x0fb4d,
+	0x0fb4e, 0x0fb4f, 0x0fb50, 0x0fb51, 0x0fb52, 0x0fb53, 0x0fb54, 0x0fb55,
+	0x0fb56, 0x0fb57, 0x0fb58, 0x0fb59, 0x0fb5a, 0x0fb5b, 0x0fb5c, 0x0fb5d,
+	0x0fb5e, 0x0fb5f, 0x0fb60, 0x0fb61, 0x0fb62, 0x0fb63, 0x0fb64, 0x0fb65,
+	0x0fb66, 0x0fb67, 0x0fb68, 0x0fb69, 0x0fb6a, 0x0fb6b, 0x0fb6c, 0x0fb6d,
+	0x0fb6e, 0x0fb6f, 0x0fb70, 0x0fb71, 0x0fb72, 0x0fb73, 0x0fb74, 0x0fb75,
+	0x0fb76, 0x0fb77, 0x0fb78, 0x0fb79, 0x0fb7a, 0x0fb7b, 0x0fb7c, 0x0fb7d,
+	0x0fb7e, 0x0fb7f, 0x0fb80, 0x0fb81, 0x0fb82, 0x0fb83, 0x0fb84, 0x0fb85,
+	0x0fb86, 0x0fb87, 0x0fb88, 0x0fb89, 0x0fb8a, 0x0fb8b, 0x0fb8c, 0x0fb8d,
+	0x0fb8e, 0x0fb8f, 0x0fb90, 0x0fb91, 0x0fb92, 0x0fb93, 0x0fb94, 0x0fb95,
+	0x0fb96, 0x0fb97, 0x0fb98, 0x0fb99, 0x0fb9a, 0x0fb9b, 0x0fb9c, 0x0fb9d,
+	0x0fb9e, 0x0fb9f, 0x0fba0, 0x0fba1, 0x0fba2, 0x0fba3, 0x0fba4, 0x0fba5,
+	0x0fba6, 0x0fba7, 0x0fba8, 0x0fba9, 0x0fbaa, 0x0fbab, 0x0fbac, 0x0fbad,
+	0x0fbae, 0x0fbaf, 0x0fbb0, 0x0fbb1, 0x0fbd3, 0x0fbd4, 0x0fbd5, 0x0fbd6,
+	0x0fbd7, 0x0fbd8, 0x0fbd9, 0x0fbda, 0x0fbdb, 0x0fbdc, 0x0fbdd, 0x0fbde,
+	0x0fbdf, 0x0fbe0, 0x0fbe1, 0x0fbe2, 0x0fbe3, 0x0fbe4, 0x0fbe5, 0x0fbe6,
+	0x0fbe7, 0x0fbe8, 0x0fbe9, 0x0fbea, 0x0fbeb, 0x0fbec, 0x0fbed, 0x0fbee,
+	0x0fbef, 0x0fbf0, 0x0fbf1, 0x0fbf2, 0x0fbf3, 0x0fbf4, 0x0fbf5, 0x0fbf6,
+	0x0fbf7, 0x0fbf8, 0x0fbf9, 0x0fbfa, 0x0fbfb, 0x0fbfc, 0x0fbfd, 0x0fbfe,
+	0x0fbff, 0x0fc00, 0x0fc01, 0x0fc02, 0x0fc03, 0x0fc04, 0x0fc05, 0x0fc06,
+	0x0fc07, 0x0fc08, 0x0fc09, 0x0fc0a, 0x0fc0b, 0x0fc0c, 0x0fc0d, 0x0fc0e,
+	0x0fc0f, 0x0fc10, 0x0fc11, 0x0fc12, 0x0fc13, 0x0fc14, 0x0fc15, 0x0fc16,
+	0x0fc17, 0x0fc18, 0x0fc19, 0x0fc1a, 0x0fc1b, 0x0fc1c, 0x0fc1d, 0x0fc1e,
+	0x0fc1f, 0x0fc20, 0x0fc21, 0x0fc22, 0x0fc23, 0x0fc24, 0x0fc25, 0x0fc26,
+	0x0fc27, 0x0fc28, 0x0fc29, 0x0fc2a, 0x0fc2b, 0x0fc2c, 0x0fc2d, 0x0fc2e,
+	0x0fc2f, 0x0fc30, 0x0fc31, 0x0fc32, 0x0fc33, 0x0fc34, 0x0fc35, 0x0fc36,
+	0x0fc37, 0x0fc38, 0x0fc39, 0x0fc3a, 0x0fc3b, 0x0fc3c, 0x0fc3d, 0x0fc3e,
+	0x0fc3f, 0x0fc40, 0x0fc41, 0x0fc42, 0x0fc43, 0x0fc44, 0x0fc45, 0x0fc46,
+	0x0fc47, 0x0fc48, 0x0fc49, 0x0fc4a, 0x0fc4b, 0x0fc4c, 0x0fc4d, 0x0fc4e,
+	0x0fc4f, 0x0fc50, 0x0fc51, 0x0fc52, 0x0fc53, 0x0fc54, 0x0fc55, 0x0fc56,
+	0x0fc57, 0x0fc58, 0x0fc59, 0x0fc5a, 0x0fc5b, 0x0fc5c, 0x0fc5d, 0x0fc5e,
+	0x0fc5f, 0x0fc60, 0x0fc61, 0x0fc62, 0x0fc63, 0x0fc64, 0x0fc65, 0x0fc66,
+	0x0fc67, 0x0fc68, 0x0fc69, 0x0fc6a, 0x0fc6b, 0x0fc6c, 0x0fc6d, 0x0fc6e,
+	0x0fc6f, 0x0fc70, 0x0fc71, 0x0fc72, 0x0fc73, 0x0fc74, 0x0fc75, 0x0fc76,
+	0x0fc77, 0x0fc78, 0x0fc79, 0x0fc7a, 0x0fc7b, 0x0fc7c, 0x0fc7d, 0x0fc7e,
+	0x0fc7f, 0x0fc80, 0x0fc81, 0x0fc82, 0x0fc83, 0x0fc84, 0x0fc85, 0x0fc86,
+	0x0fc87, 0x0fc88, 0x0fc89, 0x0fc8a, 0x0fc8b, 0x0fc8c, 0x0fc8d, 0x0fc8e,
+	0x0fc8f, 0x0fc90, 0x0fc91, 0x0fc92, 0x0fc93, 0x0fc94, 0x0fc95, 0x0fc96,
+	0x0fc97, 0x0fc98, 0x0fc99, 0x0fc9a, 0x0fc9b, 0x0fc9c, 0x0fc9d, 0x0fc9e,
+	0x0fc9f, 0x0fca0, 0x0fca1, 0x0fca2, 0x0fca3, 0x0fca4, 0x0fca5, 0x0fca6,
+	0x0fca7, 0x0fca8, 0x0fca9, 0x0fcaa, 0x0fcab, 0x0fcac, 0x0fcad, 0x0fcae,
+	0x0fcaf, 0x0fcb0, 0x0fcb1, 0x0fcb2, 0x0fcb3, 0x0fcb4, 0x0fcb5, 0x0fcb6,
+	0x0fcb7, 0x0fcb8, 0x0fcb9, 0x0fcba, 0x0fcbb, 0x0fcbc, 0x0fcbd, 0x0fcbe,
+	0x0fcbf, 0x0fcc0, 0x0fcc1, 0x0fcc2, 0x0fcc3, 0x0fcc4, 0x0fcc5, 0x0fcc6,
+	0x0fcc7, 0x0fcc8, 0x0fcc9, 0x0fcca, 0x0fccb, 0x0fccc, 0x0fccd, 0x0fcce,
+	0x0fccf, 0x0fcd0, 0x0fcd1, 0x0fcd2, 0x0fcd3, 0x0fcd4, 0x0fcd5, 0x0fcd6,
+	0x0fcd7, 0x0fcd8, 0x0fcd9, 0x0fcda, 0x0fcdb, 0x0fcdc, 0x0fcdd, 0x0fcde,
+	0x0fcdf, 0x0fce0, 0x0fce1, 0x0fce2, 0x0fce3, 0x0fce4, 0x0fce5, 0x0fce6,
+	0x0fce7, 0x0fce8, 0x0fce9, 0x0fcea, 0x0fceb, 0x0fcec, 0x0fced, 0x0fcee,
+	0x0fcef, 0x0fcf0, 0x0fcf1, 0x0fcf2, 0x0fcf3, 0x0fcf4, 0x0fcf5, 0x0fcf6,
+	0x0fcf7, 0x0fcf8, 0x0fcf9, 0x0fcfa, 0x0fcfb, 0x0fcfc, 0x0fcfd, 0x0fcfe,
+	0x0fcff, 0x0fd00, 0x0fd01, 0x0fd02, 0x0fd03, 0x0fd04, 0x0fd05, 0x0fd06,
+	0x0fd07, 0x0fd08, 0x0fd09, 0x0fd0a, 0x0fd0b, 0x0fd0c, 0x0fd0d, 0x0fd0e,
+	0x0fd0f, 0x0fd10, 0x0fd11, 0x0fd12, 0x0fd13, 0x0fd14, 0x0fd15, 0x0fd16,
+	0x0fd17, 0x0fd18, 0x0fd19, 0x0fd1a, 0x0fd1b, 0x0fd1c, 0x0fd1d, 0x0fd1e,
+	0x0fd1f, 0x0fd20, 0x0fd21, 0x0fd22, 0x0fd23, 0x0fd24, 0x0fd25, 0x0fd26,
+	0x0fd27, 0x0fd28, 0x0fd29, 0x0fd2a, 0x0fd2b, 0x0fd2c, 0x0fd2d, 0x0fd2e,
+	0x0fd2f, 0x0fd30, 0x0fd31, 0x0fd32, 0x0fd33, 0x0fd34, 0x0fd35, 0x0fd36,
+	0x0fd37, 0x0fd38, 0x0fd39, 0x0fd3a, 0x0fd3b, 0x0fd3c, 0x0fd3d, 0x0fd50,
+	0x0fd51, 0x0fd52, 0x0fd53, 0x0fd54, 0x0fd55, 0x0fd56, 0x0fd57, 0x0fd58,
+	0x0fd59, 0x0fd5a, 0x0fd5b, 0x0fd5c, 0x0fd5d, 0x0fd5e, 0x0fd5f, 0x0fd60,
+	0x0fd61, 0x0fd62, 0x0fd63, 0x0fd64, 0x0fd65, 0x0fd66, 0x0fd67, 0x0fd68,
+	0x0fd69, 0x0fd6a, 0x0fd6b, 0x0fd6c, 0x0fd6d, 0x0fd6e, 0x0fd6f, 0x0fd70,
+	0x0fd71, 0x0fd72, 0x0fd73, 0x0fd74, 0x0fd75, 0x0fd76, 0x0fd77, 0x0fd78,
+	0x0fd79, 0x0fd7a, 0x0fd7b, 0x0fd7c, 0x0fd7d, 0x0fd7e, 0x0fd7f, 0x0fd80,
+	0x0fd81, 0x0fd82, 0x0fd83, 0x0fd84, 0x0fd85, 0x0fd86, 0x0fd87, 0x0fd88,
+	0x0fd89, 0x0fd8a, 0x0fd8b, 0x0fd8c, 0x0fd8d, 0x0fd8e, 0x0fd8f, 0x0fd92,
+	0x0fd93, 0x0fd94, 0x0fd95, 0x0fd96, 0x0fd97, 0x0fd98, 0x0fd99, 0x0fd9a,
+	0x0fd9b, 0x0fd9c, 0x0fd9d, 0x0fd9e, 0x0fd9f, 0x0fda0, 0x0fda1, 0x0fda2,
+	0x0fda3, 0x0fda4, 0x0fda5, 0x0fda6, 0x0fda7, 0x0fda8, 0x0fda9, 0x0fdaa,
+	0x0fdab, 0x0fdac, 0x0fdad, 0x0fdae, 0x0fdaf, 0x0fdb0, 0x0fdb1, 0x0fdb2,
+	0x0fdb3, 0x0fdb4, 0x0fdb5, 0x0fdb6, 0x0fdb7, 0x0fdb8, 0x0fdb9, 0x0fdba,
+	0x0fdbb, 0x0fdbc, 0x0fdbd, 0x0fdbe, 0x0fdbf, 0x0fdc0, 0x0fdc1, 0x0fdc2,
+	0x0fdc3, 0x0fdc4, 0x0fdc5, 0x0fdc6, 0x0fdc7, 0x0fdf0, 0x0fdf1, 0x0fdf2,
+	0x0fdf3, 0x0fdf4, 0x0fdf5, 0x0fdf6, 0x0fdf7, 0x0fdf8, 0x0fdf9, 0x0fdfa,
+	0x0fdfb, 0x0fdfc, 0x0fe10, 0x0fe11, 0x0fe12, 0x0fe13, 0x0fe14, 0x0fe15,
+	0x0fe16, 0x0fe17, 0x0fe18, 0x0fe19, 0x0fe30, 0x0fe31, 0x0fe32, 0x0fe33,
+	0x0fe34, 0x0fe35, 0x0fe36, 0x0fe37, 0x0fe38, 0x0fe39, 0x0fe3a, 0x0fe3b,
+	0x0fe3c, 0x0fe3d, 0x0fe3e, 0x0fe3f, 0x0fe40, 0x0fe41, 0x0fe42, 0x0fe43,
+	0x0fe44, 0x0fe47, 0x0fe48, 0x0fe49, 0x0fe4a, 0x0fe4b, 0x0fe4c, 0x0fe4d,
+	0x0fe4e, 0x0fe4f, 0x0fe50, 0x0fe51, 0x0fe52, 0x0fe54, 0x0fe55, 0x0fe56,
+	0x0fe57, 0x0fe58, 0x0fe59, 0x0fe5a, 0x0fe5b, 0x0fe5c, 0x0fe5d, 0x0fe5e,
+	0x0fe5f, 0x0fe60, 0x0fe61, 0x0fe62, 0x0fe63, 0x0fe64, 0x0fe65, 0x0fe66,
+	0x0fe68, 0x0fe69, 0x0fe6a, 0x0fe6b, 0x0fe70, 0x0fe71, 0x0fe72, 0x0fe74,
+	0x0fe76, 0x0fe77, 0x0fe78, 0x0fe79, 0x0fe7a, 0x0fe7b, 0x0fe7c, 0x0fe7d,
+	0x0fe7e, 0x0fe7f, 0x0fe80, 0x0fe81, 0x0fe82, 0x0fe83, 0x0fe84, 0x0fe85,
+	0x0fe86, 0x0fe87, 0x0fe88, 0x0fe89, 0x0fe8a, 0x0fe8b, 0x0fe8c, 0x0fe8d,
+	0x0fe8e, 0x0fe8f, 0x0fe90, 0x0fe91, 0x0fe92, 0x0fe93, 0x0fe94, 0x0fe95,
+	0x0fe96, 0x0fe97, 0x0fe98, 0x0fe99, 0x0fe9a, 0x0fe9b, 0x0fe9c, 0x0fe9d,
+	0x0fe9e, 0x0fe9f, 0x0fea0, 0x0fea1, 0x0fea2, 0x0fea3, 0x0fea4, 0x0fea5,
+	0x0fea6, 0x0fea7, 0x0fea8, 0x0fea9, 0x0feaa, 0x0feab, 0x0feac, 0x0fead,
+	0x0feae, 0x0feaf, 0x0feb0, 0x0feb1, 0x0feb2, 0x0feb3, 0x0feb4, 0x0feb5,
+	0x0feb6, 0x0feb7, 0x0feb8, 0x0feb9, 0x0feba, 0x0febb, 0x0febc, 0x0febd,
+	0x0febe, 0x0febf, 0x0fec0, 0x0fec1, 0x0fec2, 0x0fec3, 0x0fec4, 0x0fec5,
+	0x0fec6, 0x0fec7, 0x0fec8, 0x0fec9, 0x0feca, 0x0fecb, 0x0fecc, 0x0fecd,
+	0x0fece, 0x0fecf, 0x0fed0, 0x0fed1, 0x0fed2, 0x0fed3, 0x0fed4, 0x0fed5,
+	0x0fed6, 0x0fed7, 0x0fed8, 0x0fed9, 0x0feda, 0x0fedb, 0x0fedc, 0x0fedd,
+	0x0fede, 0x0fedf, 0x0fee0, 0x0fee1, 0x0fee2, 0x0fee3, 0x0fee4, 0x0fee5,
+	0x0fee6, 0x0fee7, 0x0fee8, 0x0fee9, 0x0feea, 0x0feeb, 0x0feec, 0x0feed,
+	0x0feee, 0x0feef, 0x0fef0, 0x0fef1, 0x0fef2, 0x0fef3, 0x0fef4, 0x0fef5,
+	0x0fef6, 0x0fef7, 0x0fef8, 0x0fef9, 0x0fefa, 0x0fefb, 0x0fefc, 0x0ff01,
+	0x0ff02, 0x0ff03, 0x0ff04, 0x0ff05, 0x0ff06, 0x0ff07, 0x0ff08, 0x0ff09,
+	0x0ff0a, 0x0ff0b, 0x0ff0c, 0x0ff0d, 0x0ff0e, 0x0ff0f, 0x0ff10, 0x0ff11,
+	0x0ff12, 0x0ff13, 0x0ff14, 0x0ff15, 0x0ff16, 0x0ff17, 0x0ff18, 0x0ff19,
+	0x0ff1a, 0x0ff1b, 0x0ff1c, 0x0ff1d, 0x0ff1e, 0x0ff1f, 0x0ff20, 0x0ff21,
+	0x0ff22, 0x0ff23, 0x0ff24, 0x0ff25, 0x0ff26, 0x0ff27, 0x0ff28, 0x0ff29,
+	0x0ff2a, 0x0ff2b, 0x0ff2c, 0x0ff2d, 0x0ff2e, 0x0ff2f, 0x0ff30, 0x0ff31,
+	0x0ff32, 0x0ff33, 0x0ff34, 0x0ff35, 0x0ff36, 0x0ff37, 0x0ff38, 0x0ff39,
+	0x0ff3a, 0x0ff3b, 0x0ff3c, 0x0ff3d, 0x0ff3e, 0x0ff3f, 0x0ff40, 0x0ff41,
+	0x0ff42, 0x0ff43, 0x0ff44, 0x0ff45, 0x0ff46, 0x0ff47, 0x0ff48, 0x0ff49,
+	0x0ff4a, 0x0ff4b, 0x0ff4c, 0x0ff4d, 0x0ff4e, 0x0ff4f, 0x0ff50, 0x0ff51,
+	0x0ff52, 0x0ff53, 0x0ff54, 0x0ff55, 0x0ff56, 0x0ff57, 0x0ff58, 0x0ff59,
+	0x0ff5a, 0x0ff5b, 0x0ff5c, 0x0ff5d, 0x0ff5e, 0x0ff5f, 0x0ff60, 0x0ff61,
+	0x0ff62, 0x0ff63, 0x0ff64, 0x0ff65, 0x0ff66, 0x0ff67, 0x0ff68, 0x0ff69,
+	0x0ff6a, 0x0ff6b, 0x0ff6c, 0x0ff6d, 0x0ff6e, 0x0ff6f, 0x0ff70, 0x0ff71,
+	0x0ff72, 0x0ff73, 0x0ff74, 0x0ff75, 0x0ff76, 0x0ff77, 0x0ff78, 0x0ff79,
+	0x0ff7a, 0x0ff7b, 0x0ff7c, 0x0ff7d, 0x0ff7e, 0x0ff7f, 0x0ff80, 0x0ff81,
+	0x0ff82, 0x0ff83, 0x0ff84, 0x0ff85, 0x0ff86, 0x0ff87, 0x0ff88, 0x0ff89,
+	0x0ff8a, 0x0ff8b, 0x0ff8c, 0x0ff8d, 0x0ff8e, 0x0ff8f, 0x0ff90, 0x0ff91,
+	0x0ff92, 0x0ff93, 0x0ff94, 0x0ff95, 0x0ff96, 0x0ff97, 0x0ff98, 0x0ff99,
+	0x0ff9a, 0x0ff9b, 0x0ff9c, 0x0ff9d, 0x0ff9e, 0x0ff9f, 0x0ffa0, 0x0ffa1,
+	0x0ffa2, 0x0ffa3, 0x0ffa4, 0x0ffa5, 0x0ffa6, 0x0ffa7, 0x0ffa8, 0x0ffa9,
+	0x0ffaa, 0x0ffab, 0x0ffac, 0x0ffad, 0x0ffae, 0x0ffaf, 0x0ffb0, 0x0ffb1,
+	0x0ffb2, 0x0ffb3, 0x0ffb4, 0x0ffb5, 0x0ffb6, 0x0ffb7, 0x0ffb8, 0x0ffb9,
+	0x0ffba, 0x0ffbb, 0x0ffbc, 0x0ffbd, 0x0ffbe, 0x0ffc2, 0x0ffc3, 0x0ffc4,
+	0x0ffc5, 0x0ffc6, 0x0ffc7, 0x0ffca, 0x0ffcb, 0x0ffcc, 0x0ffcd, 0x0ffce,
+	0x0ffcf, 0x0ffd2, 0x0ffd3, 0x0ffd4, 0x0ffd5, 0x0ffd6, 0x0ffd7, 0x0ffda,
+	0x0ffdb, 0x0ffdc, 0x0ffe0, 0x0ffe1, 0x0ffe2, 0x0ffe3, 0x0ffe4, 0x0ffe5,
+	0x0ffe6, 0x0ffe8, 0x0ffe9, 0x0ffea, 0x0ffeb, 0x0ffec, 0x0ffed, 0x0ffee,
+	0x10781, 0x10782, 0x10783, 0x10784, 0x10785, 0x10787, 0x10788, 0x10789,
+	0x1078a, 0x1078b, 0x1078c, 0x1078d, 0x1078e, 0x1078f, 0x10790, 0x10791,
+	0x10792, 0x10793, 0x10794, 0x10795, 0x10796, 0x10797, 0x10798, 0x10799,
+	0x1079a, 0x1079b, 0x1079c, 0x1079d, 0x1079e, 0x1079f, 0x107a0, 0x107a1,
+	0x107a2, 0x107a3, 0x107a4, 0x107a5, 0x107a6, 0x107a7, 0x107a8, 0x107a9,
+	0x107aa, 0x107ab, 0x107ac, 0x107ad, 0x107ae, 0x107af, 0x107b0, 0x107b2,
+	0x107b3, 0x107b4, 0x107b5, 0x107b6, 0x107b7, 0x107b8, 0x107b9, 0x107ba,
+	0x1109a, 0x1109c, 0x110ab, 0x1112e, 0x1112f, 0x1134b, 0x1134c, 0x114bb,
+	0x114bc, 0x114be, 0x115ba, 0x115bb, 0x11938, 0x1d15e, 0x1d15f, 0x1d160,
+	0x1d161, 0x1d162, 0x1d163, 0x1d164, 0x1d1bb, 0x1d1bc, 0x1d1bd, 0x1d1be,
+	0x1d1bf, 0x1d1c0, 0x1d400, 0x1d401, 0x1d402, 0x1d403, 0x1d404, 0x1d405,
+	0x1d406, 0x1d407, 0x1d408, 0x1d409, 0x1d40a, 0x1d40b, 0x1d40c, 0x1d40d,
+	0x1d40e, 0x1d40f, 0x1d410, 0x1d411, 0x1d412, 0x1d413, 0x1d414, 0x1d415,
+	0x1d416, 0x1d417, 0x1d418, 0x1d419, 0x1d41a, 0x1d41b, 0x1d41c, 0x1d41d,
+	0x1d41e, 0x1d41f, 0x1d420, 0x1d421, 0x1d422, 0x1d423, 0x1d424, 0x1d425,
+	0x1d426, 0x1d427, 0x1d428, 0x1d429, 0x1d42a, 0x1d42b, 0x1d42c, 0x1d42d,
+	0x1d42e, 0x1d42f, 0x1d430, 0x1d431, 0x1d432, 0x1d433, 0x1d434, 0x1d435,
+	0x1d436, 0x1d437, 0x1d438, 0x1d439, 0x1d43a, 0x1d43b, 0x1d43c, 0x1d43d,
+	0x1d43e, 0x1d43f, 0x1d440, 0x1d441, 0x1d442, 0x1d443, 0x1d444, 0x1d445,
+	0x1d446, 0x1d447, 0x1d448, 0x1d449, 0x1d44a, 0x1d44b, 0x1d44c, 0x1d44d,
+	0x1d44e, 0x1d44f, 0x1d450, 0x1d451, 0x1d452, 0x1d453, 0x1d454, 0x1d456,
+	0x1d457, 0x1d458, 0x1d459, 0x1d45a, 0x1d45b, 0x1d45c, 0x1d45d, 0x1d45e,
+	0x1d45f, 0x1d460, 0x1d461, 0x1d462, 0x1d463, 0x1d464, 0x1d465, 0x1d466,
+	0x1d467, 0x1d468, 0x1d469, 0x1d46a, 0x1d46b, 0x1d46c, 0x1d46d, 0x1d46e,
+	0x1d46f, 0x1d470, 0x1d471, 0x1d472, 0x1d473, 0x1d474, 0x1d475, 0x1d476,
+	0x1d477, 0x1d478, 0x1d479, 0x1d47a, 0x1d47b, 0x1d47c, 0x1d47d, 0x1d47e,
+	0x1d47f, 0x1d480, 0x1d481, 0x1d482, 0x1d483, 0x1d484, 0x1d485, 0x1d486,
+	0x1d487, 0x1d488, 0x1d489, 0x1d48a, 0x1d48b, 0x1d48c, 0x1d48d, 0x1d48e,
+	0x1d48f, 0x1d490, 0x1d491, 0x1d492, 0x1d493, 0x1d494, 0x1d495, 0x1d496,
+	0x1d497, 0x1d498, 0x1d499, 0x1d49a, 0x1d49b, 0x1d49c, 0x1d49e, 0x1d49f,
+	0x1d4a2, 0x1d4a5, 0x1d4a6, 0x1d4a9, 0x1d4aa, 0x1d4ab, 0x1d4ac, 0x1d4ae,
+	0x1d4af, 0x1d4b0, 0x1d4b1, 0x1d4b2, 0x1d4b3, 0x1d4b4, 0x1d4b5, 0x1d4b6,
+	0x1d4b7, 0x1d4b8, 0x1d4b9, 0x1d4bb, 0x1d4bd, 0x1d4be, 0x1d4bf, 0x1d4c0,
+	0x1d4c1, 0x1d4c2, 0x1d4c3, 0x1d4c5, 0x1d4c6, 0x1d4c7, 0x1d4c8, 0x1d4c9,
+	0x1d4ca, 0x1d4cb, 0x1d4cc, 0x1d4cd, 0x1d4ce, 0x1d4cf, 0x1d4d0, 0x1d4d1,
+	0x1d4d2, 0x1d4d3, 0x1d4d4, 0x1d4d5, 0x1d4d6, 0x1d4d7, 0x1d4d8, 0x1d4d9,
+	0x1d4da, 0x1d4db, 0x1d4dc, 0x1d4dd, 0x1d4de, 0x1d4df, 0x1d4e0, 0x1d4e1,
+	0x1d4e2, 0x1d4e3, 0x1d4e4, 0x1d4e5, 0x1d4e6, 0x1d4e7, 0x1d4e8, 0x1d4e9,
+	0x1d4ea, 0x1d4eb, 0x1d4ec, 0x1d4ed, 0x1d4ee, 0x1d4ef, 0x1d4f0, 0x1d4f1,
+	0x1d4f2, 0x1d4f3, 0x1d4f4, 0x1d4f5, 0x1d4f6, 0x1d4f7, 0x1d4f8, 0x1d4f9,
+	0x1d4fa, 0x1d4fb, 0x1d4fc, 0x1d4fd, 0x1d4fe, 0x1d4ff, 0x1d500, 0x1d501,
+	0x1d502, 0x1d503, 0x1d504, 0x1d505, 0x1d507, 0x1d508, 0x1d509, 0x1d50a,
+	0x1d50d, 0x1d50e, 0x1d50f, 0x1d510, 0x1d511, 0x1d512, 0x1d513, 0x1d514,
+	0x1d516, 0x1d517, 0x1d518, 0x1d519, 0x1d51a, 0x1d51b, 0x1d51c, 0x1d51e,
+	0x1d51f, 0x1d520, 0x1d521, 0x1d522, 0x1d523, 0x1d524, 0x1d525, 0x1d526,
+	0x1d527, 0x1d528, 0x1d529, 0x1d52a, 0x1d52b, 0x1d52c, 0x1d52d, 0x1d52e,
+	0x1d52f, 0x1d530, 0x1d531, 0x1d532, 0x1d533, 0x1d534, 0x1d535, 0x1d536,
+	0x1d537, 0x1d538, 0x1d539, 0x1d53b, 0x1d53c, 0x1d53d, 0x1d53e, 0x1d540,
+	0x1d541, 0x1d542, 0x1d543, 0x1d544, 0x1d546, 0x1d54a, 0x1d54b, 0x1d54c,
+	0x1d54d, 0x1d54e, 0x1d54f, 0x1d550, 0x1d552, 0x1d553, 0x1d554, 0x1d555,
+	0x1d556, 0x1d557, 0x1d558, 0x1d559, 0x1d55a, 0x1d55b, 0x1d55c, 0x1d55d,
+	0x1d55e, 0x1d55f, 0x1d560, 0x1d561, 0x1d562, 0x1d563, 0x1d564, 0x1d565,
+	0x1d566, 0x1d567, 0x1d568, 0x1d569, 0x1d56a, 0x1d56b, 0x1d56c, 0x1d56d,
+	0x1d56e, 0x1d56f, 0x1d570, 0x1d571, 0x1d572, 0x1d573, 0x1d574, 0x1d575,
+	0x1d576, 0x1d577, 0x1d578, 0x1d579, 0x1d57a, 0x1d57b, 0x1d57c, 0x1d57d,
+	0x1d57e, 0x1d57f, 0x1d580, 0x1d581, 0x1d582, 0x1d583, 0x1d584, 0x1d585,
+	0x1d586, 0x1d587, 0x1d588, 0x1d589, 0x1d58a, 0x1d58b, 0x1d58c, 0x1d58d,
+	0x1d58e, 0x1d58f, 0x1d590, 0x1d591, 0x1d592, 0x1d593, 0x1d594, 0x1d595,
+	0x1d596, 0x1d597, 0x1d598, 0x1d599, 0x1d59a, 0x1d59b, 0x1d59c, 0x1d59d,
+	0x1d59e, 0x1d59f, 0x1d5a0, 0x1d5a1, 0x1d5a2, 0x1d5a3, 0x1d5a4, 0x1d5a5,
+	0x1d5a6, 0x1d5a7, 0x1d5a8, 0x1d5a9, 0x1d5aa, 0x1d5ab, 0x1d5ac, 0x1d5ad,
+	0x1d5ae, 0x1d5af, 0x1d5b0, 0x1d5b1, 0x1d5b2, 0x1d5b3, 0x1d5b4, 0x1d5b5,
+	0x1d5b6, 0x1d5b7, 0x1d5b8, 0x1d5b9, 0x1d5ba, 0x1d5bb, 0x1d5bc, 0x1d5bd,
+	0x1d5be, 0x1d5bf, 0x1d5c0, 0x1d5c1, 0x1d5c2, 0x1d5c3, 0x1d5c4, 0x1d5c5,
+	0x1d5c6, 0x1d5c7, 0x1d5c8, 0x1d5c9, 0x1d5ca, 0x1d5cb, 0x1d5cc, 0x1d5cd,
+	0x1d5ce, 0x1d5cf, 0x1d5d0, 0x1d5d1, 0x1d5d2, 0x1d5d3, 0x1d5d4, 0x1d5d5,
+	0x1d5d6, 0x1d5d7, 0x1d5d8, 0x1d5d9, 0x1d5da, 0x1d5db, 0x1d5dc, 0x1d5dd,
+	0x1d5de, 0x1d5df, 0x1d5e0, 0x1d5e1, 0x1d5e2, 0x1d5e3, 0x1d5e4, 0x1d5e5,
+	0x1d5e6, 0x1d5e7, 0x1d5e8, 0x1d5e9, 0x1d5ea, 0x1d5eb, 0x1d5ec, 0x1d5ed,
+	0x1d5ee, 0x1d5ef, 0x1d5f0, 0x1d5f1, 0x1d5f2, 0x1d5f3, 0x1d5f4, 0x1d5f5,
+	0x1d5f6, 0x1d5f7, 0x1d5f8, 0x1d5f9, 0x1d5fa, 0x1d5fb, 0x1d5fc, 0x1d5fd,
+	0x1d5fe, 0x1d5ff, 0x1d600, 0x1d601, 0x1d602, 0x1d603, 0x1d604, 0x1d605,
+	0x1d606, 0x1d607, 0x1d608, 0x1d609, 0x1d60a, 0x1d60b, 0x1d60c, 0x1d60d,
+	0x1d60e, 0x1d60f, 0x1d610, 0x1d611, 0x1d612, 0x1d613, 0x1d614, 0x1d615,
+	0x1d616, 0x1d617, 0x1d618, 0x1d619, 0x1d61a, 0x1d61b, 0x1d61c, 0x1d61d,
+	0x1d61e, 0x1d61f, 0x1d620, 0x1d621, 0x1d622, 0x1d623, 0x1d624, 0x1d625,
+	0x1d626, 0x1d627, 0x1d628, 0x1d629, 0x1d62a, 0x1d62b, 0x1d62c, 0x1d62d,
+	0x1d62e, 0x1d62f, 0x1d630, 0x1d631, 0x1d632, 0x1d633, 0x1d634, 0x1d635,
+	0x1d636, 0x1d637, 0x1d638, 0x1d639, 0x1d63a, 0x1d63b, 0x1d63c, 0x1d63d,
+	0x1d63e, 0x1d63f, 0x1d640, 0x1d641, 0x1d642, 0x1d643, 0x1d644, 0x1d645,
+	0x1d646, 0x1d647, 0x1d648, 0x1d649, 0x1d64a, 0x1d64b, 0x1d64c, 0x1d64d,
+	0x1d64e, 0x1d64f, 0x1d650, 0x1d651, 0x1d652, 0x1d653, 0x1d654, 0x1d655,
+	0x1d656, 0x1d657, 0x1d658, 0x1d659, 0x1d65a, 0x1d65b, 0x1d65c, 0x1d65d,
+	0x1d65e, 0x1d65f, 0x1d660, 0x1d661, 0x1d662, 0x1d663, 0x1d664, 0x1d665,
+	0x1d666, 0x1d667, 0x1d668, 0x1d669, 0x1d66a, 0x1d66b, 0x1d66c, 0x1d66d,
+	0x1d66e, 0x1d66f, 0x1d670, 0x1d671, 0x1d672, 0x1d673, 0x1d674, 0x1d675,
+	0x1d676, 0x1d677, 0x1d678, 0x1d679, 0x1d67a, 0x1d67b, 0x1d67c, 0x1d67d,
+	0x1d67e, 0x1d67f, 0x1d680, 0x1d681, 0x1d682, 0x1d683, 0x1d684, 0x1d685,
+	0x1d686, 0x1d687, 0x1d688, 0x1d689, 0x1d68a, 0x1d68b, 0x1d68c, 0x1d68d,
+	0x1d68e, 0x1d68f, 0x1d690, 0x1d691, 0x1d692, 0x1d693, 0x1d694, 0x1d695,
+	0x1d696, 0x1d697, 0x1d698, 0x1d699, 0x1d69a, 0x1d69b, 0x1d69c, 0x1d69d,
+	0x1d69e, 0x1d69f, 0x1d6a0, 0x1d6a1, 0x1d6a2, 0x1d6a3, 0x1d6a4, 0x1d6a5,
+	0x1d6a8, 0x1d6a9, 0x1d6aa, 0x1d6ab, 0x1d6ac, 0x1d6ad, 0x1d6ae, 0x1d6af,
+	0x1d6b0, 0x1d6b1, 0x1d6b2, 0x1d6b3, 0x1d6b4, 0x1d6b5, 0x1d6b6, 0x1d6b7,
+	0x1d6b8, 0x1d6b9, 0x1d6ba, 0x1d6bb, 0x1d6bc, 0x1d6bd, 0x1d6be, 0x1d6bf,
+	0x1d6c0, 0x1d6c1, 0x1d6c2, 0x1d6c3, 0x1d6c4, 0x1d6c5, 0x1d6c6, 0x1d6c7,
+	0x1d6c8, 0x1d6c9, 0x1d6ca, 0x1d6cb, 0x1d6cc, 0x1d6cd, 0x1d6ce, 0x1d6cf,
+	0x1d6d0, 0x1d6d1, 0x1d6d2, 0x1d6d3, 0x1d6d4, 0x1d6d5, 0x1d6d6, 0x1d6d7,
+	0x1d6d8, 0x1d6d9, 0x1d6da, 0x1d6db, 0x1d6dc, 0x1d6dd, 0x1d6de, 0x1d6df,
+	0x1d6e0, 0x1d6e1, 0x1d6e2, 0x1d6e3, 0x1d6e4, 0x1d6e5, 0x1d6e6, 0x1d6e7,
+	0x1d6e8, 0x1d6e9, 0x1d6ea, 0x1d6eb, 0x1d6ec, 0x1d6ed, 0x1d6ee, 0x1d6ef,
+	0x1d6f0, 0x1d6f1, 0x1d6f2, 0x1d6f3, 0x1d6f4, 0x1d6f5, 0x1d6f6, 0x1d6f7,
+	0x1d6f8, 0x1d6f9, 0x1d6fa, 0x1d6fb, 0x1d6fc, 0x1d6fd, 0x1d6fe, 0x1d6ff,
+	0x1d700, 0x1d701, 0x1d702, 0x1d703, 0x1d704, 0x1d705, 0x1d706, 0x1d707,
+	0x1d708, 0x1d709, 0x1d70a, 0x1d70b, 0x1d70c, 0x1d70d, 0x1d70e, 0x1d70f,
+	0x1d710, 0x1d711, 0x1d712, 0x1d713, 0x1d714, 0x1d715, 0x1d716, 0x1d717,
+	0x1d718, 0x1d719, 0x1d71a, 0x1d71b, 0x1d71c, 0x1d71d, 0x1d71e, 0x1d71f,
+	0x1d720, 0x1d721, 0x1d722, 0x1d723, 0x1d724, 0x1d725, 0x1d726, 0x1d727,
+	0x1d728, 0x1d729, 0x1d72a, 0x1d72b, 0x1d72c, 0x1d72d, 0x1d72e, 0x1d72f,
+	0x1d730, 0x1d731, 0x1d732, 0x1d733, 0x1d734, 0x1d735, 0x1d736, 0x1d737,
+	0x1d738, 0x1d739, 0x1d73a, 0x1d73b, 0x1d73c, 0x1d73d, 0x1d73e, 0x1d73f,
+	0x1d740, 0x1d741, 0x1d742, 0x1d743, 0x1d744, 0x1d745, 0x1d746, 0x1d747,
+	0x1d748, 0x1d749, 0x1d74a, 0x1d74b, 0x1d74c, 0x1d74d, 0x1d74e, 0x1d74f,
+	0x1d750, 0x1d751, 0x1d752, 0x1d753, 0x1d754, 0x1d755, 0x1d756, 0x1d757,
+	0x1d758, 0x1d759, 0x1d75a, 0x1d75b, 0x1d75c, 0x1d75d, 0x1d75e, 0x1d75f,
+	0x1d760, 0x1d761, 0x1d762, 0x1d763, 0x1d764, 0x1d765, 0x1d766, 0x1d767,
+	0x1d768, 0x1d769, 0x1d76a, 0x1d76b, 0x1d76c, 0x1d76d, 0x1d76e, 0x1d76f,
+	0x1d770, 0x1d771, 0x1d772, 0x1d773, 0x1d774, 0x1d775, 0x1d776, 0x1d777,
+	0x1d778, 0x1d779, 0x1d77a, 0x1d77b, 0x1d77c, 0x1d77d, 0x1d77e, 0x1d77f,
+	0x1d780, 0x1d781, 0x1d782, 0x1d783, 0x1d784, 0x1d785, 0x1d786, 0x1d787,
+	0x1d788, 0x1d789, 0x1d78a, 0x1d78b, 0x1d78c, 0x1d78d, 0x1d78e, 0x1d78f,
+	0x1d790, 0x1d791, 0x1d792, 0x1d793, 0x1d794, 0x1d795, 0x1d796, 0x1d797,
+	0x1d798, 0x1d799, 0x1d79a, 0x1d79b, 0x1d79c, 0x1d79d, 0x1d79e, 0x1d79f,
+	0x1d7a0, 0x1d7a1, 0x1d7a2, 0x1d7a3, 0x1d7a4, 0x1d7a5, 0x1d7a6, 0x1d7a7,
+	0x1d7a8, 0x1d7a9, 0x1d7aa, 0x1d7ab, 0x1d7ac, 0x1d7ad, 0x1d7ae, 0x1d7af,
+	0x1d7b0, 0x1d7b1, 0x1d7b2, 0x1d7b3, 0x1d7b4, 0x1d7b5, 0x1d7b6, 0x1d7b7,
+	0x1d7b8, 0x1d7b9, 0x1d7ba, 0x1d7bb, 0x1d7bc, 0x1d7bd, 0x1d7be, 0x1d7bf,
+	0x1d7c0, 0x1d7c1, 0x1d7c2, 0x1d7c3, 0x1d7c4, 0x1d7c5, 0x1d7c6, 0x1d7c7,
+	0x1d7c8, 0x1d7c9, 0x1d7ca, 0x1d7cb, 0x1d7ce, 0x1d7cf, 0x1d7d0, 0x1d7d1,
+	0x1d7d2, 0x1d7d3, 0x1d7d4, 0x1d7d5, 0x1d7d6, 0x1d7d7, 0x1d7d8, 0x1d7d9,
+	0x1d7da, 0x1d7db, 0x1d7dc, 0x1d7dd, 0x1d7de, 0x1d7df, 0x1d7e0, 0x1d7e1,
+	0x1d7e2, 0x1d7e3, 0x1d7e4, 0x1d7e5, 0x1d7e6, 0x1d7e7, 0x1d7e8, 0x1d7e9,
+	0x1d7ea, 0x1d7eb, 0x1d7ec, 0x1d7ed, 0x1d7ee, 0x1d7ef, 0x1d7f0, 0x1d7f1,
+	0x1d7f2, 0x1d7f3, 0x1d7f4, 0x1d7f5, 0x1d7f6, 0x1d7f7, 0x1d7f8, 0x1d7f9,
+	0x1d7fa, 0x1d7fb, 0x1d7fc, 0x1d7fd, 0x1d7fe, 0x1d7ff, 0x1ee00, 0x1ee01,
+	0x1ee02, 0x1ee03, 0x1ee05, 0x1ee06, 0x1ee07, 0x1ee08, 0x1ee09, 0x1ee0a,
+	0x1ee0b, 0x1ee0c, 0x1ee0d, 0x1ee0e, 0x1ee0f, 0x1ee10, 0x1ee11, 0x1ee12,
+	0x1ee13, 0x1ee14, 0x1ee15, 0x1ee16, 0x1ee17, 0x1ee18, 0x1ee19, 0x1ee1a,
+	0x1ee1b, 0x1ee1c, 0x1ee1d, 0x1ee1e, 0x1ee1f, 0x1ee21, 0x1ee22, 0x1ee24,
+	0x1ee27, 0x1ee29, 0x1ee2a, 0x1ee2b, 0x1ee2c, 0x1ee2d, 0x1ee2e, 0x1ee2f,
+	0x1ee30, 0x1ee31, 0x1ee32, 0x1ee34, 0x1ee35, 0x1ee36, 0x1ee37, 0x1ee39,
+	0x1ee3b, 0x1ee42, 0x1ee47, 0x1ee49, 0x1ee4b, 0x1ee4d, 0x1ee4e, 0x1ee4f,
+	0x1ee51, 0x1ee52, 0x1ee54, 0x1ee57, 0x1ee59, 0x1ee5b, 0x1ee5d, 0x1ee5f,
+	0x1ee61, 0x1ee62, 0x1ee64, 0x1ee67, 0x1ee68, 0x1ee69, 0x1ee6a, 0x1ee6c,
+	0x1ee6d, 0x1ee6e, 0x1ee6f, 0x1ee70, 0x1ee71, 0x1ee72, 0x1ee74, 0x1ee75,
+	0x1ee76, 0x1ee77, 0x1ee79, 0x1ee7a, 0x1ee7b, 0x1ee7c, 0x1ee7e, 0x1ee80,
+	0x1ee81, 0x1ee82, 0x1ee83, 0x1ee84, 0x1ee85, 0x1ee86, 0x1ee87, 0x1ee88,
+	0x1ee89, 0x1ee8b, 0x1ee8c, 0x1ee8d, 0x1ee8e, 0x1ee8f, 0x1ee90, 0x1ee91,
+	0x1ee92, 0x1ee93, 0x1ee94, 0x1ee95, 0x1ee96, 0x1ee97, 0x1ee98, 0x1ee99,
+	0x1ee9a, 0x1ee9b, 0x1eea1, 0x1eea2, 0x1eea3, 0x1eea5, 0x1eea6, 0x1eea7,
+	0x1eea8, 0x1eea9, 0x1eeab, 0x1eeac, 0x1eead, 0x1eeae, 0x1eeaf, 0x1eeb0,
+	0x1eeb1, 0x1eeb2, 0x1eeb3, 0x1eeb4, 0x1eeb5, 0x1eeb6, 0x1eeb7, 0x1eeb8,
+	0x1eeb9, 0x1eeba, 0x1eebb, 0x1f100, 0x1f101, 0x1f102, 0x1f103, 0x1f104,
+	0x1f105, 0x1f106, 0x1f107, 0x1f108, 0x1f109, 0x1f10a, 0x1f110, 0x1f111,
+	0x1f112, 0x1f113, 0x1f114, 0x1f115, 0x1f116, 0x1f117, 0x1f118, 0x1f119,
+	0x1f11a, 0x1f11b, 0x1f11c, 0x1f11d, 0x1f11e, 0x1f11f, 0x1f120, 0x1f121,
+	0x1f122, 0x1f123, 0x1f124, 0x1f125, 0x1f126, 0x1f127, 0x1f128, 0x1f129,
+	0x1f12a, 0x1f12b, 0x1f12c, 0x1f12d, 0x1f12e, 0x1f130, 0x1f131, 0x1f132,
+	0x1f133, 0x1f134, 0x1f135, 0x1f136, 0x1f137, 0x1f138, 0x1f139, 0x1f13a,
+	0x1f13b, 0x1f13c, 0x1f13d, 0x1f13e, 0x1f13f, 0x1f140, 0x1f141, 0x1f142,
+	0x1f143, 0x1f144, 0x1f145, 0x1f146, 0x1f147, 0x1f148, 0x1f149, 0x1f14a,
+	0x1f14b, 0x1f14c, 0x1f14d, 0x1f14e, 0x1f14f, 0x1f16a, 0x1f16b, 0x1f16c,
+	0x1f190, 0x1f200, 0x1f201, 0x1f202, 0x1f210, 0x1f211, 0x1f212, 0x1f213,
+	0x1f214, 0x1f215, 0x1f216, 0x1f217, 0x1f218, 0x1f219, 0x1f21a, 0x1f21b,
+	0x1f21c, 0x1f21d, 0x1f21e, 0x1f21f, 0x1f220, 0x1f221, 0x1f222, 0x1f223,
+	0x1f224, 0x1f225, 0x1f226, 0x1f227, 0x1f228, 0x1f229, 0x1f22a, 0x1f22b,
+	0x1f22c, 0x1f22d, 0x1f22e, 0x1f22f, 0x1f230, 0x1f231, 0x1f232, 0x1f233,
+	0x1f234, 0x1f235, 0x1f236, 0x1f237, 0x1f238, 0x1f239, 0x1f23a, 0x1f23b,
+	0x1f240, 0x1f241, 0x1f242, 0x1f243, 0x1f244, 0x1f245, 0x1f246, 0x1f247,
+	0x1f248, 0x1f250, 0x1f251, 0x1fbf0, 0x1fbf1, 0x1fbf2, 0x1fbf3, 0x1fbf4,
+	0x1fbf5, 0x1fbf6, 0x1fbf7, 0x1fbf8, 0x1fbf9, 0x2f800, 0x2f801, 0x2f802,
+	0x2f803, 0x2f804, 0x2f805, 0x2f806, 0x2f807, 0x2f808, 0x2f809, 0x2f80a,
+	0x2f80b, 0x2f80c, 0x2f80d, 0x2f80e, 0x2f80f, 0x2f810, 0x2f811, 0x2f812,
+	0x2f813, 0x2f814, 0x2f815, 0x2f816, 0x2f817, 0x2f818, 0x2f819, 0x2f81a,
+	0x2f81b, 0x2f81c, 0x2f81d, 0x2f81e, 0x2f81f, 0x2f820, 0x2f821, 0x2f822,
+	0x2f823, 0x2f824, 0x2f825, 0x2f826, 0x2f827, 0x2f828, 0x2f829, 0x2f82a,
+	0x2f82b, 0x2f82c, 0x2f82d, 0x2f82e, 0x2f82f, 0x2f830, 0x2f831, 0x2f832,
+	0x2f833, 0x2f834, 0x2f835, 0x2f836, 0x2f837, 0x2f838, 0x2f839, 0x2f83a,
+	0x2f83b, 0x2f83c, 0x2f83d, 0x2f83e, 0x2f83f, 0x2f840, 0x2f841, 0x2f842,
+	0x2f843, 0x2f844, 0x2f845, 0x2f846, 0x2f847, 0x2f848, 0x2f849, 0x2f84a,
+	0x2f84b, 0x2f84c, 0x2f84d, 0x2f84e, 0x2f84f, 0x2f850, 0x2f851, 0x2f852,
+	0x2f853, 0x2f854, 0x2f855, 0x2f856, 0x2f857, 0x2f858, 0x2f859, 0x2f85a,
+	0x2f85b, 0x2f85c, 0x2f85d, 0x2f85e, 0x2f85f, 0x2f860, 0x2f861, 0x2f862,
+	0x2f863, 0x2f864, 0x2f865, 0x2f866, 0x2f867, 0x2f868, 0x2f869, 0x2f86a,
+	0x2f86b, 0x2f86c, 0x2f86d, 0x2f86e, 0x2f86f, 0x2f870, 0x2f871, 0x2f872,
+	0x2f873, 0x2f874, 0x2f875, 0x2f876, 0x2f877, 0x2f878, 0x2f879, 0x2f87a,
+	0x2f87b, 0x2f87c, 0x2f87d, 0x2f87e, 0x2f87f, 0x2f880, 0x2f881, 0x2f882,
+	0x2f883, 0x2f884, 0x2f885, 0x2f886, 0x2f887, 0x2f888, 0x2f889, 0x2f88a,
+	0x2f88b, 0x2f88c, 0x2f88d, 0x2f88e, 0x2f88f, 0x2f890, 0x2f891, 0x2f892,
+	0x2f893, 0x2f894, 0x2f895, 0x2f896, 0x2f897, 0x2f898, 0x2f899, 0x2f89a,
+	0x2f89b, 0x2f89c, 0x2f89d, 0x2f89e, 0x2f89f, 0x2f8a0, 0x2f8a1, 0x2f8a2,
+	0x2f8a3, 0x2f8a4, 0x2f8a5, 0x2f8a6, 0x2f8a7, 0x2f8a8, 0x2f8a9, 0x2f8aa,
+	0x2f8ab, 0x2f8ac, 0x2f8ad, 0x2f8ae, 0x2f8af, 0x2f8b0, 0x2f8b1, 0x2f8b2,
+	0x2f8b3, 0x2f8b4, 0x2f8b5, 0x2f8b6, 0x2f8b7, 0x2f8b8, 0x2f8b9, 0x2f8ba,
+	0x2f8bb, 0x2f8bc, 0x2f8bd, 0x2f8be, 0x2f8bf, 0x2f8c0, 0x2f8c1, 0x2f8c2,
+	0x2f8c3, 0x2f8c4, 0x2f8c5, 0x2f8c6, 0x2f8c7, 0x2f8c8, 0x2f8c9, 0x2f8ca,
+	0x2f8cb, 0x2f8cc, 0x2f8cd, 0x2f8ce, 0x2f8cf, 0x2f8d0, 0x2f8d1, 0x2f8d2,
+	0x2f8d3, 0x2f8d4, 0x2f8d5, 0x2f8d6, 0x2f8d7, 0x2f8d8, 0x2f8d9, 0x2f8da,
+	0x2f8db, 0x2f8dc, 0x2f8dd, 0x2f8de, 0x2f8df, 0x2f8e0, 0x2f8e1, 0x2f8e2,
+	0x2f8e3, 0x2f8e4, 0x2f8e5, 0x2f8e6, 0x2f8e7, 0x2f8e8, 0x2f8e9, 0x2f8ea,
+	0x2f8eb, 0x2f8ec, 0x2f8ed, 0x2f8ee, 0x2f8ef, 0x2f8f0, 0x2f8f1, 0x2f8f2,
+	0x2f8f3, 0x2f8f4, 0x2f8f5, 0x2f8f6, 0x2f8f7, 0x2f8f8, 0x2f8f9, 0x2f8fa,
+	0x2f8fb, 0x2f8fc, 0x2f8fd, 0x2f8fe, 0x2f8ff, 0x2f900, 0x2f901, 0x2f902,
+	0x2f903, 0x2f904, 0x2f905, 0x2f906, 0x2f907, 0x2f908, 0x2f909, 0x2f90a,
+	0x2f90b, 0x2f90c, 0x2f90d, 0x2f90e, 0x2f90f, 0x2f910, 0x2f911, 0x2f912,
+	0x2f913, 0x2f914, 0x2f915, 0x2f916, 0x2f917, 0x2f918, 0x2f919, 0x2f91a,
+	0x2f91b, 0x2f91c, 0x2f91d, 0x2f91e, 0x2f91f, 0x2f920, 0x2f921, 0x2f922,
+	0x2f923, 0x2f924, 0x2f925, 0x2f926, 0x2f927, 0x2f928, 0x2f929, 0x2f92a,
+	0x2f92b, 0x2f92c, 0x2f92d, 0x2f92e, 0x2f92f, 0x2f930, 0x2f931, 0x2f932,
+	0x2f933, 0x2f934, 0x2f935, 0x2f936, 0x2f937, 0x2f938, 0x2f939, 0x2f93a,
+	0x2f93b, 0x2f93c, 0x2f93d, 0x2f93e, 0x2f93f, 0x2f940, 0x2f941, 0x2f942,
+	0x2f943, 0x2f944, 0x2f945, 0x2f946, 0x2f947, 0x2f948, 0x2f949, 0x2f94a,
+	0x2f94b, 0x2f94c, 0x2f94d, 0x2f94e, 0x2f94f, 0x2f950, 0x2f951, 0x2f952,
+	0x2f953, 0x2f954, 0x2f955, 0x2f956, 0x2f957, 0x2f958, 0x2f959, 0x2f95a,
+	0x2f95b, 0x2f95c, 0x2f95d, 0x2f95e, 0x2f95f, 0x2f960, 0x2f961, 0x2f962,
+	0x2f963, 0x2f964, 0x2f965, 0x2f966, 0x2f967, 0x2f968, 0x2f969, 0x2f96a,
+	0x2f96b, 0x2f96c, 0x2f96d, 0x2f96e, 0x2f96f, 0x2f970, 0x2f971, 0x2f972,
+	0x2f973, 0x2f974, 0x2f975, 0x2f976, 0x2f977, 0x2f978, 0x2f979, 0x2f97a,
+	0x2f97b, 0x2f97c, 0x2f97d, 0x2f97e, 0x2f97f, 0x2f980, 0x2f981, 0x2f982,
+	0x2f983, 0x2f984, 0x2f985, 0x2f986, 0x2f987, 0x2f988, 0x2f989, 0x2f98a,
+	0x2f98b, 0x2f98c, 0x2f98d, 0x2f98e, 0x2f98f, 0x2f990, 0x2f991, 0x2f992,
+	0x2f993, 0x2f994, 0x2f995, 0x2f996, 0x2f997, 0x2f998, 0x2f999, 0x2f99a,
+	0x2f99b, 0x2f99c, 0x2f99d, 0x2f99e, 0x2f99f, 0x2f9a0, 0x2f9a1, 0x2f9a2,
+	0x2f9a3, 0x2f9a4, 0x2f9a5, 0x2f9a6, 0x2f9a7, 0x2f9a8, 0x2f9a9, 0x2f9aa,
+	0x2f9ab, 0x2f9ac, 0x2f9ad, 0x2f9ae, 0x2f9af, 0x2f9b0, 0x2f9b1, 0x2f9b2,
+	0x2f9b3, 0x2f9b4, 0x2f9b5, 0x2f9b6, 0x2f9b7, 0x2f9b8, 0x2f9b9, 0x2f9ba,
+	0x2f9bb, 0x2f9bc, 0x2f9bd, 0x2f9be, 0x2f9bf, 0x2f9c0, 0x2f9c1, 0x2f9c2,
+	0x2f9c3, 0x2f9c4, 0x2f9c5, 0x2f9c6, 0x2f9c7, 0x2f9c8, 0x2f9c9, 0x2f9ca,
+	0x2f9cb, 0x2f9cc, 0x2f9cd, 0x2f9ce, 0x2f9cf, 0x2f9d0, 0x2f9d1, 0x2f9d2,
+	0x2f9d3, 0x2f9d4, 0x2f9d5, 0x2f9d6, 0x2f9d7, 0x2f9d8, 0x2f9d9, 0x2f9da,
+	0x2f9db, 0x2f9dc, 0x2f9dd, 0x2f9de, 0x2f9df, 0x2f9e0, 0x2f9e1, 0x2f9e2,
+	0x2f9e3, 0x2f9e4, 0x2f9e5, 0x2f9e6, 0x2f9e7, 0x2f9e8, 0x2f9e9, 0x2f9ea,
+	0x2f9eb, 0x2f9ec, 0x2f9ed, 0x2f9ee, 0x2f9ef, 0x2f9f0, 0x2f9f1, 0x2f9f2,
+	0x2f9f3, 0x2f9f4, 0x2f9f5, 0x2f9f6, 0x2f9f7, 0x2f9f8, 0x2f9f9, 0x2f9fa,
+	0x2f9fb, 0x2f9fc, 0x2f9fd, 0x2f9fe, 0x2f9ff, 0x2fa00, 0x2fa01, 0x2fa02,
+	0x2fa03, 0x2fa04, 0x2fa05, 0x2fa06, 0x2fa07, 0x2fa08, 0x2fa09, 0x2fa0a,
+	0x2fa0b, 0x2fa0c, 0x2fa0d, 0x2fa0e, 0x2fa0f, 0x2fa10, 0x2fa11, 0x2fa12,
+	0x2fa13, 0x2fa14, 0x2fa15, 0x2fa16, 0x2fa17, 0x2fa18, 0x2fa19, 0x2fa1a,
+	0x2fa1b, 0x2fa1c, 0x2fa1d
+};
+
+/*
+ * The full decomposition of nfkd_cps[i], already in canonical order, is
+ * the UTF-8 in nfkd_utf8[nfkd_offsets[i] .. nfkd_offsets[i + 1] - 1].
+ */
+static const uint16_t nfkd_offsets[5796] = {
+	    0,     1,     4,     5,     8,     9,    10,    13,    15,    18,
+	   19,    20,    25,    30,    35,    38,    41,    44,    47,    50,
+	   53,    56,    59,    62,    65,    68,    71,    74,    77,    80,
+	   83,    86,    89,    92,    95,    98,   101,   104,   107,   110,
+	  113,   116,   119,   122,   125,   128,   131,   134,   137,   140,
+	  143,   146,   149,   152,   155,   158,   161,   164,   167,   170,
+	  173,   176,   179,   182,   185,   188,   191,   194,   197,   200,
+	  203,   206,   209,   212,   215,   218,   221,   224,   227,   230,
+	  233,   236,   239,   242,   245,   248,   251,   254,   257,   260,
+	  263,   266,   269,   272,   275,   278,   281,   284,   287,   290,
+	  293,   296,   299,   302,   305,   308,   311,   314,   317,   320,
+	  323,   326,   329,   331,   333,   336,   339,   342,   345,   348,
+	  351,   354,   357,   360,   363,   366,   369,   372,   375,   378,
+	  381,   384,   387,   390,   393,   396,   399,   402,   405,   408,
+	  411,   414,   417,   420,   423,   426,   429,   432,   435,   438,
+	  441,   444,   447,   450,   453,   456,   459,   462,   465,   468,
+	  471,   474,   477,   480,   483,   486,   489,   492,   495,   498,
+	  501,   504,   507,   510,   513,   516,   519,   522,   525,   528,
+	  531,   532,   535,   538,   541,   544,   548,   552,   556,   558,
+	  560,   562,   564,   566,   568,   571,   574,   577,   580,   583,
+	  586,   589,   592,   597,   602,   607,   612,   617,   622,   627,
+	  632,   637,   642,   647,   652,   656,   660,   663,   666,   669,
+	  672,   675,   678,   683,   688,   692,   696,   699,   701,   703,
+	  705,   708,   711,   714,   717,   722,   727,   731,   735,   739,
+	  743,   746,   749,   752,   755,   758,   761,   764,   767,   770,
+	  773,   776,   779,   782,   785,   788,   791,   794,   797,   800,
+	  803,   806,   809,   812,   815,   818,   821,   824,   827,   830,
+	  833,   836,   839,   842,   845,   850,   855,   860,   865,   868,
+	  871,   876,   881,   884,   887,   888,   890,   891,   892,   894,
+	  896,   898,   899,   900,   903,   906,   909,   912,   915,   918,
+	  920,   921,   922,   923,   925,   927,   929,   931,   935,   937,
+	  940,   941,   944,   949,   953,   955,   959,   963,   967,   971,
+	  975,   979,   985,   989,   993,   997,  1001,  1005,  1009,  1015,
+	 1019,  1023,  1027,  1031,  1035,  1037,  1039,  1041,  1045,  1049,
+	 1051,  1053,  1055,  1057,  1059,  1061,  1063,  1065,  1069,  1073,
+	 1077,  1081,  1085,  1089,  1093,  1097,  1101,  1105,  1109,  1113,
+	 1117,  1121,  1125,  1129,  1133,  1137,  1141,  1145,  1149,  1153,
+	 1157,  1161,  1165,  1169,  1173,  1177,  1181,  1185,  1189,  1193,
+	 1197,  1201,  1205,  1209,  1213,  1217,  1221,  1225,  1229,  1233,
+	 1237,  1241,  1245,  1249,  1253,  1257,  1261,  1265,  1269,  1273,
+	 1277,  1281,  1285,  1289,  1293,  1297,  1301,  1305,  1309,  1313,
+	 1317,  1321,  1325,  1331,  1337,  1343,  1349,  1355,  1361,  1367,
+	 1373,  1379,  1385,  1391,  1397,  1403,  1409,  1415,  1421,  1427,
+	 1433,  1439,  1445,  1451,  1457,  1463,  1469,  1475,  1481,  1487,
+	 1493,  1499,  1505,  1511,  1517,  1523,  1529,  1535,  1541,  1550,
+	 1556,  1562,  1568,  1574,  1580,  1589,  1595,  1601,  1607,  1613,
+	 1619,  1622,  1628,  1634,  1640,  1646,  1652,  1658,  1664,  1670,
+	 1676,  1685,  1691,  1700,  1706,  1712,  1718,  1724,  1730,  1736,
+	 1742,  1748,  1751,  1757,  1763,  1769,  1775,  1781,  1787,  1793,
+	 1799,  1805,  1811,  1817,  1818,  1820,  1821,  1822,  1823,  1825,
+	 1826,  1827,  1828,  1829,  1830,  1831,  1832,  1833,  1834,  1836,
+	 1837,  1838,  1839,  1840,  1841,  1842,  1844,  1846,  1849,  1850,
+	 1851,  1852,  1854,  1856,  1858,  1859,  1860,  1861,  1863,  1864,
+	 1866,  1869,  1872,  1873,  1874,  1875,  1878,  1880,  1881,  1884,
+	 1886,  1888,  1890,  1892,  1894,  1895,  1896,  1897,  1898,  1900,
+	 1902,  1904,  1906,  1908,  1910,  1912,  1913,  1915,  1917,  1919,
+	 1920,  1922,  1924,  1926,  1928,  1930,  1932,  1935,  1937,  1939,
+	 1942,  1944,  1946,  1948,  1950,  1952,  1954,  1956,  1958,  1960,
+	 1962,  1964,  1966,  1968,  1971,  1973,  1975,  1976,  1978,  1980,
+	 1982,  1984,  1987,  1990,  1993,  1996,  1999,  2002,  2005,  2008,
+	 2013,  2018,  2021,  2024,  2027,  2030,  2033,  2036,  2039,  2042,
+	 2045,  2048,  2053,  2058,  2063,  2068,  2071,  2074,  2077,  2080,
+	 2085,  2090,  2093,  2096,  2099,  2102,  2105,  2108,  2111,  2114,
+	 2117,  2120,  2123,  2126,  2129,  2132,  2135,  2138,  2143,  2148,
+	 2151,  2154,  2157,  2160,  2163,  2166,  2169,  2172,  2177,  2182,
+	 2185,  2188,  2191,  2194,  2197,  2200,  2203,  2206,  2209,  2212,
+	 2215,  2218,  2221,  2224,  2227,  2230,  2233,  2236,  2241,  2246,
+	 2251,  2256,  2261,  2266,  2271,  2276,  2279,  2282,  2285,  2288,
+	 2291,  2294,  2297,  2300,  2305,  2310,  2313,  2316,  2319,  2322,
+	 2325,  2328,  2333,  2338,  2343,  2348,  2353,  2358,  2361,  2364,
+	 2367,  2370,  2373,  2376,  2379,  2382,  2385,  2388,  2391,  2394,
+	 2397,  2400,  2405,  2410,  2415,  2420,  2423,  2426,  2429,  2432,
+	 2435,  2438,  2441,  2444,  2447,  2450,  2453,  2456,  2459,  2462,
+	 2465,  2468,  2471,  2474,  2477,  2480,  2483,  2486,  2489,  2492,
+	 2495,  2498,  2501,  2504,  2507,  2510,  2513,  2516,  2519,  2522,
+	 2525,  2528,  2533,  2538,  2543,  2548,  2553,  2558,  2563,  2568,
+	 2573,  2578,  2583,  2588,  2593,  2598,  2603,  2608,  2613,  2618,
+	 2623,  2628,  2631,  2634,  2637,  2640,  2643,  2646,  2651,  2656,
+	 2661,  2666,  2671,  2676,  2681,  2686,  2691,  2696,  2699,  2702,
+	 2705,  2708,  2711,  2714,  2717,  2720,  2725,  2730,  2735,  2740,
+	 2745,  2750,  2755,  2760,  2765,  2770,  2775,  2780,  2785,  2790,
+	 2795,  2800,  2805,  2810,  2815,  2820,  2823,  2826,  2829,  2832,
+	 2837,  2842,  2847,  2852,  2857,  2862,  2867,  2872,  2877,  2882,
+	 2885,  2888,  2891,  2894,  2897,  2900,  2903,  2906,  2910,  2914,
+	 2920,  2926,  2932,  2938,  2944,  2950,  2954,  2958,  2964,  2970,
+	 2976,  2982,  2988,  2994,  2998,  3002,  3008,  3014,  3020,  3026,
+	 3030,  3034,  3040,  3046,  3052,  3058,  3062,  3066,  3072,  3078,
+	 3084,  3090,  3096,  3102,  3106,  3110,  3116,  3122,  3128,  3134,
+	 3140,  3146,  3150,  3154,  3160,  3166,  3172,  3178,  3184,  3190,
+	 3194,  3198,  3204,  3210,  3216,  3222,  3228,  3234,  3238,  3242,
+	 3248,  3254,  3260,  3266,  3270,  3274,  3280,  3286,  3292,  3298,
+	 3302,  3306,  3312,  3318,  3324,  3330,  3336,  3342,  3346,  3352,
+	 3358,  3364,  3368,  3372,  3378,  3384,  3390,  3396,  3402,  3408,
+	 3412,  3416,  3422,  3428,  3434,  3440,  3446,  3452,  3456,  3460,
+	 3464,  3468,  3472,  3476,  3480,  3484,  3488,  3492,  3496,  3500,
+	 3504,  3508,  3514,  3520,  3528,  3536,  3544,  3552,  3560,  3568,
+	 3574,  3580,  3588,  3596,  3604,  3612,  3620,  3628,  3634,  3640,
+	 3648,  3656,  3664,  3672,  3680,  3688,  3694,  3700,  3708,  3716,
+	 3724,  3732,  3740,  3748,  3754,  3760,  3768,  3776,  3784,  3792,
+	 3800,  3808,  3814,  3820,  3828,  3836,  3844,  3852,  3860,  3868,
+	 3872,  3876,  3882,  3886,  3892,  3896,  3902,  3906,  3910,  3914,
+	 3918,  3922,  3925,  3927,  3930,  3933,  3938,  3944,  3948,  3954,
+	 3958,  3964,  3968,  3972,  3976,  3980,  3984,  3989,  3994,  3999,
+	 4003,  4007,  4013,  4019,  4023,  4029,  4033,  4037,  4041,  4045,
+	 4050,  4055,  4060,  4064,  4068,  4074,  4080,  4084,  4088,  4092,
+	 4098,  4102,  4106,  4110,  4114,  4118,  4123,  4128,  4129,  4135,
+	 4139,  4145,  4149,  4155,  4159,  4163,  4167,  4171,  4175,  4178,
+	 4181,  4182,  4183,  4184,  4185,  4186,  4187,  4188,  4189,  4190,
+	 4191,  4192,  4195,  4198,  4199,  4201,  4204,  4205,  4211,  4220,
+	 4226,  4235,  4237,  4240,  4242,  4244,  4246,  4258,  4259,  4260,
+	 4261,  4262,  4263,  4264,  4265,  4266,  4267,  4268,  4271,  4272,
+	 4273,  4274,  4275,  4276,  4277,  4278,  4279,  4280,  4281,  4282,
+	 4283,  4284,  4285,  4286,  4289,  4290,  4291,  4292,  4293,  4294,
+	 4295,  4296,  4298,  4299,  4300,  4301,  4302,  4303,  4304,  4305,
+	 4306,  4308,  4311,  4314,  4315,  4318,  4321,  4324,  4326,  4329,
+	 4330,  4331,  4332,  4333,  4334,  4336,  4337,  4338,  4339,  4340,
+	 4341,  4343,  4344,  4345,  4346,  4347,  4348,  4350,  4353,  4355,
+	 4356,  4358,  4359,  4360,  4363,  4364,  4365,  4366,  4367,  4368,
+	 4369,  4370,  4372,  4374,  4376,  4378,  4379,  4382,  4384,  4386,
+	 4388,  4390,  4393,  4394,  4395,  4396,  4397,  4398,  4403,  4408,
+	 4414,  4419,  4424,  4429,  4434,  4439,  4444,  4449,  4454,  4459,
+	 4464,  4469,  4474,  4478,  4479,  4481,  4484,  4486,  4487,  4489,
+	 4492,  4496,  4498,  4499,  4501,  4504,  4505,  4506,  4507,  4508,
+	 4509,  4511,  4514,  4516,  4517,  4519,  4522,  4526,  4528,  4529,
+	 4531,  4534,  4535,  4536,  4537,  4538,  4543,  4548,  4553,  4558,
+	 4563,  4568,  4573,  4578,  4583,  4588,  4593,  4598,  4604,  4613,
+	 4619,  4628,  4633,  4638,  4643,  4648,  4651,  4656,  4661,  4664,
+	 4667,  4672,  4677,  4682,  4687,  4692,  4697,  4702,  4707,  4712,
+	 4717,  4722,  4727,  4732,  4737,  4742,  4747,  4752,  4757,  4762,
+	 4767,  4772,  4777,  4782,  4787,  4790,  4793,  4794,  4795,  4796,
+	 4797,  4798,  4799,  4800,  4801,  4802,  4804,  4806,  4808,  4810,
+	 4812,  4814,  4816,  4818,  4820,  4822,  4824,  4827,  4830,  4833,
+	 4836,  4839,  4842,  4845,  4848,  4851,  4855,  4859,  4863,  4867,
+	 4871,  4875,  4879,  4883,  4887,  4891,  4895,  4897,  4899,  4901,
+	 4903,  4905,  4907,  4909,  4911,  4913,  4916,  4919,  4922,  4925,
+	 4928,  4931,  4934,  4937,  4940,  4943,  4946,  4949,  4952,  4955,
+	 4958,  4961,  4964,  4967,  4970,  4973,  4976,  4979,  4982,  4985,
+	 4988,  4991,  4994,  4997,  5000,  5003,  5006,  5009,  5012,  5015,
+	 5018,  5021,  5024,  5025,  5026,  5027,  5028,  5029,  5030,  5031,
+	 5032,  5033,  5034,  5035,  5036,  5037,  5038,  5039,  5040,  5041,
+	 5042,  5043,  5044,  5045,  5046,  5047,  5048,  5049,  5050,  5051,
+	 5052,  5053,  5054,  5055,  5056,  5057,  5058,  5059,  5060,  5061,
+	 5062,  5063,  5064,  5065,  5066,  5067,  5068,  5069,  5070,  5071,
+	 5072,  5073,  5074,  5075,  5076,  5077,  5089,  5092,  5094,  5097,
+	 5102,  5103,  5104,  5107,  5110,  5113,  5116,  5119,  5122,  5125,
+	 5128,  5131,  5134,  5137,  5140,  5143,  5146,  5149,  5152,  5155,
+	 5158,  5161,  5164,  5167,  5170,  5173,  5176,  5179,  5182,  5185,
+	 5188,  5191,  5194,  5197,  5200,  5203,  5206,  5209,  5212,  5215,
+	 5218,  5221,  5224,  5227,  5230,  5233,  5236,  5239,  5242,  5245,
+	 5248,  5251,  5254,  5257,  5260,  5263,  5266,  5269,  5272,  5275,
+	 5278,  5281,  5284,  5287,  5290,  5293,  5296,  5299,  5302,  5305,
+	 5308,  5311,  5314,  5317,  5320,  5323,  5326,  5329,  5332,  5335,
+	 5338,  5341,  5344,  5347,  5350,  5353,  5356,  5359,  5362,  5365,
+	 5368,  5371,  5374,  5377,  5380,  5383,  5386,  5389,  5392,  5395,
+	 5398,  5401,  5404,  5407,  5410,  5413,  5416,  5419,  5422,  5425,
+	 5428,  5431,  5434,  5437,  5440,  5443,  5446,  5449,  5452,  5455,
+	 5458,  5461,  5464,  5467,  5470,  5473,  5476,  5479,  5482,  5485,
+	 5488,  5491,  5494,  5497,  5500,  5503,  5506,  5509,  5512,  5515,
+	 5518,  5521,  5524,  5527,  5530,  5533,  5536,  5539,  5542,  5545,
+	 5548,  5551,  5554,  5557,  5560,  5563,  5566,  5569,  5572,  5575,
+	 5578,  5581,  5584,  5587,  5590,  5593,  5596,  5599,  5602,  5605,
+	 5608,  5611,  5614,  5617,  5620,  5623,  5626,  5629,  5632,  5635,
+	 5638,  5641,  5644,  5647,  5650,  5653,  5656,  5659,  5662,  5665,
+	 5668,  5671,  5674,  5677,  5680,  5683,  5686,  5689,  5692,  5695,
+	 5698,  5701,  5704,  5707,  5710,  5713,  5716,  5719,  5722,  5725,
+	 5728,  5731,  5734,  5737,  5740,  5743,  5746,  5749,  5752,  5755,
+	 5756,  5759,  5762,  5765,  5768,  5774,  5780,  5786,  5792,  5798,
+	 5804,  5810,  5816,  5822,  5828,  5834,  5840,  5846,  5852,  5858,
+	 5864,  5870,  5876,  5882,  5888,  5894,  5900,  5906,  5912,  5918,
+	 5924,  5928,  5932,  5938,  5944,  5950,  5956,  5962,  5968,  5974,
+	 5980,  5986,  5992,  5998,  6004,  6010,  6016,  6022,  6028,  6034,
+	 6040,  6046,  6052,  6058,  6064,  6070,  6076,  6082,  6088,  6094,
+	 6100,  6106,  6112,  6118,  6124,  6130,  6136,  6139,  6142,  6145,
+	 6148,  6151,  6154,  6157,  6160,  6163,  6166,  6169,  6172,  6175,
+	 6178,  6181,  6184,  6187,  6190,  6193,  6196,  6199,  6202,  6205,
+	 6208,  6211,  6214,  6217,  6220,  6223,  6226,  6229,  6232,  6235,
+	 6238,  6241,  6244,  6247,  6250,  6253,  6256,  6259,  6262,  6265,
+	 6268,  6271,  6274,  6277,  6280,  6283,  6286,  6289,  6292,  6295,
+	 6298,  6301,  6304,  6307,  6310,  6313,  6316,  6319,  6322,  6325,
+	 6328,  6331,  6334,  6337,  6340,  6343,  6346,  6349,  6352,  6355,
+	 6358,  6361,  6364,  6367,  6370,  6373,  6376,  6379,  6382,  6385,
+	 6388,  6391,  6394,  6397,  6400,  6403,  6406,  6409,  6412,  6415,
+	 6418,  6421,  6424,  6427,  6430,  6433,  6436,  6439,  6442,  6445,
+	 6448,  6451,  6454,  6457,  6460,  6465,  6470,  6475,  6480,  6485,
+	 6490,  6495,  6500,  6505,  6510,  6515,  6520,  6525,  6530,  6538,
+	 6546,  6554,  6562,  6570,  6578,  6586,  6594,  6602,  6610,  6618,
+	 6626,  6634,  6642,  6650,  6667,  6681,  6686,  6691,  6696,  6701,
+	 6706,  6711,  6716,  6721,  6726,  6731,  6736,  6741,  6746,  6751,
+	 6756,  6761,  6766,  6771,  6776,  6781,  6786,  6791,  6796,  6801,
+	 6806,  6811,  6816,  6821,  6826,  6831,  6836,  6841,  6846,  6851,
+	 6856,  6861,  6864,  6867,  6870,  6873,  6876,  6878,  6880,  6882,
+	 6884,  6886,  6888,  6890,  6892,  6894,  6896,  6898,  6900,  6902,
+	 6904,  6906,  6909,  6912,  6915,  6918,  6921,  6924,  6927,  6930,
+	 6933,  6936,  6939,  6942,  6945,  6948,  6954,  6960,  6966,  6972,
+	 6978,  6984,  6990,  6996,  7002,  7008,  7014,  7020,  7026,  7032,
+	 7047,  7059,  7065,  7068,  7071,  7074,  7077,  7080,  7083,  7086,
+	 7089,  7092,  7095,  7098,  7101,  7104,  7107,  7110,  7113,  7116,
+	 7119,  7122,  7125,  7128,  7131,  7134,  7137,  7140,  7143,  7146,
+	 7149,  7152,  7155,  7158,  7161,  7164,  7167,  7170,  7173,  7176,
+	 7179,  7182,  7185,  7188,  7191,  7194,  7197,  7200,  7203,  7206,
+	 7209,  7212,  7214,  7216,  7218,  7220,  7222,  7224,  7226,  7228,
+	 7230,  7232,  7234,  7236,  7238,  7240,  7242,  7246,  7250,  7254,
+	 7258,  7262,  7266,  7270,  7274,  7278,  7283,  7288,  7293,  7295,
+	 7298,  7300,  7303,  7306,  7309,  7312,  7315,  7318,  7321,  7324,
+	 7327,  7330,  7333,  7336,  7339,  7342,  7345,  7348,  7351,  7354,
+	 7357,  7360,  7363,  7366,  7369,  7372,  7375,  7378,  7381,  7384,
+	 7387,  7390,  7393,  7396,  7399,  7402,  7405,  7408,  7411,  7414,
+	 7417,  7420,  7423,  7426,  7429,  7432,  7435,  7438,  7441,  7444,
+	 7450,  7465,  7477,  7492,  7501,  7516,  7525,  7534,  7552,  7564,
+	 7573,  7582,  7591,  7603,  7615,  7627,  7639,  7651,  7663,  7675,
+	 7693,  7699,  7717,  7735,  7750,  7762,  7780,  7798,  7810,  7819,
+	 7828,  7840,  7852,  7867,  7882,  7891,  7900,  7912,  7921,  7930,
+	 7936,  7942,  7951,  7960,  7978,  7990,  8005,  8023,  8035,  8044,
+	 8053,  8071,  8083,  8101,  8110,  8125,  8134,  8146,  8155,  8167,
+	 8182,  8194,  8209,  8221,  8227,  8242,  8251,  8260,  8272,  8281,
+	 8290,  8299,  8314,  8326,  8332,  8350,  8359,  8374,  8386,  8398,
+	 8407,  8416,  8428,  8434,  8446,  8461,  8467,  8485,  8494,  8498,
+	 8502,  8506,  8510,  8514,  8518,  8522,  8526,  8530,  8534,  8539,
+	 8544,  8549,  8554,  8559,  8564,  8569,  8574,  8579,  8584,  8589,
+	 8594,  8599,  8604,  8609,  8612,  8614,  8616,  8619,  8621,  8623,
+	 8625,  8628,  8631,  8633,  8639,  8645,  8651,  8657,  8669,  8671,
+	 8673,  8676,  8678,  8680,  8682,  8684,  8686,  8689,  8693,  8695,
+	 8697,  8700,  8703,  8705,  8707,  8709,  8712,  8715,  8718,  8721,
+	 8724,  8726,  8728,  8730,  8732,  8734,  8737,  8739,  8741,  8743,
+	 8746,  8749,  8751,  8754,  8757,  8760,  8762,  8765,  8770,  8776,
+	 8778,  8781,  8784,  8787,  8790,  8797,  8805,  8807,  8809,  8812,
+	 8814,  8816,  8818,  8821,  8823,  8825,  8827,  8829,  8831,  8834,
+	 8836,  8838,  8840,  8843,  8846,  8850,  8852,  8854,  8856,  8862,
+	 8865,  8867,  8869,  8871,  8873,  8875,  8877,  8879,  8881,  8883,
+	 8885,  8888,  8890,  8892,  8895,  8898,  8900,  8904,  8907,  8909,
+	 8911,  8913,  8915,  8920,  8925,  8929,  8933,  8937,  8941,  8945,
+	 8949,  8953,  8957,  8961,  8966,  8971,  8976,  8981,  8986,  8991,
+	 8996,  9001,  9006,  9011,  9016,  9021,  9026,  9031,  9036,  9041,
+	 9046,  9051,  9056,  9061,  9066,  9071,  9074,  9076,  9078,  9081,
+	 9082,  9083,  9084,  9086,  9088,  9091,  9094,  9096,  9099,  9101,
+	 9104,  9107,  9110,  9113,  9116,  9119,  9122,  9125,  9128,  9131,
+	 9134,  9137,  9140,  9143,  9146,  9149,  9152,  9155,  9158,  9161,
+	 9164,  9167,  9170,  9173,  9176,  9179,  9182,  9185,  9188,  9191,
+	 9194,  9197,  9200,  9203,  9206,  9209,  9212,  9215,  9218,  9221,
+	 9224,  9227,  9230,  9233,  9236,  9239,  9242,  9245,  9248,  9251,
+	 9254,  9257,  9260,  9263,  9266,  9269,  9272,  9275,  9278,  9281,
+	 9284,  9287,  9290,  9293,  9296,  9299,  9302,  9305,  9308,  9311,
+	 9314,  9317,  9320,  9323,  9326,  9329,  9332,  9335,  9338,  9341,
+	 9344,  9347,  9350,  9353,  9356,  9359,  9362,  9365,  9368,  9371,
+	 9374,  9377,  9380,  9383,  9386,  9389,  9392,  9395,  9398,  9401,
+	 9404,  9407,  9410,  9413,  9416,  9419,  9422,  9425,  9428,  9431,
+	 9434,  9437,  9440,  9443,  9446,  9449,  9452,  9455,  9458,  9461,
+	 9464,  9467,  9470,  9473,  9476,  9479,  9482,  9485,  9488,  9491,
+	 9494,  9497,  9500,  9503,  9506,  9509,  9512,  9515,  9518,  9521,
+	 9524,  9527,  9530,  9533,  9536,  9539,  9542,  9545,  9548,  9551,
+	 9554,  9557,  9560,  9563,  9566,  9569,  9572,  9575,  9578,  9581,
+	 9584,  9587,  9590,  9593,  9596,  9599,  9602,  9605,  9608,  9611,
+	 9614,  9617,  9620,  9623,  9626,  9629,  9632,  9635,  9638,  9641,
+	 9644,  9647,  9650,  9653,  9656,  9659,  9662,  9665,  9668,  9671,
+	 9674,  9677,  9680,  9683,  9686,  9689,  9692,  9695,  9698,  9701,
+	 9704,  9707,  9710,  9713,  9716,  9719,  9722,  9725,  9728,  9731,
+	 9734,  9737,  9740,  9743,  9746,  9749,  9752,  9755,  9758,  9761,
+	 9764,  9767,  9770,  9773,  9776,  9779,  9782,  9785,  9788,  9791,
+	 9794,  9797,  9800,  9803,  9806,  9809,  9812,  9815,  9818,  9821,
+	 9824,  9827,  9830,  9833,  9836,  9839,  9842,  9845,  9848,  9851,
+	 9854,  9857,  9860,  9863,  9866,  9869,  9872,  9875,  9878,  9881,
+	 9884,  9887,  9890,  9893,  9896,  9899,  9902,  9905,  9908,  9911,
+	 9914,  9917,  9920,  9923,  9926,  9929,  9932,  9935,  9938,  9941,
+	 9944,  9947,  9950,  9953,  9956,  9959,  9962,  9965,  9968,  9971,
+	 9974,  9977,  9980,  9983,  9986,  9989,  9992,  9995,  9998, 10001,
+	10004, 10007, 10010, 10013, 10016, 10019, 10022, 10025, 10028, 10031,
+	10034, 10037, 10040, 10043, 10046, 10049, 10052, 10055, 10058, 10061,
+	10064, 10067, 10070, 10073, 10076, 10079, 10082, 10085, 10088, 10091,
+	10094, 10097, 10100, 10103, 10106, 10109, 10112, 10115, 10118, 10121,
+	10124, 10127, 10130, 10133, 10136, 10139, 10142, 10145, 10148, 10151,
+	10154, 10157, 10161, 10164, 10167, 10170, 10173, 10176, 10179, 10182,
+	10185, 10188, 10191, 10194, 10197, 10200, 10203, 10206, 10209, 10212,
+	10215, 10218, 10221, 10224, 10227, 10230, 10233, 10236, 10239, 10242,
+	10245, 10248, 10251, 10254, 10257, 10260, 10263, 10266, 10269, 10272,
+	10275, 10278, 10281, 10284, 10287, 10290, 10293, 10296, 10299, 10302,
+	10305, 10308, 10311, 10314, 10317, 10320, 10323, 10326, 10329, 10332,
+	10335, 10338, 10341, 10344, 10347, 10350, 10353, 10356, 10359, 10362,
+	10365, 10368, 10371, 10374, 10377, 10380, 10383, 10386, 10389, 10392,
+	10395, 10398, 10401, 10404, 10407, 10410, 10413, 10416, 10419, 10422,
+	10425, 10428, 10431, 10434, 10437, 10440, 10443, 10446, 10449, 10453,
+	10457, 10461, 10464, 10467, 10470, 10474, 10478, 10482, 10485, 10488,
+	10490, 10492, 10494, 10497, 10500, 10502, 10504, 10508, 10512, 10516,
+	10520, 10524, 10528, 10532, 10534, 10536, 10538, 10540, 10542, 10544,
+	10546, 10548, 10550, 10551, 10555, 10559, 10565, 10571, 10575, 10579,
+	10583, 10587, 10591, 10595, 10599, 10603, 10607, 10611, 10615, 10619,
+	10623, 10627, 10631, 10635, 10639, 10643, 10647, 10651, 10655, 10659,
+	10663, 10667, 10671, 10675, 10679, 10683, 10687, 10689, 10691, 10693,
+	10695, 10697, 10699, 10701, 10703, 10705, 10707, 10709, 10711, 10713,
+	10715, 10717, 10719, 10721, 10723, 10725, 10727, 10729, 10731, 10733,
+	10735, 10737, 10739, 10741, 10743, 10745, 10747, 10749, 10751, 10753,
+	10755, 10757, 10759, 10761, 10763, 10765, 10767, 10769, 10771, 10773,
+	10775, 10777, 10779, 10781, 10783, 10785, 10787, 10789, 10791, 10793,
+	10795, 10797, 10799, 10801, 10803, 10805, 10807, 10809, 10811, 10813,
+	10815, 10817, 10819, 10821, 10823, 10825, 10827, 10829, 10831, 10833,
+	10835, 10837, 10839, 10841, 10843, 10845, 10847, 10849, 10851, 10853,
+	10855, 10859, 10863, 10865, 10867, 10869, 10871, 10873, 10875, 10877,
+	10879, 10881, 10883, 10887, 10891, 10893, 10895, 10897, 10899, 10901,
+	10903, 10905, 10907, 10909, 10911, 10915, 10917, 10919, 10921, 10923,
+	10925, 10927, 10929, 10931, 10933, 10935, 10937, 10939, 10945, 10951,
+	10957, 10963, 10969, 10975, 10981, 10987, 10993, 10999, 11005, 11011,
+	11017, 11023, 11029, 11035, 11041, 11047, 11049, 11051, 11053, 11055,
+	11061, 11067, 11073, 11079, 11085, 11089, 11093, 11097, 11101, 11105,
+	11109, 11113, 11117, 11121, 11125, 11129, 11133, 11137, 11141, 11145,
+	11149, 11153, 11157, 11161, 11165, 11169, 11173, 11177, 11181, 11185,
+	11189, 11193, 11197, 11201, 11205, 11209, 11213, 11217, 11221, 11225,
+	11229, 11233, 11237, 11241, 11245, 11249, 11253, 11257, 11261, 11265,
+	11269, 11273, 11277, 11281, 11285, 11289, 11293, 11297, 11301, 11305,
+	11309, 11313, 11317, 11321, 11325, 11329, 11333, 11337, 11341, 11345,
+	11349, 11353, 11357, 11361, 11365, 11369, 11373, 11377, 11381, 11385,
+	11389, 11393, 11397, 11401, 11405, 11409, 11413, 11417, 11421, 11425,
+	11429, 11433, 11437, 11441, 11446, 11451, 11456, 11461, 11466, 11471,
+	11477, 11483, 11489, 11495, 11501, 11507, 11511, 11515, 11519, 11523,
+	11527, 11531, 11535, 11539, 11543, 11547, 11551, 11555, 11559, 11563,
+	11567, 11571, 11575, 11579, 11583, 11587, 11591, 11595, 11599, 11603,
+	11607, 11611, 11615, 11619, 11623, 11627, 11631, 11635, 11639, 11643,
+	11647, 11651, 11655, 11659, 11663, 11667, 11671, 11675, 11679, 11683,
+	11687, 11693, 11699, 11705, 11711, 11717, 11721, 11725, 11729, 11733,
+	11737, 11741, 11745, 11749, 11753, 11757, 11761, 11765, 11769, 11773,
+	11777, 11781, 11785, 11789, 11793, 11797, 11801, 11805, 11809, 11813,
+	11817, 11821, 11825, 11829, 11833, 11837, 11841, 11845, 11849, 11853,
+	11857, 11861, 11865, 11869, 11873, 11877, 11881, 11885, 11889, 11893,
+	11897, 11901, 11905, 11909, 11913, 11917, 11921, 11925, 11929, 11933,
+	11937, 11941, 11945, 11949, 11953, 11957, 11961, 11965, 11969, 11973,
+	11977, 11981, 11985, 11991, 11997, 12001, 12005, 12009, 12013, 12017,
+	12021, 12025, 12029, 12033, 12037, 12041, 12045, 12049, 12053, 12057,
+	12061, 12065, 12071, 12077, 12083, 12087, 12091, 12095, 12099, 12103,
+	12107, 12111, 12115, 12119, 12123, 12127, 12131, 12135, 12139, 12143,
+	12147, 12151, 12155, 12159, 12163, 12167, 12171, 12175, 12179, 12183,
+	12187, 12191, 12195, 12199, 12203, 12207, 12211, 12215, 12219, 12223,
+	12227, 12231, 12235, 12239, 12243, 12247, 12251, 12255, 12259, 12263,
+	12267, 12271, 12275, 12279, 12283, 12287, 12291, 12295, 12299, 12303,
+	12307, 12311, 12315, 12319, 12323, 12327, 12331, 12335, 12339, 12343,
+	12347, 12351, 12355, 12359, 12363, 12367, 12371, 12375, 12381, 12387,
+	12393, 12399, 12405, 12411, 12417, 12423, 12429, 12435, 12441, 12447,
+	12453, 12459, 12465, 12471, 12477, 12483, 12489, 12495, 12501, 12507,
+	12513, 12519, 12525, 12531, 12537, 12543, 12549, 12555, 12561, 12567,
+	12573, 12579, 12585, 12591, 12597, 12603, 12609, 12615, 12621, 12627,
+	12633, 12639, 12645, 12651, 12657, 12663, 12669, 12675, 12681, 12687,
+	12693, 12699, 12705, 12711, 12717, 12723, 12729, 12735, 12741, 12747,
+	12753, 12759, 12765, 12771, 12777, 12783, 12789, 12795, 12801, 12807,
+	12813, 12819, 12825, 12831, 12837, 12843, 12849, 12855, 12861, 12867,
+	12873, 12879, 12885, 12891, 12897, 12903, 12909, 12915, 12921, 12927,
+	12933, 12939, 12945, 12951, 12957, 12963, 12969, 12975, 12981, 12987,
+	12993, 12999, 13005, 13011, 13017, 13023, 13029, 13035, 13041, 13047,
+	13053, 13059, 13065, 13071, 13077, 13083, 13089, 13095, 13103, 13111,
+	13119, 13127, 13135, 13143, 13151, 13157, 13190, 13205, 13213, 13214,
+	13217, 13220, 13221, 13222, 13223, 13224, 13227, 13230, 13233, 13235,
+	13238, 13241, 13242, 13243, 13244, 13245, 13246, 13247, 13250, 13253,
+	13256, 13259, 13262, 13265, 13268, 13271, 13274, 13277, 13280, 13283,
+	13284, 13285, 13288, 13291, 13294, 13297, 13298, 13299, 13300, 13301,
+	13304, 13305, 13306, 13307, 13308, 13309, 13312, 13313, 13314, 13315,
+	13316, 13319, 13322, 13323, 13324, 13325, 13326, 13327, 13328, 13329,
+	13330, 13331, 13332, 13333, 13334, 13337, 13341, 13344, 13347, 13350,
+	13354, 13357, 13361, 13364, 13368, 13371, 13375, 13378, 13382, 13384,
+	13388, 13392, 13396, 13400, 13404, 13408, 13412, 13416, 13420, 13424,
+	13428, 13432, 13434, 13436, 13438, 13440, 13442, 13444, 13446, 13448,
+	13450, 13452, 13454, 13456, 13458, 13460, 13462, 13464, 13466, 13468,
+	13470, 13472, 13474, 13476, 13478, 13480, 13482, 13484, 13486, 13488,
+	13490, 13492, 13494, 13496, 13498, 13500, 13502, 13504, 13506, 13508,
+	13510, 13512, 13514, 13516, 13518, 13520, 13522, 13524, 13526, 13528,
+	13530, 13532, 13534, 13536, 13538, 13540, 13542, 13544, 13546, 13548,
+	13550, 13552, 13554, 13556, 13558, 13560, 13562, 13564, 13566, 13568,
+	13570, 13572, 13574, 13576, 13578, 13580, 13582, 13584, 13586, 13588,
+	13590, 13592, 13594, 13596, 13598, 13600, 13602, 13604, 13606, 13608,
+	13610, 13612, 13614, 13616, 13618, 13620, 13622, 13624, 13626, 13628,
+	13630, 13632, 13634, 13636, 13638, 13640, 13646, 13652, 13658, 13664,
+	13670, 13676, 13680, 13684, 13685, 13686, 13687, 13688, 13689, 13690,
+	13691, 13692, 13693, 13694, 13695, 13696, 13697, 13698, 13699, 13700,
+	13701, 13702, 13703, 13704, 13705, 13706, 13707, 13708, 13709, 13710,
+	13711, 13712, 13713, 13714, 13715, 13716, 13717, 13718, 13719, 13720,
+	13721, 13722, 13723, 13724, 13725, 13726, 13727, 13728, 13729, 13730,
+	13731, 13732, 13733, 13734, 13735, 13736, 13737, 13738, 13739, 13740,
+	13741, 13742, 13743, 13744, 13745, 13746, 13747, 13748, 13749, 13750,
+	13751, 13752, 13753, 13754, 13755, 13756, 13757, 13758, 13759, 13760,
+	13761, 13762, 13763, 13764, 13765, 13766, 13767, 13768, 13769, 13770,
+	13771, 13772, 13773, 13774, 13775, 13776, 13777, 13778, 13781, 13784,
+	13787, 13790, 13793, 13796, 13799, 13802, 13805, 13808, 13811, 13814,
+	13817, 13820, 13823, 13826, 13829, 13832, 13835, 13838, 13841, 13844,
+	13847, 13850, 13853, 13856, 13859, 13862, 13865, 13868, 13871, 13874,
+	13877, 13880, 13883, 13886, 13889, 13892, 13895, 13898, 13901, 13904,
+	13907, 13910, 13913, 13916, 13919, 13922, 13925, 13928, 13931, 13934,
+	13937, 13940, 13943, 13946, 13949, 13952, 13955, 13958, 13961, 13964,
+	13967, 13970, 13973, 13976, 13979, 13982, 13985, 13988, 13991, 13994,
+	13997, 14000, 14003, 14006, 14009, 14012, 14015, 14018, 14021, 14024,
+	14027, 14030, 14033, 14036, 14039, 14042, 14045, 14048, 14051, 14054,
+	14057, 14060, 14063, 14066, 14069, 14072, 14075, 14078, 14081, 14084,
+	14087, 14090, 14093, 14096, 14099, 14102, 14105, 14108, 14111, 14114,
+	14117, 14120, 14123, 14126, 14129, 14131, 14133, 14135, 14138, 14140,
+	14142, 14145, 14148, 14151, 14154, 14157, 14160, 14163, 14166, 14168,
+	14170, 14172, 14174, 14176, 14178, 14181, 14183, 14185, 14187, 14189,
+	14192, 14194, 14196, 14198, 14200, 14202, 14204, 14206, 14208, 14210,
+	14212, 14214, 14216, 14218, 14220, 14224, 14227, 14229, 14233, 14235,
+	14239, 14241, 14243, 14245, 14246, 14248, 14252, 14254, 14256, 14258,
+	14260, 14262, 14265, 14267, 14269, 14272, 14274, 14276, 14278, 14280,
+	14282, 14284, 14286, 14290, 14294, 14302, 14310, 14318, 14326, 14334,
+	14342, 14350, 14358, 14366, 14374, 14382, 14390, 14398, 14406, 14414,
+	14426, 14438, 14450, 14462, 14474, 14482, 14490, 14502, 14514, 14526,
+	14538, 14539, 14540, 14541, 14542, 14543, 14544, 14545, 14546, 14547,
+	14548, 14549, 14550, 14551, 14552, 14553, 14554, 14555, 14556, 14557,
+	14558, 14559, 14560, 14561, 14562, 14563, 14564, 14565, 14566, 14567,
+	14568, 14569, 14570, 14571, 14572, 14573, 14574, 14575, 14576, 14577,
+	14578, 14579, 14580, 14581, 14582, 14583, 14584, 14585, 14586, 14587,
+	14588, 14589, 14590, 14591, 14592, 14593, 14594, 14595, 14596, 14597,
+	14598, 14599, 14600, 14601, 14602, 14603, 14604, 14605, 14606, 14607,
+	14608, 14609, 14610, 14611, 14612, 14613, 14614, 14615, 14616, 14617,
+	14618, 14619, 14620, 14621, 14622, 14623, 14624, 14625, 14626, 14627,
+	14628, 14629, 14630, 14631, 14632, 14633, 14634, 14635, 14636, 14637,
+	14638, 14639, 14640, 14641, 14642, 14643, 14644, 14645, 14646, 14647,
+	14648, 14649, 14650, 14651, 14652, 14653, 14654, 14655, 14656, 14657,
+	14658, 14659, 14660, 14661, 14662, 14663, 14664, 14665, 14666, 14667,
+	14668, 14669, 14670, 14671, 14672, 14673, 14674, 14675, 14676, 14677,
+	14678, 14679, 14680, 14681, 14682, 14683, 14684, 14685, 14686, 14687,
+	14688, 14689, 14690, 14691, 14692, 14693, 14694, 14695, 14696, 14697,
+	14698, 14699, 14700, 14701, 14702, 14703, 14704, 14705, 14706, 14707,
+	14708, 14709, 14710, 14711, 14712, 14713, 14714, 14715, 14716, 14717,
+	14718, 14719, 14720, 14721, 14722, 14723, 14724, 14725, 14726, 14727,
+	14728, 14729, 14730, 14731, 14732, 14733, 14734, 14735, 14736, 14737,
+	14738, 14739, 14740, 14741, 14742, 14743, 14744, 14745, 14746, 14747,
+	14748, 14749, 14750, 14751, 14752, 14753, 14754, 14755, 14756, 14757,
+	14758, 14759, 14760, 14761, 14762, 14763, 14764, 14765, 14766, 14767,
+	14768, 14769, 14770, 14771, 14772, 14773, 14774, 14775, 14776, 14777,
+	14778, 14779, 14780, 14781, 14782, 14783, 14784, 14785, 14786, 14787,
+	14788, 14789, 14790, 14791, 14792, 14793, 14794, 14795, 14796, 14797,
+	14798, 14799, 14800, 14801, 14802, 14803, 14804, 14805, 14806, 14807,
+	14808, 14809, 14810, 14811, 14812, 14813, 14814, 14815, 14816, 14817,
+	14818, 14819, 14820, 14821, 14822, 14823, 14824, 14825, 14826, 14827,
+	14828, 14829, 14830, 14831, 14832, 14833, 14834, 14835, 14836, 14837,
+	14838, 14839, 14840, 14841, 14842, 14843, 14844, 14845, 14846, 14847,
+	14848, 14849, 14850, 14851, 14852, 14853, 14854, 14855, 14856, 14857,
+	14858, 14859, 14860, 14861, 14862, 14863, 14864, 14865, 14866, 14867,
+	14868, 14869, 14870, 14871, 14872, 14873, 14874, 14875, 14876, 14877,
+	14878, 14879, 14880, 14881, 14882, 14883, 14884, 14885, 14886, 14887,
+	14888, 14889, 14890, 14891, 14892, 14893, 14894, 14895, 14896, 14897,
+	14898, 14899, 14900, 14901, 14902, 14903, 14904, 14905, 14906, 14907,
+	14908, 14909, 14910, 14911, 14912, 14913, 14914, 14915, 14916, 14917,
+	14918, 14919, 14920, 14921, 14922, 14923, 14924, 14925, 14926, 14927,
+	14928, 14929, 14930, 14931, 14932, 14933, 14934, 14935, 14936, 14937,
+	14938, 14939, 14940, 14941, 14942, 14943, 14944, 14945, 14946, 14947,
+	14948, 14949, 14950, 14951, 14952, 14953, 14954, 14955, 14956, 14957,
+	14958, 14959, 14960, 14961, 14962, 14963, 14964, 14965, 14966, 14967,
+	14968, 14969, 14970, 14971, 14972, 14973, 14974, 14975, 14976, 14977,
+	14978, 14979, 14980, 14981, 14982, 14983, 14984, 14985, 14986, 14987,
+	14988, 14989, 14990, 14991, 14992, 14993, 14994, 14995, 14996, 14997,
+	14998, 14999, 15000, 15001, 15002, 15003, 15004, 15005, 15006, 15007,
+	15008, 15009, 15010, 15011, 15012, 15013, 15014, 15015, 15016, 15017,
+	15018, 15019, 15020, 15021, 15022, 15023, 15024, 15025, 15026, 15027,
+	15028, 15029, 15030, 15031, 15032, 15033, 15034, 15035, 15036, 15037,
+	15038, 15039, 15040, 15041, 15042, 15043, 15044, 15045, 15046, 15047,
+	15048, 15049, 15050, 15051, 15052, 15053, 15054, 15055, 15056, 15057,
+	15058, 15059, 15060, 15061, 15062, 15063, 15064, 15065, 15066, 15067,
+	15068, 15069, 15070, 15071, 15072, 15073, 15074, 15075, 15076, 15077,
+	15078, 15079, 15080, 15081, 15082, 15083, 15084, 15085, 15086, 15087,
+	15088, 15089, 15090, 15091, 15092, 15093, 15094, 15095, 15096, 15097,
+	15098, 15099, 15100, 15101, 15102, 15103, 15104, 15105, 15106, 15107,
+	15108, 15109, 15110, 15111, 15112, 15113, 15114, 15115, 15116, 15117,
+	15118, 15119, 15120, 15121, 15122, 15123, 15124, 15125, 15126, 15127,
+	15128, 15129, 15130, 15131, 15132, 15133, 15134, 15135, 15136, 15137,
+	15138, 15139, 15140, 15141, 15142, 15143, 15144, 15145, 15146, 15147,
+	15148, 15149, 15150, 15151, 15152, 15153, 15154, 15155, 15156, 15157,
+	15158, 15159, 15160, 15161, 15162, 15163, 15164, 15165, 15166, 15167,
+	15168, 15169, 15170, 15171, 15172, 15173, 15174, 15175, 15176, 15177,
+	15178, 15179, 15180, 15181, 15182, 15183, 15184, 15185, 15186, 15187,
+	15188, 15189, 15190, 15192, 15194, 15196, 15198, 15200, 15202, 15204,
+	15206, 15208, 15210, 15212, 15214, 15216, 15218, 15220, 15222, 15224,
+	15226, 15228, 15230, 15232, 15234, 15236, 15238, 15240, 15242, 15244,
+	15247, 15249, 15251, 15253, 15255, 15257, 15259, 15261, 15263, 15265,
+	15267, 15269, 15271, 15273, 15275, 15277, 15279, 15281, 15283, 15285,
+	15287, 15289, 15291, 15293, 15295, 15297, 15300, 15302, 15304, 15306,
+	15308, 15310, 15312, 15314, 15316, 15318, 15320, 15322, 15324, 15326,
+	15328, 15330, 15332, 15334, 15336, 15338, 15340, 15342, 15344, 15346,
+	15348, 15350, 15352, 15354, 15356, 15358, 15360, 15362, 15365, 15367,
+	15369, 15371, 15373, 15375, 15377, 15379, 15381, 15383, 15385, 15387,
+	15389, 15391, 15393, 15395, 15397, 15399, 15401, 15403, 15405, 15407,
+	15409, 15411, 15413, 15415, 15418, 15420, 15422, 15424, 15426, 15428,
+	15430, 15432, 15434, 15436, 15438, 15440, 15442, 15444, 15446, 15448,
+	15450, 15452, 15454, 15456, 15458, 15460, 15462, 15464, 15466, 15468,
+	15470, 15472, 15474, 15476, 15478, 15480, 15483, 15485, 15487, 15489,
+	15491, 15493, 15495, 15497, 15499, 15501, 15503, 15505, 15507, 15509,
+	15511, 15513, 15515, 15517, 15519, 15521, 15523, 15525, 15527, 15529,
+	15531, 15533, 15536, 15538, 15540, 15542, 15544, 15546, 15548, 15550,
+	15552, 15554, 15556, 15558, 15560, 15562, 15564, 15566, 15568, 15570,
+	15572, 15574, 15576, 15578, 15580, 15582, 15584, 15586, 15588, 15590,
+	15592, 15594, 15596, 15598, 15601, 15603, 15605, 15607, 15609, 15611,
+	15613, 15615, 15617, 15619, 15621, 15623, 15625, 15627, 15629, 15631,
+	15633, 15635, 15637, 15639, 15641, 15643, 15645, 15647, 15649, 15651,
+	15654, 15656, 15658, 15660, 15662, 15664, 15666, 15668, 15670, 15672,
+	15674, 15676, 15678, 15680, 15682, 15684, 15686, 15688, 15690, 15692,
+	15694, 15696, 15698, 15700, 15702, 15704, 15706, 15708, 15710, 15712,
+	15714, 15716, 15719, 15721, 15723, 15725, 15727, 15729, 15731, 15733,
+	15735, 15737, 15739, 15741, 15743, 15745, 15747, 15749, 15751, 15753,
+	15755, 15757, 15759, 15761, 15763, 15765, 15767, 15769, 15772, 15774,
+	15776, 15778, 15780, 15782, 15784, 15786, 15788, 15789, 15790, 15791,
+	15792, 15793, 15794, 15795, 15796, 15797, 15798, 15799, 15800, 15801,
+	15802, 15803, 15804, 15805, 15806, 15807, 15808, 15809, 15810, 15811,
+	15812, 15813, 15814, 15815, 15816, 15817, 15818, 15819, 15820, 15821,
+	15822, 15823, 15824, 15825, 15826, 15827, 15828, 15829, 15830, 15831,
+	15832, 15833, 15834, 15835, 15836, 15837, 15838, 15840, 15842, 15844,
+	15846, 15848, 15850, 15852, 15854, 15856, 15858, 15860, 15862, 15864,
+	15866, 15868, 15870, 15872, 15874, 15876, 15878, 15880, 15882, 15884,
+	15886, 15888, 15890, 15892, 15894, 15896, 15898, 15900, 15902, 15904,
+	15906, 15908, 15910, 15912, 15914, 15916, 15918, 15920, 15922, 15924,
+	15926, 15928, 15930, 15932, 15934, 15936, 15938, 15940, 15942, 15944,
+	15946, 15948, 15950, 15952, 15954, 15956, 15958, 15960, 15962, 15964,
+	15966, 15968, 15970, 15972, 15974, 15976, 15978, 15980, 15982, 15984,
+	15986, 15988, 15990, 15992, 15994, 15996, 15998, 16000, 16002, 16004,
+	16006, 16008, 16010, 16012, 16014, 16016, 16018, 16020, 16022, 16024,
+	16026, 16028, 16030, 16032, 16034, 16036, 16038, 16040, 16042, 16044,
+	16046, 16048, 16050, 16052, 16054, 16056, 16058, 16060, 16062, 16064,
+	16066, 16068, 16070, 16072, 16074, 16076, 16078, 16080, 16082, 16084,
+	16086, 16088, 16090, 16092, 16094, 16096, 16098, 16100, 16102, 16104,
+	16106, 16108, 16110, 16112, 16114, 16116, 16118, 16120, 16122, 16124,
+	16126, 16128, 16130, 16132, 16134, 16136, 16138, 16140, 16142, 16145,
+	16148, 16151, 16154, 16157, 16160, 16163, 16166, 16169, 16172, 16175,
+	16178, 16181, 16184, 16187, 16190, 16193, 16196, 16199, 16202, 16205,
+	16208, 16211, 16214, 16217, 16220, 16227, 16228, 16229, 16231, 16233,
+	16234, 16235, 16236, 16237, 16238, 16239, 16240, 16241, 16242, 16243,
+	16244, 16245, 16246, 16247, 16248, 16249, 16250, 16251, 16252, 16253,
+	16254, 16255, 16256, 16257, 16258, 16259, 16261, 16263, 16265, 16267,
+	16270, 16272, 16274, 16276, 16278, 16280, 16286, 16292, 16295, 16298,
+	16301, 16304, 16310, 16313, 16316, 16319, 16322, 16325, 16328, 16331,
+	16334, 16337, 16340, 16343, 16346, 16349, 16352, 16355, 16358, 16361,
+	16364, 16367, 16370, 16373, 16376, 16379, 16382, 16385, 16388, 16391,
+	16394, 16397, 16400, 16403, 16406, 16409, 16412, 16415, 16418, 16421,
+	16424, 16427, 16430, 16439, 16448, 16457, 16466, 16475, 16484, 16493,
+	16502, 16511, 16514, 16517, 16518, 16519, 16520, 16521, 16522, 16523,
+	16524, 16525, 16526, 16527, 16530, 16533, 16536, 16540, 16543, 16546,
+	16549, 16552, 16555, 16558, 16561, 16564, 16567, 16571, 16574, 16577,
+	16580, 16583, 16587, 16590, 16593, 16596, 16600, 16603, 16606, 16609,
+	16612, 16615, 16619, 16622, 16625, 16628, 16631, 16634, 16637, 16640,
+	16643, 16646, 16649, 16652, 16655, 16658, 16661, 16664, 16667, 16670,
+	16673, 16676, 16679, 16682, 16685, 16688, 16692, 16695, 16698, 16701,
+	16705, 16708, 16711, 16714, 16717, 16720, 16723, 16726, 16729, 16732,
+	16735, 16738, 16741, 16744, 16747, 16750, 16753, 16756, 16759, 16762,
+	16765, 16768, 16771, 16774, 16777, 16780, 16783, 16786, 16789, 16792,
+	16795, 16798, 16801, 16805, 16808, 16811, 16814, 16817, 16820, 16823,
+	16827, 16831, 16834, 16837, 16840, 16843, 16846, 16849, 16852, 16855,
+	16858, 16861, 16865, 16868, 16871, 16874, 16877, 16881, 16884, 16887,
+	16890, 16893, 16896, 16899, 16902, 16905, 16908, 16912, 16915, 16919,
+	16922, 16925, 16928, 16931, 16934, 16937, 16940, 16943, 16946, 16949,
+	16952, 16956, 16959, 16962, 16965, 16968, 16971, 16975, 16978, 16982,
+	16986, 16989, 16992, 16995, 16998, 17002, 17006, 17009, 17012, 17015,
+	17018, 17021, 17024, 17027, 17030, 17033, 17036, 17039, 17043, 17046,
+	17049, 17052, 17055, 17058, 17061, 17064, 17067, 17070, 17073, 17076,
+	17079, 17082, 17085, 17088, 17091, 17094, 17097, 17100, 17104, 17107,
+	17110, 17113, 17116, 17119, 17123, 17126, 17129, 17132, 17135, 17138,
+	17141, 17144, 17147, 17150, 17153, 17156, 17160, 17163, 17166, 17169,
+	17172, 17175, 17178, 17181, 17184, 17187, 17190, 17193, 17196, 17199,
+	17202, 17205, 17208, 17211, 17214, 17218, 17221, 17224, 17227, 17230,
+	17233, 17237, 17240, 17243, 17246, 17249, 17252, 17255, 17258, 17261,
+	17265, 17268, 17271, 17274, 17278, 17281, 17284, 17287, 17290, 17293,
+	17296, 17300, 17304, 17308, 17311, 17315, 17318, 17321, 17324, 17327,
+	17330, 17333, 17336, 17339, 17342, 17345, 17349, 17352, 17355, 17358,
+	17361, 17364, 17367, 17371, 17374, 17377, 17381, 17385, 17388, 17391,
+	17394, 17397, 17400, 17403, 17406, 17409, 17412, 17416, 17419, 17423,
+	17426, 17430, 17433, 17436, 17439, 17443, 17446, 17449, 17453, 17457,
+	17460, 17463, 17466, 17469, 17472, 17475, 17478, 17481, 17484, 17487,
+	17490, 17493, 17496, 17500, 17503, 17507, 17510, 17514, 17517, 17521,
+	17525, 17529, 17532, 17535, 17538, 17542, 17546, 17550, 17554, 17557,
+	17560, 17563, 17566, 17569, 17572, 17575, 17578, 17582, 17585, 17588,
+	17591, 17594, 17598, 17601, 17605, 17609, 17612, 17615, 17618, 17621,
+	17624, 17627, 17631, 17635, 17639, 17642, 17645, 17649, 17652, 17655,
+	17658, 17662, 17665, 17668, 17671, 17674, 17677, 17681, 17684, 17687,
+	17690, 17693, 17696, 17699, 17703, 17707, 17710, 17714, 17717, 17721,
+	17724, 17727, 17730, 17734, 17738, 17741, 17745, 17748, 17752, 17755,
+	17758, 17761, 17764, 17767, 17770, 17774, 17778, 17782, 17786, 17789,
+	17792, 17795, 17798, 17801, 17804, 17807, 17810, 17813, 17816, 17819,
+	17822, 17826, 17829, 17832, 17835, 17838, 17841, 17844, 17847, 17850,
+	17853, 17856, 17859, 17862, 17866, 17870, 17874, 17877, 17880, 17883,
+	17886, 17890, 17893, 17897, 17900, 17903, 17907, 17911, 17914, 17917,
+	17920, 17923, 17926, 17929, 17932, 17935, 17938, 17941, 17944, 17947,
+	17950, 17953, 17956, 17959, 17962, 17965, 17968, 17972, 17975, 17978,
+	17981, 17984, 17987, 17991, 17995, 17998, 18001, 18004, 18007, 18010,
+	18013, 18017, 18020, 18023, 18026, 18029, 18033, 18037, 18040, 18043,
+	18046, 18050, 18053, 18056, 18060, 18064, 18067, 18070, 18073, 18077,
+	18080, 18083, 18086, 18089, 18092, 18095, 18098, 18102, 18105, 18108,
+	18111, 18115, 18118, 18121, 18124, 18127, 18131, 18135, 18138, 18141,
+	18144, 18148, 18151, 18155, 18158, 18161, 18164, 18168, 18171, 18174,
+	18177, 18180, 18183, 18186, 18189, 18193, 18196, 18199, 18202, 18205,
+	18208, 18211, 18215, 18218, 18222, 18226, 18230, 18233, 18236, 18239,
+	18242, 18245, 18248, 18251, 18254, 18258
+};
+
+static const uint8_t nfkd_utf8[18258] = {
+	0x20, 0x20, 0xcc, 0x88, 0x61, 0x20, 0xcc, 0x84, 0x32, 0x33, 0x20, 0xcc,
+	0x81, 0xce, 0xbc, 0x20, 0xcc, 0xa7, 0x31, 0x6f, 0x31, 0xe2, 0x81, 0x84,
+	0x34, 0x31, 0xe2, 0x81, 0x84, 0x32, 0x33, 0xe2, 0x81, 0x84, 0x34, 0x41,
+	0xcc, 0x80, 0x41, 0xcc, 0x81, 0x41, 0xcc, 0x82, 0x41, 0xcc, 0x83, 0x41,
+	0xcc, 0x88, 0x41, 0xcc, 0x8a, 0x43, 0xcc, 0xa7, 0x45, 0xcc, 0x80, 0x45,
+	0xcc, 0x81, 0x45, 0xcc, 0x82, 0x45, 0xcc, 0x88, 0x49, 0xcc, 0x80, 0x49,
+	0xcc, 0x81, 0x49, 0xcc, 0x82, 0x49, 0xcc, 0x88, 0x4e, 0xcc, 0x83, 0x4f,
+	0xcc, 0x80, 0x4f, 0xcc, 0x81, 0x4f, 0xcc, 0x82, 0x4f, 0xcc, 0x83, 0x4f,
+	0xcc, 0x88, 0x55, 0xcc, 0x80, 0x55, 0xcc, 0x81, 0x55, 0xcc, 0x82, 0x55,
+	0xcc, 0x88, 0x59, 0xcc, 0x81, 0x61, 0xcc, 0x80, 0x61, 0xcc, 0x81, 0x61,
+	0xcc, 0x82, 0x61, 0xcc, 0x83, 0x61, 0xcc, 0x88, 0x61, 0xcc, 0x8a, 0x63,
+	0xcc, 0xa7, 0x65, 0xcc, 0x80, 0x65, 0xcc, 0x81, 0x65, 0xcc, 0x82, 0x65,
+	0xcc, 0x88, 0x69, 0xcc, 0x80, 0x69, 0xcc, 0x81, 0x69, 0xcc, 0x82, 0x69,
+	0xcc, 0x88, 0x6e, 0xcc, 0x83, 0x6f, 0xcc, 0x80, 0x6f, 0xcc, 0x81, 0x6f,
+	0xcc, 0x82, 0x6f, 0xcc, 0x83, 0x6f, 0xcc, 0x88, 0x75, 0xcc, 0x80, 0x75,
+	0xcc, 0x81, 0x75, 0xcc, 0x82, 0x75, 0xcc, 0x88, 0x79, 0xcc, 0x81, 0x79,
+	0xcc, 0x88, 0x41, 0xcc, 0x84, 0x61, 0xcc, 0x84, 0x41, 0xcc, 0x86, 0x61,
+	0xcc, 0x86, 0x41, 0xcc, 0xa8, 0x61, 0xcc, 0xa8, 0x43, 0xcc, 0x81, 0x63,
+	0xcc, 0x81, 0x43, 0xcc, 0x82, 0x63, 0xcc, 0x82, 0x43, 0xcc, 0x87, 0x63,
+	0xcc, 0x87, 0x43, 0xcc, 0x8c, 0x63, 0xcc, 0x8c, 0x44, 0xcc, 0x8c, 0x64,
+	0xcc, 0x8c, 0x45, 0xcc, 0x84, 0x65, 0xcc, 0x84, 0x45, 0xcc, 0x86, 0x65,
+	0xcc, 0x86, 0x45, 0xcc, 0x87, 0x65, 0xcc, 0x87, 0x45, 0xcc, 0xa8, 0x65,
+	0xcc, 0xa8, 0x45, 0xcc, 0x8c, 0x65, 0xcc, 0x8c, 0x47, 0xcc, 0x82, 0x67,
+	0xcc, 0x82, 0x47, 0xcc, 0x86, 0x67, 0xcc, 0x86, 0x47, 0xcc, 0x87, 0x67,
+	0xcc, 0x87, 0x47, 0xcc, 0xa7, 0x67, 0xcc, 0xa7, 0x48, 0xcc, 0x82, 0x68,
+	0xcc, 0x82, 0x49, 0xcc, 0x83, 0x69, 0xcc, 0x83, 0x49, 0xcc, 0x84, 0x69,
+	0xcc, 0x84, 0x49, 0xcc, 0x86, 0x69, 0xcc, 0x86, 0x49, 0xcc, 0xa8, 0x69,
+	0xcc, 0xa8, 0x49, 0xcc, 0x87, 0x49, 0x4a, 0x69, 0x6a, 0x4a, 0xcc, 0x82,
+	0x6a, 0xcc, 0x82, 0x4b, 0xcc, 0xa7, 0x6b, 0xcc, 0xa7, 0x4c, 0xcc, 0x81,
+	0x6c, 0xcc, 0x81, 0x4c, 0xcc, 0xa7, 0x6c, 0xcc, 0xa7, 0x4c, 0xcc, 0x8c,
+	0x6c, 0xcc, 0x8c, 0x4c, 0xc2, 0xb7, 0x6c, 0xc2, 0xb7, 0x4e, 0xcc, 0x81,
+	0x6e, 0xcc, 0x81, 0x4e, 0xcc, 0xa7, 0x6e, 0xcc, 0xa7, 0x4e, 0xcc, 0x8c,
+	0x6e, 0xcc, 0x8c, 0xca, 0xbc, 0x6e, 0x4f, 0xcc, 0x84, 0x6f, 0xcc, 0x84,
+	0x4f, 0xcc, 0x86, 0x6f, 0xcc, 0x86, 0x4f, 0xcc, 0x8b, 0x6f, 0xcc, 0x8b,
+	0x52, 0xcc, 0x81, 0x72, 0xcc, 0x81, 0x52, 0xcc, 0xa7, 0x72, 0xcc, 0xa7,
+	0x52, 0xcc, 0x8c, 0x72, 0xcc, 0x8c, 0x53, 0xcc, 0x81, 0x73, 0xcc, 0x81,
+	0x53, 0xcc, 0x82, 0x73, 0xcc, 0x82, 0x53, 0xcc, 0xa7, 0x73, 0xcc, 0xa7,
+	0x53, 0xcc, 0x8c, 0x73, 0xcc, 0x8c, 0x54, 0xcc, 0xa7, 0x74, 0xcc, 0xa7,
+	0x54, 0xcc, 0x8c, 0x74, 0xcc, 0x8c, 0x55, 0xcc, 0x83, 0x75, 0xcc, 0x83,
+	0x55, 0xcc, 0x84, 0x75, 0xcc, 0x84, 0x55, 0xcc, 0x86, 0x75, 0xcc, 0x86,
+	0x55, 0xcc, 0x8a, 0x75, 0xcc, 0x8a, 0x55, 0xcc, 0x8b, 0x75, 0xcc, 0x8b,
+	0x55, 0xcc, 0xa8, 0x75, 0xcc, 0xa8, 0x57, 0xcc, 0x82, 0x77, 0xcc, 0x82,
+	0x59, 0xcc, 0x82, 0x79, 0xcc, 0x82, 0x59, 0xcc, 0x88, 0x5a, 0xcc, 0x81,
+	0x7a, 0xcc, 0x81, 0x5a, 0xcc, 0x87, 0x7a, 0xcc, 0x87, 0x5a, 0xcc, 0x8c,
+	0x7a, 0xcc, 0x8c, 0x73, 0x4f, 0xcc, 0x9b, 0x6f, 0xcc, 0x9b, 0x55, 0xcc,
+	0x9b, 0x75, 0xcc, 0x9b, 0x44, 0x5a, 0xcc, 0x8c, 0x44, 0x7a, 0xcc, 0x8c,
+	0x64, 0x7a, 0xcc, 0x8c, 0x4c, 0x4a, 0x4c, 0x6a, 0x6c, 0x6a, 0x4e, 0x4a,
+	0x4e, 0x6a, 0x6e, 0x6a, 0x41, 0xcc, 0x8c, 0x61, 0xcc, 0x8c, 0x49, 0xcc,
+	0x8c, 0x69, 0xcc, 0x8c, 0x4f, 0xcc, 0x8c, 0x6f, 0xcc, 0x8c, 0x55, 0xcc,
+	0x8c, 0x75, 0xcc, 0x8c, 0x55, 0xcc, 0x88, 0xcc, 0x84, 0x75, 0xcc, 0x88,
+	0xcc, 0x84, 0x55, 0xcc, 0x88, 0xcc, 0x81, 0x75, 0xcc, 0x88, 0xcc, 0x81,
+	0x55, 0xcc, 0x88, 0xcc, 0x8c, 0x75, 0xcc, 0x88, 0xcc, 0x8c, 0x55, 0xcc,
+	0x88, 0xcc, 0x80, 0x75, 0xcc, 0x88, 0xcc, 0x80, 0x41, 0xcc, 0x88, 0xcc,
+	0x84, 0x61, 0xcc, 0x88, 0xcc, 0x84, 0x41, 0xcc, 0x87, 0xcc, 0x84, 0x61,
+	0xcc, 0x87, 0xcc, 0x84, 0xc3, 0x86, 0xcc, 0x84, 0xc3, 0xa6, 0xcc, 0x84,
+	0x47, 0xcc, 0x8c, 0x67, 0xcc, 0x8c, 0x4b, 0xcc, 0x8c, 0x6b, 0xcc, 0x8c,
+	0x4f, 0xcc, 0xa8, 0x6f, 0xcc, 0xa8, 0x4f, 0xcc, 0xa8, 0xcc, 0x84, 0x6f,
+	0xcc, 0xa8, 0xcc, 0x84, 0xc6, 0xb7, 0xcc, 0x8c, 0xca, 0x92, 0xcc, 0x8c,
+	0x6a, 0xcc, 0x8c, 0x44, 0x5a, 0x44, 0x7a, 0x64, 0x7a, 0x47, 0xcc, 0x81,
+	0x67, 0xcc, 0x81, 0x4e, 0xcc, 0x80, 0x6e, 0xcc, 0x80, 0x41, 0xcc, 0x8a,
+	0xcc, 0x81, 0x61, 0xcc, 0x8a, 0xcc, 0x81, 0xc3, 0x86, 0xcc, 0x81, 0xc3,
+	0xa6, 0xcc, 0x81, 0xc3, 0x98, 0xcc, 0x81, 0xc3, 0xb8, 0xcc, 0x81, 0x41,
+	0xcc, 0x8f, 0x61, 0xcc, 0x8f, 0x41, 0xcc, 0x91, 0x61, 0xcc, 0x91, 0x45,
+	0xcc, 0x8f, 0x65, 0xcc, 0x8f, 0x45, 0xcc, 0x91, 0x65, 0xcc, 0x91, 0x49,
+	0xcc, 0x8f, 0x69, 0xcc, 0x8f, 0x49, 0xcc, 0x91, 0x69, 0xcc, 0x91, 0x4f,
+	0xcc, 0x8f, 0x6f, 0xcc, 0x8f, 0x4f, 0xcc, 0x91, 0x6f, 0xcc, 0x91, 0x52,
+	0xcc, 0x8f, 0x72, 0xcc, 0x8f, 0x52, 0xcc, 0x91, 0x72, 0xcc, 0x91, 0x55,
+	0xcc, 0x8f, 0x75, 0xcc, 0x8f, 0x55, 0xcc, 0x91, 0x75, 0xcc, 0x91, 0x53,
+	0xcc, 0xa6, 0x73, 0xcc, 0xa6, 0x54, 0xcc, 0xa6, 0x74, 0xcc, 0xa6, 0x48,
+	0xcc, 0x8c, 0x68, 0xcc, 0x8c, 0x41, 0xcc, 0x87, 0x61, 0xcc, 0x87, 0x45,
+	0xcc, 0xa7, 0x65, 0xcc, 0xa7, 0x4f, 0xcc, 0x88, 0xcc, 0x84, 0x6f, 0xcc,
+	0x88, 0xcc, 0x84, 0x4f, 0xcc, 0x83, 0xcc, 0x84, 0x6f, 0xcc, 0x83, 0xcc,
+	0x84, 0x4f, 0xcc, 0x87, 0x6f, 0xcc, 0x87, 0x4f, 0xcc, 0x87, 0xcc, 0x84,
+	0x6f, 0xcc, 0x87, 0xcc, 0x84, 0x59, 0xcc, 0x84, 0x79, 0xcc, 0x84, 0x68,
+	0xc9, 0xa6, 0x6a, 0x72, 0xc9, 0xb9, 0xc9, 0xbb, 0xca, 0x81, 0x77, 0x79,
+	0x20, 0xcc, 0x86, 0x20, 0xcc, 0x87, 0x20, 0xcc, 0x8a, 0x20, 0xcc, 0xa8,
+	0x20, 0xcc, 0x83, 0x20, 0xcc, 0x8b, 0xc9, 0xa3, 0x6c, 0x73, 0x78, 0xca,
+	0x95, 0xcc, 0x80, 0xcc, 0x81, 0xcc, 0x93, 0xcc, 0x88, 0xcc, 0x81, 0xca,
+	0xb9, 0x20, 0xcd, 0x85, 0x3b, 0x20, 0xcc, 0x81, 0x20, 0xcc, 0x88, 0xcc,
+	0x81, 0xce, 0x91, 0xcc, 0x81, 0xc2, 0xb7, 0xce, 0x95, 0xcc, 0x81, 0xce,
+	0x97, 0xcc, 0x81, 0xce, 0x99, 0xcc, 0x81, 0xce, 0x9f, 0xcc, 0x81, 0xce,
+	0xa5, 0xcc, 0x81, 0xce, 0xa9, 0xcc, 0x81, 0xce, 0xb9, 0xcc, 0x88, 0xcc,
+	0x81, 0xce, 0x99, 0xcc, 0x88, 0xce, 0xa5, 0xcc, 0x88, 0xce, 0xb1, 0xcc,
+	0x81, 0xce, 0xb5, 0xcc, 0x81, 0xce, 0xb7, 0xcc, 0x81, 0xce, 0xb9, 0xcc,
+	0x81, 0xcf, 0x85, 0xcc, 0x88, 0xcc, 0x81, 0xce, 0xb9, 0xcc, 0x88, 0xcf,
+	0x85, 0xcc, 0x88, 0xce, 0xbf, 0xcc, 0x81, 0xcf, 0x85, 0xcc, 0x81, 0xcf,
+	0x89, 0xcc, 0x81, 0xce, 0xb2, 0xce, 0xb8, 0xce, 0xa5, 0xce, 0xa5, 0xcc,
+	0x81, 0xce, 0xa5, 0xcc, 0x88, 0xcf, 0x86, 0xcf, 0x80, 0xce, 0xba, 0xcf,
+	0x81, 0xcf, 0x82, 0xce, 0x98, 0xce, 0xb5, 0xce, 0xa3, 0xd0, 0x95, 0xcc,
+	0x80, 0xd0, 0x95, 0xcc, 0x88, 0xd0, 0x93, 0xcc, 0x81, 0xd0, 0x86, 0xcc,
+	0x88, 0xd0, 0x9a, 0xcc, 0x81, 0xd0, 0x98, 0xcc, 0x80, 0xd0, 0xa3, 0xcc,
+	0x86, 0xd0, 0x98, 0xcc, 0x86, 0xd0, 0xb8, 0xcc, 0x86, 0xd0, 0xb5, 0xcc,
+	0x80, 0xd0, 0xb5, 0xcc, 0x88, 0xd0, 0xb3, 0xcc, 0x81, 0xd1, 0x96, 0xcc,
+	0x88, 0xd0, 0xba, 0xcc, 0x81, 0xd0, 0xb8, 0xcc, 0x80, 0xd1, 0x83, 0xcc,
+	0x86, 0xd1, 0xb4, 0xcc, 0x8f, 0xd1, 0xb5, 0xcc, 0x8f, 0xd0, 0x96, 0xcc,
+	0x86, 0xd0, 0xb6, 0xcc, 0x86, 0xd0, 0x90, 0xcc, 0x86, 0xd0, 0xb0, 0xcc,
+	0x86, 0xd0, 0x90, 0xcc, 0x88, 0xd0, 0xb0, 0xcc, 0x88, 0xd0, 0x95, 0xcc,
+	0x86, 0xd0, 0xb5, 0xcc, 0x86, 0xd3, 0x98, 0xcc, 0x88, 0xd3, 0x99, 0xcc,
+	0x88, 0xd0, 0x96, 0xcc, 0x88, 0xd0, 0xb6, 0xcc, 0x88, 0xd0, 0x97, 0xcc,
+	0x88, 0xd0, 0xb7, 0xcc, 0x88, 0xd0, 0x98, 0xcc, 0x84, 0xd0, 0xb8, 0xcc,
+	0x84, 0xd0, 0x98, 0xcc, 0x88, 0xd0, 0xb8, 0xcc, 0x88, 0xd0, 0x9e, 0xcc,
+	0x88, 0xd0, 0xbe, 0xcc, 0x88, 0xd3, 0xa8, 0xcc, 0x88, 0xd3, 0xa9, 0xcc,
+	0x88, 0xd0, 0xad, 0xcc, 0x88, 0xd1, 0x8d, 0xcc, 0x88, 0xd0, 0xa3, 0xcc,
+	0x84, 0xd1, 0x83, 0xcc, 0x84, 0xd0, 0xa3, 0xcc, 0x88, 0xd1, 0x83, 0xcc,
+	0x88, 0xd0, 0xa3, 0xcc, 0x8b, 0xd1, 0x83, 0xcc, 0x8b, 0xd0, 0xa7, 0xcc,
+	0x88, 0xd1, 0x87, 0xcc, 0x88, 0xd0, 0xab, 0xcc, 0x88, 0xd1, 0x8b, 0xcc,
+	0x88, 0xd5, 0xa5, 0xd6, 0x82, 0xd8, 0xa7, 0xd9, 0x93, 0xd8, 0xa7, 0xd9,
+	0x94, 0xd9, 0x88, 0xd9, 0x94, 0xd8, 0xa7, 0xd9, 0x95, 0xd9, 0x8a, 0xd9,
+	0x94, 0xd8, 0xa7, 0xd9, 0xb4, 0xd9, 0x88, 0xd9, 0xb4, 0xdb, 0x87, 0xd9,
+	0xb4, 0xd9, 0x8a, 0xd9, 0xb4, 0xdb, 0x95, 0xd9, 0x94, 0xdb, 0x81, 0xd9,
+	0x94, 0xdb, 0x92, 0xd9, 0x94, 0xe0, 0xa4, 0xa8, 0xe0, 0xa4, 0xbc, 0xe0,
+	0xa4, 0xb0, 0xe0, 0xa4, 0xbc, 0xe0, 0xa4, 0xb3, 0xe0, 0xa4, 0xbc, 0xe0,
+	0xa4, 0x95, 0xe0, 0xa4, 0xbc, 0xe0, 0xa4, 0x96, 0xe0, 0xa4, 0xbc, 0xe0,
+	0xa4, 0x97, 0xe0, 0xa4, 0xbc, 0xe0, 0xa4, 0x9c, 0xe0, 0xa4, 0xbc, 0xe0,
+	0xa4, 0xa1, 0xe0, 0xa4, 0xbc, 0xe0, 0xa4, 0xa2, 0xe0, 0xa4, 0xbc, 0xe0,
+	0xa4, 0xab, 0xe0, 0xa4, 0xbc, 0xe0, 0xa4, 0xaf, 0xe0, 0xa4, 0xbc, 0xe0,
+	0xa7, 0x87, 0xe0, 0xa6, 0xbe, 0xe0, 0xa7, 0x87, 0xe0, 0xa7, 0x97, 0xe0,
+	0xa6, 0xa1, 0xe0, 0xa6, 0xbc, 0xe0, 0xa6, 0xa2, 0xe0, 0xa6, 0xbc, 0xe0,
+	0xa6, 0xaf, 0xe0, 0xa6, 0xbc, 0xe0, 0xa8, 0xb2, 0xe0, 0xa8, 0xbc, 0xe0,
+	0xa8, 0xb8, 0xe0, 0xa8, 0xbc, 0xe0, 0xa8, 0x96, 0xe0, 0xa8, 0xbc, 0xe0,
+	0xa8, 0x97, 0xe0, 0xa8, 0xbc, 0xe0, 0xa8, 0x9c, 0xe0, 0xa8, 0xbc, 0xe0,
+	0xa8, 0xab, 0xe0, 0xa8, 0xbc, 0xe0, 0xad, 0x87, 0xe0, 0xad, 0x96, 0xe0,
+	0xad, 0x87, 0xe0, 0xac, 0xbe, 0xe0, 0xad, 0x87, 0xe0, 0xad, 0x97, 0xe0,
+	0xac, 0xa1, 0xe0, 0xac, 0xbc, 0xe0, 0xac, 0xa2, 0xe0, 0xac, 0xbc, 0xe0,
+	0xae, 0x92, 0xe0, 0xaf, 0x97, 0xe0, 0xaf, 0x86, 0xe0, 0xae, 0xbe, 0xe0,
+	0xaf, 0x87, 0xe0, 0xae, 0xbe, 0xe0, 0xaf, 0x86, 0xe0, 0xaf, 0x97, 0xe0,
+	0xb1, 0x86, 0xe0, 0xb1, 0x96, 0xe0, 0xb2, 0xbf, 0xe0, 0xb3, 0x95, 0xe0,
+	0xb3, 0x86, 0xe0, 0xb3, 0x95, 0xe0, 0xb3, 0x86, 0xe0, 0xb3, 0x96, 0xe0,
+	0xb3, 0x86, 0xe0, 0xb3, 0x82, 0xe0, 0xb3, 0x86, 0xe0, 0xb3, 0x82, 0xe0,
+	0xb3, 0x95, 0xe0, 0xb5, 0x86, 0xe0, 0xb4, 0xbe, 0xe0, 0xb5, 0x87, 0xe0,
+	0xb4, 0xbe, 0xe0, 0xb5, 0x86, 0xe0, 0xb5, 0x97, 0xe0, 0xb7, 0x99, 0xe0,
+	0xb7, 0x8a, 0xe0, 0xb7, 0x99, 0xe0, 0xb7, 0x8f, 0xe0, 0xb7, 0x99, 0xe0,
+	0xb7, 0x8f, 0xe0, 0xb7, 0x8a, 0xe0, 0xb7, 0x99, 0xe0, 0xb7, 0x9f, 0xe0,
+	0xb9, 0x8d, 0xe0, 0xb8, 0xb2, 0xe0, 0xbb, 0x8d, 0xe0, 0xba, 0xb2, 0xe0,
+	0xba, 0xab, 0xe0, 0xba, 0x99, 0xe0, 0xba, 0xab, 0xe0, 0xba, 0xa1, 0xe0,
+	0xbc, 0x8b, 0xe0, 0xbd, 0x82, 0xe0, 0xbe, 0xb7, 0xe0, 0xbd, 0x8c, 0xe0,
+	0xbe, 0xb7, 0xe0, 0xbd, 0x91, 0xe0, 0xbe, 0xb7, 0xe0, 0xbd, 0x96, 0xe0,
+	0xbe, 0xb7, 0xe0, 0xbd, 0x9b, 0xe0, 0xbe, 0xb7, 0xe0, 0xbd, 0x80, 0xe0,
+	0xbe, 0xb5, 0xe0, 0xbd, 0xb1, 0xe0, 0xbd, 0xb2, 0xe0, 0xbd, 0xb1, 0xe0,
+	0xbd, 0xb4, 0xe0, 0xbe, 0xb2, 0xe0, 0xbe, 0x80, 0xe0, 0xbe, 0xb2, 0xe0,
+	0xbd, 0xb1, 0xe0, 0xbe, 0x80, 0xe0, 0xbe, 0xb3, 0xe0, 0xbe, 0x80, 0xe0,
+	0xbe, 0xb3, 0xe0, 0xbd, 0xb1, 0xe0, 0xbe, 0x80, 0xe0, 0xbd, 0xb1, 0xe0,
+	0xbe, 0x80, 0xe0, 0xbe, 0x92, 0xe0, 0xbe, 0xb7, 0xe0, 0xbe, 0x9c, 0xe0,
+	0xbe, 0xb7, 0xe0, 0xbe, 0xa1, 0xe0, 0xbe, 0xb7, 0xe0, 0xbe, 0xa6, 0xe0,
+	0xbe, 0xb7, 0xe0, 0xbe, 0xab, 0xe0, 0xbe, 0xb7, 0xe0, 0xbe, 0x90, 0xe0,
+	0xbe, 0xb5, 0xe1, 0x80, 0xa5, 0xe1, 0x80, 0xae, 0xe1, 0x83, 0x9c, 0xe1,
+	0xac, 0x85, 0xe1, 0xac, 0xb5, 0xe1, 0xac, 0x87, 0xe1, 0xac, 0xb5, 0xe1,
+	0xac, 0x89, 0xe1, 0xac, 0xb5, 0xe1, 0xac, 0x8b, 0xe1, 0xac, 0xb5, 0xe1,
+	0xac, 0x8d, 0xe1, 0xac, 0xb5, 0xe1, 0xac, 0x91, 0xe1, 0xac, 0xb5, 0xe1,
+	0xac, 0xba, 0xe1, 0xac, 0xb5, 0xe1, 0xac, 0xbc, 0xe1, 0xac, 0xb5, 0xe1,
+	0xac, 0xbe, 0xe1, 0xac, 0xb5, 0xe1, 0xac, 0xbf, 0xe1, 0xac, 0xb5, 0xe1,
+	0xad, 0x82, 0xe1, 0xac, 0xb5, 0x41, 0xc3, 0x86, 0x42, 0x44, 0x45, 0xc6,
+	0x8e, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0xc8, 0xa2,
+	0x50, 0x52, 0x54, 0x55, 0x57, 0x61, 0xc9, 0x90, 0xc9, 0x91, 0xe1, 0xb4,
+	0x82, 0x62, 0x64, 0x65, 0xc9, 0x99, 0xc9, 0x9b, 0xc9, 0x9c, 0x67, 0x6b,
+	0x6d, 0xc5, 0x8b, 0x6f, 0xc9, 0x94, 0xe1, 0xb4, 0x96, 0xe1, 0xb4, 0x97,
+	0x70, 0x74, 0x75, 0xe1, 0xb4, 0x9d, 0xc9, 0xaf, 0x76, 0xe1, 0xb4, 0xa5,
+	0xce, 0xb2, 0xce, 0xb3, 0xce, 0xb4, 0xcf, 0x86, 0xcf, 0x87, 0x69, 0x72,
+	0x75, 0x76, 0xce, 0xb2, 0xce, 0xb3, 0xcf, 0x81, 0xcf, 0x86, 0xcf, 0x87,
+	0xd0, 0xbd, 0xc9, 0x92, 0x63, 0xc9, 0x95, 0xc3, 0xb0, 0xc9, 0x9c, 0x66,
+	0xc9, 0x9f, 0xc9, 0xa1, 0xc9, 0xa5, 0xc9, 0xa8, 0xc9, 0xa9, 0xc9, 0xaa,
+	0xe1, 0xb5, 0xbb, 0xca, 0x9d, 0xc9, 0xad, 0xe1, 0xb6, 0x85, 0xca, 0x9f,
+	0xc9, 0xb1, 0xc9, 0xb0, 0xc9, 0xb2, 0xc9, 0xb3, 0xc9, 0xb4, 0xc9, 0xb5,
+	0xc9, 0xb8, 0xca, 0x82, 0xca, 0x83, 0xc6, 0xab, 0xca, 0x89, 0xca, 0x8a,
+	0xe1, 0xb4, 0x9c, 0xca, 0x8b, 0xca, 0x8c, 0x7a, 0xca, 0x90, 0xca, 0x91,
+	0xca, 0x92, 0xce, 0xb8, 0x41, 0xcc, 0xa5, 0x61, 0xcc, 0xa5, 0x42, 0xcc,
+	0x87, 0x62, 0xcc, 0x87, 0x42, 0xcc, 0xa3, 0x62, 0xcc, 0xa3, 0x42, 0xcc,
+	0xb1, 0x62, 0xcc, 0xb1, 0x43, 0xcc, 0xa7, 0xcc, 0x81, 0x63, 0xcc, 0xa7,
+	0xcc, 0x81, 0x44, 0xcc, 0x87, 0x64, 0xcc, 0x87, 0x44, 0xcc, 0xa3, 0x64,
+	0xcc, 0xa3, 0x44, 0xcc, 0xb1, 0x64, 0xcc, 0xb1, 0x44, 0xcc, 0xa7, 0x64,
+	0xcc, 0xa7, 0x44, 0xcc, 0xad, 0x64, 0xcc, 0xad, 0x45, 0xcc, 0x84, 0xcc,
+	0x80, 0x65, 0xcc, 0x84, 0xcc, 0x80, 0x45, 0xcc, 0x84, 0xcc, 0x81, 0x65,
+	0xcc, 0x84, 0xcc, 0x81, 0x45, 0xcc, 0xad, 0x65, 0xcc, 0xad, 0x45, 0xcc,
+	0xb0, 0x65, 0xcc, 0xb0, 0x45, 0xcc, 0xa7, 0xcc, 0x86, 0x65, 0xcc, 0xa7,
+	0xcc, 0x86, 0x46, 0xcc, 0x87, 0x66, 0xcc, 0x87, 0x47, 0xcc, 0x84, 0x67,
+	0xcc, 0x84, 0x48, 0xcc, 0x87, 0x68, 0xcc, 0x87, 0x48, 0xcc, 0xa3, 0x68,
+	0xcc, 0xa3, 0x48, 0xcc, 0x88, 0x68, 0xcc, 0x88, 0x48, 0xcc, 0xa7, 0x68,
+	0xcc, 0xa7, 0x48, 0xcc, 0xae, 0x68, 0xcc, 0xae, 0x49, 0xcc, 0xb0, 0x69,
+	0xcc, 0xb0, 0x49, 0xcc, 0x88, 0xcc, 0x81, 0x69, 0xcc, 0x88, 0xcc, 0x81,
+	0x4b, 0xcc, 0x81, 0x6b, 0xcc, 0x81, 0x4b, 0xcc, 0xa3, 0x6b, 0xcc, 0xa3,
+	0x4b, 0xcc, 0xb1, 0x6b, 0xcc, 0xb1, 0x4c, 0xcc, 0xa3, 0x6c, 0xcc, 0xa3,
+	0x4c, 0xcc, 0xa3, 0xcc, 0x84, 0x6c, 0xcc, 0xa3, 0xcc, 0x84, 0x4c, 0xcc,
+	0xb1, 0x6c, 0xcc, 0xb1, 0x4c, 0xcc, 0xad, 0x6c, 0xcc, 0xad, 0x4d, 0xcc,
+	0x81, 0x6d, 0xcc, 0x81, 0x4d, 0xcc, 0x87, 0x6d, 0xcc, 0x87, 0x4d, 0xcc,
+	0xa3, 0x6d, 0xcc, 0xa3, 0x4e, 0xcc, 0x87, 0x6e, 0xcc, 0x87, 0x4e, 0xcc,
+	0xa3, 0x6e, 0xcc, 0xa3, 0x4e, 0xcc, 0xb1, 0x6e, 0xcc, 0xb1, 0x4e, 0xcc,
+	0xad, 0x6e, 0xcc, 0xad, 0x4f, 0xcc, 0x83, 0xcc, 0x81, 0x6f, 0xcc, 0x83,
+	0xcc, 0x81, 0x4f, 0xcc, 0x83, 0xcc, 0x88, 0x6f, 0xcc, 0x83, 0xcc, 0x88,
+	0x4f, 0xcc, 0x84, 0xcc, 0x80, 0x6f, 0xcc, 0x84, 0xcc, 0x80, 0x4f, 0xcc,
+	0x84, 0xcc, 0x81, 0x6f, 0xcc, 0x84, 0xcc, 0x81, 0x50, 0xcc, 0x81, 0x70,
+	0xcc, 0x81, 0x50, 0xcc, 0x87, 0x70, 0xcc, 0x87, 0x52, 0xcc, 0x87, 0x72,
+	0xcc, 0x87, 0x52, 0xcc, 0xa3, 0x72, 0xcc, 0xa3, 0x52, 0xcc, 0xa3, 0xcc,
+	0x84, 0x72, 0xcc, 0xa3, 0xcc, 0x84, 0x52, 0xcc, 0xb1, 0x72, 0xcc, 0xb1,
+	0x53, 0xcc, 0x87, 0x73, 0xcc, 0x87, 0x53, 0xcc, 0xa3, 0x73, 0xcc, 0xa3,
+	0x53, 0xcc, 0x81, 0xcc, 0x87, 0x73, 0xcc, 0x81, 0xcc, 0x87, 0x53, 0xcc,
+	0x8c, 0xcc, 0x87, 0x73, 0xcc, 0x8c, 0xcc, 0x87, 0x53, 0xcc, 0xa3, 0xcc,
+	0x87, 0x73, 0xcc, 0xa3, 0xcc, 0x87, 0x54, 0xcc, 0x87, 0x74, 0xcc, 0x87,
+	0x54, 0xcc, 0xa3, 0x74, 0xcc, 0xa3, 0x54, 0xcc, 0xb1, 0x74, 0xcc, 0xb1,
+	0x54, 0xcc, 0xad, 0x74, 0xcc, 0xad, 0x55, 0xcc, 0xa4, 0x75, 0xcc, 0xa4,
+	0x55, 0xcc, 0xb0, 0x75, 0xcc, 0xb0, 0x55, 0xcc, 0xad, 0x75, 0xcc, 0xad,
+	0x55, 0xcc, 0x83, 0xcc, 0x81, 0x75, 0xcc, 0x83, 0xcc, 0x81, 0x55, 0xcc,
+	0x84, 0xcc, 0x88, 0x75, 0xcc, 0x84, 0xcc, 0x88, 0x56, 0xcc, 0x83, 0x76,
+	0xcc, 0x83, 0x56, 0xcc, 0xa3, 0x76, 0xcc, 0xa3, 0x57, 0xcc, 0x80, 0x77,
+	0xcc, 0x80, 0x57, 0xcc, 0x81, 0x77, 0xcc, 0x81, 0x57, 0xcc, 0x88, 0x77,
+	0xcc, 0x88, 0x57, 0xcc, 0x87, 0x77, 0xcc, 0x87, 0x57, 0xcc, 0xa3, 0x77,
+	0xcc, 0xa3, 0x58, 0xcc, 0x87, 0x78, 0xcc, 0x87, 0x58, 0xcc, 0x88, 0x78,
+	0xcc, 0x88, 0x59, 0xcc, 0x87, 0x79, 0xcc, 0x87, 0x5a, 0xcc, 0x82, 0x7a,
+	0xcc, 0x82, 0x5a, 0xcc, 0xa3, 0x7a, 0xcc, 0xa3, 0x5a, 0xcc, 0xb1, 0x7a,
+	0xcc, 0xb1, 0x68, 0xcc, 0xb1, 0x74, 0xcc, 0x88, 0x77, 0xcc, 0x8a, 0x79,
+	0xcc, 0x8a, 0x61, 0xca, 0xbe, 0x73, 0xcc, 0x87, 0x41, 0xcc, 0xa3, 0x61,
+	0xcc, 0xa3, 0x41, 0xcc, 0x89, 0x61, 0xcc, 0x89, 0x41, 0xcc, 0x82, 0xcc,
+	0x81, 0x61, 0xcc, 0x82, 0xcc, 0x81, 0x41, 0xcc, 0x82, 0xcc, 0x80, 0x61,
+	0xcc, 0x82, 0xcc, 0x80, 0x41, 0xcc, 0x82, 0xcc, 0x89, 0x61, 0xcc, 0x82,
+	0xcc, 0x89, 0x41, 0xcc, 0x82, 0xcc, 0x83, 0x61, 0xcc, 0x82, 0xcc, 0x83,
+	0x41, 0xcc, 0xa3, 0xcc, 0x82, 0x61, 0xcc, 0xa3, 0xcc, 0x82, 0x41, 0xcc,
+	0x86, 0xcc, 0x81, 0x61, 0xcc, 0x86, 0xcc, 0x81, 0x41, 0xcc, 0x86, 0xcc,
+	0x80, 0x61, 0xcc, 0x86, 0xcc, 0x80, 0x41, 0xcc, 0x86, 0xcc, 0x89, 0x61,
+	0xcc, 0x86, 0xcc, 0x89, 0x41, 0xcc, 0x86, 0xcc, 0x83, 0x61, 0xcc, 0x86,
+	0xcc, 0x83, 0x41, 0xcc, 0xa3, 0xcc, 0x86, 0x61, 0xcc, 0xa3, 0xcc, 0x86,
+	0x45, 0xcc, 0xa3, 0x65, 0xcc, 0xa3, 0x45, 0xcc, 0x89, 0x65, 0xcc, 0x89,
+	0x45, 0xcc, 0x83, 0x65, 0xcc, 0x83, 0x45, 0xcc, 0x82, 0xcc, 0x81, 0x65,
+	0xcc, 0x82, 0xcc, 0x81, 0x45, 0xcc, 0x82, 0xcc, 0x80, 0x65, 0xcc, 0x82,
+	0xcc, 0x80, 0x45, 0xcc, 0x82, 0xcc, 0x89, 0x65, 0xcc, 0x82, 0xcc, 0x89,
+	0x45, 0xcc, 0x82, 0xcc, 0x83, 0x65, 0xcc, 0x82, 0xcc, 0x83, 0x45, 0xcc,
+	0xa3, 0xcc, 0x82, 0x65, 0xcc, 0xa3, 0xcc, 0x82, 0x49, 0xcc, 0x89, 0x69,
+	0xcc, 0x89, 0x49, 0xcc, 0xa3, 0x69, 0xcc, 0xa3, 0x4f, 0xcc, 0xa3, 0x6f,
+	0xcc, 0xa3, 0x4f, 0xcc, 0x89, 0x6f, 0xcc, 0x89, 0x4f, 0xcc, 0x82, 0xcc,
+	0x81, 0x6f, 0xcc, 0x82, 0xcc, 0x81, 0x4f, 0xcc, 0x82, 0xcc, 0x80, 0x6f,
+	0xcc, 0x82, 0xcc, 0x80, 0x4f, 0xcc, 0x82, 0xcc, 0x89, 0x6f, 0xcc, 0x82,
+	0xcc, 0x89, 0x4f, 0xcc, 0x82, 0xcc, 0x83, 0x6f, 0xcc, 0x82, 0xcc, 0x83,
+	0x4f, 0xcc, 0xa3, 0xcc, 0x82, 0x6f, 0xcc, 0xa3, 0xcc, 0x82, 0x4f, 0xcc,
+	0x9b, 0xcc, 0x81, 0x6f, 0xcc, 0x9b, 0xcc, 0x81, 0x4f, 0xcc, 0x9b, 0xcc,
+	0x80, 0x6f, 0xcc, 0x9b, 0xcc, 0x80, 0x4f, 0xcc, 0x9b, 0xcc, 0x89, 0x6f,
+	0xcc, 0x9b, 0xcc, 0x89, 0x4f, 0xcc, 0x9b, 0xcc, 0x83, 0x6f, 0xcc, 0x9b,
+	0xcc, 0x83, 0x4f, 0xcc, 0x9b, 0xcc, 0xa3, 0x6f, 0xcc, 0x9b, 0xcc, 0xa3,
+	0x55, 0xcc, 0xa3, 0x75, 0xcc, 0xa3, 0x55, 0xcc, 0x89, 0x75, 0xcc, 0x89,
+	0x55, 0xcc, 0x9b, 0xcc, 0x81, 0x75, 0xcc, 0x9b, 0xcc, 0x81, 0x55, 0xcc,
+	0x9b, 0xcc, 0x80, 0x75, 0xcc, 0x9b, 0xcc, 0x80, 0x55, 0xcc, 0x9b, 0xcc,
+	0x89, 0x75, 0xcc, 0x9b, 0xcc, 0x89, 0x55, 0xcc, 0x9b, 0xcc, 0x83, 0x75,
+	0xcc, 0x9b, 0xcc, 0x83, 0x55, 0xcc, 0x9b, 0xcc, 0xa3, 0x75, 0xcc, 0x9b,
+	0xcc, 0xa3, 0x59, 0xcc, 0x80, 0x79, 0xcc, 0x80, 0x59, 0xcc, 0xa3, 0x79,
+	0xcc, 0xa3, 0x59, 0xcc, 0x89, 0x79, 0xcc, 0x89, 0x59, 0xcc, 0x83, 0x79,
+	0xcc, 0x83, 0xce, 0xb1, 0xcc, 0x93, 0xce, 0xb1, 0xcc, 0x94, 0xce, 0xb1,
+	0xcc, 0x93, 0xcc, 0x80, 0xce, 0xb1, 0xcc, 0x94, 0xcc, 0x80, 0xce, 0xb1,
+	0xcc, 0x93, 0xcc, 0x81, 0xce, 0xb1, 0xcc, 0x94, 0xcc, 0x81, 0xce, 0xb1,
+	0xcc, 0x93, 0xcd, 0x82, 0xce, 0xb1, 0xcc, 0x94, 0xcd, 0x82, 0xce, 0x91,
+	0xcc, 0x93, 0xce, 0x91, 0xcc, 0x94, 0xce, 0x91, 0xcc, 0x93, 0xcc, 0x80,
+	0xce, 0x91, 0xcc, 0x94, 0xcc, 0x80, 0xce, 0x91, 0xcc, 0x93, 0xcc, 0x81,
+	0xce, 0x91, 0xcc, 0x94, 0xcc, 0x81, 0xce, 0x91, 0xcc, 0x93, 0xcd, 0x82,
+	0xce, 0x91, 0xcc, 0x94, 0xcd, 0x82, 0xce, 0xb5, 0xcc, 0x93, 0xce, 0xb5,
+	0xcc, 0x94, 0xce, 0xb5, 0xcc, 0x93, 0xcc, 0x80, 0xce, 0xb5, 0xcc, 0x94,
+	0xcc, 0x80, 0xce, 0xb5, 0xcc, 0x93, 0xcc, 0x81, 0xce, 0xb5, 0xcc, 0x94,
+	0xcc, 0x81, 0xce, 0x95, 0xcc, 0x93, 0xce, 0x95, 0xcc, 0x94, 0xce, 0x95,
+	0xcc, 0x93, 0xcc, 0x80, 0xce, 0x95, 0xcc, 0x94, 0xcc, 0x80, 0xce, 0x95,
+	0xcc, 0x93, 0xcc, 0x81, 0xce, 0x95, 0xcc, 0x94, 0xcc, 0x81, 0xce, 0xb7,
+	0xcc, 0x93, 0xce, 0xb7, 0xcc, 0x94, 0xce, 0xb7, 0xcc, 0x93, 0xcc, 0x80,
+	0xce, 0xb7, 0xcc, 0x94, 0xcc, 0x80, 0xce, 0xb7, 0xcc, 0x93, 0xcc, 0x81,
+	0xce, 0xb7, 0xcc, 0x94, 0xcc, 0x81, 0xce, 0xb7, 0xcc, 0x93, 0xcd, 0x82,
+	0xce, 0xb7, 0xcc, 0x94, 0xcd, 0x82, 0xce, 0x97, 0xcc, 0x93, 0xce, 0x97,
+	0xcc, 0x94, 0xce, 0x97, 0xcc, 0x93, 0xcc, 0x80, 0xce, 0x97, 0xcc, 0x94,
+	0xcc, 0x80, 0xce, 0x97, 0xcc, 0x93, 0xcc, 0x81, 0xce, 0x97, 0xcc, 0x94,
+	0xcc, 0x81, 0xce, 0x97, 0xcc, 0x93, 0xcd, 0x82, 0xce, 0x97, 0xcc, 0x94,
+	0xcd, 0x82, 0xce, 0xb9, 0xcc, 0x93, 0xce, 0xb9, 0xcc, 0x94, 0xce, 0xb9,
+	0xcc, 0x93, 0xcc, 0x80, 0xce, 0xb9, 0xcc, 0x94, 0xcc, 0x80, 0xce, 0xb9,
+	0xcc, 0x93, 0xcc, 0x81, 0xce, 0xb9, 0xcc, 0x94, 0xcc, 0x81, 0xce, 0xb9,
+	0xcc, 0x93, 0xcd, 0x82, 0xce, 0xb9, 0xcc, 0x94, 0xcd, 0x82, 0xce, 0x99,
+	0xcc, 0x93, 0xce, 0x99, 0xcc, 0x94, 0xce, 0x99, 0xcc, 0x93, 0xcc, 0x80,
+	0xce, 0x99, 0xcc, 0x94, 0xcc, 0x80, 0xce, 0x99, 0xcc, 0x93, 0xcc, 0x81,
+	0xce, 0x99, 0xcc, 0x94, 0xcc, 0x81, 0xce, 0x99, 0xcc, 0x93, 0xcd, 0x82,
+	0xce, 0x99, 0xcc, 0x94, 0xcd, 0x82, 0xce, 0xbf, 0xcc, 0x93, 0xce, 0xbf,
+	0xcc, 0x94, 0xce, 0xbf, 0xcc, 0x93, 0xcc, 0x80, 0xce, 0xbf, 0xcc, 0x94,
+	0xcc, 0x80, 0xce, 0xbf, 0xcc, 0x93, 0xcc, 0x81, 0xce, 0xbf, 0xcc, 0x94,
+	0xcc, 0x81, 0xce, 0x9f, 0xcc, 0x93, 0xce, 0x9f, 0xcc, 0x94, 0xce, 0x9f,
+	0xcc, 0x93, 0xcc, 0x80, 0xce, 0x9f, 0xcc, 0x94, 0xcc, 0x80, 0xce, 0x9f,
+	0xcc, 0x93, 0xcc, 0x81, 0xce, 0x9f, 0xcc, 0x94, 0xcc, 0x81, 0xcf, 0x85,
+	0xcc, 0x93, 0xcf, 0x85, 0xcc, 0x94, 0xcf, 0x85, 0xcc, 0x93, 0xcc, 0x80,
+	0xcf, 0x85, 0xcc, 0x94, 0xcc, 0x80, 0xcf, 0x85, 0xcc, 0x93, 0xcc, 0x81,
+	0xcf, 0x85, 0xcc, 0x94, 0xcc, 0x81, 0xcf, 0x85, 0xcc, 0x93, 0xcd, 0x82,
+	0xcf, 0x85, 0xcc, 0x94, 0xcd, 0x82, 0xce, 0xa5, 0xcc, 0x94, 0xce, 0xa5,
+	0xcc, 0x94, 0xcc, 0x80, 0xce, 0xa5, 0xcc, 0x94, 0xcc, 0x81, 0xce, 0xa5,
+	0xcc, 0x94, 0xcd, 0x82, 0xcf, 0x89, 0xcc, 0x93, 0xcf, 0x89, 0xcc, 0x94,
+	0xcf, 0x89, 0xcc, 0x93, 0xcc, 0x80, 0xcf, 0x89, 0xcc, 0x94, 0xcc, 0x80,
+	0xcf, 0x89, 0xcc, 0x93, 0xcc, 0x81, 0xcf, 0x89, 0xcc, 0x94, 0xcc, 0x81,
+	0xcf, 0x89, 0xcc, 0x93, 0xcd, 0x82, 0xcf, 0x89, 0xcc, 0x94, 0xcd, 0x82,
+	0xce, 0xa9, 0xcc, 0x93, 0xce, 0xa9, 0xcc, 0x94, 0xce, 0xa9, 0xcc, 0x93,
+	0xcc, 0x80, 0xce, 0xa9, 0xcc, 0x94, 0xcc, 0x80, 0xce, 0xa9, 0xcc, 0x93,
+	0xcc, 0x81, 0xce, 0xa9, 0xcc, 0x94, 0xcc, 0x81, 0xce, 0xa9, 0xcc, 0x93,
+	0xcd, 0x82, 0xce, 0xa9, 0xcc, 0x94, 0xcd, 0x82, 0xce, 0xb1, 0xcc, 0x80,
+	0xce, 0xb1, 0xcc, 0x81, 0xce, 0xb5, 0xcc, 0x80, 0xce, 0xb5, 0xcc, 0x81,
+	0xce, 0xb7, 0xcc, 0x80, 0xce, 0xb7, 0xcc, 0x81, 0xce, 0xb9, 0xcc, 0x80,
+	0xce, 0xb9, 0xcc, 0x81, 0xce, 0xbf, 0xcc, 0x80, 0xce, 0xbf, 0xcc, 0x81,
+	0xcf, 0x85, 0xcc, 0x80, 0xcf, 0x85, 0xcc, 0x81, 0xcf, 0x89, 0xcc, 0x80,
+	0xcf, 0x89, 0xcc, 0x81, 0xce, 0xb1, 0xcc, 0x93, 0xcd, 0x85, 0xce, 0xb1,
+	0xcc, 0x94, 0xcd, 0x85, 0xce, 0xb1, 0xcc, 0x93, 0xcc, 0x80, 0xcd, 0x85,
+	0xce, 0xb1, 0xcc, 0x94, 0xcc, 0x80, 0xcd, 0x85, 0xce, 0xb1, 0xcc, 0x93,
+	0xcc, 0x81, 0xcd, 0x85, 0xce, 0xb1, 0xcc, 0x94, 0xcc, 0x81, 0xcd, 0x85,
+	0xce, 0xb1, 0xcc, 0x93, 0xcd, 0x82, 0xcd, 0x85, 0xce, 0xb1, 0xcc, 0x94,
+	0xcd, 0x82, 0xcd, 0x85, 0xce, 0x91, 0xcc, 0x93, 0xcd, 0x85, 0xce, 0x91,
+	0xcc, 0x94, 0xcd, 0x85, 0xce, 0x91, 0xcc, 0x93, 0xcc, 0x80, 0xcd, 0x85,
+	0xce, 0x91, 0xcc, 0x94, 0xcc, 0x80, 0xcd, 0x85, 0xce, 0x91, 0xcc, 0x93,
+	0xcc, 0x81, 0xcd, 0x85, 0xce, 0x91, 0xcc, 0x94, 0xcc, 0x81, 0xcd, 0x85,
+	0xce, 0x91, 0xcc, 0x93, 0xcd, 0x82, 0xcd, 0x85, 0xce, 0x91, 0xcc, 0x94,
+	0xcd, 0x82, 0xcd, 0x85, 0xce, 0xb7, 0xcc, 0x93, 0xcd, 0x85, 0xce, 0xb7,
+	0xcc, 0x94, 0xcd, 0x85, 0xce, 0xb7, 0xcc, 0x93, 0xcc, 0x80, 0xcd, 0x85,
+	0xce, 0xb7, 0xcc, 0x94, 0xcc, 0x80, 0xcd, 0x85, 0xce, 0xb7, 0xcc, 0x93,
+	0xcc, 0x81, 0xcd, 0x85, 0xce, 0xb7, 0xcc, 0x94, 0xcc, 0x81, 0xcd, 0x85,
+	0xce, 0xb7, 0xcc, 0x93, 0xcd, 0x82, 0xcd, 0x85, 0xce, 0xb7, 0xcc, 0x94,
+	0xcd, 0x82, 0xcd, 0x85, 0xce, 0x97, 0xcc, 0x93, 0xcd, 0x85, 0xce, 0x97,
+	0xcc, 0x94, 0xcd, 0x85, 0xce, 0x97, 0xcc, 0x93, 0xcc, 0x80, 0xcd, 0x85,
+	0xce, 0x97, 0xcc, 0x94, 0xcc, 0x80, 0xcd, 0x85, 0xce, 0x97, 0xcc, 0x93,
+	0xcc, 0x81, 0xcd, 0x85, 0xce, 0x97, 0xcc, 0x94, 0xcc, 0x81, 0xcd, 0x85,
+	0xce, 0x97, 0xcc, 0x93, 0xcd, 0x82, 0xcd, 0x85, 0xce, 0x97, 0xcc, 0x94,
+	0xcd, 0x82, 0xcd, 0x85, 0xcf, 0x89, 0xcc, 0x93, 0xcd, 0x85, 0xcf, 0x89,
+	0xcc, 0x94, 0xcd, 0x85, 0xcf, 0x89, 0xcc, 0x93, 0xcc, 0x80, 0xcd, 0x85,
+	0xcf, 0x89, 0xcc, 0x94, 0xcc, 0x80, 0xcd, 0x85, 0xcf, 0x89, 0xcc, 0x93,
+	0xcc, 0x81, 0xcd, 0x85, 0xcf, 0x89, 0xcc, 0x94, 0xcc, 0x81, 0xcd, 0x85,
+	0xcf, 0x89, 0xcc, 0x93, 0xcd, 0x82, 0xcd, 0x85, 0xcf, 0x89, 0xcc, 0x94,
+	0xcd, 0x82, 0xcd, 0x85, 0xce, 0xa9, 0xcc, 0x93, 0xcd, 0x85, 0xce, 0xa9,
+	0xcc, 0x94, 0xcd, 0x85, 0xce, 0xa9, 0xcc, 0x93, 0xcc, 0x80, 0xcd, 0x85,
+	0xce, 0xa9, 0xcc, 0x94, 0xcc, 0x80, 0xcd, 0x85, 0xce, 0xa9, 0xcc, 0x93,
+	0xcc, 0x81, 0xcd, 0x85, 0xce, 0xa9, 0xcc, 0x94, 0xcc, 0x81, 0xcd, 0x85,
+	0xce, 0xa9, 0xcc, 0x93, 0xcd, 0x82, 0xcd, 0x85, 0xce, 0xa9, 0xcc, 0x94,
+	0xcd, 0x82, 0xcd, 0x85, 0xce, 0xb1, 0xcc, 0x86, 0xce, 0xb1, 0xcc, 0x84,
+	0xce, 0xb1, 0xcc, 0x80, 0xcd, 0x85, 0xce, 0xb1, 0xcd, 0x85, 0xce, 0xb1,
+	0xcc, 0x81, 0xcd, 0x85, 0xce, 0xb1, 0xcd, 0x82, 0xce, 0xb1, 0xcd, 0x82,
+	0xcd, 0x85, 0xce, 0x91, 0xcc, 0x86, 0xce, 0x91, 0xcc, 0x84, 0xce, 0x91,
+	0xcc, 0x80, 0xce, 0x91, 0xcc, 0x81, 0xce, 0x91, 0xcd, 0x85, 0x20, 0xcc,
+	0x93, 0xce, 0xb9, 0x20, 0xcc, 0x93, 0x20, 0xcd, 0x82, 0x20, 0xcc, 0x88,
+	0xcd, 0x82, 0xce, 0xb7, 0xcc, 0x80, 0xcd, 0x85, 0xce, 0xb7, 0xcd, 0x85,
+	0xce, 0xb7, 0xcc, 0x81, 0xcd, 0x85, 0xce, 0xb7, 0xcd, 0x82, 0xce, 0xb7,
+	0xcd, 0x82, 0xcd, 0x85, 0xce, 0x95, 0xcc, 0x80, 0xce, 0x95, 0xcc, 0x81,
+	0xce, 0x97, 0xcc, 0x80, 0xce, 0x97, 0xcc, 0x81, 0xce, 0x97, 0xcd, 0x85,
+	0x20, 0xcc, 0x93, 0xcc, 0x80, 0x20, 0xcc, 0x93, 0xcc, 0x81, 0x20, 0xcc,
+	0x93, 0xcd, 0x82, 0xce, 0xb9, 0xcc, 0x86, 0xce, 0xb9, 0xcc, 0x84, 0xce,
+	0xb9, 0xcc, 0x88, 0xcc, 0x80, 0xce, 0xb9, 0xcc, 0x88, 0xcc, 0x81, 0xce,
+	0xb9, 0xcd, 0x82, 0xce, 0xb9, 0xcc, 0x88, 0xcd, 0x82, 0xce, 0x99, 0xcc,
+	0x86, 0xce, 0x99, 0xcc, 0x84, 0xce, 0x99, 0xcc, 0x80, 0xce, 0x99, 0xcc,
+	0x81, 0x20, 0xcc, 0x94, 0xcc, 0x80, 0x20, 0xcc, 0x94, 0xcc, 0x81, 0x20,
+	0xcc, 0x94, 0xcd, 0x82, 0xcf, 0x85, 0xcc, 0x86, 0xcf, 0x85, 0xcc, 0x84,
+	0xcf, 0x85, 0xcc, 0x88, 0xcc, 0x80, 0xcf, 0x85, 0xcc, 0x88, 0xcc, 0x81,
+	0xcf, 0x81, 0xcc, 0x93, 0xcf, 0x81, 0xcc, 0x94, 0xcf, 0x85, 0xcd, 0x82,
+	0xcf, 0x85, 0xcc, 0x88, 0xcd, 0x82, 0xce, 0xa5, 0xcc, 0x86, 0xce, 0xa5,
+	0xcc, 0x84, 0xce, 0xa5, 0xcc, 0x80, 0xce, 0xa5, 0xcc, 0x81, 0xce, 0xa1,
+	0xcc, 0x94, 0x20, 0xcc, 0x88, 0xcc, 0x80, 0x20, 0xcc, 0x88, 0xcc, 0x81,
+	0x60, 0xcf, 0x89, 0xcc, 0x80, 0xcd, 0x85, 0xcf, 0x89, 0xcd, 0x85, 0xcf,
+	0x89, 0xcc, 0x81, 0xcd, 0x85, 0xcf, 0x89, 0xcd, 0x82, 0xcf, 0x89, 0xcd,
+	0x82, 0xcd, 0x85, 0xce, 0x9f, 0xcc, 0x80, 0xce, 0x9f, 0xcc, 0x81, 0xce,
+	0xa9, 0xcc, 0x80, 0xce, 0xa9, 0xcc, 0x81, 0xce, 0xa9, 0xcd, 0x85, 0x20,
+	0xcc, 0x81, 0x20, 0xcc, 0x94, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0xe2, 0x80, 0x90, 0x20, 0xcc, 0xb3, 0x2e, 0x2e,
+	0x2e, 0x2e, 0x2e, 0x2e, 0x20, 0xe2, 0x80, 0xb2, 0xe2, 0x80, 0xb2, 0xe2,
+	0x80, 0xb2, 0xe2, 0x80, 0xb2, 0xe2, 0x80, 0xb2, 0xe2, 0x80, 0xb5, 0xe2,
+	0x80, 0xb5, 0xe2, 0x80, 0xb5, 0xe2, 0x80, 0xb5, 0xe2, 0x80, 0xb5, 0x21,
+	0x21, 0x20, 0xcc, 0x85, 0x3f, 0x3f, 0x3f, 0x21, 0x21, 0x3f, 0xe2, 0x80,
+	0xb2, 0xe2, 0x80, 0xb2, 0xe2, 0x80, 0xb2, 0xe2, 0x80, 0xb2, 0x20, 0x30,
+	0x69, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x2b, 0xe2, 0x88, 0x92, 0x3d,
+	0x28, 0x29, 0x6e, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+	0x39, 0x2b, 0xe2, 0x88, 0x92, 0x3d, 0x28, 0x29, 0x61, 0x65, 0x6f, 0x78,
+	0xc9, 0x99, 0x68, 0x6b, 0x6c, 0x6d, 0x6e, 0x70, 0x73, 0x74, 0x52, 0x73,
+	0x61, 0x2f, 0x63, 0x61, 0x2f, 0x73, 0x43, 0xc2, 0xb0, 0x43, 0x63, 0x2f,
+	0x6f, 0x63, 0x2f, 0x75, 0xc6, 0x90, 0xc2, 0xb0, 0x46, 0x67, 0x48, 0x48,
+	0x48, 0x68, 0xc4, 0xa7, 0x49, 0x49, 0x4c, 0x6c, 0x4e, 0x4e, 0x6f, 0x50,
+	0x51, 0x52, 0x52, 0x52, 0x53, 0x4d, 0x54, 0x45, 0x4c, 0x54, 0x4d, 0x5a,
+	0xce, 0xa9, 0x5a, 0x4b, 0x41, 0xcc, 0x8a, 0x42, 0x43, 0x65, 0x45, 0x46,
+	0x4d, 0x6f, 0xd7, 0x90, 0xd7, 0x91, 0xd7, 0x92, 0xd7, 0x93, 0x69, 0x46,
+	0x41, 0x58, 0xcf, 0x80, 0xce, 0xb3, 0xce, 0x93, 0xce, 0xa0, 0xe2, 0x88,
+	0x91, 0x44, 0x64, 0x65, 0x69, 0x6a, 0x31, 0xe2, 0x81, 0x84, 0x37, 0x31,
+	0xe2, 0x81, 0x84, 0x39, 0x31, 0xe2, 0x81, 0x84, 0x31, 0x30, 0x31, 0xe2,
+	0x81, 0x84, 0x33, 0x32, 0xe2, 0x81, 0x84, 0x33, 0x31, 0xe2, 0x81, 0x84,
+	0x35, 0x32, 0xe2, 0x81, 0x84, 0x35, 0x33, 0xe2, 0x81, 0x84, 0x35, 0x34,
+	0xe2, 0x81, 0x84, 0x35, 0x31, 0xe2, 0x81, 0x84, 0x36, 0x35, 0xe2, 0x81,
+	0x84, 0x36, 0x31, 0xe2, 0x81, 0x84, 0x38, 0x33, 0xe2, 0x81, 0x84, 0x38,
+	0x35, 0xe2, 0x81, 0x84, 0x38, 0x37, 0xe2, 0x81, 0x84, 0x38, 0x31, 0xe2,
+	0x81, 0x84, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x56, 0x56, 0x56,
+	0x49, 0x56, 0x49, 0x49, 0x56, 0x49, 0x49, 0x49, 0x49, 0x58, 0x58, 0x58,
+	0x49, 0x58, 0x49, 0x49, 0x4c, 0x43, 0x44, 0x4d, 0x69, 0x69, 0x69, 0x69,
+	0x69, 0x69, 0x69, 0x76, 0x76, 0x76, 0x69, 0x76, 0x69, 0x69, 0x76, 0x69,
+	0x69, 0x69, 0x69, 0x78, 0x78, 0x78, 0x69, 0x78, 0x69, 0x69, 0x6c, 0x63,
+	0x64, 0x6d, 0x30, 0xe2, 0x81, 0x84, 0x33, 0xe2, 0x86, 0x90, 0xcc, 0xb8,
+	0xe2, 0x86, 0x92, 0xcc, 0xb8, 0xe2, 0x86, 0x94, 0xcc, 0xb8, 0xe2, 0x87,
+	0x90, 0xcc, 0xb8, 0xe2, 0x87, 0x94, 0xcc, 0xb8, 0xe2, 0x87, 0x92, 0xcc,
+	0xb8, 0xe2, 0x88, 0x83, 0xcc, 0xb8, 0xe2, 0x88, 0x88, 0xcc, 0xb8, 0xe2,
+	0x88, 0x8b, 0xcc, 0xb8, 0xe2, 0x88, 0xa3, 0xcc, 0xb8, 0xe2, 0x88, 0xa5,
+	0xcc, 0xb8, 0xe2, 0x88, 0xab, 0xe2, 0x88, 0xab, 0xe2, 0x88, 0xab, 0xe2,
+	0x88, 0xab, 0xe2, 0x88, 0xab, 0xe2, 0x88, 0xae, 0xe2, 0x88, 0xae, 0xe2,
+	0x88, 0xae, 0xe2, 0x88, 0xae, 0xe2, 0x88, 0xae, 0xe2, 0x88, 0xbc, 0xcc,
+	0xb8, 0xe2, 0x89, 0x83, 0xcc, 0xb8, 0xe2, 0x89, 0x85, 0xcc, 0xb8, 0xe2,
+	0x89, 0x88, 0xcc, 0xb8, 0x3d, 0xcc, 0xb8, 0xe2, 0x89, 0xa1, 0xcc, 0xb8,
+	0xe2, 0x89, 0x8d, 0xcc, 0xb8, 0x3c, 0xcc, 0xb8, 0x3e, 0xcc, 0xb8, 0xe2,
+	0x89, 0xa4, 0xcc, 0xb8, 0xe2, 0x89, 0xa5, 0xcc, 0xb8, 0xe2, 0x89, 0xb2,
+	0xcc, 0xb8, 0xe2, 0x89, 0xb3, 0xcc, 0xb8, 0xe2, 0x89, 0xb6, 0xcc, 0xb8,
+	0xe2, 0x89, 0xb7, 0xcc, 0xb8, 0xe2, 0x89, 0xba, 0xcc, 0xb8, 0xe2, 0x89,
+	0xbb, 0xcc, 0xb8, 0xe2, 0x8a, 0x82, 0xcc, 0xb8, 0xe2, 0x8a, 0x83, 0xcc,
+	0xb8, 0xe2, 0x8a, 0x86, 0xcc, 0xb8, 0xe2, 0x8a, 0x87, 0xcc, 0xb8, 0xe2,
+	0x8a, 0xa2, 0xcc, 0xb8, 0xe2, 0x8a, 0xa8, 0xcc, 0xb8, 0xe2, 0x8a, 0xa9,
+	0xcc, 0xb8, 0xe2, 0x8a, 0xab, 0xcc, 0xb8, 0xe2, 0x89, 0xbc, 0xcc, 0xb8,
+	0xe2, 0x89, 0xbd, 0xcc, 0xb8, 0xe2, 0x8a, 0x91, 0xcc, 0xb8, 0xe2, 0x8a,
+	0x92, 0xcc, 0xb8, 0xe2, 0x8a, 0xb2, 0xcc, 0xb8, 0xe2, 0x8a, 0xb3, 0xcc,
+	0xb8, 0xe2, 0x8a, 0xb4, 0xcc, 0xb8, 0xe2, 0x8a, 0xb5, 0xcc, 0xb8, 0xe3,
+	0x80, 0x88, 0xe3, 0x80, 0x89, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+	0x38, 0x39, 0x31, 0x30, 0x31, 0x31, 0x31, 0x32, 0x31, 0x33, 0x31, 0x34,
+	0x31, 0x35, 0x31, 0x36, 0x31, 0x37, 0x31, 0x38, 0x31, 0x39, 0x32, 0x30,
+	0x28, 0x31, 0x29, 0x28, 0x32, 0x29, 0x28, 0x33, 0x29, 0x28, 0x34, 0x29,
+	0x28, 0x35, 0x29, 0x28, 0x36, 0x29, 0x28, 0x37, 0x29, 0x28, 0x38, 0x29,
+	0x28, 0x39, 0x29, 0x28, 0x31, 0x30, 0x29, 0x28, 0x31, 0x31, 0x29, 0x28,
+	0x31, 0x32, 0x29, 0x28, 0x31, 0x33, 0x29, 0x28, 0x31, 0x34, 0x29, 0x28,
+	0x31, 0x35, 0x29, 0x28, 0x31, 0x36, 0x29, 0x28, 0x31, 0x37, 0x29, 0x28,
+	0x31, 0x38, 0x29, 0x28, 0x31, 0x39, 0x29, 0x28, 0x32, 0x30, 0x29, 0x31,
+	0x2e, 0x32, 0x2e, 0x33, 0x2e, 0x34, 0x2e, 0x35, 0x2e, 0x36, 0x2e, 0x37,
+	0x2e, 0x38, 0x2e, 0x39, 0x2e, 0x31, 0x30, 0x2e, 0x31, 0x31, 0x2e, 0x31,
+	0x32, 0x2e, 0x31, 0x33, 0x2e, 0x31, 0x34, 0x2e, 0x31, 0x35, 0x2e, 0x31,
+	0x36, 0x2e, 0x31, 0x37, 0x2e, 0x31, 0x38, 0x2e, 0x31, 0x39, 0x2e, 0x32,
+	0x30, 0x2e, 0x28, 0x61, 0x29, 0x28, 0x62, 0x29, 0x28, 0x63, 0x29, 0x28,
+	0x64, 0x29, 0x28, 0x65, 0x29, 0x28, 0x66, 0x29, 0x28, 0x67, 0x29, 0x28,
+	0x68, 0x29, 0x28, 0x69, 0x29, 0x28, 0x6a, 0x29, 0x28, 0x6b, 0x29, 0x28,
+	0x6c, 0x29, 0x28, 0x6d, 0x29, 0x28, 0x6e, 0x29, 0x28, 0x6f, 0x29, 0x28,
+	0x70, 0x29, 0x28, 0x71, 0x29, 0x28, 0x72, 0x29, 0x28, 0x73, 0x29, 0x28,
+	0x74, 0x29, 0x28, 0x75, 0x29, 0x28, 0x76, 0x29, 0x28, 0x77, 0x29, 0x28,
+	0x78, 0x29, 0x28, 0x79, 0x29, 0x28, 0x7a, 0x29, 0x41, 0x42, 0x43, 0x44,
+	0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+	0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x61, 0x62,
+	0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e,
+	0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+	0x30, 0xe2, 0x88, 0xab, 0xe2, 0x88, 0xab, 0xe2, 0x88, 0xab, 0xe2, 0x88,
+	0xab, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0xe2, 0xab, 0x9d,
+	0xcc, 0xb8, 0x6a, 0x56, 0xe2, 0xb5, 0xa1, 0xe6, 0xaf, 0x8d, 0xe9, 0xbe,
+	0x9f, 0xe4, 0xb8, 0x80, 0xe4, 0xb8, 0xa8, 0xe4, 0xb8, 0xb6, 0xe4, 0xb8,
+	0xbf, 0xe4, 0xb9, 0x99, 0xe4, 0xba, 0x85, 0xe4, 0xba, 0x8c, 0xe4, 0xba,
+	0xa0, 0xe4, 0xba, 0xba, 0xe5, 0x84, 0xbf, 0xe5, 0x85, 0xa5, 0xe5, 0x85,
+	0xab, 0xe5, 0x86, 0x82, 0xe5, 0x86, 0x96, 0xe5, 0x86, 0xab, 0xe5, 0x87,
+	0xa0, 0xe5, 0x87, 0xb5, 0xe5, 0x88, 0x80, 0xe5, 0x8a, 0x9b, 0xe5, 0x8b,
+	0xb9, 0xe5, 0x8c, 0x95, 0xe5, 0x8c, 0x9a, 0xe5, 0x8c, 0xb8, 0xe5, 0x8d,
+	0x81, 0xe5, 0x8d, 0x9c, 0xe5, 0x8d, 0xa9, 0xe5, 0x8e, 0x82, 0xe5, 0x8e,
+	0xb6, 0xe5, 0x8f, 0x88, 0xe5, 0x8f, 0xa3, 0xe5, 0x9b, 0x97, 0xe5, 0x9c,
+	0x9f, 0xe5, 0xa3, 0xab, 0xe5, 0xa4, 0x82, 0xe5, 0xa4, 0x8a, 0xe5, 0xa4,
+	0x95, 0xe5, 0xa4, 0xa7, 0xe5, 0xa5, 0xb3, 0xe5, 0xad, 0x90, 0xe5, 0xae,
+	0x80, 0xe5, 0xaf, 0xb8, 0xe5, 0xb0, 0x8f, 0xe5, 0xb0, 0xa2, 0xe5, 0xb0,
+	0xb8, 0xe5, 0xb1, 0xae, 0xe5, 0xb1, 0xb1, 0xe5, 0xb7, 0x9b, 0xe5, 0xb7,
+	0xa5, 0xe5, 0xb7, 0xb1, 0xe5, 0xb7, 0xbe, 0xe5, 0xb9, 0xb2, 0xe5, 0xb9,
+	0xba, 0xe5, 0xb9, 0xbf, 0xe5, 0xbb, 0xb4, 0xe5, 0xbb, 0xbe, 0xe5, 0xbc,
+	0x8b, 0xe5, 0xbc, 0x93, 0xe5, 0xbd, 0x90, 0xe5, 0xbd, 0xa1, 0xe5, 0xbd,
+	0xb3, 0xe5, 0xbf, 0x83, 0xe6, 0x88, 0x88, 0xe6, 0x88, 0xb6, 0xe6, 0x89,
+	0x8b, 0xe6, 0x94, 0xaf, 0xe6, 0x94, 0xb4, 0xe6, 0x96, 0x87, 0xe6, 0x96,
+	0x97, 0xe6, 0x96, 0xa4, 0xe6, 0x96, 0xb9, 0xe6, 0x97, 0xa0, 0xe6, 0x97,
+	0xa5, 0xe6, 0x9b, 0xb0, 0xe6, 0x9c, 0x88, 0xe6, 0x9c, 0xa8, 0xe6, 0xac,
+	0xa0, 0xe6, 0xad, 0xa2, 0xe6, 0xad, 0xb9, 0xe6, 0xae, 0xb3, 0xe6, 0xaf,
+	0x8b, 0xe6, 0xaf, 0x94, 0xe6, 0xaf, 0x9b, 0xe6, 0xb0, 0x8f, 0xe6, 0xb0,
+	0x94, 0xe6, 0xb0, 0xb4, 0xe7, 0x81, 0xab, 0xe7, 0x88, 0xaa, 0xe7, 0x88,
+	0xb6, 0xe7, 0x88, 0xbb, 0xe7, 0x88, 0xbf, 0xe7, 0x89, 0x87, 0xe7, 0x89,
+	0x99, 0xe7, 0x89, 0x9b, 0xe7, 0x8a, 0xac, 0xe7, 0x8e, 0x84, 0xe7, 0x8e,
+	0x89, 0xe7, 0x93, 0x9c, 0xe7, 0x93, 0xa6, 0xe7, 0x94, 0x98, 0xe7, 0x94,
+	0x9f, 0xe7, 0x94, 0xa8, 0xe7, 0x94, 0xb0, 0xe7, 0x96, 0x8b, 0xe7, 0x96,
+	0x92, 0xe7, 0x99, 0xb6, 0xe7, 0x99, 0xbd, 0xe7, 0x9a, 0xae, 0xe7, 0x9a,
+	0xbf, 0xe7, 0x9b, 0xae, 0xe7, 0x9f, 0x9b, 0xe7, 0x9f, 0xa2, 0xe7, 0x9f,
+	0xb3, 0xe7, 0xa4, 0xba, 0xe7, 0xa6, 0xb8, 0xe7, 0xa6, 0xbe, 0xe7, 0xa9,
+	0xb4, 0xe7, 0xab, 0x8b, 0xe7, 0xab, 0xb9, 0xe7, 0xb1, 0xb3, 0xe7, 0xb3,
+	0xb8, 0xe7, 0xbc, 0xb6, 0xe7, 0xbd, 0x91, 0xe7, 0xbe, 0x8a, 0xe7, 0xbe,
+	0xbd, 0xe8, 0x80, 0x81, 0xe8, 0x80, 0x8c, 0xe8, 0x80, 0x92, 0xe8, 0x80,
+	0xb3, 0xe8, 0x81, 0xbf, 0xe8, 0x82, 0x89, 0xe8, 0x87, 0xa3, 0xe8, 0x87,
+	0xaa, 0xe8, 0x87, 0xb3, 0xe8, 0x87, 0xbc, 0xe8, 0x88, 0x8c, 0xe8, 0x88,
+	0x9b, 0xe8, 0x88, 0x9f, 0xe8, 0x89, 0xae, 0xe8, 0x89, 0xb2, 0xe8, 0x89,
+	0xb8, 0xe8, 0x99, 0x8d, 0xe8, 0x99, 0xab, 0xe8, 0xa1, 0x80, 0xe8, 0xa1,
+	0x8c, 0xe8, 0xa1, 0xa3, 0xe8, 0xa5, 0xbe, 0xe8, 0xa6, 0x8b, 0xe8, 0xa7,
+	0x92, 0xe8, 0xa8, 0x80, 0xe8, 0xb0, 0xb7, 0xe8, 0xb1, 0x86, 0xe8, 0xb1,
+	0x95, 0xe8, 0xb1, 0xb8, 0xe8, 0xb2, 0x9d, 0xe8, 0xb5, 0xa4, 0xe8, 0xb5,
+	0xb0, 0xe8, 0xb6, 0xb3, 0xe8, 0xba, 0xab, 0xe8, 0xbb, 0x8a, 0xe8, 0xbe,
+	0x9b, 0xe8, 0xbe, 0xb0, 0xe8, 0xbe, 0xb5, 0xe9, 0x82, 0x91, 0xe9, 0x85,
+	0x89, 0xe9, 0x87, 0x86, 0xe9, 0x87, 0x8c, 0xe9, 0x87, 0x91, 0xe9, 0x95,
+	0xb7, 0xe9, 0x96, 0x80, 0xe9, 0x98, 0x9c, 0xe9, 0x9a, 0xb6, 0xe9, 0x9a,
+	0xb9, 0xe9, 0x9b, 0xa8, 0xe9, 0x9d, 0x91, 0xe9, 0x9d, 0x9e, 0xe9, 0x9d,
+	0xa2, 0xe9, 0x9d, 0xa9, 0xe9, 0x9f, 0x8b, 0xe9, 0x9f, 0xad, 0xe9, 0x9f,
+	0xb3, 0xe9, 0xa0, 0x81, 0xe9, 0xa2, 0xa8, 0xe9, 0xa3, 0x9b, 0xe9, 0xa3,
+	0x9f, 0xe9, 0xa6, 0x96, 0xe9, 0xa6, 0x99, 0xe9, 0xa6, 0xac, 0xe9, 0xaa,
+	0xa8, 0xe9, 0xab, 0x98, 0xe9, 0xab, 0x9f, 0xe9, 0xac, 0xa5, 0xe9, 0xac,
+	0xaf, 0xe9, 0xac, 0xb2, 0xe9, 0xac, 0xbc, 0xe9, 0xad, 0x9a, 0xe9, 0xb3,
+	0xa5, 0xe9, 0xb9, 0xb5, 0xe9, 0xb9, 0xbf, 0xe9, 0xba, 0xa5, 0xe9, 0xba,
+	0xbb, 0xe9, 0xbb, 0x83, 0xe9, 0xbb, 0x8d, 0xe9, 0xbb, 0x91, 0xe9, 0xbb,
+	0xb9, 0xe9, 0xbb, 0xbd, 0xe9, 0xbc, 0x8e, 0xe9, 0xbc, 0x93, 0xe9, 0xbc,
+	0xa0, 0xe9, 0xbc, 0xbb, 0xe9, 0xbd, 0x8a, 0xe9, 0xbd, 0x92, 0xe9, 0xbe,
+	0x8d, 0xe9, 0xbe, 0x9c, 0xe9, 0xbe, 0xa0, 0x20, 0xe3, 0x80, 0x92, 0xe5,
+	0x8d, 0x81, 0xe5, 0x8d, 0x84, 0xe5, 0x8d, 0x85, 0xe3, 0x81, 0x8b, 0xe3,
+	0x82, 0x99, 0xe3, 0x81, 0x8d, 0xe3, 0x82, 0x99, 0xe3, 0x81, 0x8f, 0xe3,
+	0x82, 0x99, 0xe3, 0x81, 0x91, 0xe3, 0x82, 0x99, 0xe3, 0x81, 0x93, 0xe3,
+	0x82, 0x99, 0xe3, 0x81, 0x95, 0xe3, 0x82, 0x99, 0xe3, 0x81, 0x97, 0xe3,
+	0x82, 0x99, 0xe3, 0x81, 0x99, 0xe3, 0x82, 0x99, 0xe3, 0x81, 0x9b, 0xe3,
+	0x82, 0x99, 0xe3, 0x81, 0x9d, 0xe3, 0x82, 0x99, 0xe3, 0x81, 0x9f, 0xe3,
+	0x82, 0x99, 0xe3, 0x81, 0xa1, 0xe3, 0x82, 0x99, 0xe3, 0x81, 0xa4, 0xe3,
+	0x82, 0x99, 0xe3, 0x81, 0xa6, 0xe3, 0x82, 0x99, 0xe3, 0x81, 0xa8, 0xe3,
+	0x82, 0x99, 0xe3, 0x81, 0xaf, 0xe3, 0x82, 0x99, 0xe3, 0x81, 0xaf, 0xe3,
+	0x82, 0x9a, 0xe3, 0x81, 0xb2, 0xe3, 0x82, 0x99, 0xe3, 0x81, 0xb2, 0xe3,
+	0x82, 0x9a, 0xe3, 0x81, 0xb5, 0xe3, 0x82, 0x99, 0xe3, 0x81, 0xb5, 0xe3,
+	0x82, 0x9a, 0xe3, 0x81, 0xb8, 0xe3, 0x82, 0x99, 0xe3, 0x81, 0xb8, 0xe3,
+	0x82, 0x9a, 0xe3, 0x81, 0xbb, 0xe3, 0x82, 0x99, 0xe3, 0x81, 0xbb, 0xe3,
+	0x82, 0x9a, 0xe3, 0x81, 0x86, 0xe3, 0x82, 0x99, 0x20, 0xe3, 0x82, 0x99,
+	0x20, 0xe3, 0x82, 0x9a, 0xe3, 0x82, 0x9d, 0xe3, 0x82, 0x99, 0xe3, 0x82,
+	0x88, 0xe3, 0x82, 0x8a, 0xe3, 0x82, 0xab, 0xe3, 0x82, 0x99, 0xe3, 0x82,
+	0xad, 0xe3, 0x82, 0x99, 0xe3, 0x82, 0xaf, 0xe3, 0x82, 0x99, 0xe3, 0x82,
+	0xb1, 0xe3, 0x82, 0x99, 0xe3, 0x82, 0xb3, 0xe3, 0x82, 0x99, 0xe3, 0x82,
+	0xb5, 0xe3, 0x82, 0x99, 0xe3, 0x82, 0xb7, 0xe3, 0x82, 0x99, 0xe3, 0x82,
+	0xb9, 0xe3, 0x82, 0x99, 0xe3, 0x82, 0xbb, 0xe3, 0x82, 0x99, 0xe3, 0x82,
+	0xbd, 0xe3, 0x82, 0x99, 0xe3, 0x82, 0xbf, 0xe3, 0x82, 0x99, 0xe3, 0x83,
+	0x81, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0x84, 0xe3, 0x82, 0x99, 0xe3, 0x83,
+	0x86, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0x88, 0xe3, 0x82, 0x99, 0xe3, 0x83,
+	0x8f, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0x8f, 0xe3, 0x82, 0x9a, 0xe3, 0x83,
+	0x92, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0x92, 0xe3, 0x82, 0x9a, 0xe3, 0x83,
+	0x95, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0x95, 0xe3, 0x82, 0x9a, 0xe3, 0x83,
+	0x98, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0x98, 0xe3, 0x82, 0x9a, 0xe3, 0x83,
+	0x9b, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0x9b, 0xe3, 0x82, 0x9a, 0xe3, 0x82,
+	0xa6, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xaf, 0xe3, 0x82, 0x99, 0xe3, 0x83,
+	0xb0, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xb1, 0xe3, 0x82, 0x99, 0xe3, 0x83,
+	0xb2, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xbd, 0xe3, 0x82, 0x99, 0xe3, 0x82,
+	0xb3, 0xe3, 0x83, 0x88, 0xe1, 0x84, 0x80, 0xe1, 0x84, 0x81, 0xe1, 0x86,
+	0xaa, 0xe1, 0x84, 0x82, 0xe1, 0x86, 0xac, 0xe1, 0x86, 0xad, 0xe1, 0x84,
+	0x83, 0xe1, 0x84, 0x84, 0xe1, 0x84, 0x85, 0xe1, 0x86, 0xb0, 0xe1, 0x86,
+	0xb1, 0xe1, 0x86, 0xb2, 0xe1, 0x86, 0xb3, 0xe1, 0x86, 0xb4, 0xe1, 0x86,
+	0xb5, 0xe1, 0x84, 0x9a, 0xe1, 0x84, 0x86, 0xe1, 0x84, 0x87, 0xe1, 0x84,
+	0x88, 0xe1, 0x84, 0xa1, 0xe1, 0x84, 0x89, 0xe1, 0x84, 0x8a, 0xe1, 0x84,
+	0x8b, 0xe1, 0x84, 0x8c, 0xe1, 0x84, 0x8d, 0xe1, 0x84, 0x8e, 0xe1, 0x84,
+	0x8f, 0xe1, 0x84, 0x90, 0xe1, 0x84, 0x91, 0xe1, 0x84, 0x92, 0xe1, 0x85,
+	0xa1, 0xe1, 0x85, 0xa2, 0xe1, 0x85, 0xa3, 0xe1, 0x85, 0xa4, 0xe1, 0x85,
+	0xa5, 0xe1, 0x85, 0xa6, 0xe1, 0x85, 0xa7, 0xe1, 0x85, 0xa8, 0xe1, 0x85,
+	0xa9, 0xe1, 0x85, 0xaa, 0xe1, 0x85, 0xab, 0xe1, 0x85, 0xac, 0xe1, 0x85,
+	0xad, 0xe1, 0x85, 0xae, 0xe1, 0x85, 0xaf, 0xe1, 0x85, 0xb0, 0xe1, 0x85,
+	0xb1, 0xe1, 0x85, 0xb2, 0xe1, 0x85, 0xb3, 0xe1, 0x85, 0xb4, 0xe1, 0x85,
+	0xb5, 0xe1, 0x85, 0xa0, 0xe1, 0x84, 0x94, 0xe1, 0x84, 0x95, 0xe1, 0x87,
+	0x87, 0xe1, 0x87, 0x88, 0xe1, 0x87, 0x8c, 0xe1, 0x87, 0x8e, 0xe1, 0x87,
+	0x93, 0xe1, 0x87, 0x97, 0xe1, 0x87, 0x99, 0xe1, 0x84, 0x9c, 0xe1, 0x87,
+	0x9d, 0xe1, 0x87, 0x9f, 0xe1, 0x84, 0x9d, 0xe1, 0x84, 0x9e, 0xe1, 0x84,
+	0xa0, 0xe1, 0x84, 0xa2, 0xe1, 0x84, 0xa3, 0xe1, 0x84, 0xa7, 0xe1, 0x84,
+	0xa9, 0xe1, 0x84, 0xab, 0xe1, 0x84, 0xac, 0xe1, 0x84, 0xad, 0xe1, 0x84,
+	0xae, 0xe1, 0x84, 0xaf, 0xe1, 0x84, 0xb2, 0xe1, 0x84, 0xb6, 0xe1, 0x85,
+	0x80, 0xe1, 0x85, 0x87, 0xe1, 0x85, 0x8c, 0xe1, 0x87, 0xb1, 0xe1, 0x87,
+	0xb2, 0xe1, 0x85, 0x97, 0xe1, 0x85, 0x98, 0xe1, 0x85, 0x99, 0xe1, 0x86,
+	0x84, 0xe1, 0x86, 0x85, 0xe1, 0x86, 0x88, 0xe1, 0x86, 0x91, 0xe1, 0x86,
+	0x92, 0xe1, 0x86, 0x94, 0xe1, 0x86, 0x9e, 0xe1, 0x86, 0xa1, 0xe4, 0xb8,
+	0x80, 0xe4, 0xba, 0x8c, 0xe4, 0xb8, 0x89, 0xe5, 0x9b, 0x9b, 0xe4, 0xb8,
+	0x8a, 0xe4, 0xb8, 0xad, 0xe4, 0xb8, 0x8b, 0xe7, 0x94, 0xb2, 0xe4, 0xb9,
+	0x99, 0xe4, 0xb8, 0x99, 0xe4, 0xb8, 0x81, 0xe5, 0xa4, 0xa9, 0xe5, 0x9c,
+	0xb0, 0xe4, 0xba, 0xba, 0x28, 0xe1, 0x84, 0x80, 0x29, 0x28, 0xe1, 0x84,
+	0x82, 0x29, 0x28, 0xe1, 0x84, 0x83, 0x29, 0x28, 0xe1, 0x84, 0x85, 0x29,
+	0x28, 0xe1, 0x84, 0x86, 0x29, 0x28, 0xe1, 0x84, 0x87, 0x29, 0x28, 0xe1,
+	0x84, 0x89, 0x29, 0x28, 0xe1, 0x84, 0x8b, 0x29, 0x28, 0xe1, 0x84, 0x8c,
+	0x29, 0x28, 0xe1, 0x84, 0x8e, 0x29, 0x28, 0xe1, 0x84, 0x8f, 0x29, 0x28,
+	0xe1, 0x84, 0x90, 0x29, 0x28, 0xe1, 0x84, 0x91, 0x29, 0x28, 0xe1, 0x84,
+	0x92, 0x29, 0x28, 0xe1, 0x84, 0x80, 0xe1, 0x85, 0xa1, 0x29, 0x28, 0xe1,
+	0x84, 0x82, 0xe1, 0x85, 0xa1, 0x29, 0x28, 0xe1, 0x84, 0x83, 0xe1, 0x85,
+	0xa1, 0x29, 0x28, 0xe1, 0x84, 0x85, 0xe1, 0x85, 0xa1, 0x29, 0x28, 0xe1,
+	0x84, 0x86, 0xe1, 0x85, 0xa1, 0x29, 0x28, 0xe1, 0x84, 0x87, 0xe1, 0x85,
+	0xa1, 0x29, 0x28, 0xe1, 0x84, 0x89, 0xe1, 0x85, 0xa1, 0x29, 0x28, 0xe1,
+	0x84, 0x8b, 0xe1, 0x85, 0xa1, 0x29, 0x28, 0xe1, 0x84, 0x8c, 0xe1, 0x85,
+	0xa1, 0x29, 0x28, 0xe1, 0x84, 0x8e, 0xe1, 0x85, 0xa1, 0x29, 0x28, 0xe1,
+	0x84, 0x8f, 0xe1, 0x85, 0xa1, 0x29, 0x28, 0xe1, 0x84, 0x90, 0xe1, 0x85,
+	0xa1, 0x29, 0x28, 0xe1, 0x84, 0x91, 0xe1, 0x85, 0xa1, 0x29, 0x28, 0xe1,
+	0x84, 0x92, 0xe1, 0x85, 0xa1, 0x29, 0x28, 0xe1, 0x84, 0x8c, 0xe1, 0x85,
+	0xae, 0x29, 0x28, 0xe1, 0x84, 0x8b, 0xe1, 0x85, 0xa9, 0xe1, 0x84, 0x8c,
+	0xe1, 0x85, 0xa5, 0xe1, 0x86, 0xab, 0x29, 0x28, 0xe1, 0x84, 0x8b, 0xe1,
+	0x85, 0xa9, 0xe1, 0x84, 0x92, 0xe1, 0x85, 0xae, 0x29, 0x28, 0xe4, 0xb8,
+	0x80, 0x29, 0x28, 0xe4, 0xba, 0x8c, 0x29, 0x28, 0xe4, 0xb8, 0x89, 0x29,
+	0x28, 0xe5, 0x9b, 0x9b, 0x29, 0x28, 0xe4, 0xba, 0x94, 0x29, 0x28, 0xe5,
+	0x85, 0xad, 0x29, 0x28, 0xe4, 0xb8, 0x83, 0x29, 0x28, 0xe5, 0x85, 0xab,
+	0x29, 0x28, 0xe4, 0xb9, 0x9d, 0x29, 0x28, 0xe5, 0x8d, 0x81, 0x29, 0x28,
+	0xe6, 0x9c, 0x88, 0x29, 0x28, 0xe7, 0x81, 0xab, 0x29, 0x28, 0xe6, 0xb0,
+	0xb4, 0x29, 0x28, 0xe6, 0x9c, 0xa8, 0x29, 0x28, 0xe9, 0x87, 0x91, 0x29,
+	0x28, 0xe5, 0x9c, 0x9f, 0x29, 0x28, 0xe6, 0x97, 0xa5, 0x29, 0x28, 0xe6,
+	0xa0, 0xaa, 0x29, 0x28, 0xe6, 0x9c, 0x89, 0x29, 0x28, 0xe7, 0xa4, 0xbe,
+	0x29, 0x28, 0xe5, 0x90, 0x8d, 0x29, 0x28, 0xe7, 0x89, 0xb9, 0x29, 0x28,
+	0xe8, 0xb2, 0xa1, 0x29, 0x28, 0xe7, 0xa5, 0x9d, 0x29, 0x28, 0xe5, 0x8a,
+	0xb4, 0x29, 0x28, 0xe4, 0xbb, 0xa3, 0x29, 0x28, 0xe5, 0x91, 0xbc, 0x29,
+	0x28, 0xe5, 0xad, 0xa6, 0x29, 0x28, 0xe7, 0x9b, 0xa3, 0x29, 0x28, 0xe4,
+	0xbc, 0x81, 0x29, 0x28, 0xe8, 0xb3, 0x87, 0x29, 0x28, 0xe5, 0x8d, 0x94,
+	0x29, 0x28, 0xe7, 0xa5, 0xad, 0x29, 0x28, 0xe4, 0xbc, 0x91, 0x29, 0x28,
+	0xe8, 0x87, 0xaa, 0x29, 0x28, 0xe8, 0x87, 0xb3, 0x29, 0xe5, 0x95, 0x8f,
+	0xe5, 0xb9, 0xbc, 0xe6, 0x96, 0x87, 0xe7, 0xae, 0x8f, 0x50, 0x54, 0x45,
+	0x32, 0x31, 0x32, 0x32, 0x32, 0x33, 0x32, 0x34, 0x32, 0x35, 0x32, 0x36,
+	0x32, 0x37, 0x32, 0x38, 0x32, 0x39, 0x33, 0x30, 0x33, 0x31, 0x33, 0x32,
+	0x33, 0x33, 0x33, 0x34, 0x33, 0x35, 0xe1, 0x84, 0x80, 0xe1, 0x84, 0x82,
+	0xe1, 0x84, 0x83, 0xe1, 0x84, 0x85, 0xe1, 0x84, 0x86, 0xe1, 0x84, 0x87,
+	0xe1, 0x84, 0x89, 0xe1, 0x84, 0x8b, 0xe1, 0x84, 0x8c, 0xe1, 0x84, 0x8e,
+	0xe1, 0x84, 0x8f, 0xe1, 0x84, 0x90, 0xe1, 0x84, 0x91, 0xe1, 0x84, 0x92,
+	0xe1, 0x84, 0x80, 0xe1, 0x85, 0xa1, 0xe1, 0x84, 0x82, 0xe1, 0x85, 0xa1,
+	0xe1, 0x84, 0x83, 0xe1, 0x85, 0xa1, 0xe1, 0x84, 0x85, 0xe1, 0x85, 0xa1,
+	0xe1, 0x84, 0x86, 0xe1, 0x85, 0xa1, 0xe1, 0x84, 0x87, 0xe1, 0x85, 0xa1,
+	0xe1, 0x84, 0x89, 0xe1, 0x85, 0xa1, 0xe1, 0x84, 0x8b, 0xe1, 0x85, 0xa1,
+	0xe1, 0x84, 0x8c, 0xe1, 0x85, 0xa1, 0xe1, 0x84, 0x8e, 0xe1, 0x85, 0xa1,
+	0xe1, 0x84, 0x8f, 0xe1, 0x85, 0xa1, 0xe1, 0x84, 0x90, 0xe1, 0x85, 0xa1,
+	0xe1, 0x84, 0x91, 0xe1, 0x85, 0xa1, 0xe1, 0x84, 0x92, 0xe1, 0x85, 0xa1,
+	0xe1, 0x84, 0x8e, 0xe1, 0x85, 0xa1, 0xe1, 0x86, 0xb7, 0xe1, 0x84, 0x80,
+	0xe1, 0x85, 0xa9, 0xe1, 0x84, 0x8c, 0xe1, 0x85, 0xae, 0xe1, 0x84, 0x8b,
+	0xe1, 0x85, 0xb4, 0xe1, 0x84, 0x8b, 0xe1, 0x85, 0xae, 0xe4, 0xb8, 0x80,
+	0xe4, 0xba, 0x8c, 0xe4, 0xb8, 0x89, 0xe5, 0x9b, 0x9b, 0xe4, 0xba, 0x94,
+	0xe5, 0x85, 0xad, 0xe4, 0xb8, 0x83, 0xe5, 0x85, 0xab, 0xe4, 0xb9, 0x9d,
+	0xe5, 0x8d, 0x81, 0xe6, 0x9c, 0x88, 0xe7, 0x81, 0xab, 0xe6, 0xb0, 0xb4,
+	0xe6, 0x9c, 0xa8, 0xe9, 0x87, 0x91, 0xe5, 0x9c, 0x9f, 0xe6, 0x97, 0xa5,
+	0xe6, 0xa0, 0xaa, 0xe6, 0x9c, 0x89, 0xe7, 0xa4, 0xbe, 0xe5, 0x90, 0x8d,
+	0xe7, 0x89, 0xb9, 0xe8, 0xb2, 0xa1, 0xe7, 0xa5, 0x9d, 0xe5, 0x8a, 0xb4,
+	0xe7, 0xa7, 0x98, 0xe7, 0x94, 0xb7, 0xe5, 0xa5, 0xb3, 0xe9, 0x81, 0xa9,
+	0xe5, 0x84, 0xaa, 0xe5, 0x8d, 0xb0, 0xe6, 0xb3, 0xa8, 0xe9, 0xa0, 0x85,
+	0xe4, 0xbc, 0x91, 0xe5, 0x86, 0x99, 0xe6, 0xad, 0xa3, 0xe4, 0xb8, 0x8a,
+	0xe4, 0xb8, 0xad, 0xe4, 0xb8, 0x8b, 0xe5, 0xb7, 0xa6, 0xe5, 0x8f, 0xb3,
+	0xe5, 0x8c, 0xbb, 0xe5, 0xae, 0x97, 0xe5, 0xad, 0xa6, 0xe7, 0x9b, 0xa3,
+	0xe4, 0xbc, 0x81, 0xe8, 0xb3, 0x87, 0xe5, 0x8d, 0x94, 0xe5, 0xa4, 0x9c,
+	0x33, 0x36, 0x33, 0x37, 0x33, 0x38, 0x33, 0x39, 0x34, 0x30, 0x34, 0x31,
+	0x34, 0x32, 0x34, 0x33, 0x34, 0x34, 0x34, 0x35, 0x34, 0x36, 0x34, 0x37,
+	0x34, 0x38, 0x34, 0x39, 0x35, 0x30, 0x31, 0xe6, 0x9c, 0x88, 0x32, 0xe6,
+	0x9c, 0x88, 0x33, 0xe6, 0x9c, 0x88, 0x34, 0xe6, 0x9c, 0x88, 0x35, 0xe6,
+	0x9c, 0x88, 0x36, 0xe6, 0x9c, 0x88, 0x37, 0xe6, 0x9c, 0x88, 0x38, 0xe6,
+	0x9c, 0x88, 0x39, 0xe6, 0x9c, 0x88, 0x31, 0x30, 0xe6, 0x9c, 0x88, 0x31,
+	0x31, 0xe6, 0x9c, 0x88, 0x31, 0x32, 0xe6, 0x9c, 0x88, 0x48, 0x67, 0x65,
+	0x72, 0x67, 0x65, 0x56, 0x4c, 0x54, 0x44, 0xe3, 0x82, 0xa2, 0xe3, 0x82,
+	0xa4, 0xe3, 0x82, 0xa6, 0xe3, 0x82, 0xa8, 0xe3, 0x82, 0xaa, 0xe3, 0x82,
+	0xab, 0xe3, 0x82, 0xad, 0xe3, 0x82, 0xaf, 0xe3, 0x82, 0xb1, 0xe3, 0x82,
+	0xb3, 0xe3, 0x82, 0xb5, 0xe3, 0x82, 0xb7, 0xe3, 0x82, 0xb9, 0xe3, 0x82,
+	0xbb, 0xe3, 0x82, 0xbd, 0xe3, 0x82, 0xbf, 0xe3, 0x83, 0x81, 0xe3, 0x83,
+	0x84, 0xe3, 0x83, 0x86, 0xe3, 0x83, 0x88, 0xe3, 0x83, 0x8a, 0xe3, 0x83,
+	0x8b, 0xe3, 0x83, 0x8c, 0xe3, 0x83, 0x8d, 0xe3, 0x83, 0x8e, 0xe3, 0x83,
+	0x8f, 0xe3, 0x83, 0x92, 0xe3, 0x83, 0x95, 0xe3, 0x83, 0x98, 0xe3, 0x83,
+	0x9b, 0xe3, 0x83, 0x9e, 0xe3, 0x83, 0x9f, 0xe3, 0x83, 0xa0, 0xe3, 0x83,
+	0xa1, 0xe3, 0x83, 0xa2, 0xe3, 0x83, 0xa4, 0xe3, 0x83, 0xa6, 0xe3, 0x83,
+	0xa8, 0xe3, 0x83, 0xa9, 0xe3, 0x83, 0xaa, 0xe3, 0x83, 0xab, 0xe3, 0x83,
+	0xac, 0xe3, 0x83, 0xad, 0xe3, 0x83, 0xaf, 0xe3, 0x83, 0xb0, 0xe3, 0x83,
+	0xb1, 0xe3, 0x83, 0xb2, 0xe4, 0xbb, 0xa4, 0xe5, 0x92, 0x8c, 0xe3, 0x82,
+	0xa2, 0xe3, 0x83, 0x8f, 0xe3, 0x82, 0x9a, 0xe3, 0x83, 0xbc, 0xe3, 0x83,
+	0x88, 0xe3, 0x82, 0xa2, 0xe3, 0x83, 0xab, 0xe3, 0x83, 0x95, 0xe3, 0x82,
+	0xa1, 0xe3, 0x82, 0xa2, 0xe3, 0x83, 0xb3, 0xe3, 0x83, 0x98, 0xe3, 0x82,
+	0x9a, 0xe3, 0x82, 0xa2, 0xe3, 0x82, 0xa2, 0xe3, 0x83, 0xbc, 0xe3, 0x83,
+	0xab, 0xe3, 0x82, 0xa4, 0xe3, 0x83, 0x8b, 0xe3, 0x83, 0xb3, 0xe3, 0x82,
+	0xaf, 0xe3, 0x82, 0x99, 0xe3, 0x82, 0xa4, 0xe3, 0x83, 0xb3, 0xe3, 0x83,
+	0x81, 0xe3, 0x82, 0xa6, 0xe3, 0x82, 0xa9, 0xe3, 0x83, 0xb3, 0xe3, 0x82,
+	0xa8, 0xe3, 0x82, 0xb9, 0xe3, 0x82, 0xaf, 0xe3, 0x83, 0xbc, 0xe3, 0x83,
+	0x88, 0xe3, 0x82, 0x99, 0xe3, 0x82, 0xa8, 0xe3, 0x83, 0xbc, 0xe3, 0x82,
+	0xab, 0xe3, 0x83, 0xbc, 0xe3, 0x82, 0xaa, 0xe3, 0x83, 0xb3, 0xe3, 0x82,
+	0xb9, 0xe3, 0x82, 0xaa, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0xa0, 0xe3, 0x82,
+	0xab, 0xe3, 0x82, 0xa4, 0xe3, 0x83, 0xaa, 0xe3, 0x82, 0xab, 0xe3, 0x83,
+	0xa9, 0xe3, 0x83, 0x83, 0xe3, 0x83, 0x88, 0xe3, 0x82, 0xab, 0xe3, 0x83,
+	0xad, 0xe3, 0x83, 0xaa, 0xe3, 0x83, 0xbc, 0xe3, 0x82, 0xab, 0xe3, 0x82,
+	0x99, 0xe3, 0x83, 0xad, 0xe3, 0x83, 0xb3, 0xe3, 0x82, 0xab, 0xe3, 0x82,
+	0x99, 0xe3, 0x83, 0xb3, 0xe3, 0x83, 0x9e, 0xe3, 0x82, 0xad, 0xe3, 0x82,
+	0x99, 0xe3, 0x82, 0xab, 0xe3, 0x82, 0x99, 0xe3, 0x82, 0xad, 0xe3, 0x82,
+	0x99, 0xe3, 0x83, 0x8b, 0xe3, 0x83, 0xbc, 0xe3, 0x82, 0xad, 0xe3, 0x83,
+	0xa5, 0xe3, 0x83, 0xaa, 0xe3, 0x83, 0xbc, 0xe3, 0x82, 0xad, 0xe3, 0x82,
+	0x99, 0xe3, 0x83, 0xab, 0xe3, 0x82, 0xbf, 0xe3, 0x82, 0x99, 0xe3, 0x83,
+	0xbc, 0xe3, 0x82, 0xad, 0xe3, 0x83, 0xad, 0xe3, 0x82, 0xad, 0xe3, 0x83,
+	0xad, 0xe3, 0x82, 0xaf, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xa9, 0xe3, 0x83,
+	0xa0, 0xe3, 0x82, 0xad, 0xe3, 0x83, 0xad, 0xe3, 0x83, 0xa1, 0xe3, 0x83,
+	0xbc, 0xe3, 0x83, 0x88, 0xe3, 0x83, 0xab, 0xe3, 0x82, 0xad, 0xe3, 0x83,
+	0xad, 0xe3, 0x83, 0xaf, 0xe3, 0x83, 0x83, 0xe3, 0x83, 0x88, 0xe3, 0x82,
+	0xaf, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xa9, 0xe3, 0x83, 0xa0, 0xe3, 0x82,
+	0xaf, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xa9, 0xe3, 0x83, 0xa0, 0xe3, 0x83,
+	0x88, 0xe3, 0x83, 0xb3, 0xe3, 0x82, 0xaf, 0xe3, 0x83, 0xab, 0xe3, 0x82,
+	0xbb, 0xe3, 0x82, 0x99, 0xe3, 0x82, 0xa4, 0xe3, 0x83, 0xad, 0xe3, 0x82,
+	0xaf, 0xe3, 0x83, 0xad, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0x8d, 0xe3, 0x82,
+	0xb1, 0xe3, 0x83, 0xbc, 0xe3, 0x82, 0xb9, 0xe3, 0x82, 0xb3, 0xe3, 0x83,
+	0xab, 0xe3, 0x83, 0x8a, 0xe3, 0x82, 0xb3, 0xe3, 0x83, 0xbc, 0xe3, 0x83,
+	0x9b, 0xe3, 0x82, 0x9a, 0xe3, 0x82, 0xb5, 0xe3, 0x82, 0xa4, 0xe3, 0x82,
+	0xaf, 0xe3, 0x83, 0xab, 0xe3, 0x82, 0xb5, 0xe3, 0x83, 0xb3, 0xe3, 0x83,
+	0x81, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0xa0, 0xe3, 0x82, 0xb7, 0xe3, 0x83,
+	0xaa, 0xe3, 0x83, 0xb3, 0xe3, 0x82, 0xaf, 0xe3, 0x82, 0x99, 0xe3, 0x82,
+	0xbb, 0xe3, 0x83, 0xb3, 0xe3, 0x83, 0x81, 0xe3, 0x82, 0xbb, 0xe3, 0x83,
+	0xb3, 0xe3, 0x83, 0x88, 0xe3, 0x82, 0xbf, 0xe3, 0x82, 0x99, 0xe3, 0x83,
+	0xbc, 0xe3, 0x82, 0xb9, 0xe3, 0x83, 0x86, 0xe3, 0x82, 0x99, 0xe3, 0x82,
+	0xb7, 0xe3, 0x83, 0x88, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xab, 0xe3, 0x83,
+	0x88, 0xe3, 0x83, 0xb3, 0xe3, 0x83, 0x8a, 0xe3, 0x83, 0x8e, 0xe3, 0x83,
+	0x8e, 0xe3, 0x83, 0x83, 0xe3, 0x83, 0x88, 0xe3, 0x83, 0x8f, 0xe3, 0x82,
+	0xa4, 0xe3, 0x83, 0x84, 0xe3, 0x83, 0x8f, 0xe3, 0x82, 0x9a, 0xe3, 0x83,
+	0xbc, 0xe3, 0x82, 0xbb, 0xe3, 0x83, 0xb3, 0xe3, 0x83, 0x88, 0xe3, 0x83,
+	0x8f, 0xe3, 0x82, 0x9a, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0x84, 0xe3, 0x83,
+	0x8f, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0xac, 0xe3, 0x83,
+	0xab, 0xe3, 0x83, 0x92, 0xe3, 0x82, 0x9a, 0xe3, 0x82, 0xa2, 0xe3, 0x82,
+	0xb9, 0xe3, 0x83, 0x88, 0xe3, 0x83, 0xab, 0xe3, 0x83, 0x92, 0xe3, 0x82,
+	0x9a, 0xe3, 0x82, 0xaf, 0xe3, 0x83, 0xab, 0xe3, 0x83, 0x92, 0xe3, 0x82,
+	0x9a, 0xe3, 0x82, 0xb3, 0xe3, 0x83, 0x92, 0xe3, 0x82, 0x99, 0xe3, 0x83,
+	0xab, 0xe3, 0x83, 0x95, 0xe3, 0x82, 0xa1, 0xe3, 0x83, 0xa9, 0xe3, 0x83,
+	0x83, 0xe3, 0x83, 0x88, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0x95, 0xe3, 0x82,
+	0xa3, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0x88, 0xe3, 0x83, 0x95, 0xe3, 0x82,
+	0x99, 0xe3, 0x83, 0x83, 0xe3, 0x82, 0xb7, 0xe3, 0x82, 0xa7, 0xe3, 0x83,
+	0xab, 0xe3, 0x83, 0x95, 0xe3, 0x83, 0xa9, 0xe3, 0x83, 0xb3, 0xe3, 0x83,
+	0x98, 0xe3, 0x82, 0xaf, 0xe3, 0x82, 0xbf, 0xe3, 0x83, 0xbc, 0xe3, 0x83,
+	0xab, 0xe3, 0x83, 0x98, 0xe3, 0x82, 0x9a, 0xe3, 0x82, 0xbd, 0xe3, 0x83,
+	0x98, 0xe3, 0x82, 0x9a, 0xe3, 0x83, 0x8b, 0xe3, 0x83, 0x92, 0xe3, 0x83,
+	0x98, 0xe3, 0x83, 0xab, 0xe3, 0x83, 0x84, 0xe3, 0x83, 0x98, 0xe3, 0x82,
+	0x9a, 0xe3, 0x83, 0xb3, 0xe3, 0x82, 0xb9, 0xe3, 0x83, 0x98, 0xe3, 0x82,
+	0x9a, 0xe3, 0x83, 0xbc, 0xe3, 0x82, 0xb7, 0xe3, 0x82, 0x99, 0xe3, 0x83,
+	0x98, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xbc, 0xe3, 0x82, 0xbf, 0xe3, 0x83,
+	0x9b, 0xe3, 0x82, 0x9a, 0xe3, 0x82, 0xa4, 0xe3, 0x83, 0xb3, 0xe3, 0x83,
+	0x88, 0xe3, 0x83, 0x9b, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xab, 0xe3, 0x83,
+	0x88, 0xe3, 0x83, 0x9b, 0xe3, 0x83, 0xb3, 0xe3, 0x83, 0x9b, 0xe3, 0x82,
+	0x9a, 0xe3, 0x83, 0xb3, 0xe3, 0x83, 0x88, 0xe3, 0x82, 0x99, 0xe3, 0x83,
+	0x9b, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0xab, 0xe3, 0x83, 0x9b, 0xe3, 0x83,
+	0xbc, 0xe3, 0x83, 0xb3, 0xe3, 0x83, 0x9e, 0xe3, 0x82, 0xa4, 0xe3, 0x82,
+	0xaf, 0xe3, 0x83, 0xad, 0xe3, 0x83, 0x9e, 0xe3, 0x82, 0xa4, 0xe3, 0x83,
+	0xab, 0xe3, 0x83, 0x9e, 0xe3, 0x83, 0x83, 0xe3, 0x83, 0x8f, 0xe3, 0x83,
+	0x9e, 0xe3, 0x83, 0xab, 0xe3, 0x82, 0xaf, 0xe3, 0x83, 0x9e, 0xe3, 0x83,
+	0xb3, 0xe3, 0x82, 0xb7, 0xe3, 0x83, 0xa7, 0xe3, 0x83, 0xb3, 0xe3, 0x83,
+	0x9f, 0xe3, 0x82, 0xaf, 0xe3, 0x83, 0xad, 0xe3, 0x83, 0xb3, 0xe3, 0x83,
+	0x9f, 0xe3, 0x83, 0xaa, 0xe3, 0x83, 0x9f, 0xe3, 0x83, 0xaa, 0xe3, 0x83,
+	0x8f, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0xab, 0xe3, 0x83,
+	0xa1, 0xe3, 0x82, 0xab, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xa1, 0xe3, 0x82,
+	0xab, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0x88, 0xe3, 0x83, 0xb3, 0xe3, 0x83,
+	0xa1, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0x88, 0xe3, 0x83, 0xab, 0xe3, 0x83,
+	0xa4, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0x88, 0xe3, 0x82, 0x99, 0xe3, 0x83,
+	0xa4, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0xab, 0xe3, 0x83, 0xa6, 0xe3, 0x82,
+	0xa2, 0xe3, 0x83, 0xb3, 0xe3, 0x83, 0xaa, 0xe3, 0x83, 0x83, 0xe3, 0x83,
+	0x88, 0xe3, 0x83, 0xab, 0xe3, 0x83, 0xaa, 0xe3, 0x83, 0xa9, 0xe3, 0x83,
+	0xab, 0xe3, 0x83, 0x92, 0xe3, 0x82, 0x9a, 0xe3, 0x83, 0xbc, 0xe3, 0x83,
+	0xab, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0x95, 0xe3, 0x82, 0x99, 0xe3, 0x83,
+	0xab, 0xe3, 0x83, 0xac, 0xe3, 0x83, 0xa0, 0xe3, 0x83, 0xac, 0xe3, 0x83,
+	0xb3, 0xe3, 0x83, 0x88, 0xe3, 0x82, 0xb1, 0xe3, 0x82, 0x99, 0xe3, 0x83,
+	0xb3, 0xe3, 0x83, 0xaf, 0xe3, 0x83, 0x83, 0xe3, 0x83, 0x88, 0x30, 0xe7,
+	0x82, 0xb9, 0x31, 0xe7, 0x82, 0xb9, 0x32, 0xe7, 0x82, 0xb9, 0x33, 0xe7,
+	0x82, 0xb9, 0x34, 0xe7, 0x82, 0xb9, 0x35, 0xe7, 0x82, 0xb9, 0x36, 0xe7,
+	0x82, 0xb9, 0x37, 0xe7, 0x82, 0xb9, 0x38, 0xe7, 0x82, 0xb9, 0x39, 0xe7,
+	0x82, 0xb9, 0x31, 0x30, 0xe7, 0x82, 0xb9, 0x31, 0x31, 0xe7, 0x82, 0xb9,
+	0x31, 0x32, 0xe7, 0x82, 0xb9, 0x31, 0x33, 0xe7, 0x82, 0xb9, 0x31, 0x34,
+	0xe7, 0x82, 0xb9, 0x31, 0x35, 0xe7, 0x82, 0xb9, 0x31, 0x36, 0xe7, 0x82,
+	0xb9, 0x31, 0x37, 0xe7, 0x82, 0xb9, 0x31, 0x38, 0xe7, 0x82, 0xb9, 0x31,
+	0x39, 0xe7, 0x82, 0xb9, 0x32, 0x30, 0xe7, 0x82, 0xb9, 0x32, 0x31, 0xe7,
+	0x82, 0xb9, 0x32, 0x32, 0xe7, 0x82, 0xb9, 0x32, 0x33, 0xe7, 0x82, 0xb9,
+	0x32, 0x34, 0xe7, 0x82, 0xb9, 0x68, 0x50, 0x61, 0x64, 0x61, 0x41, 0x55,
+	0x62, 0x61, 0x72, 0x6f, 0x56, 0x70, 0x63, 0x64, 0x6d, 0x64, 0x6d, 0x32,
+	0x64, 0x6d, 0x33, 0x49, 0x55, 0xe5, 0xb9, 0xb3, 0xe6, 0x88, 0x90, 0xe6,
+	0x98, 0xad, 0xe5, 0x92, 0x8c, 0xe5, 0xa4, 0xa7, 0xe6, 0xad, 0xa3, 0xe6,
+	0x98, 0x8e, 0xe6, 0xb2, 0xbb, 0xe6, 0xa0, 0xaa, 0xe5, 0xbc, 0x8f, 0xe4,
+	0xbc, 0x9a, 0xe7, 0xa4, 0xbe, 0x70, 0x41, 0x6e, 0x41, 0xce, 0xbc, 0x41,
+	0x6d, 0x41, 0x6b, 0x41, 0x4b, 0x42, 0x4d, 0x42, 0x47, 0x42, 0x63, 0x61,
+	0x6c, 0x6b, 0x63, 0x61, 0x6c, 0x70, 0x46, 0x6e, 0x46, 0xce, 0xbc, 0x46,
+	0xce, 0xbc, 0x67, 0x6d, 0x67, 0x6b, 0x67, 0x48, 0x7a, 0x6b, 0x48, 0x7a,
+	0x4d, 0x48, 0x7a, 0x47, 0x48, 0x7a, 0x54, 0x48, 0x7a, 0xce, 0xbc, 0x6c,
+	0x6d, 0x6c, 0x64, 0x6c, 0x6b, 0x6c, 0x66, 0x6d, 0x6e, 0x6d, 0xce, 0xbc,
+	0x6d, 0x6d, 0x6d, 0x63, 0x6d, 0x6b, 0x6d, 0x6d, 0x6d, 0x32, 0x63, 0x6d,
+	0x32, 0x6d, 0x32, 0x6b, 0x6d, 0x32, 0x6d, 0x6d, 0x33, 0x63, 0x6d, 0x33,
+	0x6d, 0x33, 0x6b, 0x6d, 0x33, 0x6d, 0xe2, 0x88, 0x95, 0x73, 0x6d, 0xe2,
+	0x88, 0x95, 0x73, 0x32, 0x50, 0x61, 0x6b, 0x50, 0x61, 0x4d, 0x50, 0x61,
+	0x47, 0x50, 0x61, 0x72, 0x61, 0x64, 0x72, 0x61, 0x64, 0xe2, 0x88, 0x95,
+	0x73, 0x72, 0x61, 0x64, 0xe2, 0x88, 0x95, 0x73, 0x32, 0x70, 0x73, 0x6e,
+	0x73, 0xce, 0xbc, 0x73, 0x6d, 0x73, 0x70, 0x56, 0x6e, 0x56, 0xce, 0xbc,
+	0x56, 0x6d, 0x56, 0x6b, 0x56, 0x4d, 0x56, 0x70, 0x57, 0x6e, 0x57, 0xce,
+	0xbc, 0x57, 0x6d, 0x57, 0x6b, 0x57, 0x4d, 0x57, 0x6b, 0xce, 0xa9, 0x4d,
+	0xce, 0xa9, 0x61, 0x2e, 0x6d, 0x2e, 0x42, 0x71, 0x63, 0x63, 0x63, 0x64,
+	0x43, 0xe2, 0x88, 0x95, 0x6b, 0x67, 0x43, 0x6f, 0x2e, 0x64, 0x42, 0x47,
+	0x79, 0x68, 0x61, 0x48, 0x50, 0x69, 0x6e, 0x4b, 0x4b, 0x4b, 0x4d, 0x6b,
+	0x74, 0x6c, 0x6d, 0x6c, 0x6e, 0x6c, 0x6f, 0x67, 0x6c, 0x78, 0x6d, 0x62,
+	0x6d, 0x69, 0x6c, 0x6d, 0x6f, 0x6c, 0x50, 0x48, 0x70, 0x2e, 0x6d, 0x2e,
+	0x50, 0x50, 0x4d, 0x50, 0x52, 0x73, 0x72, 0x53, 0x76, 0x57, 0x62, 0x56,
+	0xe2, 0x88, 0x95, 0x6d, 0x41, 0xe2, 0x88, 0x95, 0x6d, 0x31, 0xe6, 0x97,
+	0xa5, 0x32, 0xe6, 0x97, 0xa5, 0x33, 0xe6, 0x97, 0xa5, 0x34, 0xe6, 0x97,
+	0xa5, 0x35, 0xe6, 0x97, 0xa5, 0x36, 0xe6, 0x97, 0xa5, 0x37, 0xe6, 0x97,
+	0xa5, 0x38, 0xe6, 0x97, 0xa5, 0x39, 0xe6, 0x97, 0xa5, 0x31, 0x30, 0xe6,
+	0x97, 0xa5, 0x31, 0x31, 0xe6, 0x97, 0xa5, 0x31, 0x32, 0xe6, 0x97, 0xa5,
+	0x31, 0x33, 0xe6, 0x97, 0xa5, 0x31, 0x34, 0xe6, 0x97, 0xa5, 0x31, 0x35,
+	0xe6, 0x97, 0xa5, 0x31, 0x36, 0xe6, 0x97, 0xa5, 0x31, 0x37, 0xe6, 0x97,
+	0xa5, 0x31, 0x38, 0xe6, 0x97, 0xa5, 0x31, 0x39, 0xe6, 0x97, 0xa5, 0x32,
+	0x30, 0xe6, 0x97, 0xa5, 0x32, 0x31, 0xe6, 0x97, 0xa5, 0x32, 0x32, 0xe6,
+	0x97, 0xa5, 0x32, 0x33, 0xe6, 0x97, 0xa5, 0x32, 0x34, 0xe6, 0x97, 0xa5,
+	0x32, 0x35, 0xe6, 0x97, 0xa5, 0x32, 0x36, 0xe6, 0x97, 0xa5, 0x32, 0x37,
+	0xe6, 0x97, 0xa5, 0x32, 0x38, 0xe6, 0x97, 0xa5, 0x32, 0x39, 0xe6, 0x97,
+	0xa5, 0x33, 0x30, 0xe6, 0x97, 0xa5, 0x33, 0x31, 0xe6, 0x97, 0xa5, 0x67,
+	0x61, 0x6c, 0xd1, 0x8a, 0xd1, 0x8c, 0xea, 0x9d, 0xaf, 0x43, 0x46, 0x51,
+	0xc4, 0xa6, 0xc5, 0x93, 0xea, 0x9c, 0xa7, 0xea, 0xac, 0xb7, 0xc9, 0xab,
+	0xea, 0xad, 0x92, 0xca, 0x8d, 0xe8, 0xb1, 0x88, 0xe6, 0x9b, 0xb4, 0xe8,
+	0xbb, 0x8a, 0xe8, 0xb3, 0x88, 0xe6, 0xbb, 0x91, 0xe4, 0xb8, 0xb2, 0xe5,
+	0x8f, 0xa5, 0xe9, 0xbe, 0x9c, 0xe9, 0xbe, 0x9c, 0xe5, 0xa5, 0x91, 0xe9,
+	0x87, 0x91, 0xe5, 0x96, 0x87, 0xe5, 0xa5, 0x88, 0xe6, 0x87, 0xb6, 0xe7,
+	0x99, 0xa9, 0xe7, 0xbe, 0x85, 0xe8, 0x98, 0xbf, 0xe8, 0x9e, 0xba, 0xe8,
+	0xa3, 0xb8, 0xe9, 0x82, 0x8f, 0xe6, 0xa8, 0x82, 0xe6, 0xb4, 0x9b, 0xe7,
+	0x83, 0x99, 0xe7, 0x8f, 0x9e, 0xe8, 0x90, 0xbd, 0xe9, 0x85, 0xaa, 0xe9,
+	0xa7, 0xb1, 0xe4, 0xba, 0x82, 0xe5, 0x8d, 0xb5, 0xe6, 0xac, 0x84, 0xe7,
+	0x88, 0x9b, 0xe8, 0x98, 0xad, 0xe9, 0xb8, 0x9e, 0xe5, 0xb5, 0x90, 0xe6,
+	0xbf, 0xab, 0xe8, 0x97, 0x8d, 0xe8, 0xa5, 0xa4, 0xe6, 0x8b, 0x89, 0xe8,
+	0x87, 0x98, 0xe8, 0xa0, 0x9f, 0xe5, 0xbb, 0x8a, 0xe6, 0x9c, 0x97, 0xe6,
+	0xb5, 0xaa, 0xe7, 0x8b, 0xbc, 0xe9, 0x83, 0x8e, 0xe4, 0xbe, 0x86, 0xe5,
+	0x86, 0xb7, 0xe5, 0x8b, 0x9e, 0xe6, 0x93, 0x84, 0xe6, 0xab, 0x93, 0xe7,
+	0x88, 0x90, 0xe7, 0x9b, 0xa7, 0xe8, 0x80, 0x81, 0xe8, 0x98, 0x86, 0xe8,
+	0x99, 0x9c, 0xe8, 0xb7, 0xaf, 0xe9, 0x9c, 0xb2, 0xe9, 0xad, 0xaf, 0xe9,
+	0xb7, 0xba, 0xe7, 0xa2, 0x8c, 0xe7, 0xa5, 0xbf, 0xe7, 0xb6, 0xa0, 0xe8,
+	0x8f, 0x89, 0xe9, 0x8c, 0x84, 0xe9, 0xb9, 0xbf, 0xe8, 0xab, 0x96, 0xe5,
+	0xa3, 0x9f, 0xe5, 0xbc, 0x84, 0xe7, 0xb1, 0xa0, 0xe8, 0x81, 0xbe, 0xe7,
+	0x89, 0xa2, 0xe7, 0xa3, 0x8a, 0xe8, 0xb3, 0x82, 0xe9, 0x9b, 0xb7, 0xe5,
+	0xa3, 0x98, 0xe5, 0xb1, 0xa2, 0xe6, 0xa8, 0x93, 0xe6, 0xb7, 0x9a, 0xe6,
+	0xbc, 0x8f, 0xe7, 0xb4, 0xaf, 0xe7, 0xb8, 0xb7, 0xe9, 0x99, 0x8b, 0xe5,
+	0x8b, 0x92, 0xe8, 0x82, 0x8b, 0xe5, 0x87, 0x9c, 0xe5, 0x87, 0x8c, 0xe7,
+	0xa8, 0x9c, 0xe7, 0xb6, 0xbe, 0xe8, 0x8f, 0xb1, 0xe9, 0x99, 0xb5, 0xe8,
+	0xae, 0x80, 0xe6, 0x8b, 0x8f, 0xe6, 0xa8, 0x82, 0xe8, 0xab, 0xbe, 0xe4,
+	0xb8, 0xb9, 0xe5, 0xaf, 0xa7, 0xe6, 0x80, 0x92, 0xe7, 0x8e, 0x87, 0xe7,
+	0x95, 0xb0, 0xe5, 0x8c, 0x97, 0xe7, 0xa3, 0xbb, 0xe4, 0xbe, 0xbf, 0xe5,
+	0xbe, 0xa9, 0xe4, 0xb8, 0x8d, 0xe6, 0xb3, 0x8c, 0xe6, 0x95, 0xb8, 0xe7,
+	0xb4, 0xa2, 0xe5, 0x8f, 0x83, 0xe5, 0xa1, 0x9e, 0xe7, 0x9c, 0x81, 0xe8,
+	0x91, 0x89, 0xe8, 0xaa, 0xaa, 0xe6, 0xae, 0xba, 0xe8, 0xbe, 0xb0, 0xe6,
+	0xb2, 0x88, 0xe6, 0x8b, 0xbe, 0xe8, 0x8b, 0xa5, 0xe6, 0x8e, 0xa0, 0xe7,
+	0x95, 0xa5, 0xe4, 0xba, 0xae, 0xe5, 0x85, 0xa9, 0xe5, 0x87, 0x89, 0xe6,
+	0xa2, 0x81, 0xe7, 0xb3, 0xa7, 0xe8, 0x89, 0xaf, 0xe8, 0xab, 0x92, 0xe9,
+	0x87, 0x8f, 0xe5, 0x8b, 0xb5, 0xe5, 0x91, 0x82, 0xe5, 0xa5, 0xb3, 0xe5,
+	0xbb, 0xac, 0xe6, 0x97, 0x85, 0xe6, 0xbf, 0xbe, 0xe7, 0xa4, 0xaa, 0xe9,
+	0x96, 0xad, 0xe9, 0xa9, 0xaa, 0xe9, 0xba, 0x97, 0xe9, 0xbb, 0x8e, 0xe5,
+	0x8a, 0x9b, 0xe6, 0x9b, 0x86, 0xe6, 0xad, 0xb7, 0xe8, 0xbd, 0xa2, 0xe5,
+	0xb9, 0xb4, 0xe6, 0x86, 0x90, 0xe6, 0x88, 0x80, 0xe6, 0x92, 0x9a, 0xe6,
+	0xbc, 0xa3, 0xe7, 0x85, 0x89, 0xe7, 0x92, 0x89, 0xe7, 0xa7, 0x8a, 0xe7,
+	0xb7, 0xb4, 0xe8, 0x81, 0xaf, 0xe8, 0xbc, 0xa6, 0xe8, 0x93, 0xae, 0xe9,
+	0x80, 0xa3, 0xe9, 0x8d, 0x8a, 0xe5, 0x88, 0x97, 0xe5, 0x8a, 0xa3, 0xe5,
+	0x92, 0xbd, 0xe7, 0x83, 0x88, 0xe8, 0xa3, 0x82, 0xe8, 0xaa, 0xaa, 0xe5,
+	0xbb, 0x89, 0xe5, 0xbf, 0xb5, 0xe6, 0x8d, 0xbb, 0xe6, 0xae, 0xae, 0xe7,
+	0xb0, 0xbe, 0xe7, 0x8d, 0xb5, 0xe4, 0xbb, 0xa4, 0xe5, 0x9b, 0xb9, 0xe5,
+	0xaf, 0xa7, 0xe5, 0xb6, 0xba, 0xe6, 0x80, 0x9c, 0xe7, 0x8e, 0xb2, 0xe7,
+	0x91, 0xa9, 0xe7, 0xbe, 0x9a, 0xe8, 0x81, 0x86, 0xe9, 0x88, 0xb4, 0xe9,
+	0x9b, 0xb6, 0xe9, 0x9d, 0x88, 0xe9, 0xa0, 0x98, 0xe4, 0xbe, 0x8b, 0xe7,
+	0xa6, 0xae, 0xe9, 0x86, 0xb4, 0xe9, 0x9a, 0xb8, 0xe6, 0x83, 0xa1, 0xe4,
+	0xba, 0x86, 0xe5, 0x83, 0x9a, 0xe5, 0xaf, 0xae, 0xe5, 0xb0, 0xbf, 0xe6,
+	0x96, 0x99, 0xe6, 0xa8, 0x82, 0xe7, 0x87, 0x8e, 0xe7, 0x99, 0x82, 0xe8,
+	0x93, 0xbc, 0xe9, 0x81, 0xbc, 0xe9, 0xbe, 0x8d, 0xe6, 0x9a, 0x88, 0xe9,
+	0x98, 0xae, 0xe5, 0x8a, 0x89, 0xe6, 0x9d, 0xbb, 0xe6, 0x9f, 0xb3, 0xe6,
+	0xb5, 0x81, 0xe6, 0xba, 0x9c, 0xe7, 0x90, 0x89, 0xe7, 0x95, 0x99, 0xe7,
+	0xa1, 0xab, 0xe7, 0xb4, 0x90, 0xe9, 0xa1, 0x9e, 0xe5, 0x85, 0xad, 0xe6,
+	0x88, 0xae, 0xe9, 0x99, 0xb8, 0xe5, 0x80, 0xab, 0xe5, 0xb4, 0x99, 0xe6,
+	0xb7, 0xaa, 0xe8, 0xbc, 0xaa, 0xe5, 0xbe, 0x8b, 0xe6, 0x85, 0x84, 0xe6,
+	0xa0, 0x97, 0xe7, 0x8e, 0x87, 0xe9, 0x9a, 0x86, 0xe5, 0x88, 0xa9, 0xe5,
+	0x90, 0x8f, 0xe5, 0xb1, 0xa5, 0xe6, 0x98, 0x93, 0xe6, 0x9d, 0x8e, 0xe6,
+	0xa2, 0xa8, 0xe6, 0xb3, 0xa5, 0xe7, 0x90, 0x86, 0xe7, 0x97, 0xa2, 0xe7,
+	0xbd, 0xb9, 0xe8, 0xa3, 0x8f, 0xe8, 0xa3, 0xa1, 0xe9, 0x87, 0x8c, 0xe9,
+	0x9b, 0xa2, 0xe5, 0x8c, 0xbf, 0xe6, 0xba, 0xba, 0xe5, 0x90, 0x9d, 0xe7,
+	0x87, 0x90, 0xe7, 0x92, 0x98, 0xe8, 0x97, 0xba, 0xe9, 0x9a, 0xa3, 0xe9,
+	0xb1, 0x97, 0xe9, 0xba, 0x9f, 0xe6, 0x9e, 0x97, 0xe6, 0xb7, 0x8b, 0xe8,
+	0x87, 0xa8, 0xe7, 0xab, 0x8b, 0xe7, 0xac, 0xa0, 0xe7, 0xb2, 0x92, 0xe7,
+	0x8b, 0x80, 0xe7, 0x82, 0x99, 0xe8, 0xad, 0x98, 0xe4, 0xbb, 0x80, 0xe8,
+	0x8c, 0xb6, 0xe5, 0x88, 0xba, 0xe5, 0x88, 0x87, 0xe5, 0xba, 0xa6, 0xe6,
+	0x8b, 0x93, 0xe7, 0xb3, 0x96, 0xe5, 0xae, 0x85, 0xe6, 0xb4, 0x9e, 0xe6,
+	0x9a, 0xb4, 0xe8, 0xbc, 0xbb, 0xe8, 0xa1, 0x8c, 0xe9, 0x99, 0x8d, 0xe8,
+	0xa6, 0x8b, 0xe5, 0xbb, 0x93, 0xe5, 0x85, 0x80, 0xe5, 0x97, 0x80, 0xe5,
+	0xa1, 0x9a, 0xe6, 0x99, 0xb4, 0xe5, 0x87, 0x9e, 0xe7, 0x8c, 0xaa, 0xe7,
+	0x9b, 0x8a, 0xe7, 0xa4, 0xbc, 0xe7, 0xa5, 0x9e, 0xe7, 0xa5, 0xa5, 0xe7,
+	0xa6, 0x8f, 0xe9, 0x9d, 0x96, 0xe7, 0xb2, 0xbe, 0xe7, 0xbe, 0xbd, 0xe8,
+	0x98, 0x92, 0xe8, 0xab, 0xb8, 0xe9, 0x80, 0xb8, 0xe9, 0x83, 0xbd, 0xe9,
+	0xa3, 0xaf, 0xe9, 0xa3, 0xbc, 0xe9, 0xa4, 0xa8, 0xe9, 0xb6, 0xb4, 0xe9,
+	0x83, 0x9e, 0xe9, 0x9a, 0xb7, 0xe4, 0xbe, 0xae, 0xe5, 0x83, 0xa7, 0xe5,
+	0x85, 0x8d, 0xe5, 0x8b, 0x89, 0xe5, 0x8b, 0xa4, 0xe5, 0x8d, 0x91, 0xe5,
+	0x96, 0x9d, 0xe5, 0x98, 0x86, 0xe5, 0x99, 0xa8, 0xe5, 0xa1, 0x80, 0xe5,
+	0xa2, 0xa8, 0xe5, 0xb1, 0xa4, 0xe5, 0xb1, 0xae, 0xe6, 0x82, 0x94, 0xe6,
+	0x85, 0xa8, 0xe6, 0x86, 0x8e, 0xe6, 0x87, 0xb2, 0xe6, 0x95, 0x8f, 0xe6,
+	0x97, 0xa2, 0xe6, 0x9a, 0x91, 0xe6, 0xa2, 0x85, 0xe6, 0xb5, 0xb7, 0xe6,
+	0xb8, 0x9a, 0xe6, 0xbc, 0xa2, 0xe7, 0x85, 0xae, 0xe7, 0x88, 0xab, 0xe7,
+	0x90, 0xa2, 0xe7, 0xa2, 0x91, 0xe7, 0xa4, 0xbe, 0xe7, 0xa5, 0x89, 0xe7,
+	0xa5, 0x88, 0xe7, 0xa5, 0x90, 0xe7, 0xa5, 0x96, 0xe7, 0xa5, 0x9d, 0xe7,
+	0xa6, 0x8d, 0xe7, 0xa6, 0x8e, 0xe7, 0xa9, 0x80, 0xe7, 0xaa, 0x81, 0xe7,
+	0xaf, 0x80, 0xe7, 0xb7, 0xb4, 0xe7, 0xb8, 0x89, 0xe7, 0xb9, 0x81, 0xe7,
+	0xbd, 0xb2, 0xe8, 0x80, 0x85, 0xe8, 0x87, 0xad, 0xe8, 0x89, 0xb9, 0xe8,
+	0x89, 0xb9, 0xe8, 0x91, 0x97, 0xe8, 0xa4, 0x90, 0xe8, 0xa6, 0x96, 0xe8,
+	0xac, 0x81, 0xe8, 0xac, 0xb9, 0xe8, 0xb3, 0x93, 0xe8, 0xb4, 0x88, 0xe8,
+	0xbe, 0xb6, 0xe9, 0x80, 0xb8, 0xe9, 0x9b, 0xa3, 0xe9, 0x9f, 0xbf, 0xe9,
+	0xa0, 0xbb, 0xe6, 0x81, 0xb5, 0xf0, 0xa4, 0x8b, 0xae, 0xe8, 0x88, 0x98,
+	0xe4, 0xb8, 0xa6, 0xe5, 0x86, 0xb5, 0xe5, 0x85, 0xa8, 0xe4, 0xbe, 0x80,
+	0xe5, 0x85, 0x85, 0xe5, 0x86, 0x80, 0xe5, 0x8b, 0x87, 0xe5, 0x8b, 0xba,
+	0xe5, 0x96, 0x9d, 0xe5, 0x95, 0x95, 0xe5, 0x96, 0x99, 0xe5, 0x97, 0xa2,
+	0xe5, 0xa1, 0x9a, 0xe5, 0xa2, 0xb3, 0xe5, 0xa5, 0x84, 0xe5, 0xa5, 0x94,
+	0xe5, 0xa9, 0xa2, 0xe5, 0xac, 0xa8, 0xe5, 0xbb, 0x92, 0xe5, 0xbb, 0x99,
+	0xe5, 0xbd, 0xa9, 0xe5, 0xbe, 0xad, 0xe6, 0x83, 0x98, 0xe6, 0x85, 0x8e,
+	0xe6, 0x84, 0x88, 0xe6, 0x86, 0x8e, 0xe6, 0x85, 0xa0, 0xe6, 0x87, 0xb2,
+	0xe6, 0x88, 0xb4, 0xe6, 0x8f, 0x84, 0xe6, 0x90, 0x9c, 0xe6, 0x91, 0x92,
+	0xe6, 0x95, 0x96, 0xe6, 0x99, 0xb4, 0xe6, 0x9c, 0x97, 0xe6, 0x9c, 0x9b,
+	0xe6, 0x9d, 0x96, 0xe6, 0xad, 0xb9, 0xe6, 0xae, 0xba, 0xe6, 0xb5, 0x81,
+	0xe6, 0xbb, 0x9b, 0xe6, 0xbb, 0x8b, 0xe6, 0xbc, 0xa2, 0xe7, 0x80, 0x9e,
+	0xe7, 0x85, 0xae, 0xe7, 0x9e, 0xa7, 0xe7, 0x88, 0xb5, 0xe7, 0x8a, 0xaf,
+	0xe7, 0x8c, 0xaa, 0xe7, 0x91, 0xb1, 0xe7, 0x94, 0x86, 0xe7, 0x94, 0xbb,
+	0xe7, 0x98, 0x9d, 0xe7, 0x98, 0x9f, 0xe7, 0x9b, 0x8a, 0xe7, 0x9b, 0x9b,
+	0xe7, 0x9b, 0xb4, 0xe7, 0x9d, 0x8a, 0xe7, 0x9d, 0x80, 0xe7, 0xa3, 0x8c,
+	0xe7, 0xaa, 0xb1, 0xe7, 0xaf, 0x80, 0xe7, 0xb1, 0xbb, 0xe7, 0xb5, 0x9b,
+	0xe7, 0xb7, 0xb4, 0xe7, 0xbc, 0xbe, 0xe8, 0x80, 0x85, 0xe8, 0x8d, 0x92,
+	0xe8, 0x8f, 0xaf, 0xe8, 0x9d, 0xb9, 0xe8, 0xa5, 0x81, 0xe8, 0xa6, 0x86,
+	0xe8, 0xa6, 0x96, 0xe8, 0xaa, 0xbf, 0xe8, 0xab, 0xb8, 0xe8, 0xab, 0x8b,
+	0xe8, 0xac, 0x81, 0xe8, 0xab, 0xbe, 0xe8, 0xab, 0xad, 0xe8, 0xac, 0xb9,
+	0xe8, 0xae, 0x8a, 0xe8, 0xb4, 0x88, 0xe8, 0xbc, 0xb8, 0xe9, 0x81, 0xb2,
+	0xe9, 0x86, 0x99, 0xe9, 0x89, 0xb6, 0xe9, 0x99, 0xbc, 0xe9, 0x9b, 0xa3,
+	0xe9, 0x9d, 0x96, 0xe9, 0x9f, 0x9b, 0xe9, 0x9f, 0xbf, 0xe9, 0xa0, 0x8b,
+	0xe9, 0xa0, 0xbb, 0xe9, 0xac, 0x92, 0xe9, 0xbe, 0x9c, 0xf0, 0xa2, 0xa1,
+	0x8a, 0xf0, 0xa2, 0xa1, 0x84, 0xf0, 0xa3, 0x8f, 0x95, 0xe3, 0xae, 0x9d,
+	0xe4, 0x80, 0x98, 0xe4, 0x80, 0xb9, 0xf0, 0xa5, 0x89, 0x89, 0xf0, 0xa5,
+	0xb3, 0x90, 0xf0, 0xa7, 0xbb, 0x93, 0xe9, 0xbd, 0x83, 0xe9, 0xbe, 0x8e,
+	0x66, 0x66, 0x66, 0x69, 0x66, 0x6c, 0x66, 0x66, 0x69, 0x66, 0x66, 0x6c,
+	0x73, 0x74, 0x73, 0x74, 0xd5, 0xb4, 0xd5, 0xb6, 0xd5, 0xb4, 0xd5, 0xa5,
+	0xd5, 0xb4, 0xd5, 0xab, 0xd5, 0xbe, 0xd5, 0xb6, 0xd5, 0xb4, 0xd5, 0xad,
+	0xd7, 0x99, 0xd6, 0xb4, 0xd7, 0xb2, 0xd6, 0xb7, 0xd7, 0xa2, 0xd7, 0x90,
+	0xd7, 0x93, 0xd7, 0x94, 0xd7, 0x9b, 0xd7, 0x9c, 0xd7, 0x9d, 0xd7, 0xa8,
+	0xd7, 0xaa, 0x2b, 0xd7, 0xa9, 0xd7, 0x81, 0xd7, 0xa9, 0xd7, 0x82, 0xd7,
+	0xa9, 0xd6, 0xbc, 0xd7, 0x81, 0xd7, 0xa9, 0xd6, 0xbc, 0xd7, 0x82, 0xd7,
+	0x90, 0xd6, 0xb7, 0xd7, 0x90, 0xd6, 0xb8, 0xd7, 0x90, 0xd6, 0xbc, 0xd7,
+	0x91, 0xd6, 0xbc, 0xd7, 0x92, 0xd6, 0xbc, 0xd7, 0x93, 0xd6, 0xbc, 0xd7,
+	0x94, 0xd6, 0xbc, 0xd7, 0x95, 0xd6, 0xbc, 0xd7, 0x96, 0xd6, 0xbc, 0xd7,
+	0x98, 0xd6, 0xbc, 0xd7, 0x99, 0xd6, 0xbc, 0xd7, 0x9a, 0xd6, 0xbc, 0xd7,
+	0x9b, 0xd6, 0xbc, 0xd7, 0x9c, 0xd6, 0xbc, 0xd7, 0x9e, 0xd6, 0xbc, 0xd7,
+	0xa0, 0xd6, 0xbc, 0xd7, 0xa1, 0xd6, 0xbc, 0xd7, 0xa3, 0xd6, 0xbc, 0xd7,
+	0xa4, 0xd6, 0xbc, 0xd7, 0xa6, 0xd6, 0xbc, 0xd7, 0xa7, 0xd6, 0xbc, 0xd7,
+	0xa8, 0xd6, 0xbc, 0xd7, 0xa9, 0xd6, 0xbc, 0xd7, 0xaa, 0xd6, 0xbc, 0xd7,
+	0x95, 0xd6, 0xb9, 0xd7, 0x91, 0xd6, 0xbf, 0xd7, 0x9b, 0xd6, 0xbf, 0xd7,
+	0xa4, 0xd6, 0xbf, 0xd7, 0x90, 0xd7, 0x9c, 0xd9, 0xb1, 0xd9, 0xb1, 0xd9,
+	0xbb, 0xd9, 0xbb, 0xd9, 0xbb, 0xd9, 0xbb, 0xd9, 0xbe, 0xd9, 0xbe, 0xd9,
+	0xbe, 0xd9, 0xbe, 0xda, 0x80, 0xda, 0x80, 0xda, 0x80, 0xda, 0x80, 0xd9,
+	0xba, 0xd9, 0xba, 0xd9, 0xba, 0xd9, 0xba, 0xd9, 0xbf, 0xd9, 0xbf, 0xd9,
+	0xbf, 0xd9, 0xbf, 0xd9, 0xb9, 0xd9, 0xb9, 0xd9, 0xb9, 0xd9, 0xb9, 0xda,
+	0xa4, 0xda, 0xa4, 0xda, 0xa4, 0xda, 0xa4, 0xda, 0xa6, 0xda, 0xa6, 0xda,
+	0xa6, 0xda, 0xa6, 0xda, 0x84, 0xda, 0x84, 0xda, 0x84, 0xda, 0x84, 0xda,
+	0x83, 0xda, 0x83, 0xda, 0x83, 0xda, 0x83, 0xda, 0x86, 0xda, 0x86, 0xda,
+	0x86, 0xda, 0x86, 0xda, 0x87, 0xda, 0x87, 0xda, 0x87, 0xda, 0x87, 0xda,
+	0x8d, 0xda, 0x8d, 0xda, 0x8c, 0xda, 0x8c, 0xda, 0x8e, 0xda, 0x8e, 0xda,
+	0x88, 0xda, 0x88, 0xda, 0x98, 0xda, 0x98, 0xda, 0x91, 0xda, 0x91, 0xda,
+	0xa9, 0xda, 0xa9, 0xda, 0xa9, 0xda, 0xa9, 0xda, 0xaf, 0xda, 0xaf, 0xda,
+	0xaf, 0xda, 0xaf, 0xda, 0xb3, 0xda, 0xb3, 0xda, 0xb3, 0xda, 0xb3, 0xda,
+	0xb1, 0xda, 0xb1, 0xda, 0xb1, 0xda, 0xb1, 0xda, 0xba, 0xda, 0xba, 0xda,
+	0xbb, 0xda, 0xbb, 0xda, 0xbb, 0xda, 0xbb, 0xdb, 0x95, 0xd9, 0x94, 0xdb,
+	0x95, 0xd9, 0x94, 0xdb, 0x81, 0xdb, 0x81, 0xdb, 0x81, 0xdb, 0x81, 0xda,
+	0xbe, 0xda, 0xbe, 0xda, 0xbe, 0xda, 0xbe, 0xdb, 0x92, 0xdb, 0x92, 0xdb,
+	0x92, 0xd9, 0x94, 0xdb, 0x92, 0xd9, 0x94, 0xda, 0xad, 0xda, 0xad, 0xda,
+	0xad, 0xda, 0xad, 0xdb, 0x87, 0xdb, 0x87, 0xdb, 0x86, 0xdb, 0x86, 0xdb,
+	0x88, 0xdb, 0x88, 0xdb, 0x87, 0xd9, 0xb4, 0xdb, 0x8b, 0xdb, 0x8b, 0xdb,
+	0x85, 0xdb, 0x85, 0xdb, 0x89, 0xdb, 0x89, 0xdb, 0x90, 0xdb, 0x90, 0xdb,
+	0x90, 0xdb, 0x90, 0xd9, 0x89, 0xd9, 0x89, 0xd9, 0x8a, 0xd9, 0x94, 0xd8,
+	0xa7, 0xd9, 0x8a, 0xd9, 0x94, 0xd8, 0xa7, 0xd9, 0x8a, 0xd9, 0x94, 0xdb,
+	0x95, 0xd9, 0x8a, 0xd9, 0x94, 0xdb, 0x95, 0xd9, 0x8a, 0xd9, 0x94, 0xd9,
+	0x88, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x88, 0xd9, 0x8a, 0xd9, 0x94, 0xdb,
+	0x87, 0xd9, 0x8a, 0xd9, 0x94, 0xdb, 0x87, 0xd9, 0x8a, 0xd9, 0x94, 0xdb,
+	0x86, 0xd9, 0x8a, 0xd9, 0x94, 0xdb, 0x86, 0xd9, 0x8a, 0xd9, 0x94, 0xdb,
+	0x88, 0xd9, 0x8a, 0xd9, 0x94, 0xdb, 0x88, 0xd9, 0x8a, 0xd9, 0x94, 0xdb,
+	0x90, 0xd9, 0x8a, 0xd9, 0x94, 0xdb, 0x90, 0xd9, 0x8a, 0xd9, 0x94, 0xdb,
+	0x90, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x89, 0xd9, 0x8a, 0xd9, 0x94, 0xd9,
+	0x89, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x89, 0xdb, 0x8c, 0xdb, 0x8c, 0xdb,
+	0x8c, 0xdb, 0x8c, 0xd9, 0x8a, 0xd9, 0x94, 0xd8, 0xac, 0xd9, 0x8a, 0xd9,
+	0x94, 0xd8, 0xad, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x85, 0xd9, 0x8a, 0xd9,
+	0x94, 0xd9, 0x89, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x8a, 0xd8, 0xa8, 0xd8,
+	0xac, 0xd8, 0xa8, 0xd8, 0xad, 0xd8, 0xa8, 0xd8, 0xae, 0xd8, 0xa8, 0xd9,
+	0x85, 0xd8, 0xa8, 0xd9, 0x89, 0xd8, 0xa8, 0xd9, 0x8a, 0xd8, 0xaa, 0xd8,
+	0xac, 0xd8, 0xaa, 0xd8, 0xad, 0xd8, 0xaa, 0xd8, 0xae, 0xd8, 0xaa, 0xd9,
+	0x85, 0xd8, 0xaa, 0xd9, 0x89, 0xd8, 0xaa, 0xd9, 0x8a, 0xd8, 0xab, 0xd8,
+	0xac, 0xd8, 0xab, 0xd9, 0x85, 0xd8, 0xab, 0xd9, 0x89, 0xd8, 0xab, 0xd9,
+	0x8a, 0xd8, 0xac, 0xd8, 0xad, 0xd8, 0xac, 0xd9, 0x85, 0xd8, 0xad, 0xd8,
+	0xac, 0xd8, 0xad, 0xd9, 0x85, 0xd8, 0xae, 0xd8, 0xac, 0xd8, 0xae, 0xd8,
+	0xad, 0xd8, 0xae, 0xd9, 0x85, 0xd8, 0xb3, 0xd8, 0xac, 0xd8, 0xb3, 0xd8,
+	0xad, 0xd8, 0xb3, 0xd8, 0xae, 0xd8, 0xb3, 0xd9, 0x85, 0xd8, 0xb5, 0xd8,
+	0xad, 0xd8, 0xb5, 0xd9, 0x85, 0xd8, 0xb6, 0xd8, 0xac, 0xd8, 0xb6, 0xd8,
+	0xad, 0xd8, 0xb6, 0xd8, 0xae, 0xd8, 0xb6, 0xd9, 0x85, 0xd8, 0xb7, 0xd8,
+	0xad, 0xd8, 0xb7, 0xd9, 0x85, 0xd8, 0xb8, 0xd9, 0x85, 0xd8, 0xb9, 0xd8,
+	0xac, 0xd8, 0xb9, 0xd9, 0x85, 0xd8, 0xba, 0xd8, 0xac, 0xd8, 0xba, 0xd9,
+	0x85, 0xd9, 0x81, 0xd8, 0xac, 0xd9, 0x81, 0xd8, 0xad, 0xd9, 0x81, 0xd8,
+	0xae, 0xd9, 0x81, 0xd9, 0x85, 0xd9, 0x81, 0xd9, 0x89, 0xd9, 0x81, 0xd9,
+	0x8a, 0xd9, 0x82, 0xd8, 0xad, 0xd9, 0x82, 0xd9, 0x85, 0xd9, 0x82, 0xd9,
+	0x89, 0xd9, 0x82, 0xd9, 0x8a, 0xd9, 0x83, 0xd8, 0xa7, 0xd9, 0x83, 0xd8,
+	0xac, 0xd9, 0x83, 0xd8, 0xad, 0xd9, 0x83, 0xd8, 0xae, 0xd9, 0x83, 0xd9,
+	0x84, 0xd9, 0x83, 0xd9, 0x85, 0xd9, 0x83, 0xd9, 0x89, 0xd9, 0x83, 0xd9,
+	0x8a, 0xd9, 0x84, 0xd8, 0xac, 0xd9, 0x84, 0xd8, 0xad, 0xd9, 0x84, 0xd8,
+	0xae, 0xd9, 0x84, 0xd9, 0x85, 0xd9, 0x84, 0xd9, 0x89, 0xd9, 0x84, 0xd9,
+	0x8a, 0xd9, 0x85, 0xd8, 0xac, 0xd9, 0x85, 0xd8, 0xad, 0xd9, 0x85, 0xd8,
+	0xae, 0xd9, 0x85, 0xd9, 0x85, 0xd9, 0x85, 0xd9, 0x89, 0xd9, 0x85, 0xd9,
+	0x8a, 0xd9, 0x86, 0xd8, 0xac, 0xd9, 0x86, 0xd8, 0xad, 0xd9, 0x86, 0xd8,
+	0xae, 0xd9, 0x86, 0xd9, 0x85, 0xd9, 0x86, 0xd9, 0x89, 0xd9, 0x86, 0xd9,
+	0x8a, 0xd9, 0x87, 0xd8, 0xac, 0xd9, 0x87, 0xd9, 0x85, 0xd9, 0x87, 0xd9,
+	0x89, 0xd9, 0x87, 0xd9, 0x8a, 0xd9, 0x8a, 0xd8, 0xac, 0xd9, 0x8a, 0xd8,
+	0xad, 0xd9, 0x8a, 0xd8, 0xae, 0xd9, 0x8a, 0xd9, 0x85, 0xd9, 0x8a, 0xd9,
+	0x89, 0xd9, 0x8a, 0xd9, 0x8a, 0xd8, 0xb0, 0xd9, 0xb0, 0xd8, 0xb1, 0xd9,
+	0xb0, 0xd9, 0x89, 0xd9, 0xb0, 0x20, 0xd9, 0x8c, 0xd9, 0x91, 0x20, 0xd9,
+	0x8d, 0xd9, 0x91, 0x20, 0xd9, 0x8e, 0xd9, 0x91, 0x20, 0xd9, 0x8f, 0xd9,
+	0x91, 0x20, 0xd9, 0x90, 0xd9, 0x91, 0x20, 0xd9, 0x91, 0xd9, 0xb0, 0xd9,
+	0x8a, 0xd9, 0x94, 0xd8, 0xb1, 0xd9, 0x8a, 0xd9, 0x94, 0xd8, 0xb2, 0xd9,
+	0x8a, 0xd9, 0x94, 0xd9, 0x85, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x86, 0xd9,
+	0x8a, 0xd9, 0x94, 0xd9, 0x89, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x8a, 0xd8,
+	0xa8, 0xd8, 0xb1, 0xd8, 0xa8, 0xd8, 0xb2, 0xd8, 0xa8, 0xd9, 0x85, 0xd8,
+	0xa8, 0xd9, 0x86, 0xd8, 0xa8, 0xd9, 0x89, 0xd8, 0xa8, 0xd9, 0x8a, 0xd8,
+	0xaa, 0xd8, 0xb1, 0xd8, 0xaa, 0xd8, 0xb2, 0xd8, 0xaa, 0xd9, 0x85, 0xd8,
+	0xaa, 0xd9, 0x86, 0xd8, 0xaa, 0xd9, 0x89, 0xd8, 0xaa, 0xd9, 0x8a, 0xd8,
+	0xab, 0xd8, 0xb1, 0xd8, 0xab, 0xd8, 0xb2, 0xd8, 0xab, 0xd9, 0x85, 0xd8,
+	0xab, 0xd9, 0x86, 0xd8, 0xab, 0xd9, 0x89, 0xd8, 0xab, 0xd9, 0x8a, 0xd9,
+	0x81, 0xd9, 0x89, 0xd9, 0x81, 0xd9, 0x8a, 0xd9, 0x82, 0xd9, 0x89, 0xd9,
+	0x82, 0xd9, 0x8a, 0xd9, 0x83, 0xd8, 0xa7, 0xd9, 0x83, 0xd9, 0x84, 0xd9,
+	0x83, 0xd9, 0x85, 0xd9, 0x83, 0xd9, 0x89, 0xd9, 0x83, 0xd9, 0x8a, 0xd9,
+	0x84, 0xd9, 0x85, 0xd9, 0x84, 0xd9, 0x89, 0xd9, 0x84, 0xd9, 0x8a, 0xd9,
+	0x85, 0xd8, 0xa7, 0xd9, 0x85, 0xd9, 0x85, 0xd9, 0x86, 0xd8, 0xb1, 0xd9,
+	0x86, 0xd8, 0xb2, 0xd9, 0x86, 0xd9, 0x85, 0xd9, 0x86, 0xd9, 0x86, 0xd9,
+	0x86, 0xd9, 0x89, 0xd9, 0x86, 0xd9, 0x8a, 0xd9, 0x89, 0xd9, 0xb0, 0xd9,
+	0x8a, 0xd8, 0xb1, 0xd9, 0x8a, 0xd8, 0xb2, 0xd9, 0x8a, 0xd9, 0x85, 0xd9,
+	0x8a, 0xd9, 0x86, 0xd9, 0x8a, 0xd9, 0x89, 0xd9, 0x8a, 0xd9, 0x8a, 0xd9,
+	0x8a, 0xd9, 0x94, 0xd8, 0xac, 0xd9, 0x8a, 0xd9, 0x94, 0xd8, 0xad, 0xd9,
+	0x8a, 0xd9, 0x94, 0xd8, 0xae, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x85, 0xd9,
+	0x8a, 0xd9, 0x94, 0xd9, 0x87, 0xd8, 0xa8, 0xd8, 0xac, 0xd8, 0xa8, 0xd8,
+	0xad, 0xd8, 0xa8, 0xd8, 0xae, 0xd8, 0xa8, 0xd9, 0x85, 0xd8, 0xa8, 0xd9,
+	0x87, 0xd8, 0xaa, 0xd8, 0xac, 0xd8, 0xaa, 0xd8, 0xad, 0xd8, 0xaa, 0xd8,
+	0xae, 0xd8, 0xaa, 0xd9, 0x85, 0xd8, 0xaa, 0xd9, 0x87, 0xd8, 0xab, 0xd9,
+	0x85, 0xd8, 0xac, 0xd8, 0xad, 0xd8, 0xac, 0xd9, 0x85, 0xd8, 0xad, 0xd8,
+	0xac, 0xd8, 0xad, 0xd9, 0x85, 0xd8, 0xae, 0xd8, 0xac, 0xd8, 0xae, 0xd9,
+	0x85, 0xd8, 0xb3, 0xd8, 0xac, 0xd8, 0xb3, 0xd8, 0xad, 0xd8, 0xb3, 0xd8,
+	0xae, 0xd8, 0xb3, 0xd9, 0x85, 0xd8, 0xb5, 0xd8, 0xad, 0xd8, 0xb5, 0xd8,
+	0xae, 0xd8, 0xb5, 0xd9, 0x85, 0xd8, 0xb6, 0xd8, 0xac, 0xd8, 0xb6, 0xd8,
+	0xad, 0xd8, 0xb6, 0xd8, 0xae, 0xd8, 0xb6, 0xd9, 0x85, 0xd8, 0xb7, 0xd8,
+	0xad, 0xd8, 0xb8, 0xd9, 0x85, 0xd8, 0xb9, 0xd8, 0xac, 0xd8, 0xb9, 0xd9,
+	0x85, 0xd8, 0xba, 0xd8, 0xac, 0xd8, 0xba, 0xd9, 0x85, 0xd9, 0x81, 0xd8,
+	0xac, 0xd9, 0x81, 0xd8, 0xad, 0xd9, 0x81, 0xd8, 0xae, 0xd9, 0x81, 0xd9,
+	0x85, 0xd9, 0x82, 0xd8, 0xad, 0xd9, 0x82, 0xd9, 0x85, 0xd9, 0x83, 0xd8,
+	0xac, 0xd9, 0x83, 0xd8, 0xad, 0xd9, 0x83, 0xd8, 0xae, 0xd9, 0x83, 0xd9,
+	0x84, 0xd9, 0x83, 0xd9, 0x85, 0xd9, 0x84, 0xd8, 0xac, 0xd9, 0x84, 0xd8,
+	0xad, 0xd9, 0x84, 0xd8, 0xae, 0xd9, 0x84, 0xd9, 0x85, 0xd9, 0x84, 0xd9,
+	0x87, 0xd9, 0x85, 0xd8, 0xac, 0xd9, 0x85, 0xd8, 0xad, 0xd9, 0x85, 0xd8,
+	0xae, 0xd9, 0x85, 0xd9, 0x85, 0xd9, 0x86, 0xd8, 0xac, 0xd9, 0x86, 0xd8,
+	0xad, 0xd9, 0x86, 0xd8, 0xae, 0xd9, 0x86, 0xd9, 0x85, 0xd9, 0x86, 0xd9,
+	0x87, 0xd9, 0x87, 0xd8, 0xac, 0xd9, 0x87, 0xd9, 0x85, 0xd9, 0x87, 0xd9,
+	0xb0, 0xd9, 0x8a, 0xd8, 0xac, 0xd9, 0x8a, 0xd8, 0xad, 0xd9, 0x8a, 0xd8,
+	0xae, 0xd9, 0x8a, 0xd9, 0x85, 0xd9, 0x8a, 0xd9, 0x87, 0xd9, 0x8a, 0xd9,
+	0x94, 0xd9, 0x85, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x87, 0xd8, 0xa8, 0xd9,
+	0x85, 0xd8, 0xa8, 0xd9, 0x87, 0xd8, 0xaa, 0xd9, 0x85, 0xd8, 0xaa, 0xd9,
+	0x87, 0xd8, 0xab, 0xd9, 0x85, 0xd8, 0xab, 0xd9, 0x87, 0xd8, 0xb3, 0xd9,
+	0x85, 0xd8, 0xb3, 0xd9, 0x87, 0xd8, 0xb4, 0xd9, 0x85, 0xd8, 0xb4, 0xd9,
+	0x87, 0xd9, 0x83, 0xd9, 0x84, 0xd9, 0x83, 0xd9, 0x85, 0xd9, 0x84, 0xd9,
+	0x85, 0xd9, 0x86, 0xd9, 0x85, 0xd9, 0x86, 0xd9, 0x87, 0xd9, 0x8a, 0xd9,
+	0x85, 0xd9, 0x8a, 0xd9, 0x87, 0xd9, 0x80, 0xd9, 0x8e, 0xd9, 0x91, 0xd9,
+	0x80, 0xd9, 0x8f, 0xd9, 0x91, 0xd9, 0x80, 0xd9, 0x90, 0xd9, 0x91, 0xd8,
+	0xb7, 0xd9, 0x89, 0xd8, 0xb7, 0xd9, 0x8a, 0xd8, 0xb9, 0xd9, 0x89, 0xd8,
+	0xb9, 0xd9, 0x8a, 0xd8, 0xba, 0xd9, 0x89, 0xd8, 0xba, 0xd9, 0x8a, 0xd8,
+	0xb3, 0xd9, 0x89, 0xd8, 0xb3, 0xd9, 0x8a, 0xd8, 0xb4, 0xd9, 0x89, 0xd8,
+	0xb4, 0xd9, 0x8a, 0xd8, 0xad, 0xd9, 0x89, 0xd8, 0xad, 0xd9, 0x8a, 0xd8,
+	0xac, 0xd9, 0x89, 0xd8, 0xac, 0xd9, 0x8a, 0xd8, 0xae, 0xd9, 0x89, 0xd8,
+	0xae, 0xd9, 0x8a, 0xd8, 0xb5, 0xd9, 0x89, 0xd8, 0xb5, 0xd9, 0x8a, 0xd8,
+	0xb6, 0xd9, 0x89, 0xd8, 0xb6, 0xd9, 0x8a, 0xd8, 0xb4, 0xd8, 0xac, 0xd8,
+	0xb4, 0xd8, 0xad, 0xd8, 0xb4, 0xd8, 0xae, 0xd8, 0xb4, 0xd9, 0x85, 0xd8,
+	0xb4, 0xd8, 0xb1, 0xd8, 0xb3, 0xd8, 0xb1, 0xd8, 0xb5, 0xd8, 0xb1, 0xd8,
+	0xb6, 0xd8, 0xb1, 0xd8, 0xb7, 0xd9, 0x89, 0xd8, 0xb7, 0xd9, 0x8a, 0xd8,
+	0xb9, 0xd9, 0x89, 0xd8, 0xb9, 0xd9, 0x8a, 0xd8, 0xba, 0xd9, 0x89, 0xd8,
+	0xba, 0xd9, 0x8a, 0xd8, 0xb3, 0xd9, 0x89, 0xd8, 0xb3, 0xd9, 0x8a, 0xd8,
+	0xb4, 0xd9, 0x89, 0xd8, 0xb4, 0xd9, 0x8a, 0xd8, 0xad, 0xd9, 0x89, 0xd8,
+	0xad, 0xd9, 0x8a, 0xd8, 0xac, 0xd9, 0x89, 0xd8, 0xac, 0xd9, 0x8a, 0xd8,
+	0xae, 0xd9, 0x89, 0xd8, 0xae, 0xd9, 0x8a, 0xd8, 0xb5, 0xd9, 0x89, 0xd8,
+	0xb5, 0xd9, 0x8a, 0xd8, 0xb6, 0xd9, 0x89, 0xd8, 0xb6, 0xd9, 0x8a, 0xd8,
+	0xb4, 0xd8, 0xac, 0xd8, 0xb4, 0xd8, 0xad, 0xd8, 0xb4, 0xd8, 0xae, 0xd8,
+	0xb4, 0xd9, 0x85, 0xd8, 0xb4, 0xd8, 0xb1, 0xd8, 0xb3, 0xd8, 0xb1, 0xd8,
+	0xb5, 0xd8, 0xb1, 0xd8, 0xb6, 0xd8, 0xb1, 0xd8, 0xb4, 0xd8, 0xac, 0xd8,
+	0xb4, 0xd8, 0xad, 0xd8, 0xb4, 0xd8, 0xae, 0xd8, 0xb4, 0xd9, 0x85, 0xd8,
+	0xb3, 0xd9, 0x87, 0xd8, 0xb4, 0xd9, 0x87, 0xd8, 0xb7, 0xd9, 0x85, 0xd8,
+	0xb3, 0xd8, 0xac, 0xd8, 0xb3, 0xd8, 0xad, 0xd8, 0xb3, 0xd8, 0xae, 0xd8,
+	0xb4, 0xd8, 0xac, 0xd8, 0xb4, 0xd8, 0xad, 0xd8, 0xb4, 0xd8, 0xae, 0xd8,
+	0xb7, 0xd9, 0x85, 0xd8, 0xb8, 0xd9, 0x85, 0xd8, 0xa7, 0xd9, 0x8b, 0xd8,
+	0xa7, 0xd9, 0x8b, 0xd8, 0xaa, 0xd8, 0xac, 0xd9, 0x85, 0xd8, 0xaa, 0xd8,
+	0xad, 0xd8, 0xac, 0xd8, 0xaa, 0xd8, 0xad, 0xd8, 0xac, 0xd8, 0xaa, 0xd8,
+	0xad, 0xd9, 0x85, 0xd8, 0xaa, 0xd8, 0xae, 0xd9, 0x85, 0xd8, 0xaa, 0xd9,
+	0x85, 0xd8, 0xac, 0xd8, 0xaa, 0xd9, 0x85, 0xd8, 0xad, 0xd8, 0xaa, 0xd9,
+	0x85, 0xd8, 0xae, 0xd8, 0xac, 0xd9, 0x85, 0xd8, 0xad, 0xd8, 0xac, 0xd9,
+	0x85, 0xd8, 0xad, 0xd8, 0xad, 0xd9, 0x85, 0xd9, 0x8a, 0xd8, 0xad, 0xd9,
+	0x85, 0xd9, 0x89, 0xd8, 0xb3, 0xd8, 0xad, 0xd8, 0xac, 0xd8, 0xb3, 0xd8,
+	0xac, 0xd8, 0xad, 0xd8, 0xb3, 0xd8, 0xac, 0xd9, 0x89, 0xd8, 0xb3, 0xd9,
+	0x85, 0xd8, 0xad, 0xd8, 0xb3, 0xd9, 0x85, 0xd8, 0xad, 0xd8, 0xb3, 0xd9,
+	0x85, 0xd8, 0xac, 0xd8, 0xb3, 0xd9, 0x85, 0xd9, 0x85, 0xd8, 0xb3, 0xd9,
+	0x85, 0xd9, 0x85, 0xd8, 0xb5, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xb5, 0xd8,
+	0xad, 0xd8, 0xad, 0xd8, 0xb5, 0xd9, 0x85, 0xd9, 0x85, 0xd8, 0xb4, 0xd8,
+	0xad, 0xd9, 0x85, 0xd8, 0xb4, 0xd8, 0xad, 0xd9, 0x85, 0xd8, 0xb4, 0xd8,
+	0xac, 0xd9, 0x8a, 0xd8, 0xb4, 0xd9, 0x85, 0xd8, 0xae, 0xd8, 0xb4, 0xd9,
+	0x85, 0xd8, 0xae, 0xd8, 0xb4, 0xd9, 0x85, 0xd9, 0x85, 0xd8, 0xb4, 0xd9,
+	0x85, 0xd9, 0x85, 0xd8, 0xb6, 0xd8, 0xad, 0xd9, 0x89, 0xd8, 0xb6, 0xd8,
+	0xae, 0xd9, 0x85, 0xd8, 0xb6, 0xd8, 0xae, 0xd9, 0x85, 0xd8, 0xb7, 0xd9,
+	0x85, 0xd8, 0xad, 0xd8, 0xb7, 0xd9, 0x85, 0xd8, 0xad, 0xd8, 0xb7, 0xd9,
+	0x85, 0xd9, 0x85, 0xd8, 0xb7, 0xd9, 0x85, 0xd9, 0x8a, 0xd8, 0xb9, 0xd8,
+	0xac, 0xd9, 0x85, 0xd8, 0xb9, 0xd9, 0x85, 0xd9, 0x85, 0xd8, 0xb9, 0xd9,
+	0x85, 0xd9, 0x85, 0xd8, 0xb9, 0xd9, 0x85, 0xd9, 0x89, 0xd8, 0xba, 0xd9,
+	0x85, 0xd9, 0x85, 0xd8, 0xba, 0xd9, 0x85, 0xd9, 0x8a, 0xd8, 0xba, 0xd9,
+	0x85, 0xd9, 0x89, 0xd9, 0x81, 0xd8, 0xae, 0xd9, 0x85, 0xd9, 0x81, 0xd8,
+	0xae, 0xd9, 0x85, 0xd9, 0x82, 0xd9, 0x85, 0xd8, 0xad, 0xd9, 0x82, 0xd9,
+	0x85, 0xd9, 0x85, 0xd9, 0x84, 0xd8, 0xad, 0xd9, 0x85, 0xd9, 0x84, 0xd8,
+	0xad, 0xd9, 0x8a, 0xd9, 0x84, 0xd8, 0xad, 0xd9, 0x89, 0xd9, 0x84, 0xd8,
+	0xac, 0xd8, 0xac, 0xd9, 0x84, 0xd8, 0xac, 0xd8, 0xac, 0xd9, 0x84, 0xd8,
+	0xae, 0xd9, 0x85, 0xd9, 0x84, 0xd8, 0xae, 0xd9, 0x85, 0xd9, 0x84, 0xd9,
+	0x85, 0xd8, 0xad, 0xd9, 0x84, 0xd9, 0x85, 0xd8, 0xad, 0xd9, 0x85, 0xd8,
+	0xad, 0xd8, 0xac, 0xd9, 0x85, 0xd8, 0xad, 0xd9, 0x85, 0xd9, 0x85, 0xd8,
+	0xad, 0xd9, 0x8a, 0xd9, 0x85, 0xd8, 0xac, 0xd8, 0xad, 0xd9, 0x85, 0xd8,
+	0xac, 0xd9, 0x85, 0xd9, 0x85, 0xd8, 0xae, 0xd8, 0xac, 0xd9, 0x85, 0xd8,
+	0xae, 0xd9, 0x85, 0xd9, 0x85, 0xd8, 0xac, 0xd8, 0xae, 0xd9, 0x87, 0xd9,
+	0x85, 0xd8, 0xac, 0xd9, 0x87, 0xd9, 0x85, 0xd9, 0x85, 0xd9, 0x86, 0xd8,
+	0xad, 0xd9, 0x85, 0xd9, 0x86, 0xd8, 0xad, 0xd9, 0x89, 0xd9, 0x86, 0xd8,
+	0xac, 0xd9, 0x85, 0xd9, 0x86, 0xd8, 0xac, 0xd9, 0x85, 0xd9, 0x86, 0xd8,
+	0xac, 0xd9, 0x89, 0xd9, 0x86, 0xd9, 0x85, 0xd9, 0x8a, 0xd9, 0x86, 0xd9,
+	0x85, 0xd9, 0x89, 0xd9, 0x8a, 0xd9, 0x85, 0xd9, 0x85, 0xd9, 0x8a, 0xd9,
+	0x85, 0xd9, 0x85, 0xd8, 0xa8, 0xd8, 0xae, 0xd9, 0x8a, 0xd8, 0xaa, 0xd8,
+	0xac, 0xd9, 0x8a, 0xd8, 0xaa, 0xd8, 0xac, 0xd9, 0x89, 0xd8, 0xaa, 0xd8,
+	0xae, 0xd9, 0x8a, 0xd8, 0xaa, 0xd8, 0xae, 0xd9, 0x89, 0xd8, 0xaa, 0xd9,
+	0x85, 0xd9, 0x8a, 0xd8, 0xaa, 0xd9, 0x85, 0xd9, 0x89, 0xd8, 0xac, 0xd9,
+	0x85, 0xd9, 0x8a, 0xd8, 0xac, 0xd8, 0xad, 0xd9, 0x89, 0xd8, 0xac, 0xd9,
+	0x85, 0xd9, 0x89, 0xd8, 0xb3, 0xd8, 0xae, 0xd9, 0x89, 0xd8, 0xb5, 0xd8,
+	0xad, 0xd9, 0x8a, 0xd8, 0xb4, 0xd8, 0xad, 0xd9, 0x8a, 0xd8, 0xb6, 0xd8,
+	0xad, 0xd9, 0x8a, 0xd9, 0x84, 0xd8, 0xac, 0xd9, 0x8a, 0xd9, 0x84, 0xd9,
+	0x85, 0xd9, 0x8a, 0xd9, 0x8a, 0xd8, 0xad, 0xd9, 0x8a, 0xd9, 0x8a, 0xd8,
+	0xac, 0xd9, 0x8a, 0xd9, 0x8a, 0xd9, 0x85, 0xd9, 0x8a, 0xd9, 0x85, 0xd9,
+	0x85, 0xd9, 0x8a, 0xd9, 0x82, 0xd9, 0x85, 0xd9, 0x8a, 0xd9, 0x86, 0xd8,
+	0xad, 0xd9, 0x8a, 0xd9, 0x82, 0xd9, 0x85, 0xd8, 0xad, 0xd9, 0x84, 0xd8,
+	0xad, 0xd9, 0x85, 0xd8, 0xb9, 0xd9, 0x85, 0xd9, 0x8a, 0xd9, 0x83, 0xd9,
+	0x85, 0xd9, 0x8a, 0xd9, 0x86, 0xd8, 0xac, 0xd8, 0xad, 0xd9, 0x85, 0xd8,
+	0xae, 0xd9, 0x8a, 0xd9, 0x84, 0xd8, 0xac, 0xd9, 0x85, 0xd9, 0x83, 0xd9,
+	0x85, 0xd9, 0x85, 0xd9, 0x84, 0xd8, 0xac, 0xd9, 0x85, 0xd9, 0x86, 0xd8,
+	0xac, 0xd8, 0xad, 0xd8, 0xac, 0xd8, 0xad, 0xd9, 0x8a, 0xd8, 0xad, 0xd8,
+	0xac, 0xd9, 0x8a, 0xd9, 0x85, 0xd8, 0xac, 0xd9, 0x8a, 0xd9, 0x81, 0xd9,
+	0x85, 0xd9, 0x8a, 0xd8, 0xa8, 0xd8, 0xad, 0xd9, 0x8a, 0xd9, 0x83, 0xd9,
+	0x85, 0xd9, 0x85, 0xd8, 0xb9, 0xd8, 0xac, 0xd9, 0x85, 0xd8, 0xb5, 0xd9,
+	0x85, 0xd9, 0x85, 0xd8, 0xb3, 0xd8, 0xae, 0xd9, 0x8a, 0xd9, 0x86, 0xd8,
+	0xac, 0xd9, 0x8a, 0xd8, 0xb5, 0xd9, 0x84, 0xdb, 0x92, 0xd9, 0x82, 0xd9,
+	0x84, 0xdb, 0x92, 0xd8, 0xa7, 0xd9, 0x84, 0xd9, 0x84, 0xd9, 0x87, 0xd8,
+	0xa7, 0xd9, 0x83, 0xd8, 0xa8, 0xd8, 0xb1, 0xd9, 0x85, 0xd8, 0xad, 0xd9,
+	0x85, 0xd8, 0xaf, 0xd8, 0xb5, 0xd9, 0x84, 0xd8, 0xb9, 0xd9, 0x85, 0xd8,
+	0xb1, 0xd8, 0xb3, 0xd9, 0x88, 0xd9, 0x84, 0xd8, 0xb9, 0xd9, 0x84, 0xd9,
+	0x8a, 0xd9, 0x87, 0xd9, 0x88, 0xd8, 0xb3, 0xd9, 0x84, 0xd9, 0x85, 0xd8,
+	0xb5, 0xd9, 0x84, 0xd9, 0x89, 0xd8, 0xb5, 0xd9, 0x84, 0xd9, 0x89, 0x20,
+	0xd8, 0xa7, 0xd9, 0x84, 0xd9, 0x84, 0xd9, 0x87, 0x20, 0xd8, 0xb9, 0xd9,
+	0x84, 0xd9, 0x8a, 0xd9, 0x87, 0x20, 0xd9, 0x88, 0xd8, 0xb3, 0xd9, 0x84,
+	0xd9, 0x85, 0xd8, 0xac, 0xd9, 0x84, 0x20, 0xd8, 0xac, 0xd9, 0x84, 0xd8,
+	0xa7, 0xd9, 0x84, 0xd9, 0x87, 0xd8, 0xb1, 0xdb, 0x8c, 0xd8, 0xa7, 0xd9,
+	0x84, 0x2c, 0xe3, 0x80, 0x81, 0xe3, 0x80, 0x82, 0x3a, 0x3b, 0x21, 0x3f,
+	0xe3, 0x80, 0x96, 0xe3, 0x80, 0x97, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0xe2,
+	0x80, 0x94, 0xe2, 0x80, 0x93, 0x5f, 0x5f, 0x28, 0x29, 0x7b, 0x7d, 0xe3,
+	0x80, 0x94, 0xe3, 0x80, 0x95, 0xe3, 0x80, 0x90, 0xe3, 0x80, 0x91, 0xe3,
+	0x80, 0x8a, 0xe3, 0x80, 0x8b, 0xe3, 0x80, 0x88, 0xe3, 0x80, 0x89, 0xe3,
+	0x80, 0x8c, 0xe3, 0x80, 0x8d, 0xe3, 0x80, 0x8e, 0xe3, 0x80, 0x8f, 0x5b,
+	0x5d, 0x20, 0xcc, 0x85, 0x20, 0xcc, 0x85, 0x20, 0xcc, 0x85, 0x20, 0xcc,
+	0x85, 0x5f, 0x5f, 0x5f, 0x2c, 0xe3, 0x80, 0x81, 0x2e, 0x3b, 0x3a, 0x3f,
+	0x21, 0xe2, 0x80, 0x94, 0x28, 0x29, 0x7b, 0x7d, 0xe3, 0x80, 0x94, 0xe3,
+	0x80, 0x95, 0x23, 0x26, 0x2a, 0x2b, 0x2d, 0x3c, 0x3e, 0x3d, 0x5c, 0x24,
+	0x25, 0x40, 0x20, 0xd9, 0x8b, 0xd9, 0x80, 0xd9, 0x8b, 0x20, 0xd9, 0x8c,
+	0x20, 0xd9, 0x8d, 0x20, 0xd9, 0x8e, 0xd9, 0x80, 0xd9, 0x8e, 0x20, 0xd9,
+	0x8f, 0xd9, 0x80, 0xd9, 0x8f, 0x20, 0xd9, 0x90, 0xd9, 0x80, 0xd9, 0x90,
+	0x20, 0xd9, 0x91, 0xd9, 0x80, 0xd9, 0x91, 0x20, 0xd9, 0x92, 0xd9, 0x80,
+	0xd9, 0x92, 0xd8, 0xa1, 0xd8, 0xa7, 0xd9, 0x93, 0xd8, 0xa7, 0xd9, 0x93,
+	0xd8, 0xa7, 0xd9, 0x94, 0xd8, 0xa7, 0xd9, 0x94, 0xd9, 0x88, 0xd9, 0x94,
+	0xd9, 0x88, 0xd9, 0x94, 0xd8, 0xa7, 0xd9, 0x95, 0xd8, 0xa7, 0xd9, 0x95,
+	0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x8a, 0xd9, 0x94,
+	0xd9, 0x8a, 0xd9, 0x94, 0xd8, 0xa7, 0xd8, 0xa7, 0xd8, 0xa8, 0xd8, 0xa8,
+	0xd8, 0xa8, 0xd8, 0xa8, 0xd8, 0xa9, 0xd8, 0xa9, 0xd8, 0xaa, 0xd8, 0xaa,
+	0xd8, 0xaa, 0xd8, 0xaa, 0xd8, 0xab, 0xd8, 0xab, 0xd8, 0xab, 0xd8, 0xab,
+	0xd8, 0xac, 0xd8, 0xac, 0xd8, 0xac, 0xd8, 0xac, 0xd8, 0xad, 0xd8, 0xad,
+	0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xae, 0xd8, 0xae, 0xd8, 0xae, 0xd8, 0xae,
+	0xd8, 0xaf, 0xd8, 0xaf, 0xd8, 0xb0, 0xd8, 0xb0, 0xd8, 0xb1, 0xd8, 0xb1,
+	0xd8, 0xb2, 0xd8, 0xb2, 0xd8, 0xb3, 0xd8, 0xb3, 0xd8, 0xb3, 0xd8, 0xb3,
+	0xd8, 0xb4, 0xd8, 0xb4, 0xd8, 0xb4, 0xd8, 0xb4, 0xd8, 0xb5, 0xd8, 0xb5,
+	0xd8, 0xb5, 0xd8, 0xb5, 0xd8, 0xb6, 0xd8, 0xb6, 0xd8, 0xb6, 0xd8, 0xb6,
+	0xd8, 0xb7, 0xd8, 0xb7, 0xd8, 0xb7, 0xd8, 0xb7, 0xd8, 0xb8, 0xd8, 0xb8,
+	0xd8, 0xb8, 0xd8, 0xb8, 0xd8, 0xb9, 0xd8, 0xb9, 0xd8, 0xb9, 0xd8, 0xb9,
+	0xd8, 0xba, 0xd8, 0xba, 0xd8, 0xba, 0xd8, 0xba, 0xd9, 0x81, 0xd9, 0x81,
+	0xd9, 0x81, 0xd9, 0x81, 0xd9, 0x82, 0xd9, 0x82, 0xd9, 0x82, 0xd9, 0x82,
+	0xd9, 0x83, 0xd9, 0x83, 0xd9, 0x83, 0xd9, 0x83, 0xd9, 0x84, 0xd9, 0x84,
+	0xd9, 0x84, 0xd9, 0x84, 0xd9, 0x85, 0xd9, 0x85, 0xd9, 0x85, 0xd9, 0x85,
+	0xd9, 0x86, 0xd9, 0x86, 0xd9, 0x86, 0xd9, 0x86, 0xd9, 0x87, 0xd9, 0x87,
+	0xd9, 0x87, 0xd9, 0x87, 0xd9, 0x88, 0xd9, 0x88, 0xd9, 0x89, 0xd9, 0x89,
+	0xd9, 0x8a, 0xd9, 0x8a, 0xd9, 0x8a, 0xd9, 0x8a, 0xd9, 0x84, 0xd8, 0xa7,
+	0xd9, 0x93, 0xd9, 0x84, 0xd8, 0xa7, 0xd9, 0x93, 0xd9, 0x84, 0xd8, 0xa7,
+	0xd9, 0x94, 0xd9, 0x84, 0xd8, 0xa7, 0xd9, 0x94, 0xd9, 0x84, 0xd8, 0xa7,
+	0xd9, 0x95, 0xd9, 0x84, 0xd8, 0xa7, 0xd9, 0x95, 0xd9, 0x84, 0xd8, 0xa7,
+	0xd9, 0x84, 0xd8, 0xa7, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+	0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34,
+	0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40,
+	0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c,
+	0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+	0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63, 0x64,
+	0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+	0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c,
+	0x7d, 0x7e, 0xe2, 0xa6, 0x85, 0xe2, 0xa6, 0x86, 0xe3, 0x80, 0x82, 0xe3,
+	0x80, 0x8c, 0xe3, 0x80, 0x8d, 0xe3, 0x80, 0x81, 0xe3, 0x83, 0xbb, 0xe3,
+	0x83, 0xb2, 0xe3, 0x82, 0xa1, 0xe3, 0x82, 0xa3, 0xe3, 0x82, 0xa5, 0xe3,
+	0x82, 0xa7, 0xe3, 0x82, 0xa9, 0xe3, 0x83, 0xa3, 0xe3, 0x83, 0xa5, 0xe3,
+	0x83, 0xa7, 0xe3, 0x83, 0x83, 0xe3, 0x83, 0xbc, 0xe3, 0x82, 0xa2, 0xe3,
+	0x82, 0xa4, 0xe3, 0x82, 0xa6, 0xe3, 0x82, 0xa8, 0xe3, 0x82, 0xaa, 0xe3,
+	0x82, 0xab, 0xe3, 0x82, 0xad, 0xe3, 0x82, 0xaf, 0xe3, 0x82, 0xb1, 0xe3,
+	0x82, 0xb3, 0xe3, 0x82, 0xb5, 0xe3, 0x82, 0xb7, 0xe3, 0x82, 0xb9, 0xe3,
+	0x82, 0xbb, 0xe3, 0x82, 0xbd, 0xe3, 0x82, 0xbf, 0xe3, 0x83, 0x81, 0xe3,
+	0x83, 0x84, 0xe3, 0x83, 0x86, 0xe3, 0x83, 0x88, 0xe3, 0x83, 0x8a, 0xe3,
+	0x83, 0x8b, 0xe3, 0x83, 0x8c, 0xe3, 0x83, 0x8d, 0xe3, 0x83, 0x8e, 0xe3,
+	0x83, 0x8f, 0xe3, 0x83, 0x92, 0xe3, 0x83, 0x95, 0xe3, 0x83, 0x98, 0xe3,
+	0x83, 0x9b, 0xe3, 0x83, 0x9e, 0xe3, 0x83, 0x9f, 0xe3, 0x83, 0xa0, 0xe3,
+	0x83, 0xa1, 0xe3, 0x83, 0xa2, 0xe3, 0x83, 0xa4, 0xe3, 0x83, 0xa6, 0xe3,
+	0x83, 0xa8, 0xe3, 0x83, 0xa9, 0xe3, 0x83, 0xaa, 0xe3, 0x83, 0xab, 0xe3,
+	0x83, 0xac, 0xe3, 0x83, 0xad, 0xe3, 0x83, 0xaf, 0xe3, 0x83, 0xb3, 0xe3,
+	0x82, 0x99, 0xe3, 0x82, 0x9a, 0xe1, 0x85, 0xa0, 0xe1, 0x84, 0x80, 0xe1,
+	0x84, 0x81, 0xe1, 0x86, 0xaa, 0xe1, 0x84, 0x82, 0xe1, 0x86, 0xac, 0xe1,
+	0x86, 0xad, 0xe1, 0x84, 0x83, 0xe1, 0x84, 0x84, 0xe1, 0x84, 0x85, 0xe1,
+	0x86, 0xb0, 0xe1, 0x86, 0xb1, 0xe1, 0x86, 0xb2, 0xe1, 0x86, 0xb3, 0xe1,
+	0x86, 0xb4, 0xe1, 0x86, 0xb5, 0xe1, 0x84, 0x9a, 0xe1, 0x84, 0x86, 0xe1,
+	0x84, 0x87, 0xe1, 0x84, 0x88, 0xe1, 0x84, 0xa1, 0xe1, 0x84, 0x89, 0xe1,
+	0x84, 0x8a, 0xe1, 0x84, 0x8b, 0xe1, 0x84, 0x8c, 0xe1, 0x84, 0x8d, 0xe1,
+	0x84, 0x8e, 0xe1, 0x84, 0x8f, 0xe1, 0x84, 0x90, 0xe1, 0x84, 0x91, 0xe1,
+	0x84, 0x92, 0xe1, 0x85, 0xa1, 0xe1, 0x85, 0xa2, 0xe1, 0x85, 0xa3, 0xe1,
+	0x85, 0xa4, 0xe1, 0x85, 0xa5, 0xe1, 0x85, 0xa6, 0xe1, 0x85, 0xa7, 0xe1,
+	0x85, 0xa8, 0xe1, 0x85, 0xa9, 0xe1, 0x85, 0xaa, 0xe1, 0x85, 0xab, 0xe1,
+	0x85, 0xac, 0xe1, 0x85, 0xad, 0xe1, 0x85, 0xae, 0xe1, 0x85, 0xaf, 0xe1,
+	0x85, 0xb0, 0xe1, 0x85, 0xb1, 0xe1, 0x85, 0xb2, 0xe1, 0x85, 0xb3, 0xe1,
+	0x85, 0xb4, 0xe1, 0x85, 0xb5, 0xc2, 0xa2, 0xc2, 0xa3, 0xc2, 0xac, 0x20,
+	0xcc, 0x84, 0xc2, 0xa6, 0xc2, 0xa5, 0xe2, 0x82, 0xa9, 0xe2, 0x94, 0x82,
+	0xe2, 0x86, 0x90, 0xe2, 0x86, 0x91, 0xe2, 0x86, 0x92, 0xe2, 0x86, 0x93,
+	0xe2, 0x96, 0xa0, 0xe2, 0x97, 0x8b, 0xcb, 0x90, 0xcb, 0x91, 0xc3, 0xa6,
+	0xca, 0x99, 0xc9, 0x93, 0xca, 0xa3, 0xea, 0xad, 0xa6, 0xca, 0xa5, 0xca,
+	0xa4, 0xc9, 0x96, 0xc9, 0x97, 0xe1, 0xb6, 0x91, 0xc9, 0x98, 0xc9, 0x9e,
+	0xca, 0xa9, 0xc9, 0xa4, 0xc9, 0xa2, 0xc9, 0xa0, 0xca, 0x9b, 0xc4, 0xa7,
+	0xca, 0x9c, 0xc9, 0xa7, 0xca, 0x84, 0xca, 0xaa, 0xca, 0xab, 0xc9, 0xac,
+	0xf0, 0x9d, 0xbc, 0x84, 0xea, 0x9e, 0x8e, 0xc9, 0xae, 0xf0, 0x9d, 0xbc,
+	0x85, 0xca, 0x8e, 0xf0, 0x9d, 0xbc, 0x86, 0xc3, 0xb8, 0xc9, 0xb6, 0xc9,
+	0xb7, 0x71, 0xc9, 0xba, 0xf0, 0x9d, 0xbc, 0x88, 0xc9, 0xbd, 0xc9, 0xbe,
+	0xca, 0x80, 0xca, 0xa8, 0xca, 0xa6, 0xea, 0xad, 0xa7, 0xca, 0xa7, 0xca,
+	0x88, 0xe2, 0xb1, 0xb1, 0xca, 0x8f, 0xca, 0xa1, 0xca, 0xa2, 0xca, 0x98,
+	0xc7, 0x80, 0xc7, 0x81, 0xc7, 0x82, 0xf0, 0x9d, 0xbc, 0x8a, 0xf0, 0x9d,
+	0xbc, 0x9e, 0xf0, 0x91, 0x82, 0x99, 0xf0, 0x91, 0x82, 0xba, 0xf0, 0x91,
+	0x82, 0x9b, 0xf0, 0x91, 0x82, 0xba, 0xf0, 0x91, 0x82, 0xa5, 0xf0, 0x91,
+	0x82, 0xba, 0xf0, 0x91, 0x84, 0xb1, 0xf0, 0x91, 0x84, 0xa7, 0xf0, 0x91,
+	0x84, 0xb2, 0xf0, 0x91, 0x84, 0xa7, 0xf0, 0x91, 0x8d, 0x87, 0xf0, 0x91,
+	0x8c, 0xbe, 0xf0, 0x91, 0x8d, 0x87, 0xf0, 0x91, 0x8d, 0x97, 0xf0, 0x91,
+	0x92, 0xb9, 0xf0, 0x91, 0x92, 0xba, 0xf0, 0x91, 0x92, 0xb9, 0xf0, 0x91,
+	0x92, 0xb0, 0xf0, 0x91, 0x92, 0xb9, 0xf0, 0x91, 0x92, 0xbd, 0xf0, 0x91,
+	0x96, 0xb8, 0xf0, 0x91, 0x96, 0xaf, 0xf0, 0x91, 0x96, 0xb9, 0xf0, 0x91,
+	0x96, 0xaf, 0xf0, 0x91, 0xa4, 0xb5, 0xf0, 0x91, 0xa4, 0xb0, 0xf0, 0x9d,
+	0x85, 0x97, 0xf0, 0x9d, 0x85, 0xa5, 0xf0, 0x9d, 0x85, 0x98, 0xf0, 0x9d,
+	0x85, 0xa5, 0xf0, 0x9d, 0x85, 0x98, 0xf0, 0x9d, 0x85, 0xa5, 0xf0, 0x9d,
+	0x85, 0xae, 0xf0, 0x9d, 0x85, 0x98, 0xf0, 0x9d, 0x85, 0xa5, 0xf0, 0x9d,
+	0x85, 0xaf, 0xf0, 0x9d, 0x85, 0x98, 0xf0, 0x9d, 0x85, 0xa5, 0xf0, 0x9d,
+	0x85, 0xb0, 0xf0, 0x9d, 0x85, 0x98, 0xf0, 0x9d, 0x85, 0xa5, 0xf0, 0x9d,
+	0x85, 0xb1, 0xf0, 0x9d, 0x85, 0x98, 0xf0, 0x9d, 0x85, 0xa5, 0xf0, 0x9d,
+	0x85, 0xb2, 0xf0, 0x9d, 0x86, 0xb9, 0xf0, 0x9d, 0x85, 0xa5, 0xf0, 0x9d,
+	0x86, 0xba, 0xf0, 0x9d, 0x85, 0xa5, 0xf0, 0x9d, 0x86, 0xb9, 0xf0, 0x9d,
+	0x85, 0xa5, 0xf0, 0x9d, 0x85, 0xae, 0xf0, 0x9d, 0x86, 0xba, 0xf0, 0x9d,
+	0x85, 0xa5, 0xf0, 0x9d, 0x85, 0xae, 0xf0, 0x9d, 0x86, 0xb9, 0xf0, 0x9d,
+	0x85, 0xa5, 0xf0, 0x9d, 0x85, 0xaf, 0xf0, 0x9d, 0x86, 0xba, 0xf0, 0x9d,
+	0x85, 0xa5, 0xf0, 0x9d, 0x85, 0xaf, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+	0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52,
+	0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x61, 0x62, 0x63, 0x64,
+	0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+	0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x41, 0x42,
+	0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e,
+	0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+	0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6a, 0x6b, 0x6c, 0x6d,
+	0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+	0x7a, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b,
+	0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+	0x58, 0x59, 0x5a, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+	0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+	0x76, 0x77, 0x78, 0x79, 0x7a, 0x41, 0x43, 0x44, 0x47, 0x4a, 0x4b, 0x4e,
+	0x4f, 0x50, 0x51, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x61,
+	0x62, 0x63, 0x64, 0x66, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x70,
+	0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x41, 0x42,
+	0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e,
+	0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+	0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+	0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+	0x79, 0x7a, 0x41, 0x42, 0x44, 0x45, 0x46, 0x47, 0x4a, 0x4b, 0x4c, 0x4d,
+	0x4e, 0x4f, 0x50, 0x51, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x61,
+	0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d,
+	0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+	0x7a, 0x41, 0x42, 0x44, 0x45, 0x46, 0x47, 0x49, 0x4a, 0x4b, 0x4c, 0x4d,
+	0x4f, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x61, 0x62, 0x63, 0x64,
+	0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+	0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x41, 0x42,
+	0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e,
+	0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+	0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+	0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+	0x79, 0x7a, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a,
+	0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+	0x57, 0x58, 0x59, 0x5a, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+	0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74,
+	0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+	0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52,
+	0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x61, 0x62, 0x63, 0x64,
+	0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+	0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x41, 0x42,
+	0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e,
+	0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+	0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+	0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+	0x79, 0x7a, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a,
+	0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+	0x57, 0x58, 0x59, 0x5a, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+	0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74,
+	0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+	0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52,
+	0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x61, 0x62, 0x63, 0x64,
+	0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+	0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0xc4, 0xb1,
+	0xc8, 0xb7, 0xce, 0x91, 0xce, 0x92, 0xce, 0x93, 0xce, 0x94, 0xce, 0x95,
+	0xce, 0x96, 0xce, 0x97, 0xce, 0x98, 0xce, 0x99, 0xce, 0x9a, 0xce, 0x9b,
+	0xce, 0x9c, 0xce, 0x9d, 0xce, 0x9e, 0xce, 0x9f, 0xce, 0xa0, 0xce, 0xa1,
+	0xce, 0x98, 0xce, 0xa3, 0xce, 0xa4, 0xce, 0xa5, 0xce, 0xa6, 0xce, 0xa7,
+	0xce, 0xa8, 0xce, 0xa9, 0xe2, 0x88, 0x87, 0xce, 0xb1, 0xce, 0xb2, 0xce,
+	0xb3, 0xce, 0xb4, 0xce, 0xb5, 0xce, 0xb6, 0xce, 0xb7, 0xce, 0xb8, 0xce,
+	0xb9, 0xce, 0xba, 0xce, 0xbb, 0xce, 0xbc, 0xce, 0xbd, 0xce, 0xbe, 0xce,
+	0xbf, 0xcf, 0x80, 0xcf, 0x81, 0xcf, 0x82, 0xcf, 0x83, 0xcf, 0x84, 0xcf,
+	0x85, 0xcf, 0x86, 0xcf, 0x87, 0xcf, 0x88, 0xcf, 0x89, 0xe2, 0x88, 0x82,
+	0xce, 0xb5, 0xce, 0xb8, 0xce, 0xba, 0xcf, 0x86, 0xcf, 0x81, 0xcf, 0x80,
+	0xce, 0x91, 0xce, 0x92, 0xce, 0x93, 0xce, 0x94, 0xce, 0x95, 0xce, 0x96,
+	0xce, 0x97, 0xce, 0x98, 0xce, 0x99, 0xce, 0x9a, 0xce, 0x9b, 0xce, 0x9c,
+	0xce, 0x9d, 0xce, 0x9e, 0xce, 0x9f, 0xce, 0xa0, 0xce, 0xa1, 0xce, 0x98,
+	0xce, 0xa3, 0xce, 0xa4, 0xce, 0xa5, 0xce, 0xa6, 0xce, 0xa7, 0xce, 0xa8,
+	0xce, 0xa9, 0xe2, 0x88, 0x87, 0xce, 0xb1, 0xce, 0xb2, 0xce, 0xb3, 0xce,
+	0xb4, 0xce, 0xb5, 0xce, 0xb6, 0xce, 0xb7, 0xce, 0xb8, 0xce, 0xb9, 0xce,
+	0xba, 0xce, 0xbb, 0xce, 0xbc, 0xce, 0xbd, 0xce, 0xbe, 0xce, 0xbf, 0xcf,
+	0x80, 0xcf, 0x81, 0xcf, 0x82, 0xcf, 0x83, 0xcf, 0x84, 0xcf, 0x85, 0xcf,
+	0x86, 0xcf, 0x87, 0xcf, 0x88, 0xcf, 0x89, 0xe2, 0x88, 0x82, 0xce, 0xb5,
+	0xce, 0xb8, 0xce, 0xba, 0xcf, 0x86, 0xcf, 0x81, 0xcf, 0x80, 0xce, 0x91,
+	0xce, 0x92, 0xce, 0x93, 0xce, 0x94, 0xce, 0x95, 0xce, 0x96, 0xce, 0x97,
+	0xce, 0x98, 0xce, 0x99, 0xce, 0x9a, 0xce, 0x9b, 0xce, 0x9c, 0xce, 0x9d,
+	0xce, 0x9e, 0xce, 0x9f, 0xce, 0xa0, 0xce, 0xa1, 0xce, 0x98, 0xce, 0xa3,
+	0xce, 0xa4, 0xce, 0xa5, 0xce, 0xa6, 0xce, 0xa7, 0xce, 0xa8, 0xce, 0xa9,
+	0xe2, 0x88, 0x87, 0xce, 0xb1, 0xce, 0xb2, 0xce, 0xb3, 0xce, 0xb4, 0xce,
+	0xb5, 0xce, 0xb6, 0xce, 0xb7, 0xce, 0xb8, 0xce, 0xb9, 0xce, 0xba, 0xce,
+	0xbb, 0xce, 0xbc, 0xce, 0xbd, 0xce, 0xbe, 0xce, 0xbf, 0xcf, 0x80, 0xcf,
+	0x81, 0xcf, 0x82, 0xcf, 0x83, 0xcf, 0x84, 0xcf, 0x85, 0xcf, 0x86, 0xcf,
+	0x87, 0xcf, 0x88, 0xcf, 0x89, 0xe2, 0x88, 0x82, 0xce, 0xb5, 0xce, 0xb8,
+	0xce, 0xba, 0xcf, 0x86, 0xcf, 0x81, 0xcf, 0x80, 0xce, 0x91, 0xce, 0x92,
+	0xce, 0x93, 0xce, 0x94, 0xce, 0x95, 0xce, 0x96, 0xce, 0x97, 0xce, 0x98,
+	0xce, 0x99, 0xce, 0x9a, 0xce, 0x9b, 0xce, 0x9c, 0xce, 0x9d, 0xce, 0x9e,
+	0xce, 0x9f, 0xce, 0xa0, 0xce, 0xa1, 0xce, 0x98, 0xce, 0xa3, 0xce, 0xa4,
+	0xce, 0xa5, 0xce, 0xa6, 0xce, 0xa7, 0xce, 0xa8, 0xce, 0xa9, 0xe2, 0x88,
+	0x87, 0xce, 0xb1, 0xce, 0xb2, 0xce, 0xb3, 0xce, 0xb4, 0xce, 0xb5, 0xce,
+	0xb6, 0xce, 0xb7, 0xce, 0xb8, 0xce, 0xb9, 0xce, 0xba, 0xce, 0xbb, 0xce,
+	0xbc, 0xce, 0xbd, 0xce, 0xbe, 0xce, 0xbf, 0xcf, 0x80, 0xcf, 0x81, 0xcf,
+	0x82, 0xcf, 0x83, 0xcf, 0x84, 0xcf, 0x85, 0xcf, 0x86, 0xcf, 0x87, 0xcf,
+	0x88, 0xcf, 0x89, 0xe2, 0x88, 0x82, 0xce, 0xb5, 0xce, 0xb8, 0xce, 0xba,
+	0xcf, 0x86, 0xcf, 0x81, 0xcf, 0x80, 0xce, 0x91, 0xce, 0x92, 0xce, 0x93,
+	0xce, 0x94, 0xce, 0x95, 0xce, 0x96, 0xce, 0x97, 0xce, 0x98, 0xce, 0x99,
+	0xce, 0x9a, 0xce, 0x9b, 0xce, 0x9c, 0xce, 0x9d, 0xce, 0x9e, 0xce, 0x9f,
+	0xce, 0xa0, 0xce, 0xa1, 0xce, 0x98, 0xce, 0xa3, 0xce, 0xa4, 0xce, 0xa5,
+	0xce, 0xa6, 0xce, 0xa7, 0xce, 0xa8, 0xce, 0xa9, 0xe2, 0x88, 0x87, 0xce,
+	0xb1, 0xce, 0xb2, 0xce, 0xb3, 0xce, 0xb4, 0xce, 0xb5, 0xce, 0xb6, 0xce,
+	0xb7, 0xce, 0xb8, 0xce, 0xb9, 0xce, 0xba, 0xce, 0xbb, 0xce, 0xbc, 0xce,
+	0xbd, 0xce, 0xbe, 0xce, 0xbf, 0xcf, 0x80, 0xcf, 0x81, 0xcf, 0x82, 0xcf,
+	0x83, 0xcf, 0x84, 0xcf, 0x85, 0xcf, 0x86, 0xcf, 0x87, 0xcf, 0x88, 0xcf,
+	0x89, 0xe2, 0x88, 0x82, 0xce, 0xb5, 0xce, 0xb8, 0xce, 0xba, 0xcf, 0x86,
+	0xcf, 0x81, 0xcf, 0x80, 0xcf, 0x9c, 0xcf, 0x9d, 0x30, 0x31, 0x32, 0x33,
+	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+	0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+	0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xd8, 0xa7,
+	0xd8, 0xa8, 0xd8, 0xac, 0xd8, 0xaf, 0xd9, 0x88, 0xd8, 0xb2, 0xd8, 0xad,
+	0xd8, 0xb7, 0xd9, 0x8a, 0xd9, 0x83, 0xd9, 0x84, 0xd9, 0x85, 0xd9, 0x86,
+	0xd8, 0xb3, 0xd8, 0xb9, 0xd9, 0x81, 0xd8, 0xb5, 0xd9, 0x82, 0xd8, 0xb1,
+	0xd8, 0xb4, 0xd8, 0xaa, 0xd8, 0xab, 0xd8, 0xae, 0xd8, 0xb0, 0xd8, 0xb6,
+	0xd8, 0xb8, 0xd8, 0xba, 0xd9, 0xae, 0xda, 0xba, 0xda, 0xa1, 0xd9, 0xaf,
+	0xd8, 0xa8, 0xd8, 0xac, 0xd9, 0x87, 0xd8, 0xad, 0xd9, 0x8a, 0xd9, 0x83,
+	0xd9, 0x84, 0xd9, 0x85, 0xd9, 0x86, 0xd8, 0xb3, 0xd8, 0xb9, 0xd9, 0x81,
+	0xd8, 0xb5, 0xd9, 0x82, 0xd8, 0xb4, 0xd8, 0xaa, 0xd8, 0xab, 0xd8, 0xae,
+	0xd8, 0xb6, 0xd8, 0xba, 0xd8, 0xac, 0xd8, 0xad, 0xd9, 0x8a, 0xd9, 0x84,
+	0xd9, 0x86, 0xd8, 0xb3, 0xd8, 0xb9, 0xd8, 0xb5, 0xd9, 0x82, 0xd8, 0xb4,
+	0xd8, 0xae, 0xd8, 0xb6, 0xd8, 0xba, 0xda, 0xba, 0xd9, 0xaf, 0xd8, 0xa8,
+	0xd8, 0xac, 0xd9, 0x87, 0xd8, 0xad, 0xd8, 0xb7, 0xd9, 0x8a, 0xd9, 0x83,
+	0xd9, 0x85, 0xd9, 0x86, 0xd8, 0xb3, 0xd8, 0xb9, 0xd9, 0x81, 0xd8, 0xb5,
+	0xd9, 0x82, 0xd8, 0xb4, 0xd8, 0xaa, 0xd8, 0xab, 0xd8, 0xae, 0xd8, 0xb6,
+	0xd8, 0xb8, 0xd8, 0xba, 0xd9, 0xae, 0xda, 0xa1, 0xd8, 0xa7, 0xd8, 0xa8,
+	0xd8, 0xac, 0xd8, 0xaf, 0xd9, 0x87, 0xd9, 0x88, 0xd8, 0xb2, 0xd8, 0xad,
+	0xd8, 0xb7, 0xd9, 0x8a, 0xd9, 0x84, 0xd9, 0x85, 0xd9, 0x86, 0xd8, 0xb3,
+	0xd8, 0xb9, 0xd9, 0x81, 0xd8, 0xb5, 0xd9, 0x82, 0xd8, 0xb1, 0xd8, 0xb4,
+	0xd8, 0xaa, 0xd8, 0xab, 0xd8, 0xae, 0xd8, 0xb0, 0xd8, 0xb6, 0xd8, 0xb8,
+	0xd8, 0xba, 0xd8, 0xa8, 0xd8, 0xac, 0xd8, 0xaf, 0xd9, 0x88, 0xd8, 0xb2,
+	0xd8, 0xad, 0xd8, 0xb7, 0xd9, 0x8a, 0xd9, 0x84, 0xd9, 0x85, 0xd9, 0x86,
+	0xd8, 0xb3, 0xd8, 0xb9, 0xd9, 0x81, 0xd8, 0xb5, 0xd9, 0x82, 0xd8, 0xb1,
+	0xd8, 0xb4, 0xd8, 0xaa, 0xd8, 0xab, 0xd8, 0xae, 0xd8, 0xb0, 0xd8, 0xb6,
+	0xd8, 0xb8, 0xd8, 0xba, 0x30, 0x2e, 0x30, 0x2c, 0x31, 0x2c, 0x32, 0x2c,
+	0x33, 0x2c, 0x34, 0x2c, 0x35, 0x2c, 0x36, 0x2c, 0x37, 0x2c, 0x38, 0x2c,
+	0x39, 0x2c, 0x28, 0x41, 0x29, 0x28, 0x42, 0x29, 0x28, 0x43, 0x29, 0x28,
+	0x44, 0x29, 0x28, 0x45, 0x29, 0x28, 0x46, 0x29, 0x28, 0x47, 0x29, 0x28,
+	0x48, 0x29, 0x28, 0x49, 0x29, 0x28, 0x4a, 0x29, 0x28, 0x4b, 0x29, 0x28,
+	0x4c, 0x29, 0x28, 0x4d, 0x29, 0x28, 0x4e, 0x29, 0x28, 0x4f, 0x29, 0x28,
+	0x50, 0x29, 0x28, 0x51, 0x29, 0x28, 0x52, 0x29, 0x28, 0x53, 0x29, 0x28,
+	0x54, 0x29, 0x28, 0x55, 0x29, 0x28, 0x56, 0x29, 0x28, 0x57, 0x29, 0x28,
+	0x58, 0x29, 0x28, 0x59, 0x29, 0x28, 0x5a, 0x29, 0xe3, 0x80, 0x94, 0x53,
+	0xe3, 0x80, 0x95, 0x43, 0x52, 0x43, 0x44, 0x57, 0x5a, 0x41, 0x42, 0x43,
+	0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+	0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x48,
+	0x56, 0x4d, 0x56, 0x53, 0x44, 0x53, 0x53, 0x50, 0x50, 0x56, 0x57, 0x43,
+	0x4d, 0x43, 0x4d, 0x44, 0x4d, 0x52, 0x44, 0x4a, 0xe3, 0x81, 0xbb, 0xe3,
+	0x81, 0x8b, 0xe3, 0x82, 0xb3, 0xe3, 0x82, 0xb3, 0xe3, 0x82, 0xb5, 0xe6,
+	0x89, 0x8b, 0xe5, 0xad, 0x97, 0xe5, 0x8f, 0x8c, 0xe3, 0x83, 0x86, 0xe3,
+	0x82, 0x99, 0xe4, 0xba, 0x8c, 0xe5, 0xa4, 0x9a, 0xe8, 0xa7, 0xa3, 0xe5,
+	0xa4, 0xa9, 0xe4, 0xba, 0xa4, 0xe6, 0x98, 0xa0, 0xe7, 0x84, 0xa1, 0xe6,
+	0x96, 0x99, 0xe5, 0x89, 0x8d, 0xe5, 0xbe, 0x8c, 0xe5, 0x86, 0x8d, 0xe6,
+	0x96, 0xb0, 0xe5, 0x88, 0x9d, 0xe7, 0xb5, 0x82, 0xe7, 0x94, 0x9f, 0xe8,
+	0xb2, 0xa9, 0xe5, 0xa3, 0xb0, 0xe5, 0x90, 0xb9, 0xe6, 0xbc, 0x94, 0xe6,
+	0x8a, 0x95, 0xe6, 0x8d, 0x95, 0xe4, 0xb8, 0x80, 0xe4, 0xb8, 0x89, 0xe9,
+	0x81, 0x8a, 0xe5, 0xb7, 0xa6, 0xe4, 0xb8, 0xad, 0xe5, 0x8f, 0xb3, 0xe6,
+	0x8c, 0x87, 0xe8, 0xb5, 0xb0, 0xe6, 0x89, 0x93, 0xe7, 0xa6, 0x81, 0xe7,
+	0xa9, 0xba, 0xe5, 0x90, 0x88, 0xe6, 0xba, 0x80, 0xe6, 0x9c, 0x89, 0xe6,
+	0x9c, 0x88, 0xe7, 0x94, 0xb3, 0xe5, 0x89, 0xb2, 0xe5, 0x96, 0xb6, 0xe9,
+	0x85, 0x8d, 0xe3, 0x80, 0x94, 0xe6, 0x9c, 0xac, 0xe3, 0x80, 0x95, 0xe3,
+	0x80, 0x94, 0xe4, 0xb8, 0x89, 0xe3, 0x80, 0x95, 0xe3, 0x80, 0x94, 0xe4,
+	0xba, 0x8c, 0xe3, 0x80, 0x95, 0xe3, 0x80, 0x94, 0xe5, 0xae, 0x89, 0xe3,
+	0x80, 0x95, 0xe3, 0x80, 0x94, 0xe7, 0x82, 0xb9, 0xe3, 0x80, 0x95, 0xe3,
+	0x80, 0x94, 0xe6, 0x89, 0x93, 0xe3, 0x80, 0x95, 0xe3, 0x80, 0x94, 0xe7,
+	0x9b, 0x97, 0xe3, 0x80, 0x95, 0xe3, 0x80, 0x94, 0xe5, 0x8b, 0x9d, 0xe3,
+	0x80, 0x95, 0xe3, 0x80, 0x94, 0xe6, 0x95, 0x97, 0xe3, 0x80, 0x95, 0xe5,
+	0xbe, 0x97, 0xe5, 0x8f, 0xaf, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+	0x37, 0x38, 0x39, 0xe4, 0xb8, 0xbd, 0xe4, 0xb8, 0xb8, 0xe4, 0xb9, 0x81,
+	0xf0, 0xa0, 0x84, 0xa2, 0xe4, 0xbd, 0xa0, 0xe4, 0xbe, 0xae, 0xe4, 0xbe,
+	0xbb, 0xe5, 0x80, 0x82, 0xe5, 0x81, 0xba, 0xe5, 0x82, 0x99, 0xe5, 0x83,
+	0xa7, 0xe5, 0x83, 0x8f, 0xe3, 0x92, 0x9e, 0xf0, 0xa0, 0x98, 0xba, 0xe5,
+	0x85, 0x8d, 0xe5, 0x85, 0x94, 0xe5, 0x85, 0xa4, 0xe5, 0x85, 0xb7, 0xf0,
+	0xa0, 0x94, 0x9c, 0xe3, 0x92, 0xb9, 0xe5, 0x85, 0xa7, 0xe5, 0x86, 0x8d,
+	0xf0, 0xa0, 0x95, 0x8b, 0xe5, 0x86, 0x97, 0xe5, 0x86, 0xa4, 0xe4, 0xbb,
+	0x8c, 0xe5, 0x86, 0xac, 0xe5, 0x86, 0xb5, 0xf0, 0xa9, 0x87, 0x9f, 0xe5,
+	0x87, 0xb5, 0xe5, 0x88, 0x83, 0xe3, 0x93, 0x9f, 0xe5, 0x88, 0xbb, 0xe5,
+	0x89, 0x86, 0xe5, 0x89, 0xb2, 0xe5, 0x89, 0xb7, 0xe3, 0x94, 0x95, 0xe5,
+	0x8b, 0x87, 0xe5, 0x8b, 0x89, 0xe5, 0x8b, 0xa4, 0xe5, 0x8b, 0xba, 0xe5,
+	0x8c, 0x85, 0xe5, 0x8c, 0x86, 0xe5, 0x8c, 0x97, 0xe5, 0x8d, 0x89, 0xe5,
+	0x8d, 0x91, 0xe5, 0x8d, 0x9a, 0xe5, 0x8d, 0xb3, 0xe5, 0x8d, 0xbd, 0xe5,
+	0x8d, 0xbf, 0xe5, 0x8d, 0xbf, 0xe5, 0x8d, 0xbf, 0xf0, 0xa0, 0xa8, 0xac,
+	0xe7, 0x81, 0xb0, 0xe5, 0x8f, 0x8a, 0xe5, 0x8f, 0x9f, 0xf0, 0xa0, 0xad,
+	0xa3, 0xe5, 0x8f, 0xab, 0xe5, 0x8f, 0xb1, 0xe5, 0x90, 0x86, 0xe5, 0x92,
+	0x9e, 0xe5, 0x90, 0xb8, 0xe5, 0x91, 0x88, 0xe5, 0x91, 0xa8, 0xe5, 0x92,
+	0xa2, 0xe5, 0x93, 0xb6, 0xe5, 0x94, 0x90, 0xe5, 0x95, 0x93, 0xe5, 0x95,
+	0xa3, 0xe5, 0x96, 0x84, 0xe5, 0x96, 0x84, 0xe5, 0x96, 0x99, 0xe5, 0x96,
+	0xab, 0xe5, 0x96, 0xb3, 0xe5, 0x97, 0x82, 0xe5, 0x9c, 0x96, 0xe5, 0x98,
+	0x86, 0xe5, 0x9c, 0x97, 0xe5, 0x99, 0x91, 0xe5, 0x99, 0xb4, 0xe5, 0x88,
+	0x87, 0xe5, 0xa3, 0xae, 0xe5, 0x9f, 0x8e, 0xe5, 0x9f, 0xb4, 0xe5, 0xa0,
+	0x8d, 0xe5, 0x9e, 0x8b, 0xe5, 0xa0, 0xb2, 0xe5, 0xa0, 0xb1, 0xe5, 0xa2,
+	0xac, 0xf0, 0xa1, 0x93, 0xa4, 0xe5, 0xa3, 0xb2, 0xe5, 0xa3, 0xb7, 0xe5,
+	0xa4, 0x86, 0xe5, 0xa4, 0x9a, 0xe5, 0xa4, 0xa2, 0xe5, 0xa5, 0xa2, 0xf0,
+	0xa1, 0x9a, 0xa8, 0xf0, 0xa1, 0x9b, 0xaa, 0xe5, 0xa7, 0xac, 0xe5, 0xa8,
+	0x9b, 0xe5, 0xa8, 0xa7, 0xe5, 0xa7, 0x98, 0xe5, 0xa9, 0xa6, 0xe3, 0x9b,
+	0xae, 0xe3, 0x9b, 0xbc, 0xe5, 0xac, 0x88, 0xe5, 0xac, 0xbe, 0xe5, 0xac,
+	0xbe, 0xf0, 0xa1, 0xa7, 0x88, 0xe5, 0xaf, 0x83, 0xe5, 0xaf, 0x98, 0xe5,
+	0xaf, 0xa7, 0xe5, 0xaf, 0xb3, 0xf0, 0xa1, 0xac, 0x98, 0xe5, 0xaf, 0xbf,
+	0xe5, 0xb0, 0x86, 0xe5, 0xbd, 0x93, 0xe5, 0xb0, 0xa2, 0xe3, 0x9e, 0x81,
+	0xe5, 0xb1, 0xa0, 0xe5, 0xb1, 0xae, 0xe5, 0xb3, 0x80, 0xe5, 0xb2, 0x8d,
+	0xf0, 0xa1, 0xb7, 0xa4, 0xe5, 0xb5, 0x83, 0xf0, 0xa1, 0xb7, 0xa6, 0xe5,
+	0xb5, 0xae, 0xe5, 0xb5, 0xab, 0xe5, 0xb5, 0xbc, 0xe5, 0xb7, 0xa1, 0xe5,
+	0xb7, 0xa2, 0xe3, 0xa0, 0xaf, 0xe5, 0xb7, 0xbd, 0xe5, 0xb8, 0xa8, 0xe5,
+	0xb8, 0xbd, 0xe5, 0xb9, 0xa9, 0xe3, 0xa1, 0xa2, 0xf0, 0xa2, 0x86, 0x83,
+	0xe3, 0xa1, 0xbc, 0xe5, 0xba, 0xb0, 0xe5, 0xba, 0xb3, 0xe5, 0xba, 0xb6,
+	0xe5, 0xbb, 0x8a, 0xf0, 0xaa, 0x8e, 0x92, 0xe5, 0xbb, 0xbe, 0xf0, 0xa2,
+	0x8c, 0xb1, 0xf0, 0xa2, 0x8c, 0xb1, 0xe8, 0x88, 0x81, 0xe5, 0xbc, 0xa2,
+	0xe5, 0xbc, 0xa2, 0xe3, 0xa3, 0x87, 0xf0, 0xa3, 0x8a, 0xb8, 0xf0, 0xa6,
+	0x87, 0x9a, 0xe5, 0xbd, 0xa2, 0xe5, 0xbd, 0xab, 0xe3, 0xa3, 0xa3, 0xe5,
+	0xbe, 0x9a, 0xe5, 0xbf, 0x8d, 0xe5, 0xbf, 0x97, 0xe5, 0xbf, 0xb9, 0xe6,
+	0x82, 0x81, 0xe3, 0xa4, 0xba, 0xe3, 0xa4, 0x9c, 0xe6, 0x82, 0x94, 0xf0,
+	0xa2, 0x9b, 0x94, 0xe6, 0x83, 0x87, 0xe6, 0x85, 0x88, 0xe6, 0x85, 0x8c,
+	0xe6, 0x85, 0x8e, 0xe6, 0x85, 0x8c, 0xe6, 0x85, 0xba, 0xe6, 0x86, 0x8e,
+	0xe6, 0x86, 0xb2, 0xe6, 0x86, 0xa4, 0xe6, 0x86, 0xaf, 0xe6, 0x87, 0x9e,
+	0xe6, 0x87, 0xb2, 0xe6, 0x87, 0xb6, 0xe6, 0x88, 0x90, 0xe6, 0x88, 0x9b,
+	0xe6, 0x89, 0x9d, 0xe6, 0x8a, 0xb1, 0xe6, 0x8b, 0x94, 0xe6, 0x8d, 0x90,
+	0xf0, 0xa2, 0xac, 0x8c, 0xe6, 0x8c, 0xbd, 0xe6, 0x8b, 0xbc, 0xe6, 0x8d,
+	0xa8, 0xe6, 0x8e, 0x83, 0xe6, 0x8f, 0xa4, 0xf0, 0xa2, 0xaf, 0xb1, 0xe6,
+	0x90, 0xa2, 0xe6, 0x8f, 0x85, 0xe6, 0x8e, 0xa9, 0xe3, 0xa8, 0xae, 0xe6,
+	0x91, 0xa9, 0xe6, 0x91, 0xbe, 0xe6, 0x92, 0x9d, 0xe6, 0x91, 0xb7, 0xe3,
+	0xa9, 0xac, 0xe6, 0x95, 0x8f, 0xe6, 0x95, 0xac, 0xf0, 0xa3, 0x80, 0x8a,
+	0xe6, 0x97, 0xa3, 0xe6, 0x9b, 0xb8, 0xe6, 0x99, 0x89, 0xe3, 0xac, 0x99,
+	0xe6, 0x9a, 0x91, 0xe3, 0xac, 0x88, 0xe3, 0xab, 0xa4, 0xe5, 0x86, 0x92,
+	0xe5, 0x86, 0x95, 0xe6, 0x9c, 0x80, 0xe6, 0x9a, 0x9c, 0xe8, 0x82, 0xad,
+	0xe4, 0x8f, 0x99, 0xe6, 0x9c, 0x97, 0xe6, 0x9c, 0x9b, 0xe6, 0x9c, 0xa1,
+	0xe6, 0x9d, 0x9e, 0xe6, 0x9d, 0x93, 0xf0, 0xa3, 0x8f, 0x83, 0xe3, 0xad,
+	0x89, 0xe6, 0x9f, 0xba, 0xe6, 0x9e, 0x85, 0xe6, 0xa1, 0x92, 0xe6, 0xa2,
+	0x85, 0xf0, 0xa3, 0x91, 0xad, 0xe6, 0xa2, 0x8e, 0xe6, 0xa0, 0x9f, 0xe6,
+	0xa4, 0x94, 0xe3, 0xae, 0x9d, 0xe6, 0xa5, 0x82, 0xe6, 0xa6, 0xa3, 0xe6,
+	0xa7, 0xaa, 0xe6, 0xaa, 0xa8, 0xf0, 0xa3, 0x9a, 0xa3, 0xe6, 0xab, 0x9b,
+	0xe3, 0xb0, 0x98, 0xe6, 0xac, 0xa1, 0xf0, 0xa3, 0xa2, 0xa7, 0xe6, 0xad,
+	0x94, 0xe3, 0xb1, 0x8e, 0xe6, 0xad, 0xb2, 0xe6, 0xae, 0x9f, 0xe6, 0xae,
+	0xba, 0xe6, 0xae, 0xbb, 0xf0, 0xa3, 0xaa, 0x8d, 0xf0, 0xa1, 0xb4, 0x8b,
+	0xf0, 0xa3, 0xab, 0xba, 0xe6, 0xb1, 0x8e, 0xf0, 0xa3, 0xb2, 0xbc, 0xe6,
+	0xb2, 0xbf, 0xe6, 0xb3, 0x8d, 0xe6, 0xb1, 0xa7, 0xe6, 0xb4, 0x96, 0xe6,
+	0xb4, 0xbe, 0xe6, 0xb5, 0xb7, 0xe6, 0xb5, 0x81, 0xe6, 0xb5, 0xa9, 0xe6,
+	0xb5, 0xb8, 0xe6, 0xb6, 0x85, 0xf0, 0xa3, 0xb4, 0x9e, 0xe6, 0xb4, 0xb4,
+	0xe6, 0xb8, 0xaf, 0xe6, 0xb9, 0xae, 0xe3, 0xb4, 0xb3, 0xe6, 0xbb, 0x8b,
+	0xe6, 0xbb, 0x87, 0xf0, 0xa3, 0xbb, 0x91, 0xe6, 0xb7, 0xb9, 0xe6, 0xbd,
+	0xae, 0xf0, 0xa3, 0xbd, 0x9e, 0xf0, 0xa3, 0xbe, 0x8e, 0xe6, 0xbf, 0x86,
+	0xe7, 0x80, 0xb9, 0xe7, 0x80, 0x9e, 0xe7, 0x80, 0x9b, 0xe3, 0xb6, 0x96,
+	0xe7, 0x81, 0x8a, 0xe7, 0x81, 0xbd, 0xe7, 0x81, 0xb7, 0xe7, 0x82, 0xad,
+	0xf0, 0xa0, 0x94, 0xa5, 0xe7, 0x85, 0x85, 0xf0, 0xa4, 0x89, 0xa3, 0xe7,
+	0x86, 0x9c, 0xf0, 0xa4, 0x8e, 0xab, 0xe7, 0x88, 0xa8, 0xe7, 0x88, 0xb5,
+	0xe7, 0x89, 0x90, 0xf0, 0xa4, 0x98, 0x88, 0xe7, 0x8a, 0x80, 0xe7, 0x8a,
+	0x95, 0xf0, 0xa4, 0x9c, 0xb5, 0xf0, 0xa4, 0xa0, 0x94, 0xe7, 0x8d, 0xba,
+	0xe7, 0x8e, 0x8b, 0xe3, 0xba, 0xac, 0xe7, 0x8e, 0xa5, 0xe3, 0xba, 0xb8,
+	0xe3, 0xba, 0xb8, 0xe7, 0x91, 0x87, 0xe7, 0x91, 0x9c, 0xe7, 0x91, 0xb1,
+	0xe7, 0x92, 0x85, 0xe7, 0x93, 0x8a, 0xe3, 0xbc, 0x9b, 0xe7, 0x94, 0xa4,
+	0xf0, 0xa4, 0xb0, 0xb6, 0xe7, 0x94, 0xbe, 0xf0, 0xa4, 0xb2, 0x92, 0xe7,
+	0x95, 0xb0, 0xf0, 0xa2, 0x86, 0x9f, 0xe7, 0x98, 0x90, 0xf0, 0xa4, 0xbe,
+	0xa1, 0xf0, 0xa4, 0xbe, 0xb8, 0xf0, 0xa5, 0x81, 0x84, 0xe3, 0xbf, 0xbc,
+	0xe4, 0x80, 0x88, 0xe7, 0x9b, 0xb4, 0xf0, 0xa5, 0x83, 0xb3, 0xf0, 0xa5,
+	0x83, 0xb2, 0xf0, 0xa5, 0x84, 0x99, 0xf0, 0xa5, 0x84, 0xb3, 0xe7, 0x9c,
+	0x9e, 0xe7, 0x9c, 0x9f, 0xe7, 0x9c, 0x9f, 0xe7, 0x9d, 0x8a, 0xe4, 0x80,
+	0xb9, 0xe7, 0x9e, 0x8b, 0xe4, 0x81, 0x86, 0xe4, 0x82, 0x96, 0xf0, 0xa5,
+	0x90, 0x9d, 0xe7, 0xa1, 0x8e, 0xe7, 0xa2, 0x8c, 0xe7, 0xa3, 0x8c, 0xe4,
+	0x83, 0xa3, 0xf0, 0xa5, 0x98, 0xa6, 0xe7, 0xa5, 0x96, 0xf0, 0xa5, 0x9a,
+	0x9a, 0xf0, 0xa5, 0x9b, 0x85, 0xe7, 0xa6, 0x8f, 0xe7, 0xa7, 0xab, 0xe4,
+	0x84, 0xaf, 0xe7, 0xa9, 0x80, 0xe7, 0xa9, 0x8a, 0xe7, 0xa9, 0x8f, 0xf0,
+	0xa5, 0xa5, 0xbc, 0xf0, 0xa5, 0xaa, 0xa7, 0xf0, 0xa5, 0xaa, 0xa7, 0xe7,
+	0xab, 0xae, 0xe4, 0x88, 0x82, 0xf0, 0xa5, 0xae, 0xab, 0xe7, 0xaf, 0x86,
+	0xe7, 0xaf, 0x89, 0xe4, 0x88, 0xa7, 0xf0, 0xa5, 0xb2, 0x80, 0xe7, 0xb3,
+	0x92, 0xe4, 0x8a, 0xa0, 0xe7, 0xb3, 0xa8, 0xe7, 0xb3, 0xa3, 0xe7, 0xb4,
+	0x80, 0xf0, 0xa5, 0xbe, 0x86, 0xe7, 0xb5, 0xa3, 0xe4, 0x8c, 0x81, 0xe7,
+	0xb7, 0x87, 0xe7, 0xb8, 0x82, 0xe7, 0xb9, 0x85, 0xe4, 0x8c, 0xb4, 0xf0,
+	0xa6, 0x88, 0xa8, 0xf0, 0xa6, 0x89, 0x87, 0xe4, 0x8d, 0x99, 0xf0, 0xa6,
+	0x8b, 0x99, 0xe7, 0xbd, 0xba, 0xf0, 0xa6, 0x8c, 0xbe, 0xe7, 0xbe, 0x95,
+	0xe7, 0xbf, 0xba, 0xe8, 0x80, 0x85, 0xf0, 0xa6, 0x93, 0x9a, 0xf0, 0xa6,
+	0x94, 0xa3, 0xe8, 0x81, 0xa0, 0xf0, 0xa6, 0x96, 0xa8, 0xe8, 0x81, 0xb0,
+	0xf0, 0xa3, 0x8d, 0x9f, 0xe4, 0x8f, 0x95, 0xe8, 0x82, 0xb2, 0xe8, 0x84,
+	0x83, 0xe4, 0x90, 0x8b, 0xe8, 0x84, 0xbe, 0xe5, 0xaa, 0xb5, 0xf0, 0xa6,
+	0x9e, 0xa7, 0xf0, 0xa6, 0x9e, 0xb5, 0xf0, 0xa3, 0x8e, 0x93, 0xf0, 0xa3,
+	0x8e, 0x9c, 0xe8, 0x88, 0x81, 0xe8, 0x88, 0x84, 0xe8, 0xbe, 0x9e, 0xe4,
+	0x91, 0xab, 0xe8, 0x8a, 0x91, 0xe8, 0x8a, 0x8b, 0xe8, 0x8a, 0x9d, 0xe5,
+	0x8a, 0xb3, 0xe8, 0x8a, 0xb1, 0xe8, 0x8a, 0xb3, 0xe8, 0x8a, 0xbd, 0xe8,
+	0x8b, 0xa6, 0xf0, 0xa6, 0xac, 0xbc, 0xe8, 0x8b, 0xa5, 0xe8, 0x8c, 0x9d,
+	0xe8, 0x8d, 0xa3, 0xe8, 0x8e, 0xad, 0xe8, 0x8c, 0xa3, 0xe8, 0x8e, 0xbd,
+	0xe8, 0x8f, 0xa7, 0xe8, 0x91, 0x97, 0xe8, 0x8d, 0x93, 0xe8, 0x8f, 0x8a,
+	0xe8, 0x8f, 0x8c, 0xe8, 0x8f, 0x9c, 0xf0, 0xa6, 0xb0, 0xb6, 0xf0, 0xa6,
+	0xb5, 0xab, 0xf0, 0xa6, 0xb3, 0x95, 0xe4, 0x94, 0xab, 0xe8, 0x93, 0xb1,
+	0xe8, 0x93, 0xb3, 0xe8, 0x94, 0x96, 0xf0, 0xa7, 0x8f, 0x8a, 0xe8, 0x95,
+	0xa4, 0xf0, 0xa6, 0xbc, 0xac, 0xe4, 0x95, 0x9d, 0xe4, 0x95, 0xa1, 0xf0,
+	0xa6, 0xbe, 0xb1, 0xf0, 0xa7, 0x83, 0x92, 0xe4, 0x95, 0xab, 0xe8, 0x99,
+	0x90, 0xe8, 0x99, 0x9c, 0xe8, 0x99, 0xa7, 0xe8, 0x99, 0xa9, 0xe8, 0x9a,
+	0xa9, 0xe8, 0x9a, 0x88, 0xe8, 0x9c, 0x8e, 0xe8, 0x9b, 0xa2, 0xe8, 0x9d,
+	0xb9, 0xe8, 0x9c, 0xa8, 0xe8, 0x9d, 0xab, 0xe8, 0x9e, 0x86, 0xe4, 0x97,
+	0x97, 0xe8, 0x9f, 0xa1, 0xe8, 0xa0, 0x81, 0xe4, 0x97, 0xb9, 0xe8, 0xa1,
+	0xa0, 0xe8, 0xa1, 0xa3, 0xf0, 0xa7, 0x99, 0xa7, 0xe8, 0xa3, 0x97, 0xe8,
+	0xa3, 0x9e, 0xe4, 0x98, 0xb5, 0xe8, 0xa3, 0xba, 0xe3, 0x92, 0xbb, 0xf0,
+	0xa7, 0xa2, 0xae, 0xf0, 0xa7, 0xa5, 0xa6, 0xe4, 0x9a, 0xbe, 0xe4, 0x9b,
+	0x87, 0xe8, 0xaa, 0xa0, 0xe8, 0xab, 0xad, 0xe8, 0xae, 0x8a, 0xe8, 0xb1,
+	0x95, 0xf0, 0xa7, 0xb2, 0xa8, 0xe8, 0xb2, 0xab, 0xe8, 0xb3, 0x81, 0xe8,
+	0xb4, 0x9b, 0xe8, 0xb5, 0xb7, 0xf0, 0xa7, 0xbc, 0xaf, 0xf0, 0xa0, 0xa0,
+	0x84, 0xe8, 0xb7, 0x8b, 0xe8, 0xb6, 0xbc, 0xe8, 0xb7, 0xb0, 0xf0, 0xa0,
+	0xa3, 0x9e, 0xe8, 0xbb, 0x94, 0xe8, 0xbc, 0xb8, 0xf0, 0xa8, 0x97, 0x92,
+	0xf0, 0xa8, 0x97, 0xad, 0xe9, 0x82, 0x94, 0xe9, 0x83, 0xb1, 0xe9, 0x84,
+	0x91, 0xf0, 0xa8, 0x9c, 0xae, 0xe9, 0x84, 0x9b, 0xe9, 0x88, 0xb8, 0xe9,
+	0x8b, 0x97, 0xe9, 0x8b, 0x98, 0xe9, 0x89, 0xbc, 0xe9, 0x8f, 0xb9, 0xe9,
+	0x90, 0x95, 0xf0, 0xa8, 0xaf, 0xba, 0xe9, 0x96, 0x8b, 0xe4, 0xa6, 0x95,
+	0xe9, 0x96, 0xb7, 0xf0, 0xa8, 0xb5, 0xb7, 0xe4, 0xa7, 0xa6, 0xe9, 0x9b,
+	0x83, 0xe5, 0xb6, 0xb2, 0xe9, 0x9c, 0xa3, 0xf0, 0xa9, 0x85, 0x85, 0xf0,
+	0xa9, 0x88, 0x9a, 0xe4, 0xa9, 0xae, 0xe4, 0xa9, 0xb6, 0xe9, 0x9f, 0xa0,
+	0xf0, 0xa9, 0x90, 0x8a, 0xe4, 0xaa, 0xb2, 0xf0, 0xa9, 0x92, 0x96, 0xe9,
+	0xa0, 0x8b, 0xe9, 0xa0, 0x8b, 0xe9, 0xa0, 0xa9, 0xf0, 0xa9, 0x96, 0xb6,
+	0xe9, 0xa3, 0xa2, 0xe4, 0xac, 0xb3, 0xe9, 0xa4, 0xa9, 0xe9, 0xa6, 0xa7,
+	0xe9, 0xa7, 0x82, 0xe9, 0xa7, 0xbe, 0xe4, 0xaf, 0x8e, 0xf0, 0xa9, 0xac,
+	0xb0, 0xe9, 0xac, 0x92, 0xe9, 0xb1, 0x80, 0xe9, 0xb3, 0xbd, 0xe4, 0xb3,
+	0x8e, 0xe4, 0xb3, 0xad, 0xe9, 0xb5, 0xa7, 0xf0, 0xaa, 0x83, 0x8e, 0xe4,
+	0xb3, 0xb8, 0xf0, 0xaa, 0x84, 0x85, 0xf0, 0xaa, 0x88, 0x8e, 0xf0, 0xaa,
+	0x8a, 0x91, 0xe9, 0xba, 0xbb, 0xe4, 0xb5, 0x96, 0xe9, 0xbb, 0xb9, 0xe9,
+	0xbb, 0xbe, 0xe9, 0xbc, 0x85, 0xe9, 0xbc, 0x8f, 0xe9, 0xbc, 0x96, 0xe9,
+	0xbc, 0xbb, 0xf0, 0xaa, 0x98, 0x80
+};
+
+/* Ranges of code points with a nonzero canonical combining class. */
+static const struct nfkd_ccc_range {
+	uint32_t first;
+	uint32_t last;
+	uint8_t ccc;
+} nfkd_ccc[382] = {
+	{ 0x00300, 0x00314, 230 },
+	{ 0x00315, 0x00315, 232 },
+	{ 0x00316, 0x00319, 220 },
+	{ 0x0031a, 0x0031a, 232 },
+	{ 0x0031b, 0x0031b, 216 },
+	{ 0x0031c, 0x00320, 220 },
+	{ 0x00321, 0x00322, 202 },
+	{ 0x00323, 0x00326, 220 },
+	{ 0x00327, 0x00328, 202 },
+	{ 0x00329, 0x00333, 220 },
+	{ 0x00334, 0x00338,   1 },
+	{ 0x00339, 0x0033c, 220 },
+	{ 0x0033d, 0x00344, 230 },
+	{ 0x00345, 0x00345, 240 },
+	{ 0x00346, 0x00346, 230 },
+	{ 0x00347, 0x00349, 220 },
+	{ 0x0034a, 0x0034c, 230 },
+	{ 0x0034d, 0x0034e, 220 },
+	{ 0x00350, 0x00352, 230 },
+	{ 0x00353, 0x00356, 220 },
+	{ 0x00357, 0x00357, 230 },
+	{ 0x00358, 0x00358, 232 },
+	{ 0x00359, 0x0035a, 220 },
+	{ 0x0035b, 0x0035b, 230 },
+	{ 0x0035c, 0x0035c, 233 },
+	{ 0x0035d, 0x0035e, 234 },
+	{ 0x0035f, 0x0035f, 233 },
+	{ 0x00360, 0x00361, 234 },
+	{ 0x00362, 0x00362, 233 },
+	{ 0x00363, 0x0036f, 230 },
+	{ 0x00483, 0x00487, 230 },
+	{ 0x00591, 0x00591, 220 },
+	{ 0x00592, 0x00595, 230 },
+	{ 0x00596, 0x00596, 220 },
+	{ 0x00597, 0x00599, 230 },
+	{ 0x0059a, 0x0059a, 222 },
+	{ 0x0059b, 0x0059b, 220 },
+	{ 0x0059c, 0x005a1, 230 },
+	{ 0x005a2, 0x005a7, 220 },
+	{ 0x005a8, 0x005a9, 230 },
+	{ 0x005aa, 0x005aa, 220 },
+	{ 0x005ab, 0x005ac, 230 },
+	{ 0x005ad, 0x005ad, 222 },
+	{ 0x005ae, 0x005ae, 228 },
+	{ 0x005af, 0x005af, 230 },
+	{ 0x005b0, 0x005b0,  10 },
+	{ 0x005b1, 0x005b1,  11 },
+	{ 0x005b2, 0x005b2,  12 },
+	{ 0x005b3, 0x005b3,  13 },
+	{ 0x005b4, 0x005b4,  14 },
+	{ 0x005b5, 0x005b5,  15 },
+	{ 0x005b6, 0x005b6,  16 },
+	{ 0x005b7, 0x005b7,  17 },
+	{ 0x005b8, 0x005b8,  18 },
+	{ 0x005b9, 0x005ba,  19 },
+	{ 0x005bb, 0x005bb,  20 },
+	{ 0x005bc, 0x005bc,  21 },
+	{ 0x005bd, 0x005bd,  22 },
+	{ 0x005bf, 0x005bf,  23 },
+	{ 0x005c1, 0x005c1,  24 },
+	{ 0x005c2, 0x005c2,  25 },
+	{ 0x005c4, 0x005c4, 230 },
+	{ 0x005c5, 0x005c5, 220 },
+	{ 0x005c7, 0x005c7,  18 },
+	{ 0x00610, 0x00617, 230 },
+	{ 0x00618, 0x00618,  30 },
+	{ 0x00619, 0x00619,  31 },
+	{ 0x0061a, 0x0061a,  32 },
+	{ 0x0064b, 0x0064b,  27 },
+	{ 0x0064c, 0x0064c,  28 },
+	{ 0x0064d, 0x0064d,  29 },
+	{ 0x0064e, 0x0064e,  30 },
+	{ 0x0064f, 0x0064f,  31 },
+	{ 0x00650, 0x00650,  32 },
+	{ 0x00651, 0x00651,  33 },
+	{ 0x00652, 0x00652,  34 },
+	{ 0x00653, 0x00654, 230 },
+	{ 0x00655, 0x00656, 220 },
+	{ 0x00657, 0x0065b, 230 },
+	{ 0x0065c, 0x0065c, 220 },
+	{ 0x0065d, 0x0065e, 230 },
+	{ 0x0065f, 0x0065f, 220 },
+	{ 0x00670, 0x00670,  35 },
+	{ 0x006d6, 0x006dc, 230 },
+	{ 0x006df, 0x006e2, 230 },
+	{ 0x006e3, 0x006e3, 220 },
+	{ 0x006e4, 0x006e4, 230 },
+	{ 0x006e7, 0x006e8, 230 },
+	{ 0x006ea, 0x006ea, 220 },
+	{ 0x006eb, 0x006ec, 230 },
+	{ 0x006ed, 0x006ed, 220 },
+	{ 0x00711, 0x00711,  36 },
+	{ 0x00730, 0x00730, 230 },
+	{ 0x00731, 0x00731, 220 },
+	{ 0x00732, 0x00733, 230 },
+	{ 0x00734, 0x00734, 220 },
+	{ 0x00735, 0x00736, 230 },
+	{ 0x00737, 0x00739, 220 },
+	{ 0x0073a, 0x0073a, 230 },
+	{ 0x0073b, 0x0073c, 220 },
+	{ 0x0073d, 0x0073d, 230 },
+	{ 0x0073e, 0x0073e, 220 },
+	{ 0x0073f, 0x00741, 230 },
+	{ 0x00742, 0x00742, 220 },
+	{ 0x00743, 0x00743, 230 },
+	{ 0x00744, 0x00744, 220 },
+	{ 0x00745, 0x00745, 230 },
+	{ 0x00746, 0x00746, 220 },
+	{ 0x00747, 0x00747, 230 },
+	{ 0x00748, 0x00748, 220 },
+	{ 0x00749, 0x0074a, 230 },
+	{ 0x007eb, 0x007f1, 230 },
+	{ 0x007f2, 0x007f2, 220 },
+	{ 0x007f3, 0x007f3, 230 },
+	{ 0x007fd, 0x007fd, 220 },
+	{ 0x00816, 0x00819, 230 },
+	{ 0x0081b, 0x00823, 230 },
+	{ 0x00825, 0x00827, 230 },
+	{ 0x00829, 0x0082d, 230 },
+	{ 0x00859, 0x0085b, 220 },
+	{ 0x00898, 0x00898, 230 },
+	{ 0x00899, 0x0089b, 220 },
+	{ 0x0089c, 0x0089f, 230 },
+	{ 0x008ca, 0x008ce, 230 },
+	{ 0x008cf, 0x008d3, 220 },
+	{ 0x008d4, 0x008e1, 230 },
+	{ 0x008e3, 0x008e3, 220 },
+	{ 0x008e4, 0x008e5, 230 },
+	{ 0x008e6, 0x008e6, 220 },
+	{ 0x008e7, 0x008e8, 230 },
+	{ 0x008e9, 0x008e9, 220 },
+	{ 0x008ea, 0x008ec, 230 },
+	{ 0x008ed, 0x008ef, 220 },
+	{ 0x008f0, 0x008f0,  27 },
+	{ 0x008f1, 0x008f1,  28 },
+	{ 0x008f2, 0x008f2,  29 },
+	{ 0x008f3, 0x008f5, 230 },
+	{ 0x008f6, 0x008f6, 220 },
+	{ 0x008f7, 0x008f8, 230 },
+	{ 0x008f9, 0x008fa, 220 },
+	{ 0x008fb, 0x008ff, 230 },
+	{ 0x0093c, 0x0093c,   7 },
+	{ 0x0094d, 0x0094d,   9 },
+	{ 0x00951, 0x00951, 230 },
+	{ 0x00952, 0x00952, 220 },
+	{ 0x00953, 0x00954, 230 },
+	{ 0x009bc, 0x009bc,   7 },
+	{ 0x009cd, 0x009cd,   9 },
+	{ 0x009fe, 0x009fe, 230 },
+	{ 0x00a3c, 0x00a3c,   7 },
+	{ 0x00a4d, 0x00a4d,   9 },
+	{ 0x00abc, 0x00abc,   7 },
+	{ 0x00acd, 0x00acd,   9 },
+	{ 0x00b3c, 0x00b3c,   7 },
+	{ 0x00b4d, 0x00b4d,   9 },
+	{ 0x00bcd, 0x00bcd,   9 },
+	{ 0x00c3c, 0x00c3c,   7 },
+	{ 0x00c4d, 0x00c4d,   9 },
+	{ 0x00c55, 0x00c55,  84 },
+	{ 0x00c56, 0x00c56,  91 },
+	{ 0x00cbc, 0x00cbc,   7 },
+	{ 0x00ccd, 0x00ccd,   9 },
+	{ 0x00d3b, 0x00d3c,   9 },
+	{ 0x00d4d, 0x00d4d,   9 },
+	{ 0x00dca, 0x00dca,   9 },
+	{ 0x00e38, 0x00e39, 103 },
+	{ 0x00e3a, 0x00e3a,   9 },
+	{ 0x00e48, 0x00e4b, 107 },
+	{ 0x00eb8, 0x00eb9, 118 },
+	{ 0x00eba, 0x00eba,   9 },
+	{ 0x00ec8, 0x00ecb, 122 },
+	{ 0x00f18, 0x00f19, 220 },
+	{ 0x00f35, 0x00f35, 220 },
+	{ 0x00f37, 0x00f37, 220 },
+	{ 0x00f39, 0x00f39, 216 },
+	{ 0x00f71, 0x00f71, 129 },
+	{ 0x00f72, 0x00f72, 130 },
+	{ 0x00f74, 0x00f74, 132 },
+	{ 0x00f7a, 0x00f7d, 130 },
+	{ 0x00f80, 0x00f80, 130 },
+	{ 0x00f82, 0x00f83, 230 },
+	{ 0x00f84, 0x00f84,   9 },
+	{ 0x00f86, 0x00f87, 230 },
+	{ 0x00fc6, 0x00fc6, 220 },
+	{ 0x01037, 0x01037,   7 },
+	{ 0x01039, 0x0103a,   9 },
+	{ 0x0108d, 0x0108d, 220 },
+	{ 0x0135d, 0x0135f, 230 },
+	{ 0x01714, 0x01715,   9 },
+	{ 0x01734, 0x01734,   9 },
+	{ 0x017d2, 0x017d2,   9 },
+	{ 0x017dd, 0x017dd, 230 },
+	{ 0x018a9, 0x018a9, 228 },
+	{ 0x01939, 0x01939, 222 },
+	{ 0x0193a, 0x0193a, 230 },
+	{ 0x0193b, 0x0193b, 220 },
+	{ 0x01a17, 0x01a17, 230 },
+	{ 0x01a18, 0x01a18, 220 },
+	{ 0x01a60, 0x01a60,   9 },
+	{ 0x01a75, 0x01a7c, 230 },
+	{ 0x01a7f, 0x01a7f, 220 },
+	{ 0x01ab0, 0x01ab4, 230 },
+	{ 0x01ab5, 0x01aba, 220 },
+	{ 0x01abb, 0x01abc, 230 },
+	{ 0x01abd, 0x01abd, 220 },
+	{ 0x01abf, 0x01ac0, 220 },
+	{ 0x01ac1, 0x01ac2, 230 },
+	{ 0x01ac3, 0x01ac4, 220 },
+	{ 0x01ac5, 0x01ac9, 230 },
+	{ 0x01aca, 0x01aca, 220 },
+	{ 0x01acb, 0x01ace, 230 },
+	{ 0x01b34, 0x01b34,   7 },
+	{ 0x01b44, 0x01b44,   9 },
+	{ 0x01b6b, 0x01b6b, 230 },
+	{ 0x01b6c, 0x01b6c, 220 },
+	{ 0x01b6d, 0x01b73, 230 },
+	{ 0x01baa, 0x01bab,   9 },
+	{ 0x01be6, 0x01be6,   7 },
+	{ 0x01bf2, 0x01bf3,   9 },
+	{ 0x01c37, 0x01c37,   7 },
+	{ 0x01cd0, 0x01cd2, 230 },
+	{ 0x01cd4, 0x01cd4,   1 },
+	{ 0x01cd5, 0x01cd9, 220 },
+	{ 0x01cda, 0x01cdb, 230 },
+	{ 0x01cdc, 0x01cdf, 220 },
+	{ 0x01ce0, 0x01ce0, 230 },
+	{ 0x01ce2, 0x01ce8,   1 },
+	{ 0x01ced, 0x01ced, 220 },
+	{ 0x01cf4, 0x01cf4, 230 },
+	{ 0x01cf8, 0x01cf9, 230 },
+	{ 0x01dc0, 0x01dc1, 230 },
+	{ 0x01dc2, 0x01dc2, 220 },
+	{ 0x01dc3, 0x01dc9, 230 },
+	{ 0x01dca, 0x01dca, 220 },
+	{ 0x01dcb, 0x01dcc, 230 },
+	{ 0x01dcd, 0x01dcd, 234 },
+	{ 0x01dce, 0x01dce, 214 },
+	{ 0x01dcf, 0x01dcf, 220 },
+	{ 0x01dd0, 0x01dd0, 202 },
+	{ 0x01dd1, 0x01df5, 230 },
+	{ 0x01df6, 0x01df6, 232 },
+	{ 0x01df7, 0x01df8, 228 },
+	{ 0x01df9, 0x01df9, 220 },
+	{ 0x01dfa, 0x01dfa, 218 },
+	{ 0x01dfb, 0x01dfb, 230 },
+	{ 0x01dfc, 0x01dfc, 233 },
+	{ 0x01dfd, 0x01dfd, 220 },
+	{ 0x01dfe, 0x01dfe, 230 },
+	{ 0x01dff, 0x01dff, 220 },
+	{ 0x020d0, 0x020d1, 230 },
+	{ 0x020d2, 0x020d3,   1 },
+	{ 0x020d4, 0x020d7, 230 },
+	{ 0x020d8, 0x020da,   1 },
+	{ 0x020db, 0x020dc, 230 },
+	{ 0x020e1, 0x020e1, 230 },
+	{ 0x020e5, 0x020e6,   1 },
+	{ 0x020e7, 0x020e7, 230 },
+	{ 0x020e8, 0x020e8, 220 },
+	{ 0x020e9, 0x020e9, 230 },
+	{ 0x020ea, 0x020eb,   1 },
+	{ 0x020ec, 0x020ef, 220 },
+	{ 0x020f0, 0x020f0, 230 },
+	{ 0x02cef, 0x02cf1, 230 },
+	{ 0x02d7f, 0x02d7f,   9 },
+	{ 0x02de0, 0x02dff, 230 },
+	{ 0x0302a, 0x0302a, 218 },
+	{ 0x0302b, 0x0302b, 228 },
+	{ 0x0302c, 0x0302c, 232 },
+	{ 0x0302d, 0x0302d, 222 },
+	{ 0x0302e, 0x0302f, 224 },
+	{ 0x03099, 0x0309a,   8 },
+	{ 0x0a66f, 0x0a66f, 230 },
+	{ 0x0a674, 0x0a67d, 230 },
+	{ 0x0a69e, 0x0a69f, 230 },
+	{ 0x0a6f0, 0x0a6f1, 230 },
+	{ 0x0a806, 0x0a806,   9 },
+	{ 0x0a82c, 0x0a82c,   9 },
+	{ 0x0a8c4, 0x0a8c4,   9 },
+	{ 0x0a8e0, 0x0a8f1, 230 },
+	{ 0x0a92b, 0x0a92d, 220 },
+	{ 0x0a953, 0x0a953,   9 },
+	{ 0x0a9b3, 0x0a9b3,   7 },
+	{ 0x0a9c0, 0x0a9c0,   9 },
+	{ 0x0aab0, 0x0aab0, 230 },
+	{ 0x0aab2, 0x0aab3, 230 },
+	{ 0x0aab4, 0x0aab4, 220 },
+	{ 0x0aab7, 0x0aab8, 230 },
+	{ 0x0aabe, 0x0aabf, 230 },
+	{ 0x0aac1, 0x0aac1, 230 },
+	{ 0x0aaf6, 0x0aaf6,   9 },
+	{ 0x0abed, 0x0abed,   9 },
+	{ 0x0fb1e, 0x0fb1e,  26 },
+	{ 0x0fe20, 0x0fe26, 230 },
+	{ 0x0fe27, 0x0fe2d, 220 },
+	{ 0x0fe2e, 0x0fe2f, 230 },
+	{ 0x101fd, 0x101fd, 220 },
+	{ 0x102e0, 0x102e0, 220 },
+	{ 0x10376, 0x1037a, 230 },
+	{ 0x10a0d, 0x10a0d, 220 },
+	{ 0x10a0f, 0x10a0f, 230 },
+	{ 0x10a38, 0x10a38, 230 },
+	{ 0x10a39, 0x10a39,   1 },
+	{ 0x10a3a, 0x10a3a, 220 },
+	{ 0x10a3f, 0x10a3f,   9 },
+	{ 0x10ae5, 0x10ae5, 230 },
+	{ 0x10ae6, 0x10ae6, 220 },
+	{ 0x10d24, 0x10d27, 230 },
+	{ 0x10eab, 0x10eac, 230 },
+	{ 0x10f46, 0x10f47, 220 },
+	{ 0x10f48, 0x10f4a, 230 },
+	{ 0x10f4b, 0x10f4b, 220 },
+	{ 0x10f4c, 0x10f4c, 230 },
+	{ 0x10f4d, 0x10f50, 220 },
+	{ 0x10f82, 0x10f82, 230 },
+	{ 0x10f83, 0x10f83, 220 },
+	{ 0x10f84, 0x10f84, 230 },
+	{ 0x10f85, 0x10f85, 220 },
+	{ 0x11046, 0x11046,   9 },
+	{ 0x11070, 0x11070,   9 },
+	{ 0x1107f, 0x1107f,   9 },
+	{ 0x110b9, 0x110b9,   9 },
+	{ 0x110ba, 0x110ba,   7 },
+	{ 0x11100, 0x11102, 230 },
+	{ 0x11133, 0x11134,   9 },
+	{ 0x11173, 0x11173,   7 },
+	{ 0x111c0, 0x111c0,   9 },
+	{ 0x111ca, 0x111ca,   7 },
+	{ 0x11235, 0x11235,   9 },
+	{ 0x11236, 0x11236,   7 },
+	{ 0x112e9, 0x112e9,   7 },
+	{ 0x112ea, 0x112ea,   9 },
+	{ 0x1133b, 0x1133c,   7 },
+	{ 0x1134d, 0x1134d,   9 },
+	{ 0x11366, 0x1136c, 230 },
+	{ 0x11370, 0x11374, 230 },
+	{ 0x11442, 0x11442,   9 },
+	{ 0x11446, 0x11446,   7 },
+	{ 0x1145e, 0x1145e, 230 },
+	{ 0x114c2, 0x114c2,   9 },
+	{ 0x114c3, 0x114c3,   7 },
+	{ 0x115bf, 0x115bf,   9 },
+	{ 0x115c0, 0x115c0,   7 },
+	{ 0x1163f, 0x1163f,   9 },
+	{ 0x116b6, 0x116b6,   9 },
+	{ 0x116b7, 0x116b7,   7 },
+	{ 0x1172b, 0x1172b,   9 },
+	{ 0x11839, 0x11839,   9 },
+	{ 0x1183a, 0x1183a,   7 },
+	{ 0x1193d, 0x1193e,   9 },
+	{ 0x11943, 0x11943,   7 },
+	{ 0x119e0, 0x119e0,   9 },
+	{ 0x11a34, 0x11a34,   9 },
+	{ 0x11a47, 0x11a47,   9 },
+	{ 0x11a99, 0x11a99,   9 },
+	{ 0x11c3f, 0x11c3f,   9 },
+	{ 0x11d42, 0x11d42,   7 },
+	{ 0x11d44, 0x11d45,   9 },
+	{ 0x11d97, 0x11d97,   9 },
+	{ 0x16af0, 0x16af4,   1 },
+	{ 0x16b30, 0x16b36, 230 },
+	{ 0x16ff0, 0x16ff1,   6 },
+	{ 0x1bc9e, 0x1bc9e,   1 },
+	{ 0x1d165, 0x1d166, 216 },
+	{ 0x1d167, 0x1d169,   1 },
+	{ 0x1d16d, 0x1d16d, 226 },
+	{ 0x1d16e, 0x1d172, 216 },
+	{ 0x1d17b, 0x1d182, 220 },
+	{ 0x1d185, 0x1d189, 230 },
+	{ 0x1d18a, 0x1d18b, 220 },
+	{ 0x1d1aa, 0x1d1ad, 230 },
+	{ 0x1d242, 0x1d244, 230 },
+	{ 0x1e000, 0x1e006, 230 },
+	{ 0x1e008, 0x1e018, 230 },
+	{ 0x1e01b, 0x1e021, 230 },
+	{ 0x1e023, 0x1e024, 230 },
+	{ 0x1e026, 0x1e02a, 230 },
+	{ 0x1e130, 0x1e136, 230 },
+	{ 0x1e2ae, 0x1e2ae, 230 },
+	{ 0x1e2ec, 0x1e2ef, 230 },
+	{ 0x1e8d0, 0x1e8d6, 220 },
+	{ 0x1e944, 0x1e949, 230 },
+	{ 0x1e94a, 0x1e94a,   7 }
+};
+
+#endif /* !_NFKD_TABLE_H_ */
@@ -0,0 +1,754 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../scrypt/sysendian.h"
+
+#include "aes.h"
+#include "aes_impl.h"
+
+/*
+ * The portable path is bitsliced: bit i of every state byte lives in
+ * plane q[i], with two blocks side by side in each 32-bit plane. Byte j
+ * of the first block is bit j, and byte j of the second is bit j + 16.
+ * The S-box is a fixed circuit of AND and XOR gates, so there are no
+ * secret-dependent table lookups or branches.
+ */
+
+/**
+ * aes_pack(in, nbytes, q):
+ * Spread up to 32 bytes across the eight bit planes.
+ */
+static void
+aes_pack(const uint8_t * in, size_t nbytes, uint32_t q[8])
+{
+	size_t i, j;
+
+	for (i = 0; i < 8; i++)
+		q[i] = 0;
+	for (j = 0; j < nbytes; j++)
+		for (i = 0; i < 8; i++)
+			q[i] |= (uint32_t)((in[j] >> i) & 1) << j;
+}
+
+/**
+ * aes_unpack(q, out, nbytes):
+ * Gather up to 32 bytes back out of the bit planes.
+ */
+static void
+aes_unpack(const uint32_t q[8], uint8_t * out, size_t nbytes)
+{
+	size_t i, j;
+
+	for (j = 0; j < nbytes; j++) {
+		out[j] = 0;
+		for (i = 0; i < 8; i++)
+			out[j] |= ((q[i] >> j) & 1) << i;
+	}
+}
+
+/**
+ * aes_sub_bytes(q):
+ * The Boyar-Peralta S-box circuit: 113 XOR, XNOR, and AND gates.
+ */
+static void
+aes_sub_bytes(uint32_t q[8])
+{
+	uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+	uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+	uint32_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+	uint32_t y20, y21;
+	uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+	uint32_t z10, z11, z12, z13, z14, z15, z16, z17;
+	uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+	uint32_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+	uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+	uint32_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+	uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+	uint32_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+	uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+	uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+	x0 = q[7];
+	x1 = q[6];
+	x2 = q[5];
+	x3 = q[4];
+	x4 = q[3];
+	x5 = q[2];
+	x6 = q[1];
+	x7 = q[0];
+
+	/* Top linear transformation. */
+	y14 = x3 ^ x5;
+	y13 = x0 ^ x6;
+	y9 = x0 ^ x3;
+	y8 = x0 ^ x5;
+	t0 = x1 ^ x2;
+	y1 = t0 ^ x7;
+	y4 = y1 ^ x3;
+	y12 = y13 ^ y14;
+	y2 = y1 ^ x0;
+	y5 = y1 ^ x6;
+	y3 = y5 ^ y8;
+	t1 = x4 ^ y12;
+	y15 = t1 ^ x5;
+	y20 = t1 ^ x1;
+	y6 = y15 ^ x7;
+	y10 = y15 ^ t0;
+	y11 = y20 ^ y9;
+	y7 = x7 ^ y11;
+	y17 = y10 ^ y11;
+	y19 = y10 ^ y8;
+	y16 = t0 ^ y11;
+	y21 = y13 ^ y16;
+	y18 = x0 ^ y16;
+
+	/* Non-linear section. */
+	t2 = y12 & y15;
+	t3 = y3 & y6;
+	t4 = t3 ^ t2;
+	t5 = y4 & x7;
+	t6 = t5 ^ t2;
+	t7 = y13 & y16;
+	t8 = y5 & y1;
+	t9 = t8 ^ t7;
+	t10 = y2 & y7;
+	t11 = t10 ^ t7;
+	t12 = y9 & y11;
+	t13 = y14 & y17;
+	t14 = t13 ^ t12;
+	t15 = y8 & y10;
+	t16 = t15 ^ t12;
+	t17 = t4 ^ t14;
+	t18 = t6 ^ t16;
+	t19 = t9 ^ t14;
+	t20 = t11 ^ t16;
+	t21 = t17 ^ y20;
+	t22 = t18 ^ y19;
+	t23 = t19 ^ y21;
+	t24 = t20 ^ y18;
+
+	t25 = t21 ^ t22;
+	t26 = t21 & t23;
+	t27 = t24 ^ t26;
+	t28 = t25 & t27;
+	t29 = t28 ^ t22;
+	t30 = t23 ^ t24;
+	t31 = t22 ^ t26;
+	t32 = t31 & t30;
+	t33 = t32 ^ t24;
+	t34 = t23 ^ t33;
+	t35 = t27 ^ t33;
+	t36 = t24 & t35;
+	t37 = t36 ^ t34;
+	t38 = t27 ^ t36;
+	t39 = t29 & t38;
+	t40 = t25 ^ t39;
+
+	t41 = t40 ^ t37;
+	t42 = t29 ^ t33;
+	t43 = t29 ^ t40;
+	t44 = t33 ^ t37;
+	t45 = t42 ^ t41;
+	z0 = t44 & y15;
+	z1 = t37 & y6;
+	z2 = t33 & x7;
+	z3 = t43 & y16;
+	z4 = t40 & y1;
+	z5 = t29 & y7;
+	z6 = t42 & y11;
+	z7 = t45 & y17;
+	z8 = t41 & y10;
+	z9 = t44 & y12;
+	z10 = t37 & y3;
+	z11 = t33 & y4;
+	z12 = t43 & y13;
+	z13 = t40 & y5;
+	z14 = t29 & y2;
+	z15 = t42 & y9;
+	z16 = t45 & y14;
+	z17 = t41 & y8;
+
+	/* Bottom linear transformation. */
+	t46 = z15 ^ z16;
+	t47 = z10 ^ z11;
+	t48 = z5 ^ z13;
+	t49 = z9 ^ z10;
+	t50 = z2 ^ z12;
+	t51 = z2 ^ z5;
+	t52 = z7 ^ z8;
+	t53 = z0 ^ z3;
+	t54 = z6 ^ z7;
+	t55 = z16 ^ z17;
+	t56 = z12 ^ t48;
+	t57 = t50 ^ t53;
+	t58 = z4 ^ t46;
+	t59 = z3 ^ t54;
+	t60 = t46 ^ t57;
+	t61 = z14 ^ t57;
+	t62 = t52 ^ t58;
+	t63 = t49 ^ t58;
+	t64 = z4 ^ t59;
+	t65 = t61 ^ t62;
+	t66 = z1 ^ t63;
+	s0 = t59 ^ t63;
+	s6 = t56 ^ ~t62;
+	s7 = t48 ^ ~t60;
+	t67 = t64 ^ t65;
+	s3 = t53 ^ t66;
+	s4 = t51 ^ t66;
+	s5 = t47 ^ t65;
+	s1 = t64 ^ ~s3;
+	s2 = t55 ^ ~t67;
+
+	q[7] = s0;
+	q[6] = s1;
+	q[5] = s2;
+	q[4] = s3;
+	q[3] = s4;
+	q[2] = s5;
+	q[1] = s6;
+	q[0] = s7;
+}
+
+/**
+ * aes_inv_affine(q):
+ * Undo the S-box's affine step, including its constant 0x63.
+ */
+static void
+aes_inv_affine(uint32_t q[8])
+{
+	uint32_t t[8];
+	int i;
+
+	for (i = 0; i < 8; i++)
+		t[i] = q[(i + 2) % 8] ^ q[(i + 5) % 8] ^ q[(i + 7) % 8];
+	q[0] = ~t[0];
+	q[1] = t[1];
+	q[2] = ~t[2];
+	for (i = 3; i < 8; i++)
+		q[i] = t[i];
+}
+
+/**
+ * aes_inv_sub_bytes(q):
+ * The S-box is an inversion followed by an affine map, so undoing that
+ * map on both sides of the forward circuit leaves just the inversion.
+ */
+static void
+aes_inv_sub_bytes(uint32_t q[8])
+{
+
+	aes_inv_affine(q);
+	aes_sub_bytes(q);
+	aes_inv_affine(q);
+}
+
+#define ROTR16(x, n) ((((x) >> (n)) | ((x) << (16 - (n)))) & 0xffff)
+
+/**
+ * shift_rows16(x, inverse):
+ * Apply ShiftRows to one block's worth of bits. Row r holds the bits
+ * 0x1111 << r, and moves by r columns of four bits each.
+ */
+static uint32_t
+shift_rows16(uint32_t x, int inverse)
+{
+	uint32_t r1 = x & 0x2222, r2 = x & 0x4444, r3 = x & 0x8888;
+
+	if (inverse)
+		return (x & 0x1111) | ROTR16(r1, 12) | ROTR16(r2, 8) |
+		    ROTR16(r3, 4);
+	return (x & 0x1111) | ROTR16(r1, 4) | ROTR16(r2, 8) | ROTR16(r3, 12);
+}
+
+static void
+aes_shift_rows(uint32_t q[8], int inverse)
+{
+	int i;
+
+	for (i = 0; i < 8; i++)
+		q[i] = shift_rows16(q[i] & 0xffff, inverse) |
+		    (shift_rows16(q[i] >> 16, inverse) << 16);
+}
+
+/* Move row r + k of each column into row r. */
+#define ROW1(x) ((((x) >> 1) & 0x77777777) | (((x) << 3) & 0x88888888))
+#define ROW2(x) ((((x) >> 2) & 0x33333333) | (((x) << 2) & 0xcccccccc))
+#define ROW3(x) ((((x) >> 3) & 0x11111111) | (((x) << 1) & 0xeeeeeeee))
+
+/**
+ * aes_xtime(a, r):
+ * Multiply every byte by x.
+ */
+static void
+aes_xtime(const uint32_t a[8], uint32_t r[8])
+{
+
+	r[0] = a[7];
+	r[1] = a[0] ^ a[7];
+	r[2] = a[1];
+	r[3] = a[2] ^ a[7];
+	r[4] = a[3] ^ a[7];
+	r[5] = a[4];
+	r[6] = a[5];
+	r[7] = a[6];
+}
+
+static void
+aes_mix_columns(uint32_t q[8])
+{
+	uint32_t t[8], u[8];
+	int i;
+
+	/* s'[r] = 2 * (s[r] + s[r + 1]) + s[r + 1] + s[r + 2] + s[r + 3] */
+	for (i = 0; i < 8; i++) {
+		t[i] = q[i] ^ ROW1(q[i]);
+		u[i] = ROW1(q[i]) ^ ROW2(q[i]) ^ ROW3(q[i]);
+	}
+	aes_xtime(t, q);
+	for (i = 0; i < 8; i++)
+		q[i] ^= u[i];
+}
+
+static void
+aes_inv_mix_columns(uint32_t q[8])
+{
+	uint32_t t[8], u[8];
+	int i;
+
+	/* Add 4 * (s[r] + s[r + 2]), then apply the forward MixColumns. */
+	for (i = 0; i < 8; i++)
+		t[i] = q[i] ^ ROW2(q[i]);
+	aes_xtime(t, u);
+	aes_xtime(u, t);
+	for (i = 0; i < 8; i++)
+		q[i] ^= t[i];
+	aes_mix_columns(q);
+}
+
+static void
+aes_add_round_key(uint32_t q[8], const uint32_t * sk)
+{
+	int i;
+
+	for (i = 0; i < 8; i++)
+		q[i] ^= sk[i];
+}
+
+static void
+bitsliced_encrypt2(const uint32_t * sk, uint32_t q[8])
+{
+	int r;
+
+	aes_add_round_key(q, sk);
+	for (r = 1; r < 14; r++) {
+		aes_sub_bytes(q);
+		aes_shift_rows(q, 0);
+		aes_mix_columns(q);
+		aes_add_round_key(q, sk + 8 * r);
+	}
+	aes_sub_bytes(q);
+	aes_shift_rows(q, 0);
+	aes_add_round_key(q, sk + 8 * 14);
+}
+
+static void
+bitsliced_decrypt2(const uint32_t * sk, uint32_t q[8])
+{
+	int r;
+
+	aes_add_round_key(q, sk + 8 * 14);
+	for (r = 13; r > 0; r--) {
+		aes_shift_rows(q, 1);
+		aes_inv_sub_bytes(q);
+		aes_add_round_key(q, sk + 8 * r);
+		aes_inv_mix_columns(q);
+	}
+	aes_shift_rows(q, 1);
+	aes_inv_sub_bytes(q);
+	aes_add_round_key(q, sk);
+}
+
+static void
+bitsliced_blocks(const uint32_t * sk, const uint8_t * in, uint8_t * out,
+    size_t nblocks, int decrypt)
+{
+	uint32_t q[8];
+	size_t n;
+
+	for (; nblocks > 0; nblocks -= n, in += 16 * n, out += 16 * n) {
+		n = nblocks >= 2 ? 2 : 1;
+		aes_pack(in, 16 * n, q);
+		if (decrypt)
+			bitsliced_decrypt2(sk, q);
+		else
+			bitsliced_encrypt2(sk, q);
+		aes_unpack(q, out, 16 * n);
+	}
+
+	/* Clean the stack. */
+	memset(q, 0, sizeof(q));
+}
+
+/* Implementation selection. */
+static int aes_forced = AES_IMPL_AUTO;
+
+static int
+aes_available(int impl)
+{
+
+	switch (impl) {
+	case AES_IMPL_BITSLICED:
+		return 1;
+	case AES_IMPL_AESNI:
+		return aes_x86_available();
+	case AES_IMPL_ARMV8:
+		return aes_arm_available();
+	default:
+		return 0;
+	}
+}
+
+int
+AES_SetImplementation(int impl)
+{
+
+	if (impl != AES_IMPL_AUTO && !aes_available(impl))
+		return (-1);
+	__atomic_store_n(&aes_forced, impl, __ATOMIC_RELAXED);
+	return (0);
+}
+
+int
+AES_GetImplementation(void)
+{
+	int impl = __atomic_load_n(&aes_forced, __ATOMIC_RELAXED);
+
+	if (impl != AES_IMPL_AUTO)
+		return (impl);
+	if (aes_x86_available())
+		return (AES_IMPL_AESNI);
+	if (aes_arm_available())
+		return (AES_IMPL_ARMV8);
+	return (AES_IMPL_BITSLICED);
+}
+
+void
+AES256_Init(AES256_CTX * ctx, const uint8_t key[32])
+{
+	static const uint8_t rcon[7] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40 };
+	uint8_t * w = ctx->ek;
+	uint8_t t[4];
+	uint32_t q[8];
+	int i, j;
+
+	ctx->impl = AES_GetImplementation();
+
+	/* Expand the key, using the bitsliced S-box for SubWord. */
+	memcpy(w, key, 32);
+	for (i = 8; i < 60; i++) {
+		memcpy(t, &w[4 * (i - 1)], 4);
+		if (i % 8 == 0) {
+			uint8_t r = t[0];
+			t[0] = t[1];
+			t[1] = t[2];
+			t[2] = t[3];
+			t[3] = r;
+		}
+		if (i % 4 == 0) {
+			aes_pack(t, 4, q);
+			aes_sub_bytes(q);
+			aes_unpack(q, t, 4);
+		}
+		if (i % 8 == 0)
+			t[0] ^= rcon[i / 8 - 1];
+		for (j = 0; j < 4; j++)
+			w[4 * i + j] = w[4 * (i - 8) + j] ^ t[j];
+	}
+
+	switch (ctx->impl) {
+	case AES_IMPL_AESNI:
+		aes_x86_invert_keys(ctx->ek, ctx->dk);
+		break;
+	case AES_IMPL_ARMV8:
+		aes_arm_invert_keys(ctx->ek, ctx->dk);
+		break;
+	default:
+		/* Copy each round key into both halves of its planes. */
+		for (i = 0; i < 15; i++) {
+			aes_pack(&ctx->ek[16 * i], 16, &ctx->sk[8 * i]);
+			for (j = 0; j < 8; j++)
+				ctx->sk[8 * i + j] |= ctx->sk[8 * i + j] << 16;
+		}
+		break;
+	}
+
+	/* Clean the stack. */
+	memset(t, 0, sizeof(t));
+	memset(q, 0, sizeof(q));
+}
+
+void
+AES256_Clear(AES256_CTX * ctx)
+{
+
+	memset(ctx, 0, sizeof(*ctx));
+}
+
+void
+AES256_Encrypt_Blocks(const AES256_CTX * ctx, const uint8_t * in,
+    uint8_t * out, size_t nblocks)
+{
+
+	switch (ctx->impl) {
+	case AES_IMPL_AESNI:
+		aes_x86_encrypt(ctx->ek, in, out, nblocks);
+		break;
+	case AES_IMPL_ARMV8:
+		aes_arm_encrypt(ctx->ek, in, out, nblocks);
+		break;
+	default:
+		bitsliced_blocks(ctx->sk, in, out, nblocks, 0);
+		break;
+	}
+}
+
+void
+AES256_Decrypt_Blocks(const AES256_CTX * ctx, const uint8_t * in,
+    uint8_t * out, size_t nblocks)
+{
+
+	switch (ctx->impl) {
+	case AES_IMPL_AESNI:
+		aes_x86_decrypt(ctx->dk, in, out, nblocks);
+		break;
+	case AES_IMPL_ARMV8:
+		aes_arm_decrypt(ctx->dk, in, out, nblocks);
+		break;
+	default:
+		bitsliced_blocks(ctx->sk, in, out, nblocks, 1);
+		break;
+	}
+}
+
+void
+AES256_CBC_Encrypt(const AES256_CTX * ctx, uint8_t iv[16],
+    const uint8_t * in, uint8_t * out, size_t nblocks)
+{
+	size_t i, j;
+
+	for (i = 0; i < nblocks; i++) {
+		for (j = 0; j < 16; j++)
+			iv[j] ^= in[16 * i + j];
+		AES256_Encrypt_Blocks(ctx, iv, iv, 1);
+		memcpy(&out[16 * i], iv, 16);
+	}
+}
+
+void
+AES256_CBC_Decrypt(const AES256_CTX * ctx, uint8_t iv[16],
+    const uint8_t * in, uint8_t * out, size_t nblocks)
+{
+	uint8_t c[128], p[128];
+	size_t i, n;
+
+	/* Decrypt eight blocks at a time, so the hardware can pipeline. */
+	for (; nblocks > 0; nblocks -= n, in += 16 * n, out += 16 * n) {
+		n = nblocks >= 8 ? 8 : nblocks;
+		memcpy(c, in, 16 * n);
+		AES256_Decrypt_Blocks(ctx, c, p, n);
+		for (i = 0; i < 16; i++)
+			out[i] = p[i] ^ iv[i];
+		for (i = 16; i < 16 * n; i++)
+			out[i] = p[i] ^ c[i - 16];
+		memcpy(iv, &c[16 * (n - 1)], 16);
+	}
+
+	/* Clean the stack. */
+	memset(p, 0, sizeof(p));
+}
+
+/**
+ * ghash_ct(H, Y, in, nblocks):
+ * Portable GHASH, using masks rather than branches or tables.
+ */
+static void
+ghash_ct(const uint8_t H[16], uint8_t Y[16], const uint8_t * in,
+    size_t nblocks)
+{
+	uint64_t hh = be64dec(H), hl = be64dec(&H[8]);
+	uint64_t xh, xl, zh, zl, vh, vl, mask;
+	size_t b;
+	int i;
+
+	for (b = 0; b < nblocks; b++, in += 16) {
+		xh = be64dec(Y) ^ be64dec(in);
+		xl = be64dec(&Y[8]) ^ be64dec(&in[8]);
+		zh = zl = 0;
+		vh = hh;
+		vl = hl;
+		for (i = 0; i < 128; i++) {
+			mask = -((i < 64 ? xh >> (63 - i) : xl >> (127 - i)) & 1);
+			zh ^= vh & mask;
+			zl ^= vl & mask;
+
+			/* Multiply V by x, reducing by x^128 + x^7 + x^2 + x + 1. */
+			mask = -(vl & 1);
+			vl = (vl >> 1) | (vh << 63);
+			vh = (vh >> 1) ^ (0xe100000000000000ULL & mask);
+		}
+		be64enc(Y, zh);
+		be64enc(&Y[8], zl);
+	}
+}
+
+static void
+aes_ghash(int impl, const uint8_t H[16], uint8_t Y[16], const uint8_t * in,
+    size_t len)
+{
+	uint8_t last[16];
+	size_t nblocks = len / 16;
+
+	switch (impl) {
+	case AES_IMPL_AESNI:
+		aes_x86_ghash(H, Y, in, nblocks);
+		break;
+	case AES_IMPL_ARMV8:
+		aes_arm_ghash(H, Y, in, nblocks);
+		break;
+	default:
+		ghash_ct(H, Y, in, nblocks);
+		break;
+	}
+
+	/* Zero-pad any partial block. */
+	if (len % 16 != 0) {
+		memset(last, 0, 16);
+		memcpy(last, &in[16 * nblocks], len % 16);
+		aes_ghash(impl, H, Y, last, 16);
+	}
+}
+
+/**
+ * aes_ctr32(ctx, counter, in, out, len):
+ * GCM counter mode, which only increments the last 32 bits.
+ */
+static void
+aes_ctr32(const AES256_CTX * ctx, uint8_t counter[16], const uint8_t * in,
+    uint8_t * out, size_t len)
+{
+	uint8_t blocks[128], stream[128];
+	uint32_t ctr = be32dec(&counter[12]);
+	size_t i, n;
+
+	for (; len > 0; len -= n, in += n, out += n) {
+		n = len >= 128 ? 128 : len;
+		for (i = 0; i < n; i += 16) {
+			memcpy(&blocks[i], counter, 12);
+			be32enc(&blocks[i + 12], ctr++);
+		}
+		AES256_Encrypt_Blocks(ctx, blocks, stream, (n + 15) / 16);
+		for (i = 0; i < n; i++)
+			out[i] = in[i] ^ stream[i];
+	}
+	be32enc(&counter[12], ctr);
+
+	/* Clean the stack. */
+	memset(stream, 0, sizeof(stream));
+}
+
+/**
+ * aes_gcm_tag(ctx, H, J0, aad, aadlen, c, len, tag):
+ * Compute the GCM tag over the AAD and ciphertext.
+ */
+static void
+aes_gcm_tag(const AES256_CTX * ctx, const uint8_t H[16], const uint8_t J0[16],
+    const uint8_t * aad, size_t aadlen, const uint8_t * c, size_t len,
+    uint8_t tag[16])
+{
+	uint8_t S[16], lengths[16], EJ0[16];
+	int i;
+
+	memset(S, 0, 16);
+	aes_ghash(ctx->impl, H, S, aad, aadlen);
+	aes_ghash(ctx->impl, H, S, c, len);
+	be64enc(lengths, (uint64_t)aadlen * 8);
+	be64enc(&lengths[8], (uint64_t)len * 8);
+	aes_ghash(ctx->impl, H, S, lengths, 16);
+
+	AES256_Encrypt_Blocks(ctx, J0, EJ0, 1);
+	for (i = 0; i < 16; i++)
+		tag[i] = S[i] ^ EJ0[i];
+}
+
+/**
+ * aes_gcm_init(ctx, key, iv, H, J0):
+ * Set up the cipher, hash key, and first counter block.
+ */
+static void
+aes_gcm_init(AES256_CTX * ctx, const uint8_t key[32], const uint8_t iv[12],
+    uint8_t H[16], uint8_t J0[16])
+{
+
+	AES256_Init(ctx, key);
+	memset(H, 0, 16);
+	AES256_Encrypt_Blocks(ctx, H, H, 1);
+	memcpy(J0, iv, 12);
+	be32enc(&J0[12], 1);
+}
+
+void
+AES256_GCM_Encrypt(const uint8_t key[32], const uint8_t iv[12],
+    const uint8_t * aad, size_t aadlen, const uint8_t * in, size_t len,
+    uint8_t * out, uint8_t tag[16])
+{
+	AES256_CTX ctx;
+	uint8_t H[16], J0[16], counter[16];
+
+	aes_gcm_init(&ctx, key, iv, H, J0);
+	memcpy(counter, J0, 16);
+	be32enc(&counter[12], 2);
+	aes_ctr32(&ctx, counter, in, out, len);
+	aes_gcm_tag(&ctx, H, J0, aad, aadlen, out, len, tag);
+
+	/* Clean the stack. */
+	AES256_Clear(&ctx);
+	memset(H, 0, sizeof(H));
+}
+
+int
+AES256_GCM_Decrypt(const uint8_t key[32], const uint8_t iv[12],
+    const uint8_t * aad, size_t aadlen, const uint8_t * in, size_t len,
+    const uint8_t tag[16], uint8_t * out)
+{
+	AES256_CTX ctx;
+	uint8_t H[16], J0[16], counter[16], expected[16];
+	uint8_t diff = 0;
+	int i;
+
+	/* Check the tag before releasing any plaintext. */
+	aes_gcm_init(&ctx, key, iv, H, J0);
+	aes_gcm_tag(&ctx, H, J0, aad, aadlen, in, len, expected);
+	for (i = 0; i < 16; i++)
+		diff |= expected[i] ^ tag[i];
+
+	if (diff == 0) {
+		memcpy(counter, J0, 16);
+		be32enc(&counter[12], 2);
+		aes_ctr32(&ctx, counter, in, out, len);
+	} else {
+		memset(out, 0, len);
+	}
+
+	/* Clean the stack. */
+	AES256_Clear(&ctx);
+	memset(H, 0, sizeof(H));
+	return (diff == 0 ? 0 : -1);
+}
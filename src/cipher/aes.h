@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _AES_H_
+#define _AES_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/* Block cipher implementations, for AES_SetImplementation. */
+#define AES_IMPL_AUTO		0
+#define AES_IMPL_BITSLICED	1
+#define AES_IMPL_AESNI		2
+#define AES_IMPL_ARMV8		3
+
+typedef struct AES256Context {
+	/* Round keys in byte form, for the hardware paths. */
+	unsigned char ek[15 * 16];
+	unsigned char dk[15 * 16];
+
+	/* Round keys in bit-plane form, for the bitsliced path. */
+	uint32_t sk[15 * 8];
+
+	int impl;
+} AES256_CTX;
+
+/**
+ * AES_SetImplementation(impl):
+ * Force a particular implementation for contexts created after this
+ * call, or go back to picking the fastest with AES_IMPL_AUTO.
+ * Return 0 on success, or -1 if this CPU lacks the implementation.
+ */
+int	AES_SetImplementation(int);
+
+/**
+ * AES_GetImplementation():
+ * Return the implementation new contexts will use.
+ */
+int	AES_GetImplementation(void);
+
+void	AES256_Init(AES256_CTX *, const uint8_t [32]);
+void	AES256_Clear(AES256_CTX *);
+
+/**
+ * AES256_Encrypt_Blocks(ctx, in, out, nblocks):
+ * AES256_Decrypt_Blocks(ctx, in, out, nblocks):
+ * Run the raw block cipher over nblocks independent 16-byte blocks.
+ */
+void	AES256_Encrypt_Blocks(const AES256_CTX *, const uint8_t *, uint8_t *,
+    size_t);
+void	AES256_Decrypt_Blocks(const AES256_CTX *, const uint8_t *, uint8_t *,
+    size_t);
+
+/**
+ * AES256_CBC_Encrypt(ctx, iv, in, out, nblocks):
+ * AES256_CBC_Decrypt(ctx, iv, in, out, nblocks):
+ * Run CBC mode over nblocks whole blocks, updating iv in place so
+ * longer messages can be processed in pieces.
+ */
+void	AES256_CBC_Encrypt(const AES256_CTX *, uint8_t [16], const uint8_t *,
+    uint8_t *, size_t);
+void	AES256_CBC_Decrypt(const AES256_CTX *, uint8_t [16], const uint8_t *,
+    uint8_t *, size_t);
+
+/**
+ * AES256_GCM_Encrypt(key, iv, aad, aadlen, in, len, out, tag):
+ * Encrypt in[0 .. len - 1] with AES-256-GCM and a 96-bit IV,
+ * authenticating aad as well.
+ */
+void	AES256_GCM_Encrypt(const uint8_t [32], const uint8_t [12],
+    const uint8_t *, size_t, const uint8_t *, size_t, uint8_t *,
+    uint8_t [16]);
+
+/**
+ * AES256_GCM_Decrypt(key, iv, aad, aadlen, in, len, tag, out):
+ * Check the tag and decrypt in[0 .. len - 1] with AES-256-GCM.
+ * Return 0 on success, or -1 if the tag does not match, in which case
+ * out is zeroed.
+ */
+int	AES256_GCM_Decrypt(const uint8_t [32], const uint8_t [12],
+    const uint8_t *, size_t, const uint8_t *, size_t, const uint8_t [16],
+    uint8_t *);
+
+#endif /* !_AES_H_ */
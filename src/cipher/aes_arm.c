@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "aes_impl.h"
+
+#if defined(__aarch64__)
+
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+
+/* Only these functions use the extensions, so the rest of the library
+ * still runs on cores without them. */
+#if defined(__clang__)
+#define AES_ARM_TARGET __attribute__((target("aes")))
+#else
+#define AES_ARM_TARGET __attribute__((target("+crypto")))
+#endif
+
+int
+aes_arm_available(void)
+{
+#if defined(__APPLE__)
+	/* Every 64-bit Apple chip has the crypto extensions. */
+	return (1);
+#elif defined(__linux__)
+	unsigned long hwcap = getauxval(AT_HWCAP);
+
+	return ((hwcap & HWCAP_AES) && (hwcap & HWCAP_PMULL));
+#else
+	return (0);
+#endif
+}
+
+AES_ARM_TARGET void
+aes_arm_invert_keys(const unsigned char * ek, unsigned char * dk)
+{
+	int i;
+
+	/* The equivalent inverse cipher runs InvMixColumns over the keys. */
+	memcpy(dk, &ek[16 * 14], 16);
+	for (i = 1; i < 14; i++)
+		vst1q_u8(&dk[16 * i], vaesimcq_u8(vld1q_u8(&ek[16 * (14 - i)])));
+	memcpy(&dk[16 * 14], ek, 16);
+}
+
+/*
+ * AESE and AESD add the round key first, so round r uses key r, and
+ * the last key is a plain XOR.
+ */
+
+AES_ARM_TARGET void
+aes_arm_encrypt(const unsigned char * ek, const uint8_t * in, uint8_t * out,
+    size_t nblocks)
+{
+	uint8x16_t k[15], b0, b1, b2, b3;
+	int r;
+
+	for (r = 0; r < 15; r++)
+		k[r] = vld1q_u8(&ek[16 * r]);
+
+	/* Four blocks at a time hides the instruction latency. */
+	for (; nblocks >= 4; nblocks -= 4, in += 64, out += 64) {
+		b0 = vld1q_u8(in);
+		b1 = vld1q_u8(&in[16]);
+		b2 = vld1q_u8(&in[32]);
+		b3 = vld1q_u8(&in[48]);
+		for (r = 0; r < 13; r++) {
+			b0 = vaesmcq_u8(vaeseq_u8(b0, k[r]));
+			b1 = vaesmcq_u8(vaeseq_u8(b1, k[r]));
+			b2 = vaesmcq_u8(vaeseq_u8(b2, k[r]));
+			b3 = vaesmcq_u8(vaeseq_u8(b3, k[r]));
+		}
+		vst1q_u8(out, veorq_u8(vaeseq_u8(b0, k[13]), k[14]));
+		vst1q_u8(&out[16], veorq_u8(vaeseq_u8(b1, k[13]), k[14]));
+		vst1q_u8(&out[32], veorq_u8(vaeseq_u8(b2, k[13]), k[14]));
+		vst1q_u8(&out[48], veorq_u8(vaeseq_u8(b3, k[13]), k[14]));
+	}
+	for (; nblocks > 0; nblocks--, in += 16, out += 16) {
+		b0 = vld1q_u8(in);
+		for (r = 0; r < 13; r++)
+			b0 = vaesmcq_u8(vaeseq_u8(b0, k[r]));
+		vst1q_u8(out, veorq_u8(vaeseq_u8(b0, k[13]), k[14]));
+	}
+}
+
+AES_ARM_TARGET void
+aes_arm_decrypt(const unsigned char * dk, const uint8_t * in, uint8_t * out,
+    size_t nblocks)
+{
+	uint8x16_t k[15], b0, b1, b2, b3;
+	int r;
+
+	for (r = 0; r < 15; r++)
+		k[r] = vld1q_u8(&dk[16 * r]);
+
+	for (; nblocks >= 4; nblocks -= 4, in += 64, out += 64) {
+		b0 = vld1q_u8(in);
+		b1 = vld1q_u8(&in[16]);
+		b2 = vld1q_u8(&in[32]);
+		b3 = vld1q_u8(&in[48]);
+		for (r = 0; r < 13; r++) {
+			b0 = vaesimcq_u8(vaesdq_u8(b0, k[r]));
+			b1 = vaesimcq_u8(vaesdq_u8(b1, k[r]));
+			b2 = vaesimcq_u8(vaesdq_u8(b2, k[r]));
+			b3 = vaesimcq_u8(vaesdq_u8(b3, k[r]));
+		}
+		vst1q_u8(out, veorq_u8(vaesdq_u8(b0, k[13]), k[14]));
+		vst1q_u8(&out[16], veorq_u8(vaesdq_u8(b1, k[13]), k[14]));
+		vst1q_u8(&out[32], veorq_u8(vaesdq_u8(b2, k[13]), k[14]));
+		vst1q_u8(&out[48], veorq_u8(vaesdq_u8(b3, k[13]), k[14]));
+	}
+	for (; nblocks > 0; nblocks--, in += 16, out += 16) {
+		b0 = vld1q_u8(in);
+		for (r = 0; r < 13; r++)
+			b0 = vaesimcq_u8(vaesdq_u8(b0, k[r]));
+		vst1q_u8(out, veorq_u8(vaesdq_u8(b0, k[13]), k[14]));
+	}
+}
+
+/*
+ * Reversing the bits of each byte turns GHASH elements into ordinary
+ * little-endian polynomials, so PMULL works on them directly and the
+ * reduction is by x^128 + x^7 + x^2 + x + 1 without reflection.
+ */
+
+#define LANE0(x) vgetq_lane_u64(vreinterpretq_u64_u8(x), 0)
+#define LANE1(x) vgetq_lane_u64(vreinterpretq_u64_u8(x), 1)
+#define PMULL(a, b) vreinterpretq_u8_p128(vmull_p64((a), (b)))
+
+/**
+ * clmul(a, b, lo, hi):
+ * Accumulate the unreduced 256-bit carry-less product of a and b.
+ */
+AES_ARM_TARGET static void
+clmul(uint8x16_t a, uint8x16_t b, uint8x16_t * lo, uint8x16_t * hi)
+{
+	const uint8x16_t zero = vdupq_n_u8(0);
+	uint8x16_t mid = veorq_u8(PMULL(LANE0(a), LANE1(b)),
+	    PMULL(LANE1(a), LANE0(b)));
+
+	*lo = veorq_u8(*lo, veorq_u8(PMULL(LANE0(a), LANE0(b)),
+	    vextq_u8(zero, mid, 8)));
+	*hi = veorq_u8(*hi, veorq_u8(PMULL(LANE1(a), LANE1(b)),
+	    vextq_u8(mid, zero, 8)));
+}
+
+/**
+ * reduce(lo, hi):
+ * Fold the high 128 bits back down, using x^128 = x^7 + x^2 + x + 1.
+ */
+AES_ARM_TARGET static uint8x16_t
+reduce(uint8x16_t lo, uint8x16_t hi)
+{
+	const uint8x16_t zero = vdupq_n_u8(0);
+	uint8x16_t p0 = PMULL(LANE0(hi), 0x87);
+	uint8x16_t p1 = PMULL(LANE1(hi), 0x87);
+
+	/* The top few bits of p1 spill past x^128 and need one more fold. */
+	lo = veorq_u8(lo, p0);
+	lo = veorq_u8(lo, vextq_u8(zero, p1, 8));
+	return (veorq_u8(lo, PMULL(LANE1(p1), 0x87)));
+}
+
+AES_ARM_TARGET static uint8x16_t
+gfmul(uint8x16_t a, uint8x16_t b)
+{
+	uint8x16_t lo = vdupq_n_u8(0), hi = vdupq_n_u8(0);
+
+	clmul(a, b, &lo, &hi);
+	return (reduce(lo, hi));
+}
+
+AES_ARM_TARGET void
+aes_arm_ghash(const uint8_t H[16], uint8_t Y[16], const uint8_t * in,
+    size_t nblocks)
+{
+	uint8x16_t h1, h2, h3, h4, y, lo, hi;
+
+#define LOAD_BLOCK(p) vrbitq_u8(vld1q_u8(p))
+	h1 = LOAD_BLOCK(H);
+	y = LOAD_BLOCK(Y);
+
+	/* Four blocks at a time share a single reduction. */
+	if (nblocks >= 4) {
+		h2 = gfmul(h1, h1);
+		h3 = gfmul(h2, h1);
+		h4 = gfmul(h3, h1);
+		for (; nblocks >= 4; nblocks -= 4, in += 64) {
+			lo = hi = vdupq_n_u8(0);
+			clmul(veorq_u8(y, LOAD_BLOCK(in)), h4, &lo, &hi);
+			clmul(LOAD_BLOCK(&in[16]), h3, &lo, &hi);
+			clmul(LOAD_BLOCK(&in[32]), h2, &lo, &hi);
+			clmul(LOAD_BLOCK(&in[48]), h1, &lo, &hi);
+			y = reduce(lo, hi);
+		}
+	}
+	for (; nblocks > 0; nblocks--, in += 16)
+		y = gfmul(veorq_u8(y, LOAD_BLOCK(in)), h1);
+#undef LOAD_BLOCK
+
+	vst1q_u8(Y, vrbitq_u8(y));
+}
+
+#else
+
+int
+aes_arm_available(void)
+{
+
+	return (0);
+}
+
+void
+aes_arm_invert_keys(const unsigned char * ek, unsigned char * dk)
+{
+
+	(void)ek;
+	(void)dk;
+}
+
+void
+aes_arm_encrypt(const unsigned char * ek, const uint8_t * in, uint8_t * out,
+    size_t nblocks)
+{
+
+	(void)ek;
+	(void)in;
+	(void)out;
+	(void)nblocks;
+}
+
+void
+aes_arm_decrypt(const unsigned char * dk, const uint8_t * in, uint8_t * out,
+    size_t nblocks)
+{
+
+	(void)dk;
+	(void)in;
+	(void)out;
+	(void)nblocks;
+}
+
+void
+aes_arm_ghash(const uint8_t H[16], uint8_t Y[16], const uint8_t * in,
+    size_t nblocks)
+{
+
+	(void)H;
+	(void)Y;
+	(void)in;
+	(void)nblocks;
+}
+
+#endif
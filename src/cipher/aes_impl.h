@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _AES_IMPL_H_
+#define _AES_IMPL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Hardware back ends for aes.c. Each one works on the byte-form round
+ * keys from AES256_CTX, and has an _available() check that returns 0
+ * when the CPU or the compiler target lacks the instructions.
+ */
+
+int	aes_x86_available(void);
+void	aes_x86_invert_keys(const unsigned char *, unsigned char *);
+void	aes_x86_encrypt(const unsigned char *, const uint8_t *, uint8_t *,
+    size_t);
+void	aes_x86_decrypt(const unsigned char *, const uint8_t *, uint8_t *,
+    size_t);
+void	aes_x86_ghash(const uint8_t [16], uint8_t [16], const uint8_t *,
+    size_t);
+
+int	aes_arm_available(void);
+void	aes_arm_invert_keys(const unsigned char *, unsigned char *);
+void	aes_arm_encrypt(const unsigned char *, const uint8_t *, uint8_t *,
+    size_t);
+void	aes_arm_decrypt(const unsigned char *, const uint8_t *, uint8_t *,
+    size_t);
+void	aes_arm_ghash(const uint8_t [16], uint8_t [16], const uint8_t *,
+    size_t);
+
+#endif /* !_AES_IMPL_H_ */
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "aes_impl.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+/* Only these functions use the extensions, so the rest of the library
+ * still runs on older CPUs. */
+#define AES_X86_TARGET __attribute__((target("aes,pclmul,ssse3")))
+
+int
+aes_x86_available(void)
+{
+	static int available = -1;
+	unsigned int a, b, c, d;
+	int result = __atomic_load_n(&available, __ATOMIC_RELAXED);
+
+	if (result < 0) {
+		result = __get_cpuid(1, &a, &b, &c, &d) &&
+		    (c & bit_AES) && (c & bit_PCLMUL) && (c & bit_SSSE3);
+		__atomic_store_n(&available, result, __ATOMIC_RELAXED);
+	}
+	return (result);
+}
+
+AES_X86_TARGET void
+aes_x86_invert_keys(const unsigned char * ek, unsigned char * dk)
+{
+	int i;
+
+	/* The equivalent inverse cipher runs InvMixColumns over the keys. */
+	memcpy(dk, &ek[16 * 14], 16);
+	for (i = 1; i < 14; i++)
+		_mm_storeu_si128((__m128i *)&dk[16 * i], _mm_aesimc_si128(
+		    _mm_loadu_si128((const __m128i *)&ek[16 * (14 - i)])));
+	memcpy(&dk[16 * 14], ek, 16);
+}
+
+#define LOAD_KEYS(k, keys) do {						\
+	int r_;								\
+	for (r_ = 0; r_ < 15; r_++)					\
+		k[r_] = _mm_loadu_si128((const __m128i *)&keys[16 * r_]); \
+} while (0)
+
+AES_X86_TARGET void
+aes_x86_encrypt(const unsigned char * ek, const uint8_t * in, uint8_t * out,
+    size_t nblocks)
+{
+	__m128i k[15], b0, b1, b2, b3;
+	int r;
+
+	LOAD_KEYS(k, ek);
+
+	/* Four blocks at a time hides the instruction latency. */
+	for (; nblocks >= 4; nblocks -= 4, in += 64, out += 64) {
+		b0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in), k[0]);
+		b1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&in[16]), k[0]);
+		b2 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&in[32]), k[0]);
+		b3 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&in[48]), k[0]);
+		for (r = 1; r < 14; r++) {
+			b0 = _mm_aesenc_si128(b0, k[r]);
+			b1 = _mm_aesenc_si128(b1, k[r]);
+			b2 = _mm_aesenc_si128(b2, k[r]);
+			b3 = _mm_aesenc_si128(b3, k[r]);
+		}
+		_mm_storeu_si128((__m128i *)out, _mm_aesenclast_si128(b0, k[14]));
+		_mm_storeu_si128((__m128i *)&out[16], _mm_aesenclast_si128(b1, k[14]));
+		_mm_storeu_si128((__m128i *)&out[32], _mm_aesenclast_si128(b2, k[14]));
+		_mm_storeu_si128((__m128i *)&out[48], _mm_aesenclast_si128(b3, k[14]));
+	}
+	for (; nblocks > 0; nblocks--, in += 16, out += 16) {
+		b0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in), k[0]);
+		for (r = 1; r < 14; r++)
+			b0 = _mm_aesenc_si128(b0, k[r]);
+		_mm_storeu_si128((__m128i *)out, _mm_aesenclast_si128(b0, k[14]));
+	}
+}
+
+AES_X86_TARGET void
+aes_x86_decrypt(const unsigned char * dk, const uint8_t * in, uint8_t * out,
+    size_t nblocks)
+{
+	__m128i k[15], b0, b1, b2, b3;
+	int r;
+
+	LOAD_KEYS(k, dk);
+
+	for (; nblocks >= 4; nblocks -= 4, in += 64, out += 64) {
+		b0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in), k[0]);
+		b1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&in[16]), k[0]);
+		b2 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&in[32]), k[0]);
+		b3 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&in[48]), k[0]);
+		for (r = 1; r < 14; r++) {
+			b0 = _mm_aesdec_si128(b0, k[r]);
+			b1 = _mm_aesdec_si128(b1, k[r]);
+			b2 = _mm_aesdec_si128(b2, k[r]);
+			b3 = _mm_aesdec_si128(b3, k[r]);
+		}
+		_mm_storeu_si128((__m128i *)out, _mm_aesdeclast_si128(b0, k[14]));
+		_mm_storeu_si128((__m128i *)&out[16], _mm_aesdeclast_si128(b1, k[14]));
+		_mm_storeu_si128((__m128i *)&out[32], _mm_aesdeclast_si128(b2, k[14]));
+		_mm_storeu_si128((__m128i *)&out[48], _mm_aesdeclast_si128(b3, k[14]));
+	}
+	for (; nblocks > 0; nblocks--, in += 16, out += 16) {
+		b0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in), k[0]);
+		for (r = 1; r < 14; r++)
+			b0 = _mm_aesdec_si128(b0, k[r]);
+		_mm_storeu_si128((__m128i *)out, _mm_aesdeclast_si128(b0, k[14]));
+	}
+}
+
+/**
+ * clmul(a, b, lo, hi):
+ * Accumulate the unreduced 256-bit carry-less product of a and b.
+ */
+AES_X86_TARGET static void
+clmul(__m128i a, __m128i b, __m128i * lo, __m128i * hi)
+{
+	__m128i mid = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x10),
+	    _mm_clmulepi64_si128(a, b, 0x01));
+
+	*lo = _mm_xor_si128(*lo, _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x00),
+	    _mm_slli_si128(mid, 8)));
+	*hi = _mm_xor_si128(*hi, _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x11),
+	    _mm_srli_si128(mid, 8)));
+}
+
+/**
+ * reduce(lo, hi):
+ * Reduce a 256-bit product of byte-reversed GHASH elements. The bits
+ * are reflected, so the product first shifts left by one.
+ */
+AES_X86_TARGET static __m128i
+reduce(__m128i lo, __m128i hi)
+{
+	__m128i t0, t1, t2;
+
+	/* Shift the 256-bit value left by one bit. */
+	t0 = _mm_srli_epi32(lo, 31);
+	t1 = _mm_srli_epi32(hi, 31);
+	lo = _mm_slli_epi32(lo, 1);
+	hi = _mm_slli_epi32(hi, 1);
+	t2 = _mm_srli_si128(t0, 12);
+	t1 = _mm_slli_si128(t1, 4);
+	t0 = _mm_slli_si128(t0, 4);
+	lo = _mm_or_si128(lo, t0);
+	hi = _mm_or_si128(_mm_or_si128(hi, t1), t2);
+
+	/* Fold the low half into the high half. */
+	t0 = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(lo, 31),
+	    _mm_slli_epi32(lo, 30)), _mm_slli_epi32(lo, 25));
+	t1 = _mm_srli_si128(t0, 4);
+	t0 = _mm_slli_si128(t0, 12);
+	lo = _mm_xor_si128(lo, t0);
+	t2 = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(lo, 1),
+	    _mm_srli_epi32(lo, 2)), _mm_srli_epi32(lo, 7));
+	t2 = _mm_xor_si128(t2, t1);
+	lo = _mm_xor_si128(lo, t2);
+	return (_mm_xor_si128(hi, lo));
+}
+
+AES_X86_TARGET static __m128i
+gfmul(__m128i a, __m128i b)
+{
+	__m128i lo = _mm_setzero_si128(), hi = _mm_setzero_si128();
+
+	clmul(a, b, &lo, &hi);
+	return (reduce(lo, hi));
+}
+
+AES_X86_TARGET void
+aes_x86_ghash(const uint8_t H[16], uint8_t Y[16], const uint8_t * in,
+    size_t nblocks)
+{
+	const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+	    11, 12, 13, 14, 15);
+	__m128i h1, h2, h3, h4, y, lo, hi;
+
+#define LOAD_BLOCK(p) _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(p)), bswap)
+	h1 = LOAD_BLOCK(H);
+	y = LOAD_BLOCK(Y);
+
+	/* Four blocks at a time share a single reduction. */
+	if (nblocks >= 4) {
+		h2 = gfmul(h1, h1);
+		h3 = gfmul(h2, h1);
+		h4 = gfmul(h3, h1);
+		for (; nblocks >= 4; nblocks -= 4, in += 64) {
+			lo = hi = _mm_setzero_si128();
+			clmul(_mm_xor_si128(y, LOAD_BLOCK(in)), h4, &lo, &hi);
+			clmul(LOAD_BLOCK(&in[16]), h3, &lo, &hi);
+			clmul(LOAD_BLOCK(&in[32]), h2, &lo, &hi);
+			clmul(LOAD_BLOCK(&in[48]), h1, &lo, &hi);
+			y = reduce(lo, hi);
+		}
+	}
+	for (; nblocks > 0; nblocks--, in += 16)
+		y = gfmul(_mm_xor_si128(y, LOAD_BLOCK(in)), h1);
+#undef LOAD_BLOCK
+
+	_mm_storeu_si128((__m128i *)Y, _mm_shuffle_epi8(y, bswap));
+}
+
+#else
+
+int
+aes_x86_available(void)
+{
+
+	return (0);
+}
+
+void
+aes_x86_invert_keys(const unsigned char * ek, unsigned char * dk)
+{
+
+	(void)ek;
+	(void)dk;
+}
+
+void
+aes_x86_encrypt(const unsigned char * ek, const uint8_t * in, uint8_t * out,
+    size_t nblocks)
+{
+
+	(void)ek;
+	(void)in;
+	(void)out;
+	(void)nblocks;
+}
+
+void
+aes_x86_decrypt(const unsigned char * dk, const uint8_t * in, uint8_t * out,
+    size_t nblocks)
+{
+
+	(void)dk;
+	(void)in;
+	(void)out;
+	(void)nblocks;
+}
+
+void
+aes_x86_ghash(const uint8_t H[16], uint8_t Y[16], const uint8_t * in,
+    size_t nblocks)
+{
+
+	(void)H;
+	(void)Y;
+	(void)in;
+	(void)nblocks;
+}
+
+#endif
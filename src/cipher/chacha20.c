@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../scrypt/sysendian.h"
+
+#include "chacha20.h"
+#include "chacha20_impl.h"
+
+#define ROTL32(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define QUARTERROUND(a, b, c, d) do {					\
+	a += b; d ^= a; d = ROTL32(d, 16);				\
+	c += d; b ^= c; b = ROTL32(b, 12);				\
+	a += b; d ^= a; d = ROTL32(d, 8);				\
+	c += d; b ^= c; b = ROTL32(b, 7);				\
+} while (0)
+
+/**
+ * chacha20_rounds(x):
+ * Run the 20 ChaCha rounds over x in place.
+ */
+static void
+chacha20_rounds(uint32_t x[16])
+{
+	int i;
+
+	for (i = 0; i < 10; i++) {
+		QUARTERROUND(x[0], x[4], x[8], x[12]);
+		QUARTERROUND(x[1], x[5], x[9], x[13]);
+		QUARTERROUND(x[2], x[6], x[10], x[14]);
+		QUARTERROUND(x[3], x[7], x[11], x[15]);
+		QUARTERROUND(x[0], x[5], x[10], x[15]);
+		QUARTERROUND(x[1], x[6], x[11], x[12]);
+		QUARTERROUND(x[2], x[7], x[8], x[13]);
+		QUARTERROUND(x[3], x[4], x[9], x[14]);
+	}
+}
+
+/**
+ * chacha20_block(state, keystream):
+ * Produce one block of keystream and advance the counter.
+ */
+static void
+chacha20_block(uint32_t state[16], uint8_t keystream[64])
+{
+	uint32_t x[16];
+	int i;
+
+	memcpy(x, state, sizeof(x));
+	chacha20_rounds(x);
+	for (i = 0; i < 16; i++)
+		le32enc(&keystream[4 * i], x[i] + state[i]);
+	state[12]++;
+
+	/* Clean the stack. */
+	memset(x, 0, sizeof(x));
+}
+
+/**
+ * chacha20_blocks(impl, state, in, out, nblocks):
+ * XOR nblocks whole blocks of keystream, using the widest kernel
+ * available and the portable code for whatever it leaves over.
+ */
+static void
+chacha20_blocks(int impl, uint32_t state[16], const uint8_t * in,
+    uint8_t * out, size_t nblocks)
+{
+	uint8_t keystream[64];
+	size_t done = 0;
+	int i;
+
+	switch (impl) {
+	case CHACHA20_IMPL_AVX2:
+		done = chacha20_avx2_blocks(state, in, out, nblocks);
+		done += chacha20_sse2_blocks(state, &in[64 * done],
+		    &out[64 * done], nblocks - done);
+		break;
+	case CHACHA20_IMPL_SSE2:
+		done = chacha20_sse2_blocks(state, in, out, nblocks);
+		break;
+	case CHACHA20_IMPL_NEON:
+		done = chacha20_neon_blocks(state, in, out, nblocks);
+		break;
+	}
+
+	for (in += 64 * done, out += 64 * done; done < nblocks;
+	    done++, in += 64, out += 64) {
+		chacha20_block(state, keystream);
+		for (i = 0; i < 64; i++)
+			out[i] = in[i] ^ keystream[i];
+	}
+
+	/* Clean the stack. */
+	memset(keystream, 0, sizeof(keystream));
+}
+
+/* Implementation selection. */
+static int chacha20_forced = CHACHA20_IMPL_AUTO;
+
+static int
+chacha20_available(int impl)
+{
+
+	switch (impl) {
+	case CHACHA20_IMPL_PORTABLE:
+		return (1);
+	case CHACHA20_IMPL_SSE2:
+		return (chacha20_sse2_available());
+	case CHACHA20_IMPL_AVX2:
+		return (chacha20_avx2_available());
+	case CHACHA20_IMPL_NEON:
+		return (chacha20_neon_available());
+	default:
+		return (0);
+	}
+}
+
+int
+ChaCha20_SetImplementation(int impl)
+{
+
+	if (impl != CHACHA20_IMPL_AUTO && !chacha20_available(impl))
+		return (-1);
+	__atomic_store_n(&chacha20_forced, impl, __ATOMIC_RELAXED);
+	return (0);
+}
+
+int
+ChaCha20_GetImplementation(void)
+{
+	int impl = __atomic_load_n(&chacha20_forced, __ATOMIC_RELAXED);
+
+	if (impl != CHACHA20_IMPL_AUTO)
+		return (impl);
+	if (chacha20_avx2_available())
+		return (CHACHA20_IMPL_AVX2);
+	if (chacha20_sse2_available())
+		return (CHACHA20_IMPL_SSE2);
+	if (chacha20_neon_available())
+		return (CHACHA20_IMPL_NEON);
+	return (CHACHA20_IMPL_PORTABLE);
+}
+
+/**
+ * chacha20_setup(state, key):
+ * Fill in the constant and key words of a ChaCha20 state.
+ */
+static void
+chacha20_setup(uint32_t state[16], const uint8_t key[32])
+{
+	int i;
+
+	/* "expand 32-byte k" */
+	state[0] = 0x61707865;
+	state[1] = 0x3320646e;
+	state[2] = 0x79622d32;
+	state[3] = 0x6b206574;
+	for (i = 0; i < 8; i++)
+		state[4 + i] = le32dec(&key[4 * i]);
+}
+
+void
+ChaCha20_Init(CHACHA20_CTX * ctx, const uint8_t key[32],
+    const uint8_t nonce[12], uint32_t counter)
+{
+
+	chacha20_setup(ctx->state, key);
+	ctx->state[12] = counter;
+	ctx->state[13] = le32dec(&nonce[0]);
+	ctx->state[14] = le32dec(&nonce[4]);
+	ctx->state[15] = le32dec(&nonce[8]);
+	ctx->used = 64;
+	ctx->impl = ChaCha20_GetImplementation();
+}
+
+void
+ChaCha20_XOR(CHACHA20_CTX * ctx, const uint8_t * in, uint8_t * out,
+    size_t len)
+{
+	size_t nblocks;
+
+	/* Use up any keystream left over from last time. */
+	for (; len > 0 && ctx->used < 64; len--)
+		*out++ = *in++ ^ ctx->keystream[ctx->used++];
+
+	/* Process whole blocks straight from the input. */
+	nblocks = len / 64;
+	chacha20_blocks(ctx->impl, ctx->state, in, out, nblocks);
+	in += 64 * nblocks;
+	out += 64 * nblocks;
+	len -= 64 * nblocks;
+
+	/* Save the rest of a final partial block for next time. */
+	if (len > 0) {
+		chacha20_block(ctx->state, ctx->keystream);
+		for (ctx->used = 0; ctx->used < len; ctx->used++)
+			out[ctx->used] = in[ctx->used] ^
+			    ctx->keystream[ctx->used];
+	}
+}
+
+void
+ChaCha20_Clear(CHACHA20_CTX * ctx)
+{
+
+	memset(ctx, 0, sizeof(*ctx));
+}
+
+void
+HChaCha20(const uint8_t key[32], const uint8_t nonce[16], uint8_t subkey[32])
+{
+	uint32_t x[16];
+	int i;
+
+	chacha20_setup(x, key);
+	for (i = 0; i < 4; i++)
+		x[12 + i] = le32dec(&nonce[4 * i]);
+	chacha20_rounds(x);
+
+	/* The subkey is the first and last rows, without the feed-forward. */
+	for (i = 0; i < 4; i++) {
+		le32enc(&subkey[4 * i], x[i]);
+		le32enc(&subkey[16 + 4 * i], x[12 + i]);
+	}
+
+	/* Clean the stack. */
+	memset(x, 0, sizeof(x));
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _CHACHA20_H_
+#define _CHACHA20_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/* Keystream implementations, for ChaCha20_SetImplementation. */
+#define CHACHA20_IMPL_AUTO	0
+#define CHACHA20_IMPL_PORTABLE	1
+#define CHACHA20_IMPL_SSE2	2
+#define CHACHA20_IMPL_AVX2	3
+#define CHACHA20_IMPL_NEON	4
+
+typedef struct ChaCha20Context {
+	uint32_t state[16];
+
+	/* Keystream left over from the last partial block. */
+	uint8_t keystream[64];
+	size_t used;
+
+	int impl;
+} CHACHA20_CTX;
+
+/**
+ * ChaCha20_SetImplementation(impl):
+ * Force a particular implementation for contexts created after this
+ * call, or go back to picking the fastest with CHACHA20_IMPL_AUTO.
+ * Return 0 on success, or -1 if this CPU lacks the implementation.
+ */
+int	ChaCha20_SetImplementation(int);
+
+/**
+ * ChaCha20_GetImplementation():
+ * Return the implementation new contexts will use.
+ */
+int	ChaCha20_GetImplementation(void);
+
+/**
+ * ChaCha20_Init(ctx, key, nonce, counter):
+ * Set up the RFC 8439 cipher, with a 96-bit nonce and 32-bit block
+ * counter. A single nonce covers at most 2^32 blocks (256 GiB).
+ */
+void	ChaCha20_Init(CHACHA20_CTX *, const uint8_t [32], const uint8_t [12],
+    uint32_t);
+
+/**
+ * ChaCha20_XOR(ctx, in, out, len):
+ * XOR the next len bytes of keystream into in[0 .. len - 1]. Calls may
+ * use any lengths, and in may equal out.
+ */
+void	ChaCha20_XOR(CHACHA20_CTX *, const uint8_t *, uint8_t *, size_t);
+
+void	ChaCha20_Clear(CHACHA20_CTX *);
+
+/**
+ * HChaCha20(key, nonce, subkey):
+ * Derive the XChaCha20 subkey from a key and the first 16 bytes of a
+ * 24-byte nonce.
+ */
+void	HChaCha20(const uint8_t [32], const uint8_t [16], uint8_t [32]);
+
+#endif /* !_CHACHA20_H_ */
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "chacha20_impl.h"
+
+#if defined(__ARM_NEON)
+
+#include <arm_neon.h>
+
+/*
+ * NEON is part of the baseline on arm64, and every Android armv7 ABI
+ * we build for, so this needs no runtime check. Like the x86 kernels,
+ * this keeps word i of four blocks side by side in x[i].
+ */
+
+#define ROTL(v, n) vsriq_n_u32(vshlq_n_u32(v, n), v, 32 - (n))
+#define ROTL16(v) vreinterpretq_u32_u16(vrev32q_u16(vreinterpretq_u16_u32(v)))
+
+#define QUARTERROUND(a, b, c, d) do {					\
+	a = vaddq_u32(a, b); d = veorq_u32(d, a); d = ROTL16(d);	\
+	c = vaddq_u32(c, d); b = veorq_u32(b, c); b = ROTL(b, 12);	\
+	a = vaddq_u32(a, b); d = veorq_u32(d, a); d = ROTL(d, 8);	\
+	c = vaddq_u32(c, d); b = veorq_u32(b, c); b = ROTL(b, 7);	\
+} while (0)
+
+int
+chacha20_neon_available(void)
+{
+
+	return (1);
+}
+
+size_t
+chacha20_neon_blocks(uint32_t state[16], const uint8_t * in, uint8_t * out,
+    size_t nblocks)
+{
+	static const uint32_t lanes[4] = { 0, 1, 2, 3 };
+	uint32x4_t s[16], x[16], r[4];
+	uint32x4x2_t t01, t23;
+	size_t done;
+	uint8_t * o;
+	const uint8_t * p;
+	int i, g, k;
+
+	for (i = 0; i < 16; i++)
+		s[i] = vdupq_n_u32(state[i]);
+
+	for (done = 0; done + 4 <= nblocks; done += 4, in += 256, out += 256) {
+		/* Each lane runs its own block counter. */
+		s[12] = vaddq_u32(vdupq_n_u32(state[12]), vld1q_u32(lanes));
+		memcpy(x, s, sizeof(x));
+		for (i = 0; i < 10; i++) {
+			QUARTERROUND(x[0], x[4], x[8], x[12]);
+			QUARTERROUND(x[1], x[5], x[9], x[13]);
+			QUARTERROUND(x[2], x[6], x[10], x[14]);
+			QUARTERROUND(x[3], x[7], x[11], x[15]);
+			QUARTERROUND(x[0], x[5], x[10], x[15]);
+			QUARTERROUND(x[1], x[6], x[11], x[12]);
+			QUARTERROUND(x[2], x[7], x[8], x[13]);
+			QUARTERROUND(x[3], x[4], x[9], x[14]);
+		}
+		for (i = 0; i < 16; i++)
+			x[i] = vaddq_u32(x[i], s[i]);
+
+		/* Row g of the state is bytes 16g to 16g + 15 of each block. */
+		for (g = 0; g < 4; g++) {
+			t01 = vtrnq_u32(x[4 * g], x[4 * g + 1]);
+			t23 = vtrnq_u32(x[4 * g + 2], x[4 * g + 3]);
+			r[0] = vcombine_u32(vget_low_u32(t01.val[0]),
+			    vget_low_u32(t23.val[0]));
+			r[1] = vcombine_u32(vget_low_u32(t01.val[1]),
+			    vget_low_u32(t23.val[1]));
+			r[2] = vcombine_u32(vget_high_u32(t01.val[0]),
+			    vget_high_u32(t23.val[0]));
+			r[3] = vcombine_u32(vget_high_u32(t01.val[1]),
+			    vget_high_u32(t23.val[1]));
+			for (k = 0; k < 4; k++) {
+				p = &in[64 * k + 16 * g];
+				o = &out[64 * k + 16 * g];
+				vst1q_u8(o, veorq_u8(vld1q_u8(p),
+				    vreinterpretq_u8_u32(r[k])));
+			}
+		}
+		state[12] += 4;
+	}
+
+	/* Clean the stack. */
+	memset(s, 0, sizeof(s));
+	memset(x, 0, sizeof(x));
+	memset(r, 0, sizeof(r));
+	return (done);
+}
+
+#else
+
+int
+chacha20_neon_available(void)
+{
+
+	return (0);
+}
+
+size_t
+chacha20_neon_blocks(uint32_t state[16], const uint8_t * in, uint8_t * out,
+    size_t nblocks)
+{
+
+	(void)state;
+	(void)in;
+	(void)out;
+	(void)nblocks;
+	return (0);
+}
+
+#endif
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _CHACHA20_IMPL_H_
+#define _CHACHA20_IMPL_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/*
+ * Multi-block keystream kernels. Each one XORs as many whole 64-byte
+ * blocks as fit its width, advances the counter in state[12], and
+ * returns the number of blocks it handled. The caller finishes off
+ * the rest. The *_available functions report whether this CPU can run
+ * the kernel; kernels for other architectures are stubs.
+ */
+
+int	chacha20_sse2_available(void);
+int	chacha20_avx2_available(void);
+int	chacha20_neon_available(void);
+
+size_t	chacha20_sse2_blocks(uint32_t [16], const uint8_t *, uint8_t *, size_t);
+size_t	chacha20_avx2_blocks(uint32_t [16], const uint8_t *, uint8_t *, size_t);
+size_t	chacha20_neon_blocks(uint32_t [16], const uint8_t *, uint8_t *, size_t);
+
+#endif /* !_CHACHA20_IMPL_H_ */
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "chacha20_impl.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+/* Only these functions use the extensions, so the rest of the library
+ * still runs on older CPUs. */
+#define CHACHA20_SSE2_TARGET __attribute__((target("sse2")))
+#define CHACHA20_AVX2_TARGET __attribute__((target("avx2")))
+
+/*
+ * Both kernels keep word i of several blocks side by side in vector
+ * x[i], so the rounds run on every block at once. Afterwards, a 4x4
+ * transpose of each row of the state turns the words back into
+ * keystream bytes.
+ */
+
+#define QUARTERROUND(ADD, XOR, ROTL16, ROTL12, ROTL8, ROTL7, a, b, c, d) do { \
+	a = ADD(a, b); d = XOR(d, a); d = ROTL16(d);			\
+	c = ADD(c, d); b = XOR(b, c); b = ROTL12(b);			\
+	a = ADD(a, b); d = XOR(d, a); d = ROTL8(d);			\
+	c = ADD(c, d); b = XOR(b, c); b = ROTL7(b);			\
+} while (0)
+
+#define DOUBLEROUND(QR, x) do {						\
+	QR(x[0], x[4], x[8], x[12]);					\
+	QR(x[1], x[5], x[9], x[13]);					\
+	QR(x[2], x[6], x[10], x[14]);					\
+	QR(x[3], x[7], x[11], x[15]);					\
+	QR(x[0], x[5], x[10], x[15]);					\
+	QR(x[1], x[6], x[11], x[12]);					\
+	QR(x[2], x[7], x[8], x[13]);					\
+	QR(x[3], x[4], x[9], x[14]);					\
+} while (0)
+
+int
+chacha20_sse2_available(void)
+{
+	static int available = -1;
+	unsigned int a, b, c, d;
+	int result = __atomic_load_n(&available, __ATOMIC_RELAXED);
+
+	if (result < 0) {
+		result = __get_cpuid(1, &a, &b, &c, &d) && (d & bit_SSE2);
+		__atomic_store_n(&available, result, __ATOMIC_RELAXED);
+	}
+	return (result);
+}
+
+int
+chacha20_avx2_available(void)
+{
+	static int available = -1;
+	unsigned int a, b, c, d, xcr0, xcr0_hi;
+	int result = __atomic_load_n(&available, __ATOMIC_RELAXED);
+
+	if (result < 0) {
+		result = 0;
+
+		/* The OS has to save the YMM registers, as well. */
+		if (__get_cpuid(1, &a, &b, &c, &d) && (c & bit_OSXSAVE) &&
+		    (c & bit_AVX) && __get_cpuid_max(0, NULL) >= 7) {
+			__asm__ ("xgetbv" : "=a" (xcr0), "=d" (xcr0_hi) : "c" (0));
+			__cpuid_count(7, 0, a, b, c, d);
+			result = ((xcr0 & 6) == 6) && (b & bit_AVX2);
+		}
+		__atomic_store_n(&available, result, __ATOMIC_RELAXED);
+	}
+	return (result);
+}
+
+#define SSE2_ROTL(v, n)							\
+	_mm_or_si128(_mm_slli_epi32(v, n), _mm_srli_epi32(v, 32 - (n)))
+#define SSE2_ROTL16(v) SSE2_ROTL(v, 16)
+#define SSE2_ROTL12(v) SSE2_ROTL(v, 12)
+#define SSE2_ROTL8(v) SSE2_ROTL(v, 8)
+#define SSE2_ROTL7(v) SSE2_ROTL(v, 7)
+#define SSE2_QR(a, b, c, d)						\
+	QUARTERROUND(_mm_add_epi32, _mm_xor_si128, SSE2_ROTL16,		\
+	    SSE2_ROTL12, SSE2_ROTL8, SSE2_ROTL7, a, b, c, d)
+
+CHACHA20_SSE2_TARGET size_t
+chacha20_sse2_blocks(uint32_t state[16], const uint8_t * in, uint8_t * out,
+    size_t nblocks)
+{
+	__m128i s[16], x[16], t0, t1, t2, t3, r[4];
+	size_t done;
+	int i, g, k;
+
+	for (i = 0; i < 16; i++)
+		s[i] = _mm_set1_epi32((int)state[i]);
+
+	for (done = 0; done + 4 <= nblocks; done += 4, in += 256, out += 256) {
+		/* Each lane runs its own block counter. */
+		s[12] = _mm_add_epi32(_mm_set1_epi32((int)state[12]),
+		    _mm_set_epi32(3, 2, 1, 0));
+		memcpy(x, s, sizeof(x));
+		for (i = 0; i < 10; i++)
+			DOUBLEROUND(SSE2_QR, x);
+		for (i = 0; i < 16; i++)
+			x[i] = _mm_add_epi32(x[i], s[i]);
+
+		/* Row g of the state is bytes 16g to 16g + 15 of each block. */
+		for (g = 0; g < 4; g++) {
+			t0 = _mm_unpacklo_epi32(x[4 * g], x[4 * g + 1]);
+			t1 = _mm_unpacklo_epi32(x[4 * g + 2], x[4 * g + 3]);
+			t2 = _mm_unpackhi_epi32(x[4 * g], x[4 * g + 1]);
+			t3 = _mm_unpackhi_epi32(x[4 * g + 2], x[4 * g + 3]);
+			r[0] = _mm_unpacklo_epi64(t0, t1);
+			r[1] = _mm_unpackhi_epi64(t0, t1);
+			r[2] = _mm_unpacklo_epi64(t2, t3);
+			r[3] = _mm_unpackhi_epi64(t2, t3);
+			for (k = 0; k < 4; k++)
+				_mm_storeu_si128((__m128i *)&out[64 * k + 16 * g],
+				    _mm_xor_si128(r[k], _mm_loadu_si128(
+				    (const __m128i *)&in[64 * k + 16 * g])));
+		}
+		state[12] += 4;
+	}
+
+	/* Clean the stack. */
+	memset(s, 0, sizeof(s));
+	memset(x, 0, sizeof(x));
+	return (done);
+}
+
+/* Byte shuffles are faster than shifts for the whole-byte rotations. */
+#define AVX2_ROTL(v, n)							\
+	_mm256_or_si256(_mm256_slli_epi32(v, n), _mm256_srli_epi32(v, 32 - (n)))
+#define AVX2_ROTL16(v) _mm256_shuffle_epi8(v, rot16)
+#define AVX2_ROTL12(v) AVX2_ROTL(v, 12)
+#define AVX2_ROTL8(v) _mm256_shuffle_epi8(v, rot8)
+#define AVX2_ROTL7(v) AVX2_ROTL(v, 7)
+#define AVX2_QR(a, b, c, d)						\
+	QUARTERROUND(_mm256_add_epi32, _mm256_xor_si256, AVX2_ROTL16,	\
+	    AVX2_ROTL12, AVX2_ROTL8, AVX2_ROTL7, a, b, c, d)
+
+#define AVX2_XOR_STORE(p, q, v)						\
+	_mm256_storeu_si256((__m256i *)(p), _mm256_xor_si256(v,	\
+	    _mm256_loadu_si256((const __m256i *)(q))))
+
+CHACHA20_AVX2_TARGET size_t
+chacha20_avx2_blocks(uint32_t state[16], const uint8_t * in, uint8_t * out,
+    size_t nblocks)
+{
+	const __m256i rot16 = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5,
+	    10, 11, 8, 9, 14, 15, 12, 13, 2, 3, 0, 1, 6, 7, 4, 5,
+	    10, 11, 8, 9, 14, 15, 12, 13);
+	const __m256i rot8 = _mm256_setr_epi8(3, 0, 1, 2, 7, 4, 5, 6,
+	    11, 8, 9, 10, 15, 12, 13, 14, 3, 0, 1, 2, 7, 4, 5, 6,
+	    11, 8, 9, 10, 15, 12, 13, 14);
+	__m256i s[16], x[16], t0, t1, t2, t3, r[4][4];
+	size_t done;
+	int i, g, k;
+
+	for (i = 0; i < 16; i++)
+		s[i] = _mm256_set1_epi32((int)state[i]);
+
+	for (done = 0; done + 8 <= nblocks; done += 8, in += 512, out += 512) {
+		s[12] = _mm256_add_epi32(_mm256_set1_epi32((int)state[12]),
+		    _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+		memcpy(x, s, sizeof(x));
+		for (i = 0; i < 10; i++)
+			DOUBLEROUND(AVX2_QR, x);
+		for (i = 0; i < 16; i++)
+			x[i] = _mm256_add_epi32(x[i], s[i]);
+
+		/*
+		 * Transposing within each 128-bit half leaves row g of
+		 * block k in the low half of r[g][k], and row g of block
+		 * k + 4 in the high half.
+		 */
+		for (g = 0; g < 4; g++) {
+			t0 = _mm256_unpacklo_epi32(x[4 * g], x[4 * g + 1]);
+			t1 = _mm256_unpacklo_epi32(x[4 * g + 2], x[4 * g + 3]);
+			t2 = _mm256_unpackhi_epi32(x[4 * g], x[4 * g + 1]);
+			t3 = _mm256_unpackhi_epi32(x[4 * g + 2], x[4 * g + 3]);
+			r[g][0] = _mm256_unpacklo_epi64(t0, t1);
+			r[g][1] = _mm256_unpackhi_epi64(t0, t1);
+			r[g][2] = _mm256_unpacklo_epi64(t2, t3);
+			r[g][3] = _mm256_unpackhi_epi64(t2, t3);
+		}
+		for (k = 0; k < 4; k++) {
+			AVX2_XOR_STORE(&out[64 * k], &in[64 * k],
+			    _mm256_permute2x128_si256(r[0][k], r[1][k], 0x20));
+			AVX2_XOR_STORE(&out[64 * k + 32], &in[64 * k + 32],
+			    _mm256_permute2x128_si256(r[2][k], r[3][k], 0x20));
+			AVX2_XOR_STORE(&out[64 * k + 256], &in[64 * k + 256],
+			    _mm256_permute2x128_si256(r[0][k], r[1][k], 0x31));
+			AVX2_XOR_STORE(&out[64 * k + 288], &in[64 * k + 288],
+			    _mm256_permute2x128_si256(r[2][k], r[3][k], 0x31));
+		}
+		state[12] += 8;
+	}
+
+	/* Clean the stack. */
+	memset(s, 0, sizeof(s));
+	memset(x, 0, sizeof(x));
+	memset(r, 0, sizeof(r));
+	return (done);
+}
+
+#else
+
+int
+chacha20_sse2_available(void)
+{
+
+	return (0);
+}
+
+int
+chacha20_avx2_available(void)
+{
+
+	return (0);
+}
+
+size_t
+chacha20_sse2_blocks(uint32_t state[16], const uint8_t * in, uint8_t * out,
+    size_t nblocks)
+{
+
+	(void)state;
+	(void)in;
+	(void)out;
+	(void)nblocks;
+	return (0);
+}
+
+size_t
+chacha20_avx2_blocks(uint32_t state[16], const uint8_t * in, uint8_t * out,
+    size_t nblocks)
+{
+
+	(void)state;
+	(void)in;
+	(void)out;
+	(void)nblocks;
+	return (0);
+}
+
+#endif
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../scrypt/sysendian.h"
+
+#include "chacha20poly1305.h"
+
+static const uint8_t zeros[16];
+
+/**
+ * chacha20poly1305_start(ctx, key, nonce):
+ * Take the Poly1305 key from block 0, leaving the cipher at block 1.
+ */
+static void
+chacha20poly1305_start(CHACHA20POLY1305_CTX * ctx, const uint8_t key[32],
+    const uint8_t nonce[12])
+{
+	uint8_t polykey[64];
+
+	memset(polykey, 0, sizeof(polykey));
+	ChaCha20_Init(&ctx->chacha, key, nonce, 0);
+	ChaCha20_XOR(&ctx->chacha, polykey, polykey, sizeof(polykey));
+	Poly1305_Init(&ctx->poly, polykey);
+	ctx->aadlen = 0;
+	ctx->datalen = 0;
+
+	/* Clean the stack. */
+	memset(polykey, 0, sizeof(polykey));
+}
+
+void
+ChaCha20Poly1305_Init(CHACHA20POLY1305_CTX * ctx, const uint8_t key[32],
+    const uint8_t nonce[12])
+{
+
+	chacha20poly1305_start(ctx, key, nonce);
+}
+
+void
+XChaCha20Poly1305_Init(CHACHA20POLY1305_CTX * ctx, const uint8_t key[32],
+    const uint8_t nonce[24])
+{
+	uint8_t subkey[32];
+	uint8_t subnonce[12];
+
+	/* The last 8 nonce bytes go with the subkey, after 4 zero bytes. */
+	HChaCha20(key, nonce, subkey);
+	memset(subnonce, 0, 4);
+	memcpy(&subnonce[4], &nonce[16], 8);
+	chacha20poly1305_start(ctx, subkey, subnonce);
+
+	/* Clean the stack. */
+	memset(subkey, 0, sizeof(subkey));
+}
+
+void
+ChaCha20Poly1305_AAD(CHACHA20POLY1305_CTX * ctx, const uint8_t * aad,
+    size_t len)
+{
+
+	Poly1305_Update(&ctx->poly, aad, len);
+	ctx->aadlen += len;
+}
+
+/**
+ * chacha20poly1305_pad(ctx, len):
+ * Pad the MAC input out to a multiple of 16 bytes, given that len
+ * bytes have gone in since the last padding.
+ */
+static void
+chacha20poly1305_pad(CHACHA20POLY1305_CTX * ctx, uint64_t len)
+{
+
+	if (len % 16 != 0)
+		Poly1305_Update(&ctx->poly, zeros, 16 - len % 16);
+}
+
+void
+ChaCha20Poly1305_Encrypt(CHACHA20POLY1305_CTX * ctx, const uint8_t * in,
+    uint8_t * out, size_t len)
+{
+
+	if (ctx->datalen == 0 && len > 0)
+		chacha20poly1305_pad(ctx, ctx->aadlen);
+	ChaCha20_XOR(&ctx->chacha, in, out, len);
+	Poly1305_Update(&ctx->poly, out, len);
+	ctx->datalen += len;
+}
+
+void
+ChaCha20Poly1305_Decrypt(CHACHA20POLY1305_CTX * ctx, const uint8_t * in,
+    uint8_t * out, size_t len)
+{
+
+	if (ctx->datalen == 0 && len > 0)
+		chacha20poly1305_pad(ctx, ctx->aadlen);
+
+	/* MAC the ciphertext first, in case in and out are the same. */
+	Poly1305_Update(&ctx->poly, in, len);
+	ChaCha20_XOR(&ctx->chacha, in, out, len);
+	ctx->datalen += len;
+}
+
+void
+ChaCha20Poly1305_Final(CHACHA20POLY1305_CTX * ctx, uint8_t tag[16])
+{
+	uint8_t lengths[16];
+
+	/* With no data, the padding after the AAD has not happened yet. */
+	if (ctx->datalen == 0)
+		chacha20poly1305_pad(ctx, ctx->aadlen);
+	chacha20poly1305_pad(ctx, ctx->datalen);
+	le64enc(&lengths[0], ctx->aadlen);
+	le64enc(&lengths[8], ctx->datalen);
+	Poly1305_Update(&ctx->poly, lengths, sizeof(lengths));
+	Poly1305_Final(&ctx->poly, tag);
+
+	/* Clean the context. */
+	ChaCha20_Clear(&ctx->chacha);
+	ctx->aadlen = 0;
+	ctx->datalen = 0;
+}
+
+int
+ChaCha20Poly1305_Verify(CHACHA20POLY1305_CTX * ctx, const uint8_t tag[16])
+{
+	uint8_t expected[16];
+	uint8_t diff = 0;
+	int i;
+
+	ChaCha20Poly1305_Final(ctx, expected);
+	for (i = 0; i < 16; i++)
+		diff |= expected[i] ^ tag[i];
+	return (diff == 0 ? 0 : -1);
+}
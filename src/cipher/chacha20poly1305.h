@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _CHACHA20POLY1305_H_
+#define _CHACHA20POLY1305_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+#include "chacha20.h"
+#include "poly1305.h"
+
+typedef struct ChaCha20Poly1305Context {
+	CHACHA20_CTX chacha;
+	POLY1305_CTX poly;
+	uint64_t aadlen;
+	uint64_t datalen;
+} CHACHA20POLY1305_CTX;
+
+/**
+ * ChaCha20Poly1305_Init(ctx, key, nonce):
+ * XChaCha20Poly1305_Init(ctx, key, nonce):
+ * Start an RFC 8439 AEAD operation with a 12-byte nonce, or an
+ * XChaCha20-Poly1305 one with a 24-byte nonce. The same calls below
+ * then handle either one, in either direction.
+ */
+void	ChaCha20Poly1305_Init(CHACHA20POLY1305_CTX *, const uint8_t [32],
+    const uint8_t [12]);
+void	XChaCha20Poly1305_Init(CHACHA20POLY1305_CTX *, const uint8_t [32],
+    const uint8_t [24]);
+
+/**
+ * ChaCha20Poly1305_AAD(ctx, aad, len):
+ * Authenticate len more bytes of additional data. This must come
+ * before any calls to encrypt or decrypt.
+ */
+void	ChaCha20Poly1305_AAD(CHACHA20POLY1305_CTX *, const uint8_t *, size_t);
+
+/**
+ * ChaCha20Poly1305_Encrypt(ctx, in, out, len):
+ * ChaCha20Poly1305_Decrypt(ctx, in, out, len):
+ * Process the next len bytes of the message, in chunks of any size.
+ * Decrypted data is not authentic until ChaCha20Poly1305_Verify
+ * succeeds.
+ */
+void	ChaCha20Poly1305_Encrypt(CHACHA20POLY1305_CTX *, const uint8_t *,
+    uint8_t *, size_t);
+void	ChaCha20Poly1305_Decrypt(CHACHA20POLY1305_CTX *, const uint8_t *,
+    uint8_t *, size_t);
+
+/**
+ * ChaCha20Poly1305_Final(ctx, tag):
+ * Output the 16-byte tag and clear the context.
+ */
+void	ChaCha20Poly1305_Final(CHACHA20POLY1305_CTX *, uint8_t [16]);
+
+/**
+ * ChaCha20Poly1305_Verify(ctx, tag):
+ * Compare the tag in constant time and clear the context.
+ * Return 0 if it matches, or -1 otherwise.
+ */
+int	ChaCha20Poly1305_Verify(CHACHA20POLY1305_CTX *, const uint8_t [16]);
+
+#endif /* !_CHACHA20POLY1305_H_ */
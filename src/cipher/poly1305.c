@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../scrypt/sysendian.h"
+
+#include "poly1305.h"
+
+/*
+ * The accumulator and key live in five 26-bit limbs, so the products
+ * fit in 64 bits on 32-bit CPUs as well as 64-bit ones.
+ */
+
+#define MASK26 0x3ffffff
+
+/**
+ * poly1305_blocks(ctx, in, nblocks, hibit):
+ * Multiply each 16-byte block into the accumulator. The hibit is the
+ * 2^128 bit, which is set for all but a padded final block.
+ */
+static void
+poly1305_blocks(POLY1305_CTX * ctx, const uint8_t * in, size_t nblocks,
+    uint32_t hibit)
+{
+	const uint32_t r0 = ctx->r[0], r1 = ctx->r[1], r2 = ctx->r[2];
+	const uint32_t r3 = ctx->r[3], r4 = ctx->r[4];
+	const uint32_t s1 = r1 * 5, s2 = r2 * 5, s3 = r3 * 5, s4 = r4 * 5;
+	uint32_t h0 = ctx->h[0], h1 = ctx->h[1], h2 = ctx->h[2];
+	uint32_t h3 = ctx->h[3], h4 = ctx->h[4];
+	uint64_t d0, d1, d2, d3, d4;
+	uint32_t c;
+
+	for (; nblocks > 0; nblocks--, in += 16) {
+		h0 += le32dec(&in[0]) & MASK26;
+		h1 += (le32dec(&in[3]) >> 2) & MASK26;
+		h2 += (le32dec(&in[6]) >> 4) & MASK26;
+		h3 += (le32dec(&in[9]) >> 6) & MASK26;
+		h4 += (le32dec(&in[12]) >> 8) | hibit;
+
+		/* h *= r, folding 2^130 back in as 5. */
+		d0 = (uint64_t)h0 * r0 + (uint64_t)h1 * s4 +
+		    (uint64_t)h2 * s3 + (uint64_t)h3 * s2 + (uint64_t)h4 * s1;
+		d1 = (uint64_t)h0 * r1 + (uint64_t)h1 * r0 +
+		    (uint64_t)h2 * s4 + (uint64_t)h3 * s3 + (uint64_t)h4 * s2;
+		d2 = (uint64_t)h0 * r2 + (uint64_t)h1 * r1 +
+		    (uint64_t)h2 * r0 + (uint64_t)h3 * s4 + (uint64_t)h4 * s3;
+		d3 = (uint64_t)h0 * r3 + (uint64_t)h1 * r2 +
+		    (uint64_t)h2 * r1 + (uint64_t)h3 * r0 + (uint64_t)h4 * s4;
+		d4 = (uint64_t)h0 * r4 + (uint64_t)h1 * r3 +
+		    (uint64_t)h2 * r2 + (uint64_t)h3 * r1 + (uint64_t)h4 * r0;
+
+		/* Partially reduce, leaving h below 2^130 + a little. */
+		c = (uint32_t)(d0 >> 26);
+		h0 = (uint32_t)d0 & MASK26;
+		d1 += c;
+		c = (uint32_t)(d1 >> 26);
+		h1 = (uint32_t)d1 & MASK26;
+		d2 += c;
+		c = (uint32_t)(d2 >> 26);
+		h2 = (uint32_t)d2 & MASK26;
+		d3 += c;
+		c = (uint32_t)(d3 >> 26);
+		h3 = (uint32_t)d3 & MASK26;
+		d4 += c;
+		c = (uint32_t)(d4 >> 26);
+		h4 = (uint32_t)d4 & MASK26;
+		h0 += c * 5;
+		c = h0 >> 26;
+		h0 &= MASK26;
+		h1 += c;
+	}
+
+	ctx->h[0] = h0;
+	ctx->h[1] = h1;
+	ctx->h[2] = h2;
+	ctx->h[3] = h3;
+	ctx->h[4] = h4;
+}
+
+void
+Poly1305_Init(POLY1305_CTX * ctx, const uint8_t key[32])
+{
+	int i;
+
+	/* Clamp r, as the specification requires. */
+	ctx->r[0] = le32dec(&key[0]) & 0x3ffffff;
+	ctx->r[1] = (le32dec(&key[3]) >> 2) & 0x3ffff03;
+	ctx->r[2] = (le32dec(&key[6]) >> 4) & 0x3ffc0ff;
+	ctx->r[3] = (le32dec(&key[9]) >> 6) & 0x3f03fff;
+	ctx->r[4] = (le32dec(&key[12]) >> 8) & 0x00fffff;
+
+	for (i = 0; i < 5; i++)
+		ctx->h[i] = 0;
+	for (i = 0; i < 4; i++)
+		ctx->pad[i] = le32dec(&key[16 + 4 * i]);
+	ctx->buflen = 0;
+}
+
+void
+Poly1305_Update(POLY1305_CTX * ctx, const uint8_t * in, size_t len)
+{
+	size_t n;
+
+	/* Finish off a buffered partial block. */
+	if (ctx->buflen > 0) {
+		n = 16 - ctx->buflen;
+		if (n > len)
+			n = len;
+		memcpy(&ctx->buf[ctx->buflen], in, n);
+		ctx->buflen += n;
+		in += n;
+		len -= n;
+		if (ctx->buflen < 16)
+			return;
+		poly1305_blocks(ctx, ctx->buf, 1, 1 << 24);
+		ctx->buflen = 0;
+	}
+
+	/* Process whole blocks straight from the input. */
+	poly1305_blocks(ctx, in, len / 16, 1 << 24);
+	in += len & ~(size_t)15;
+	len &= 15;
+
+	/* Buffer the rest. */
+	memcpy(ctx->buf, in, len);
+	ctx->buflen = len;
+}
+
+void
+Poly1305_Final(POLY1305_CTX * ctx, uint8_t mac[16])
+{
+	uint32_t h0, h1, h2, h3, h4, g0, g1, g2, g3, g4, c, mask;
+	uint64_t f;
+
+	/* A final partial block gets a 1 byte, then zeros. */
+	if (ctx->buflen > 0) {
+		ctx->buf[ctx->buflen] = 1;
+		memset(&ctx->buf[ctx->buflen + 1], 0, 15 - ctx->buflen);
+		poly1305_blocks(ctx, ctx->buf, 1, 0);
+	}
+
+	/* Fully carry h. */
+	h0 = ctx->h[0];
+	h1 = ctx->h[1];
+	h2 = ctx->h[2];
+	h3 = ctx->h[3];
+	h4 = ctx->h[4];
+	c = h1 >> 26;
+	h1 &= MASK26;
+	h2 += c;
+	c = h2 >> 26;
+	h2 &= MASK26;
+	h3 += c;
+	c = h3 >> 26;
+	h3 &= MASK26;
+	h4 += c;
+	c = h4 >> 26;
+	h4 &= MASK26;
+	h0 += c * 5;
+	c = h0 >> 26;
+	h0 &= MASK26;
+	h1 += c;
+
+	/* Compute g = h - (2^130 - 5), and use it if it did not borrow. */
+	g0 = h0 + 5;
+	c = g0 >> 26;
+	g0 &= MASK26;
+	g1 = h1 + c;
+	c = g1 >> 26;
+	g1 &= MASK26;
+	g2 = h2 + c;
+	c = g2 >> 26;
+	g2 &= MASK26;
+	g3 = h3 + c;
+	c = g3 >> 26;
+	g3 &= MASK26;
+	g4 = h4 + c - (1 << 26);
+
+	mask = (g4 >> 31) - 1;
+	h0 = (h0 & ~mask) | (g0 & mask);
+	h1 = (h1 & ~mask) | (g1 & mask);
+	h2 = (h2 & ~mask) | (g2 & mask);
+	h3 = (h3 & ~mask) | (g3 & mask);
+	h4 = (h4 & ~mask) | (g4 & mask);
+
+	/* Pack into 32-bit words, dropping bits above 2^128. */
+	h0 = h0 | (h1 << 26);
+	h1 = (h1 >> 6) | (h2 << 20);
+	h2 = (h2 >> 12) | (h3 << 14);
+	h3 = (h3 >> 18) | (h4 << 8);
+
+	/* mac = (h + pad) mod 2^128 */
+	f = (uint64_t)h0 + ctx->pad[0];
+	le32enc(&mac[0], (uint32_t)f);
+	f = (uint64_t)h1 + ctx->pad[1] + (f >> 32);
+	le32enc(&mac[4], (uint32_t)f);
+	f = (uint64_t)h2 + ctx->pad[2] + (f >> 32);
+	le32enc(&mac[8], (uint32_t)f);
+	f = (uint64_t)h3 + ctx->pad[3] + (f >> 32);
+	le32enc(&mac[12], (uint32_t)f);
+
+	/* Clean the context. */
+	memset(ctx, 0, sizeof(*ctx));
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _POLY1305_H_
+#define _POLY1305_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+typedef struct Poly1305Context {
+	uint32_t r[5];
+	uint32_t h[5];
+	uint32_t pad[4];
+	uint8_t buf[16];
+	size_t buflen;
+} POLY1305_CTX;
+
+/**
+ * Poly1305_Init(ctx, key):
+ * Start a MAC under a one-time 32-byte key.
+ */
+void	Poly1305_Init(POLY1305_CTX *, const uint8_t [32]);
+
+/**
+ * Poly1305_Update(ctx, in, len):
+ * Input len bytes from in into the MAC.
+ */
+void	Poly1305_Update(POLY1305_CTX *, const uint8_t *, size_t);
+
+/**
+ * Poly1305_Final(ctx, mac):
+ * Output the 16-byte MAC and clear the context.
+ */
+void	Poly1305_Final(POLY1305_CTX *, uint8_t [16]);
+
+#endif /* !_POLY1305_H_ */
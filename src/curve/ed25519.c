@@ -0,0 +1,1114 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../hash/sha512.h"
+#include "../scrypt/sysendian.h"
+
+#include "ed25519.h"
+
+/*
+ * Field elements mod p = 2^255 - 19. Where the compiler has 128-bit
+ * integers, they live in five unsigned 51-bit limbs. Otherwise they live
+ * in ten signed limbs of alternately 26 and 25 bits, so the products
+ * still fit in 64 bits on 32-bit CPUs. Either way, sums and differences
+ * of up to three reduced elements can go straight into fe_mul without
+ * carrying first.
+ */
+#if defined(__SIZEOF_INT128__)
+#define FE_RADIX51
+#define FE_LIMBS 5
+typedef uint64_t fe_limb;
+typedef unsigned __int128 fe_wide;
+#else
+#define FE_LIMBS 10
+typedef int32_t fe_limb;
+#endif
+
+typedef fe_limb fe[FE_LIMBS];
+
+#ifdef FE_RADIX51
+
+#define FE_MASK51 (((uint64_t)1 << 51) - 1)
+
+/* d = -121665 / 121666 */
+static const fe fe_d = {
+	0x34dca135978a3, 0x1a8283b156ebd, 0x5e7a26001c029, 0x739c663a03cbb,
+	0x52036cee2b6ff
+};
+
+/* 2 * d */
+static const fe fe_d2 = {
+	0x69b9426b2f159, 0x35050762add7a, 0x3cf44c0038052, 0x6738cc7407977,
+	0x2406d9dc56dff
+};
+
+/* sqrt(-1) */
+static const fe fe_sqrtm1 = {
+	0x61b274a0ea0b0, 0x0d5a5fc8f189d, 0x7ef5e9cbd0c60, 0x78595a6804c9e,
+	0x2b8324804fc1d
+};
+
+/* The base point, in extended coordinates with Z = 1. */
+static const fe fe_basex = {
+	0x62d608f25d51a, 0x412a4b4f6592a, 0x75b7171a4b31d, 0x1ff60527118fe,
+	0x216936d3cd6e5
+};
+static const fe fe_basey = {
+	0x6666666666658, 0x4cccccccccccc, 0x1999999999999, 0x3333333333333,
+	0x6666666666666
+};
+static const fe fe_baset = {
+	0x68ab3a5b7dda3, 0x00eea2a5eadbb, 0x2af8df483c27e, 0x332b375274732,
+	0x67875f0fd78b7
+};
+
+#else
+
+#define FE_WIDTH(i) ((i) % 2 == 0 ? 26 : 25)
+
+static const unsigned int fe_offset[10] = {
+	0, 26, 51, 77, 102, 128, 153, 179, 204, 230
+};
+
+/* d = -121665 / 121666 */
+static const fe fe_d = {
+	56195235, 13857412, 51736253, 6949390, 114729,
+	24766616, 60832955, 30306712, 48412415, 21499315
+};
+
+/* 2 * d */
+static const fe fe_d2 = {
+	45281625, 27714825, 36363642, 13898781, 229458,
+	15978800, 54557047, 27058993, 29715967, 9444199
+};
+
+/* sqrt(-1) */
+static const fe fe_sqrtm1 = {
+	34513072, 25610706, 9377949, 3500415, 12389472,
+	33281959, 41962654, 31548777, 326685, 11406482
+};
+
+/* The base point, in extended coordinates with Z = 1. */
+static const fe fe_basex = {
+	52811034, 25909283, 16144682, 17082669, 27570973,
+	30858332, 40966398, 8378388, 20764389, 8758491
+};
+static const fe fe_basey = {
+	40265304, 26843545, 13421772, 20132659, 26843545,
+	6710886, 53687091, 13421772, 40265318, 26843545
+};
+static const fe fe_baset = {
+	28827043, 27438313, 39759291, 244362, 8635006,
+	11264893, 19351346, 13413597, 16611511, 27139452
+};
+
+#endif
+
+/* The group order L = 2^252 + 27742317777372353535851937790883648493. */
+static const int64_t L[32] = {
+	0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58,
+	0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x10
+};
+
+static void
+fe_0(fe h)
+{
+
+	memset(h, 0, sizeof(fe));
+}
+
+static void
+fe_1(fe h)
+{
+
+	memset(h, 0, sizeof(fe));
+	h[0] = 1;
+}
+
+static void
+fe_copy(fe h, const fe f)
+{
+
+	memcpy(h, f, sizeof(fe));
+}
+
+static void
+fe_add(fe h, const fe f, const fe g)
+{
+	int i;
+
+	for (i = 0; i < FE_LIMBS; i++)
+		h[i] = f[i] + g[i];
+}
+
+/**
+ * fe_cmov(f, g, b):
+ * Replace f with g if b is 1, or leave it alone if b is 0, in constant
+ * time.
+ */
+static void
+fe_cmov(fe f, const fe g, unsigned int b)
+{
+	fe_limb mask = -(fe_limb)b;
+	int i;
+
+	for (i = 0; i < FE_LIMBS; i++)
+		f[i] ^= mask & (f[i] ^ g[i]);
+}
+
+#ifdef FE_RADIX51
+
+/*
+ * Subtraction adds 4 * p first, so the limbs never go negative.
+ */
+static const fe fe_4p = {
+	0x1fffffffffffb4, 0x1ffffffffffffc, 0x1ffffffffffffc, 0x1ffffffffffffc,
+	0x1ffffffffffffc
+};
+
+static void
+fe_sub(fe h, const fe f, const fe g)
+{
+	int i;
+
+	for (i = 0; i < 5; i++)
+		h[i] = f[i] + fe_4p[i] - g[i];
+}
+
+static void
+fe_neg(fe h, const fe f)
+{
+	int i;
+
+	for (i = 0; i < 5; i++)
+		h[i] = fe_4p[i] - f[i];
+}
+
+/**
+ * fe_carry(h, t):
+ * Carry the 128-bit column sums into 51-bit limbs.
+ */
+static void
+fe_carry(fe h, fe_wide t[5])
+{
+	uint64_t c;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		t[i + 1] += (uint64_t)(t[i] >> 51);
+		h[i] = (uint64_t)t[i] & FE_MASK51;
+	}
+	c = (uint64_t)(t[4] >> 51);
+	h[4] = (uint64_t)t[4] & FE_MASK51;
+	h[0] += 19 * c;
+	h[1] += h[0] >> 51;
+	h[0] &= FE_MASK51;
+}
+
+/**
+ * fe_mul(h, f, g):
+ * Multiply, with limb 5 wrapping around as 19, since it sits at 2^255.
+ */
+static void
+fe_mul(fe h, const fe f, const fe g)
+{
+	uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+	uint64_t g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4];
+	uint64_t g1_19 = 19 * g1, g2_19 = 19 * g2, g3_19 = 19 * g3;
+	uint64_t g4_19 = 19 * g4;
+	fe_wide t[5];
+
+	t[0] = (fe_wide)f0 * g0 + (fe_wide)f1 * g4_19 + (fe_wide)f2 * g3_19 +
+	    (fe_wide)f3 * g2_19 + (fe_wide)f4 * g1_19;
+	t[1] = (fe_wide)f0 * g1 + (fe_wide)f1 * g0 + (fe_wide)f2 * g4_19 +
+	    (fe_wide)f3 * g3_19 + (fe_wide)f4 * g2_19;
+	t[2] = (fe_wide)f0 * g2 + (fe_wide)f1 * g1 + (fe_wide)f2 * g0 +
+	    (fe_wide)f3 * g4_19 + (fe_wide)f4 * g3_19;
+	t[3] = (fe_wide)f0 * g3 + (fe_wide)f1 * g2 + (fe_wide)f2 * g1 +
+	    (fe_wide)f3 * g0 + (fe_wide)f4 * g4_19;
+	t[4] = (fe_wide)f0 * g4 + (fe_wide)f1 * g3 + (fe_wide)f2 * g2 +
+	    (fe_wide)f3 * g1 + (fe_wide)f4 * g0;
+	fe_carry(h, t);
+}
+
+/**
+ * fe_sq(h, f):
+ * Square, sharing the products that fe_mul would compute twice.
+ */
+static void
+fe_sq(fe h, const fe f)
+{
+	uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+	uint64_t f0_2 = 2 * f0, f1_2 = 2 * f1, f2_2 = 2 * f2, f3_2 = 2 * f3;
+	uint64_t f3_19 = 19 * f3, f4_19 = 19 * f4;
+	fe_wide t[5];
+
+	t[0] = (fe_wide)f0 * f0 + (fe_wide)f1_2 * f4_19 + (fe_wide)f2_2 * f3_19;
+	t[1] = (fe_wide)f0_2 * f1 + (fe_wide)f2_2 * f4_19 + (fe_wide)f3 * f3_19;
+	t[2] = (fe_wide)f0_2 * f2 + (fe_wide)f1 * f1 + (fe_wide)f3_2 * f4_19;
+	t[3] = (fe_wide)f0_2 * f3 + (fe_wide)f1_2 * f2 + (fe_wide)f4 * f4_19;
+	t[4] = (fe_wide)f0_2 * f4 + (fe_wide)f1_2 * f3 + (fe_wide)f2 * f2;
+	fe_carry(h, t);
+}
+
+/**
+ * fe_reduce(h):
+ * Carry h, for sums too big to go into fe_mul directly.
+ */
+static void
+fe_reduce(fe h)
+{
+	fe_wide t[5];
+	int i;
+
+	for (i = 0; i < 5; i++)
+		t[i] = h[i];
+	fe_carry(h, t);
+}
+
+/**
+ * fe_frombytes(h, s):
+ * Load a little-endian number, ignoring the top bit.
+ */
+static void
+fe_frombytes(fe h, const uint8_t s[32])
+{
+
+	h[0] = le64dec(&s[0]) & FE_MASK51;
+	h[1] = (le64dec(&s[6]) >> 3) & FE_MASK51;
+	h[2] = (le64dec(&s[12]) >> 6) & FE_MASK51;
+	h[3] = (le64dec(&s[19]) >> 1) & FE_MASK51;
+	h[4] = (le64dec(&s[24]) >> 12) & FE_MASK51;
+}
+
+/**
+ * fe_tobytes(s, f):
+ * Store the fully-reduced value of f, little-endian.
+ */
+static void
+fe_tobytes(uint8_t s[32], const fe f)
+{
+	uint64_t t[5];
+	uint64_t q;
+	int i;
+
+	/* Carry twice, leaving 0 <= t < 2^255 + 19 * 2^13. */
+	memcpy(t, f, sizeof(t));
+	fe_reduce(t);
+	fe_reduce(t);
+
+	/* Subtract p if t >= p, by adding 19 and dropping 2^255. */
+	q = (t[0] + 19) >> 51;
+	for (i = 1; i < 5; i++)
+		q = (t[i] + q) >> 51;
+	t[0] += 19 * q;
+	for (i = 0; i < 4; i++) {
+		t[i + 1] += t[i] >> 51;
+		t[i] &= FE_MASK51;
+	}
+	t[4] &= FE_MASK51;
+
+	le64enc(&s[0], t[0] | t[1] << 51);
+	le64enc(&s[8], t[1] >> 13 | t[2] << 38);
+	le64enc(&s[16], t[2] >> 26 | t[3] << 25);
+	le64enc(&s[24], t[3] >> 39 | t[4] << 12);
+}
+
+#else
+
+static void
+fe_sub(fe h, const fe f, const fe g)
+{
+	int i;
+
+	for (i = 0; i < 10; i++)
+		h[i] = f[i] - g[i];
+}
+
+static void
+fe_neg(fe h, const fe f)
+{
+	int i;
+
+	for (i = 0; i < 10; i++)
+		h[i] = -f[i];
+}
+
+/**
+ * fe_carry(t):
+ * Carry each limb into the next, rounding so the limbs end up signed
+ * and no bigger than half their width.
+ */
+static void
+fe_carry(int64_t t[10])
+{
+	int64_t c;
+	int i;
+
+	for (i = 0; i < 10; i++) {
+		c = (t[i] + ((int64_t)1 << (FE_WIDTH(i) - 1))) >> FE_WIDTH(i);
+		t[i] -= c * ((int64_t)1 << FE_WIDTH(i));
+		if (i < 9)
+			t[i + 1] += c;
+		else
+			t[0] += 19 * c;
+	}
+	c = (t[0] + ((int64_t)1 << 25)) >> 26;
+	t[0] -= c * ((int64_t)1 << 26);
+	t[1] += c;
+}
+
+/**
+ * fe_mul(h, f, g):
+ * Multiply, with each output limb summing the products that land at
+ * its weight. Two odd limbs multiply out to twice the weight of limb
+ * i + j, and limb 10 sits at 2^255, which is 19 mod p.
+ */
+static void
+fe_mul(fe h, const fe f, const fe g)
+{
+	int32_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4],
+	    f5 = f[5], f6 = f[6], f7 = f[7], f8 = f[8], f9 = f[9];
+	int32_t g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4],
+	    g5 = g[5], g6 = g[6], g7 = g[7], g8 = g[8], g9 = g[9];
+	int32_t f1_2 = 2 * f1, f3_2 = 2 * f3, f5_2 = 2 * f5, f7_2 = 2 * f7,
+	    f9_2 = 2 * f9;
+	int32_t g1_19 = 19 * g1, g2_19 = 19 * g2, g3_19 = 19 * g3,
+	    g4_19 = 19 * g4, g5_19 = 19 * g5, g6_19 = 19 * g6,
+	    g7_19 = 19 * g7, g8_19 = 19 * g8, g9_19 = 19 * g9;
+	int64_t t[10];
+	int i;
+
+	t[0] = (int64_t)f0 * g0 + (int64_t)f1_2 * g9_19 + (int64_t)f2 * g8_19 +
+	    (int64_t)f3_2 * g7_19 + (int64_t)f4 * g6_19 +
+	    (int64_t)f5_2 * g5_19 + (int64_t)f6 * g4_19 +
+	    (int64_t)f7_2 * g3_19 + (int64_t)f8 * g2_19 +
+	    (int64_t)f9_2 * g1_19;
+	t[1] = (int64_t)f0 * g1 + (int64_t)f1 * g0 + (int64_t)f2 * g9_19 +
+	    (int64_t)f3 * g8_19 + (int64_t)f4 * g7_19 + (int64_t)f5 * g6_19 +
+	    (int64_t)f6 * g5_19 + (int64_t)f7 * g4_19 + (int64_t)f8 * g3_19 +
+	    (int64_t)f9 * g2_19;
+	t[2] = (int64_t)f0 * g2 + (int64_t)f1_2 * g1 + (int64_t)f2 * g0 +
+	    (int64_t)f3_2 * g9_19 + (int64_t)f4 * g8_19 +
+	    (int64_t)f5_2 * g7_19 + (int64_t)f6 * g6_19 +
+	    (int64_t)f7_2 * g5_19 + (int64_t)f8 * g4_19 +
+	    (int64_t)f9_2 * g3_19;
+	t[3] = (int64_t)f0 * g3 + (int64_t)f1 * g2 + (int64_t)f2 * g1 +
+	    (int64_t)f3 * g0 + (int64_t)f4 * g9_19 + (int64_t)f5 * g8_19 +
+	    (int64_t)f6 * g7_19 + (int64_t)f7 * g6_19 + (int64_t)f8 * g5_19 +
+	    (int64_t)f9 * g4_19;
+	t[4] = (int64_t)f0 * g4 + (int64_t)f1_2 * g3 + (int64_t)f2 * g2 +
+	    (int64_t)f3_2 * g1 + (int64_t)f4 * g0 + (int64_t)f5_2 * g9_19 +
+	    (int64_t)f6 * g8_19 + (int64_t)f7_2 * g7_19 + (int64_t)f8 * g6_19 +
+	    (int64_t)f9_2 * g5_19;
+	t[5] = (int64_t)f0 * g5 + (int64_t)f1 * g4 + (int64_t)f2 * g3 +
+	    (int64_t)f3 * g2 + (int64_t)f4 * g1 + (int64_t)f5 * g0 +
+	    (int64_t)f6 * g9_19 + (int64_t)f7 * g8_19 + (int64_t)f8 * g7_19 +
+	    (int64_t)f9 * g6_19;
+	t[6] = (int64_t)f0 * g6 + (int64_t)f1_2 * g5 + (int64_t)f2 * g4 +
+	    (int64_t)f3_2 * g3 + (int64_t)f4 * g2 + (int64_t)f5_2 * g1 +
+	    (int64_t)f6 * g0 + (int64_t)f7_2 * g9_19 + (int64_t)f8 * g8_19 +
+	    (int64_t)f9_2 * g7_19;
+	t[7] = (int64_t)f0 * g7 + (int64_t)f1 * g6 + (int64_t)f2 * g5 +
+	    (int64_t)f3 * g4 + (int64_t)f4 * g3 + (int64_t)f5 * g2 +
+	    (int64_t)f6 * g1 + (int64_t)f7 * g0 + (int64_t)f8 * g9_19 +
+	    (int64_t)f9 * g8_19;
+	t[8] = (int64_t)f0 * g8 + (int64_t)f1_2 * g7 + (int64_t)f2 * g6 +
+	    (int64_t)f3_2 * g5 + (int64_t)f4 * g4 + (int64_t)f5_2 * g3 +
+	    (int64_t)f6 * g2 + (int64_t)f7_2 * g1 + (int64_t)f8 * g0 +
+	    (int64_t)f9_2 * g9_19;
+	t[9] = (int64_t)f0 * g9 + (int64_t)f1 * g8 + (int64_t)f2 * g7 +
+	    (int64_t)f3 * g6 + (int64_t)f4 * g5 + (int64_t)f5 * g4 +
+	    (int64_t)f6 * g3 + (int64_t)f7 * g2 + (int64_t)f8 * g1 +
+	    (int64_t)f9 * g0;
+
+	fe_carry(t);
+	for (i = 0; i < 10; i++)
+		h[i] = (int32_t)t[i];
+}
+
+/**
+ * fe_sq(h, f):
+ * Square, sharing the products that fe_mul would compute twice.
+ */
+static void
+fe_sq(fe h, const fe f)
+{
+	int32_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4],
+	    f5 = f[5], f6 = f[6], f7 = f[7], f8 = f[8], f9 = f[9];
+	int32_t f0_2 = 2 * f0, f1_2 = 2 * f1, f2_2 = 2 * f2, f3_2 = 2 * f3,
+	    f4_2 = 2 * f4, f5_2 = 2 * f5, f6_2 = 2 * f6, f7_2 = 2 * f7,
+	    f8_2 = 2 * f8;
+	int32_t f6_19 = 19 * f6, f7_19 = 19 * f7, f8_19 = 19 * f8,
+	    f9_19 = 19 * f9;
+	int32_t f5_38 = 38 * f5, f7_38 = 38 * f7, f9_38 = 38 * f9;
+	int64_t t[10];
+	int i;
+
+	t[0] = (int64_t)f0 * f0 + (int64_t)f1_2 * f9_38 +
+	    (int64_t)f2_2 * f8_19 + (int64_t)f3_2 * f7_38 +
+	    (int64_t)f4_2 * f6_19 + (int64_t)f5 * f5_38;
+	t[1] = (int64_t)f0_2 * f1 + (int64_t)f2_2 * f9_19 +
+	    (int64_t)f3_2 * f8_19 + (int64_t)f4_2 * f7_19 +
+	    (int64_t)f5_2 * f6_19;
+	t[2] = (int64_t)f0_2 * f2 + (int64_t)f1 * f1_2 + (int64_t)f3_2 * f9_38 +
+	    (int64_t)f4_2 * f8_19 + (int64_t)f5_2 * f7_38 +
+	    (int64_t)f6 * f6_19;
+	t[3] = (int64_t)f0_2 * f3 + (int64_t)f1_2 * f2 + (int64_t)f4_2 * f9_19 +
+	    (int64_t)f5_2 * f8_19 + (int64_t)f6_2 * f7_19;
+	t[4] = (int64_t)f0_2 * f4 + (int64_t)f1_2 * f3_2 + (int64_t)f2 * f2 +
+	    (int64_t)f5_2 * f9_38 + (int64_t)f6_2 * f8_19 +
+	    (int64_t)f7 * f7_38;
+	t[5] = (int64_t)f0_2 * f5 + (int64_t)f1_2 * f4 + (int64_t)f2_2 * f3 +
+	    (int64_t)f6_2 * f9_19 + (int64_t)f7_2 * f8_19;
+	t[6] = (int64_t)f0_2 * f6 + (int64_t)f1_2 * f5_2 + (int64_t)f2_2 * f4 +
+	    (int64_t)f3 * f3_2 + (int64_t)f7_2 * f9_38 + (int64_t)f8 * f8_19;
+	t[7] = (int64_t)f0_2 * f7 + (int64_t)f1_2 * f6 + (int64_t)f2_2 * f5 +
+	    (int64_t)f3_2 * f4 + (int64_t)f8_2 * f9_19;
+	t[8] = (int64_t)f0_2 * f8 + (int64_t)f1_2 * f7_2 + (int64_t)f2_2 * f6 +
+	    (int64_t)f3_2 * f5_2 + (int64_t)f4 * f4 + (int64_t)f9 * f9_38;
+	t[9] = (int64_t)f0_2 * f9 + (int64_t)f1_2 * f8 + (int64_t)f2_2 * f7 +
+	    (int64_t)f3_2 * f6 + (int64_t)f4_2 * f5;
+
+	fe_carry(t);
+	for (i = 0; i < 10; i++)
+		h[i] = (int32_t)t[i];
+}
+
+/**
+ * fe_reduce(h):
+ * Carry h, for sums too big to go into fe_mul directly.
+ */
+static void
+fe_reduce(fe h)
+{
+	int64_t t[10];
+	int i;
+
+	for (i = 0; i < 10; i++)
+		t[i] = h[i];
+	fe_carry(t);
+	for (i = 0; i < 10; i++)
+		h[i] = (int32_t)t[i];
+}
+
+/**
+ * fe_frombytes(h, s):
+ * Load a little-endian number, ignoring the top bit.
+ */
+static void
+fe_frombytes(fe h, const uint8_t s[32])
+{
+	int i;
+
+	for (i = 0; i < 10; i++)
+		h[i] = (le32dec(&s[fe_offset[i] / 8]) >> (fe_offset[i] % 8)) &
+		    ((1 << FE_WIDTH(i)) - 1);
+}
+
+/**
+ * fe_tobytes(s, f):
+ * Store the fully-reduced value of f, little-endian.
+ */
+static void
+fe_tobytes(uint8_t s[32], const fe f)
+{
+	int64_t t[10];
+	int64_t c, q;
+	uint64_t v;
+	unsigned int j;
+	int i;
+
+	for (i = 0; i < 10; i++)
+		t[i] = f[i];
+	fe_carry(t);
+
+	/* Now |f| < p, so q = floor(f / p) is -1, 0, or 1. */
+	q = (19 * t[9] + ((int64_t)1 << 24)) >> 25;
+	for (i = 0; i < 10; i++)
+		q = (t[i] + q) >> FE_WIDTH(i);
+
+	/* Subtract q * p by adding 19 * q and dropping 2^255 * q. */
+	t[0] += 19 * q;
+	for (i = 0; i < 9; i++) {
+		c = t[i] >> FE_WIDTH(i);
+		t[i + 1] += c;
+		t[i] -= c * ((int64_t)1 << FE_WIDTH(i));
+	}
+	t[9] &= ((int64_t)1 << 25) - 1;
+
+	memset(s, 0, 32);
+	for (i = 0; i < 10; i++) {
+		v = (uint64_t)t[i] << (fe_offset[i] % 8);
+		for (j = fe_offset[i] / 8; j < 32 && j <= fe_offset[i] / 8 + 4;
+		    j++, v >>= 8)
+			s[j] |= (uint8_t)v;
+	}
+}
+
+#endif
+
+/**
+ * fe_sqn(h, f, n):
+ * Square f n times.
+ */
+static void
+fe_sqn(fe h, const fe f, int n)
+{
+
+	fe_sq(h, f);
+	while (--n > 0)
+		fe_sq(h, h);
+}
+
+/**
+ * fe_pow2250(h, t0, z):
+ * Compute z^(2^250 - 1), leaving z^11 in t0.
+ */
+static void
+fe_pow2250(fe h, fe t0, const fe z)
+{
+	fe t1, t2, t3;
+
+	fe_sq(t0, z);
+	fe_sqn(t1, t0, 2);
+	fe_mul(t1, z, t1);
+	fe_mul(t0, t0, t1);
+	fe_sq(t2, t0);
+	fe_mul(t1, t1, t2);
+	fe_sqn(t2, t1, 5);
+	fe_mul(t1, t2, t1);
+	fe_sqn(t2, t1, 10);
+	fe_mul(t2, t2, t1);
+	fe_sqn(t3, t2, 20);
+	fe_mul(t2, t3, t2);
+	fe_sqn(t2, t2, 10);
+	fe_mul(t1, t2, t1);
+	fe_sqn(t2, t1, 50);
+	fe_mul(t2, t2, t1);
+	fe_sqn(t3, t2, 100);
+	fe_mul(t2, t3, t2);
+	fe_sqn(t2, t2, 50);
+	fe_mul(h, t2, t1);
+}
+
+/**
+ * fe_invert(h, z):
+ * Compute 1 / z as z^(p - 2) = z^(2^255 - 21).
+ */
+static void
+fe_invert(fe h, const fe z)
+{
+	fe t0, t1;
+
+	fe_pow2250(t1, t0, z);
+	fe_sqn(t1, t1, 5);
+	fe_mul(h, t1, t0);
+}
+
+/**
+ * fe_pow22523(h, z):
+ * Compute z^((p - 5) / 8) = z^(2^252 - 3), for square roots.
+ */
+static void
+fe_pow22523(fe h, const fe z)
+{
+	fe t0, t1;
+
+	fe_pow2250(t1, t0, z);
+	fe_sqn(t1, t1, 2);
+	fe_mul(h, t1, z);
+}
+
+static int
+fe_isnegative(const fe f)
+{
+	uint8_t s[32];
+
+	fe_tobytes(s, f);
+	return (s[0] & 1);
+}
+
+static int
+fe_iszero(const fe f)
+{
+	uint8_t s[32];
+	uint8_t acc = 0;
+	int i;
+
+	fe_tobytes(s, f);
+	for (i = 0; i < 32; i++)
+		acc |= s[i];
+	return (acc == 0);
+}
+
+/*
+ * Points live in extended twisted Edwards coordinates (X : Y : Z : T),
+ * with x = X / Z, y = Y / Z, and x * y = T / Z. Points about to be
+ * added in are cached as (Y + X, Y - X, Z, 2 * d * T), which saves
+ * work when the same point goes in many times.
+ */
+typedef struct {
+	fe X;
+	fe Y;
+	fe Z;
+	fe T;
+} ge_p3;
+
+typedef struct {
+	fe YplusX;
+	fe YminusX;
+	fe Z;
+	fe T2d;
+} ge_cached;
+
+static void
+ge_identity(ge_p3 * h)
+{
+
+	fe_0(h->X);
+	fe_1(h->Y);
+	fe_1(h->Z);
+	fe_0(h->T);
+}
+
+static void
+ge_base(ge_p3 * h)
+{
+
+	fe_copy(h->X, fe_basex);
+	fe_copy(h->Y, fe_basey);
+	fe_1(h->Z);
+	fe_copy(h->T, fe_baset);
+}
+
+static void
+ge_to_cached(ge_cached * r, const ge_p3 * p)
+{
+
+	fe_add(r->YplusX, p->Y, p->X);
+	fe_sub(r->YminusX, p->Y, p->X);
+	fe_copy(r->Z, p->Z);
+	fe_mul(r->T2d, p->T, fe_d2);
+}
+
+static void
+ge_cached_cmov(ge_cached * t, const ge_cached * u, unsigned int b)
+{
+
+	fe_cmov(t->YplusX, u->YplusX, b);
+	fe_cmov(t->YminusX, u->YminusX, b);
+	fe_cmov(t->Z, u->Z, b);
+	fe_cmov(t->T2d, u->T2d, b);
+}
+
+/**
+ * ge_add(r, p, q):
+ * Compute r = p + q. This formula is complete, so it also works for
+ * doubling and the identity. The output may alias p.
+ */
+static void
+ge_add(ge_p3 * r, const ge_p3 * p, const ge_cached * q)
+{
+	fe a, b, c, d, e, f, g, h;
+
+	fe_sub(a, p->Y, p->X);
+	fe_mul(a, a, q->YminusX);
+	fe_add(b, p->Y, p->X);
+	fe_mul(b, b, q->YplusX);
+	fe_mul(c, p->T, q->T2d);
+	fe_mul(d, p->Z, q->Z);
+	fe_add(d, d, d);
+	fe_sub(e, b, a);
+	fe_sub(f, d, c);
+	fe_add(g, d, c);
+	fe_add(h, b, a);
+	fe_mul(r->X, e, f);
+	fe_mul(r->Y, g, h);
+	fe_mul(r->Z, f, g);
+	fe_mul(r->T, e, h);
+}
+
+/**
+ * ge_dbl(r, p):
+ * Compute r = 2 * p. The output may alias p.
+ */
+static void
+ge_dbl(ge_p3 * r, const ge_p3 * p)
+{
+	fe a, b, c, e, f, g, h;
+
+	fe_sq(a, p->X);
+	fe_sq(b, p->Y);
+	fe_sq(c, p->Z);
+	fe_add(c, c, c);
+	fe_add(h, a, b);
+	fe_add(e, p->X, p->Y);
+	fe_sq(e, e);
+	fe_sub(e, h, e);
+	fe_sub(g, a, b);
+	fe_add(f, c, g);
+	fe_reduce(f);
+	fe_mul(r->X, e, f);
+	fe_mul(r->Y, g, h);
+	fe_mul(r->Z, f, g);
+	fe_mul(r->T, e, h);
+}
+
+/**
+ * ge_table(table, p):
+ * Fill table[k] with k * p, for k in [0, 16).
+ */
+static void
+ge_table(ge_cached table[16], const ge_p3 * p)
+{
+	ge_p3 acc;
+	int k;
+
+	ge_identity(&acc);
+	ge_to_cached(&table[0], &acc);
+	ge_to_cached(&table[1], p);
+	for (k = 2; k < 16; k++) {
+		ge_add(&acc, p, &table[k - 1]);
+		ge_to_cached(&table[k], &acc);
+	}
+}
+
+/**
+ * ge_scalarmult_base(h, a):
+ * Compute h = a * B for a secret 32-byte scalar a, in constant time.
+ */
+static void
+ge_scalarmult_base(ge_p3 * h, const uint8_t a[32])
+{
+	ge_cached table[16];
+	ge_cached t;
+	ge_p3 base;
+	unsigned int nibble, k;
+	int i;
+
+	ge_base(&base);
+	ge_table(table, &base);
+
+	/* Four bits at a time, from the top, reading every table entry. */
+	ge_identity(h);
+	for (i = 63; i >= 0; i--) {
+		if (i != 63) {
+			ge_dbl(h, h);
+			ge_dbl(h, h);
+			ge_dbl(h, h);
+			ge_dbl(h, h);
+		}
+		nibble = (a[i / 2] >> (4 * (i & 1))) & 15;
+		t = table[0];
+		for (k = 1; k < 16; k++)
+			ge_cached_cmov(&t, &table[k], ((k ^ nibble) - 1) >> 31);
+		ge_add(h, h, &t);
+	}
+
+	/* Clean the stack. */
+	memset(table, 0, sizeof(table));
+	memset(&t, 0, sizeof(t));
+}
+
+/**
+ * ge_double_scalarmult_vartime(h, a, A, b):
+ * Compute h = a * A + b * B for public scalars, in variable time.
+ */
+static void
+ge_double_scalarmult_vartime(ge_p3 * h, const uint8_t a[32],
+    const ge_p3 * A, const uint8_t b[32])
+{
+	ge_cached tableA[16], tableB[16];
+	ge_p3 base;
+	unsigned int na, nb;
+	int i;
+
+	ge_base(&base);
+	ge_table(tableA, A);
+	ge_table(tableB, &base);
+
+	ge_identity(h);
+	for (i = 63; i >= 0; i--) {
+		if (i != 63) {
+			ge_dbl(h, h);
+			ge_dbl(h, h);
+			ge_dbl(h, h);
+			ge_dbl(h, h);
+		}
+		na = (a[i / 2] >> (4 * (i & 1))) & 15;
+		nb = (b[i / 2] >> (4 * (i & 1))) & 15;
+		if (na != 0)
+			ge_add(h, h, &tableA[na]);
+		if (nb != 0)
+			ge_add(h, h, &tableB[nb]);
+	}
+}
+
+static void
+ge_tobytes(uint8_t s[32], const ge_p3 * h)
+{
+	fe recip, x, y;
+
+	fe_invert(recip, h->Z);
+	fe_mul(x, h->X, recip);
+	fe_mul(y, h->Y, recip);
+	fe_tobytes(s, y);
+	s[31] ^= fe_isnegative(x) << 7;
+}
+
+/**
+ * ge_frombytes(h, s):
+ * Decode a point, as in RFC 8032 section 5.1.3.
+ * Return 0 on success, or -1 if s is not a canonical encoding.
+ */
+static int
+ge_frombytes(ge_p3 * h, const uint8_t s[32])
+{
+	uint8_t y[32];
+	fe u, v, v3, vxx, check;
+	int sign = s[31] >> 7;
+
+	/* Reject y >= p. */
+	fe_frombytes(h->Y, s);
+	fe_tobytes(y, h->Y);
+	if (memcmp(y, s, 31) != 0 || y[31] != (s[31] & 0x7f))
+		return (-1);
+	fe_1(h->Z);
+
+	/* x^2 = u / v, with u = y^2 - 1 and v = d * y^2 + 1. */
+	fe_sq(u, h->Y);
+	fe_mul(v, u, fe_d);
+	fe_sub(u, u, h->Z);
+	fe_add(v, v, h->Z);
+
+	/* x = u * v^3 * (u * v^7)^((p - 5) / 8) */
+	fe_sq(v3, v);
+	fe_mul(v3, v3, v);
+	fe_sq(h->X, v3);
+	fe_mul(h->X, h->X, v);
+	fe_mul(h->X, h->X, u);
+	fe_pow22523(h->X, h->X);
+	fe_mul(h->X, h->X, v3);
+	fe_mul(h->X, h->X, u);
+
+	/* That is a square root of u / v or -u / v, or neither. */
+	fe_sq(vxx, h->X);
+	fe_mul(vxx, vxx, v);
+	fe_sub(check, vxx, u);
+	if (!fe_iszero(check)) {
+		fe_add(check, vxx, u);
+		if (!fe_iszero(check))
+			return (-1);
+		fe_mul(h->X, h->X, fe_sqrtm1);
+	}
+
+	if (fe_iszero(h->X) && sign)
+		return (-1);
+	if (fe_isnegative(h->X) != sign)
+		fe_neg(h->X, h->X);
+	fe_mul(h->T, h->X, h->Y);
+	return (0);
+}
+
+/**
+ * sc_modl(r, x):
+ * Reduce the 64-byte number in x, one byte per limb, mod L.
+ */
+static void
+sc_modl(uint8_t r[32], int64_t x[64])
+{
+	int64_t carry;
+	int i, j;
+
+	/* Fold each top byte down, using 2^256 = -16 * (L - 2^252) mod L. */
+	for (i = 63; i >= 32; i--) {
+		carry = 0;
+		for (j = i - 32; j < i - 12; j++) {
+			x[j] += carry - 16 * x[i] * L[j - (i - 32)];
+			carry = (x[j] + 128) >> 8;
+			x[j] -= carry * 256;
+		}
+		x[j] += carry;
+		x[i] = 0;
+	}
+
+	/* Take off any multiples of L left above 2^252. */
+	carry = 0;
+	for (j = 0; j < 32; j++) {
+		x[j] += carry - (x[31] >> 4) * L[j];
+		carry = x[j] >> 8;
+		x[j] &= 255;
+	}
+	for (j = 0; j < 32; j++)
+		x[j] -= carry * L[j];
+	for (i = 0; i < 32; i++) {
+		x[i + 1] += x[i] >> 8;
+		r[i] = x[i] & 255;
+	}
+}
+
+/**
+ * sc_reduce(s):
+ * Reduce the 64-byte number in s mod L, leaving it in s[0 .. 31].
+ */
+static void
+sc_reduce(uint8_t s[64])
+{
+	int64_t x[64];
+	int i;
+
+	for (i = 0; i < 64; i++)
+		x[i] = s[i];
+	sc_modl(s, x);
+
+	/* Clean the stack. */
+	memset(x, 0, sizeof(x));
+}
+
+/**
+ * sc_muladd(s, a, b, c):
+ * Compute s = (a * b + c) mod L.
+ */
+static void
+sc_muladd(uint8_t s[32], const uint8_t a[32], const uint8_t b[32],
+    const uint8_t c[32])
+{
+	int64_t x[64];
+	int i, j;
+
+	memset(x, 0, sizeof(x));
+	for (i = 0; i < 32; i++)
+		x[i] = c[i];
+	for (i = 0; i < 32; i++)
+		for (j = 0; j < 32; j++)
+			x[i + j] += (int64_t)a[i] * b[j];
+	sc_modl(s, x);
+
+	/* Clean the stack. */
+	memset(x, 0, sizeof(x));
+}
+
+/**
+ * sc_is_canonical(s):
+ * Return 1 if the scalar s is below L, or 0 otherwise.
+ */
+static int
+sc_is_canonical(const uint8_t s[32])
+{
+	int i;
+
+	for (i = 31; i >= 0; i--) {
+		if (s[i] < L[i])
+			return (1);
+		if (s[i] > L[i])
+			return (0);
+	}
+	return (0);
+}
+
+/**
+ * ed25519_expand(seed, az):
+ * Hash the seed into the clamped secret scalar, followed by the 32-byte
+ * nonce prefix.
+ */
+static void
+ed25519_expand(const uint8_t seed[32], uint8_t az[64])
+{
+	SHA512_CTX ctx;
+
+	SHA512_Init(&ctx);
+	SHA512_Update(&ctx, seed, 32);
+	SHA512_Final(az, &ctx);
+	az[0] &= 248;
+	az[31] &= 127;
+	az[31] |= 64;
+}
+
+void
+Ed25519_PublicKey(const uint8_t seed[32], uint8_t pk[32])
+{
+	uint8_t az[64];
+	ge_p3 A;
+
+	ed25519_expand(seed, az);
+	ge_scalarmult_base(&A, az);
+	ge_tobytes(pk, &A);
+
+	/* Clean the stack. */
+	memset(az, 0, sizeof(az));
+	memset(&A, 0, sizeof(A));
+}
+
+void
+Ed25519_Sign(const uint8_t seed[32], const uint8_t pk[32],
+    const uint8_t * msg, size_t len, uint8_t sig[64])
+{
+	SHA512_CTX ctx;
+	uint8_t az[64];
+	uint8_t nonce[64];
+	uint8_t hram[64];
+	ge_p3 R;
+
+	ed25519_expand(seed, az);
+
+	/* r = H(prefix || M) mod L, and R = r * B. */
+	SHA512_Init(&ctx);
+	SHA512_Update(&ctx, &az[32], 32);
+	SHA512_Update(&ctx, msg, len);
+	SHA512_Final(nonce, &ctx);
+	sc_reduce(nonce);
+	ge_scalarmult_base(&R, nonce);
+	ge_tobytes(sig, &R);
+
+	/* S = (r + H(R || A || M) * a) mod L */
+	SHA512_Init(&ctx);
+	SHA512_Update(&ctx, sig, 32);
+	SHA512_Update(&ctx, pk, 32);
+	SHA512_Update(&ctx, msg, len);
+	SHA512_Final(hram, &ctx);
+	sc_reduce(hram);
+	sc_muladd(&sig[32], hram, az, nonce);
+
+	/* Clean the stack. */
+	memset(&ctx, 0, sizeof(ctx));
+	memset(az, 0, sizeof(az));
+	memset(nonce, 0, sizeof(nonce));
+	memset(&R, 0, sizeof(R));
+}
+
+int
+Ed25519_Verify(const uint8_t sig[64], const uint8_t pk[32],
+    const uint8_t * msg, size_t len)
+{
+	SHA512_CTX ctx;
+	uint8_t h[64];
+	uint8_t check[32];
+	ge_p3 A, R;
+
+	if (!sc_is_canonical(&sig[32]))
+		return (-1);
+	if (ge_frombytes(&A, pk) != 0)
+		return (-1);
+
+	/* Check that S * B - H(R || A || M) * A encodes to R. */
+	fe_neg(A.X, A.X);
+	fe_neg(A.T, A.T);
+	SHA512_Init(&ctx);
+	SHA512_Update(&ctx, sig, 32);
+	SHA512_Update(&ctx, pk, 32);
+	SHA512_Update(&ctx, msg, len);
+	SHA512_Final(h, &ctx);
+	sc_reduce(h);
+	ge_double_scalarmult_vartime(&R, h, &A, &sig[32]);
+	ge_tobytes(check, &R);
+	return (memcmp(check, sig, 32) == 0 ? 0 : -1);
+}
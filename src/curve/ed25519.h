@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _ED25519_H_
+#define _ED25519_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/*
+ * Ed25519 signatures, as specified in RFC 8032. Private keys are the
+ * 32-byte seeds from that document, and verification is cofactorless,
+ * rejecting non-canonical S values and public keys.
+ */
+
+/**
+ * Ed25519_PublicKey(seed, pk):
+ * Compute the 32-byte public key for a 32-byte seed.
+ */
+void	Ed25519_PublicKey(const uint8_t [32], uint8_t [32]);
+
+/**
+ * Ed25519_Sign(seed, pk, msg, len, sig):
+ * Sign msg[0 .. len - 1], writing a 64-byte signature. The public key
+ * must be the one Ed25519_PublicKey computes for the seed.
+ */
+void	Ed25519_Sign(const uint8_t [32], const uint8_t [32], const uint8_t *,
+    size_t, uint8_t [64]);
+
+/**
+ * Ed25519_Verify(sig, pk, msg, len):
+ * Check a signature over msg[0 .. len - 1].
+ * Return 0 if it is valid, or -1 otherwise.
+ */
+int	Ed25519_Verify(const uint8_t [64], const uint8_t [32], const uint8_t *,
+    size_t);
+
+#endif /* !_ED25519_H_ */
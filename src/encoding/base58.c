@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../arena/arena.h"
+#include "../scrypt/sha256.h"
+
+#include "base58.h"
+
+static const char ALPHABET[] =
+    "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+/* 58^5, the largest power of 58 that still fits in 32 bits. */
+#define LIMB_BASE	656356768U
+#define LIMB_DIGITS	5
+
+/*
+ * Converting between bases one digit at a time costs a pass over the
+ * whole number per digit. Working in limbs of 5 base58 digits, and
+ * feeding in 3 bytes or 5 digits at a time, cuts the passes about 15
+ * times over.
+ */
+
+/**
+ * base58_digit(c):
+ * Return the value of the base58 character c, or -1 if it is not one.
+ */
+static int
+base58_digit(char c)
+{
+	const char * p;
+
+	if (c == '\0' || (p = strchr(ALPHABET, c)) == NULL)
+		return (-1);
+	return ((int)(p - ALPHABET));
+}
+
+/**
+ * base58_encode(in, inlen, check, out):
+ * Encode in[0 .. inlen - 1], followed by the 4 bytes in check if it is
+ * not NULL, into out. Return the encoded length.
+ */
+static size_t
+base58_encode(const uint8_t * in, size_t inlen, const uint8_t * check,
+    char * out)
+{
+	uint32_t limbs_buf[64];
+	uint32_t * limbs = limbs_buf;
+	size_t len = inlen + (check != NULL ? 4 : 0);
+	size_t maxlimbs = BASE58_ENCODED_MAX(len) / LIMB_DIGITS + 1;
+	size_t zeros, used = 0, pos, i, j, k, n;
+	uint64_t t;
+	uint32_t carry, scale;
+	uint8_t b;
+	char digits[LIMB_DIGITS];
+
+	/* Short inputs, like addresses and keys, stay on the stack. */
+	if (maxlimbs > sizeof(limbs_buf) / sizeof(limbs_buf[0]) &&
+	    (limbs = Arena_Alloc(maxlimbs * sizeof(uint32_t))) == NULL)
+		return (0);
+
+	/* Leading zero bytes become leading ones. */
+	for (zeros = 0; zeros < len; zeros++) {
+		b = zeros < inlen ? in[zeros] : check[zeros - inlen];
+		if (b != 0)
+			break;
+	}
+
+	/* Multiply in up to 3 bytes at a time, low limbs first. */
+	for (i = zeros; i < len; i += n) {
+		n = len - i < 3 ? len - i : 3;
+		carry = 0;
+		scale = 1;
+		for (k = 0; k < n; k++) {
+			b = i + k < inlen ? in[i + k] : check[i + k - inlen];
+			carry = (carry << 8) | b;
+			scale <<= 8;
+		}
+		for (j = 0; j < used; j++) {
+			t = (uint64_t)limbs[j] * scale + carry;
+			limbs[j] = (uint32_t)(t % LIMB_BASE);
+			carry = (uint32_t)(t / LIMB_BASE);
+		}
+		while (carry != 0) {
+			limbs[used++] = carry % LIMB_BASE;
+			carry /= LIMB_BASE;
+		}
+	}
+
+	/* Write the limbs out, high first, skipping leading zero digits. */
+	memset(out, ALPHABET[0], zeros);
+	pos = zeros;
+	for (j = used; j-- > 0; ) {
+		for (k = LIMB_DIGITS; k-- > 0; ) {
+			digits[k] = ALPHABET[limbs[j] % 58];
+			limbs[j] /= 58;
+		}
+		for (k = 0; k < LIMB_DIGITS; k++) {
+			if (pos == zeros && j == used - 1 &&
+			    digits[k] == ALPHABET[0])
+				continue;
+			out[pos++] = digits[k];
+		}
+	}
+
+	/* Clean up. */
+	memset(limbs, 0, maxlimbs * sizeof(uint32_t));
+	if (limbs != limbs_buf)
+		Arena_Free(limbs, maxlimbs * sizeof(uint32_t));
+	return (pos);
+}
+
+size_t
+Base58_Encode(const uint8_t * in, size_t inlen, char * out)
+{
+
+	return (base58_encode(in, inlen, NULL, out));
+}
+
+int
+Base58_Decode(const char * in, size_t inlen, uint8_t * out, size_t * outlen)
+{
+	uint32_t limbs_buf[64];
+	uint32_t * limbs = limbs_buf;
+	size_t maxlimbs = inlen / 4 + 1;
+	size_t zeros, used = 0, pos, i, j, k, n;
+	uint64_t t, carry;
+	uint32_t scale;
+	int d, rc = -1;
+
+	if (maxlimbs > sizeof(limbs_buf) / sizeof(limbs_buf[0]) &&
+	    (limbs = Arena_Alloc(maxlimbs * sizeof(uint32_t))) == NULL)
+		return (-1);
+
+	/* Leading ones become leading zero bytes. */
+	for (zeros = 0; zeros < inlen && in[zeros] == ALPHABET[0]; zeros++)
+		continue;
+
+	/* Multiply in up to 5 digits at a time, low limbs first. */
+	for (i = zeros; i < inlen; i += n) {
+		n = inlen - i < LIMB_DIGITS ? inlen - i : LIMB_DIGITS;
+		carry = 0;
+		scale = 1;
+		for (k = 0; k < n; k++) {
+			if ((d = base58_digit(in[i + k])) < 0)
+				goto err;
+			carry = carry * 58 + (uint32_t)d;
+			scale *= 58;
+		}
+		for (j = 0; j < used; j++) {
+			t = (uint64_t)limbs[j] * scale + carry;
+			limbs[j] = (uint32_t)t;
+			carry = t >> 32;
+		}
+		if (carry != 0)
+			limbs[used++] = (uint32_t)carry;
+	}
+
+	/* Write the limbs out big-endian, skipping leading zero bytes. */
+	memset(out, 0, zeros);
+	pos = zeros;
+	for (j = used; j-- > 0; ) {
+		for (k = 4; k-- > 0; ) {
+			if (pos == zeros && j == used - 1 &&
+			    ((limbs[j] >> (8 * k)) & 0xff) == 0)
+				continue;
+			out[pos++] = (uint8_t)(limbs[j] >> (8 * k));
+		}
+	}
+	*outlen = pos;
+	rc = 0;
+
+err:
+	/* Clean up. */
+	memset(limbs, 0, maxlimbs * sizeof(uint32_t));
+	if (limbs != limbs_buf)
+		Arena_Free(limbs, maxlimbs * sizeof(uint32_t));
+	return (rc);
+}
+
+/**
+ * base58_checksum(in, len, check):
+ * Write the first 4 bytes of the double SHA-256 of in[0 .. len - 1]
+ * into check.
+ */
+static void
+base58_checksum(const uint8_t * in, size_t len, uint8_t check[4])
+{
+	SHA256_CTX ctx;
+	uint8_t hash[32];
+
+	SHA256_Init(&ctx);
+	SHA256_Update(&ctx, in, len);
+	SHA256_Final(hash, &ctx);
+	SHA256_Init(&ctx);
+	SHA256_Update(&ctx, hash, sizeof(hash));
+	SHA256_Final(hash, &ctx);
+	memcpy(check, hash, 4);
+
+	/* Clean the stack. */
+	memset(hash, 0, sizeof(hash));
+}
+
+size_t
+Base58Check_Encode(const uint8_t * in, size_t inlen, char * out)
+{
+	uint8_t check[4];
+
+	base58_checksum(in, inlen, check);
+	return (base58_encode(in, inlen, check, out));
+}
+
+int
+Base58Check_Decode(const char * in, size_t inlen, uint8_t * out,
+    size_t * outlen)
+{
+	uint8_t check[4];
+
+	if (Base58_Decode(in, inlen, out, outlen) || *outlen < 4)
+		return (-1);
+	*outlen -= 4;
+	base58_checksum(out, *outlen, check);
+	if (memcmp(check, &out[*outlen], 4) != 0)
+		return (-1);
+	return (0);
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _BASE58_H_
+#define _BASE58_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/**
+ * BASE58_ENCODED_MAX(len):
+ * The most characters base58 needs for len bytes, since each character
+ * holds log2(58) > 5.857 bits.
+ */
+#define BASE58_ENCODED_MAX(len)	((len) * 138 / 100 + 1)
+
+/**
+ * Base58_Encode(in, inlen, out):
+ * Encode in[0 .. inlen - 1] in base58, into out, which must hold
+ * BASE58_ENCODED_MAX(inlen) characters. Return the encoded length, or 0
+ * if a long input could not get its working memory.
+ */
+size_t	Base58_Encode(const uint8_t *, size_t, char *);
+
+/**
+ * Base58_Decode(in, inlen, out, outlen):
+ * Decode the base58 text in[0 .. inlen - 1] into out, which must hold
+ * inlen bytes, and store the decoded length in outlen. Return 0 on
+ * success, or -1 if the text is not base58 or a long input could not get
+ * its working memory.
+ */
+int	Base58_Decode(const char *, size_t, uint8_t *, size_t *);
+
+/**
+ * Base58Check_Encode(in, inlen, out):
+ * Encode in[0 .. inlen - 1] followed by the first 4 bytes of its double
+ * SHA-256, into out, which must hold BASE58_ENCODED_MAX(inlen + 4)
+ * characters. Return the encoded length, or 0 as for Base58_Encode.
+ */
+size_t	Base58Check_Encode(const uint8_t *, size_t, char *);
+
+/**
+ * Base58Check_Decode(in, inlen, out, outlen):
+ * Decode the base58 text in[0 .. inlen - 1] into out, which must hold
+ * inlen bytes, then check and remove its 4-byte checksum. Return 0 on
+ * success, or -1 if the text is not base58 or the checksum is wrong.
+ */
+int	Base58Check_Decode(const char *, size_t, uint8_t *, size_t *);
+
+#endif /* !_BASE58_H_ */
@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "bech32.h"
+
+static const char CHARSET[] = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
+
+/* The values xor-ed into the final polymod, by checksum flavour. */
+#define BECH32_CONST	1U
+#define BECH32M_CONST	0x2bc830a3U
+#define CASHADDR_CONST	1U
+
+/**
+ * charset_value(c):
+ * Return the 5-bit value of the lower-case character c, or -1 if it is
+ * not in the alphabet.
+ */
+static int
+charset_value(char c)
+{
+	const char * p;
+
+	if (c == '\0' || (p = strchr(CHARSET, c)) == NULL)
+		return (-1);
+	return ((int)(p - CHARSET));
+}
+
+/**
+ * lower(c):
+ * Return the ASCII character c in lower case.
+ */
+static char
+lower(char c)
+{
+
+	return ((c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c);
+}
+
+/**
+ * convert_bits(out, outlen, outbits, in, inlen, inbits, pad):
+ * Regroup the inbits-bit values in[0 .. inlen - 1] into outbits-bit
+ * values in out, and store their count in outlen. With pad, zero-fill
+ * the last value; without it, fail if the leftover bits are a whole
+ * value or not zero. Return 0 on success, or -1 on failure.
+ */
+static int
+convert_bits(uint8_t * out, size_t * outlen, int outbits,
+    const uint8_t * in, size_t inlen, int inbits, int pad)
+{
+	uint32_t acc = 0, maxv = (1U << outbits) - 1;
+	size_t i;
+	int bits = 0;
+
+	*outlen = 0;
+	for (i = 0; i < inlen; i++) {
+		acc = ((acc << inbits) | in[i]) & 0xfffff;
+		bits += inbits;
+		while (bits >= outbits) {
+			bits -= outbits;
+			out[(*outlen)++] = (acc >> bits) & maxv;
+		}
+	}
+	if (pad) {
+		if (bits > 0)
+			out[(*outlen)++] = (acc << (outbits - bits)) & maxv;
+	} else if (bits >= inbits || ((acc << (outbits - bits)) & maxv)) {
+		return (-1);
+	}
+	return (0);
+}
+
+/**
+ * bech32_polymod_step(c, v):
+ * Feed the 5-bit value v into the BIP173 checksum c.
+ */
+static uint32_t
+bech32_polymod_step(uint32_t c, uint8_t v)
+{
+	uint8_t b = c >> 25;
+
+	return (((c & 0x1ffffff) << 5) ^ v ^
+	    (-((b >> 0) & 1) & 0x3b6a57b2U) ^
+	    (-((b >> 1) & 1) & 0x26508e6dU) ^
+	    (-((b >> 2) & 1) & 0x1ea119faU) ^
+	    (-((b >> 3) & 1) & 0x3d4233ddU) ^
+	    (-((b >> 4) & 1) & 0x2a1462b3U));
+}
+
+/**
+ * bech32_polymod(hrp, hrplen, data, datalen):
+ * Return the BIP173 checksum of the lower-case hrp[0 .. hrplen - 1] and
+ * the 5-bit values data[0 .. datalen - 1].
+ */
+static uint32_t
+bech32_polymod(const char * hrp, size_t hrplen, const uint8_t * data,
+    size_t datalen)
+{
+	uint32_t c = 1;
+	size_t i;
+
+	for (i = 0; i < hrplen; i++)
+		c = bech32_polymod_step(c, (uint8_t)hrp[i] >> 5);
+	c = bech32_polymod_step(c, 0);
+	for (i = 0; i < hrplen; i++)
+		c = bech32_polymod_step(c, hrp[i] & 0x1f);
+	for (i = 0; i < datalen; i++)
+		c = bech32_polymod_step(c, data[i]);
+	return (c);
+}
+
+/**
+ * check_hrp(hrp, hrplen):
+ * Return 0 if hrp[0 .. hrplen - 1] is a valid lower-case human-readable
+ * part, or -1 otherwise.
+ */
+static int
+check_hrp(const char * hrp, size_t hrplen)
+{
+	size_t i;
+
+	if (hrplen < 1 || hrplen > 83)
+		return (-1);
+	for (i = 0; i < hrplen; i++) {
+		if (hrp[i] < 33 || hrp[i] > 126 ||
+		    (hrp[i] >= 'A' && hrp[i] <= 'Z'))
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * check_program(witver, proglen):
+ * Return 0 if a witness program of proglen bytes is valid for witver.
+ */
+static int
+check_program(int witver, size_t proglen)
+{
+
+	if (witver < 0 || witver > 16)
+		return (-1);
+	if (proglen < 2 || proglen > SEGWIT_PROGRAM_MAX)
+		return (-1);
+	if (witver == 0 && proglen != 20 && proglen != 32)
+		return (-1);
+	return (0);
+}
+
+int
+Segwit_Encode(char * out, size_t * outlen, const char * hrp, size_t hrplen,
+    int witver, const uint8_t * prog, size_t proglen)
+{
+	uint8_t data[1 + (SEGWIT_PROGRAM_MAX * 8 + 4) / 5 + 6];
+	size_t datalen, i;
+	uint32_t c;
+
+	if (check_hrp(hrp, hrplen) || check_program(witver, proglen))
+		return (-1);
+
+	/* The version, then the program, then the checksum. */
+	data[0] = (uint8_t)witver;
+	convert_bits(&data[1], &datalen, 5, prog, proglen, 8, 1);
+	datalen += 1;
+	if (hrplen + 1 + datalen + 6 > SEGWIT_ADDRESS_MAX)
+		return (-1);
+	memset(&data[datalen], 0, 6);
+	c = bech32_polymod(hrp, hrplen, data, datalen + 6) ^
+	    (witver == 0 ? BECH32_CONST : BECH32M_CONST);
+	for (i = 0; i < 6; i++)
+		data[datalen + i] = (c >> (5 * (5 - i))) & 0x1f;
+	datalen += 6;
+
+	memcpy(out, hrp, hrplen);
+	out[hrplen] = '1';
+	for (i = 0; i < datalen; i++)
+		out[hrplen + 1 + i] = CHARSET[data[i]];
+	*outlen = hrplen + 1 + datalen;
+	return (0);
+}
+
+int
+Segwit_Decode(int * witver, uint8_t * prog, size_t * proglen,
+    const char * hrp, size_t hrplen, const char * addr, size_t addrlen)
+{
+	uint8_t data[SEGWIT_ADDRESS_MAX];
+	size_t sep, datalen, i;
+	uint32_t c;
+	int lo = 0, up = 0, v;
+
+	if (addrlen > SEGWIT_ADDRESS_MAX || check_hrp(hrp, hrplen))
+		return (-1);
+
+	/* Mixed case is not allowed, and the separator is the last '1'. */
+	for (i = 0; i < addrlen; i++) {
+		if (addr[i] >= 'a' && addr[i] <= 'z')
+			lo = 1;
+		if (addr[i] >= 'A' && addr[i] <= 'Z')
+			up = 1;
+	}
+	if (lo && up)
+		return (-1);
+	for (sep = addrlen; sep > 0 && addr[sep - 1] != '1'; sep--)
+		continue;
+	if (sep == 0 || sep - 1 != hrplen || addrlen - sep < 6)
+		return (-1);
+	for (i = 0; i < hrplen; i++) {
+		if (lower(addr[i]) != hrp[i])
+			return (-1);
+	}
+
+	datalen = addrlen - sep;
+	for (i = 0; i < datalen; i++) {
+		if ((v = charset_value(lower(addr[sep + i]))) < 0)
+			return (-1);
+		data[i] = (uint8_t)v;
+	}
+
+	/* The version picks the checksum flavour. */
+	c = bech32_polymod(hrp, hrplen, data, datalen);
+	if (datalen < 7 ||
+	    c != (data[0] == 0 ? BECH32_CONST : BECH32M_CONST))
+		return (-1);
+	if (convert_bits(prog, proglen, 8, &data[1], datalen - 7, 5, 0))
+		return (-1);
+	if (check_program(data[0], *proglen))
+		return (-1);
+	*witver = data[0];
+	return (0);
+}
+
+/**
+ * cashaddr_polymod(prefix, prefixlen, data, datalen):
+ * Return the 40-bit CashAddr checksum of the lower-case
+ * prefix[0 .. prefixlen - 1] and the 5-bit values data[0 .. datalen - 1].
+ */
+static uint64_t
+cashaddr_polymod(const char * prefix, size_t prefixlen,
+    const uint8_t * data, size_t datalen)
+{
+	uint64_t c = 1;
+	uint8_t b;
+	size_t i, n = prefixlen + 1 + datalen;
+	uint8_t v;
+
+	for (i = 0; i < n; i++) {
+		if (i < prefixlen)
+			v = prefix[i] & 0x1f;
+		else if (i == prefixlen)
+			v = 0;
+		else
+			v = data[i - prefixlen - 1];
+		b = (uint8_t)(c >> 35);
+		c = ((c & 0x07ffffffffULL) << 5) ^ v;
+		if (b & 0x01)
+			c ^= 0x98f2bc8e61ULL;
+		if (b & 0x02)
+			c ^= 0x79b76d99e2ULL;
+		if (b & 0x04)
+			c ^= 0xf33e5fb3c4ULL;
+		if (b & 0x08)
+			c ^= 0xae2eabe2a8ULL;
+		if (b & 0x10)
+			c ^= 0x1e4f43e470ULL;
+	}
+	return (c ^ CASHADDR_CONST);
+}
+
+/**
+ * cashaddr_size(hashlen):
+ * Return the version size bits for a hashlen-byte hash, or -1 if there
+ * are none.
+ */
+static int
+cashaddr_size(size_t hashlen)
+{
+	static const size_t sizes[8] = { 20, 24, 28, 32, 40, 48, 56, 64 };
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		if (sizes[i] == hashlen)
+			return (i);
+	}
+	return (-1);
+}
+
+/**
+ * check_prefix(prefix, prefixlen):
+ * Return 0 if prefix[0 .. prefixlen - 1] is a valid lower-case prefix.
+ */
+static int
+check_prefix(const char * prefix, size_t prefixlen)
+{
+	size_t i;
+
+	if (prefixlen < 1)
+		return (-1);
+	for (i = 0; i < prefixlen; i++) {
+		if (!((prefix[i] >= 'a' && prefix[i] <= 'z') ||
+		    (prefix[i] >= '0' && prefix[i] <= '9')))
+			return (-1);
+	}
+	return (0);
+}
+
+int
+CashAddr_Encode(char * out, size_t * outlen, const char * prefix,
+    size_t prefixlen, int type, const uint8_t * hash, size_t hashlen)
+{
+	uint8_t payload[1 + CASHADDR_HASH_MAX];
+	uint8_t data[(8 * sizeof(payload) + 4) / 5 + 8];
+	size_t datalen, i;
+	uint64_t c;
+	int size;
+
+	if (check_prefix(prefix, prefixlen) || type < 0 || type > 15 ||
+	    (size = cashaddr_size(hashlen)) < 0)
+		return (-1);
+
+	/* The version byte, then the hash, then the checksum. */
+	payload[0] = (uint8_t)((type << 3) | size);
+	memcpy(&payload[1], hash, hashlen);
+	convert_bits(data, &datalen, 5, payload, 1 + hashlen, 8, 1);
+	memset(&data[datalen], 0, 8);
+	c = cashaddr_polymod(prefix, prefixlen, data, datalen + 8);
+	for (i = 0; i < 8; i++)
+		data[datalen + i] = (c >> (5 * (7 - i))) & 0x1f;
+	datalen += 8;
+
+	memcpy(out, prefix, prefixlen);
+	out[prefixlen] = ':';
+	for (i = 0; i < datalen; i++)
+		out[prefixlen + 1 + i] = CHARSET[data[i]];
+	*outlen = prefixlen + 1 + datalen;
+
+	/* Clean the stack. */
+	memset(payload, 0, sizeof(payload));
+	return (0);
+}
+
+int
+CashAddr_Decode(int * type, uint8_t * hash, size_t * hashlen,
+    const char * prefix, size_t prefixlen, const char * addr,
+    size_t addrlen)
+{
+	uint8_t data[112];
+	uint8_t payload[(5 * sizeof(data)) / 8];
+	size_t start = 0, datalen, payloadlen, i;
+	int lo = 0, up = 0, v;
+
+	if (check_prefix(prefix, prefixlen))
+		return (-1);
+
+	/* Mixed case is not allowed, and the prefix is optional. */
+	for (i = 0; i < addrlen; i++) {
+		if (addr[i] >= 'a' && addr[i] <= 'z')
+			lo = 1;
+		if (addr[i] >= 'A' && addr[i] <= 'Z')
+			up = 1;
+	}
+	if (lo && up)
+		return (-1);
+	if (memchr(addr, ':', addrlen) != NULL) {
+		if (addrlen <= prefixlen || addr[prefixlen] != ':')
+			return (-1);
+		for (i = 0; i < prefixlen; i++) {
+			if (lower(addr[i]) != prefix[i])
+				return (-1);
+		}
+		start = prefixlen + 1;
+	}
+
+	datalen = addrlen - start;
+	if (datalen <= 8 || datalen > sizeof(data))
+		return (-1);
+	for (i = 0; i < datalen; i++) {
+		if ((v = charset_value(lower(addr[start + i]))) < 0)
+			return (-1);
+		data[i] = (uint8_t)v;
+	}
+	if (cashaddr_polymod(prefix, prefixlen, data, datalen) != 0)
+		return (-1);
+
+	/* The version byte has a reserved top bit, and sizes the hash. */
+	if (convert_bits(payload, &payloadlen, 8, data, datalen - 8, 5, 0))
+		return (-1);
+	if (payloadlen < 1 || (payload[0] & 0x80) ||
+	    cashaddr_size(payloadlen - 1) != (payload[0] & 0x07))
+		return (-1);
+	*type = payload[0] >> 3;
+	*hashlen = payloadlen - 1;
+	memcpy(hash, &payload[1], *hashlen);
+	return (0);
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _BECH32_H_
+#define _BECH32_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/*
+ * Segwit addresses, in bech32 (BIP173) for witness version 0 and in
+ * bech32m (BIP350) for later versions, and Bitcoin Cash CashAddr
+ * addresses, which use the same alphabet with a longer checksum.
+ */
+
+/* The longest segwit address, and the longest witness program. */
+#define SEGWIT_ADDRESS_MAX	90
+#define SEGWIT_PROGRAM_MAX	40
+
+/* The longest CashAddr hash, and the longest address for a prefix. */
+#define CASHADDR_HASH_MAX	64
+#define CASHADDR_ADDRESS_MAX(prefixlen)	((prefixlen) + 1 + 112)
+
+/**
+ * Segwit_Encode(out, outlen, hrp, hrplen, witver, prog, proglen):
+ * Encode the witness program prog[0 .. proglen - 1] of version witver
+ * with the human-readable part hrp[0 .. hrplen - 1], in lower case,
+ * into out, which must hold SEGWIT_ADDRESS_MAX characters. Store the
+ * address length in outlen. Return 0 on success, or -1 if the inputs
+ * cannot make a valid address.
+ */
+int	Segwit_Encode(char *, size_t *, const char *, size_t, int,
+    const uint8_t *, size_t);
+
+/**
+ * Segwit_Decode(witver, prog, proglen, hrp, hrplen, addr, addrlen):
+ * Decode the segwit address addr[0 .. addrlen - 1], which must have the
+ * human-readable part hrp[0 .. hrplen - 1] in either case. Store its
+ * witness version in witver and its program in prog, which must hold
+ * SEGWIT_PROGRAM_MAX bytes, with its length in proglen. Return 0 on
+ * success, or -1 if the address is invalid.
+ */
+int	Segwit_Decode(int *, uint8_t *, size_t *, const char *, size_t,
+    const char *, size_t);
+
+/**
+ * CashAddr_Encode(out, outlen, prefix, prefixlen, type, hash, hashlen):
+ * Encode the hash[0 .. hashlen - 1] of the given type (0 for P2PKH, 1 for
+ * P2SH) with the prefix[0 .. prefixlen - 1], in lower case, into out,
+ * which must hold CASHADDR_ADDRESS_MAX(prefixlen) characters. Store the
+ * address length in outlen. Return 0 on success, or -1 if the inputs
+ * cannot make a valid address.
+ */
+int	CashAddr_Encode(char *, size_t *, const char *, size_t, int,
+    const uint8_t *, size_t);
+
+/**
+ * CashAddr_Decode(type, hash, hashlen, prefix, prefixlen, addr, addrlen):
+ * Decode the CashAddr address addr[0 .. addrlen - 1], with or without
+ * its prefix, which must be prefix[0 .. prefixlen - 1] in either case.
+ * Store its type in type and its hash in hash, which must hold
+ * CASHADDR_HASH_MAX bytes, with its length in hashlen. Return 0 on
+ * success, or -1 if the address is invalid.
+ */
+int	CashAddr_Decode(int *, uint8_t *, size_t *, const char *, size_t,
+    const char *, size_t);
+
+#endif /* !_BECH32_H_ */
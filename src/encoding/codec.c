@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "codec.h"
+#include "codec_impl.h"
+
+static const char BASE64_ALPHABET[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static const char HEX_ALPHABET[] = "0123456789abcdef";
+
+/* Digit values by character, with 0xff for anything else. */
+static const uint8_t BASE64_VALUES[256] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0x3f,
+	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+	0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+	0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const uint8_t HEX_VALUES[256] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+/* Implementation selection. */
+static int codec_forced = CODEC_IMPL_AUTO;
+
+static int
+codec_available(int impl)
+{
+
+	switch (impl) {
+	case CODEC_IMPL_PORTABLE:
+		return (1);
+	case CODEC_IMPL_SSSE3:
+		return (codec_ssse3_available());
+	case CODEC_IMPL_AVX2:
+		return (codec_avx2_available());
+	case CODEC_IMPL_NEON:
+		return (codec_neon_available());
+	default:
+		return (0);
+	}
+}
+
+int
+Codec_SetImplementation(int impl)
+{
+
+	if (impl != CODEC_IMPL_AUTO && !codec_available(impl))
+		return (-1);
+	__atomic_store_n(&codec_forced, impl, __ATOMIC_RELAXED);
+	return (0);
+}
+
+int
+Codec_GetImplementation(void)
+{
+	int impl = __atomic_load_n(&codec_forced, __ATOMIC_RELAXED);
+
+	if (impl != CODEC_IMPL_AUTO)
+		return (impl);
+	if (codec_avx2_available())
+		return (CODEC_IMPL_AVX2);
+	if (codec_ssse3_available())
+		return (CODEC_IMPL_SSSE3);
+	if (codec_neon_available())
+		return (CODEC_IMPL_NEON);
+	return (CODEC_IMPL_PORTABLE);
+}
+
+void
+Base64_Encode(const uint8_t * in, size_t inlen, char * out)
+{
+	size_t done = 0;
+	uint32_t v;
+
+	switch (Codec_GetImplementation()) {
+	case CODEC_IMPL_AVX2:
+		done = codec_avx2_base64_encode(in, inlen, out);
+		done += codec_ssse3_base64_encode(&in[done], inlen - done,
+		    &out[done / 3 * 4]);
+		break;
+	case CODEC_IMPL_SSSE3:
+		done = codec_ssse3_base64_encode(in, inlen, out);
+		break;
+	case CODEC_IMPL_NEON:
+		done = codec_neon_base64_encode(in, inlen, out);
+		break;
+	}
+	in += done;
+	out += done / 3 * 4;
+	inlen -= done;
+
+	for (; inlen >= 3; inlen -= 3, in += 3, out += 4) {
+		v = (uint32_t)in[0] << 16 | (uint32_t)in[1] << 8 | in[2];
+		out[0] = BASE64_ALPHABET[v >> 18];
+		out[1] = BASE64_ALPHABET[(v >> 12) & 0x3f];
+		out[2] = BASE64_ALPHABET[(v >> 6) & 0x3f];
+		out[3] = BASE64_ALPHABET[v & 0x3f];
+	}
+
+	/* Pad out the last 1 or 2 bytes. */
+	if (inlen > 0) {
+		v = (uint32_t)in[0] << 16 | (inlen > 1 ? (uint32_t)in[1] << 8 : 0);
+		out[0] = BASE64_ALPHABET[v >> 18];
+		out[1] = BASE64_ALPHABET[(v >> 12) & 0x3f];
+		out[2] = inlen > 1 ? BASE64_ALPHABET[(v >> 6) & 0x3f] : '=';
+		out[3] = '=';
+	}
+}
+
+int
+Base64_Decode(const char * in, size_t inlen, uint8_t * out, size_t * outlen,
+    size_t * errpos)
+{
+	const uint8_t * p = (const uint8_t *)in;
+	size_t len = inlen, i = 0, o = 0, k;
+	uint32_t v, bad;
+	int padded;
+
+	/* Up to two padding characters can end the text. */
+	padded = len > 0 && p[len - 1] == '=';
+	if (padded)
+		len -= len > 1 && p[len - 2] == '=' ? 2 : 1;
+
+	switch (Codec_GetImplementation()) {
+	case CODEC_IMPL_AVX2:
+		i = codec_avx2_base64_decode(in, len, out);
+		i += codec_ssse3_base64_decode(&in[i], len - i, &out[i / 4 * 3]);
+		break;
+	case CODEC_IMPL_SSSE3:
+		i = codec_ssse3_base64_decode(in, len, out);
+		break;
+	case CODEC_IMPL_NEON:
+		i = codec_neon_base64_decode(in, len, out);
+		break;
+	}
+	o = i / 4 * 3;
+
+	for (; i + 4 <= len; i += 4, o += 3) {
+		bad = BASE64_VALUES[p[i]] | BASE64_VALUES[p[i + 1]] |
+		    BASE64_VALUES[p[i + 2]] | BASE64_VALUES[p[i + 3]];
+		if (bad & 0x80)
+			goto fail;
+		v = (uint32_t)BASE64_VALUES[p[i]] << 18 |
+		    (uint32_t)BASE64_VALUES[p[i + 1]] << 12 |
+		    (uint32_t)BASE64_VALUES[p[i + 2]] << 6 |
+		    BASE64_VALUES[p[i + 3]];
+		out[o] = (uint8_t)(v >> 16);
+		out[o + 1] = (uint8_t)(v >> 8);
+		out[o + 2] = (uint8_t)v;
+	}
+
+	/* The last 2 or 3 digits hold 1 or 2 bytes. */
+	if (i < len) {
+		for (k = i; k < len; k++) {
+			if (BASE64_VALUES[p[k]] & 0x80)
+				goto fail;
+		}
+		if (len - i == 1)
+			goto truncated;
+		v = (uint32_t)BASE64_VALUES[p[i]] << 18 |
+		    (uint32_t)BASE64_VALUES[p[i + 1]] << 12 |
+		    (len - i > 2 ? (uint32_t)BASE64_VALUES[p[i + 2]] << 6 : 0);
+		out[o++] = (uint8_t)(v >> 16);
+		if (len - i > 2)
+			out[o++] = (uint8_t)(v >> 8);
+	}
+
+	/* Padding has to fill out the last group of 4. */
+	if (padded && inlen % 4 != 0)
+		goto truncated;
+
+	*outlen = o;
+	return (0);
+
+fail:
+	/* Find the bad character in the group that failed. */
+	while (!(BASE64_VALUES[p[i]] & 0x80))
+		i++;
+	if (errpos != NULL)
+		*errpos = i;
+	return (-1);
+
+truncated:
+	if (errpos != NULL)
+		*errpos = inlen;
+	return (-1);
+}
+
+void
+Hex_Encode(const uint8_t * in, size_t inlen, char * out)
+{
+	size_t done = 0;
+
+	switch (Codec_GetImplementation()) {
+	case CODEC_IMPL_AVX2:
+		done = codec_avx2_hex_encode(in, inlen, out);
+		done += codec_ssse3_hex_encode(&in[done], inlen - done,
+		    &out[2 * done]);
+		break;
+	case CODEC_IMPL_SSSE3:
+		done = codec_ssse3_hex_encode(in, inlen, out);
+		break;
+	case CODEC_IMPL_NEON:
+		done = codec_neon_hex_encode(in, inlen, out);
+		break;
+	}
+
+	for (; done < inlen; done++) {
+		out[2 * done] = HEX_ALPHABET[in[done] >> 4];
+		out[2 * done + 1] = HEX_ALPHABET[in[done] & 0xf];
+	}
+}
+
+int
+Hex_Decode(const char * in, size_t inlen, uint8_t * out, size_t * errpos)
+{
+	const uint8_t * p = (const uint8_t *)in;
+	size_t i = 0;
+	uint8_t hi, lo;
+
+	switch (Codec_GetImplementation()) {
+	case CODEC_IMPL_AVX2:
+		i = codec_avx2_hex_decode(in, inlen, out);
+		i += codec_ssse3_hex_decode(&in[i], inlen - i, &out[i / 2]);
+		break;
+	case CODEC_IMPL_SSSE3:
+		i = codec_ssse3_hex_decode(in, inlen, out);
+		break;
+	case CODEC_IMPL_NEON:
+		i = codec_neon_hex_decode(in, inlen, out);
+		break;
+	}
+
+	for (; i + 2 <= inlen; i += 2) {
+		hi = HEX_VALUES[p[i]];
+		lo = HEX_VALUES[p[i + 1]];
+		if ((hi | lo) & 0x80) {
+			if (errpos != NULL)
+				*errpos = hi & 0x80 ? i : i + 1;
+			return (-1);
+		}
+		out[i / 2] = (uint8_t)(hi << 4 | lo);
+	}
+
+	/* A leftover digit is only reported once the rest checks out. */
+	if (i < inlen) {
+		if (errpos != NULL)
+			*errpos = HEX_VALUES[p[i]] & 0x80 ? i : inlen;
+		return (-1);
+	}
+	return (0);
+}
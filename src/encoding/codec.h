@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _CODEC_H_
+#define _CODEC_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/* Kernel implementations, for Codec_SetImplementation. */
+#define CODEC_IMPL_AUTO		0
+#define CODEC_IMPL_PORTABLE	1
+#define CODEC_IMPL_SSSE3	2
+#define CODEC_IMPL_AVX2		3
+#define CODEC_IMPL_NEON		4
+
+/**
+ * BASE64_ENCODED_LEN(len):
+ * The padded base64 length of len bytes.
+ */
+#define BASE64_ENCODED_LEN(len)	(((len) + 2) / 3 * 4)
+
+/**
+ * BASE64_DECODED_MAX(len):
+ * The most bytes len characters of base64 can decode to.
+ */
+#define BASE64_DECODED_MAX(len)	(((len) + 3) / 4 * 3)
+
+/**
+ * Codec_SetImplementation(impl):
+ * Force a particular implementation for later calls, or go back to
+ * picking the fastest with CODEC_IMPL_AUTO. Return 0 on success, or -1
+ * if this CPU lacks the implementation.
+ */
+int	Codec_SetImplementation(int);
+
+/**
+ * Codec_GetImplementation():
+ * Return the implementation calls will use.
+ */
+int	Codec_GetImplementation(void);
+
+/**
+ * Base64_Encode(in, inlen, out):
+ * Encode in[0 .. inlen - 1] as padded base64 with the standard
+ * alphabet, into out, which must hold BASE64_ENCODED_LEN(inlen)
+ * characters. Nothing terminates the output.
+ */
+void	Base64_Encode(const uint8_t *, size_t, char *);
+
+/**
+ * Base64_Decode(in, inlen, out, outlen, errpos):
+ * Decode the standard base64 text in[0 .. inlen - 1], which may leave
+ * out its padding, into out, which must hold BASE64_DECODED_MAX(inlen)
+ * bytes, and store the decoded length in outlen. Return 0 on success,
+ * or -1 on failure, storing the offset of the first bad character in
+ * errpos, or inlen if the text stops partway through a byte. The
+ * errpos may be NULL.
+ */
+int	Base64_Decode(const char *, size_t, uint8_t *, size_t *, size_t *);
+
+/**
+ * Hex_Encode(in, inlen, out):
+ * Encode in[0 .. inlen - 1] as lower-case hex, into out, which must
+ * hold 2 * inlen characters. Nothing terminates the output.
+ */
+void	Hex_Encode(const uint8_t *, size_t, char *);
+
+/**
+ * Hex_Decode(in, inlen, out, errpos):
+ * Decode the upper or lower-case hex text in[0 .. inlen - 1] into out,
+ * which must hold inlen / 2 bytes. Return 0 on success, or -1 on
+ * failure, storing the offset of the first bad character in errpos, or
+ * inlen if the length is odd. The errpos may be NULL.
+ */
+int	Hex_Decode(const char *, size_t, uint8_t *, size_t *);
+
+#endif /* !_CODEC_H_ */
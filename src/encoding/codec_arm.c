@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "codec_impl.h"
+
+#if defined(__ARM_NEON)
+
+#include <arm_neon.h>
+
+/*
+ * NEON is part of the baseline on arm64, and every Android armv7 ABI
+ * we build for, so this needs no runtime check. The interleaving loads
+ * and stores do the heavy lifting: vld3q splits 48 bytes into the
+ * first, second, and third bytes of each group, and vst4q weaves four
+ * vectors of digits back together, so the kernels only need shifts and
+ * range checks, which armv7 and arm64 both have.
+ */
+
+/**
+ * all_set(v):
+ * Return non-zero if every byte of v is 0xff.
+ */
+static inline int
+all_set(uint8x16_t v)
+{
+	uint64x2_t w = vreinterpretq_u64_u8(v);
+
+	return ((vgetq_lane_u64(w, 0) & vgetq_lane_u64(w, 1)) == UINT64_MAX);
+}
+
+/**
+ * base64_chars(v):
+ * Turn 6-bit digits into base64 characters.
+ */
+static inline uint8x16_t
+base64_chars(uint8x16_t v)
+{
+	uint8x16_t offset = vdupq_n_u8('A');
+
+	/* Each range moves the offset along from the one before. */
+	offset = vaddq_u8(offset, vandq_u8(vcgeq_u8(v, vdupq_n_u8(26)),
+	    vdupq_n_u8('a' - 26 - 'A')));
+	offset = vaddq_u8(offset, vandq_u8(vcgeq_u8(v, vdupq_n_u8(52)),
+	    vdupq_n_u8((uint8_t)('0' - 52 - ('a' - 26)))));
+	offset = vaddq_u8(offset, vandq_u8(vcgeq_u8(v, vdupq_n_u8(62)),
+	    vdupq_n_u8((uint8_t)('+' - 62 - ('0' - 52)))));
+	offset = vaddq_u8(offset, vandq_u8(vceqq_u8(v, vdupq_n_u8(63)),
+	    vdupq_n_u8('/' - 63 - ('+' - 62))));
+	return (vaddq_u8(v, offset));
+}
+
+/**
+ * base64_digits(c, ok):
+ * Turn base64 characters into 6-bit digits, and clear the bytes of ok
+ * where c holds anything else.
+ */
+static inline uint8x16_t
+base64_digits(uint8x16_t c, uint8x16_t * ok)
+{
+	uint8x16_t upper, lower, digit, plus, slash;
+
+	upper = vcleq_u8(vsubq_u8(c, vdupq_n_u8('A')), vdupq_n_u8(25));
+	lower = vcleq_u8(vsubq_u8(c, vdupq_n_u8('a')), vdupq_n_u8(25));
+	digit = vcleq_u8(vsubq_u8(c, vdupq_n_u8('0')), vdupq_n_u8(9));
+	plus = vceqq_u8(c, vdupq_n_u8('+'));
+	slash = vceqq_u8(c, vdupq_n_u8('/'));
+	*ok = vandq_u8(*ok, vorrq_u8(vorrq_u8(upper, lower),
+	    vorrq_u8(digit, vorrq_u8(plus, slash))));
+
+	return (vorrq_u8(vorrq_u8(
+	    vandq_u8(upper, vsubq_u8(c, vdupq_n_u8('A'))),
+	    vandq_u8(lower, vsubq_u8(c, vdupq_n_u8('a' - 26)))),
+	    vorrq_u8(vandq_u8(digit, vaddq_u8(c, vdupq_n_u8(52 - '0'))),
+	    vorrq_u8(vandq_u8(plus, vdupq_n_u8(62)),
+	    vandq_u8(slash, vdupq_n_u8(63))))));
+}
+
+/**
+ * hex_digits(c, ok):
+ * Turn hex characters into 4-bit digits, and clear the bytes of ok
+ * where c holds anything else.
+ */
+static inline uint8x16_t
+hex_digits(uint8x16_t c, uint8x16_t * ok)
+{
+	uint8x16_t digit, letter, is_digit, is_letter;
+
+	digit = vsubq_u8(c, vdupq_n_u8('0'));
+	letter = vsubq_u8(vorrq_u8(c, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+	is_digit = vcleq_u8(digit, vdupq_n_u8(9));
+	is_letter = vcleq_u8(letter, vdupq_n_u8(5));
+	*ok = vandq_u8(*ok, vorrq_u8(is_digit, is_letter));
+
+	return (vorrq_u8(vandq_u8(is_digit, digit),
+	    vandq_u8(is_letter, vaddq_u8(letter, vdupq_n_u8(10)))));
+}
+
+/**
+ * hex_chars(v):
+ * Turn 4-bit digits into lower-case hex characters.
+ */
+static inline uint8x16_t
+hex_chars(uint8x16_t v)
+{
+
+	return (vaddq_u8(vaddq_u8(v, vdupq_n_u8('0')),
+	    vandq_u8(vcgtq_u8(v, vdupq_n_u8(9)), vdupq_n_u8('a' - '0' - 10))));
+}
+
+int
+codec_neon_available(void)
+{
+
+	return (1);
+}
+
+size_t
+codec_neon_base64_encode(const uint8_t * in, size_t inlen, char * out)
+{
+	uint8x16x3_t x;
+	uint8x16x4_t y;
+	size_t done;
+
+	for (done = 0; done + 48 <= inlen; done += 48, out += 64) {
+		x = vld3q_u8(&in[done]);
+		y.val[0] = vshrq_n_u8(x.val[0], 2);
+		y.val[1] = vorrq_u8(vshlq_n_u8(vandq_u8(x.val[0],
+		    vdupq_n_u8(0x03)), 4), vshrq_n_u8(x.val[1], 4));
+		y.val[2] = vorrq_u8(vshlq_n_u8(vandq_u8(x.val[1],
+		    vdupq_n_u8(0x0f)), 2), vshrq_n_u8(x.val[2], 6));
+		y.val[3] = vandq_u8(x.val[2], vdupq_n_u8(0x3f));
+		y.val[0] = base64_chars(y.val[0]);
+		y.val[1] = base64_chars(y.val[1]);
+		y.val[2] = base64_chars(y.val[2]);
+		y.val[3] = base64_chars(y.val[3]);
+		vst4q_u8((uint8_t *)out, y);
+	}
+	return (done);
+}
+
+size_t
+codec_neon_base64_decode(const char * in, size_t inlen, uint8_t * out)
+{
+	uint8x16x4_t x;
+	uint8x16x3_t y;
+	uint8x16_t ok;
+	size_t done;
+
+	for (done = 0; done + 64 <= inlen; done += 64, out += 48) {
+		x = vld4q_u8((const uint8_t *)&in[done]);
+		ok = vdupq_n_u8(0xff);
+		x.val[0] = base64_digits(x.val[0], &ok);
+		x.val[1] = base64_digits(x.val[1], &ok);
+		x.val[2] = base64_digits(x.val[2], &ok);
+		x.val[3] = base64_digits(x.val[3], &ok);
+		if (!all_set(ok))
+			break;
+		y.val[0] = vorrq_u8(vshlq_n_u8(x.val[0], 2),
+		    vshrq_n_u8(x.val[1], 4));
+		y.val[1] = vorrq_u8(vshlq_n_u8(x.val[1], 4),
+		    vshrq_n_u8(x.val[2], 2));
+		y.val[2] = vorrq_u8(vshlq_n_u8(x.val[2], 6), x.val[3]);
+		vst3q_u8(out, y);
+	}
+	return (done);
+}
+
+size_t
+codec_neon_hex_encode(const uint8_t * in, size_t inlen, char * out)
+{
+	uint8x16x2_t y;
+	uint8x16_t x;
+	size_t done;
+
+	for (done = 0; done + 16 <= inlen; done += 16, out += 32) {
+		x = vld1q_u8(&in[done]);
+		y.val[0] = hex_chars(vshrq_n_u8(x, 4));
+		y.val[1] = hex_chars(vandq_u8(x, vdupq_n_u8(0x0f)));
+		vst2q_u8((uint8_t *)out, y);
+	}
+	return (done);
+}
+
+size_t
+codec_neon_hex_decode(const char * in, size_t inlen, uint8_t * out)
+{
+	uint8x16x2_t x;
+	uint8x16_t ok, hi, lo;
+	size_t done;
+
+	for (done = 0; done + 32 <= inlen; done += 32, out += 16) {
+		x = vld2q_u8((const uint8_t *)&in[done]);
+		ok = vdupq_n_u8(0xff);
+		hi = hex_digits(x.val[0], &ok);
+		lo = hex_digits(x.val[1], &ok);
+		if (!all_set(ok))
+			break;
+		vst1q_u8(out, vorrq_u8(vshlq_n_u8(hi, 4), lo));
+	}
+	return (done);
+}
+
+#else
+
+int
+codec_neon_available(void)
+{
+
+	return (0);
+}
+
+size_t
+codec_neon_base64_encode(const uint8_t * in, size_t inlen, char * out)
+{
+
+	(void)in;
+	(void)inlen;
+	(void)out;
+	return (0);
+}
+
+size_t
+codec_neon_base64_decode(const char * in, size_t inlen, uint8_t * out)
+{
+
+	(void)in;
+	(void)inlen;
+	(void)out;
+	return (0);
+}
+
+size_t
+codec_neon_hex_encode(const uint8_t * in, size_t inlen, char * out)
+{
+
+	(void)in;
+	(void)inlen;
+	(void)out;
+	return (0);
+}
+
+size_t
+codec_neon_hex_decode(const char * in, size_t inlen, uint8_t * out)
+{
+
+	(void)in;
+	(void)inlen;
+	(void)out;
+	return (0);
+}
+
+#endif
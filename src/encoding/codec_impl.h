@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _CODEC_IMPL_H_
+#define _CODEC_IMPL_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/*
+ * Vector kernels. Each one handles as many whole blocks as fit its
+ * width and returns how much input it consumed, leaving the rest to
+ * the portable code. The decoders stop in front of the first block
+ * holding anything other than plain digits, including padding, so the
+ * portable code can handle the end of the text and pinpoint errors.
+ * The *_available functions report whether this CPU can run the
+ * kernels; kernels for other architectures are stubs.
+ */
+
+int	codec_ssse3_available(void);
+int	codec_avx2_available(void);
+int	codec_neon_available(void);
+
+size_t	codec_ssse3_base64_encode(const uint8_t *, size_t, char *);
+size_t	codec_ssse3_base64_decode(const char *, size_t, uint8_t *);
+size_t	codec_ssse3_hex_encode(const uint8_t *, size_t, char *);
+size_t	codec_ssse3_hex_decode(const char *, size_t, uint8_t *);
+
+size_t	codec_avx2_base64_encode(const uint8_t *, size_t, char *);
+size_t	codec_avx2_base64_decode(const char *, size_t, uint8_t *);
+size_t	codec_avx2_hex_encode(const uint8_t *, size_t, char *);
+size_t	codec_avx2_hex_decode(const char *, size_t, uint8_t *);
+
+size_t	codec_neon_base64_encode(const uint8_t *, size_t, char *);
+size_t	codec_neon_base64_decode(const char *, size_t, uint8_t *);
+size_t	codec_neon_hex_encode(const uint8_t *, size_t, char *);
+size_t	codec_neon_hex_decode(const char *, size_t, uint8_t *);
+
+#endif /* !_CODEC_IMPL_H_ */
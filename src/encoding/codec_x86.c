@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "codec_impl.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+/* Only these functions use the extensions, so the rest of the library
+ * still runs on older CPUs. */
+#define CODEC_SSSE3_TARGET __attribute__((target("ssse3")))
+#define CODEC_AVX2_TARGET __attribute__((target("avx2")))
+
+/*
+ * The base64 kernels follow Wojciech Muła's vector codecs. Encoding
+ * shuffles each 3 input bytes into a 32-bit word, pulls the four 6-bit
+ * digits out with a pair of multiplies, and turns digits into
+ * characters with a 16-entry table of offsets. Decoding classifies each
+ * character by its two nibbles, which rejects anything outside the
+ * alphabet, adds a per-class offset, and then packs the digits back
+ * together with multiply-adds.
+ *
+ * The hex kernels look up nibbles in a 16-entry table to encode, and
+ * decode with range checks on each character and a multiply-add to
+ * join each pair of digits.
+ */
+
+int
+codec_ssse3_available(void)
+{
+	static int available = -1;
+	unsigned int a, b, c, d;
+	int result = __atomic_load_n(&available, __ATOMIC_RELAXED);
+
+	if (result < 0) {
+		result = __get_cpuid(1, &a, &b, &c, &d) && (c & bit_SSSE3);
+		__atomic_store_n(&available, result, __ATOMIC_RELAXED);
+	}
+	return (result);
+}
+
+int
+codec_avx2_available(void)
+{
+	static int available = -1;
+	unsigned int a, b, c, d, xcr0, xcr0_hi;
+	int result = __atomic_load_n(&available, __ATOMIC_RELAXED);
+
+	if (result < 0) {
+		result = 0;
+
+		/* The OS has to save the YMM registers, as well. */
+		if (__get_cpuid(1, &a, &b, &c, &d) && (c & bit_OSXSAVE) &&
+		    (c & bit_AVX) && __get_cpuid_max(0, NULL) >= 7) {
+			__asm__ ("xgetbv" : "=a" (xcr0), "=d" (xcr0_hi) : "c" (0));
+			__cpuid_count(7, 0, a, b, c, d);
+			result = ((xcr0 & 6) == 6) && (b & bit_AVX2);
+		}
+		__atomic_store_n(&available, result, __ATOMIC_RELAXED);
+	}
+	return (result);
+}
+
+/* Base64 encoding, on 12 bytes in the low part of each 128-bit lane. */
+#define BASE64_ENCODE(W, in, out) do {					\
+	in = W(shuffle_epi8)(in, W(table_epi8)(1, 0, 2, 1, 4, 3, 5, 4,	\
+	    7, 6, 8, 7, 10, 9, 11, 10));				\
+	out = W(or_si)(							\
+	    W(mulhi_epu16)(W(and_si)(in, W(set1_epi32)(0x0fc0fc00)),	\
+	    W(set1_epi32)(0x04000040)),					\
+	    W(mullo_epi16)(W(and_si)(in, W(set1_epi32)(0x003f03f0)),	\
+	    W(set1_epi32)(0x01000010)));				\
+	/* Offset classes: 0 for A-Z, 1 for a-z, 2-11 for 0-9, 12	\
+	 * for +, and 13 for /. */					\
+	in = W(subs_epu8)(out, W(set1_epi8)(51));			\
+	in = W(or_si)(in, W(and_si)(W(cmpgt_epi8)(W(set1_epi8)(26), out), \
+	    W(set1_epi8)(13)));						\
+	out = W(add_epi8)(out, W(shuffle_epi8)(W(table_epi8)('a' - 26,	\
+	    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,	\
+	    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63,	\
+	    'A', 0, 0), in));						\
+} while (0)
+
+/* Base64 decoding. Sets bad to all ones in any byte that is not a
+ * base64 digit, and leaves 12 bytes in the low part of each lane. */
+#define BASE64_DECODE(W, in, out, bad) do {				\
+	out = W(and_si)(W(srli_epi32)(in, 4), W(set1_epi8)(0x0f));	\
+	bad = W(and_si)(						\
+	    W(shuffle_epi8)(W(table_epi8)(0x15, 0x11, 0x11, 0x11, 0x11,	\
+	    0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b,	\
+	    0x1a), W(and_si)(in, W(set1_epi8)(0x0f))),			\
+	    W(shuffle_epi8)(W(table_epi8)(0x10, 0x10, 0x01, 0x02, 0x04,	\
+	    0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,	\
+	    0x10), out));						\
+	bad = W(cmpgt_epi8)(bad, W(setzero_si)());			\
+	out = W(add_epi8)(in, W(shuffle_epi8)(W(table_epi8)(0, 16, 19,	\
+	    4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0),		\
+	    W(add_epi8)(W(cmpeq_epi8)(in, W(set1_epi8)('/')), out)));	\
+	out = W(madd_epi16)(W(maddubs_epi16)(out,			\
+	    W(set1_epi32)(0x01400140)), W(set1_epi32)(0x00011000));	\
+	out = W(shuffle_epi8)(out, W(table_epi8)(2, 1, 0, 6, 5, 4, 10, 9, \
+	    8, 14, 13, 12, -1, -1, -1, -1));				\
+} while (0)
+
+/* Hex decoding of one vector of digits, setting bad as above. */
+#define HEX_DECODE(W, in, out, bad) do {				\
+	__typeof__(in) digit, letter, is_digit, is_letter;		\
+	digit = W(sub_epi8)(in, W(set1_epi8)('0'));			\
+	letter = W(sub_epi8)(W(or_si)(in, W(set1_epi8)(0x20)),		\
+	    W(set1_epi8)('a'));						\
+	is_digit = W(cmpeq_epi8)(W(min_epu8)(digit, W(set1_epi8)(9)), digit); \
+	is_letter = W(cmpeq_epi8)(W(min_epu8)(letter, W(set1_epi8)(5)),	\
+	    letter);							\
+	out = W(or_si)(W(and_si)(is_digit, digit), W(and_si)(is_letter,	\
+	    W(add_epi8)(letter, W(set1_epi8)(10))));			\
+	bad = W(cmpeq_epi8)(W(or_si)(is_digit, is_letter), W(setzero_si)()); \
+	/* Join each pair of digits into 16 bits, high digit first. */	\
+	out = W(maddubs_epi16)(out, W(set1_epi16)(0x0110));		\
+} while (0)
+
+#define SSE(name) _mm_##name
+#define _mm_and_si _mm_and_si128
+#define _mm_or_si _mm_or_si128
+#define _mm_setzero_si _mm_setzero_si128
+
+#define AVX(name) _mm256_##name
+#define _mm256_and_si _mm256_and_si256
+#define _mm256_or_si _mm256_or_si256
+#define _mm256_setzero_si _mm256_setzero_si256
+
+/* The 16-entry tables, repeated in each 128-bit lane. */
+#define _mm_table_epi8 _mm_setr_epi8
+#define _mm256_table_epi8(...)						\
+	_mm256_broadcastsi128_si256(_mm_setr_epi8(__VA_ARGS__))
+
+CODEC_SSSE3_TARGET size_t
+codec_ssse3_base64_encode(const uint8_t * in, size_t inlen, char * out)
+{
+	__m128i x, y;
+	size_t done;
+
+	/* Each load reads 16 bytes but uses 12. */
+	for (done = 0; done + 16 <= inlen; done += 12, out += 16) {
+		x = _mm_loadu_si128((const __m128i *)&in[done]);
+		BASE64_ENCODE(SSE, x, y);
+		_mm_storeu_si128((__m128i *)out, y);
+	}
+	return (done);
+}
+
+CODEC_SSSE3_TARGET size_t
+codec_ssse3_base64_decode(const char * in, size_t inlen, uint8_t * out)
+{
+	__m128i x, y, bad;
+	size_t done;
+
+	/* Each store writes 16 bytes but fills 12. The 8 characters we
+	 * leave over guarantee room for the other 4. */
+	for (done = 0; done + 24 <= inlen; done += 16, out += 12) {
+		x = _mm_loadu_si128((const __m128i *)&in[done]);
+		BASE64_DECODE(SSE, x, y, bad);
+		if (_mm_movemask_epi8(bad) != 0)
+			break;
+		_mm_storeu_si128((__m128i *)out, y);
+	}
+	return (done);
+}
+
+CODEC_SSSE3_TARGET size_t
+codec_ssse3_hex_encode(const uint8_t * in, size_t inlen, char * out)
+{
+	const __m128i digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5',
+	    '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+	const __m128i mask = _mm_set1_epi8(0x0f);
+	__m128i x, hi, lo;
+	size_t done;
+
+	for (done = 0; done + 16 <= inlen; done += 16, out += 32) {
+		x = _mm_loadu_si128((const __m128i *)&in[done]);
+		hi = _mm_shuffle_epi8(digits,
+		    _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+		lo = _mm_shuffle_epi8(digits, _mm_and_si128(x, mask));
+		_mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi8(hi, lo));
+		_mm_storeu_si128((__m128i *)&out[16],
+		    _mm_unpackhi_epi8(hi, lo));
+	}
+	return (done);
+}
+
+CODEC_SSSE3_TARGET size_t
+codec_ssse3_hex_decode(const char * in, size_t inlen, uint8_t * out)
+{
+	__m128i a, b, bad_a, bad_b;
+	size_t done;
+
+	for (done = 0; done + 32 <= inlen; done += 32, out += 16) {
+		a = _mm_loadu_si128((const __m128i *)&in[done]);
+		b = _mm_loadu_si128((const __m128i *)&in[done + 16]);
+		HEX_DECODE(SSE, a, a, bad_a);
+		HEX_DECODE(SSE, b, b, bad_b);
+		if (_mm_movemask_epi8(_mm_or_si128(bad_a, bad_b)) != 0)
+			break;
+		_mm_storeu_si128((__m128i *)out, _mm_packus_epi16(a, b));
+	}
+	return (done);
+}
+
+CODEC_AVX2_TARGET size_t
+codec_avx2_base64_encode(const uint8_t * in, size_t inlen, char * out)
+{
+	__m256i x, y;
+	size_t done;
+
+	/* Each lane loads 16 bytes and uses 12, so the second lane
+	 * starts 12 bytes in. */
+	for (done = 0; done + 28 <= inlen; done += 24, out += 32) {
+		x = _mm256_inserti128_si256(_mm256_castsi128_si256(
+		    _mm_loadu_si128((const __m128i *)&in[done])),
+		    _mm_loadu_si128((const __m128i *)&in[done + 12]), 1);
+		BASE64_ENCODE(AVX, x, y);
+		_mm256_storeu_si256((__m256i *)out, y);
+	}
+	return (done);
+}
+
+CODEC_AVX2_TARGET size_t
+codec_avx2_base64_decode(const char * in, size_t inlen, uint8_t * out)
+{
+	__m256i x, y, bad;
+	size_t done;
+
+	/* Each store writes 32 bytes but fills 24. The 12 characters we
+	 * leave over guarantee room for the other 8. */
+	for (done = 0; done + 44 <= inlen; done += 32, out += 24) {
+		x = _mm256_loadu_si256((const __m256i *)&in[done]);
+		BASE64_DECODE(AVX, x, y, bad);
+		if (_mm256_movemask_epi8(bad) != 0)
+			break;
+		/* Close the gap between the two lanes. */
+		y = _mm256_permutevar8x32_epi32(y,
+		    _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+		_mm256_storeu_si256((__m256i *)out, y);
+	}
+	return (done);
+}
+
+CODEC_AVX2_TARGET size_t
+codec_avx2_hex_encode(const uint8_t * in, size_t inlen, char * out)
+{
+	const __m256i digits = _mm256_table_epi8('0', '1', '2', '3', '4',
+	    '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+	const __m256i mask = _mm256_set1_epi8(0x0f);
+	__m256i x, hi, lo, first, second;
+	size_t done;
+
+	for (done = 0; done + 32 <= inlen; done += 32, out += 64) {
+		x = _mm256_loadu_si256((const __m256i *)&in[done]);
+		hi = _mm256_shuffle_epi8(digits,
+		    _mm256_and_si256(_mm256_srli_epi16(x, 4), mask));
+		lo = _mm256_shuffle_epi8(digits, _mm256_and_si256(x, mask));
+
+		/* The unpacks work within lanes, so put them back in order. */
+		first = _mm256_unpacklo_epi8(hi, lo);
+		second = _mm256_unpackhi_epi8(hi, lo);
+		_mm256_storeu_si256((__m256i *)out,
+		    _mm256_permute2x128_si256(first, second, 0x20));
+		_mm256_storeu_si256((__m256i *)&out[32],
+		    _mm256_permute2x128_si256(first, second, 0x31));
+	}
+	return (done);
+}
+
+CODEC_AVX2_TARGET size_t
+codec_avx2_hex_decode(const char * in, size_t inlen, uint8_t * out)
+{
+	__m256i a, b, bad_a, bad_b;
+	size_t done;
+
+	for (done = 0; done + 64 <= inlen; done += 64, out += 32) {
+		a = _mm256_loadu_si256((const __m256i *)&in[done]);
+		b = _mm256_loadu_si256((const __m256i *)&in[done + 32]);
+		HEX_DECODE(AVX, a, a, bad_a);
+		HEX_DECODE(AVX, b, b, bad_b);
+		if (_mm256_movemask_epi8(_mm256_or_si256(bad_a, bad_b)) != 0)
+			break;
+
+		/* The pack works within lanes, so put them back in order. */
+		_mm256_storeu_si256((__m256i *)out, _mm256_permute4x64_epi64(
+		    _mm256_packus_epi16(a, b), 0xd8));
+	}
+	return (done);
+}
+
+#else
+
+int
+codec_ssse3_available(void)
+{
+
+	return (0);
+}
+
+int
+codec_avx2_available(void)
+{
+
+	return (0);
+}
+
+size_t
+codec_ssse3_base64_encode(const uint8_t * in, size_t inlen, char * out)
+{
+
+	(void)in;
+	(void)inlen;
+	(void)out;
+	return (0);
+}
+
+size_t
+codec_ssse3_base64_decode(const char * in, size_t inlen, uint8_t * out)
+{
+
+	(void)in;
+	(void)inlen;
+	(void)out;
+	return (0);
+}
+
+size_t
+codec_ssse3_hex_encode(const uint8_t * in, size_t inlen, char * out)
+{
+
+	(void)in;
+	(void)inlen;
+	(void)out;
+	return (0);
+}
+
+size_t
+codec_ssse3_hex_decode(const char * in, size_t inlen, uint8_t * out)
+{
+
+	(void)in;
+	(void)inlen;
+	(void)out;
+	return (0);
+}
+
+size_t
+codec_avx2_base64_encode(const uint8_t * in, size_t inlen, char * out)
+{
+
+	(void)in;
+	(void)inlen;
+	(void)out;
+	return (0);
+}
+
+size_t
+codec_avx2_base64_decode(const char * in, size_t inlen, uint8_t * out)
+{
+
+	(void)in;
+	(void)inlen;
+	(void)out;
+	return (0);
+}
+
+size_t
+codec_avx2_hex_encode(const uint8_t * in, size_t inlen, char * out)
+{
+
+	(void)in;
+	(void)inlen;
+	(void)out;
+	return (0);
+}
+
+size_t
+codec_avx2_hex_decode(const char * in, size_t inlen, uint8_t * out)
+{
+
+	(void)in;
+	(void)inlen;
+	(void)out;
+	return (0);
+}
+
+#endif
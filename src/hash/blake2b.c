@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../scrypt/sysendian.h"
+
+#include "blake2b.h"
+
+static const uint64_t IV[8] = {
+	0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL,
+	0xa54ff53a5f1d36f1ULL, 0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+	0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+
+static const uint8_t SIGMA[12][16] = {
+	{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+	{ 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 },
+	{ 11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4 },
+	{ 7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8 },
+	{ 9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13 },
+	{ 2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9 },
+	{ 12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11 },
+	{ 13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10 },
+	{ 6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5 },
+	{ 10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0 },
+	{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+	{ 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 }
+};
+
+#define ROTR64(x, n) (((x) >> (n)) | ((x) << (64 - (n))))
+
+#define G(m, r, i, a, b, c, d) do {					\
+	a = a + b + m[SIGMA[r][2 * i]];					\
+	d = ROTR64(d ^ a, 32);						\
+	c = c + d;							\
+	b = ROTR64(b ^ c, 24);						\
+	a = a + b + m[SIGMA[r][2 * i + 1]];				\
+	d = ROTR64(d ^ a, 16);						\
+	c = c + d;							\
+	b = ROTR64(b ^ c, 63);						\
+} while (0)
+
+/**
+ * blake2b_compress(ctx, block, last):
+ * Mix one 128-byte block into the state.
+ */
+static void
+blake2b_compress(BLAKE2B_CTX * ctx, const uint8_t block[128], int last)
+{
+	uint64_t m[16];
+	uint64_t v[16];
+	int i;
+
+	for (i = 0; i < 16; i++)
+		m[i] = le64dec(&block[8 * i]);
+	for (i = 0; i < 8; i++) {
+		v[i] = ctx->h[i];
+		v[i + 8] = IV[i];
+	}
+	v[12] ^= ctx->t[0];
+	v[13] ^= ctx->t[1];
+	if (last)
+		v[14] = ~v[14];
+
+	for (i = 0; i < 12; i++) {
+		G(m, i, 0, v[0], v[4], v[8], v[12]);
+		G(m, i, 1, v[1], v[5], v[9], v[13]);
+		G(m, i, 2, v[2], v[6], v[10], v[14]);
+		G(m, i, 3, v[3], v[7], v[11], v[15]);
+		G(m, i, 4, v[0], v[5], v[10], v[15]);
+		G(m, i, 5, v[1], v[6], v[11], v[12]);
+		G(m, i, 6, v[2], v[7], v[8], v[13]);
+		G(m, i, 7, v[3], v[4], v[9], v[14]);
+	}
+
+	for (i = 0; i < 8; i++)
+		ctx->h[i] ^= v[i] ^ v[i + 8];
+
+	/* Clean the stack. */
+	memset(m, 0, sizeof(m));
+	memset(v, 0, sizeof(v));
+}
+
+/**
+ * blake2b_count(ctx, len):
+ * Add len bytes to the 128-bit byte counter.
+ */
+static void
+blake2b_count(BLAKE2B_CTX * ctx, size_t len)
+{
+
+	ctx->t[0] += len;
+	if (ctx->t[0] < len)
+		ctx->t[1]++;
+}
+
+void
+BLAKE2b_Init(BLAKE2B_CTX * ctx, size_t outlen)
+{
+	int i;
+
+	for (i = 0; i < 8; i++)
+		ctx->h[i] = IV[i];
+
+	/* Parameter block: digest length, no key, fanout 1, depth 1. */
+	ctx->h[0] ^= 0x01010000 ^ (uint64_t)outlen;
+	ctx->t[0] = 0;
+	ctx->t[1] = 0;
+	ctx->buflen = 0;
+	ctx->outlen = outlen;
+}
+
+void
+BLAKE2b_Update(BLAKE2B_CTX * ctx, const void * _in, size_t len)
+{
+	const uint8_t * in = _in;
+	size_t n;
+
+	/*
+	 * The last block gets a flag, so a full buffer is only compressed
+	 * once more input shows up.
+	 */
+	while (len > 0) {
+		if (ctx->buflen == 128) {
+			blake2b_count(ctx, 128);
+			blake2b_compress(ctx, ctx->buf, 0);
+			ctx->buflen = 0;
+		}
+		n = 128 - ctx->buflen;
+		if (n > len)
+			n = len;
+		memcpy(&ctx->buf[ctx->buflen], in, n);
+		ctx->buflen += n;
+		in += n;
+		len -= n;
+	}
+}
+
+void
+BLAKE2b_Final(uint8_t * digest, BLAKE2B_CTX * ctx)
+{
+	uint8_t out[64];
+	int i;
+
+	blake2b_count(ctx, ctx->buflen);
+	memset(&ctx->buf[ctx->buflen], 0, 128 - ctx->buflen);
+	blake2b_compress(ctx, ctx->buf, 1);
+	for (i = 0; i < 8; i++)
+		le64enc(&out[8 * i], ctx->h[i]);
+	memcpy(digest, out, ctx->outlen);
+
+	/* Clean the stack and context. */
+	memset(out, 0, sizeof(out));
+	memset(ctx, 0, sizeof(*ctx));
+}
+
+void
+BLAKE2b(const void * in, size_t len, uint8_t * digest, size_t outlen)
+{
+	BLAKE2B_CTX ctx;
+
+	BLAKE2b_Init(&ctx, outlen);
+	BLAKE2b_Update(&ctx, in, len);
+	BLAKE2b_Final(digest, &ctx);
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _BLAKE2B_H_
+#define _BLAKE2B_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+typedef struct BLAKE2bContext {
+	uint64_t h[8];
+	uint64_t t[2];
+	uint8_t buf[128];
+	size_t buflen;
+	size_t outlen;
+} BLAKE2B_CTX;
+
+/**
+ * BLAKE2b_Init(ctx, outlen):
+ * Start an unkeyed BLAKE2b hash with an outlen-byte digest, where
+ * outlen is between 1 and 64.
+ */
+void	BLAKE2b_Init(BLAKE2B_CTX *, size_t);
+void	BLAKE2b_Update(BLAKE2B_CTX *, const void *, size_t);
+
+/**
+ * BLAKE2b_Final(digest, ctx):
+ * Output the digest, of the length given to BLAKE2b_Init, and clear
+ * the context.
+ */
+void	BLAKE2b_Final(uint8_t *, BLAKE2B_CTX *);
+
+/**
+ * BLAKE2b(in, len, digest, outlen):
+ * Compute the outlen-byte BLAKE2b hash of in[0 .. len - 1] in one step.
+ */
+void	BLAKE2b(const void *, size_t, uint8_t *, size_t);
+
+#endif /* !_BLAKE2B_H_ */
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../scrypt/sysendian.h"
+
+#include "keccak.h"
+
+/* Rate in bytes for a 256-bit capacity of 512 bits. */
+#define KECCAK256_RATE 136
+
+static const uint64_t RC[24] = {
+	0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+	0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+	0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+	0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+	0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+	0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+	0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+	0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+static const unsigned int ROTC[24] = {
+	1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14,
+	27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44
+};
+
+static const unsigned int PILN[24] = {
+	10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4,
+	15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1
+};
+
+#define ROTL64(x, n) (((x) << (n)) | ((x) >> (64 - (n))))
+
+/**
+ * keccakf(st):
+ * Apply the Keccak-f[1600] permutation to the state.
+ */
+static void
+keccakf(uint64_t st[25])
+{
+	uint64_t bc[5];
+	uint64_t t;
+	int i, j, round;
+
+	for (round = 0; round < 24; round++) {
+		/* Theta. */
+		for (i = 0; i < 5; i++)
+			bc[i] = st[i] ^ st[i + 5] ^ st[i + 10] ^ st[i + 15] ^
+			    st[i + 20];
+		for (i = 0; i < 5; i++) {
+			t = bc[(i + 4) % 5] ^ ROTL64(bc[(i + 1) % 5], 1);
+			for (j = 0; j < 25; j += 5)
+				st[j + i] ^= t;
+		}
+
+		/* Rho and pi. */
+		t = st[1];
+		for (i = 0; i < 24; i++) {
+			j = PILN[i];
+			bc[0] = st[j];
+			st[j] = ROTL64(t, ROTC[i]);
+			t = bc[0];
+		}
+
+		/* Chi. */
+		for (j = 0; j < 25; j += 5) {
+			for (i = 0; i < 5; i++)
+				bc[i] = st[j + i];
+			for (i = 0; i < 5; i++)
+				st[j + i] ^= (~bc[(i + 1) % 5]) & bc[(i + 2) % 5];
+		}
+
+		/* Iota. */
+		st[0] ^= RC[round];
+	}
+}
+
+/**
+ * keccak_absorb(ctx, in, len):
+ * XOR bytes into the state, starting at the current position.
+ */
+static void
+keccak_absorb(KECCAK256_CTX * ctx, const unsigned char * in, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		ctx->state[ctx->pos / 8] ^=
+		    (uint64_t)in[i] << (8 * (ctx->pos % 8));
+		if (++ctx->pos == KECCAK256_RATE) {
+			keccakf(ctx->state);
+			ctx->pos = 0;
+		}
+	}
+}
+
+void
+KECCAK256_Init(KECCAK256_CTX * ctx)
+{
+
+	memset(ctx, 0, sizeof(*ctx));
+}
+
+void
+KECCAK256_Update(KECCAK256_CTX * ctx, const void * in, size_t len)
+{
+	const unsigned char * src = in;
+	size_t i;
+
+	/* Absorb whole little-endian words when we are lane-aligned. */
+	while (ctx->pos == 0 && len >= KECCAK256_RATE) {
+		for (i = 0; i < KECCAK256_RATE / 8; i++)
+			ctx->state[i] ^= le64dec(&src[i * 8]);
+		keccakf(ctx->state);
+		src += KECCAK256_RATE;
+		len -= KECCAK256_RATE;
+	}
+
+	keccak_absorb(ctx, src, len);
+}
+
+void
+KECCAK256_Final(unsigned char digest[32], KECCAK256_CTX * ctx)
+{
+	int i;
+
+	/* Original Keccak multi-rate padding: 0x01 ... 0x80. */
+	ctx->state[ctx->pos / 8] ^= (uint64_t)0x01 << (8 * (ctx->pos % 8));
+	ctx->state[(KECCAK256_RATE - 1) / 8] ^=
+	    (uint64_t)0x80 << (8 * ((KECCAK256_RATE - 1) % 8));
+	keccakf(ctx->state);
+
+	for (i = 0; i < 4; i++)
+		le64enc(&digest[i * 8], ctx->state[i]);
+
+	/* Clear the context state. */
+	memset(ctx, 0, sizeof(*ctx));
+}
+
+void
+KECCAK256(const void * in, size_t len, unsigned char digest[32])
+{
+	KECCAK256_CTX ctx;
+
+	KECCAK256_Init(&ctx);
+	KECCAK256_Update(&ctx, in, len);
+	KECCAK256_Final(digest, &ctx);
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _KECCAK_H_
+#define _KECCAK_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/*
+ * Keccak-256, as used by Ethereum. This is the original Keccak padding,
+ * which differs from the final FIPS 202 SHA3-256 standard.
+ */
+typedef struct KECCAK256Context {
+	uint64_t state[25];
+	size_t pos;
+} KECCAK256_CTX;
+
+void	KECCAK256_Init(KECCAK256_CTX *);
+void	KECCAK256_Update(KECCAK256_CTX *, const void *, size_t);
+void	KECCAK256_Final(unsigned char [32], KECCAK256_CTX *);
+
+/**
+ * KECCAK256(in, len, digest):
+ * Compute the Keccak-256 hash of in[0 .. len - 1] in one step.
+ */
+void	KECCAK256(const void *, size_t, unsigned char [32]);
+
+#endif /* !_KECCAK_H_ */
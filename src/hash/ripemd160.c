@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../scrypt/sha256.h"
+#include "../scrypt/sysendian.h"
+
+#include "ripemd160.h"
+
+/* Message word order and rotation amounts for the left and right lines. */
+static const unsigned char RL[80] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	7, 4, 13, 1, 10, 6, 15, 3, 12, 0, 9, 5, 2, 14, 11, 8,
+	3, 10, 14, 4, 9, 15, 8, 1, 2, 7, 0, 6, 13, 11, 5, 12,
+	1, 9, 11, 10, 0, 8, 12, 4, 13, 3, 7, 15, 14, 5, 6, 2,
+	4, 0, 5, 9, 7, 12, 2, 10, 14, 1, 3, 8, 11, 6, 15, 13
+};
+static const unsigned char RR[80] = {
+	5, 14, 7, 0, 9, 2, 11, 4, 13, 6, 15, 8, 1, 10, 3, 12,
+	6, 11, 3, 7, 0, 13, 5, 10, 14, 15, 8, 12, 4, 9, 1, 2,
+	15, 5, 1, 3, 7, 14, 6, 9, 11, 8, 12, 2, 10, 0, 4, 13,
+	8, 6, 4, 1, 3, 11, 15, 0, 5, 12, 2, 13, 9, 7, 10, 14,
+	12, 15, 10, 4, 1, 5, 8, 7, 6, 2, 13, 14, 0, 3, 9, 11
+};
+static const unsigned char SL[80] = {
+	11, 14, 15, 12, 5, 8, 7, 9, 11, 13, 14, 15, 6, 7, 9, 8,
+	7, 6, 8, 13, 11, 9, 7, 15, 7, 12, 15, 9, 11, 7, 13, 12,
+	11, 13, 6, 7, 14, 9, 13, 15, 14, 8, 13, 6, 5, 12, 7, 5,
+	11, 12, 14, 15, 14, 15, 9, 8, 9, 14, 5, 6, 8, 6, 5, 12,
+	9, 15, 5, 11, 6, 8, 13, 12, 5, 12, 13, 14, 11, 8, 5, 6
+};
+static const unsigned char SR[80] = {
+	8, 9, 9, 11, 13, 15, 15, 5, 7, 7, 8, 11, 14, 14, 12, 6,
+	9, 13, 15, 7, 12, 8, 9, 11, 7, 7, 12, 7, 6, 15, 13, 11,
+	9, 7, 15, 11, 8, 6, 6, 14, 12, 13, 5, 14, 13, 13, 7, 5,
+	15, 5, 8, 11, 14, 14, 6, 14, 6, 9, 12, 9, 12, 5, 15, 8,
+	8, 5, 12, 9, 12, 5, 14, 6, 8, 13, 6, 5, 15, 13, 11, 11
+};
+static const uint32_t KL[5] = {
+	0x00000000, 0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xa953fd4e
+};
+static const uint32_t KR[5] = {
+	0x50a28be6, 0x5c4dd124, 0x6d703ef3, 0x7a6d76e9, 0x00000000
+};
+
+#define ROTL32(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+/**
+ * f(j, x, y, z):
+ * The boolean function for round j / 16.
+ */
+static uint32_t
+f(int j, uint32_t x, uint32_t y, uint32_t z)
+{
+
+	switch (j / 16) {
+	case 0: return x ^ y ^ z;
+	case 1: return (x & y) | (~x & z);
+	case 2: return (x | ~y) ^ z;
+	case 3: return (x & z) | (y & ~z);
+	default: return x ^ (y | ~z);
+	}
+}
+
+/**
+ * RIPEMD160_Transform(state, block):
+ * Compress one 64-byte block into the state.
+ */
+static void
+RIPEMD160_Transform(uint32_t * state, const unsigned char block[64])
+{
+	uint32_t X[16];
+	uint32_t al, bl, cl, dl, el;
+	uint32_t ar, br, cr, dr, er;
+	uint32_t t;
+	int j;
+
+	for (j = 0; j < 16; j++)
+		X[j] = le32dec(&block[j * 4]);
+
+	al = ar = state[0];
+	bl = br = state[1];
+	cl = cr = state[2];
+	dl = dr = state[3];
+	el = er = state[4];
+	for (j = 0; j < 80; j++) {
+		t = ROTL32(al + f(j, bl, cl, dl) + X[RL[j]] + KL[j / 16],
+		    SL[j]) + el;
+		al = el;
+		el = dl;
+		dl = ROTL32(cl, 10);
+		cl = bl;
+		bl = t;
+
+		t = ROTL32(ar + f(79 - j, br, cr, dr) + X[RR[j]] + KR[j / 16],
+		    SR[j]) + er;
+		ar = er;
+		er = dr;
+		dr = ROTL32(cr, 10);
+		cr = br;
+		br = t;
+	}
+
+	t = state[1] + cl + dr;
+	state[1] = state[2] + dl + er;
+	state[2] = state[3] + el + ar;
+	state[3] = state[4] + al + br;
+	state[4] = state[0] + bl + cr;
+	state[0] = t;
+
+	/* Clean the stack. */
+	memset(X, 0, sizeof(X));
+}
+
+void
+RIPEMD160_Init(RIPEMD160_CTX * ctx)
+{
+
+	ctx->count = 0;
+	ctx->state[0] = 0x67452301;
+	ctx->state[1] = 0xefcdab89;
+	ctx->state[2] = 0x98badcfe;
+	ctx->state[3] = 0x10325476;
+	ctx->state[4] = 0xc3d2e1f0;
+}
+
+void
+RIPEMD160_Update(RIPEMD160_CTX * ctx, const void * in, size_t len)
+{
+	const unsigned char * src = in;
+	size_t r = ctx->count % 64;
+
+	ctx->count += len;
+
+	/* Fill a partial block first. */
+	if (r != 0) {
+		if (len < 64 - r) {
+			memcpy(&ctx->buf[r], src, len);
+			return;
+		}
+		memcpy(&ctx->buf[r], src, 64 - r);
+		RIPEMD160_Transform(ctx->state, ctx->buf);
+		src += 64 - r;
+		len -= 64 - r;
+	}
+
+	/* Then whole blocks straight from the input. */
+	while (len >= 64) {
+		RIPEMD160_Transform(ctx->state, src);
+		src += 64;
+		len -= 64;
+	}
+
+	memcpy(ctx->buf, src, len);
+}
+
+void
+RIPEMD160_Final(unsigned char digest[20], RIPEMD160_CTX * ctx)
+{
+	size_t r = ctx->count % 64;
+	int i;
+
+	/* Pad with 0x80, zeroes, and the 64-bit little-endian bit count. */
+	ctx->buf[r++] = 0x80;
+	if (r > 56) {
+		memset(&ctx->buf[r], 0, 64 - r);
+		RIPEMD160_Transform(ctx->state, ctx->buf);
+		r = 0;
+	}
+	memset(&ctx->buf[r], 0, 56 - r);
+	le64enc(&ctx->buf[56], ctx->count << 3);
+	RIPEMD160_Transform(ctx->state, ctx->buf);
+
+	for (i = 0; i < 5; i++)
+		le32enc(&digest[i * 4], ctx->state[i]);
+
+	/* Clear the context state. */
+	memset(ctx, 0, sizeof(*ctx));
+}
+
+void
+RIPEMD160(const void * in, size_t len, unsigned char digest[20])
+{
+	RIPEMD160_CTX ctx;
+
+	RIPEMD160_Init(&ctx);
+	RIPEMD160_Update(&ctx, in, len);
+	RIPEMD160_Final(digest, &ctx);
+}
+
+void
+HASH160(const void * in, size_t len, unsigned char digest[20])
+{
+	SHA256_CTX ctx;
+	unsigned char hash[32];
+
+	SHA256_Init(&ctx);
+	SHA256_Update(&ctx, in, len);
+	SHA256_Final(hash, &ctx);
+	RIPEMD160(hash, sizeof(hash), digest);
+}
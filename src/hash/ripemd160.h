@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _RIPEMD160_H_
+#define _RIPEMD160_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+typedef struct RIPEMD160Context {
+	uint32_t state[5];
+	uint64_t count;
+	unsigned char buf[64];
+} RIPEMD160_CTX;
+
+void	RIPEMD160_Init(RIPEMD160_CTX *);
+void	RIPEMD160_Update(RIPEMD160_CTX *, const void *, size_t);
+void	RIPEMD160_Final(unsigned char [20], RIPEMD160_CTX *);
+
+/**
+ * RIPEMD160(in, len, digest):
+ * Compute the RIPEMD-160 hash of in[0 .. len - 1] in one step.
+ */
+void	RIPEMD160(const void *, size_t, unsigned char [20]);
+
+/**
+ * HASH160(in, len, digest):
+ * Compute RIPEMD160(SHA256(in)), as used by Bitcoin addresses.
+ */
+void	HASH160(const void *, size_t, unsigned char [20]);
+
+#endif /* !_RIPEMD160_H_ */
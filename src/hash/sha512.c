@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../scrypt/sysendian.h"
+
+#include "sha512.h"
+
+static const uint64_t K[80] = {
+	0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL,
+	0xe9b5dba58189dbbcULL, 0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL,
+	0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL, 0xd807aa98a3030242ULL,
+	0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+	0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL,
+	0xc19bf174cf692694ULL, 0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL,
+	0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL, 0x2de92c6f592b0275ULL,
+	0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+	0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL,
+	0xbf597fc7beef0ee4ULL, 0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL,
+	0x06ca6351e003826fULL, 0x142929670a0e6e70ULL, 0x27b70a8546d22ffcULL,
+	0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+	0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL,
+	0x92722c851482353bULL, 0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL,
+	0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL, 0xd192e819d6ef5218ULL,
+	0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+	0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL,
+	0x34b0bcb5e19b48a8ULL, 0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL,
+	0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL, 0x748f82ee5defb2fcULL,
+	0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+	0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL,
+	0xc67178f2e372532bULL, 0xca273eceea26619cULL, 0xd186b8c721c0c207ULL,
+	0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL, 0x06f067aa72176fbaULL,
+	0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+	0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL,
+	0x431d67c49c100d4cULL, 0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
+	0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+
+#define ROTR64(x, n) (((x) >> (n)) | ((x) << (64 - (n))))
+#define Ch(x, y, z) ((x & (y ^ z)) ^ z)
+#define Maj(x, y, z) ((x & (y | z)) | (y & z))
+#define S0(x) (ROTR64(x, 28) ^ ROTR64(x, 34) ^ ROTR64(x, 39))
+#define S1(x) (ROTR64(x, 14) ^ ROTR64(x, 18) ^ ROTR64(x, 41))
+#define s0(x) (ROTR64(x, 1) ^ ROTR64(x, 8) ^ (x >> 7))
+#define s1(x) (ROTR64(x, 19) ^ ROTR64(x, 61) ^ (x >> 6))
+
+/**
+ * SHA512_Transform(state, block):
+ * Compress one 128-byte block into the state.
+ */
+static void
+SHA512_Transform(uint64_t * state, const unsigned char block[128])
+{
+	uint64_t W[80];
+	uint64_t S[8];
+	uint64_t t0, t1;
+	int i;
+
+	for (i = 0; i < 16; i++)
+		W[i] = be64dec(&block[i * 8]);
+	for (i = 16; i < 80; i++)
+		W[i] = s1(W[i - 2]) + W[i - 7] + s0(W[i - 15]) + W[i - 16];
+
+	memcpy(S, state, sizeof(S));
+	for (i = 0; i < 80; i++) {
+		t0 = S[7] + S1(S[4]) + Ch(S[4], S[5], S[6]) + K[i] + W[i];
+		t1 = S0(S[0]) + Maj(S[0], S[1], S[2]);
+		S[7] = S[6];
+		S[6] = S[5];
+		S[5] = S[4];
+		S[4] = S[3] + t0;
+		S[3] = S[2];
+		S[2] = S[1];
+		S[1] = S[0];
+		S[0] = t0 + t1;
+	}
+	for (i = 0; i < 8; i++)
+		state[i] += S[i];
+
+	/* Clean the stack. */
+	memset(W, 0, sizeof(W));
+	memset(S, 0, sizeof(S));
+}
+
+void
+SHA512_Init(SHA512_CTX * ctx)
+{
+
+	ctx->count = 0;
+	ctx->state[0] = 0x6a09e667f3bcc908ULL;
+	ctx->state[1] = 0xbb67ae8584caa73bULL;
+	ctx->state[2] = 0x3c6ef372fe94f82bULL;
+	ctx->state[3] = 0xa54ff53a5f1d36f1ULL;
+	ctx->state[4] = 0x510e527fade682d1ULL;
+	ctx->state[5] = 0x9b05688c2b3e6c1fULL;
+	ctx->state[6] = 0x1f83d9abfb41bd6bULL;
+	ctx->state[7] = 0x5be0cd19137e2179ULL;
+}
+
+void
+SHA512_Update(SHA512_CTX * ctx, const void * in, size_t len)
+{
+	const unsigned char * src = in;
+	size_t r = ctx->count % 128;
+
+	ctx->count += len;
+
+	/* Fill a partial block first. */
+	if (r != 0) {
+		if (len < 128 - r) {
+			memcpy(&ctx->buf[r], src, len);
+			return;
+		}
+		memcpy(&ctx->buf[r], src, 128 - r);
+		SHA512_Transform(ctx->state, ctx->buf);
+		src += 128 - r;
+		len -= 128 - r;
+	}
+
+	/* Then whole blocks straight from the input. */
+	while (len >= 128) {
+		SHA512_Transform(ctx->state, src);
+		src += 128;
+		len -= 128;
+	}
+
+	memcpy(ctx->buf, src, len);
+}
+
+void
+SHA512_Final(unsigned char digest[64], SHA512_CTX * ctx)
+{
+	size_t r = ctx->count % 128;
+	int i;
+
+	/* Pad with 0x80, zeroes, and the 128-bit big-endian bit count. */
+	ctx->buf[r++] = 0x80;
+	if (r > 112) {
+		memset(&ctx->buf[r], 0, 128 - r);
+		SHA512_Transform(ctx->state, ctx->buf);
+		r = 0;
+	}
+	memset(&ctx->buf[r], 0, 112 - r);
+	be64enc(&ctx->buf[112], ctx->count >> 61);
+	be64enc(&ctx->buf[120], ctx->count << 3);
+	SHA512_Transform(ctx->state, ctx->buf);
+
+	for (i = 0; i < 8; i++)
+		be64enc(&digest[i * 8], ctx->state[i]);
+
+	/* Clear the context state. */
+	memset(ctx, 0, sizeof(*ctx));
+}
+
+void
+HMAC_SHA512_Init(HMAC_SHA512_CTX * ctx, const void * _K, size_t Klen)
+{
+	unsigned char pad[128];
+	unsigned char khash[64];
+	const unsigned char * K = _K;
+	size_t i;
+
+	/* If Klen > 128, the key is really SHA512(K). */
+	if (Klen > 128) {
+		SHA512_Init(&ctx->ictx);
+		SHA512_Update(&ctx->ictx, K, Klen);
+		SHA512_Final(khash, &ctx->ictx);
+		K = khash;
+		Klen = 64;
+	}
+
+	/* Inner SHA512 operation is SHA512(K xor [block of 0x36] || data). */
+	SHA512_Init(&ctx->ictx);
+	memset(pad, 0x36, 128);
+	for (i = 0; i < Klen; i++)
+		pad[i] ^= K[i];
+	SHA512_Update(&ctx->ictx, pad, 128);
+
+	/* Outer SHA512 operation is SHA512(K xor [block of 0x5c] || hash). */
+	SHA512_Init(&ctx->octx);
+	memset(pad, 0x5c, 128);
+	for (i = 0; i < Klen; i++)
+		pad[i] ^= K[i];
+	SHA512_Update(&ctx->octx, pad, 128);
+
+	/* Clean the stack. */
+	memset(khash, 0, 64);
+	memset(pad, 0, 128);
+}
+
+void
+HMAC_SHA512_Update(HMAC_SHA512_CTX * ctx, const void * in, size_t len)
+{
+
+	/* Feed data to the inner SHA512 operation. */
+	SHA512_Update(&ctx->ictx, in, len);
+}
+
+void
+HMAC_SHA512_Final(unsigned char digest[64], HMAC_SHA512_CTX * ctx)
+{
+	unsigned char ihash[64];
+
+	/* Finish the inner SHA512 operation. */
+	SHA512_Final(ihash, &ctx->ictx);
+
+	/* Feed the inner hash to the outer SHA512 operation. */
+	SHA512_Update(&ctx->octx, ihash, 64);
+
+	/* Finish the outer SHA512 operation. */
+	SHA512_Final(digest, &ctx->octx);
+
+	/* Clean the stack. */
+	memset(ihash, 0, 64);
+}
+
+void
+HMAC_SHA512(const void * K, size_t Klen, const void * in, size_t len,
+    unsigned char digest[64])
+{
+	HMAC_SHA512_CTX ctx;
+
+	HMAC_SHA512_Init(&ctx, K, Klen);
+	HMAC_SHA512_Update(&ctx, in, len);
+	HMAC_SHA512_Final(digest, &ctx);
+}
+
+/**
+ * PBKDF2_SHA512(passwd, passwdlen, salt, saltlen, c, buf, dkLen):
+ * Compute PBKDF2(passwd, salt, c, dkLen) using HMAC-SHA512 as the PRF, and
+ * write the output to buf.  The value dkLen must be at most 64 * (2^32 - 1).
+ */
+void
+PBKDF2_SHA512(const uint8_t * passwd, size_t passwdlen, const uint8_t * salt,
+    size_t saltlen, uint64_t c, uint8_t * buf, size_t dkLen)
+{
+	HMAC_SHA512_CTX Phctx, PShctx, hctx;
+	unsigned char block[128];
+	uint64_t state[8];
+	size_t i;
+	uint8_t ivec[4];
+	uint8_t T[64];
+	uint64_t j;
+	int k;
+	size_t clen;
+
+	/* Compute HMAC state after processing P, and after P and S. */
+	HMAC_SHA512_Init(&Phctx, passwd, passwdlen);
+	memcpy(&PShctx, &Phctx, sizeof(HMAC_SHA512_CTX));
+	HMAC_SHA512_Update(&PShctx, salt, saltlen);
+
+	/*
+	 * Every U_j after the first is a 64-byte message after the 128-byte
+	 * key block, so its padding never changes. Set it up once, and run
+	 * the compressions directly, with the previous hash in the first
+	 * half of the block.
+	 */
+	memset(block, 0, sizeof(block));
+	block[64] = 0x80;
+	be64enc(&block[120], (128 + 64) * 8);
+
+	/* Iterate through the blocks. */
+	for (i = 0; i * 64 < dkLen; i++) {
+		/* Generate INT(i + 1). */
+		be32enc(ivec, (uint32_t)(i + 1));
+
+		/* Compute U_1 = PRF(P, S || INT(i)). */
+		memcpy(&hctx, &PShctx, sizeof(HMAC_SHA512_CTX));
+		HMAC_SHA512_Update(&hctx, ivec, 4);
+		HMAC_SHA512_Final(block, &hctx);
+
+		/* T_i = U_1 ... */
+		memcpy(T, block, 64);
+
+		for (j = 2; j <= c; j++) {
+			/* Compute U_j. */
+			memcpy(state, Phctx.ictx.state, sizeof(state));
+			SHA512_Transform(state, block);
+			for (k = 0; k < 8; k++)
+				be64enc(&block[k * 8], state[k]);
+			memcpy(state, Phctx.octx.state, sizeof(state));
+			SHA512_Transform(state, block);
+			for (k = 0; k < 8; k++)
+				be64enc(&block[k * 8], state[k]);
+
+			/* ... xor U_j ... */
+			for (k = 0; k < 64; k++)
+				T[k] ^= block[k];
+		}
+
+		/* Copy as many bytes as necessary into buf. */
+		clen = dkLen - i * 64;
+		if (clen > 64)
+			clen = 64;
+		memcpy(&buf[i * 64], T, clen);
+	}
+
+	/* Clean the stack, and the contexts we never called _Final on. */
+	memset(&Phctx, 0, sizeof(HMAC_SHA512_CTX));
+	memset(&PShctx, 0, sizeof(HMAC_SHA512_CTX));
+	memset(block, 0, sizeof(block));
+	memset(state, 0, sizeof(state));
+	memset(T, 0, sizeof(T));
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _SHA512_H_
+#define _SHA512_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+typedef struct SHA512Context {
+	uint64_t state[8];
+	uint64_t count;
+	unsigned char buf[128];
+} SHA512_CTX;
+
+typedef struct HMAC_SHA512Context {
+	SHA512_CTX ictx;
+	SHA512_CTX octx;
+} HMAC_SHA512_CTX;
+
+void	SHA512_Init(SHA512_CTX *);
+void	SHA512_Update(SHA512_CTX *, const void *, size_t);
+void	SHA512_Final(unsigned char [64], SHA512_CTX *);
+void	HMAC_SHA512_Init(HMAC_SHA512_CTX *, const void *, size_t);
+void	HMAC_SHA512_Update(HMAC_SHA512_CTX *, const void *, size_t);
+void	HMAC_SHA512_Final(unsigned char [64], HMAC_SHA512_CTX *);
+
+/**
+ * HMAC_SHA512(key, keylen, in, len, digest):
+ * Compute the HMAC-SHA512 of in[0 .. len - 1] in one step.
+ */
+void	HMAC_SHA512(const void *, size_t, const void *, size_t,
+    unsigned char [64]);
+
+/**
+ * PBKDF2_SHA512(passwd, passwdlen, salt, saltlen, c, buf, dkLen):
+ * Compute PBKDF2(passwd, salt, c, dkLen) using HMAC-SHA512 as the PRF, and
+ * write the output to buf.  The value dkLen must be at most 64 * (2^32 - 1).
+ */
+void	PBKDF2_SHA512(const uint8_t *, size_t, const uint8_t *, size_t,
+    uint64_t, uint8_t *, size_t);
+
+#endif /* !_SHA512_H_ */
@@ -1,9 +1,108 @@
 import { NativeModules } from 'react-native'
 import { base16, base64 } from 'rfc4648'
 
-const { RNFastCrypto } = NativeModules
+const { RNFastCrypto, RNFastCryptoJsi } = NativeModules
 const Buffer = require('buffer/').Buffer
 
+/**
+ * The JSI bindings, if this app can load them.
+ * These pass bytes as buffers instead of base64 strings,
+ * and skip the bridge's thread hops for quick methods.
+ */
+const jsi: FastCryptoJsi | undefined =
+  global.__fastCryptoJsi ??
+  (RNFastCryptoJsi?.install() === true ? global.__fastCryptoJsi : undefined)
+const native = jsi ?? RNFastCrypto
+
+/**
+ * Prepares bytes for the native methods.
+ */
+function toNative(data: Uint8Array): NativeBytes {
+  return jsi != null ? data : base64.stringify(data)
+}
+
+/**
+ * Reads bytes returned from the native methods.
+ */
+function fromNative(data: NativeBytes): Uint8Array {
+  if (typeof data === 'string') {
+    return base64.parse(data, { out: Buffer.allocUnsafe })
+  }
+  return data instanceof Uint8Array ? data : Buffer.from(data)
+}
+
+/**
+ * Packs same-sized byte arrays back-to-back into one buffer,
+ * so a batch can cross the bridge in a single call.
+ */
+function packBytes(
+  items: Uint8Array[],
+  itemLength: number,
+  name: string
+): Uint8Array {
+  const out = new Uint8Array(items.length * itemLength)
+  for (let i = 0; i < items.length; ++i) {
+    if (items[i].length !== itemLength) {
+      throw new Error(`${name} ${i} must be ${itemLength} bytes`)
+    }
+    out.set(items[i], i * itemLength)
+  }
+  return out
+}
+
+/**
+ * Like `packBytes`, but turns a missing array into an empty string.
+ */
+function packOptional(
+  items: Uint8Array[] | undefined,
+  count: number,
+  itemLength: number,
+  name: string
+): NativeBytes {
+  if (items == null) return ''
+  if (items.length !== count) {
+    throw new Error(`Expected ${count} items in the ${name} list`)
+  }
+  return toNative(packBytes(items, itemLength, name))
+}
+
+/**
+ * Splits a packed buffer back into same-sized byte arrays.
+ */
+function unpackBytes(
+  data: Uint8Array,
+  itemLength: number,
+  count: number
+): Uint8Array[] {
+  const out: Uint8Array[] = []
+  for (let i = 0; i < count; ++i) {
+    out.push(data.subarray(i * itemLength, (i + 1) * itemLength))
+  }
+  return out
+}
+
+/**
+ * Packs byte arrays of any size back-to-back, along with
+ * their lengths as little-endian 32-bit words.
+ */
+function packVariable(items: Uint8Array[]): {
+  data: Uint8Array
+  lens: Uint8Array
+} {
+  const lens = new Uint8Array(4 * items.length)
+  const view = new DataView(lens.buffer)
+  items.forEach((item, i) => view.setUint32(4 * i, item.length, true))
+  const data = new Uint8Array(
+    items.reduce((total, item) => total + item.length, 0)
+  )
+  let offset = 0
+  for (const item of items) {
+    data.set(item, offset)
+    offset += item.length
+  }
+  return { data, lens }
+}
+
 async function pbkdf2DeriveAsync(
   data: Uint8Array,
   salt: Uint8Array,
@@ -31,25 +130,121 @@ export async function scrypt(
   p: number,
   size: number
 ): Promise<Uint8Array> {
-  const passwd = base64.stringify(passwdBytes)
-  const salt = base64.stringify(saltBytes)
-
-  console.log(
-    'RNFS:scrypt(' + N.toString() + ', ' + r.toString() + ', ' + p.toString()
-  )
-  const t = Date.now()
-  const retval: string = await RNFastCrypto.scrypt(passwd, salt, N, r, p, size)
-  const elapsed = Date.now() - t
-  console.log('RNFS:script finished in ' + elapsed + 'ms')
+  const passwd = toNative(passwdBytes)
+  const salt = toNative(saltBytes)
 
-  const uint8array = base64.parse(retval)
+  const retval: NativeBytes = await native.scrypt(passwd, salt, N, r, p, size)
+  const uint8array = fromNative(retval)
   return uint8array.subarray(0, size)
 }
 
+// Coalesced batches smaller than this run on a single native thread,
+// since starting more threads would cost more than the keys themselves:
+const coalescedThreadMinimum = 16
+
+/**
+ * Collects the calls made before the current microtask finishes,
+ * then hands them to `run` as one batch, so a loop of quick calls
+ * crosses the bridge once. Each call's promise settles with its
+ * own item of the batch's results, in the order of the calls.
+ */
+function coalesce<Input, Output>(
+  run: (inputs: Input[]) => Promise<Output[]>
+): (input: Input) => Promise<Output> {
+  let queue: Array<{
+    input: Input
+    resolve: (output: Output) => void
+    reject: (error: unknown) => void
+  }> = []
+
+  function flush(): void {
+    const calls = queue
+    queue = []
+    run(calls.map(call => call.input)).then(
+      outputs => calls.forEach((call, i) => call.resolve(outputs[i])),
+      error => calls.forEach(call => call.reject(error))
+    )
+  }
+
+  return async input =>
+    await new Promise<Output>((resolve, reject) => {
+      if (queue.length === 0) Promise.resolve().then(flush).catch(() => {})
+      queue.push({ input, resolve, reject })
+    })
+}
+
+/**
+ * Creates public keys in one native call,
+ * giving back empty keys for invalid private keys.
+ */
+function publicKeyCreateBatch(
+  compressed: boolean
+): (privateKey: Uint8Array) => Promise<Uint8Array> {
+  const publicKeyLength = compressed ? 33 : 65
+  return coalesce(async (privateKeys: Uint8Array[]) => {
+    const count = privateKeys.length
+    const out = fromNative(
+      await native.secp256k1EcPubkeyCreateBatch(
+        toNative(packBytes(privateKeys, 32, 'Private key')),
+        count,
+        compressed,
+        count < coalescedThreadMinimum ? 1 : 0
+      )
+    )
+
+    // The result bytes come first, followed by the public keys:
+    return privateKeys.map((_, i) => {
+      const start = count + i * publicKeyLength
+      return out.subarray(start, out[i] === 1 ? start + publicKeyLength : start)
+    })
+  })
+}
+
+const coalescedPublicKeyCreate = {
+  compressed: publicKeyCreateBatch(true),
+  uncompressed: publicKeyCreateBatch(false)
+}
+
+/**
+ * Tweaks private keys in one native call,
+ * giving back the original key if a tweak fails.
+ */
+const coalescedPrivateKeyTweakAdd = coalesce(
+  async (items: Array<{ privateKey: Uint8Array; tweak: Uint8Array }>) => {
+    const count = items.length
+    const privateKeys = items.map(item => item.privateKey)
+    const out = fromNative(
+      await native.secp256k1EcPrivkeyTweakAddBatch(
+        toNative(packBytes(privateKeys, 32, 'Private key')),
+        toNative(packBytes(items.map(item => item.tweak), 32, 'Tweak')),
+        count,
+        count < coalescedThreadMinimum ? 1 : 0
+      )
+    )
+
+    // The result bytes come first, followed by the private keys:
+    return privateKeys.map((privateKey, i) =>
+      out[i] === 1
+        ? out.subarray(count + i * 32, count + (i + 1) * 32)
+        : Buffer.from(privateKey)
+    )
+  }
+)
+
 async function publicKeyCreate(
   privateKey: Uint8Array,
   compressed: boolean
 ): Promise<Uint8Array> {
+  if (jsi != null) {
+    return fromNative(jsi.secp256k1EcPubkeyCreate(privateKey, compressed))
+  }
+
+  // Calls made in the same tick cross the bridge as one batch:
+  if (privateKey.length === 32) {
+    return await (compressed
+      ? coalescedPublicKeyCreate.compressed(privateKey)
+      : coalescedPublicKeyCreate.uncompressed(privateKey))
+  }
   const privateKeyHex = base16.stringify(privateKey)
   const publicKeyHex: string = await RNFastCrypto.secp256k1EcPubkeyCreate(
     privateKeyHex,
@@ -63,6 +258,12 @@ async function privateKeyTweakAdd(
   privateKey: Uint8Array,
   tweak: Uint8Array
 ): Promise<Uint8Array> {
+  if (jsi != null) {
+    return fromNative(jsi.secp256k1EcPrivkeyTweakAdd(privateKey, tweak))
+  }
+  if (privateKey.length === 32 && tweak.length === 32) {
+    return await coalescedPrivateKeyTweakAdd({ privateKey, tweak })
+  }
   const privateKeyHex = base16.stringify(privateKey)
   const tweakHex = base16.stringify(tweak)
   const privateKeyTweakedHex: string =
@@ -78,6 +279,11 @@ async function publicKeyTweakAdd(
   tweak: Uint8Array,
   compressed: boolean
 ): Promise<Uint8Array> {
+  if (jsi != null) {
+    return fromNative(
+      jsi.secp256k1EcPubkeyTweakAdd(publicKey, tweak, compressed)
+    )
+  }
   const publicKeyHex = base16.stringify(publicKey)
   const tweakHex = base16.stringify(tweak)
   const publickKeyTweakedHex: string =
@@ -92,12 +298,2032 @@ async function publicKeyTweakAdd(
   return outBuf
 }
 
+async function ecdsaSign(
+  msgHash: Uint8Array,
+  privateKey: Uint8Array,
+  der: boolean = false
+): Promise<Uint8Array> {
+  const sig: NativeBytes = await native.secp256k1EcdsaSign(
+    toNative(privateKey),
+    toNative(msgHash),
+    der
+  )
+  return fromNative(sig)
+}
+
+async function ecdsaVerify(
+  sig: Uint8Array,
+  msgHash: Uint8Array,
+  publicKey: Uint8Array,
+  der: boolean = false,
+  strict: boolean = false
+): Promise<boolean> {
+  return await native.secp256k1EcdsaVerify(
+    toNative(sig),
+    der,
+    toNative(msgHash),
+    toNative(publicKey),
+    strict
+  )
+}
+
+/**
+ * Verifies many compact signatures in a single native call,
+ * spread across `threads` worker threads (0 means one per core).
+ * The public keys must all be the same length.
+ */
+async function ecdsaVerifyBatch(
+  sigs: Uint8Array[],
+  msgHashes: Uint8Array[],
+  publicKeys: Uint8Array[],
+  threads: number = 0,
+  strict: boolean = false
+): Promise<boolean[]> {
+  const count = sigs.length
+  if (count === 0) return []
+  if (msgHashes.length !== count || publicKeys.length !== count) {
+    throw new Error('ecdsaVerifyBatch needs one hash and key per signature')
+  }
+
+  const results: NativeBytes = await native.secp256k1EcdsaVerifyBatch(
+    toNative(packBytes(sigs, 64, 'Signature')),
+    toNative(packBytes(msgHashes, 32, 'Message hash')),
+    toNative(
+      packBytes(publicKeys, publicKeys[0].length, 'Public key')
+    ),
+    count,
+    strict,
+    threads
+  )
+  return Array.from(fromNative(results), valid => valid === 1)
+}
+
+async function xOnlyPublicKeyCreateBatch(
+  privateKeys: Uint8Array[],
+  threads: number = 0
+): Promise<Uint8Array[]> {
+  const count = privateKeys.length
+  if (count === 0) return []
+  const out: NativeBytes = await native.secp256k1XonlyPubkeyCreateBatch(
+    toNative(packBytes(privateKeys, 32, 'Private key')),
+    count,
+    threads
+  )
+  return unpackBytes(fromNative(out), 32, count)
+}
+
+async function xOnlyPublicKeyCreate(
+  privateKey: Uint8Array
+): Promise<Uint8Array> {
+  const [out] = await xOnlyPublicKeyCreateBatch([privateKey])
+  return out
+}
+
+export interface TaprootOutputKey {
+  // The 32-byte x-only output key:
+  publicKey: Uint8Array
+  // 0 for an even y coordinate, 1 for odd:
+  parity: number
+}
+
+/**
+ * Applies the BIP341 TapTweak to a list of x-only internal keys.
+ * Leave out the merkle roots for key-path-only outputs.
+ */
+async function taprootTweakPublicKeyBatch(
+  internalKeys: Uint8Array[],
+  merkleRoots?: Uint8Array[],
+  threads: number = 0
+): Promise<TaprootOutputKey[]> {
+  const count = internalKeys.length
+  if (count === 0) return []
+  const out: NativeBytes = await native.secp256k1TaprootTweakPubkeyBatch(
+    toNative(packBytes(internalKeys, 32, 'Internal key')),
+    packOptional(merkleRoots, count, 32, 'Merkle root'),
+    count,
+    threads
+  )
+
+  // The output keys come first, followed by one parity byte per key:
+  const data = fromNative(out)
+  return unpackBytes(data, 32, count).map((publicKey, i) => ({
+    publicKey,
+    parity: data[32 * count + i]
+  }))
+}
+
+async function taprootTweakPublicKey(
+  internalKey: Uint8Array,
+  merkleRoot?: Uint8Array
+): Promise<TaprootOutputKey> {
+  const [out] = await taprootTweakPublicKeyBatch(
+    [internalKey],
+    merkleRoot == null ? undefined : [merkleRoot]
+  )
+  return out
+}
+
+async function taprootTweakPrivateKeyBatch(
+  privateKeys: Uint8Array[],
+  merkleRoots?: Uint8Array[],
+  threads: number = 0
+): Promise<Uint8Array[]> {
+  const count = privateKeys.length
+  if (count === 0) return []
+  const out: NativeBytes = await native.secp256k1TaprootTweakPrivkeyBatch(
+    toNative(packBytes(privateKeys, 32, 'Private key')),
+    packOptional(merkleRoots, count, 32, 'Merkle root'),
+    count,
+    threads
+  )
+  return unpackBytes(fromNative(out), 32, count)
+}
+
+async function taprootTweakPrivateKey(
+  privateKey: Uint8Array,
+  merkleRoot?: Uint8Array
+): Promise<Uint8Array> {
+  const [out] = await taprootTweakPrivateKeyBatch(
+    [privateKey],
+    merkleRoot == null ? undefined : [merkleRoot]
+  )
+  return out
+}
+
+async function schnorrSignBatch(
+  msgs: Uint8Array[],
+  privateKeys: Uint8Array[],
+  auxRands?: Uint8Array[],
+  threads: number = 0
+): Promise<Uint8Array[]> {
+  const count = msgs.length
+  if (count === 0) return []
+  if (privateKeys.length !== count) {
+    throw new Error('schnorrSignBatch needs one private key per message')
+  }
+  const out: NativeBytes = await native.secp256k1SchnorrSignBatch(
+    toNative(packBytes(privateKeys, 32, 'Private key')),
+    toNative(packBytes(msgs, 32, 'Message')),
+    packOptional(auxRands, count, 32, 'Aux random'),
+    count,
+    threads
+  )
+  return unpackBytes(fromNative(out), 64, count)
+}
+
+async function schnorrSign(
+  msg: Uint8Array,
+  privateKey: Uint8Array,
+  auxRand?: Uint8Array
+): Promise<Uint8Array> {
+  const [out] = await schnorrSignBatch(
+    [msg],
+    [privateKey],
+    auxRand == null ? undefined : [auxRand]
+  )
+  return out
+}
+
+async function schnorrVerifyBatch(
+  sigs: Uint8Array[],
+  msgs: Uint8Array[],
+  publicKeys: Uint8Array[],
+  threads: number = 0
+): Promise<boolean[]> {
+  const count = sigs.length
+  if (count === 0) return []
+  if (msgs.length !== count || publicKeys.length !== count) {
+    throw new Error(
+      'schnorrVerifyBatch needs one message and key per signature'
+    )
+  }
+  const results: NativeBytes = await native.secp256k1SchnorrVerifyBatch(
+    toNative(packBytes(sigs, 64, 'Signature')),
+    toNative(packBytes(msgs, 32, 'Message')),
+    toNative(packBytes(publicKeys, 32, 'Public key')),
+    count,
+    threads
+  )
+  return Array.from(fromNative(results), valid => valid === 1)
+}
+
+async function schnorrVerify(
+  sig: Uint8Array,
+  msg: Uint8Array,
+  publicKey: Uint8Array
+): Promise<boolean> {
+  const [out] = await schnorrVerifyBatch([sig], [msg], [publicKey])
+  return out
+}
+
+async function ecdsaSignRecoverableBatch(
+  msgHashes: Uint8Array[],
+  privateKeys: Uint8Array[],
+  threads: number = 0
+): Promise<Uint8Array[]> {
+  const count = msgHashes.length
+  if (count === 0) return []
+  if (privateKeys.length !== count) {
+    throw new Error('ecdsaSignRecoverableBatch needs one key per hash')
+  }
+  const out: NativeBytes = await native.secp256k1EcdsaSignRecoverableBatch(
+    toNative(packBytes(privateKeys, 32, 'Private key')),
+    toNative(packBytes(msgHashes, 32, 'Message hash')),
+    count,
+    threads
+  )
+  return unpackBytes(fromNative(out), 65, count)
+}
+
+/**
+ * Signs a message hash, returning r || s || recovery id.
+ */
+async function ecdsaSignRecoverable(
+  msgHash: Uint8Array,
+  privateKey: Uint8Array
+): Promise<Uint8Array> {
+  const [out] = await ecdsaSignRecoverableBatch([msgHash], [privateKey])
+  return out
+}
+
+export type RecoverFormat = 'compressed' | 'uncompressed' | 'address'
+
+const recoverFormats: { [format in RecoverFormat]: [number, number] } = {
+  compressed: [0, 33],
+  uncompressed: [1, 65],
+  address: [2, 20]
+}
+
+/**
+ * Recovers the signers of many 65-byte recoverable signatures
+ * in one native call. The 'address' format returns 20-byte
+ * Ethereum addresses. Signatures that fail to recover give `undefined`.
+ */
+async function ecdsaRecoverBatch(
+  sigs: Uint8Array[],
+  msgHashes: Uint8Array[],
+  format: RecoverFormat = 'compressed',
+  threads: number = 0
+): Promise<Array<Uint8Array | undefined>> {
+  const count = sigs.length
+  if (count === 0) return []
+  if (msgHashes.length !== count) {
+    throw new Error('ecdsaRecoverBatch needs one hash per signature')
+  }
+  const [formatId, itemLength] = recoverFormats[format]
+  const out: NativeBytes = await native.secp256k1EcdsaRecoverBatch(
+    toNative(packBytes(sigs, 65, 'Signature')),
+    toNative(packBytes(msgHashes, 32, 'Message hash')),
+    count,
+    formatId,
+    threads
+  )
+
+  // The recovered items come first, followed by one status byte per item:
+  const data = fromNative(out)
+  return unpackBytes(data, itemLength, count).map((item, i) =>
+    data[itemLength * count + i] === 1 ? item : undefined
+  )
+}
+
+async function ecdsaRecover(
+  sig: Uint8Array,
+  msgHash: Uint8Array,
+  compressed: boolean = true
+): Promise<Uint8Array> {
+  const [out] = await ecdsaRecoverBatch(
+    [sig],
+    [msgHash],
+    compressed ? 'compressed' : 'uncompressed'
+  )
+  if (out == null) throw new Error('Cannot recover public key')
+  return out
+}
+
+/**
+ * Computes the SHA-256 of the shared point, like libsecp256k1's ECDH.
+ */
+async function ecdh(
+  privateKey: Uint8Array,
+  publicKey: Uint8Array
+): Promise<Uint8Array> {
+  const out: NativeBytes = await native.secp256k1Ecdh(
+    toNative(privateKey),
+    toNative(publicKey)
+  )
+  return fromNative(out)
+}
+
 export const secp256k1 = {
   publicKeyCreate,
   privateKeyTweakAdd,
-  publicKeyTweakAdd
+  publicKeyTweakAdd,
+  ecdsaSign,
+  ecdsaVerify,
+  ecdsaVerifyBatch,
+  xOnlyPublicKeyCreate,
+  xOnlyPublicKeyCreateBatch,
+  taprootTweakPublicKey,
+  taprootTweakPublicKeyBatch,
+  taprootTweakPrivateKey,
+  taprootTweakPrivateKeyBatch,
+  schnorrSign,
+  schnorrSignBatch,
+  schnorrVerify,
+  schnorrVerifyBatch,
+  ecdsaSignRecoverable,
+  ecdsaSignRecoverableBatch,
+  ecdsaRecover,
+  ecdsaRecoverBatch,
+  ecdh
 }
 
 export const pbkdf2 = {
   deriveAsync: pbkdf2DeriveAsync
 }
+
+export interface SilentPaymentTx {
+  // The sum of the eligible input public keys (33 bytes),
+  // or that sum times the input hash, as served by indexers:
+  tweak: Uint8Array
+  // The BIP352 input hash, if `tweak` does not include it yet:
+  inputHash?: Uint8Array
+  // The transaction's x-only taproot output keys:
+  outputs: Uint8Array[]
+}
+
+export interface SilentPaymentMatch {
+  txIndex: number
+  outputIndex: number
+  // The index into the `labels` list, or -1 for an unlabeled output:
+  labelIndex: number
+  // Add this (and the label tweak, if any) to the spend key:
+  tweak: Uint8Array
+}
+
+export interface SilentPaymentScanOpts {
+  scanKey: Uint8Array
+  spendPublicKey: Uint8Array
+  // Label points (m * G) to check for:
+  labels?: Uint8Array[]
+  txs: SilentPaymentTx[]
+  threads?: number
+}
+
+/**
+ * Scans a batch of transactions for BIP352 silent payments
+ * in a single native call.
+ */
+async function silentPaymentsScan(
+  opts: SilentPaymentScanOpts
+): Promise<SilentPaymentMatch[]> {
+  const { scanKey, spendPublicKey, labels = [], txs, threads = 0 } = opts
+  if (txs.length === 0) return []
+
+  const withHash = txs.filter(tx => tx.inputHash != null).length
+  if (withHash !== 0 && withHash !== txs.length) {
+    throw new Error('Either all transactions need input hashes, or none')
+  }
+  const outputCounts = new Uint8Array(4 * txs.length)
+  const view = new DataView(outputCounts.buffer)
+  txs.forEach((tx, i) => view.setUint32(4 * i, tx.outputs.length, true))
+
+  const out: NativeBytes = await native.silentPaymentsScan(
+    toNative(scanKey),
+    toNative(spendPublicKey),
+    toNative(packBytes(labels, 33, 'Label')),
+    toNative(
+      packBytes(
+        txs.map(tx => tx.tweak),
+        33,
+        'Tweak'
+      )
+    ),
+    withHash === 0
+      ? ''
+      : toNative(
+          packBytes(
+            txs.map(tx => tx.inputHash ?? new Uint8Array(0)),
+            32,
+            'Input hash'
+          )
+        ),
+    toNative(
+      packBytes(
+        txs.flatMap(tx => tx.outputs),
+        32,
+        'Output key'
+      )
+    ),
+    toNative(outputCounts),
+    threads
+  )
+
+  // Each match is three little-endian 32-bit integers and a tweak:
+  const data = fromNative(out)
+  const matchView = new DataView(data.buffer, data.byteOffset, data.length)
+  return unpackBytes(data, 44, data.length / 44).map((item, i) => ({
+    txIndex: matchView.getUint32(44 * i, true),
+    outputIndex: matchView.getUint32(44 * i + 4, true),
+    labelIndex: matchView.getInt32(44 * i + 8, true),
+    tweak: item.subarray(12)
+  }))
+}
+
+export const silentPayments = {
+  scan: silentPaymentsScan
+}
+
+export interface MusigKeyAgg {
+  // The 32-byte x-only aggregate key:
+  aggregateKey: Uint8Array
+  // Opaque session state for the signing steps:
+  keyaggCache: Uint8Array
+}
+
+/**
+ * An opaque reference to a secret nonce, which never leaves native
+ * memory. Signing uses it up, and the native cache evicts the
+ * least-recently-used ones, so release nonces for aborted sessions.
+ */
+export type MusigNonceHandle = number
+
+export interface MusigNonce {
+  // Pass this to partialSign, which only accepts it once:
+  nonceHandle: MusigNonceHandle
+  // Send this to the other signers:
+  pubnonce: Uint8Array
+}
+
+export interface MusigNonceGenOpts {
+  // 32 bytes of fresh randomness, unique for every call:
+  sessionRand: Uint8Array
+  publicKey: Uint8Array
+  // These optional values add extra protection against nonce reuse:
+  privateKey?: Uint8Array
+  msg?: Uint8Array
+  keyaggCache?: Uint8Array
+}
+
+function optionalNative(data: Uint8Array | undefined): NativeBytes {
+  return data == null ? '' : toNative(data)
+}
+
+/**
+ * Combines compressed public keys into a BIP327 MuSig2 aggregate key.
+ * Pass `sort: true` to get the same key regardless of signer order.
+ */
+async function musigKeyAgg(
+  publicKeys: Uint8Array[],
+  sort: boolean = true
+): Promise<MusigKeyAgg> {
+  const out: NativeBytes = await native.musigPubkeyAgg(
+    toNative(packBytes(publicKeys, 33, 'Public key')),
+    sort
+  )
+  const data = fromNative(out)
+  return { aggregateKey: data.subarray(0, 32), keyaggCache: data.subarray(32) }
+}
+
+/**
+ * Aggregates many same-sized signer sets in a single native call.
+ * Returns just the x-only aggregate keys.
+ */
+async function musigKeyAggBatch(
+  publicKeySets: Uint8Array[][],
+  sort: boolean = true,
+  threads: number = 0
+): Promise<Uint8Array[]> {
+  const setCount = publicKeySets.length
+  if (setCount === 0) return []
+  const keysPerSet = publicKeySets[0].length
+  if (publicKeySets.some(set => set.length !== keysPerSet)) {
+    throw new Error('musigKeyAggBatch needs the same signer count per set')
+  }
+
+  const out: NativeBytes = await native.musigPubkeyAggBatch(
+    toNative(packBytes(publicKeySets.flat(), 33, 'Public key')),
+    keysPerSet,
+    setCount,
+    sort,
+    threads
+  )
+  return unpackBytes(
+    fromNative(out),
+    32,
+    setCount
+  )
+}
+
+/**
+ * Tweaks the aggregate key, such as for BIP32 or taproot.
+ * Returns the 33-byte tweaked key and the updated cache.
+ */
+async function musigTweakAdd(
+  keyaggCache: Uint8Array,
+  tweak: Uint8Array,
+  xonly: boolean = false
+): Promise<{ publicKey: Uint8Array; keyaggCache: Uint8Array }> {
+  const out: NativeBytes = await native.musigPubkeyTweakAdd(
+    toNative(keyaggCache),
+    toNative(tweak),
+    xonly
+  )
+  const data = fromNative(out)
+  return { publicKey: data.subarray(0, 33), keyaggCache: data.subarray(33) }
+}
+
+async function musigNonceGen(opts: MusigNonceGenOpts): Promise<MusigNonce> {
+  const out: NativeBytes = await native.musigNonceGen(
+    toNative(opts.sessionRand),
+    optionalNative(opts.privateKey),
+    toNative(opts.publicKey),
+    optionalNative(opts.msg),
+    optionalNative(opts.keyaggCache)
+  )
+  // A little-endian 32-bit handle, followed by the public nonce:
+  const data = fromNative(out)
+  const dataView = new DataView(data.buffer, data.byteOffset, data.length)
+  return { nonceHandle: dataView.getUint32(0, true), pubnonce: data.subarray(4) }
+}
+
+async function musigNonceAgg(pubnonces: Uint8Array[]): Promise<Uint8Array> {
+  const out: NativeBytes = await native.musigNonceAgg(
+    toNative(packBytes(pubnonces, 66, 'Public nonce'))
+  )
+  return fromNative(out)
+}
+
+/**
+ * Creates a partial signature. The nonce is used up, even if signing
+ * fails, since signing two messages with one nonce leaks the private key.
+ */
+async function musigPartialSign(
+  nonceHandle: MusigNonceHandle,
+  privateKey: Uint8Array,
+  keyaggCache: Uint8Array,
+  aggnonce: Uint8Array,
+  msg: Uint8Array
+): Promise<Uint8Array> {
+  const out: NativeBytes = await native.musigPartialSign(
+    nonceHandle,
+    toNative(privateKey),
+    toNative(keyaggCache),
+    toNative(aggnonce),
+    toNative(msg)
+  )
+  return fromNative(out)
+}
+
+/**
+ * Wipes a secret nonce that will never sign, such as after a session
+ * is abandoned.
+ */
+async function musigNonceRelease(nonceHandle: MusigNonceHandle): Promise<void> {
+  await native.musigNonceRelease(nonceHandle)
+}
+
+async function musigPartialVerify(
+  partialSig: Uint8Array,
+  pubnonce: Uint8Array,
+  publicKey: Uint8Array,
+  keyaggCache: Uint8Array,
+  aggnonce: Uint8Array,
+  msg: Uint8Array
+): Promise<boolean> {
+  return await native.musigPartialVerify(
+    toNative(partialSig),
+    toNative(pubnonce),
+    toNative(publicKey),
+    toNative(keyaggCache),
+    toNative(aggnonce),
+    toNative(msg)
+  )
+}
+
+/**
+ * Combines partial signatures into a BIP340 Schnorr signature
+ * that verifies against the aggregate key.
+ */
+async function musigPartialSigAgg(
+  partialSigs: Uint8Array[],
+  keyaggCache: Uint8Array,
+  aggnonce: Uint8Array,
+  msg: Uint8Array
+): Promise<Uint8Array> {
+  const out: NativeBytes = await native.musigPartialSigAgg(
+    toNative(packBytes(partialSigs, 32, 'Partial signature')),
+    toNative(keyaggCache),
+    toNative(aggnonce),
+    toNative(msg)
+  )
+  return fromNative(out)
+}
+
+export const musig = {
+  keyAgg: musigKeyAgg,
+  keyAggBatch: musigKeyAggBatch,
+  tweakAdd: musigTweakAdd,
+  nonceGen: musigNonceGen,
+  nonceAgg: musigNonceAgg,
+  partialSign: musigPartialSign,
+  nonceRelease: musigNonceRelease,
+  partialVerify: musigPartialVerify,
+  partialSigAgg: musigPartialSigAgg
+}
+
+/**
+ * An opaque reference to a parsed key living on the native side.
+ * Chained operations on handles skip the parse and serialize steps
+ * in between. The native cache holds a bounded number of handles,
+ * evicting the least-recently-used ones, so release them when done.
+ */
+export type KeyHandle = number
+
+async function keyHandleFromPublicKey(
+  publicKey: Uint8Array
+): Promise<KeyHandle> {
+  return await native.secp256k1KeyHandleCreate(
+    toNative(publicKey),
+    false
+  )
+}
+
+async function keyHandleFromPrivateKey(
+  privateKey: Uint8Array
+): Promise<KeyHandle> {
+  return await native.secp256k1KeyHandleCreate(
+    toNative(privateKey),
+    true
+  )
+}
+
+/**
+ * Turns a private key handle into a new public key handle.
+ */
+async function keyHandlePublicKey(handle: KeyHandle): Promise<KeyHandle> {
+  return await native.secp256k1KeyHandlePublicKey(handle)
+}
+
+/**
+ * Adds a 32-byte tweak to a private or public key handle,
+ * returning a new handle of the same kind.
+ */
+async function keyHandleTweakAdd(
+  handle: KeyHandle,
+  tweak: Uint8Array
+): Promise<KeyHandle> {
+  return await native.secp256k1KeyHandleTweakAdd(
+    handle,
+    toNative(tweak)
+  )
+}
+
+/**
+ * Adds public key handles together, returning a new handle.
+ */
+async function keyHandleCombine(handles: KeyHandle[]): Promise<KeyHandle> {
+  return await native.secp256k1KeyHandleCombine(handles)
+}
+
+/**
+ * Returns the key behind a handle. Private keys ignore `compressed`.
+ */
+async function keyHandleSerialize(
+  handle: KeyHandle,
+  compressed: boolean = true
+): Promise<Uint8Array> {
+  const out: NativeBytes = await native.secp256k1KeyHandleSerialize(
+    handle,
+    compressed
+  )
+  return fromNative(out)
+}
+
+async function keyHandleRelease(handle: KeyHandle): Promise<void> {
+  await native.secp256k1KeyHandleRelease(handle)
+}
+
+export const keyHandles = {
+  fromPublicKey: keyHandleFromPublicKey,
+  fromPrivateKey: keyHandleFromPrivateKey,
+  publicKey: keyHandlePublicKey,
+  tweakAdd: keyHandleTweakAdd,
+  combine: keyHandleCombine,
+  serialize: keyHandleSerialize,
+  release: keyHandleRelease
+}
+
+export type MultisigScriptType = 'p2sh' | 'p2wsh' | 'p2sh-p2wsh'
+
+const multisigScriptTypes: {
+  [type in MultisigScriptType]: [number, number]
+} = {
+  // Native constant, hash length:
+  p2sh: [0, 20],
+  p2wsh: [1, 32],
+  'p2sh-p2wsh': [2, 20]
+}
+
+export interface MultisigXpub {
+  chainCode: Uint8Array
+  // The 33-byte compressed public key:
+  publicKey: Uint8Array
+}
+
+export interface MultisigDeriveOpts {
+  // The cosigners' account-level extended public keys:
+  xpubs: MultisigXpub[]
+  // The number of signatures needed:
+  m: number
+  scriptType: MultisigScriptType
+  startIndex: number
+  count: number
+  threads?: number
+}
+
+/**
+ * Derives the script hashes for a range of m-of-n multisig addresses
+ * in a single native call. Each index derives every cosigner's child key,
+ * sorts them by BIP67, and hashes the resulting CHECKMULTISIG script.
+ */
+async function multisigDeriveScriptHashes(
+  opts: MultisigDeriveOpts
+): Promise<Uint8Array[]> {
+  const { xpubs, m, scriptType, startIndex, count, threads = 0 } = opts
+  if (count === 0) return []
+  const [type, hashLength] = multisigScriptTypes[scriptType]
+
+  const packed = new Uint8Array(65 * xpubs.length)
+  xpubs.forEach((xpub, i) => {
+    if (xpub.chainCode.length !== 32 || xpub.publicKey.length !== 33) {
+      throw new Error(`Cosigner ${i} is not a valid extended public key`)
+    }
+    packed.set(xpub.chainCode, 65 * i)
+    packed.set(xpub.publicKey, 65 * i + 32)
+  })
+
+  const out: NativeBytes = await native.multisigDeriveBatch(
+    toNative(packed),
+    m,
+    startIndex,
+    count,
+    type,
+    threads
+  )
+  return unpackBytes(
+    fromNative(out),
+    hashLength,
+    count
+  )
+}
+
+export const multisig = {
+  deriveScriptHashes: multisigDeriveScriptHashes
+}
+
+export type AesImplementation = 'auto' | 'bitsliced' | 'aesni' | 'armv8'
+
+// In the order of the native constants:
+const aesImplementations: AesImplementation[] = [
+  'auto',
+  'bitsliced',
+  'aesni',
+  'armv8'
+]
+
+export interface AesCbcOpts {
+  // Add and remove PKCS#7 padding. Defaults to true:
+  padding?: boolean
+}
+
+async function aesCbcEncrypt(
+  key: Uint8Array,
+  iv: Uint8Array,
+  data: Uint8Array,
+  opts: AesCbcOpts = {}
+): Promise<Uint8Array> {
+  const { padding = true } = opts
+  const out: NativeBytes = await native.aes256CbcEncrypt(
+    toNative(key),
+    toNative(iv),
+    toNative(data),
+    padding
+  )
+  return fromNative(out)
+}
+
+async function aesCbcDecrypt(
+  key: Uint8Array,
+  iv: Uint8Array,
+  data: Uint8Array,
+  opts: AesCbcOpts = {}
+): Promise<Uint8Array> {
+  const { padding = true } = opts
+  const out: NativeBytes = await native.aes256CbcDecrypt(
+    toNative(key),
+    toNative(iv),
+    toNative(data),
+    padding
+  )
+  return fromNative(out)
+}
+
+/**
+ * Encrypts with AES-256-GCM and a 12-byte IV.
+ * The 16-byte tag goes after the ciphertext, as in WebCrypto.
+ */
+async function aesGcmEncrypt(
+  key: Uint8Array,
+  iv: Uint8Array,
+  data: Uint8Array,
+  aad: Uint8Array = new Uint8Array(0)
+): Promise<Uint8Array> {
+  const out: NativeBytes = await native.aes256GcmEncrypt(
+    toNative(key),
+    toNative(iv),
+    toNative(aad),
+    toNative(data)
+  )
+  return fromNative(out)
+}
+
+/**
+ * Checks the trailing tag and decrypts with AES-256-GCM.
+ * Rejects if the data or additional data has been tampered with.
+ */
+async function aesGcmDecrypt(
+  key: Uint8Array,
+  iv: Uint8Array,
+  data: Uint8Array,
+  aad: Uint8Array = new Uint8Array(0)
+): Promise<Uint8Array> {
+  const out: NativeBytes = await native.aes256GcmDecrypt(
+    toNative(key),
+    toNative(iv),
+    toNative(aad),
+    toNative(data)
+  )
+  return fromNative(out)
+}
+
+/**
+ * Forces a particular AES implementation, mainly for benchmarks.
+ * Returns false if this CPU lacks it. Pass 'auto' to go back to
+ * the fastest available one.
+ */
+async function aesSetImplementation(
+  implementation: AesImplementation
+): Promise<boolean> {
+  return await native.aesSetImplementation(
+    aesImplementations.indexOf(implementation)
+  )
+}
+
+async function aesGetImplementation(): Promise<AesImplementation> {
+  const out: number = await native.aesGetImplementation()
+  return aesImplementations[out]
+}
+
+export const aes = {
+  cbcEncrypt: aesCbcEncrypt,
+  cbcDecrypt: aesCbcDecrypt,
+  gcmEncrypt: aesGcmEncrypt,
+  gcmDecrypt: aesGcmDecrypt,
+  setImplementation: aesSetImplementation,
+  getImplementation: aesGetImplementation
+}
+
+export type ChaCha20Implementation =
+  | 'auto'
+  | 'portable'
+  | 'sse2'
+  | 'avx2'
+  | 'neon'
+
+// In the order of the native constants:
+const chacha20Implementations: ChaCha20Implementation[] = [
+  'auto',
+  'portable',
+  'sse2',
+  'avx2',
+  'neon'
+]
+
+/**
+ * Encrypts with ChaCha20-Poly1305. A 12-byte nonce selects RFC 8439,
+ * and a 24-byte nonce selects XChaCha20-Poly1305.
+ * The 16-byte tag goes after the ciphertext.
+ */
+async function chacha20Poly1305Encrypt(
+  key: Uint8Array,
+  nonce: Uint8Array,
+  data: Uint8Array,
+  aad: Uint8Array = new Uint8Array(0)
+): Promise<Uint8Array> {
+  const out: NativeBytes = await native.chacha20Poly1305Encrypt(
+    toNative(key),
+    toNative(nonce),
+    toNative(aad),
+    toNative(data)
+  )
+  return fromNative(out)
+}
+
+/**
+ * Checks the trailing tag and decrypts with ChaCha20-Poly1305 or
+ * XChaCha20-Poly1305, depending on the nonce length.
+ */
+async function chacha20Poly1305Decrypt(
+  key: Uint8Array,
+  nonce: Uint8Array,
+  data: Uint8Array,
+  aad: Uint8Array = new Uint8Array(0)
+): Promise<Uint8Array> {
+  const out: NativeBytes = await native.chacha20Poly1305Decrypt(
+    toNative(key),
+    toNative(nonce),
+    toNative(aad),
+    toNative(data)
+  )
+  return fromNative(out)
+}
+
+export interface AeadEncryptStream {
+  // Encrypts the next chunk, which can be any size:
+  update: (data: Uint8Array) => Promise<Uint8Array>
+  // Closes the stream and returns the 16-byte tag:
+  final: () => Promise<Uint8Array>
+  // Closes the stream without finishing it:
+  release: () => Promise<void>
+}
+
+export interface AeadDecryptStream {
+  // Decrypts the next chunk. Nothing is authentic until `final` succeeds:
+  update: (data: Uint8Array) => Promise<Uint8Array>
+  // Closes the stream, rejecting if the tag does not match:
+  final: (tag: Uint8Array) => Promise<void>
+  // Closes the stream without finishing it:
+  release: () => Promise<void>
+}
+
+async function createChaCha20Poly1305Stream(
+  key: Uint8Array,
+  nonce: Uint8Array,
+  aad: Uint8Array,
+  decrypt: boolean
+): Promise<number> {
+  return await native.chacha20Poly1305StreamCreate(
+    toNative(key),
+    toNative(nonce),
+    toNative(aad),
+    decrypt
+  )
+}
+
+async function chacha20Poly1305StreamUpdate(
+  stream: number,
+  data: Uint8Array
+): Promise<Uint8Array> {
+  const out: NativeBytes = await native.chacha20Poly1305StreamUpdate(
+    stream,
+    toNative(data)
+  )
+  return fromNative(out)
+}
+
+/**
+ * Opens a native encryption stream, so large payloads can cross the
+ * bridge a chunk at a time. Each stream holds native memory until
+ * `final` or `release`, and only a limited number can be open at once.
+ */
+async function chacha20Poly1305CreateEncryptStream(
+  key: Uint8Array,
+  nonce: Uint8Array,
+  aad: Uint8Array = new Uint8Array(0)
+): Promise<AeadEncryptStream> {
+  const stream = await createChaCha20Poly1305Stream(key, nonce, aad, false)
+  return {
+    update: async data => await chacha20Poly1305StreamUpdate(stream, data),
+    async final() {
+      const out: NativeBytes = await native.chacha20Poly1305StreamFinal(
+        stream,
+        ''
+      )
+      return fromNative(out)
+    },
+    release: async () =>
+      await native.chacha20Poly1305StreamRelease(stream)
+  }
+}
+
+async function chacha20Poly1305CreateDecryptStream(
+  key: Uint8Array,
+  nonce: Uint8Array,
+  aad: Uint8Array = new Uint8Array(0)
+): Promise<AeadDecryptStream> {
+  const stream = await createChaCha20Poly1305Stream(key, nonce, aad, true)
+  return {
+    update: async data => await chacha20Poly1305StreamUpdate(stream, data),
+    async final(tag) {
+      await native.chacha20Poly1305StreamFinal(
+        stream,
+        toNative(tag)
+      )
+    },
+    release: async () =>
+      await native.chacha20Poly1305StreamRelease(stream)
+  }
+}
+
+/**
+ * Forces a particular ChaCha20 implementation, mainly for benchmarks.
+ * Returns false if this CPU lacks it. Pass 'auto' to go back to
+ * the fastest available one.
+ */
+async function chacha20SetImplementation(
+  implementation: ChaCha20Implementation
+): Promise<boolean> {
+  return await native.chacha20SetImplementation(
+    chacha20Implementations.indexOf(implementation)
+  )
+}
+
+async function chacha20GetImplementation(): Promise<ChaCha20Implementation> {
+  const out: number = await native.chacha20GetImplementation()
+  return chacha20Implementations[out]
+}
+
+export const chacha20poly1305 = {
+  encrypt: chacha20Poly1305Encrypt,
+  decrypt: chacha20Poly1305Decrypt,
+  createEncryptStream: chacha20Poly1305CreateEncryptStream,
+  createDecryptStream: chacha20Poly1305CreateDecryptStream,
+  setImplementation: chacha20SetImplementation,
+  getImplementation: chacha20GetImplementation
+}
+
+export type RecordStatus =
+  | 'ok'
+  | 'bad-length'
+  | 'bad-mac'
+  | 'bad-padding'
+  | 'kdf-failed'
+
+const recordStatuses: RecordStatus[] = [
+  'ok',
+  'bad-length',
+  'bad-mac',
+  'bad-padding',
+  'kdf-failed'
+]
+
+export interface RecordScryptKey {
+  password: Uint8Array
+  salt: Uint8Array
+  N: number
+  r: number
+  p: number
+}
+
+export interface DecryptedRecord {
+  status: RecordStatus
+  // Empty unless the status is 'ok':
+  data: Uint8Array
+}
+
+export interface RecordDecryptOpts {
+  // The 64-byte data key (the AES key, then the HMAC key),
+  // or the scrypt inputs to derive it from without leaving native code:
+  key: Uint8Array | RecordScryptKey
+  // Each record is an IV, the AES-256-CBC ciphertext,
+  // and an HMAC-SHA256 of the IV and ciphertext:
+  records: Uint8Array[]
+  threads?: number
+}
+
+/**
+ * Checks and decrypts a batch of encrypted storage records
+ * in a single native call.
+ */
+async function recordsDecryptBatch(
+  opts: RecordDecryptOpts
+): Promise<DecryptedRecord[]> {
+  const { key, records, threads = 0 } = opts
+  if (records.length === 0) return []
+
+  const { data: packed, lens: recordLens } = packVariable(records)
+
+  const out: NativeBytes =
+    key instanceof Uint8Array
+      ? await native.recordsDecryptBatch(
+          toNative(key),
+          toNative(packed),
+          toNative(recordLens),
+          threads
+        )
+      : await native.recordsDecryptBatchScrypt(
+          toNative(key.password),
+          toNative(key.salt),
+          key.N,
+          key.r,
+          key.p,
+          toNative(packed),
+          toNative(recordLens),
+          threads
+        )
+
+  // Each record is a status byte, a little-endian 32-bit length,
+  // and the plaintext:
+  const data = fromNative(out)
+  const dataView = new DataView(data.buffer, data.byteOffset, data.length)
+  const results: DecryptedRecord[] = []
+  for (let i = 0, position = 0; i < records.length; ++i) {
+    const length = dataView.getUint32(position + 1, true)
+    results.push({
+      status: recordStatuses[data[position]],
+      data: data.subarray(position + 5, position + 5 + length)
+    })
+    position += 5 + length
+  }
+  return results
+}
+
+export const records = {
+  decryptBatch: recordsDecryptBatch
+}
+
+async function ed25519PublicKeyCreateBatch(
+  privateKeys: Uint8Array[],
+  threads: number = 0
+): Promise<Uint8Array[]> {
+  const count = privateKeys.length
+  if (count === 0) return []
+  const out: NativeBytes = await native.ed25519PubkeyCreateBatch(
+    toNative(packBytes(privateKeys, 32, 'Private key')),
+    count,
+    threads
+  )
+  return unpackBytes(fromNative(out), 32, count)
+}
+
+async function ed25519PublicKeyCreate(
+  privateKey: Uint8Array
+): Promise<Uint8Array> {
+  const [out] = await ed25519PublicKeyCreateBatch([privateKey])
+  return out
+}
+
+async function ed25519Sign(
+  msg: Uint8Array,
+  privateKey: Uint8Array
+): Promise<Uint8Array> {
+  if (privateKey.length !== 32) {
+    throw new Error('Private key must be 32 bytes')
+  }
+  const sig: NativeBytes = await native.ed25519Sign(
+    toNative(privateKey),
+    toNative(msg)
+  )
+  return fromNative(sig)
+}
+
+/**
+ * Verifies many signatures over messages of any length
+ * in a single native call.
+ */
+async function ed25519VerifyBatch(
+  sigs: Uint8Array[],
+  msgs: Uint8Array[],
+  publicKeys: Uint8Array[],
+  threads: number = 0
+): Promise<boolean[]> {
+  const count = sigs.length
+  if (count === 0) return []
+  if (msgs.length !== count || publicKeys.length !== count) {
+    throw new Error('verifyBatch needs one message and key per signature')
+  }
+  const { data, lens } = packVariable(msgs)
+  const results: NativeBytes = await native.ed25519VerifyBatch(
+    toNative(packBytes(sigs, 64, 'Signature')),
+    toNative(data),
+    toNative(lens),
+    toNative(packBytes(publicKeys, 32, 'Public key')),
+    threads
+  )
+  return Array.from(fromNative(results), valid => valid === 1)
+}
+
+async function ed25519Verify(
+  sig: Uint8Array,
+  msg: Uint8Array,
+  publicKey: Uint8Array
+): Promise<boolean> {
+  const [out] = await ed25519VerifyBatch([sig], [msg], [publicKey])
+  return out
+}
+
+export const ed25519 = {
+  publicKeyCreate: ed25519PublicKeyCreate,
+  publicKeyCreateBatch: ed25519PublicKeyCreateBatch,
+  sign: ed25519Sign,
+  verify: ed25519Verify,
+  verifyBatch: ed25519VerifyBatch
+}
+
+export interface Slip10Key {
+  privateKey: Uint8Array
+  publicKey: Uint8Array
+}
+
+/**
+ * Turns a path like "m/44'/501'/0'" into its indices.
+ * SLIP-0010 only allows hardened Ed25519 indices.
+ */
+function parseSlip10Path(path: string | number[]): number[] {
+  if (typeof path !== 'string') return path
+  const parts = path.split('/')
+  if (parts[0] !== 'm') throw new Error(`Invalid path ${path}`)
+  return parts.slice(1).map(part => {
+    const match = /^(\d+)['hH]$/.exec(part)
+    if (match == null || Number(match[1]) >= 0x80000000) {
+      throw new Error(`Ed25519 path ${path} must be fully hardened`)
+    }
+    return Number(match[1]) + 0x80000000
+  })
+}
+
+/**
+ * Derives SLIP-0010 Ed25519 keys for many paths from one seed
+ * in a single native call. Paths are either strings like "m/44'/501'/0'"
+ * or lists of indices with the hardened bit (0x80000000) set.
+ */
+async function slip10Ed25519DeriveBatch(
+  seed: Uint8Array,
+  paths: Array<string | number[]>,
+  threads: number = 0
+): Promise<Slip10Key[]> {
+  const count = paths.length
+  if (count === 0) return []
+  const indices = paths.map(parseSlip10Path)
+  const pathLens = new Uint8Array(4 * count)
+  const lensView = new DataView(pathLens.buffer)
+  indices.forEach((path, i) => lensView.setUint32(4 * i, path.length, true))
+  const packed = new Uint8Array(
+    4 * indices.reduce((total, path) => total + path.length, 0)
+  )
+  const packedView = new DataView(packed.buffer)
+  let offset = 0
+  for (const path of indices) {
+    for (const index of path) {
+      packedView.setUint32(offset, index, true)
+      offset += 4
+    }
+  }
+
+  const out: NativeBytes = await native.slip10Ed25519DeriveBatch(
+    toNative(seed),
+    toNative(packed),
+    toNative(pathLens),
+    threads
+  )
+
+  // The private keys come first, followed by the public keys:
+  const data = fromNative(out)
+  const publicKeys = unpackBytes(data.subarray(32 * count), 32, count)
+  return unpackBytes(data, 32, count).map((privateKey, i) => ({
+    privateKey,
+    publicKey: publicKeys[i]
+  }))
+}
+
+async function slip10Ed25519Derive(
+  seed: Uint8Array,
+  path: string | number[]
+): Promise<Slip10Key> {
+  const [out] = await slip10Ed25519DeriveBatch(seed, [path])
+  return out
+}
+
+export const slip10 = {
+  ed25519Derive: slip10Ed25519Derive,
+  ed25519DeriveBatch: slip10Ed25519DeriveBatch
+}
+
+/**
+ * Derives a key with Argon2id (RFC 9106), using `t` passes over
+ * `m` KiB of memory split into `p` lanes. The lanes run in parallel,
+ * on one thread per CPU core unless `threads` says otherwise.
+ */
+export async function argon2id(
+  passwdBytes: Uint8Array,
+  saltBytes: Uint8Array,
+  t: number,
+  m: number,
+  p: number,
+  size: number,
+  threads: number = 0
+): Promise<Uint8Array> {
+  const out: NativeBytes = await native.argon2id(
+    toNative(passwdBytes),
+    toNative(saltBytes),
+    t,
+    m,
+    p,
+    threads,
+    size
+  )
+  return fromNative(out)
+}
+
+export type Argon2Implementation =
+  | 'auto'
+  | 'portable'
+  | 'ssse3'
+  | 'avx2'
+  | 'neon'
+
+// In the order of the native constants:
+const argon2Implementations: Argon2Implementation[] = [
+  'auto',
+  'portable',
+  'ssse3',
+  'avx2',
+  'neon'
+]
+
+async function argon2SetImplementation(
+  implementation: Argon2Implementation
+): Promise<boolean> {
+  return await native.argon2SetImplementation(
+    argon2Implementations.indexOf(implementation)
+  )
+}
+
+async function argon2GetImplementation(): Promise<Argon2Implementation> {
+  const out: number = await native.argon2GetImplementation()
+  return argon2Implementations[out]
+}
+
+export const argon2 = {
+  setImplementation: argon2SetImplementation,
+  getImplementation: argon2GetImplementation
+}
+
+export type Bip39Status =
+  | 'ok'
+  | 'bad-utf8'
+  | 'bad-wordlist'
+  | 'bad-length'
+  | 'bad-word'
+  | 'bad-checksum'
+  | 'bad-master-key'
+
+// In the order of the native constants:
+const bip39Statuses: Bip39Status[] = [
+  'ok',
+  'bad-utf8',
+  'bad-wordlist',
+  'bad-length',
+  'bad-word',
+  'bad-checksum',
+  'bad-master-key'
+]
+
+export interface Bip39Seed {
+  // The 64-byte BIP39 seed:
+  seed: Uint8Array
+  // The BIP32 master key for the seed:
+  chainCode: Uint8Array
+  privateKey: Uint8Array
+}
+
+export interface Bip39BatchSeed extends Bip39Seed {
+  // The keys are all zeros unless this is 'ok':
+  status: Bip39Status
+}
+
+export interface Bip39Opts {
+  // The UTF-8 words, separated by newlines. Defaults to English:
+  wordlist?: Uint8Array
+  threads?: number
+}
+
+/**
+ * Checks a UTF-8 BIP39 mnemonic, then derives its seed and BIP32
+ * master key once for each UTF-8 passphrase. Normalization, checking,
+ * and derivation all happen in a single native call, spread across
+ * worker threads.
+ */
+async function bip39MnemonicToSeedBatch(
+  mnemonic: Uint8Array,
+  passphrases: Uint8Array[],
+  opts: Bip39Opts = {}
+): Promise<Bip39BatchSeed[]> {
+  const { wordlist, threads = 0 } = opts
+  const count = passphrases.length
+  if (count === 0) return []
+  const { data: packed, lens } = packVariable(passphrases)
+
+  const out: NativeBytes = await native.bip39MnemonicToSeedBatch(
+    toNative(mnemonic),
+    toNative(packed),
+    toNative(lens),
+    wordlist == null ? '' : toNative(wordlist),
+    threads
+  )
+
+  // The statuses come first, followed by the seeds and the master keys,
+  // which are a chain code followed by a private key:
+  const data = fromNative(out)
+  const seeds = unpackBytes(data.subarray(count), 64, count)
+  const xprvs = unpackBytes(data.subarray(65 * count), 64, count)
+  return seeds.map((seed, i) => ({
+    status: bip39Statuses[data[i]],
+    seed,
+    chainCode: xprvs[i].subarray(0, 32),
+    privateKey: xprvs[i].subarray(32)
+  }))
+}
+
+/**
+ * Checks a UTF-8 BIP39 mnemonic, then derives its seed and BIP32
+ * master key. Throws if the mnemonic is invalid.
+ */
+async function bip39MnemonicToSeed(
+  mnemonic: Uint8Array,
+  passphrase: Uint8Array = new Uint8Array(0),
+  opts: Bip39Opts = {}
+): Promise<Bip39Seed> {
+  const [{ status, seed, chainCode, privateKey }] =
+    await bip39MnemonicToSeedBatch(mnemonic, [passphrase], opts)
+  if (status !== 'ok') throw new Error(`Invalid BIP39 mnemonic: ${status}`)
+  return { seed, chainCode, privateKey }
+}
+
+export const bip39 = {
+  mnemonicToSeed: bip39MnemonicToSeed,
+  mnemonicToSeedBatch: bip39MnemonicToSeedBatch
+}
+
+export type AddressFormat = 'base58check' | 'segwit' | 'cashaddr'
+
+// In the order of the native constants:
+const addressFormats: AddressFormat[] = ['base58check', 'segwit', 'cashaddr']
+
+export interface AddressOpts {
+  format: AddressFormat
+  // The version bytes for base58check, or the human-readable part
+  // or network prefix, such as 'bc' or 'bitcoincash':
+  prefix: Uint8Array | string
+  threads?: number
+}
+
+export interface AddressEncodeOpts extends AddressOpts {
+  // The witness version for segwit,
+  // or the type for cashaddr (0 for P2PKH, 1 for P2SH):
+  version?: number
+}
+
+export interface DecodedAddress {
+  // The witness version for segwit, the type for cashaddr,
+  // or 0 for base58check:
+  version: number
+  // The hash or witness program, without any base58check version bytes:
+  payload: Uint8Array
+}
+
+/**
+ * Turns a string prefix into ASCII bytes. Other characters become
+ * zeros, which no address format accepts.
+ */
+function packAddressPrefix(prefix: Uint8Array | string): NativeBytes {
+  if (prefix instanceof Uint8Array) return toNative(prefix)
+  const bytes = new Uint8Array(prefix.length)
+  for (let i = 0; i < prefix.length; ++i) {
+    const code = prefix.charCodeAt(i)
+    bytes[i] = code < 0x80 ? code : 0
+  }
+  return toNative(bytes)
+}
+
+/**
+ * Encodes hashes or witness programs as address strings in a single
+ * native call. Payloads that cannot be encoded give `undefined`.
+ */
+async function addressEncodeBatch(
+  payloads: Uint8Array[],
+  opts: AddressEncodeOpts
+): Promise<Array<string | undefined>> {
+  const { format, prefix, version = 0, threads = 0 } = opts
+  if (payloads.length === 0) return []
+  const { data: packed, lens } = packVariable(payloads)
+
+  // The addresses come back as one newline-separated string:
+  const out: string = await native.addressEncodeBatch(
+    addressFormats.indexOf(format),
+    packAddressPrefix(prefix),
+    version,
+    toNative(packed),
+    toNative(lens),
+    threads
+  )
+  return out.split('\n').map(address => (address === '' ? undefined : address))
+}
+
+/**
+ * Checks and decodes address strings in a single native call.
+ * Addresses that are invalid, or belong to another network,
+ * give `undefined`.
+ */
+async function addressDecodeBatch(
+  addresses: string[],
+  opts: AddressOpts
+): Promise<Array<DecodedAddress | undefined>> {
+  const { format, prefix, threads = 0 } = opts
+  if (addresses.length === 0) return []
+
+  // The addresses cross as one newline-separated string,
+  // so anything with a newline in it becomes an invalid empty address:
+  const out: NativeBytes = await native.addressDecodeBatch(
+    addressFormats.indexOf(format),
+    packAddressPrefix(prefix),
+    addresses
+      .map(address => (address.includes('\n') ? '' : address))
+      .join('\n'),
+    threads
+  )
+
+  // Each address is a version byte (0xff if it failed),
+  // a length byte, and the payload:
+  const data = fromNative(out)
+  const results: Array<DecodedAddress | undefined> = []
+  for (let i = 0, position = 0; i < addresses.length; ++i) {
+    const version = data[position]
+    const length = data[position + 1]
+    results.push(
+      version === 0xff
+        ? undefined
+        : {
+            version,
+            payload: data.subarray(position + 2, position + 2 + length)
+          }
+    )
+    position += 2 + length
+  }
+  return results
+}
+
+/**
+ * Encodes a hash or witness program as an address string.
+ * Throws if the payload cannot be encoded.
+ */
+async function addressEncode(
+  payload: Uint8Array,
+  opts: AddressEncodeOpts
+): Promise<string> {
+  const [address] = await addressEncodeBatch([payload], opts)
+  if (address == null) throw new Error(`Cannot encode ${opts.format} address`)
+  return address
+}
+
+/**
+ * Checks and decodes an address string.
+ * Throws if the address is invalid.
+ */
+async function addressDecode(
+  address: string,
+  opts: AddressOpts
+): Promise<DecodedAddress> {
+  const [decoded] = await addressDecodeBatch([address], opts)
+  if (decoded == null) throw new Error(`Invalid ${opts.format} address`)
+  return decoded
+}
+
+export const address = {
+  encode: addressEncode,
+  decode: addressDecode,
+  encodeBatch: addressEncodeBatch,
+  decodeBatch: addressDecodeBatch
+}
+
+/**
+ * Returns bytes from the native ChaCha20 DRBG, which seeds itself from
+ * the OS and keeps separate state for each native thread.
+ */
+async function randomBytes(size: number): Promise<Uint8Array> {
+  const out: NativeBytes = await native.randomBytes(size)
+  return fromNative(out)
+}
+
+export type KeyType =
+  | 'secp256k1'
+  | 'secp256k1-uncompressed'
+  | 'secp256k1-xonly'
+  | 'ed25519'
+
+// In the order of the native constants:
+const keyTypes: KeyType[] = [
+  'secp256k1',
+  'secp256k1-uncompressed',
+  'secp256k1-xonly',
+  'ed25519'
+]
+const keyTypePublicKeyLengths = [33, 65, 32, 32]
+
+export interface GeneratedKey {
+  // The 32-byte private key, or Ed25519 seed:
+  privateKey: Uint8Array
+  publicKey: Uint8Array
+}
+
+/**
+ * Generates fresh key pairs in a single native call, so the random
+ * material never crosses the bridge on its way to becoming keys.
+ */
+async function generateKeys(
+  keyType: KeyType,
+  count: number,
+  threads: number = 0
+): Promise<GeneratedKey[]> {
+  const type = keyTypes.indexOf(keyType)
+  if (type < 0) throw new Error(`Unknown key type ${keyType}`)
+  if (count === 0) return []
+
+  // The private keys come first, followed by the public keys:
+  const out: NativeBytes = await native.keysGenerateBatch(type, count, threads)
+  const data = fromNative(out)
+  const privateKeys = unpackBytes(data, 32, count)
+  const publicKeys = unpackBytes(
+    data.subarray(32 * count),
+    keyTypePublicKeyLengths[type],
+    count
+  )
+  return privateKeys.map((privateKey, i) => ({
+    privateKey,
+    publicKey: publicKeys[i]
+  }))
+}
+
+export const random = {
+  bytes: randomBytes,
+  generateKeys
+}
+
+export type PoolPriority = 'interactive' | 'background'
+
+// In the order of the native constants:
+const poolPriorities: PoolPriority[] = ['interactive', 'background']
+
+export interface PoolOpts {
+  // Worker threads for this priority class:
+  threads: number
+
+  // Calls that may wait for a thread before new ones fail, default 256:
+  queueLimit?: number
+
+  // CPUs to pin the threads to, such as the big cores on a big.LITTLE
+  // phone. Only Android honors this. Leave it empty to use any CPU:
+  cpus?: number[]
+}
+
+/**
+ * Configures one priority class of the native worker pool.
+ * Key stretching and batches run in the background class, and
+ * everything else runs in the interactive class, so a slow scrypt
+ * never holds up a signature. Interactive calls start in the order
+ * they were made, so with more than one interactive thread,
+ * wait for each stream update before starting the next.
+ * Returns false if an option is out of range.
+ */
+async function configurePool(
+  priority: PoolPriority,
+  opts: PoolOpts
+): Promise<boolean> {
+  const { threads, queueLimit = 256, cpus = [] } = opts
+  const index = poolPriorities.indexOf(priority)
+  if (index < 0) throw new Error(`Unknown pool priority ${priority}`)
+  return await native.poolConfigure(index, threads, queueLimit, cpus)
+}
+
+export const pool = {
+  configure: configurePool
+}
+
+// Steps name the values they read and write. Inputs and outputs share
+// one namespace, and writing to an existing name replaces its value:
+export type PipelineStep =
+  | {
+      op: 'scrypt'
+      out: string
+      password: string
+      salt: string
+      N: number
+      r: number
+      p: number
+      size: number
+    }
+  | {
+      op: 'argon2id'
+      out: string
+      password: string
+      salt: string
+      t: number
+      m: number
+      p: number
+      size: number
+    }
+  | { op: 'sha256'; out: string; data: string }
+  | { op: 'hmacSha256' | 'hmacSha512'; out: string; key: string; data: string }
+  | { op: 'slice'; out: string; data: string; start: number; length: number }
+  | { op: 'concat'; out: string; first: string; second: string }
+  // Stops the pipeline with 'mismatch' unless both values are equal:
+  | { op: 'verify'; actual: string; expected: string }
+  | {
+      op: 'aesCbcEncrypt' | 'aesCbcDecrypt'
+      out: string
+      key: string
+      iv: string
+      data: string
+      // PKCS#7 padding, default true:
+      pad?: boolean
+    }
+
+export type PipelineStatus =
+  | 'ok'
+  | 'bad-step'
+  | 'bad-length'
+  | 'mismatch'
+  | 'bad-padding'
+  | 'kdf-failed'
+
+// In the order of the native constants:
+const pipelineStatuses: PipelineStatus[] = [
+  'ok',
+  'bad-step',
+  'bad-length',
+  'mismatch',
+  'bad-padding',
+  'kdf-failed'
+]
+const pipelineOps: Array<PipelineStep['op']> = [
+  'scrypt',
+  'argon2id',
+  'sha256',
+  'hmacSha256',
+  'hmacSha512',
+  'slice',
+  'concat',
+  'verify',
+  'aesCbcEncrypt',
+  'aesCbcDecrypt'
+]
+
+// From native-crypto.h:
+const pipelineStepLength = 24
+const pipelineSlots = 16
+
+export interface PipelineOpts {
+  inputs: { [name: string]: Uint8Array }
+  steps: PipelineStep[]
+  // The value to return once every step is done:
+  output: string
+}
+
+export interface PipelineResult {
+  status: PipelineStatus
+  // The step that stopped the pipeline, unless the status is 'ok':
+  step: number
+  // Empty unless the status is 'ok':
+  data: Uint8Array
+}
+
+/**
+ * Lists the values a pipeline step reads and its numeric parameters.
+ */
+function pipelineStepFields(step: PipelineStep): {
+  sources: string[]
+  params: number[]
+} {
+  switch (step.op) {
+    case 'scrypt':
+      return {
+        sources: [step.password, step.salt],
+        params: [step.N, step.r, step.p, step.size]
+      }
+    case 'argon2id':
+      return {
+        sources: [step.password, step.salt],
+        params: [step.t, step.m, step.p, step.size]
+      }
+    case 'sha256':
+      return { sources: [step.data], params: [] }
+    case 'hmacSha256':
+    case 'hmacSha512':
+      return { sources: [step.key, step.data], params: [] }
+    case 'slice':
+      return { sources: [step.data], params: [step.start, step.length] }
+    case 'concat':
+      return { sources: [step.first, step.second], params: [] }
+    case 'verify':
+      return { sources: [step.actual, step.expected], params: [] }
+    case 'aesCbcEncrypt':
+    case 'aesCbcDecrypt':
+      return {
+        sources: [step.key, step.iv, step.data],
+        params: [step.pad === false ? 0 : 1]
+      }
+  }
+}
+
+/**
+ * Runs a chain of KDF, MAC, and cipher steps in a single native call,
+ * such as a login that stretches a password, checks a MAC, and then
+ * decrypts a key. The intermediate values never cross the bridge,
+ * and are wiped once the pipeline finishes.
+ */
+async function pipelineRun(opts: PipelineOpts): Promise<PipelineResult> {
+  const { inputs, steps, output } = opts
+
+  // Give each named value a native slot:
+  const slots = new Map<string, number>()
+  const names = Object.keys(inputs)
+  names.forEach((name, i) => slots.set(name, i))
+  function getSlot(name: string, create: boolean): number {
+    let slot = slots.get(name)
+    if (slot == null) {
+      if (!create) throw new Error(`Unknown pipeline value ${name}`)
+      slot = slots.size
+      if (slot >= pipelineSlots) throw new Error('Too many pipeline values')
+      slots.set(name, slot)
+    }
+    return slot
+  }
+
+  const program = new Uint8Array(pipelineStepLength * steps.length)
+  const view = new DataView(program.buffer)
+  steps.forEach((step, i) => {
+    const position = pipelineStepLength * i
+    const { sources, params } = pipelineStepFields(step)
+    program[position] = pipelineOps.indexOf(step.op)
+    sources.forEach((name, j) => {
+      program[position + 2 + j] = getSlot(name, false)
+    })
+    if (step.op !== 'verify') program[position + 1] = getSlot(step.out, true)
+    params.forEach((param, j) => {
+      view.setUint32(position + 8 + 4 * j, param, true)
+    })
+  })
+  const outputSlot = getSlot(output, false)
+
+  const { data: packed, lens: inputLens } = packVariable(
+    names.map(name => inputs[name])
+  )
+  const out = fromNative(
+    await native.pipelineRun(
+      toNative(program),
+      toNative(packed),
+      toNative(inputLens),
+      outputSlot
+    )
+  )
+
+  // The status byte and a little-endian 32-bit step index
+  // come before the output:
+  const dataView = new DataView(out.buffer, out.byteOffset, out.length)
+  return {
+    status: pipelineStatuses[out[0]],
+    step: dataView.getUint32(1, true),
+    data: out.subarray(5)
+  }
+}
+
+export const pipeline = {
+  run: pipelineRun
+}
+
+export type StatsOp =
+  | 'scrypt'
+  | 'argon2id'
+  | 'bip39'
+  | 'pipeline'
+  | 'records'
+  | 'aes'
+  | 'chacha20poly1305'
+  | 'secp256k1Keys'
+  | 'ecdsa'
+  | 'schnorr'
+  | 'ed25519'
+  | 'address'
+  | 'codec'
+  | 'random'
+
+// In the order of the native constants:
+const statsOps: StatsOp[] = [
+  'scrypt',
+  'argon2id',
+  'bip39',
+  'pipeline',
+  'records',
+  'aes',
+  'chacha20poly1305',
+  'secp256k1Keys',
+  'ecdsa',
+  'schnorr',
+  'ed25519',
+  'address',
+  'codec',
+  'random'
+]
+
+// From native-crypto.h:
+const statsHistogramBuckets = 32
+
+export interface OpStats {
+  calls: number
+  // Input bytes, where the operation has a natural size:
+  bytes: number
+  totalMs: number
+  maxMs: number
+  // Bucket i counts calls that took under 2^i microseconds,
+  // and the last bucket counts everything slower:
+  histogram: number[]
+}
+
+export interface NativeStats {
+  // False unless the native library was built with FAST_CRYPTO_STATS=1,
+  // in which case every count is zero:
+  enabled: boolean
+  // Bytes of locked memory holding secrets and KDF scratch space:
+  secureMemory: { inUse: number; peak: number; unlocked: number }
+  ops: { [op in StatsOp]: OpStats }
+}
+
+/**
+ * Reads the native call counters and latency histograms.
+ * Only calls from JavaScript count, not the work they do internally,
+ * so a pipeline's scrypt step shows up under 'pipeline' alone.
+ */
+async function statsSnapshot(): Promise<NativeStats> {
+  const out = fromNative(await native.statsSnapshot())
+  const view = new DataView(out.buffer, out.byteOffset, out.length)
+
+  // Native-endian 64-bit counters, which are little-endian on every
+  // platform we ship:
+  let position = 8
+  function read(): number {
+    const low = view.getUint32(position, true)
+    const high = view.getUint32(position + 4, true)
+    position += 8
+    return low + high * 0x100000000
+  }
+
+  const secureMemory = { inUse: read(), peak: read(), unlocked: read() }
+  const ops: Partial<NativeStats['ops']> = {}
+  for (const op of statsOps) {
+    const calls = read()
+    const bytes = read()
+    const totalMs = read() / 1e6
+    const maxMs = read() / 1e6
+    const histogram: number[] = []
+    for (let i = 0; i < statsHistogramBuckets; ++i) histogram.push(read())
+    ops[op] = { calls, bytes, totalMs, maxMs, histogram }
+  }
+  return {
+    enabled: out[0] !== 0,
+    secureMemory,
+    ops: ops as NativeStats['ops']
+  }
+}
+
+/**
+ * Zeroes the call counters and the peak secure memory use.
+ */
+async function statsReset(): Promise<void> {
+  await native.statsReset()
+}
+
+/**
+ * Starts recording one event per native call, keeping at most
+ * maxEvents of them. Returns false if the native library was built
+ * without FAST_CRYPTO_STATS=1 or a trace is already running.
+ */
+async function traceStart(maxEvents: number = 100000): Promise<boolean> {
+  return await native.traceStart(maxEvents)
+}
+
+/**
+ * Stops the trace and returns it as Chrome trace-event JSON,
+ * which chrome://tracing and Perfetto can open.
+ * Returns an empty string if no trace was recorded.
+ */
+async function traceStop(): Promise<string> {
+  return await native.traceStop()
+}
+
+export const stats = {
+  snapshot: statsSnapshot,
+  reset: statsReset,
+  traceStart,
+  traceStop
+}
@@ -1,222 +1,14 @@
-#include <android/log.h>
 #include <jni.h>
 #include "../native-crypto.h"
-
-#define LOG_TAG "crypto_bridge-JNI"
-
-#define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, __VA_ARGS__)
-
-extern "C" {
-
-/*
- * Copyright (c) 2003 Apple Computer, Inc. All rights reserved.
- *
- * @APPLE_LICENSE_HEADER_START@
- *
- * Copyright (c) 1999-2003 Apple Computer, Inc.  All Rights Reserved.
- *
- * This file contains Original Code and/or Modifications of Original Code
- * as defined in and that are subject to the Apple Public Source License
- * Version 2.0 (the 'License'). You may not use this file except in
- * compliance with the License. Please obtain a copy of the License at
- * http://www.opensource.apple.com/apsl/ and read it before using this
- * file.
- *
- * The Original Code and all software distributed under the License are
- * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
- * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
- * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
- * Please see the License for the specific language governing rights and
- * limitations under the License.
- *
- * @APPLE_LICENSE_HEADER_END@
- */
-/* ====================================================================
- * Copyright (c) 1995-1999 The Apache Group.  All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions
- * are met:
- *
- * 1. Redistributions of source code must retain the above copyright
- *    notice, this list of conditions and the following disclaimer.
- *
- * 2. Redistributions in binary form must reproduce the above copyright
- *    notice, this list of conditions and the following disclaimer in
- *    the documentation and/or other materials provided with the
- *    distribution.
- *
- * 3. All advertising materials mentioning features or use of this
- *    software must display the following acknowledgment:
- *    "This product includes software developed by the Apache Group
- *    for use in the Apache HTTP server project (http://www.apache.org/)."
- *
- * 4. The names "Apache Server" and "Apache Group" must not be used to
- *    endorse or promote products derived from this software without
- *    prior written permission. For written permission, please contact
- *    apache@apache.org.
- *
- * 5. Products derived from this software may not be called "Apache"
- *    nor may "Apache" appear in their names without prior written
- *    permission of the Apache Group.
- *
- * 6. Redistributions of any form whatsoever must retain the following
- *    acknowledgment:
- *    "This product includes software developed by the Apache Group
- *    for use in the Apache HTTP server project (http://www.apache.org/)."
- *
- * THIS SOFTWARE IS PROVIDED BY THE APACHE GROUP ``AS IS'' AND ANY
- * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
- * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
- * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE APACHE GROUP OR
- * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
- * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
- * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
- * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
- * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
- * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
- * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
- * OF THE POSSIBILITY OF SUCH DAMAGE.
- * ====================================================================
- *
- * This software consists of voluntary contributions made by many
- * individuals on behalf of the Apache Group and was originally based
- * on public domain software written at the National Center for
- * Supercomputing Applications, University of Illinois, Urbana-Champaign.
- * For more information on the Apache Group and the Apache HTTP server
- * project, please see <http://www.apache.org/>.
- *
- */
-
-/* Base64 encoder/decoder. Originally Apache file ap_base64.c
- */
+#include "../secure-memory.h"
 
 #include <string.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
 
-//#include "base64.h"
-
-/* aaaack but it's fast and const should make it shared text page. */
-static const unsigned char pr2six[256] =
-        {
-                /* ASCII table */
-                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 62, 64, 64, 64, 63,
-                52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 64, 64, 64, 64, 64, 64,
-                64,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
-                15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 64, 64, 64, 64, 64,
-                64, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
-                41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 64, 64, 64, 64, 64,
-                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-                64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64
-        };
-
-int Base64decode_len(const char *bufcoded)
-{
-    int nbytesdecoded;
-    const unsigned char *bufin;
-    int nprbytes;
-
-    bufin = (const unsigned char *) bufcoded;
-    while (pr2six[*(bufin++)] <= 63);
-
-    nprbytes = (bufin - (const unsigned char *) bufcoded) - 1;
-    nbytesdecoded = ((nprbytes + 3) / 4) * 3;
-
-    return nbytesdecoded + 1;
-}
-
-int Base64decode(char *bufplain, const char *bufcoded)
-{
-    int nbytesdecoded;
-    const unsigned char *bufin;
-    unsigned char *bufout;
-    int nprbytes;
-
-    bufin = (const unsigned char *) bufcoded;
-    while (pr2six[*(bufin++)] <= 63);
-    nprbytes = (bufin - (const unsigned char *) bufcoded) - 1;
-    nbytesdecoded = ((nprbytes + 3) / 4) * 3;
-
-    bufout = (unsigned char *) bufplain;
-    bufin = (const unsigned char *) bufcoded;
-
-    while (nprbytes > 4) {
-        *(bufout++) =
-                (unsigned char) (pr2six[*bufin] << 2 | pr2six[bufin[1]] >> 4);
-        *(bufout++) =
-                (unsigned char) (pr2six[bufin[1]] << 4 | pr2six[bufin[2]] >> 2);
-        *(bufout++) =
-                (unsigned char) (pr2six[bufin[2]] << 6 | pr2six[bufin[3]]);
-        bufin += 4;
-        nprbytes -= 4;
-    }
-
-    /* Note: (nprbytes == 1) would be an error, so just ingore that case */
-    if (nprbytes > 1) {
-        *(bufout++) =
-                (unsigned char) (pr2six[*bufin] << 2 | pr2six[bufin[1]] >> 4);
-    }
-    if (nprbytes > 2) {
-        *(bufout++) =
-                (unsigned char) (pr2six[bufin[1]] << 4 | pr2six[bufin[2]] >> 2);
-    }
-    if (nprbytes > 3) {
-        *(bufout++) =
-                (unsigned char) (pr2six[bufin[2]] << 6 | pr2six[bufin[3]]);
-    }
-
-    *(bufout++) = '\0';
-    nbytesdecoded -= (4 - nprbytes) & 3;
-    return nbytesdecoded;
-}
-
-static const char basis_64[] =
-        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-
-int Base64encode_len(int len)
-{
-    return ((len + 2) / 3 * 4) + 1;
-}
-
-int Base64encode(char *encoded, const char *string, int len)
-{
-    int i;
-    char *p;
-
-    p = encoded;
-    for (i = 0; i < len - 2; i += 3) {
-        *p++ = basis_64[(string[i] >> 2) & 0x3F];
-        *p++ = basis_64[((string[i] & 0x3) << 4) |
-                        ((int) (string[i + 1] & 0xF0) >> 4)];
-        *p++ = basis_64[((string[i + 1] & 0xF) << 2) |
-                        ((int) (string[i + 2] & 0xC0) >> 6)];
-        *p++ = basis_64[string[i + 2] & 0x3F];
-    }
-    if (i < len) {
-        *p++ = basis_64[(string[i] >> 2) & 0x3F];
-        if (i == (len - 1)) {
-            *p++ = basis_64[((string[i] & 0x3) << 4)];
-            *p++ = '=';
-        }
-        else {
-            *p++ = basis_64[((string[i] & 0x3) << 4) |
-                            ((int) (string[i + 1] & 0xF0) >> 4)];
-            *p++ = basis_64[((string[i + 1] & 0xF) << 2)];
-        }
-        *p++ = '=';
-    }
-
-    *p++ = '\0';
-    return p - encoded;
-}
+extern "C" {
 
 JNIEXPORT jstring JNICALL
 Java_co_airbitz_fastcrypto_RNFastCryptoModule_scryptJNI(JNIEnv *env, jobject thiz,
@@ -240,38 +32,31 @@ Java_co_airbitz_fastcrypto_RNFastCryptoModule_scryptJNI(JNIEnv *env, jobject thi
             return env->NewStringUTF("Salt error!");
         }
     }
-    LOGD("passwd=%s, salt=%s, n=%d, r=%d, p=%d, size=%d", szPassword, szSalt, N, r, p, size);
 
     // Base64 decode string into a buffer
-    size_t passwordBufSize = Base64decode_len(szPassword);
-    size_t saltBufSize = Base64decode_len(szSalt);
-
-    unsigned char *passwordBuf = (unsigned char *) malloc(sizeof(char) * passwordBufSize);
-    unsigned char *saltBuf = (unsigned char *) malloc(sizeof(char) * saltBufSize);
-
-    int passwordBufLen = Base64decode((char *)passwordBuf, szPassword);
-    int saltBufLen = Base64decode((char *)saltBuf, szSalt);
-
-    LOGD("passwordBuf len=%d :%d %d %d %d %d %d", passwordBufLen, passwordBuf[0], passwordBuf[1], passwordBuf[2], passwordBuf[3], passwordBuf[4], passwordBuf[5]);
-    LOGD("saltBuf len=%d :%d %d %d %d %d %d", saltBufLen, saltBuf[0], saltBuf[1], saltBuf[2], saltBuf[3], saltBuf[4], saltBuf[5]);
+    size_t passwordLen = strlen(szPassword);
+    size_t saltLen = strlen(szSalt);
+    SecureBytes passwordBuf(BASE64_DECODED_MAX_LENGTH(passwordLen));
+    SecureBytes saltBuf(BASE64_DECODED_MAX_LENGTH(saltLen));
+    size_t passwordBufLen = 0;
+    size_t saltBufLen = 0;
 
-    uint8_t *buffer = (uint8_t *) malloc(sizeof(char) * size);
-
-    fast_crypto_scrypt((uint8_t *) passwordBuf, passwordBufLen, (uint8_t *) saltBuf, saltBufLen, N, r, p, buffer, size);
-
-    LOGD("buffer:%d %d %d %d %d %d", buffer[0], buffer[1], buffer[2], buffer[3], buffer[4], buffer[5]);
-    int b64encSize = Base64encode_len(size);
-
-    char *szB64Encoded = (char *)malloc(sizeof(char) * b64encSize);
-    int b64encLen = Base64encode(szB64Encoded, (const char *) buffer, size);
-
-    LOGD("result szB64Encoded:%s len:%d", szB64Encoded, b64encLen);
+    jstring out;
+    if (!fast_crypto_base64_decode(szPassword, passwordLen, passwordBuf.data(), &passwordBufLen, NULL) ||
+        !fast_crypto_base64_decode(szSalt, saltLen, saltBuf.data(), &saltBufLen, NULL)) {
+        out = env->NewStringUTF("Invalid base64 error!");
+    } else {
+        SecureBytes buffer(size);
+        if (!fast_crypto_scrypt(passwordBuf.data(), passwordBufLen, saltBuf.data(), saltBufLen, N, r, p,
+                buffer.data(), size)) {
+            out = env->NewStringUTF("Invalid scrypt parameters error!");
+        } else {
+            SecureChars szB64Encoded(BASE64_ENCODED_LENGTH(buffer.size()) + 1);
+            fast_crypto_base64_encode(buffer.data(), buffer.size(), szB64Encoded.data());
+            out = env->NewStringUTF(szB64Encoded.data());
+        }
+    }
 
-    jstring out = env->NewStringUTF(szB64Encoded);
-    free(buffer);
-    free(szB64Encoded);
-    free(passwordBuf);
-    free(saltBuf);
     env->ReleaseStringUTFChars(jsPassword, szPassword);
     env->ReleaseStringUTFChars(jsSalt, szSalt);
 
@@ -315,9 +100,9 @@ Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1EcPrivkeyTweakAddJNI(JNIE
         }
     }
 
-    int privateKeyLen = strlen(szPrivateKeyHexTemp);
-    char szPrivateKeyHex[privateKeyLen + 1];
-    strcpy(szPrivateKeyHex, (const char *) szPrivateKeyHexTemp);
+    // The arena wipes this copy of the key on every return path:
+    SecureChars szPrivateKeyHex(strlen(szPrivateKeyHexTemp) + 1);
+    strcpy(szPrivateKeyHex.data(), (const char *) szPrivateKeyHexTemp);
 
     if (jsTweakHex) {
         szTweakHex = (char *) env->GetStringUTFChars(jsTweakHex, 0);
@@ -327,8 +112,8 @@ Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1EcPrivkeyTweakAddJNI(JNIE
         }
     }
 
-    fast_crypto_secp256k1_ec_privkey_tweak_add(szPrivateKeyHex, szTweakHex);
-    jstring out = env->NewStringUTF(szPrivateKeyHex);
+    fast_crypto_secp256k1_ec_privkey_tweak_add(szPrivateKeyHex.data(), szTweakHex);
+    jstring out = env->NewStringUTF(szPrivateKeyHex.data());
     env->ReleaseStringUTFChars(jsPrivateKeyHex, szPrivateKeyHexTemp);
     env->ReleaseStringUTFChars(jsTweakHex, szTweakHex);
     return out;
@@ -368,4 +153,1608 @@ Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1EcPubkeyTweakAddJNI(JNIEn
     return out;
 }
 
+/**
+ * Copies a Java byte array into a native buffer.
+ */
+static SecureBytes getBytes(JNIEnv *env, jbyteArray array) {
+    SecureBytes out(array ? env->GetArrayLength(array) : 0);
+    if (!out.empty()) {
+        env->GetByteArrayRegion(array, 0, out.size(), (jbyte *) out.data());
+    }
+    return out;
+}
+
+/**
+ * Copies a native buffer into a new Java byte array.
+ */
+static jbyteArray newByteArray(JNIEnv *env, const uint8_t *data, size_t size) {
+    jbyteArray out = env->NewByteArray(size);
+    if (out) {
+        env->SetByteArrayRegion(out, 0, size, (const jbyte *) data);
+    }
+    return out;
+}
+
+/**
+ * Returns the buffer contents, or NULL if the optional buffer is empty.
+ */
+static const uint8_t *optionalBytes(const SecureBytes &buffer) {
+    return buffer.empty() ? NULL : buffer.data();
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1EcPubkeyCreateBatchJNI(JNIEnv *env, jobject thiz,
+                                                                              jbyteArray jaPrivateKeys,
+                                                                              jint jiCount,
+                                                                              jint jiCompressed,
+                                                                              jint jiThreads) {
+    SecureBytes privateKeys = getBytes(env, jaPrivateKeys);
+    size_t count = jiCount;
+    if (count == 0 || privateKeys.size() != count * SECRET_KEY_LENGTH) {
+        memset(privateKeys.data(), 0, privateKeys.size());
+        return NULL;
+    }
+
+    // The result bytes come first, followed by the public keys:
+    size_t publicKeyLen = jiCompressed ? COMPRESSED_PUBKEY_LENGTH : DECOMPRESSED_PUBKEY_LENGTH;
+    SecureBytes out(count * (1 + publicKeyLen));
+    fast_crypto_secp256k1_pubkey_create_batch(privateKeys.data(), count, jiCompressed, jiThreads,
+                                              out.data() + count, out.data());
+    memset(privateKeys.data(), 0, privateKeys.size());
+    return newByteArray(env, out.data(), out.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1EcPrivkeyTweakAddBatchJNI(JNIEnv *env, jobject thiz,
+                                                                                 jbyteArray jaPrivateKeys,
+                                                                                 jbyteArray jaTweaks,
+                                                                                 jint jiCount,
+                                                                                 jint jiThreads) {
+    SecureBytes privateKeys = getBytes(env, jaPrivateKeys);
+    SecureBytes tweaks = getBytes(env, jaTweaks);
+    size_t count = jiCount;
+    if (count == 0 || privateKeys.size() != count * SECRET_KEY_LENGTH ||
+        tweaks.size() != count * SECRET_KEY_LENGTH) {
+        memset(privateKeys.data(), 0, privateKeys.size());
+        return NULL;
+    }
+
+    // The result bytes come first, followed by the private keys:
+    SecureBytes out(count * (1 + SECRET_KEY_LENGTH));
+    fast_crypto_secp256k1_privkey_tweak_add_batch(privateKeys.data(), tweaks.data(), count, jiThreads,
+                                                  out.data() + count, out.data());
+    memset(privateKeys.data(), 0, privateKeys.size());
+    jbyteArray result = newByteArray(env, out.data(), out.size());
+    memset(out.data(), 0, out.size());
+    return result;
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1EcdsaSignJNI(JNIEnv *env, jobject thiz,
+                                                                    jbyteArray jaPrivateKey,
+                                                                    jbyteArray jaMsgHash,
+                                                                    jint jiDer) {
+    SecureBytes privateKey = getBytes(env, jaPrivateKey);
+    SecureBytes msgHash = getBytes(env, jaMsgHash);
+    if (privateKey.size() != SECRET_KEY_LENGTH || msgHash.size() != MESSAGE_HASH_LENGTH) {
+        return NULL;
+    }
+
+    uint8_t sig[ECDSA_DER_SIGNATURE_MAX_LENGTH];
+    size_t sigLen = 0;
+    if (!fast_crypto_secp256k1_ecdsa_sign(privateKey.data(), msgHash.data(), sig, &sigLen, jiDer)) {
+        return NULL;
+    }
+    return newByteArray(env, sig, sigLen);
+}
+
+JNIEXPORT jboolean JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1EcdsaVerifyJNI(JNIEnv *env, jobject thiz,
+                                                                      jbyteArray jaSig,
+                                                                      jint jiDer,
+                                                                      jbyteArray jaMsgHash,
+                                                                      jbyteArray jaPublicKey,
+                                                                      jint jiStrict) {
+    SecureBytes sig = getBytes(env, jaSig);
+    SecureBytes msgHash = getBytes(env, jaMsgHash);
+    SecureBytes publicKey = getBytes(env, jaPublicKey);
+    if (msgHash.size() != MESSAGE_HASH_LENGTH) {
+        return JNI_FALSE;
+    }
+
+    return fast_crypto_secp256k1_ecdsa_verify(sig.data(), sig.size(), jiDer, msgHash.data(),
+                                              publicKey.data(), publicKey.size(), jiStrict)
+           ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1EcdsaVerifyBatchJNI(JNIEnv *env, jobject thiz,
+                                                                           jbyteArray jaSigs,
+                                                                           jbyteArray jaMsgHashes,
+                                                                           jbyteArray jaPublicKeys,
+                                                                           jint jiCount,
+                                                                           jint jiStrict,
+                                                                           jint jiThreads) {
+    SecureBytes sigs = getBytes(env, jaSigs);
+    SecureBytes msgHashes = getBytes(env, jaMsgHashes);
+    SecureBytes publicKeys = getBytes(env, jaPublicKeys);
+    size_t count = jiCount;
+    if (count == 0 ||
+        sigs.size() != count * ECDSA_COMPACT_SIGNATURE_LENGTH ||
+        msgHashes.size() != count * MESSAGE_HASH_LENGTH ||
+        publicKeys.size() % count != 0) {
+        return NULL;
+    }
+
+    SecureBytes results(count);
+    fast_crypto_secp256k1_ecdsa_verify_batch(sigs.data(), msgHashes.data(), publicKeys.data(),
+                                             publicKeys.size() / count, count, jiStrict,
+                                             jiThreads, results.data());
+    return newByteArray(env, results.data(), results.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1XonlyPubkeyCreateBatchJNI(JNIEnv *env, jobject thiz,
+                                                                                 jbyteArray jaPrivateKeys,
+                                                                                 jint jiCount,
+                                                                                 jint jiThreads) {
+    SecureBytes privateKeys = getBytes(env, jaPrivateKeys);
+    size_t count = jiCount;
+    if (count == 0 || privateKeys.size() != count * SECRET_KEY_LENGTH) {
+        return NULL;
+    }
+
+    SecureBytes publicKeys(count * XONLY_PUBKEY_LENGTH);
+    if (fast_crypto_secp256k1_xonly_pubkey_create_batch(privateKeys.data(), count, jiThreads,
+                                                        publicKeys.data()) != count) {
+        return NULL;
+    }
+    return newByteArray(env, publicKeys.data(), publicKeys.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1TaprootTweakPubkeyBatchJNI(JNIEnv *env, jobject thiz,
+                                                                                  jbyteArray jaInternalKeys,
+                                                                                  jbyteArray jaMerkleRoots,
+                                                                                  jint jiCount,
+                                                                                  jint jiThreads) {
+    SecureBytes internalKeys = getBytes(env, jaInternalKeys);
+    SecureBytes merkleRoots = getBytes(env, jaMerkleRoots);
+    size_t count = jiCount;
+    if (count == 0 || internalKeys.size() != count * XONLY_PUBKEY_LENGTH ||
+        (!merkleRoots.empty() && merkleRoots.size() != count * 32)) {
+        return NULL;
+    }
+
+    // The output keys come first, followed by one parity byte per key:
+    SecureBytes out(count * (XONLY_PUBKEY_LENGTH + 1));
+    if (fast_crypto_secp256k1_taproot_tweak_pubkey_batch(internalKeys.data(), optionalBytes(merkleRoots),
+                                                         count, jiThreads, out.data(),
+                                                         out.data() + count * XONLY_PUBKEY_LENGTH) != count) {
+        return NULL;
+    }
+    return newByteArray(env, out.data(), out.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1TaprootTweakPrivkeyBatchJNI(JNIEnv *env, jobject thiz,
+                                                                                   jbyteArray jaPrivateKeys,
+                                                                                   jbyteArray jaMerkleRoots,
+                                                                                   jint jiCount,
+                                                                                   jint jiThreads) {
+    SecureBytes privateKeys = getBytes(env, jaPrivateKeys);
+    SecureBytes merkleRoots = getBytes(env, jaMerkleRoots);
+    size_t count = jiCount;
+    if (count == 0 || privateKeys.size() != count * SECRET_KEY_LENGTH ||
+        (!merkleRoots.empty() && merkleRoots.size() != count * 32)) {
+        return NULL;
+    }
+
+    SecureBytes out(count * SECRET_KEY_LENGTH);
+    if (fast_crypto_secp256k1_taproot_tweak_privkey_batch(privateKeys.data(), optionalBytes(merkleRoots),
+                                                          count, jiThreads, out.data()) != count) {
+        return NULL;
+    }
+    return newByteArray(env, out.data(), out.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1SchnorrSignBatchJNI(JNIEnv *env, jobject thiz,
+                                                                           jbyteArray jaPrivateKeys,
+                                                                           jbyteArray jaMsgs,
+                                                                           jbyteArray jaAuxRands,
+                                                                           jint jiCount,
+                                                                           jint jiThreads) {
+    SecureBytes privateKeys = getBytes(env, jaPrivateKeys);
+    SecureBytes msgs = getBytes(env, jaMsgs);
+    SecureBytes auxRands = getBytes(env, jaAuxRands);
+    size_t count = jiCount;
+    if (count == 0 || privateKeys.size() != count * SECRET_KEY_LENGTH ||
+        msgs.size() != count * MESSAGE_HASH_LENGTH ||
+        (!auxRands.empty() && auxRands.size() != count * 32)) {
+        return NULL;
+    }
+
+    SecureBytes sigs(count * SCHNORR_SIGNATURE_LENGTH);
+    if (fast_crypto_secp256k1_schnorr_sign_batch(privateKeys.data(), msgs.data(), optionalBytes(auxRands),
+                                                 count, jiThreads, sigs.data()) != count) {
+        return NULL;
+    }
+    return newByteArray(env, sigs.data(), sigs.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1SchnorrVerifyBatchJNI(JNIEnv *env, jobject thiz,
+                                                                             jbyteArray jaSigs,
+                                                                             jbyteArray jaMsgs,
+                                                                             jbyteArray jaPublicKeys,
+                                                                             jint jiCount,
+                                                                             jint jiThreads) {
+    SecureBytes sigs = getBytes(env, jaSigs);
+    SecureBytes msgs = getBytes(env, jaMsgs);
+    SecureBytes publicKeys = getBytes(env, jaPublicKeys);
+    size_t count = jiCount;
+    if (count == 0 || sigs.size() != count * SCHNORR_SIGNATURE_LENGTH ||
+        msgs.size() != count * MESSAGE_HASH_LENGTH ||
+        publicKeys.size() != count * XONLY_PUBKEY_LENGTH) {
+        return NULL;
+    }
+
+    SecureBytes results(count);
+    fast_crypto_secp256k1_schnorr_verify_batch(sigs.data(), msgs.data(), publicKeys.data(),
+                                               count, jiThreads, results.data());
+    return newByteArray(env, results.data(), results.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1EcdsaSignRecoverableBatchJNI(JNIEnv *env, jobject thiz,
+                                                                                    jbyteArray jaPrivateKeys,
+                                                                                    jbyteArray jaMsgHashes,
+                                                                                    jint jiCount,
+                                                                                    jint jiThreads) {
+    SecureBytes privateKeys = getBytes(env, jaPrivateKeys);
+    SecureBytes msgHashes = getBytes(env, jaMsgHashes);
+    size_t count = jiCount;
+    if (count == 0 || privateKeys.size() != count * SECRET_KEY_LENGTH ||
+        msgHashes.size() != count * MESSAGE_HASH_LENGTH) {
+        return NULL;
+    }
+
+    SecureBytes sigs(count * RECOVERABLE_SIGNATURE_LENGTH);
+    if (fast_crypto_secp256k1_ecdsa_sign_recoverable_batch(privateKeys.data(), msgHashes.data(),
+                                                           count, jiThreads, sigs.data()) != count) {
+        return NULL;
+    }
+    return newByteArray(env, sigs.data(), sigs.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1EcdsaRecoverBatchJNI(JNIEnv *env, jobject thiz,
+                                                                            jbyteArray jaSigs,
+                                                                            jbyteArray jaMsgHashes,
+                                                                            jint jiCount,
+                                                                            jint jiFormat,
+                                                                            jint jiThreads) {
+    SecureBytes sigs = getBytes(env, jaSigs);
+    SecureBytes msgHashes = getBytes(env, jaMsgHashes);
+    size_t count = jiCount;
+    if (count == 0 || sigs.size() != count * RECOVERABLE_SIGNATURE_LENGTH ||
+        msgHashes.size() != count * MESSAGE_HASH_LENGTH) {
+        return NULL;
+    }
+
+    size_t stride;
+    switch (jiFormat) {
+        case RECOVER_COMPRESSED_PUBKEY: stride = COMPRESSED_PUBKEY_LENGTH; break;
+        case RECOVER_UNCOMPRESSED_PUBKEY: stride = DECOMPRESSED_PUBKEY_LENGTH; break;
+        case RECOVER_ETHEREUM_ADDRESS: stride = ETHEREUM_ADDRESS_LENGTH; break;
+        default: return NULL;
+    }
+
+    // The recovered items come first, followed by one status byte per item:
+    SecureBytes out(count * (stride + 1));
+    fast_crypto_secp256k1_ecdsa_recover_batch(sigs.data(), msgHashes.data(), count, jiFormat,
+                                              jiThreads, out.data(), out.data() + count * stride);
+    return newByteArray(env, out.data(), out.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1EcdhJNI(JNIEnv *env, jobject thiz,
+                                                               jbyteArray jaPrivateKey,
+                                                               jbyteArray jaPublicKey) {
+    SecureBytes privateKey = getBytes(env, jaPrivateKey);
+    SecureBytes publicKey = getBytes(env, jaPublicKey);
+    if (privateKey.size() != SECRET_KEY_LENGTH) {
+        return NULL;
+    }
+
+    uint8_t secret[32];
+    if (!fast_crypto_secp256k1_ecdh(privateKey.data(), publicKey.data(), publicKey.size(), secret)) {
+        return NULL;
+    }
+    return newByteArray(env, secret, sizeof(secret));
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_silentPaymentsScanJNI(JNIEnv *env, jobject thiz,
+                                                                    jbyteArray jaScanKey,
+                                                                    jbyteArray jaSpendPublicKey,
+                                                                    jbyteArray jaLabels,
+                                                                    jbyteArray jaTweaks,
+                                                                    jbyteArray jaInputHashes,
+                                                                    jbyteArray jaOutputKeys,
+                                                                    jbyteArray jaOutputCounts,
+                                                                    jint jiThreads) {
+    SecureBytes scanKey = getBytes(env, jaScanKey);
+    SecureBytes spendPublicKey = getBytes(env, jaSpendPublicKey);
+    SecureBytes labels = getBytes(env, jaLabels);
+    SecureBytes tweaks = getBytes(env, jaTweaks);
+    SecureBytes inputHashes = getBytes(env, jaInputHashes);
+    SecureBytes outputKeys = getBytes(env, jaOutputKeys);
+    SecureBytes outputCountBytes = getBytes(env, jaOutputCounts);
+
+    // The output counts arrive as little-endian 32-bit integers:
+    size_t txCount = tweaks.size() / COMPRESSED_PUBKEY_LENGTH;
+    std::vector<uint32_t> outputCounts(txCount);
+    if (outputCountBytes.size() != 4 * txCount) {
+        return NULL;
+    }
+    memcpy(outputCounts.data(), outputCountBytes.data(), outputCountBytes.size());
+
+    size_t outputTotal = 0;
+    for (size_t i = 0; i < txCount; ++i) outputTotal += outputCounts[i];
+    if (scanKey.size() != SECRET_KEY_LENGTH ||
+        spendPublicKey.size() != COMPRESSED_PUBKEY_LENGTH ||
+        labels.size() % COMPRESSED_PUBKEY_LENGTH != 0 ||
+        tweaks.size() != txCount * COMPRESSED_PUBKEY_LENGTH ||
+        (!inputHashes.empty() && inputHashes.size() != txCount * 32) ||
+        outputKeys.size() != outputTotal * XONLY_PUBKEY_LENGTH) {
+        return NULL;
+    }
+
+    // Each output can match at most once:
+    std::vector<fast_crypto_silent_payment_match> matches(outputTotal);
+    size_t matchCount = fast_crypto_silent_payments_scan(
+        scanKey.data(), spendPublicKey.data(),
+        optionalBytes(labels), labels.size() / COMPRESSED_PUBKEY_LENGTH,
+        tweaks.data(), optionalBytes(inputHashes), txCount,
+        outputKeys.data(), outputCounts.data(), jiThreads,
+        matches.data(), matches.size());
+
+    // Pack each match as little-endian tx index, output index,
+    // and label index, followed by the 32-byte tweak:
+    SecureBytes out(matchCount * 44);
+    for (size_t i = 0; i < matchCount; ++i) {
+        uint8_t *item = out.data() + i * 44;
+        memcpy(item + 0, &matches[i].txIndex, 4);
+        memcpy(item + 4, &matches[i].outputIndex, 4);
+        memcpy(item + 8, &matches[i].labelIndex, 4);
+        memcpy(item + 12, matches[i].tweak, 32);
+    }
+    return newByteArray(env, out.data(), out.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_musigPubkeyAggJNI(JNIEnv *env, jobject thiz,
+                                                                jbyteArray jaPublicKeys,
+                                                                jint jiSort) {
+    SecureBytes publicKeys = getBytes(env, jaPublicKeys);
+    if (publicKeys.empty() || publicKeys.size() % COMPRESSED_PUBKEY_LENGTH != 0) {
+        return NULL;
+    }
+
+    // The aggregate key comes first, followed by the cache:
+    uint8_t out[XONLY_PUBKEY_LENGTH + MUSIG_KEYAGG_CACHE_LENGTH];
+    if (!fast_crypto_musig_pubkey_agg(publicKeys.data(), publicKeys.size() / COMPRESSED_PUBKEY_LENGTH,
+                                      jiSort, out, out + XONLY_PUBKEY_LENGTH)) {
+        return NULL;
+    }
+    return newByteArray(env, out, sizeof(out));
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_musigPubkeyAggBatchJNI(JNIEnv *env, jobject thiz,
+                                                                     jbyteArray jaPublicKeySets,
+                                                                     jint jiKeysPerSet,
+                                                                     jint jiSetCount,
+                                                                     jint jiSort,
+                                                                     jint jiThreads) {
+    SecureBytes publicKeySets = getBytes(env, jaPublicKeySets);
+    size_t keysPerSet = jiKeysPerSet;
+    size_t setCount = jiSetCount;
+    if (keysPerSet == 0 || setCount == 0 ||
+        publicKeySets.size() != setCount * keysPerSet * COMPRESSED_PUBKEY_LENGTH) {
+        return NULL;
+    }
+
+    SecureBytes aggregateKeys(setCount * XONLY_PUBKEY_LENGTH);
+    if (fast_crypto_musig_pubkey_agg_batch(publicKeySets.data(), keysPerSet, setCount, jiSort,
+                                           jiThreads, aggregateKeys.data()) != setCount) {
+        return NULL;
+    }
+    return newByteArray(env, aggregateKeys.data(), aggregateKeys.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_musigPubkeyTweakAddJNI(JNIEnv *env, jobject thiz,
+                                                                     jbyteArray jaKeyaggCache,
+                                                                     jbyteArray jaTweak,
+                                                                     jint jiXonly) {
+    SecureBytes tweak = getBytes(env, jaTweak);
+    uint8_t out[COMPRESSED_PUBKEY_LENGTH + MUSIG_KEYAGG_CACHE_LENGTH];
+    if (tweak.size() != 32 || !jaKeyaggCache ||
+        env->GetArrayLength(jaKeyaggCache) != MUSIG_KEYAGG_CACHE_LENGTH) {
+        return NULL;
+    }
+
+    // The tweaked key comes first, followed by the updated cache:
+    env->GetByteArrayRegion(jaKeyaggCache, 0, MUSIG_KEYAGG_CACHE_LENGTH,
+                            (jbyte *) (out + COMPRESSED_PUBKEY_LENGTH));
+    if (!fast_crypto_musig_pubkey_tweak_add(out + COMPRESSED_PUBKEY_LENGTH, tweak.data(), jiXonly, out)) {
+        return NULL;
+    }
+    return newByteArray(env, out, sizeof(out));
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_musigNonceGenJNI(JNIEnv *env, jobject thiz,
+                                                               jbyteArray jaSessionRand,
+                                                               jbyteArray jaPrivateKey,
+                                                               jbyteArray jaPublicKey,
+                                                               jbyteArray jaMsg,
+                                                               jbyteArray jaKeyaggCache) {
+    SecureBytes sessionRand = getBytes(env, jaSessionRand);
+    SecureBytes privateKey = getBytes(env, jaPrivateKey);
+    SecureBytes publicKey = getBytes(env, jaPublicKey);
+    SecureBytes msg = getBytes(env, jaMsg);
+    SecureBytes keyaggCache = getBytes(env, jaKeyaggCache);
+    if (sessionRand.size() != 32 ||
+        (!privateKey.empty() && privateKey.size() != SECRET_KEY_LENGTH) ||
+        publicKey.size() != COMPRESSED_PUBKEY_LENGTH ||
+        (!msg.empty() && msg.size() != MESSAGE_HASH_LENGTH) ||
+        (!keyaggCache.empty() && keyaggCache.size() != MUSIG_KEYAGG_CACHE_LENGTH)) {
+        return NULL;
+    }
+
+    // The secret nonce stays native, so this returns its little-endian
+    // 32-bit handle, followed by the public nonce:
+    uint8_t out[4 + MUSIG_PUBNONCE_LENGTH];
+    uint32_t handle = fast_crypto_musig_nonce_gen(sessionRand.data(), optionalBytes(privateKey),
+                                                  publicKey.data(), optionalBytes(msg),
+                                                  optionalBytes(keyaggCache), out + 4);
+    if (handle == 0) {
+        return NULL;
+    }
+    out[0] = handle;
+    out[1] = handle >> 8;
+    out[2] = handle >> 16;
+    out[3] = handle >> 24;
+    return newByteArray(env, out, sizeof(out));
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_musigNonceAggJNI(JNIEnv *env, jobject thiz,
+                                                               jbyteArray jaPubnonces) {
+    SecureBytes pubnonces = getBytes(env, jaPubnonces);
+    if (pubnonces.empty() || pubnonces.size() % MUSIG_PUBNONCE_LENGTH != 0) {
+        return NULL;
+    }
+
+    uint8_t aggnonce[MUSIG_PUBNONCE_LENGTH];
+    if (!fast_crypto_musig_nonce_agg(pubnonces.data(), pubnonces.size() / MUSIG_PUBNONCE_LENGTH, aggnonce)) {
+        return NULL;
+    }
+    return newByteArray(env, aggnonce, sizeof(aggnonce));
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_musigPartialSignJNI(JNIEnv *env, jobject thiz,
+                                                                  jint jiNonceHandle,
+                                                                  jbyteArray jaPrivateKey,
+                                                                  jbyteArray jaKeyaggCache,
+                                                                  jbyteArray jaAggnonce,
+                                                                  jbyteArray jaMsg) {
+    SecureBytes privateKey = getBytes(env, jaPrivateKey);
+    SecureBytes keyaggCache = getBytes(env, jaKeyaggCache);
+    SecureBytes aggnonce = getBytes(env, jaAggnonce);
+    SecureBytes msg = getBytes(env, jaMsg);
+    if (privateKey.size() != SECRET_KEY_LENGTH ||
+        keyaggCache.size() != MUSIG_KEYAGG_CACHE_LENGTH || aggnonce.size() != MUSIG_PUBNONCE_LENGTH ||
+        msg.size() != MESSAGE_HASH_LENGTH) {
+        // Never leave a nonce behind that a retry could sign with:
+        fast_crypto_musig_nonce_release(jiNonceHandle);
+        return NULL;
+    }
+
+    uint8_t partialSig[MUSIG_PARTIAL_SIG_LENGTH];
+    int success = fast_crypto_musig_partial_sign(jiNonceHandle, privateKey.data(), keyaggCache.data(),
+                                                 aggnonce.data(), msg.data(), partialSig);
+    memset(privateKey.data(), 0, privateKey.size());
+    return success ? newByteArray(env, partialSig, sizeof(partialSig)) : NULL;
+}
+
+JNIEXPORT void JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_musigNonceReleaseJNI(JNIEnv *env, jobject thiz,
+                                                                   jint jiNonceHandle) {
+    fast_crypto_musig_nonce_release(jiNonceHandle);
+}
+
+JNIEXPORT jboolean JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_musigPartialVerifyJNI(JNIEnv *env, jobject thiz,
+                                                                    jbyteArray jaPartialSig,
+                                                                    jbyteArray jaPubnonce,
+                                                                    jbyteArray jaPublicKey,
+                                                                    jbyteArray jaKeyaggCache,
+                                                                    jbyteArray jaAggnonce,
+                                                                    jbyteArray jaMsg) {
+    SecureBytes partialSig = getBytes(env, jaPartialSig);
+    SecureBytes pubnonce = getBytes(env, jaPubnonce);
+    SecureBytes publicKey = getBytes(env, jaPublicKey);
+    SecureBytes keyaggCache = getBytes(env, jaKeyaggCache);
+    SecureBytes aggnonce = getBytes(env, jaAggnonce);
+    SecureBytes msg = getBytes(env, jaMsg);
+    if (partialSig.size() != MUSIG_PARTIAL_SIG_LENGTH || pubnonce.size() != MUSIG_PUBNONCE_LENGTH ||
+        publicKey.size() != COMPRESSED_PUBKEY_LENGTH || keyaggCache.size() != MUSIG_KEYAGG_CACHE_LENGTH ||
+        aggnonce.size() != MUSIG_PUBNONCE_LENGTH || msg.size() != MESSAGE_HASH_LENGTH) {
+        return JNI_FALSE;
+    }
+
+    return fast_crypto_musig_partial_verify(partialSig.data(), pubnonce.data(), publicKey.data(),
+                                            keyaggCache.data(), aggnonce.data(), msg.data())
+           ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_musigPartialSigAggJNI(JNIEnv *env, jobject thiz,
+                                                                    jbyteArray jaPartialSigs,
+                                                                    jbyteArray jaKeyaggCache,
+                                                                    jbyteArray jaAggnonce,
+                                                                    jbyteArray jaMsg) {
+    SecureBytes partialSigs = getBytes(env, jaPartialSigs);
+    SecureBytes keyaggCache = getBytes(env, jaKeyaggCache);
+    SecureBytes aggnonce = getBytes(env, jaAggnonce);
+    SecureBytes msg = getBytes(env, jaMsg);
+    if (partialSigs.empty() || partialSigs.size() % MUSIG_PARTIAL_SIG_LENGTH != 0 ||
+        keyaggCache.size() != MUSIG_KEYAGG_CACHE_LENGTH || aggnonce.size() != MUSIG_PUBNONCE_LENGTH ||
+        msg.size() != MESSAGE_HASH_LENGTH) {
+        return NULL;
+    }
+
+    uint8_t sig[SCHNORR_SIGNATURE_LENGTH];
+    if (!fast_crypto_musig_partial_sig_agg(partialSigs.data(), partialSigs.size() / MUSIG_PARTIAL_SIG_LENGTH,
+                                           keyaggCache.data(), aggnonce.data(), msg.data(), sig)) {
+        return NULL;
+    }
+    return newByteArray(env, sig, sizeof(sig));
+}
+
+JNIEXPORT jint JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1PubkeyHandleCreateJNI(JNIEnv *env, jobject thiz,
+                                                                             jbyteArray jaPublicKey) {
+    SecureBytes publicKey = getBytes(env, jaPublicKey);
+    return fast_crypto_secp256k1_pubkey_handle_create(publicKey.data(), publicKey.size());
+}
+
+JNIEXPORT jint JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1PrivkeyHandleCreateJNI(JNIEnv *env, jobject thiz,
+                                                                              jbyteArray jaPrivateKey) {
+    SecureBytes privateKey = getBytes(env, jaPrivateKey);
+    if (privateKey.size() != SECRET_KEY_LENGTH) {
+        return 0;
+    }
+
+    uint32_t handle = fast_crypto_secp256k1_privkey_handle_create(privateKey.data());
+    memset(privateKey.data(), 0, privateKey.size());
+    return handle;
+}
+
+JNIEXPORT jint JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1HandlePubkeyJNI(JNIEnv *env, jobject thiz,
+                                                                       jint jiHandle) {
+    return fast_crypto_secp256k1_handle_pubkey(jiHandle);
+}
+
+JNIEXPORT jint JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1HandleTweakAddJNI(JNIEnv *env, jobject thiz,
+                                                                         jint jiHandle,
+                                                                         jbyteArray jaTweak) {
+    SecureBytes tweak = getBytes(env, jaTweak);
+    if (tweak.size() != 32) {
+        return 0;
+    }
+    return fast_crypto_secp256k1_handle_tweak_add(jiHandle, tweak.data());
+}
+
+JNIEXPORT jint JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1HandleCombineJNI(JNIEnv *env, jobject thiz,
+                                                                        jintArray jaHandles) {
+    if (!jaHandles) {
+        return 0;
+    }
+    std::vector<uint32_t> handles(env->GetArrayLength(jaHandles));
+    env->GetIntArrayRegion(jaHandles, 0, handles.size(), (jint *) handles.data());
+    return fast_crypto_secp256k1_handle_combine(handles.data(), handles.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1HandleSerializeJNI(JNIEnv *env, jobject thiz,
+                                                                          jint jiHandle,
+                                                                          jint jiCompressed) {
+    uint8_t out[DECOMPRESSED_PUBKEY_LENGTH];
+    size_t outLen = fast_crypto_secp256k1_handle_serialize(jiHandle, jiCompressed, out);
+    jbyteArray result = outLen ? newByteArray(env, out, outLen) : NULL;
+    memset(out, 0, sizeof(out));
+    return result;
+}
+
+JNIEXPORT void JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1HandleReleaseJNI(JNIEnv *env, jobject thiz,
+                                                                        jint jiHandle) {
+    fast_crypto_secp256k1_handle_release(jiHandle);
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_multisigDeriveBatchJNI(JNIEnv *env, jobject thiz,
+                                                                     jbyteArray jaXpubs,
+                                                                     jint jiM,
+                                                                     jint jiStartIndex,
+                                                                     jint jiCount,
+                                                                     jint jiScriptType,
+                                                                     jint jiThreads) {
+    SecureBytes xpubs = getBytes(env, jaXpubs);
+    if (xpubs.empty() || xpubs.size() % XPUB_LENGTH != 0 || jiM <= 0 || jiStartIndex < 0 || jiCount <= 0) {
+        return NULL;
+    }
+
+    size_t count = jiCount;
+    size_t hashLen = jiScriptType == MULTISIG_P2WSH ? 32 : 20;
+    SecureBytes hashes(count * hashLen);
+    if (fast_crypto_multisig_derive_batch(xpubs.data(), xpubs.size() / XPUB_LENGTH, jiM, jiStartIndex,
+                                          count, jiScriptType, jiThreads, hashes.data()) != count) {
+        return NULL;
+    }
+    return newByteArray(env, hashes.data(), hashes.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_aes256CbcEncryptJNI(JNIEnv *env, jobject thiz,
+                                                                  jbyteArray jaKey,
+                                                                  jbyteArray jaIv,
+                                                                  jbyteArray jaData,
+                                                                  jint jiPad) {
+    SecureBytes key = getBytes(env, jaKey);
+    SecureBytes iv = getBytes(env, jaIv);
+    SecureBytes data = getBytes(env, jaData);
+    if (key.size() != AES256_KEY_LENGTH || iv.size() != AES_BLOCK_LENGTH) {
+        return NULL;
+    }
+
+    SecureBytes out(data.size() + AES_BLOCK_LENGTH);
+    size_t outLen;
+    jbyteArray result = NULL;
+    if (fast_crypto_aes256_cbc_encrypt(key.data(), iv.data(), data.data(), data.size(), jiPad,
+                                       out.data(), &outLen)) {
+        result = newByteArray(env, out.data(), outLen);
+    }
+    memset(key.data(), 0, key.size());
+    memset(data.data(), 0, data.size());
+    return result;
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_aes256CbcDecryptJNI(JNIEnv *env, jobject thiz,
+                                                                  jbyteArray jaKey,
+                                                                  jbyteArray jaIv,
+                                                                  jbyteArray jaData,
+                                                                  jint jiPad) {
+    SecureBytes key = getBytes(env, jaKey);
+    SecureBytes iv = getBytes(env, jaIv);
+    SecureBytes data = getBytes(env, jaData);
+    if (key.size() != AES256_KEY_LENGTH || iv.size() != AES_BLOCK_LENGTH) {
+        return NULL;
+    }
+
+    SecureBytes out(data.size());
+    size_t outLen;
+    jbyteArray result = NULL;
+    if (fast_crypto_aes256_cbc_decrypt(key.data(), iv.data(), data.data(), data.size(), jiPad,
+                                       out.data(), &outLen)) {
+        result = newByteArray(env, out.data(), outLen);
+    }
+    memset(key.data(), 0, key.size());
+    memset(out.data(), 0, out.size());
+    return result;
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_aes256GcmEncryptJNI(JNIEnv *env, jobject thiz,
+                                                                  jbyteArray jaKey,
+                                                                  jbyteArray jaIv,
+                                                                  jbyteArray jaAad,
+                                                                  jbyteArray jaData) {
+    SecureBytes key = getBytes(env, jaKey);
+    SecureBytes iv = getBytes(env, jaIv);
+    SecureBytes aad = getBytes(env, jaAad);
+    SecureBytes data = getBytes(env, jaData);
+    if (key.size() != AES256_KEY_LENGTH || iv.size() != AES_GCM_IV_LENGTH) {
+        return NULL;
+    }
+
+    // The tag goes after the ciphertext:
+    SecureBytes out(data.size() + AES_GCM_TAG_LENGTH);
+    fast_crypto_aes256_gcm_encrypt(key.data(), iv.data(), aad.data(), aad.size(),
+                                   data.data(), data.size(), out.data(), out.data() + data.size());
+    memset(key.data(), 0, key.size());
+    memset(data.data(), 0, data.size());
+    return newByteArray(env, out.data(), out.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_aes256GcmDecryptJNI(JNIEnv *env, jobject thiz,
+                                                                  jbyteArray jaKey,
+                                                                  jbyteArray jaIv,
+                                                                  jbyteArray jaAad,
+                                                                  jbyteArray jaData) {
+    SecureBytes key = getBytes(env, jaKey);
+    SecureBytes iv = getBytes(env, jaIv);
+    SecureBytes aad = getBytes(env, jaAad);
+    SecureBytes data = getBytes(env, jaData);
+    if (key.size() != AES256_KEY_LENGTH || iv.size() != AES_GCM_IV_LENGTH ||
+        data.size() < AES_GCM_TAG_LENGTH) {
+        return NULL;
+    }
+
+    size_t length = data.size() - AES_GCM_TAG_LENGTH;
+    SecureBytes out(length);
+    jbyteArray result = NULL;
+    if (fast_crypto_aes256_gcm_decrypt(key.data(), iv.data(), aad.data(), aad.size(),
+                                       data.data(), length, data.data() + length, out.data())) {
+        result = newByteArray(env, out.data(), out.size());
+    }
+    memset(key.data(), 0, key.size());
+    memset(out.data(), 0, out.size());
+    return result;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_aesSetImplementationJNI(JNIEnv *env, jobject thiz,
+                                                                      jint jiImplementation) {
+    return fast_crypto_aes_set_implementation(jiImplementation) ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jint JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_aesGetImplementationJNI(JNIEnv *env, jobject thiz) {
+    return fast_crypto_aes_get_implementation();
+}
+
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_chacha20Poly1305EncryptJNI(JNIEnv *env, jobject thiz,
+                                                                         jbyteArray jaKey,
+                                                                         jbyteArray jaNonce,
+                                                                         jbyteArray jaAad,
+                                                                         jbyteArray jaData) {
+    SecureBytes key = getBytes(env, jaKey);
+    SecureBytes nonce = getBytes(env, jaNonce);
+    SecureBytes aad = getBytes(env, jaAad);
+    SecureBytes data = getBytes(env, jaData);
+    if (key.size() != CHACHA20_POLY1305_KEY_LENGTH) {
+        return NULL;
+    }
+
+    // The tag goes after the ciphertext:
+    SecureBytes out(data.size() + CHACHA20_POLY1305_TAG_LENGTH);
+    jbyteArray result = NULL;
+    if (fast_crypto_chacha20_poly1305_encrypt(key.data(), nonce.data(), nonce.size(), aad.data(),
+                                              aad.size(), data.data(), data.size(), out.data(),
+                                              out.data() + data.size())) {
+        result = newByteArray(env, out.data(), out.size());
+    }
+    memset(key.data(), 0, key.size());
+    memset(data.data(), 0, data.size());
+    return result;
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_chacha20Poly1305DecryptJNI(JNIEnv *env, jobject thiz,
+                                                                         jbyteArray jaKey,
+                                                                         jbyteArray jaNonce,
+                                                                         jbyteArray jaAad,
+                                                                         jbyteArray jaData) {
+    SecureBytes key = getBytes(env, jaKey);
+    SecureBytes nonce = getBytes(env, jaNonce);
+    SecureBytes aad = getBytes(env, jaAad);
+    SecureBytes data = getBytes(env, jaData);
+    if (key.size() != CHACHA20_POLY1305_KEY_LENGTH || data.size() < CHACHA20_POLY1305_TAG_LENGTH) {
+        return NULL;
+    }
+
+    size_t length = data.size() - CHACHA20_POLY1305_TAG_LENGTH;
+    SecureBytes out(length);
+    jbyteArray result = NULL;
+    if (fast_crypto_chacha20_poly1305_decrypt(key.data(), nonce.data(), nonce.size(), aad.data(),
+                                              aad.size(), data.data(), length, data.data() + length,
+                                              out.data())) {
+        result = newByteArray(env, out.data(), out.size());
+    }
+    memset(key.data(), 0, key.size());
+    memset(out.data(), 0, out.size());
+    return result;
+}
+
+JNIEXPORT jint JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_chacha20Poly1305StreamCreateJNI(JNIEnv *env, jobject thiz,
+                                                                              jbyteArray jaKey,
+                                                                              jbyteArray jaNonce,
+                                                                              jbyteArray jaAad,
+                                                                              jint jiDecrypt) {
+    SecureBytes key = getBytes(env, jaKey);
+    SecureBytes nonce = getBytes(env, jaNonce);
+    SecureBytes aad = getBytes(env, jaAad);
+    if (key.size() != CHACHA20_POLY1305_KEY_LENGTH) {
+        return 0;
+    }
+
+    uint32_t stream = fast_crypto_chacha20_poly1305_stream_create(key.data(), nonce.data(),
+                                                                  nonce.size(), aad.data(),
+                                                                  aad.size(), jiDecrypt);
+    memset(key.data(), 0, key.size());
+    return stream;
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_chacha20Poly1305StreamUpdateJNI(JNIEnv *env, jobject thiz,
+                                                                              jint jiStream,
+                                                                              jbyteArray jaData) {
+    SecureBytes data = getBytes(env, jaData);
+
+    SecureBytes out(data.size());
+    jbyteArray result = NULL;
+    if (fast_crypto_chacha20_poly1305_stream_update(jiStream, data.data(), data.size(), out.data())) {
+        result = newByteArray(env, out.data(), out.size());
+    }
+    memset(data.data(), 0, data.size());
+    memset(out.data(), 0, out.size());
+    return result;
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_chacha20Poly1305StreamFinalJNI(JNIEnv *env, jobject thiz,
+                                                                             jint jiStream,
+                                                                             jbyteArray jaTag) {
+    // Decrypting streams check this tag, and encrypting streams replace it:
+    SecureBytes tag = getBytes(env, jaTag);
+    tag.resize(CHACHA20_POLY1305_TAG_LENGTH);
+    if (!fast_crypto_chacha20_poly1305_stream_final(jiStream, tag.data())) {
+        return NULL;
+    }
+    return newByteArray(env, tag.data(), tag.size());
+}
+
+JNIEXPORT void JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_chacha20Poly1305StreamReleaseJNI(JNIEnv *env, jobject thiz,
+                                                                               jint jiStream) {
+    fast_crypto_chacha20_poly1305_stream_release(jiStream);
+}
+
+JNIEXPORT jboolean JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_chacha20SetImplementationJNI(JNIEnv *env, jobject thiz,
+                                                                           jint jiImplementation) {
+    return fast_crypto_chacha20_set_implementation(jiImplementation) ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jint JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_chacha20GetImplementationJNI(JNIEnv *env, jobject thiz) {
+    return fast_crypto_chacha20_get_implementation();
+}
+
+/**
+ * Unpacks the little-endian 32-bit lengths of some back-to-back items,
+ * checking that they cover the packed data exactly.
+ */
+static bool getPackedLens(const SecureBytes &items, const SecureBytes &lenBytes,
+                          std::vector<uint32_t> &itemLens) {
+    if (lenBytes.size() % 4 != 0) return false;
+    itemLens.resize(lenBytes.size() / 4);
+    if (!itemLens.empty()) memcpy(itemLens.data(), lenBytes.data(), lenBytes.size());
+
+    size_t total = 0;
+    for (size_t i = 0; i < itemLens.size(); ++i) total += itemLens[i];
+    return total == items.size();
+}
+
+/**
+ * Packs each record's status byte, little-endian 32-bit plaintext length,
+ * and plaintext back-to-back, then wipes the native copies.
+ */
+static jbyteArray packRecords(JNIEnv *env, const std::vector<uint32_t> &recordLens,
+                              SecureBytes &plaintexts,
+                              std::vector<uint32_t> &plaintextLens,
+                              const SecureBytes &statuses) {
+    size_t size = 0;
+    for (size_t i = 0; i < recordLens.size(); ++i) size += 5 + plaintextLens[i];
+
+    SecureBytes out(size);
+    uint8_t *item = out.data();
+    const uint8_t *plaintext = plaintexts.data();
+    for (size_t i = 0; i < recordLens.size(); ++i) {
+        item[0] = statuses[i];
+        memcpy(item + 1, &plaintextLens[i], 4);
+        if (plaintextLens[i] != 0) memcpy(item + 5, plaintext, plaintextLens[i]);
+        item += 5 + plaintextLens[i];
+        plaintext += recordLens[i];
+    }
+
+    jbyteArray result = newByteArray(env, out.data(), out.size());
+    memset(plaintexts.data(), 0, plaintexts.size());
+    memset(out.data(), 0, out.size());
+    return result;
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_recordsDecryptBatchJNI(JNIEnv *env, jobject thiz,
+                                                                     jbyteArray jaKey,
+                                                                     jbyteArray jaRecords,
+                                                                     jbyteArray jaRecordLens,
+                                                                     jint jiThreads) {
+    SecureBytes key = getBytes(env, jaKey);
+    SecureBytes records = getBytes(env, jaRecords);
+    std::vector<uint32_t> recordLens;
+    if (key.size() != RECORD_KEY_LENGTH || !getPackedLens(records, getBytes(env, jaRecordLens), recordLens)) {
+        memset(key.data(), 0, key.size());
+        return NULL;
+    }
+
+    SecureBytes plaintexts(records.size());
+    std::vector<uint32_t> plaintextLens(recordLens.size());
+    SecureBytes statuses(recordLens.size());
+    fast_crypto_records_decrypt_batch(key.data(), records.data(), recordLens.data(), recordLens.size(),
+                                      jiThreads, plaintexts.data(), plaintextLens.data(), statuses.data());
+    memset(key.data(), 0, key.size());
+    return packRecords(env, recordLens, plaintexts, plaintextLens, statuses);
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_recordsDecryptBatchScryptJNI(JNIEnv *env, jobject thiz,
+                                                                           jbyteArray jaPassword,
+                                                                           jbyteArray jaSalt,
+                                                                           jint N, jint r, jint p,
+                                                                           jbyteArray jaRecords,
+                                                                           jbyteArray jaRecordLens,
+                                                                           jint jiThreads) {
+    SecureBytes password = getBytes(env, jaPassword);
+    SecureBytes salt = getBytes(env, jaSalt);
+    SecureBytes records = getBytes(env, jaRecords);
+    std::vector<uint32_t> recordLens;
+    if (!getPackedLens(records, getBytes(env, jaRecordLens), recordLens)) {
+        memset(password.data(), 0, password.size());
+        return NULL;
+    }
+
+    SecureBytes plaintexts(records.size());
+    std::vector<uint32_t> plaintextLens(recordLens.size());
+    SecureBytes statuses(recordLens.size());
+    fast_crypto_records_decrypt_batch_scrypt(password.data(), password.size(), salt.data(), salt.size(),
+                                             N, r, p, records.data(), recordLens.data(), recordLens.size(),
+                                             jiThreads, plaintexts.data(), plaintextLens.data(),
+                                             statuses.data());
+    memset(password.data(), 0, password.size());
+    return packRecords(env, recordLens, plaintexts, plaintextLens, statuses);
+}
+
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_ed25519PubkeyCreateBatchJNI(JNIEnv *env, jobject thiz,
+                                                                          jbyteArray jaPrivateKeys,
+                                                                          jint jiCount,
+                                                                          jint jiThreads) {
+    SecureBytes privateKeys = getBytes(env, jaPrivateKeys);
+    size_t count = jiCount;
+    if (count == 0 || privateKeys.size() != count * ED25519_PRIVKEY_LENGTH) {
+        memset(privateKeys.data(), 0, privateKeys.size());
+        return NULL;
+    }
+
+    SecureBytes publicKeys(count * ED25519_PUBKEY_LENGTH);
+    fast_crypto_ed25519_pubkey_create_batch(privateKeys.data(), count, jiThreads, publicKeys.data());
+    memset(privateKeys.data(), 0, privateKeys.size());
+    return newByteArray(env, publicKeys.data(), publicKeys.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_ed25519SignJNI(JNIEnv *env, jobject thiz,
+                                                             jbyteArray jaPrivateKey,
+                                                             jbyteArray jaMsg) {
+    SecureBytes privateKey = getBytes(env, jaPrivateKey);
+    SecureBytes msg = getBytes(env, jaMsg);
+    if (privateKey.size() != ED25519_PRIVKEY_LENGTH) {
+        memset(privateKey.data(), 0, privateKey.size());
+        return NULL;
+    }
+
+    uint8_t sig[ED25519_SIGNATURE_LENGTH];
+    fast_crypto_ed25519_sign(privateKey.data(), msg.data(), msg.size(), sig);
+    memset(privateKey.data(), 0, privateKey.size());
+    return newByteArray(env, sig, sizeof(sig));
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_ed25519VerifyBatchJNI(JNIEnv *env, jobject thiz,
+                                                                    jbyteArray jaSigs,
+                                                                    jbyteArray jaMsgs,
+                                                                    jbyteArray jaMsgLens,
+                                                                    jbyteArray jaPublicKeys,
+                                                                    jint jiThreads) {
+    SecureBytes sigs = getBytes(env, jaSigs);
+    SecureBytes msgs = getBytes(env, jaMsgs);
+    SecureBytes publicKeys = getBytes(env, jaPublicKeys);
+    std::vector<uint32_t> msgLens;
+    if (!getPackedLens(msgs, getBytes(env, jaMsgLens), msgLens)) return NULL;
+    size_t count = msgLens.size();
+    if (count == 0 || sigs.size() != count * ED25519_SIGNATURE_LENGTH ||
+        publicKeys.size() != count * ED25519_PUBKEY_LENGTH) {
+        return NULL;
+    }
+
+    SecureBytes results(count);
+    fast_crypto_ed25519_verify_batch(sigs.data(), msgs.data(), msgLens.data(), publicKeys.data(),
+                                     count, jiThreads, results.data());
+    return newByteArray(env, results.data(), results.size());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_slip10Ed25519DeriveBatchJNI(JNIEnv *env, jobject thiz,
+                                                                          jbyteArray jaSeed,
+                                                                          jbyteArray jaPaths,
+                                                                          jbyteArray jaPathLens,
+                                                                          jint jiThreads) {
+    SecureBytes seed = getBytes(env, jaSeed);
+    SecureBytes pathBytes = getBytes(env, jaPaths);
+    SecureBytes pathLenBytes = getBytes(env, jaPathLens);
+    if (pathBytes.size() % 4 != 0 || pathLenBytes.size() % 4 != 0 || pathLenBytes.empty()) {
+        memset(seed.data(), 0, seed.size());
+        return NULL;
+    }
+
+    // Both the indices and the path lengths are little-endian 32-bit words:
+    std::vector<uint32_t> paths(pathBytes.size() / 4);
+    std::vector<uint32_t> pathLens(pathLenBytes.size() / 4);
+    if (!paths.empty()) memcpy(paths.data(), pathBytes.data(), pathBytes.size());
+    memcpy(pathLens.data(), pathLenBytes.data(), pathLenBytes.size());
+    size_t total = 0;
+    for (size_t i = 0; i < pathLens.size(); ++i) total += pathLens[i];
+    size_t count = pathLens.size();
+    if (total != paths.size()) {
+        memset(seed.data(), 0, seed.size());
+        return NULL;
+    }
+
+    // The private keys come first, followed by the public keys:
+    SecureBytes keys(count * (ED25519_PRIVKEY_LENGTH + ED25519_PUBKEY_LENGTH));
+    size_t derived = fast_crypto_slip10_ed25519_derive_batch(seed.data(), seed.size(), paths.data(),
+                                                            pathLens.data(), count, jiThreads, keys.data(),
+                                                            keys.data() + count * ED25519_PRIVKEY_LENGTH);
+    memset(seed.data(), 0, seed.size());
+    jbyteArray result = derived == count ? newByteArray(env, keys.data(), keys.size()) : NULL;
+    memset(keys.data(), 0, keys.size());
+    return result;
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_argon2idJNI(JNIEnv *env, jobject thiz,
+                                                          jbyteArray jaPassword, jbyteArray jaSalt,
+                                                          jint t, jint m, jint p, jint jiThreads,
+                                                          jint size) {
+    SecureBytes password = getBytes(env, jaPassword);
+    SecureBytes salt = getBytes(env, jaSalt);
+    if (size <= 0) {
+        memset(password.data(), 0, password.size());
+        return NULL;
+    }
+
+    SecureBytes out(size);
+    int success = fast_crypto_argon2id(password.data(), password.size(), salt.data(), salt.size(),
+                                       t, m, p, jiThreads, out.data(), out.size());
+    memset(password.data(), 0, password.size());
+    jbyteArray result = success ? newByteArray(env, out.data(), out.size()) : NULL;
+    memset(out.data(), 0, out.size());
+    return result;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_argon2SetImplementationJNI(JNIEnv *env, jobject thiz,
+                                                                         jint jiImplementation) {
+    return fast_crypto_argon2_set_implementation(jiImplementation) ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jint JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_argon2GetImplementationJNI(JNIEnv *env, jobject thiz) {
+    return fast_crypto_argon2_get_implementation();
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_bip39MnemonicToSeedBatchJNI(JNIEnv *env, jobject thiz,
+                                                                          jbyteArray jaMnemonic,
+                                                                          jbyteArray jaPassphrases,
+                                                                          jbyteArray jaPassphraseLens,
+                                                                          jbyteArray jaWordlist,
+                                                                          jint jiThreads) {
+    SecureBytes mnemonic = getBytes(env, jaMnemonic);
+    SecureBytes passphrases = getBytes(env, jaPassphrases);
+    SecureBytes wordlist = getBytes(env, jaWordlist);
+    std::vector<uint32_t> passphraseLens;
+    if (!getPackedLens(passphrases, getBytes(env, jaPassphraseLens), passphraseLens)) {
+        memset(mnemonic.data(), 0, mnemonic.size());
+        memset(passphrases.data(), 0, passphrases.size());
+        return NULL;
+    }
+
+    // The statuses come first, followed by the seeds and the master keys:
+    size_t count = passphraseLens.size();
+    SecureBytes out(count * (1 + BIP39_SEED_LENGTH + XPRV_LENGTH));
+    fast_crypto_bip39_mnemonic_to_seed_batch(mnemonic.data(), mnemonic.size(), passphrases.data(),
+                                             passphraseLens.data(), count,
+                                             wordlist.empty() ? NULL : wordlist.data(), wordlist.size(),
+                                             jiThreads, out.data() + count,
+                                             out.data() + count * (1 + BIP39_SEED_LENGTH), out.data());
+    memset(mnemonic.data(), 0, mnemonic.size());
+    memset(passphrases.data(), 0, passphrases.size());
+    jbyteArray result = newByteArray(env, out.data(), out.size());
+    memset(out.data(), 0, out.size());
+    return result;
+}
+
+
+JNIEXPORT jstring JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_addressEncodeBatchJNI(JNIEnv *env, jobject thiz,
+                                                                    jint jiFormat, jbyteArray jaPrefix,
+                                                                    jint jiVersion, jbyteArray jaPayloads,
+                                                                    jbyteArray jaPayloadLens,
+                                                                    jint jiThreads) {
+    SecureBytes prefix = getBytes(env, jaPrefix);
+    SecureBytes payloads = getBytes(env, jaPayloads);
+    std::vector<uint32_t> payloadLens;
+    if (!getPackedLens(payloads, getBytes(env, jaPayloadLens), payloadLens)) return NULL;
+
+    size_t count = payloadLens.size();
+    SecureChars addresses(count * ADDRESS_MAX_LENGTH);
+    fast_crypto_address_encode_batch(jiFormat, prefix.data(), prefix.size(), jiVersion,
+                                     payloads.data(), payloadLens.data(), count, jiThreads,
+                                     addresses.data());
+
+    // Addresses are plain ASCII, so they go back as one newline-separated string:
+    std::string out;
+    out.reserve(count * 64);
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0) out += '\n';
+        out += &addresses[i * ADDRESS_MAX_LENGTH];
+    }
+    return env->NewStringUTF(out.c_str());
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_addressDecodeBatchJNI(JNIEnv *env, jobject thiz,
+                                                                    jint jiFormat, jbyteArray jaPrefix,
+                                                                    jstring jsAddresses,
+                                                                    jint jiThreads) {
+    SecureBytes prefix = getBytes(env, jaPrefix);
+    const char *szAddresses = env->GetStringUTFChars(jsAddresses, 0);
+    if (szAddresses == NULL) return NULL;
+
+    // The addresses arrive as one newline-separated string:
+    std::string addresses(szAddresses);
+    env->ReleaseStringUTFChars(jsAddresses, szAddresses);
+    std::vector<uint32_t> addressLens;
+    size_t start = 0;
+    for (size_t i = 0; i <= addresses.size(); ++i) {
+        if (i == addresses.size() || addresses[i] == '\n') {
+            addressLens.push_back(i - start);
+            start = i + 1;
+        }
+    }
+    addresses.erase(std::remove(addresses.begin(), addresses.end(), '\n'), addresses.end());
+
+    size_t count = addressLens.size();
+    SecureBytes payloads(count * ADDRESS_PAYLOAD_MAX_LENGTH);
+    std::vector<uint32_t> payloadLens(count);
+    std::vector<int32_t> versions(count);
+    fast_crypto_address_decode_batch(jiFormat, prefix.data(), prefix.size(), addresses.data(),
+                                     addressLens.data(), count, jiThreads, payloads.data(),
+                                     payloadLens.data(), versions.data());
+
+    // Each address packs its version byte (0xff if it failed),
+    // its payload length byte, and its payload:
+    SecureBytes out;
+    out.reserve(count * 2 + count * 32);
+    for (size_t i = 0; i < count; ++i) {
+        out.push_back(versions[i] < 0 ? 0xff : versions[i]);
+        out.push_back(payloadLens[i]);
+        const uint8_t *payload = &payloads[i * ADDRESS_PAYLOAD_MAX_LENGTH];
+        out.insert(out.end(), payload, payload + payloadLens[i]);
+    }
+    return newByteArray(env, out.data(), out.size());
+}
+
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_randomBytesJNI(JNIEnv *env, jobject thiz, jint size) {
+    if (size < 0) return NULL;
+    SecureBytes out(size);
+    jbyteArray result = fast_crypto_random_bytes(out.data(), out.size())
+                        ? newByteArray(env, out.data(), out.size())
+                        : NULL;
+    memset(out.data(), 0, out.size());
+    return result;
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_keysGenerateBatchJNI(JNIEnv *env, jobject thiz,
+                                                                   jint jiKeyType, jint jiCount,
+                                                                   jint jiThreads) {
+    size_t publicKeyLen = jiKeyType == KEYGEN_SECP256K1_COMPRESSED ? COMPRESSED_PUBKEY_LENGTH
+                          : jiKeyType == KEYGEN_SECP256K1_UNCOMPRESSED ? DECOMPRESSED_PUBKEY_LENGTH
+                          : XONLY_PUBKEY_LENGTH;
+    if (jiCount <= 0) return NULL;
+
+    // The private keys come first, followed by the public keys:
+    size_t count = jiCount;
+    SecureBytes keys(count * (SECRET_KEY_LENGTH + publicKeyLen));
+    size_t generated = fast_crypto_keys_generate_batch(jiKeyType, count, jiThreads, keys.data(),
+                                                       keys.data() + count * SECRET_KEY_LENGTH);
+    jbyteArray result = generated == count ? newByteArray(env, keys.data(), keys.size()) : NULL;
+    memset(keys.data(), 0, keys.size());
+    return result;
+}
+
+/**
+ * A Java Runnable waiting for a thread in the native worker pool.
+ */
+struct JavaTask {
+    JavaVM *vm;
+    jmethodID run;
+    jobject runnable;
+};
+
+/**
+ * Attaches a pool thread to the JVM the first time it runs Java code,
+ * and detaches it again if the pool ever retires the thread.
+ */
+struct JavaThread {
+    JavaVM *vm = NULL;
+    JNIEnv *env = NULL;
+    ~JavaThread() {
+        if (vm != NULL) vm->DetachCurrentThread();
+    }
+};
+
+static void runJavaTask(void *context) {
+    thread_local JavaThread thread;
+    std::unique_ptr<JavaTask> task(static_cast<JavaTask *>(context));
+
+    if (thread.env == NULL) {
+        JavaVMAttachArgs args = {JNI_VERSION_1_6, "fastcrypto-pool", NULL};
+#ifdef __ANDROID__
+        JNIEnv **env = &thread.env;
+#else
+        void **env = reinterpret_cast<void **>(&thread.env);
+#endif
+        // Daemon threads never hold up the JVM's exit:
+        if (task->vm->AttachCurrentThreadAsDaemon(env, &args) != JNI_OK) {
+            thread.env = NULL;
+            return;
+        }
+        thread.vm = task->vm;
+    }
+
+    // The Java side catches its own exceptions, so anything left is a bug:
+    thread.env->CallVoidMethod(task->runnable, task->run);
+    if (thread.env->ExceptionCheck()) {
+        thread.env->ExceptionDescribe();
+        thread.env->ExceptionClear();
+    }
+    thread.env->DeleteGlobalRef(task->runnable);
+}
+
+JNIEXPORT jboolean JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_poolSubmitJNI(JNIEnv *env, jobject thiz,
+                                                            jint jiPriority, jobject runnable) {
+    std::unique_ptr<JavaTask> task(new JavaTask());
+    if (env->GetJavaVM(&task->vm) != JNI_OK) return JNI_FALSE;
+
+    jclass runnableClass = env->GetObjectClass(runnable);
+    task->run = env->GetMethodID(runnableClass, "run", "()V");
+    env->DeleteLocalRef(runnableClass);
+    if (task->run == NULL) return JNI_FALSE;
+
+    task->runnable = env->NewGlobalRef(runnable);
+    if (!fast_crypto_pool_submit(jiPriority, runJavaTask, task.get())) {
+        env->DeleteGlobalRef(task->runnable);
+        return JNI_FALSE;
+    }
+    task.release();
+    return JNI_TRUE;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_poolConfigureJNI(JNIEnv *env, jobject thiz,
+                                                               jint jiPriority, jint jiThreads,
+                                                               jint jiQueueLimit,
+                                                               jintArray jaCpus) {
+    if (jiThreads <= 0 || jiQueueLimit <= 0) return JNI_FALSE;
+    std::vector<jint> cpus(env->GetArrayLength(jaCpus));
+    if (!cpus.empty()) env->GetIntArrayRegion(jaCpus, 0, cpus.size(), cpus.data());
+    std::vector<int> cpuList(cpus.begin(), cpus.end());
+    return fast_crypto_pool_configure(jiPriority, jiThreads, jiQueueLimit, cpuList.data(),
+                                      cpuList.size())
+           ? JNI_TRUE
+           : JNI_FALSE;
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_pipelineRunJNI(JNIEnv *env, jobject thiz,
+                                                             jbyteArray jaSteps,
+                                                             jbyteArray jaInputs,
+                                                             jbyteArray jaInputLens,
+                                                             jint jiOutputSlot) {
+    SecureBytes steps = getBytes(env, jaSteps);
+    SecureBytes inputs = getBytes(env, jaInputs);
+    std::vector<uint32_t> inputLens;
+    if (steps.size() % PIPELINE_STEP_LENGTH != 0 || jiOutputSlot < 0 ||
+        !getPackedLens(inputs, getBytes(env, jaInputLens), inputLens)) {
+        memset(inputs.data(), 0, inputs.size());
+        return NULL;
+    }
+    size_t stepCount = steps.size() / PIPELINE_STEP_LENGTH;
+
+    // The status byte and little-endian 32-bit step index come first,
+    // followed by the output:
+    size_t outSize, outLen = 0, failedStep;
+    int status = fast_crypto_pipeline_check(steps.data(), stepCount, inputLens.data(), inputLens.size(),
+                                            jiOutputSlot, &outSize, &failedStep);
+    SecureBytes out(5 + (status == PIPELINE_OK ? outSize : 0));
+    if (status == PIPELINE_OK) {
+        status = fast_crypto_pipeline_run(steps.data(), stepCount, inputs.data(), inputLens.data(),
+                                          inputLens.size(), jiOutputSlot, out.data() + 5, &outLen,
+                                          &failedStep);
+    }
+    memset(inputs.data(), 0, inputs.size());
+    uint32_t step = (uint32_t) failedStep;
+    out[0] = (uint8_t) status;
+    memcpy(out.data() + 1, &step, 4);
+
+    jbyteArray result = newByteArray(env, out.data(), 5 + outLen);
+    memset(out.data(), 0, out.size());
+    return result;
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_statsSnapshotJNI(JNIEnv *env, jobject thiz) {
+    uint8_t out[STATS_SNAPSHOT_LENGTH];
+    fast_crypto_stats_snapshot(out);
+    return newByteArray(env, out, sizeof(out));
+}
+
+JNIEXPORT void JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_statsResetJNI(JNIEnv *env, jobject thiz) {
+    fast_crypto_reset_stats();
+}
+
+JNIEXPORT jboolean JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_traceStartJNI(JNIEnv *env, jobject thiz,
+                                                            jint jiMaxEvents) {
+    if (jiMaxEvents <= 0) return JNI_FALSE;
+    return fast_crypto_trace_start(jiMaxEvents) ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jstring JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_traceStopJNI(JNIEnv *env, jobject thiz) {
+    // The first call stops the trace, so both calls see the same events:
+    std::vector<char> json(fast_crypto_trace_stop(NULL, 0) + 1);
+    fast_crypto_trace_stop(json.data(), json.size());
+    return env->NewStringUTF(json.data());
+}
+
+/**
+ * Pins a Java byte array in place for the lifetime of this object.
+ * Nothing may call back into the JVM while an array is pinned,
+ * so check the array lengths first and keep the work short.
+ * Inputs should release with JNI_ABORT, and outputs with 0.
+ */
+class CriticalBytes {
+public:
+    CriticalBytes(JNIEnv *env, jbyteArray array, jint mode):
+        env(env), array(array), mode(mode),
+        data((uint8_t *) env->GetPrimitiveArrayCritical(array, NULL)) {}
+    ~CriticalBytes() {
+        if (data) env->ReleasePrimitiveArrayCritical(array, data, mode);
+    }
+
+    JNIEnv *env;
+    jbyteArray array;
+    jint mode;
+    uint8_t *data;
+};
+
+/**
+ * Returns the address of a direct ByteBuffer holding at least `size` bytes,
+ * or NULL if the buffer is missing, not direct, or too small.
+ */
+static uint8_t *directBytes(JNIEnv *env, jobject buffer, jint size) {
+    static uint8_t empty;
+    if (size == 0) return &empty;
+    if (!buffer || size < 0) return NULL;
+
+    uint8_t *data = (uint8_t *) env->GetDirectBufferAddress(buffer);
+    return data && env->GetDirectBufferCapacity(buffer) >= size ? data : NULL;
+}
+
+/**
+ * Runs scrypt straight out of and into direct ByteBuffers.
+ * A pinned array would hold up the garbage collector for the whole run,
+ * so this uses memory the collector never moves instead.
+ */
+JNIEXPORT jboolean JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_scryptIntoJNI(JNIEnv *env, jobject thiz,
+                                                            jobject jbPassword, jint jiPasswordLen,
+                                                            jobject jbSalt, jint jiSaltLen,
+                                                            jint N, jint r, jint p,
+                                                            jobject jbOut, jint size) {
+    uint8_t *password = directBytes(env, jbPassword, jiPasswordLen);
+    uint8_t *salt = directBytes(env, jbSalt, jiSaltLen);
+    uint8_t *out = directBytes(env, jbOut, size);
+    if (!password || !salt || !out) return JNI_FALSE;
+
+    if (N <= 0 || r <= 0 || p <= 0) return JNI_FALSE;
+    return fast_crypto_scrypt(password, jiPasswordLen, salt, jiSaltLen, N, r, p, out, size) ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jint JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1EcPubkeyCreateIntoJNI(JNIEnv *env, jobject thiz,
+                                                                            jbyteArray jaPrivateKey,
+                                                                            jint jiCompressed,
+                                                                            jbyteArray jaOut) {
+    jsize outLen = jiCompressed ? COMPRESSED_PUBKEY_LENGTH : DECOMPRESSED_PUBKEY_LENGTH;
+    if (!jaPrivateKey || !jaOut ||
+        env->GetArrayLength(jaPrivateKey) != SECRET_KEY_LENGTH ||
+        env->GetArrayLength(jaOut) < outLen) {
+        return 0;
+    }
+
+    CriticalBytes privateKey(env, jaPrivateKey, JNI_ABORT);
+    CriticalBytes out(env, jaOut, 0);
+    if (!privateKey.data || !out.data) return 0;
+    return fast_crypto_secp256k1_pubkey_create(privateKey.data, jiCompressed, out.data);
+}
+
+JNIEXPORT jboolean JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1EcPrivkeyTweakAddIntoJNI(JNIEnv *env, jobject thiz,
+                                                                                jbyteArray jaPrivateKey,
+                                                                                jbyteArray jaTweak,
+                                                                                jbyteArray jaOut) {
+    if (!jaPrivateKey || !jaTweak || !jaOut ||
+        env->GetArrayLength(jaPrivateKey) != SECRET_KEY_LENGTH ||
+        env->GetArrayLength(jaTweak) != SECRET_KEY_LENGTH ||
+        env->GetArrayLength(jaOut) < SECRET_KEY_LENGTH) {
+        return JNI_FALSE;
+    }
+
+    CriticalBytes privateKey(env, jaPrivateKey, JNI_ABORT);
+    CriticalBytes tweak(env, jaTweak, JNI_ABORT);
+    CriticalBytes out(env, jaOut, 0);
+    if (!privateKey.data || !tweak.data || !out.data) return JNI_FALSE;
+    return fast_crypto_secp256k1_privkey_tweak_add(privateKey.data, tweak.data, out.data)
+           ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jint JNICALL
+Java_co_airbitz_fastcrypto_RNFastCryptoModule_secp256k1EcPubkeyTweakAddIntoJNI(JNIEnv *env, jobject thiz,
+                                                                               jbyteArray jaPublicKey,
+                                                                               jbyteArray jaTweak,
+                                                                               jint jiCompressed,
+                                                                               jbyteArray jaOut) {
+    jsize outLen = jiCompressed ? COMPRESSED_PUBKEY_LENGTH : DECOMPRESSED_PUBKEY_LENGTH;
+    if (!jaPublicKey || !jaTweak || !jaOut ||
+        env->GetArrayLength(jaTweak) != SECRET_KEY_LENGTH ||
+        env->GetArrayLength(jaOut) < outLen) {
+        return 0;
+    }
+    jsize publicKeyLen = env->GetArrayLength(jaPublicKey);
+
+    CriticalBytes publicKey(env, jaPublicKey, JNI_ABORT);
+    CriticalBytes tweak(env, jaTweak, JNI_ABORT);
+    CriticalBytes out(env, jaOut, 0);
+    if (!publicKey.data || !tweak.data || !out.data) return 0;
+    return fast_crypto_secp256k1_pubkey_tweak_add(publicKey.data, publicKeyLen, tweak.data,
+                                                  jiCompressed, out.data);
+}
+
+/**
+ * Copies an ASCII Java string into a native buffer,
+ * since base64 and hex look the same in modified UTF-8.
+ */
+static SecureChars getText(JNIEnv *env, jstring string) {
+    // Some VMs add a NUL terminator, so leave room:
+    SecureChars out(env->GetStringUTFLength(string) + 1);
+    env->GetStringUTFRegion(string, 0, env->GetStringLength(string), out.data());
+    out.pop_back();
+    return out;
+}
+
+/**
+ * Decodes base64 for the Java side of the bridge,
+ * throwing IllegalArgumentException if the text is not base64.
+ */
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_Bytes_fromBase64(JNIEnv *env, jclass clazz, jstring jsText) {
+    if (!jsText) {
+        env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), "Missing base64");
+        return NULL;
+    }
+
+    SecureChars text = getText(env, jsText);
+    SecureBytes out(BASE64_DECODED_MAX_LENGTH(text.size()));
+    size_t outLen = 0;
+    size_t errorPos = 0;
+    if (!fast_crypto_base64_decode(text.data(), text.size(), out.data(), &outLen, &errorPos)) {
+        std::string message = "Invalid base64 at offset " + std::to_string(errorPos);
+        env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), message.c_str());
+        return NULL;
+    }
+    jbyteArray result = newByteArray(env, out.data(), outLen);
+    memset(out.data(), 0, out.size());
+    return result;
+}
+
+/**
+ * Encodes bytes as base64 for the Java side of the bridge.
+ */
+JNIEXPORT jstring JNICALL
+Java_co_airbitz_fastcrypto_Bytes_toBase64(JNIEnv *env, jclass clazz, jbyteArray jaData) {
+    jsize length = jaData ? env->GetArrayLength(jaData) : 0;
+    SecureChars text(BASE64_ENCODED_LENGTH(length) + 1);
+    if (length > 0) {
+        CriticalBytes data(env, jaData, JNI_ABORT);
+        if (!data.data) return NULL;
+        fast_crypto_base64_encode(data.data, length, text.data());
+    }
+    return env->NewStringUTF(text.data());
+}
+
+/**
+ * Decodes upper or lower-case hex for the Java side of the bridge,
+ * returning null if the text is not hex.
+ */
+JNIEXPORT jbyteArray JNICALL
+Java_co_airbitz_fastcrypto_Bytes_fromHex(JNIEnv *env, jclass clazz, jstring jsText) {
+    if (!jsText) return NULL;
+
+    SecureChars text = getText(env, jsText);
+    SecureBytes out(text.size() / 2);
+    if (!fast_crypto_hex_decode(text.data(), text.size(), out.data(), NULL)) return NULL;
+    jbyteArray result = newByteArray(env, out.data(), out.size());
+    memset(out.data(), 0, out.size());
+    return result;
+}
+
+/**
+ * Encodes the first `length` bytes as lower-case hex
+ * for the Java side of the bridge.
+ */
+JNIEXPORT jstring JNICALL
+Java_co_airbitz_fastcrypto_Bytes_toHex(JNIEnv *env, jclass clazz, jbyteArray jaData,
+                                       jint jiLength) {
+    if (jiLength < 0 || (jiLength > 0 && (!jaData || env->GetArrayLength(jaData) < jiLength))) {
+        env->ThrowNew(env->FindClass("java/lang/IndexOutOfBoundsException"), "Invalid length");
+        return NULL;
+    }
+
+    SecureChars text(2 * (size_t) jiLength + 1);
+    if (jiLength > 0) {
+        CriticalBytes data(env, jaData, JNI_ABORT);
+        if (!data.data) return NULL;
+        fast_crypto_hex_encode(data.data, jiLength, text.data());
+    }
+    return env->NewStringUTF(text.data());
+}
+
 }
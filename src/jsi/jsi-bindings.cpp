@@ -0,0 +1,1426 @@
+/*
+ * Copyright (c) 2014, Airbitz, Inc.
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include "jsi-bindings.h"
+#include "../native-crypto.h"
+#include "../secure-memory.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace fastcrypto {
+
+using namespace facebook;
+
+namespace {
+
+// Empty buffers point here rather than at NULL:
+const uint8_t emptyByte = 0;
+
+/**
+ * An ArrayBuffer backing store in the secure arena, which wipes it
+ * once JavaScript lets go of it, since many of our outputs are secret.
+ */
+class Buffer : public jsi::MutableBuffer {
+public:
+    explicit Buffer(size_t size): bytes(size) {}
+
+    size_t size() const override { return bytes.size(); }
+    uint8_t *data() override { return bytes.data(); }
+
+    SecureBytes bytes;
+};
+
+/**
+ * One method argument. Byte arguments point straight into their
+ * JavaScript buffer for synchronous calls, or into a private copy
+ * for calls that run on a worker thread.
+ */
+struct Arg {
+    Arg() {}
+    Arg(const Arg &) = delete;
+    Arg &operator=(const Arg &) = delete;
+
+    /**
+     * Returns the buffer contents, or NULL if the optional buffer is empty.
+     */
+    const uint8_t *optional() const { return size ? data : NULL; }
+
+    // Out-of-range numbers become 0, which every method rejects or
+    // treats as a default, the same as a missing argument:
+    int toInt() const {
+        return number >= -2147483648.0 && number <= 2147483647.0 ? (int) number : 0;
+    }
+    size_t toSize() const {
+        return number >= 0 && number <= 4294967295.0 ? (size_t) number : 0;
+    }
+    unsigned toThreads() const { return (unsigned) toSize(); }
+
+    // Handles fit in 32 bits, but the bridge can hand them out as negative numbers:
+    uint32_t toHandle() const {
+        return number >= -2147483648.0 && number <= 4294967295.0
+               ? (uint32_t) (int64_t) number : 0;
+    }
+
+    const uint8_t *data = &emptyByte;
+    size_t size = 0;
+    double number = 0;
+    std::string text;
+    std::vector<double> list;
+    SecureBytes copy;
+};
+
+typedef std::vector<Arg> Args;
+
+/**
+ * A method's return value, or the error it wants to throw.
+ * This is plain C++, so worker threads can build one.
+ */
+struct Result {
+    enum Kind { UNDEFINED, BYTES, NUMBER, BOOLEAN, TEXT, ERROR };
+
+    Kind kind = UNDEFINED;
+    std::shared_ptr<Buffer> bytes;
+    double number = 0;
+    std::string text;
+};
+
+Result fail(const char *message) {
+    Result out;
+    out.kind = Result::ERROR;
+    out.text = message;
+    return out;
+}
+
+Result bytesResult(std::shared_ptr<Buffer> bytes) {
+    Result out;
+    out.kind = Result::BYTES;
+    out.bytes = std::move(bytes);
+    return out;
+}
+
+Result copyResult(const uint8_t *data, size_t size) {
+    std::shared_ptr<Buffer> bytes = std::make_shared<Buffer>(size);
+    if (size != 0) memcpy(bytes->data(), data, size);
+    return bytesResult(std::move(bytes));
+}
+
+Result numberResult(double number) {
+    Result out;
+    out.kind = Result::NUMBER;
+    out.number = number;
+    return out;
+}
+
+Result boolResult(bool value) {
+    Result out;
+    out.kind = Result::BOOLEAN;
+    out.number = value ? 1 : 0;
+    return out;
+}
+
+Result textResult(std::string text) {
+    Result out;
+    out.kind = Result::TEXT;
+    out.text = std::move(text);
+    return out;
+}
+
+/**
+ * True if a batch of `count` items, `stride` bytes each, is too big
+ * for a size_t. This has to come before any `count * stride`, which
+ * wraps around on the 32-bit ABIs (armeabi-v7a and x86).
+ */
+bool batchOverflows(size_t count, size_t stride) {
+    return count > SIZE_MAX / stride;
+}
+
+/**
+ * Unpacks the little-endian 32-bit lengths of some back-to-back items,
+ * checking that they cover the packed data exactly.
+ */
+bool getPackedLens(const Arg &items, const Arg &lenBytes, std::vector<uint32_t> &itemLens) {
+    if (lenBytes.size % 4 != 0) return false;
+    itemLens.resize(lenBytes.size / 4);
+    if (!itemLens.empty()) memcpy(itemLens.data(), lenBytes.data, lenBytes.size);
+
+    // Counting down what is left, rather than summing, can't wrap around:
+    size_t left = items.size;
+    for (size_t i = 0; i < itemLens.size(); ++i) {
+        if (itemLens[i] > left) return false;
+        left -= itemLens[i];
+    }
+    return left == 0;
+}
+
+/**
+ * Packs each record's status byte, little-endian 32-bit plaintext length,
+ * and plaintext back-to-back, then wipes the decrypted copies.
+ */
+Result packRecords(const std::vector<uint32_t> &recordLens, SecureBytes &plaintexts,
+                   const std::vector<uint32_t> &plaintextLens, const SecureBytes &statuses) {
+    size_t size = 0;
+    for (size_t i = 0; i < recordLens.size(); ++i) size += 5 + plaintextLens[i];
+
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(size);
+    uint8_t *item = out->data();
+    const uint8_t *plaintext = plaintexts.data();
+    for (size_t i = 0; i < recordLens.size(); ++i) {
+        item[0] = statuses[i];
+        memcpy(item + 1, &plaintextLens[i], 4);
+        if (plaintextLens[i] != 0) memcpy(item + 5, plaintext, plaintextLens[i]);
+        item += 5 + plaintextLens[i];
+        plaintext += recordLens[i];
+    }
+    if (!plaintexts.empty()) memset(plaintexts.data(), 0, plaintexts.size());
+    return bytesResult(std::move(out));
+}
+
+// ---------------------------------------------------------------------------
+// Methods, in the same order and with the same checks as src/jni/jni.cpp.
+// ---------------------------------------------------------------------------
+
+Result scrypt(Args &a) {
+    const Arg &passwd = a[0], &salt = a[1];
+    if (a[5].number < 0) return fail("Invalid scrypt parameters");
+
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(a[5].toSize());
+    if (!fast_crypto_scrypt(passwd.data, passwd.size, salt.data, salt.size,
+                            a[2].toInt(), a[3].toInt(), a[4].toInt(), out->data(), out->size())) {
+        return fail("Invalid scrypt parameters");
+    }
+    return bytesResult(std::move(out));
+}
+
+// The three old hex methods give back an empty key, or the original
+// private key, instead of failing:
+
+Result secp256k1EcPubkeyCreate(Args &a) {
+    const Arg &privateKey = a[0];
+    uint8_t out[DECOMPRESSED_PUBKEY_LENGTH];
+    size_t outLen = privateKey.size != SECRET_KEY_LENGTH ? 0
+                    : fast_crypto_secp256k1_pubkey_create(privateKey.data, a[1].number != 0, out);
+    return copyResult(out, outLen);
+}
+
+Result secp256k1EcPrivkeyTweakAdd(Args &a) {
+    const Arg &privateKey = a[0], &tweak = a[1];
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(SECRET_KEY_LENGTH);
+    if (privateKey.size != SECRET_KEY_LENGTH || tweak.size != SECRET_KEY_LENGTH ||
+        !fast_crypto_secp256k1_privkey_tweak_add(privateKey.data, tweak.data, out->data())) {
+        return copyResult(privateKey.data, privateKey.size);
+    }
+    return bytesResult(std::move(out));
+}
+
+Result secp256k1EcPubkeyTweakAdd(Args &a) {
+    // Only compressed keys are supported:
+    const Arg &publicKey = a[0], &tweak = a[1];
+    uint8_t out[COMPRESSED_PUBKEY_LENGTH];
+    size_t outLen = a[2].number != 0 && publicKey.size == COMPRESSED_PUBKEY_LENGTH &&
+                    tweak.size == SECRET_KEY_LENGTH
+                    ? fast_crypto_secp256k1_pubkey_tweak_add(publicKey.data, publicKey.size,
+                                                             tweak.data, 1, out)
+                    : 0;
+    return copyResult(out, outLen);
+}
+
+Result secp256k1EcPubkeyCreateBatch(Args &a) {
+    const Arg &privateKeys = a[0];
+    size_t count = a[1].toSize();
+    if (count == 0 || batchOverflows(count, 1 + DECOMPRESSED_PUBKEY_LENGTH) ||
+        privateKeys.size != count * SECRET_KEY_LENGTH) {
+        return fail("Invalid batch layout");
+    }
+
+    // The result bytes come first, followed by the public keys:
+    bool compressed = a[2].number != 0;
+    size_t publicKeyLen = compressed ? COMPRESSED_PUBKEY_LENGTH : DECOMPRESSED_PUBKEY_LENGTH;
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(count * (1 + publicKeyLen));
+    fast_crypto_secp256k1_pubkey_create_batch(privateKeys.data, count, compressed, a[3].toThreads(),
+                                              out->data() + count, out->data());
+    return bytesResult(std::move(out));
+}
+
+Result secp256k1EcPrivkeyTweakAddBatch(Args &a) {
+    const Arg &privateKeys = a[0], &tweaks = a[1];
+    size_t count = a[2].toSize();
+    if (count == 0 || batchOverflows(count, 1 + SECRET_KEY_LENGTH) ||
+        privateKeys.size != count * SECRET_KEY_LENGTH ||
+        tweaks.size != count * SECRET_KEY_LENGTH) {
+        return fail("Invalid batch layout");
+    }
+
+    // The result bytes come first, followed by the private keys:
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(count * (1 + SECRET_KEY_LENGTH));
+    fast_crypto_secp256k1_privkey_tweak_add_batch(privateKeys.data, tweaks.data, count,
+                                                  a[3].toThreads(), out->data() + count, out->data());
+    return bytesResult(std::move(out));
+}
+
+Result secp256k1EcdsaSign(Args &a) {
+    const Arg &privateKey = a[0], &msgHash = a[1];
+    if (privateKey.size != SECRET_KEY_LENGTH || msgHash.size != MESSAGE_HASH_LENGTH) {
+        return fail("Invalid private key");
+    }
+
+    uint8_t sig[ECDSA_DER_SIGNATURE_MAX_LENGTH];
+    size_t sigLen = 0;
+    if (!fast_crypto_secp256k1_ecdsa_sign(privateKey.data, msgHash.data, sig, &sigLen,
+                                          a[2].number != 0)) {
+        return fail("Invalid private key");
+    }
+    return copyResult(sig, sigLen);
+}
+
+Result secp256k1EcdsaVerify(Args &a) {
+    const Arg &sig = a[0], &msgHash = a[2], &publicKey = a[3];
+    if (msgHash.size != MESSAGE_HASH_LENGTH) return boolResult(false);
+
+    return boolResult(fast_crypto_secp256k1_ecdsa_verify(sig.data, sig.size, a[1].number != 0,
+                                                         msgHash.data, publicKey.data,
+                                                         publicKey.size, a[4].number != 0));
+}
+
+Result secp256k1EcdsaVerifyBatch(Args &a) {
+    const Arg &sigs = a[0], &msgHashes = a[1], &publicKeys = a[2];
+    size_t count = a[3].toSize();
+    if (count == 0 || batchOverflows(count, ECDSA_COMPACT_SIGNATURE_LENGTH) ||
+        sigs.size != count * ECDSA_COMPACT_SIGNATURE_LENGTH ||
+        msgHashes.size != count * MESSAGE_HASH_LENGTH ||
+        publicKeys.size % count != 0) {
+        return fail("Invalid batch layout");
+    }
+
+    std::shared_ptr<Buffer> results = std::make_shared<Buffer>(count);
+    fast_crypto_secp256k1_ecdsa_verify_batch(sigs.data, msgHashes.data, publicKeys.data,
+                                             publicKeys.size / count, count, a[4].number != 0,
+                                             a[5].toThreads(), results->data());
+    return bytesResult(std::move(results));
+}
+
+Result secp256k1XonlyPubkeyCreateBatch(Args &a) {
+    const Arg &privateKeys = a[0];
+    size_t count = a[1].toSize();
+    if (count == 0 || batchOverflows(count, SECRET_KEY_LENGTH) ||
+        privateKeys.size != count * SECRET_KEY_LENGTH) {
+        return fail("Invalid private key");
+    }
+
+    std::shared_ptr<Buffer> publicKeys = std::make_shared<Buffer>(count * XONLY_PUBKEY_LENGTH);
+    if (fast_crypto_secp256k1_xonly_pubkey_create_batch(privateKeys.data, count, a[2].toThreads(),
+                                                        publicKeys->data()) != count) {
+        return fail("Invalid private key");
+    }
+    return bytesResult(std::move(publicKeys));
+}
+
+Result secp256k1TaprootTweakPubkeyBatch(Args &a) {
+    const Arg &internalKeys = a[0], &merkleRoots = a[1];
+    size_t count = a[2].toSize();
+    if (count == 0 || batchOverflows(count, XONLY_PUBKEY_LENGTH + 1) ||
+        internalKeys.size != count * XONLY_PUBKEY_LENGTH ||
+        (merkleRoots.size != 0 && merkleRoots.size != count * 32)) {
+        return fail("Invalid internal key");
+    }
+
+    // The output keys come first, followed by one parity byte per key:
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(count * (XONLY_PUBKEY_LENGTH + 1));
+    if (fast_crypto_secp256k1_taproot_tweak_pubkey_batch(internalKeys.data, merkleRoots.optional(),
+                                                         count, a[3].toThreads(), out->data(),
+                                                         out->data() + count * XONLY_PUBKEY_LENGTH) != count) {
+        return fail("Invalid internal key");
+    }
+    return bytesResult(std::move(out));
+}
+
+Result secp256k1TaprootTweakPrivkeyBatch(Args &a) {
+    const Arg &privateKeys = a[0], &merkleRoots = a[1];
+    size_t count = a[2].toSize();
+    if (count == 0 || batchOverflows(count, SECRET_KEY_LENGTH) ||
+        privateKeys.size != count * SECRET_KEY_LENGTH ||
+        (merkleRoots.size != 0 && merkleRoots.size != count * 32)) {
+        return fail("Invalid private key");
+    }
+
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(count * SECRET_KEY_LENGTH);
+    if (fast_crypto_secp256k1_taproot_tweak_privkey_batch(privateKeys.data, merkleRoots.optional(),
+                                                          count, a[3].toThreads(), out->data()) != count) {
+        return fail("Invalid private key");
+    }
+    return bytesResult(std::move(out));
+}
+
+Result secp256k1SchnorrSignBatch(Args &a) {
+    const Arg &privateKeys = a[0], &msgs = a[1], &auxRands = a[2];
+    size_t count = a[3].toSize();
+    if (count == 0 || batchOverflows(count, SCHNORR_SIGNATURE_LENGTH) ||
+        privateKeys.size != count * SECRET_KEY_LENGTH ||
+        msgs.size != count * MESSAGE_HASH_LENGTH ||
+        (auxRands.size != 0 && auxRands.size != count * 32)) {
+        return fail("Invalid private key");
+    }
+
+    std::shared_ptr<Buffer> sigs = std::make_shared<Buffer>(count * SCHNORR_SIGNATURE_LENGTH);
+    if (fast_crypto_secp256k1_schnorr_sign_batch(privateKeys.data, msgs.data, auxRands.optional(),
+                                                 count, a[4].toThreads(), sigs->data()) != count) {
+        return fail("Invalid private key");
+    }
+    return bytesResult(std::move(sigs));
+}
+
+Result secp256k1SchnorrVerifyBatch(Args &a) {
+    const Arg &sigs = a[0], &msgs = a[1], &publicKeys = a[2];
+    size_t count = a[3].toSize();
+    if (count == 0 || batchOverflows(count, SCHNORR_SIGNATURE_LENGTH) ||
+        sigs.size != count * SCHNORR_SIGNATURE_LENGTH ||
+        msgs.size != count * MESSAGE_HASH_LENGTH ||
+        publicKeys.size != count * XONLY_PUBKEY_LENGTH) {
+        return fail("Invalid batch layout");
+    }
+
+    std::shared_ptr<Buffer> results = std::make_shared<Buffer>(count);
+    fast_crypto_secp256k1_schnorr_verify_batch(sigs.data, msgs.data, publicKeys.data,
+                                               count, a[4].toThreads(), results->data());
+    return bytesResult(std::move(results));
+}
+
+Result secp256k1EcdsaSignRecoverableBatch(Args &a) {
+    const Arg &privateKeys = a[0], &msgHashes = a[1];
+    size_t count = a[2].toSize();
+    if (count == 0 || batchOverflows(count, RECOVERABLE_SIGNATURE_LENGTH) ||
+        privateKeys.size != count * SECRET_KEY_LENGTH ||
+        msgHashes.size != count * MESSAGE_HASH_LENGTH) {
+        return fail("Invalid private key");
+    }
+
+    std::shared_ptr<Buffer> sigs = std::make_shared<Buffer>(count * RECOVERABLE_SIGNATURE_LENGTH);
+    if (fast_crypto_secp256k1_ecdsa_sign_recoverable_batch(privateKeys.data, msgHashes.data,
+                                                           count, a[3].toThreads(), sigs->data()) != count) {
+        return fail("Invalid private key");
+    }
+    return bytesResult(std::move(sigs));
+}
+
+Result secp256k1EcdsaRecoverBatch(Args &a) {
+    const Arg &sigs = a[0], &msgHashes = a[1];
+    size_t count = a[2].toSize();
+    int format = a[3].toInt();
+    if (count == 0 || batchOverflows(count, DECOMPRESSED_PUBKEY_LENGTH + 1) ||
+        sigs.size != count * RECOVERABLE_SIGNATURE_LENGTH ||
+        msgHashes.size != count * MESSAGE_HASH_LENGTH) {
+        return fail("Invalid batch layout");
+    }
+
+    size_t stride;
+    switch (format) {
+        case RECOVER_COMPRESSED_PUBKEY: stride = COMPRESSED_PUBKEY_LENGTH; break;
+        case RECOVER_UNCOMPRESSED_PUBKEY: stride = DECOMPRESSED_PUBKEY_LENGTH; break;
+        case RECOVER_ETHEREUM_ADDRESS: stride = ETHEREUM_ADDRESS_LENGTH; break;
+        default: return fail("Invalid batch layout");
+    }
+
+    // The recovered items come first, followed by one status byte per item:
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(count * (stride + 1));
+    fast_crypto_secp256k1_ecdsa_recover_batch(sigs.data, msgHashes.data, count, format,
+                                              a[4].toThreads(), out->data(),
+                                              out->data() + count * stride);
+    return bytesResult(std::move(out));
+}
+
+Result secp256k1Ecdh(Args &a) {
+    const Arg &privateKey = a[0], &publicKey = a[1];
+    if (privateKey.size != SECRET_KEY_LENGTH) return fail("Invalid key");
+
+    std::shared_ptr<Buffer> secret = std::make_shared<Buffer>(32);
+    if (!fast_crypto_secp256k1_ecdh(privateKey.data, publicKey.data, publicKey.size,
+                                    secret->data())) {
+        return fail("Invalid key");
+    }
+    return bytesResult(std::move(secret));
+}
+
+Result silentPaymentsScan(Args &a) {
+    const Arg &scanKey = a[0], &spendPublicKey = a[1], &labels = a[2], &tweaks = a[3];
+    const Arg &inputHashes = a[4], &outputKeys = a[5], &outputCountBytes = a[6];
+
+    // The output counts arrive as little-endian 32-bit integers:
+    size_t txCount = tweaks.size / COMPRESSED_PUBKEY_LENGTH;
+    std::vector<uint32_t> outputCounts(txCount);
+    if (outputCountBytes.size != 4 * txCount) return fail("Invalid scan layout");
+    if (txCount != 0) memcpy(outputCounts.data(), outputCountBytes.data, outputCountBytes.size);
+
+    size_t outputTotal = 0;
+    for (size_t i = 0; i < txCount; ++i) outputTotal += outputCounts[i];
+    if (scanKey.size != SECRET_KEY_LENGTH ||
+        spendPublicKey.size != COMPRESSED_PUBKEY_LENGTH ||
+        labels.size % COMPRESSED_PUBKEY_LENGTH != 0 ||
+        tweaks.size != txCount * COMPRESSED_PUBKEY_LENGTH ||
+        (inputHashes.size != 0 && inputHashes.size != txCount * 32) ||
+        outputKeys.size != outputTotal * XONLY_PUBKEY_LENGTH) {
+        return fail("Invalid scan layout");
+    }
+
+    // Each output can match at most once:
+    std::vector<fast_crypto_silent_payment_match> matches(outputTotal);
+    size_t matchCount = fast_crypto_silent_payments_scan(
+        scanKey.data, spendPublicKey.data,
+        labels.optional(), labels.size / COMPRESSED_PUBKEY_LENGTH,
+        tweaks.data, inputHashes.optional(), txCount,
+        outputKeys.data, outputCounts.data(), a[7].toThreads(),
+        matches.data(), matches.size());
+
+    // Pack each match as little-endian tx index, output index,
+    // and label index, followed by the 32-byte tweak:
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(matchCount * 44);
+    for (size_t i = 0; i < matchCount; ++i) {
+        uint8_t *item = out->data() + i * 44;
+        memcpy(item + 0, &matches[i].txIndex, 4);
+        memcpy(item + 4, &matches[i].outputIndex, 4);
+        memcpy(item + 8, &matches[i].labelIndex, 4);
+        memcpy(item + 12, matches[i].tweak, 32);
+    }
+    return bytesResult(std::move(out));
+}
+
+Result musigPubkeyAgg(Args &a) {
+    const Arg &publicKeys = a[0];
+    if (publicKeys.size == 0 || publicKeys.size % COMPRESSED_PUBKEY_LENGTH != 0) {
+        return fail("Invalid public key");
+    }
+
+    // The aggregate key comes first, followed by the cache:
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(XONLY_PUBKEY_LENGTH + MUSIG_KEYAGG_CACHE_LENGTH);
+    if (!fast_crypto_musig_pubkey_agg(publicKeys.data, publicKeys.size / COMPRESSED_PUBKEY_LENGTH,
+                                      a[1].number != 0, out->data(), out->data() + XONLY_PUBKEY_LENGTH)) {
+        return fail("Invalid public key");
+    }
+    return bytesResult(std::move(out));
+}
+
+Result musigPubkeyAggBatch(Args &a) {
+    const Arg &publicKeySets = a[0];
+    size_t keysPerSet = a[1].toSize();
+    size_t setCount = a[2].toSize();
+    if (keysPerSet == 0 || setCount == 0 ||
+        publicKeySets.size != setCount * keysPerSet * COMPRESSED_PUBKEY_LENGTH) {
+        return fail("Invalid public key");
+    }
+
+    std::shared_ptr<Buffer> aggregateKeys = std::make_shared<Buffer>(setCount * XONLY_PUBKEY_LENGTH);
+    if (fast_crypto_musig_pubkey_agg_batch(publicKeySets.data, keysPerSet, setCount, a[3].number != 0,
+                                           a[4].toThreads(), aggregateKeys->data()) != setCount) {
+        return fail("Invalid public key");
+    }
+    return bytesResult(std::move(aggregateKeys));
+}
+
+Result musigPubkeyTweakAdd(Args &a) {
+    const Arg &keyaggCache = a[0], &tweak = a[1];
+    if (tweak.size != 32 || keyaggCache.size != MUSIG_KEYAGG_CACHE_LENGTH) {
+        return fail("Invalid tweak");
+    }
+
+    // The tweaked key comes first, followed by the updated cache,
+    // which leaves the caller's cache alone:
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(COMPRESSED_PUBKEY_LENGTH + MUSIG_KEYAGG_CACHE_LENGTH);
+    uint8_t *cache = out->data() + COMPRESSED_PUBKEY_LENGTH;
+    memcpy(cache, keyaggCache.data, MUSIG_KEYAGG_CACHE_LENGTH);
+    if (!fast_crypto_musig_pubkey_tweak_add(cache, tweak.data, a[2].number != 0, out->data())) {
+        return fail("Invalid tweak");
+    }
+    return bytesResult(std::move(out));
+}
+
+Result musigNonceGen(Args &a) {
+    const Arg &sessionRand = a[0], &privateKey = a[1], &publicKey = a[2];
+    const Arg &msg = a[3], &keyaggCache = a[4];
+    if (sessionRand.size != 32 ||
+        (privateKey.size != 0 && privateKey.size != SECRET_KEY_LENGTH) ||
+        publicKey.size != COMPRESSED_PUBKEY_LENGTH ||
+        (msg.size != 0 && msg.size != MESSAGE_HASH_LENGTH) ||
+        (keyaggCache.size != 0 && keyaggCache.size != MUSIG_KEYAGG_CACHE_LENGTH)) {
+        return fail("Invalid nonce inputs");
+    }
+
+    // The secret nonce stays native, so this returns its little-endian
+    // 32-bit handle, followed by the public nonce:
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(4 + MUSIG_PUBNONCE_LENGTH);
+    uint8_t *bytes = out->data();
+    uint32_t handle = fast_crypto_musig_nonce_gen(sessionRand.data, privateKey.optional(),
+                                                  publicKey.data, msg.optional(),
+                                                  keyaggCache.optional(), bytes + 4);
+    if (handle == 0) return fail("Invalid nonce inputs");
+    bytes[0] = handle;
+    bytes[1] = handle >> 8;
+    bytes[2] = handle >> 16;
+    bytes[3] = handle >> 24;
+    return bytesResult(std::move(out));
+}
+
+Result musigNonceAgg(Args &a) {
+    const Arg &pubnonces = a[0];
+    if (pubnonces.size == 0 || pubnonces.size % MUSIG_PUBNONCE_LENGTH != 0) {
+        return fail("Invalid public nonce");
+    }
+
+    uint8_t aggnonce[MUSIG_PUBNONCE_LENGTH];
+    if (!fast_crypto_musig_nonce_agg(pubnonces.data, pubnonces.size / MUSIG_PUBNONCE_LENGTH, aggnonce)) {
+        return fail("Invalid public nonce");
+    }
+    return copyResult(aggnonce, sizeof(aggnonce));
+}
+
+Result musigPartialSign(Args &a) {
+    uint32_t nonceHandle = a[0].toHandle();
+    const Arg &privateKey = a[1], &keyaggCache = a[2];
+    const Arg &aggnonce = a[3], &msg = a[4];
+    if (privateKey.size != SECRET_KEY_LENGTH ||
+        keyaggCache.size != MUSIG_KEYAGG_CACHE_LENGTH || aggnonce.size != MUSIG_PUBNONCE_LENGTH ||
+        msg.size != MESSAGE_HASH_LENGTH) {
+        // Never leave a nonce behind that a retry could sign with:
+        fast_crypto_musig_nonce_release(nonceHandle);
+        return fail("Cannot create partial signature");
+    }
+
+    uint8_t partialSig[MUSIG_PARTIAL_SIG_LENGTH];
+    int success = fast_crypto_musig_partial_sign(nonceHandle, privateKey.data, keyaggCache.data,
+                                                 aggnonce.data, msg.data, partialSig);
+    return success ? copyResult(partialSig, sizeof(partialSig))
+           : fail("Cannot create partial signature");
+}
+
+Result musigNonceRelease(Args &a) {
+    fast_crypto_musig_nonce_release(a[0].toHandle());
+    return Result();
+}
+
+Result musigPartialVerify(Args &a) {
+    const Arg &partialSig = a[0], &pubnonce = a[1], &publicKey = a[2];
+    const Arg &keyaggCache = a[3], &aggnonce = a[4], &msg = a[5];
+    if (partialSig.size != MUSIG_PARTIAL_SIG_LENGTH || pubnonce.size != MUSIG_PUBNONCE_LENGTH ||
+        publicKey.size != COMPRESSED_PUBKEY_LENGTH || keyaggCache.size != MUSIG_KEYAGG_CACHE_LENGTH ||
+        aggnonce.size != MUSIG_PUBNONCE_LENGTH || msg.size != MESSAGE_HASH_LENGTH) {
+        return boolResult(false);
+    }
+
+    return boolResult(fast_crypto_musig_partial_verify(partialSig.data, pubnonce.data, publicKey.data,
+                                                       keyaggCache.data, aggnonce.data, msg.data));
+}
+
+Result musigPartialSigAgg(Args &a) {
+    const Arg &partialSigs = a[0], &keyaggCache = a[1], &aggnonce = a[2], &msg = a[3];
+    if (partialSigs.size == 0 || partialSigs.size % MUSIG_PARTIAL_SIG_LENGTH != 0 ||
+        keyaggCache.size != MUSIG_KEYAGG_CACHE_LENGTH || aggnonce.size != MUSIG_PUBNONCE_LENGTH ||
+        msg.size != MESSAGE_HASH_LENGTH) {
+        return fail("Cannot aggregate signatures");
+    }
+
+    uint8_t sig[SCHNORR_SIGNATURE_LENGTH];
+    if (!fast_crypto_musig_partial_sig_agg(partialSigs.data, partialSigs.size / MUSIG_PARTIAL_SIG_LENGTH,
+                                           keyaggCache.data, aggnonce.data, msg.data, sig)) {
+        return fail("Cannot aggregate signatures");
+    }
+    return copyResult(sig, sizeof(sig));
+}
+
+Result secp256k1KeyHandleCreate(Args &a) {
+    const Arg &key = a[0];
+    uint32_t handle = a[1].number == 0
+                      ? fast_crypto_secp256k1_pubkey_handle_create(key.data, key.size)
+                      : key.size == SECRET_KEY_LENGTH
+                      ? fast_crypto_secp256k1_privkey_handle_create(key.data)
+                      : 0;
+    return handle ? numberResult(handle) : fail("Invalid key");
+}
+
+Result secp256k1KeyHandlePublicKey(Args &a) {
+    uint32_t handle = fast_crypto_secp256k1_handle_pubkey(a[0].toHandle());
+    return handle ? numberResult(handle) : fail("Invalid private key handle");
+}
+
+Result secp256k1KeyHandleTweakAdd(Args &a) {
+    const Arg &tweak = a[1];
+    uint32_t handle = tweak.size == 32
+                      ? fast_crypto_secp256k1_handle_tweak_add(a[0].toHandle(), tweak.data)
+                      : 0;
+    return handle ? numberResult(handle) : fail("Invalid key handle or tweak");
+}
+
+Result secp256k1KeyHandleCombine(Args &a) {
+    std::vector<uint32_t> handles;
+    handles.reserve(a[0].list.size());
+    for (double item : a[0].list) {
+        Arg handle;
+        handle.number = item;
+        handles.push_back(handle.toHandle());
+    }
+
+    uint32_t handle = fast_crypto_secp256k1_handle_combine(handles.data(), handles.size());
+    return handle ? numberResult(handle) : fail("Invalid public key handles");
+}
+
+Result secp256k1KeyHandleSerialize(Args &a) {
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(DECOMPRESSED_PUBKEY_LENGTH);
+    size_t outLen = fast_crypto_secp256k1_handle_serialize(a[0].toHandle(), a[1].number != 0,
+                                                           out->data());
+    if (outLen == 0) return fail("Invalid key handle");
+    out->bytes.resize(outLen);
+    return bytesResult(std::move(out));
+}
+
+Result secp256k1KeyHandleRelease(Args &a) {
+    fast_crypto_secp256k1_handle_release(a[0].toHandle());
+    return Result();
+}
+
+Result multisigDeriveBatch(Args &a) {
+    const Arg &xpubs = a[0];
+    int m = a[1].toInt(), startIndex = a[2].toInt(), count = a[3].toInt();
+    int scriptType = a[4].toInt();
+    if (xpubs.size == 0 || xpubs.size % XPUB_LENGTH != 0 || m <= 0 || startIndex < 0 ||
+        count <= 0 || batchOverflows(count, 32)) {
+        return fail("Cannot derive multisig scripts");
+    }
+
+    size_t hashLen = scriptType == MULTISIG_P2WSH ? 32 : 20;
+    std::shared_ptr<Buffer> hashes = std::make_shared<Buffer>(count * hashLen);
+    if (fast_crypto_multisig_derive_batch(xpubs.data, xpubs.size / XPUB_LENGTH, m, startIndex,
+                                          count, scriptType, a[5].toThreads(),
+                                          hashes->data()) != (size_t) count) {
+        return fail("Cannot derive multisig scripts");
+    }
+    return bytesResult(std::move(hashes));
+}
+
+Result aes256CbcEncrypt(Args &a) {
+    const Arg &key = a[0], &iv = a[1], &data = a[2];
+    if (key.size != AES256_KEY_LENGTH || iv.size != AES_BLOCK_LENGTH) return fail("Cannot encrypt");
+
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(data.size + AES_BLOCK_LENGTH);
+    size_t outLen;
+    if (!fast_crypto_aes256_cbc_encrypt(key.data, iv.data, data.data, data.size, a[3].number != 0,
+                                        out->data(), &outLen)) {
+        return fail("Cannot encrypt");
+    }
+    out->bytes.resize(outLen);
+    return bytesResult(std::move(out));
+}
+
+Result aes256CbcDecrypt(Args &a) {
+    const Arg &key = a[0], &iv = a[1], &data = a[2];
+    if (key.size != AES256_KEY_LENGTH || iv.size != AES_BLOCK_LENGTH) return fail("Cannot decrypt");
+
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(data.size);
+    size_t outLen;
+    if (!fast_crypto_aes256_cbc_decrypt(key.data, iv.data, data.data, data.size, a[3].number != 0,
+                                        out->data(), &outLen)) {
+        return fail("Cannot decrypt");
+    }
+    out->bytes.resize(outLen);
+    return bytesResult(std::move(out));
+}
+
+Result aes256GcmEncrypt(Args &a) {
+    const Arg &key = a[0], &iv = a[1], &aad = a[2], &data = a[3];
+    if (key.size != AES256_KEY_LENGTH || iv.size != AES_GCM_IV_LENGTH) return fail("Cannot encrypt");
+
+    // The tag goes after the ciphertext:
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(data.size + AES_GCM_TAG_LENGTH);
+    fast_crypto_aes256_gcm_encrypt(key.data, iv.data, aad.data, aad.size,
+                                   data.data, data.size, out->data(), out->data() + data.size);
+    return bytesResult(std::move(out));
+}
+
+Result aes256GcmDecrypt(Args &a) {
+    const Arg &key = a[0], &iv = a[1], &aad = a[2], &data = a[3];
+    if (key.size != AES256_KEY_LENGTH || iv.size != AES_GCM_IV_LENGTH ||
+        data.size < AES_GCM_TAG_LENGTH) {
+        return fail("Cannot decrypt");
+    }
+
+    size_t length = data.size - AES_GCM_TAG_LENGTH;
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(length);
+    if (!fast_crypto_aes256_gcm_decrypt(key.data, iv.data, aad.data, aad.size,
+                                        data.data, length, data.data + length, out->data())) {
+        return fail("Cannot decrypt");
+    }
+    return bytesResult(std::move(out));
+}
+
+Result aesSetImplementation(Args &a) {
+    return boolResult(fast_crypto_aes_set_implementation(a[0].toInt()));
+}
+
+Result aesGetImplementation(Args &a) {
+    return numberResult(fast_crypto_aes_get_implementation());
+}
+
+Result chacha20Poly1305Encrypt(Args &a) {
+    const Arg &key = a[0], &nonce = a[1], &aad = a[2], &data = a[3];
+    if (key.size != CHACHA20_POLY1305_KEY_LENGTH) return fail("Cannot encrypt");
+
+    // The tag goes after the ciphertext:
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(data.size + CHACHA20_POLY1305_TAG_LENGTH);
+    if (!fast_crypto_chacha20_poly1305_encrypt(key.data, nonce.data, nonce.size, aad.data,
+                                               aad.size, data.data, data.size, out->data(),
+                                               out->data() + data.size)) {
+        return fail("Cannot encrypt");
+    }
+    return bytesResult(std::move(out));
+}
+
+Result chacha20Poly1305Decrypt(Args &a) {
+    const Arg &key = a[0], &nonce = a[1], &aad = a[2], &data = a[3];
+    if (key.size != CHACHA20_POLY1305_KEY_LENGTH || data.size < CHACHA20_POLY1305_TAG_LENGTH) {
+        return fail("Cannot decrypt");
+    }
+
+    size_t length = data.size - CHACHA20_POLY1305_TAG_LENGTH;
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(length);
+    if (!fast_crypto_chacha20_poly1305_decrypt(key.data, nonce.data, nonce.size, aad.data,
+                                               aad.size, data.data, length, data.data + length,
+                                               out->data())) {
+        return fail("Cannot decrypt");
+    }
+    return bytesResult(std::move(out));
+}
+
+Result chacha20Poly1305StreamCreate(Args &a) {
+    const Arg &key = a[0], &nonce = a[1], &aad = a[2];
+    if (key.size != CHACHA20_POLY1305_KEY_LENGTH) return fail("Cannot open stream");
+
+    uint32_t stream = fast_crypto_chacha20_poly1305_stream_create(key.data, nonce.data, nonce.size,
+                                                                  aad.data, aad.size,
+                                                                  a[3].number != 0);
+    return stream ? numberResult(stream) : fail("Cannot open stream");
+}
+
+Result chacha20Poly1305StreamUpdate(Args &a) {
+    const Arg &data = a[1];
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(data.size);
+    if (!fast_crypto_chacha20_poly1305_stream_update(a[0].toHandle(), data.data, data.size,
+                                                     out->data())) {
+        return fail("Invalid stream");
+    }
+    return bytesResult(std::move(out));
+}
+
+Result chacha20Poly1305StreamFinal(Args &a) {
+    // Decrypting streams check this tag, and encrypting streams replace it:
+    const Arg &tag = a[1];
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(CHACHA20_POLY1305_TAG_LENGTH);
+    if (tag.size != 0) {
+        memcpy(out->data(), tag.data, std::min<size_t>(tag.size, CHACHA20_POLY1305_TAG_LENGTH));
+    }
+    if (!fast_crypto_chacha20_poly1305_stream_final(a[0].toHandle(), out->data())) {
+        return fail("Invalid stream or tag");
+    }
+    return bytesResult(std::move(out));
+}
+
+Result chacha20Poly1305StreamRelease(Args &a) {
+    fast_crypto_chacha20_poly1305_stream_release(a[0].toHandle());
+    return Result();
+}
+
+Result chacha20SetImplementation(Args &a) {
+    return boolResult(fast_crypto_chacha20_set_implementation(a[0].toInt()));
+}
+
+Result chacha20GetImplementation(Args &a) {
+    return numberResult(fast_crypto_chacha20_get_implementation());
+}
+
+Result recordsDecryptBatch(Args &a) {
+    const Arg &key = a[0], &records = a[1];
+    std::vector<uint32_t> recordLens;
+    if (key.size != RECORD_KEY_LENGTH || !getPackedLens(records, a[2], recordLens)) {
+        return fail("Invalid record layout");
+    }
+
+    SecureBytes plaintexts(records.size);
+    std::vector<uint32_t> plaintextLens(recordLens.size());
+    SecureBytes statuses(recordLens.size());
+    fast_crypto_records_decrypt_batch(key.data, records.data, recordLens.data(), recordLens.size(),
+                                      a[3].toThreads(), plaintexts.data(), plaintextLens.data(),
+                                      statuses.data());
+    return packRecords(recordLens, plaintexts, plaintextLens, statuses);
+}
+
+Result recordsDecryptBatchScrypt(Args &a) {
+    const Arg &password = a[0], &salt = a[1], &records = a[5];
+    std::vector<uint32_t> recordLens;
+    if (!getPackedLens(records, a[6], recordLens)) return fail("Invalid record layout");
+
+    SecureBytes plaintexts(records.size);
+    std::vector<uint32_t> plaintextLens(recordLens.size());
+    SecureBytes statuses(recordLens.size());
+    fast_crypto_records_decrypt_batch_scrypt(password.data, password.size, salt.data, salt.size,
+                                             a[2].toInt(), a[3].toInt(), a[4].toInt(),
+                                             records.data, recordLens.data(), recordLens.size(),
+                                             a[7].toThreads(), plaintexts.data(),
+                                             plaintextLens.data(), statuses.data());
+    return packRecords(recordLens, plaintexts, plaintextLens, statuses);
+}
+
+Result ed25519PubkeyCreateBatch(Args &a) {
+    const Arg &privateKeys = a[0];
+    size_t count = a[1].toSize();
+    if (count == 0 || batchOverflows(count, ED25519_PRIVKEY_LENGTH) ||
+        privateKeys.size != count * ED25519_PRIVKEY_LENGTH) {
+        return fail("Invalid private key");
+    }
+
+    std::shared_ptr<Buffer> publicKeys = std::make_shared<Buffer>(count * ED25519_PUBKEY_LENGTH);
+    fast_crypto_ed25519_pubkey_create_batch(privateKeys.data, count, a[2].toThreads(),
+                                            publicKeys->data());
+    return bytesResult(std::move(publicKeys));
+}
+
+Result ed25519Sign(Args &a) {
+    const Arg &privateKey = a[0], &msg = a[1];
+    if (privateKey.size != ED25519_PRIVKEY_LENGTH) return fail("Invalid private key");
+
+    std::shared_ptr<Buffer> sig = std::make_shared<Buffer>(ED25519_SIGNATURE_LENGTH);
+    fast_crypto_ed25519_sign(privateKey.data, msg.data, msg.size, sig->data());
+    return bytesResult(std::move(sig));
+}
+
+Result ed25519VerifyBatch(Args &a) {
+    const Arg &sigs = a[0], &msgs = a[1], &publicKeys = a[3];
+    std::vector<uint32_t> msgLens;
+    if (!getPackedLens(msgs, a[2], msgLens)) return fail("Invalid batch layout");
+    size_t count = msgLens.size();
+    if (count == 0 || batchOverflows(count, ED25519_SIGNATURE_LENGTH) ||
+        sigs.size != count * ED25519_SIGNATURE_LENGTH ||
+        publicKeys.size != count * ED25519_PUBKEY_LENGTH) {
+        return fail("Invalid batch layout");
+    }
+
+    std::shared_ptr<Buffer> results = std::make_shared<Buffer>(count);
+    fast_crypto_ed25519_verify_batch(sigs.data, msgs.data, msgLens.data(), publicKeys.data,
+                                     count, a[4].toThreads(), results->data());
+    return bytesResult(std::move(results));
+}
+
+Result slip10Ed25519DeriveBatch(Args &a) {
+    const Arg &seed = a[0], &pathBytes = a[1], &pathLenBytes = a[2];
+    if (pathBytes.size % 4 != 0 || pathLenBytes.size % 4 != 0 || pathLenBytes.size == 0) {
+        return fail("Invalid derivation path");
+    }
+
+    // Both the indices and the path lengths are little-endian 32-bit words:
+    std::vector<uint32_t> paths(pathBytes.size / 4);
+    std::vector<uint32_t> pathLens(pathLenBytes.size / 4);
+    if (!paths.empty()) memcpy(paths.data(), pathBytes.data, pathBytes.size);
+    memcpy(pathLens.data(), pathLenBytes.data, pathLenBytes.size);
+    size_t left = paths.size();
+    for (size_t i = 0; i < pathLens.size(); ++i) {
+        if (pathLens[i] > left) return fail("Invalid derivation path");
+        left -= pathLens[i];
+    }
+    size_t count = pathLens.size();
+    if (left != 0 || batchOverflows(count, ED25519_PRIVKEY_LENGTH + ED25519_PUBKEY_LENGTH)) {
+        return fail("Invalid derivation path");
+    }
+
+    // The private keys come first, followed by the public keys:
+    std::shared_ptr<Buffer> keys =
+        std::make_shared<Buffer>(count * (ED25519_PRIVKEY_LENGTH + ED25519_PUBKEY_LENGTH));
+    size_t derived = fast_crypto_slip10_ed25519_derive_batch(seed.data, seed.size, paths.data(),
+                                                            pathLens.data(), count, a[3].toThreads(),
+                                                            keys->data(),
+                                                            keys->data() + count * ED25519_PRIVKEY_LENGTH);
+    return derived == count ? bytesResult(std::move(keys)) : fail("Invalid derivation path");
+}
+
+Result argon2id(Args &a) {
+    const Arg &password = a[0], &salt = a[1];
+    int size = a[6].toInt();
+    if (size <= 0) return fail("Invalid Argon2 parameters");
+
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(size);
+    if (!fast_crypto_argon2id(password.data, password.size, salt.data, salt.size,
+                              a[2].toInt(), a[3].toInt(), a[4].toInt(), a[5].toThreads(),
+                              out->data(), out->size())) {
+        return fail("Invalid Argon2 parameters");
+    }
+    return bytesResult(std::move(out));
+}
+
+Result argon2SetImplementation(Args &a) {
+    return boolResult(fast_crypto_argon2_set_implementation(a[0].toInt()));
+}
+
+Result argon2GetImplementation(Args &a) {
+    return numberResult(fast_crypto_argon2_get_implementation());
+}
+
+Result bip39MnemonicToSeedBatch(Args &a) {
+    const Arg &mnemonic = a[0], &passphrases = a[1], &wordlist = a[3];
+    std::vector<uint32_t> passphraseLens;
+    if (!getPackedLens(passphrases, a[2], passphraseLens)) return fail("Invalid passphrase layout");
+
+    // The statuses come first, followed by the seeds and the master keys:
+    size_t count = passphraseLens.size();
+    if (batchOverflows(count, 1 + BIP39_SEED_LENGTH + XPRV_LENGTH)) return fail("Invalid passphrase layout");
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(count * (1 + BIP39_SEED_LENGTH + XPRV_LENGTH));
+    fast_crypto_bip39_mnemonic_to_seed_batch(mnemonic.data, mnemonic.size, passphrases.data,
+                                             passphraseLens.data(), count,
+                                             wordlist.optional(), wordlist.size,
+                                             a[4].toThreads(), out->data() + count,
+                                             out->data() + count * (1 + BIP39_SEED_LENGTH),
+                                             out->data());
+    return bytesResult(std::move(out));
+}
+
+Result addressEncodeBatch(Args &a) {
+    const Arg &prefix = a[1], &payloads = a[3];
+    std::vector<uint32_t> payloadLens;
+    if (!getPackedLens(payloads, a[4], payloadLens)) return fail("Invalid payload layout");
+
+    size_t count = payloadLens.size();
+    if (batchOverflows(count, ADDRESS_MAX_LENGTH)) return fail("Invalid payload layout");
+    SecureChars addresses(count * ADDRESS_MAX_LENGTH);
+    fast_crypto_address_encode_batch(a[0].toInt(), prefix.data, prefix.size, a[2].toInt(),
+                                     payloads.data, payloadLens.data(), count, a[5].toThreads(),
+                                     addresses.data());
+
+    // Addresses are plain ASCII, so they go back as one newline-separated string:
+    std::string out;
+    out.reserve(count * 64);
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0) out += '\n';
+        out += &addresses[i * ADDRESS_MAX_LENGTH];
+    }
+    return textResult(std::move(out));
+}
+
+Result addressDecodeBatch(Args &a) {
+    const Arg &prefix = a[1];
+
+    // The addresses arrive as one newline-separated string:
+    std::string addresses = std::move(a[2].text);
+    std::vector<uint32_t> addressLens;
+    size_t start = 0;
+    for (size_t i = 0; i <= addresses.size(); ++i) {
+        if (i == addresses.size() || addresses[i] == '\n') {
+            addressLens.push_back(i - start);
+            start = i + 1;
+        }
+    }
+    addresses.erase(std::remove(addresses.begin(), addresses.end(), '\n'), addresses.end());
+
+    size_t count = addressLens.size();
+    if (batchOverflows(count, ADDRESS_PAYLOAD_MAX_LENGTH)) return fail("Invalid address layout");
+    SecureBytes payloads(count * ADDRESS_PAYLOAD_MAX_LENGTH);
+    std::vector<uint32_t> payloadLens(count);
+    std::vector<int32_t> versions(count);
+    fast_crypto_address_decode_batch(a[0].toInt(), prefix.data, prefix.size, addresses.data(),
+                                     addressLens.data(), count, a[3].toThreads(), payloads.data(),
+                                     payloadLens.data(), versions.data());
+
+    // Each address packs its version byte (0xff if it failed),
+    // its payload length byte, and its payload:
+    size_t size = 0;
+    for (size_t i = 0; i < count; ++i) size += 2 + payloadLens[i];
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(size);
+    uint8_t *item = out->data();
+    for (size_t i = 0; i < count; ++i) {
+        item[0] = versions[i] < 0 ? 0xff : versions[i];
+        item[1] = payloadLens[i];
+        if (payloadLens[i] != 0) {
+            memcpy(item + 2, &payloads[i * ADDRESS_PAYLOAD_MAX_LENGTH], payloadLens[i]);
+        }
+        item += 2 + payloadLens[i];
+    }
+    return bytesResult(std::move(out));
+}
+
+Result randomBytes(Args &a) {
+    if (a[0].number < 0) return fail("Cannot generate random bytes");
+
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(a[0].toSize());
+    if (!fast_crypto_random_bytes(out->data(), out->size())) {
+        return fail("Cannot generate random bytes");
+    }
+    return bytesResult(std::move(out));
+}
+
+Result keysGenerateBatch(Args &a) {
+    int keyType = a[0].toInt();
+    size_t publicKeyLen = keyType == KEYGEN_SECP256K1_COMPRESSED ? COMPRESSED_PUBKEY_LENGTH
+                          : keyType == KEYGEN_SECP256K1_UNCOMPRESSED ? DECOMPRESSED_PUBKEY_LENGTH
+                          : XONLY_PUBKEY_LENGTH;
+    size_t count = a[1].toSize();
+    if (count == 0 || batchOverflows(count, SECRET_KEY_LENGTH + publicKeyLen)) {
+        return fail("Cannot generate keys");
+    }
+
+    // The private keys come first, followed by the public keys:
+    std::shared_ptr<Buffer> keys = std::make_shared<Buffer>(count * (SECRET_KEY_LENGTH + publicKeyLen));
+    size_t generated = fast_crypto_keys_generate_batch(keyType, count, a[2].toThreads(), keys->data(),
+                                                       keys->data() + count * SECRET_KEY_LENGTH);
+    return generated == count ? bytesResult(std::move(keys)) : fail("Cannot generate keys");
+}
+
+Result poolConfigure(Args &a) {
+    std::vector<int> cpus;
+    cpus.reserve(a[3].list.size());
+    // Out-of-range CPU numbers become -1, which the pool rejects:
+    for (double item : a[3].list) {
+        cpus.push_back(item >= 0 && item <= 2147483647.0 ? (int) item : -1);
+    }
+    return boolResult(fast_crypto_pool_configure(a[0].toInt(), a[1].toThreads(), a[2].toSize(),
+                                                 cpus.data(), cpus.size()));
+}
+
+Result pipelineRun(Args &a) {
+    const Arg &steps = a[0], &inputs = a[1];
+    std::vector<uint32_t> inputLens;
+    if (steps.size % PIPELINE_STEP_LENGTH != 0 || !getPackedLens(inputs, a[2], inputLens)) {
+        return fail("Invalid pipeline layout");
+    }
+    size_t stepCount = steps.size / PIPELINE_STEP_LENGTH;
+    unsigned outputSlot = (unsigned) a[3].toSize();
+
+    // The status byte and little-endian 32-bit step index come first,
+    // followed by the output:
+    size_t outSize, outLen = 0, failedStep;
+    int status = fast_crypto_pipeline_check(steps.data, stepCount, inputLens.data(), inputLens.size(),
+                                            outputSlot, &outSize, &failedStep);
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(5 + (status == PIPELINE_OK ? outSize : 0));
+    if (status == PIPELINE_OK) {
+        status = fast_crypto_pipeline_run(steps.data, stepCount, inputs.data, inputLens.data(),
+                                          inputLens.size(), outputSlot, out->data() + 5, &outLen,
+                                          &failedStep);
+    }
+    uint32_t step = (uint32_t) failedStep;
+    out->bytes.resize(5 + outLen);
+    out->data()[0] = (uint8_t) status;
+    memcpy(out->data() + 1, &step, 4);
+    return bytesResult(std::move(out));
+}
+
+Result statsSnapshot(Args &a) {
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>(STATS_SNAPSHOT_LENGTH);
+    fast_crypto_stats_snapshot(out->data());
+    return bytesResult(std::move(out));
+}
+
+Result statsReset(Args &a) {
+    fast_crypto_reset_stats();
+    return Result();
+}
+
+Result traceStart(Args &a) {
+    return boolResult(fast_crypto_trace_start(a[0].toSize()));
+}
+
+Result traceStop(Args &a) {
+    // The first call stops the trace, so both calls see the same events:
+    std::vector<char> json(fast_crypto_trace_stop(NULL, 0) + 1);
+    size_t length = fast_crypto_trace_stop(json.data(), json.size());
+    return textResult(std::string(json.data(), std::min(length, json.size() - 1)));
+}
+
+/**
+ * Describes one method on the host object.
+ * Each character of `args` gives an argument type:
+ * b for bytes, n for a number, f for a boolean flag,
+ * s for a string, and l for a list of numbers.
+ * Async methods run on the worker pool and return a promise.
+ */
+struct Method {
+    const char *name;
+    const char *args;
+    bool async;
+    Result (*run)(Args &args);
+};
+
+const Method methods[] = {
+    {"scrypt", "bbnnnn", true, scrypt},
+    {"secp256k1EcPubkeyCreate", "bf", false, secp256k1EcPubkeyCreate},
+    {"secp256k1EcPrivkeyTweakAdd", "bb", false, secp256k1EcPrivkeyTweakAdd},
+    {"secp256k1EcPubkeyTweakAdd", "bbf", false, secp256k1EcPubkeyTweakAdd},
+    {"secp256k1EcPubkeyCreateBatch", "bnfn", true, secp256k1EcPubkeyCreateBatch},
+    {"secp256k1EcPrivkeyTweakAddBatch", "bbnn", true, secp256k1EcPrivkeyTweakAddBatch},
+    {"secp256k1EcdsaSign", "bbf", false, secp256k1EcdsaSign},
+    {"secp256k1EcdsaVerify", "bfbbf", false, secp256k1EcdsaVerify},
+    {"secp256k1EcdsaVerifyBatch", "bbbnfn", true, secp256k1EcdsaVerifyBatch},
+    {"secp256k1XonlyPubkeyCreateBatch", "bnn", true, secp256k1XonlyPubkeyCreateBatch},
+    {"secp256k1TaprootTweakPubkeyBatch", "bbnn", true, secp256k1TaprootTweakPubkeyBatch},
+    {"secp256k1TaprootTweakPrivkeyBatch", "bbnn", true, secp256k1TaprootTweakPrivkeyBatch},
+    {"secp256k1SchnorrSignBatch", "bbbnn", true, secp256k1SchnorrSignBatch},
+    {"secp256k1SchnorrVerifyBatch", "bbbnn", true, secp256k1SchnorrVerifyBatch},
+    {"secp256k1EcdsaSignRecoverableBatch", "bbnn", true, secp256k1EcdsaSignRecoverableBatch},
+    {"secp256k1EcdsaRecoverBatch", "bbnnn", true, secp256k1EcdsaRecoverBatch},
+    {"secp256k1Ecdh", "bb", false, secp256k1Ecdh},
+    {"silentPaymentsScan", "bbbbbbbn", true, silentPaymentsScan},
+    {"musigPubkeyAgg", "bf", false, musigPubkeyAgg},
+    {"musigPubkeyAggBatch", "bnnfn", true, musigPubkeyAggBatch},
+    {"musigPubkeyTweakAdd", "bbf", false, musigPubkeyTweakAdd},
+    {"musigNonceGen", "bbbbb", false, musigNonceGen},
+    {"musigNonceAgg", "b", false, musigNonceAgg},
+    {"musigPartialSign", "nbbbb", false, musigPartialSign},
+    {"musigNonceRelease", "n", false, musigNonceRelease},
+    {"musigPartialVerify", "bbbbbb", false, musigPartialVerify},
+    {"musigPartialSigAgg", "bbbb", false, musigPartialSigAgg},
+    {"secp256k1KeyHandleCreate", "bf", false, secp256k1KeyHandleCreate},
+    {"secp256k1KeyHandlePublicKey", "n", false, secp256k1KeyHandlePublicKey},
+    {"secp256k1KeyHandleTweakAdd", "nb", false, secp256k1KeyHandleTweakAdd},
+    {"secp256k1KeyHandleCombine", "l", false, secp256k1KeyHandleCombine},
+    {"secp256k1KeyHandleSerialize", "nf", false, secp256k1KeyHandleSerialize},
+    {"secp256k1KeyHandleRelease", "n", false, secp256k1KeyHandleRelease},
+    {"multisigDeriveBatch", "bnnnnn", true, multisigDeriveBatch},
+    {"aes256CbcEncrypt", "bbbf", false, aes256CbcEncrypt},
+    {"aes256CbcDecrypt", "bbbf", false, aes256CbcDecrypt},
+    {"aes256GcmEncrypt", "bbbb", false, aes256GcmEncrypt},
+    {"aes256GcmDecrypt", "bbbb", false, aes256GcmDecrypt},
+    {"aesSetImplementation", "n", false, aesSetImplementation},
+    {"aesGetImplementation", "", false, aesGetImplementation},
+    {"chacha20Poly1305Encrypt", "bbbb", false, chacha20Poly1305Encrypt},
+    {"chacha20Poly1305Decrypt", "bbbb", false, chacha20Poly1305Decrypt},
+    {"chacha20Poly1305StreamCreate", "bbbf", false, chacha20Poly1305StreamCreate},
+    {"chacha20Poly1305StreamUpdate", "nb", false, chacha20Poly1305StreamUpdate},
+    {"chacha20Poly1305StreamFinal", "nb", false, chacha20Poly1305StreamFinal},
+    {"chacha20Poly1305StreamRelease", "n", false, chacha20Poly1305StreamRelease},
+    {"chacha20SetImplementation", "n", false, chacha20SetImplementation},
+    {"chacha20GetImplementation", "", false, chacha20GetImplementation},
+    {"recordsDecryptBatch", "bbbn", true, recordsDecryptBatch},
+    {"recordsDecryptBatchScrypt", "bbnnnbbn", true, recordsDecryptBatchScrypt},
+    {"ed25519PubkeyCreateBatch", "bnn", true, ed25519PubkeyCreateBatch},
+    {"ed25519Sign", "bb", false, ed25519Sign},
+    {"ed25519VerifyBatch", "bbbbn", true, ed25519VerifyBatch},
+    {"slip10Ed25519DeriveBatch", "bbbn", true, slip10Ed25519DeriveBatch},
+    {"argon2id", "bbnnnnn", true, argon2id},
+    {"argon2SetImplementation", "n", false, argon2SetImplementation},
+    {"argon2GetImplementation", "", false, argon2GetImplementation},
+    {"bip39MnemonicToSeedBatch", "bbbbn", true, bip39MnemonicToSeedBatch},
+    {"addressEncodeBatch", "nbnbbn", true, addressEncodeBatch},
+    {"addressDecodeBatch", "nbsn", true, addressDecodeBatch},
+    {"randomBytes", "n", false, randomBytes},
+    {"keysGenerateBatch", "nnn", true, keysGenerateBatch},
+    {"poolConfigure", "nnnl", false, poolConfigure},
+    {"pipelineRun", "bbbn", true, pipelineRun},
+    {"statsSnapshot", "", false, statsSnapshot},
+    {"statsReset", "", false, statsReset},
+    {"traceStart", "n", false, traceStart},
+    {"traceStop", "", true, traceStop},
+};
+
+/**
+ * Finds the bytes behind an ArrayBuffer, typed array, or DataView.
+ * Missing optional buffers may also be null, undefined, or ''.
+ */
+bool readBytes(jsi::Runtime &rt, const jsi::Value &value, Arg &arg) {
+    if (value.isUndefined() || value.isNull()) return true;
+    if (value.isString()) return value.getString(rt).utf8(rt).empty();
+    if (!value.isObject()) return false;
+
+    jsi::Object object = value.getObject(rt);
+    if (object.isArrayBuffer(rt)) {
+        jsi::ArrayBuffer buffer = object.getArrayBuffer(rt);
+        arg.size = buffer.size(rt);
+        if (arg.size != 0) arg.data = buffer.data(rt);
+        return true;
+    }
+
+    // Typed arrays and DataViews are windows onto an ArrayBuffer:
+    jsi::Value inner = object.getProperty(rt, "buffer");
+    if (!inner.isObject() || !inner.getObject(rt).isArrayBuffer(rt)) return false;
+    jsi::ArrayBuffer buffer = inner.getObject(rt).getArrayBuffer(rt);
+    jsi::Value offset = object.getProperty(rt, "byteOffset");
+    jsi::Value length = object.getProperty(rt, "byteLength");
+    if (!offset.isNumber() || !length.isNumber()) return false;
+    double start = offset.getNumber(), size = length.getNumber();
+    if (!(start >= 0 && size >= 0 && start + size <= buffer.size(rt))) return false;
+
+    arg.size = (size_t) size;
+    if (arg.size != 0) arg.data = buffer.data(rt) + (size_t) start;
+    return true;
+}
+
+/**
+ * Converts the JavaScript arguments, checking their types.
+ * Async methods copy their bytes, since JavaScript is free to
+ * modify or collect its buffers once the call returns.
+ */
+void readArgs(jsi::Runtime &rt, const Method &method, const jsi::Value *values, size_t count,
+              Args &args) {
+    jsi::Value missing;
+    for (size_t i = 0; i < args.size(); ++i) {
+        const jsi::Value &value = i < count ? values[i] : missing;
+        Arg &arg = args[i];
+        bool valid;
+        switch (method.args[i]) {
+            case 'b':
+                valid = readBytes(rt, value, arg);
+                if (valid && method.async && arg.size != 0) {
+                    arg.copy.assign(arg.data, arg.data + arg.size);
+                    arg.data = arg.copy.data();
+                }
+                break;
+            case 'n':
+                valid = value.isNumber();
+                if (valid) arg.number = value.getNumber();
+                break;
+            case 'f':
+                valid = value.isBool();
+                if (valid) arg.number = value.getBool() ? 1 : 0;
+                break;
+            case 's':
+                valid = value.isString();
+                if (valid) arg.text = value.getString(rt).utf8(rt);
+                break;
+            case 'l':
+                valid = value.isObject() && value.getObject(rt).isArray(rt);
+                if (valid) {
+                    jsi::Array array = value.getObject(rt).getArray(rt);
+                    size_t length = array.size(rt);
+                    arg.list.reserve(length);
+                    for (size_t j = 0; valid && j < length; ++j) {
+                        jsi::Value item = array.getValueAtIndex(rt, j);
+                        valid = item.isNumber();
+                        if (valid) arg.list.push_back(item.getNumber());
+                    }
+                }
+                break;
+            default:
+                valid = false;
+        }
+        if (!valid) {
+            throw jsi::JSError(rt, std::string(method.name) + ": Invalid argument " +
+                               std::to_string(i + 1));
+        }
+    }
+}
+
+/**
+ * Turns a method result into a JavaScript value,
+ * or throws the method's error.
+ */
+jsi::Value toValue(jsi::Runtime &rt, Result &result) {
+    switch (result.kind) {
+        case Result::BYTES: return jsi::ArrayBuffer(rt, std::move(result.bytes));
+        case Result::NUMBER: return jsi::Value(result.number);
+        case Result::BOOLEAN: return jsi::Value(result.number != 0);
+        case Result::TEXT: return jsi::String::createFromUtf8(rt, result.text);
+        case Result::ERROR: throw jsi::JSError(rt, result.text);
+        default: return jsi::Value::undefined();
+    }
+}
+
+/**
+ * Runs a job queued by runAsync on a worker pool thread.
+ */
+void runJob(void *context) {
+    std::unique_ptr<std::function<void()>> job(static_cast<std::function<void()> *>(context));
+    (*job)();
+}
+
+/**
+ * Runs a method on the native worker pool, returning a promise for the result.
+ * The promise callbacks are only touched on the JavaScript thread.
+ */
+jsi::Value runAsync(jsi::Runtime &rt, const Invoker &invoker, const Method &method,
+                    std::shared_ptr<Args> args) {
+    jsi::Function promise = rt.global().getPropertyAsFunction(rt, "Promise");
+    return promise.callAsConstructor(rt, jsi::Function::createFromHostFunction(
+        rt, jsi::PropNameID::forAscii(rt, "executor"), 2,
+        [invoker, &method, args](jsi::Runtime &rt, const jsi::Value &, const jsi::Value *values,
+                                 size_t count) -> jsi::Value {
+            std::shared_ptr<jsi::Value> resolve = std::make_shared<jsi::Value>(rt, values[0]);
+            std::shared_ptr<jsi::Value> reject = std::make_shared<jsi::Value>(rt, values[1]);
+
+            auto run = [invoker, &rt, &method, args, resolve, reject]() mutable {
+                std::shared_ptr<Result> result = std::make_shared<Result>();
+                try {
+                    *result = method.run(*args);
+                } catch (const std::exception &e) {
+                    *result = fail(e.what());
+                }
+                args.reset();
+
+                // The last references to the callbacks must go away
+                // on the JavaScript thread, so move them over:
+                invoker([&rt, result, resolve = std::move(resolve),
+                         reject = std::move(reject)]() {
+                    if (result->kind == Result::ERROR) {
+                        reject->getObject(rt).getFunction(rt).call(
+                            rt, jsi::JSError(rt, result->text).value());
+                    } else {
+                        resolve->getObject(rt).getFunction(rt).call(rt, toValue(rt, *result));
+                    }
+                });
+            };
+            std::function<void()> *job = new std::function<void()>(std::move(run));
+            if (!fast_crypto_pool_submit(POOL_PRIORITY_BACKGROUND, runJob, job)) {
+                delete job;
+                values[1].getObject(rt).getFunction(rt).call(
+                    rt, jsi::JSError(rt, std::string(method.name) + ": Too many pending calls").value());
+            }
+            return jsi::Value::undefined();
+        }));
+}
+
+class FastCryptoHostObject : public jsi::HostObject {
+public:
+    explicit FastCryptoHostObject(Invoker invoker): invoker(std::move(invoker)) {}
+
+    jsi::Value get(jsi::Runtime &rt, const jsi::PropNameID &name) override {
+        std::string key = name.utf8(rt);
+        for (const Method &method : methods) {
+            if (key != method.name) continue;
+
+            Invoker invoker = this->invoker;
+            return jsi::Function::createFromHostFunction(
+                rt, name, strlen(method.args),
+                [invoker, &method](jsi::Runtime &rt, const jsi::Value &, const jsi::Value *values,
+                                   size_t count) -> jsi::Value {
+                    std::shared_ptr<Args> args = std::make_shared<Args>(strlen(method.args));
+                    readArgs(rt, method, values, count, *args);
+                    if (method.async) return runAsync(rt, invoker, method, std::move(args));
+
+                    Result result = method.run(*args);
+                    return toValue(rt, result);
+                });
+        }
+        return jsi::Value::undefined();
+    }
+
+    std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime &rt) override {
+        std::vector<jsi::PropNameID> names;
+        for (const Method &method : methods) {
+            names.push_back(jsi::PropNameID::forAscii(rt, method.name));
+        }
+        return names;
+    }
+
+private:
+    Invoker invoker;
+};
+
+} // namespace
+
+void installJsi(jsi::Runtime &runtime, Invoker invoker) {
+    runtime.global().setProperty(
+        runtime, "__fastCryptoJsi",
+        jsi::Object::createFromHostObject(
+            runtime, std::make_shared<FastCryptoHostObject>(std::move(invoker))));
+}
+
+} // namespace fastcrypto
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2014, Airbitz, Inc.
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+/**
+ * @file
+ * JSI bindings for native-crypto.h, which pass bytes as ArrayBuffers
+ * instead of base64 strings over the React Native bridge.
+ */
+
+#ifndef fast_crypto_jsi_bindings_h
+#define fast_crypto_jsi_bindings_h
+
+#include <jsi/jsi.h>
+
+#include <functional>
+
+namespace fastcrypto {
+
+/**
+ * Schedules a callback to run on the JavaScript thread.
+ * Each platform builds one on top of its React Native CallInvoker.
+ */
+typedef std::function<void(std::function<void()>)> Invoker;
+
+/**
+ * Installs the bindings as `global.__fastCryptoJsi`.
+ * Must run on the JavaScript thread.
+ *
+ * The methods take the same arguments as the RNFastCrypto bridge module,
+ * except that bytes are ArrayBuffers or typed arrays instead of base64
+ * (or hex) strings, and come back as ArrayBuffers.
+ * Quick methods return their results directly, while slow ones
+ * (key stretching and batches) run on the native worker pool and return promises.
+ */
+void installJsi(facebook::jsi::Runtime &runtime, Invoker invoker);
+
+} // namespace fastcrypto
+
+#endif // fast_crypto_jsi_bindings_h
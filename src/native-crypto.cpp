@@ -6,131 +6,230 @@
  */
 
 #include "native-crypto.h"
+#include "secure-memory.h"
 extern "C" {
+#include "arena/arena.h"
+#include "argon2/argon2.h"
+#include "bip39/bip39.h"
+#include "bip39/nfkd.h"
+#include "cipher/aes.h"
+#include "cipher/chacha20poly1305.h"
+#include "curve/ed25519.h"
+#include "encoding/base58.h"
+#include "encoding/bech32.h"
+#include "encoding/codec.h"
+#include "hash/keccak.h"
+#include "hash/ripemd160.h"
+#include "hash/sha512.h"
+#include "pool/pool.h"
+#include "random/drbg.h"
 #include "scrypt/crypto_scrypt.h"
+#include "scrypt/sha256.h"
+#include "stats/stats.h"
 }
 
 #include <math.h>
 #include <secp256k1.h>
+#include <secp256k1_ecdh.h>
+#include <secp256k1_extrakeys.h>
+#include <secp256k1_musig.h>
+#include <secp256k1_recovery.h>
+#include <secp256k1_schnorrsig.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-void fast_crypto_scrypt (const uint8_t *passwd, size_t passwdlen, const uint8_t *salt, size_t saltlen, uint64_t N,
-    uint32_t r, uint32_t p, uint8_t *buf, size_t buflen)
-{
-    crypto_scrypt(passwd, passwdlen, salt, saltlen, N, r, p, buf, buflen);
-}
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
-void bytesToHex(uint8_t * in, int inlen, char * out)
-{
-    uint8_t * pin = in;
-    const char * hex = "0123456789abcdef";
-    char * pout = out;
-    for(; pin < in+inlen; pout +=2, pin++){
-        pout[0] = hex[(*pin>>4) & 0xF];
-        pout[1] = hex[ *pin     & 0xF];
+#if FAST_CRYPTO_STATS
+/**
+ * Times a call for fast_crypto_get_stats, from here to the end of the
+ * scope. Only the outermost scope on a thread counts, so calls made
+ * inside other calls, including on parallelFor's threads, do not.
+ */
+class StatsScope {
+public:
+    StatsScope(int op, uint64_t bytes): op(op), bytes(bytes)
+    {
+        if (depth++ == 0) start = Stats_Now();
     }
-    pout[0] = 0;
-}
+    ~StatsScope()
+    {
+        if (--depth == 0 && op >= 0) Stats_Record(op, bytes, start, Stats_Now());
+    }
+
+private:
+    static thread_local unsigned depth;
+    const int op;
+    const uint64_t bytes;
+    uint64_t start = 0;
+};
 
-bool hexToBytes(const char * string, uint8_t *outBytes) {
-    uint8_t *data = outBytes;
+thread_local unsigned StatsScope::depth = 0;
 
-    if(string == NULL)
-       return false;
+/**
+ * Adds up a list of lengths, for the bytes a batch processed.
+ */
+static uint64_t statsTotal(const uint32_t *lens, size_t count)
+{
+    uint64_t total = 0;
+    for (size_t i = 0; i < count; ++i) total += lens[i];
+    return total;
+}
 
-    size_t slength = strlen(string);
-    if(slength % 2 != 0) // must be even
-       return false;
+#define STATS_SCOPE(op, bytes) StatsScope statsScope((op), (bytes))
+#define STATS_NESTED() StatsScope statsScope(-1, 0)
+#else
+// Without FAST_CRYPTO_STATS, the instrumentation compiles away:
+#define STATS_SCOPE(op, bytes) ((void) 0)
+#define STATS_NESTED() ((void) 0)
+#endif
 
-    size_t dlength = slength / 2;
+int fast_crypto_scrypt(const uint8_t *passwd, size_t passwdlen, const uint8_t *salt, size_t saltlen, uint64_t N,
+    uint32_t r, uint32_t p, uint8_t *buf, size_t buflen)
+{
+    STATS_SCOPE(STATS_SCRYPT, buflen);
+    return crypto_scrypt(passwd, passwdlen, salt, saltlen, N, r, p, buf, buflen) == 0;
+}
 
-    memset(data, 0, dlength);
+/**
+ * Decodes a NUL-terminated hex string into at most `outSize` bytes,
+ * zeroing whatever the string does not fill.
+ */
+static bool hexToBytes(const char *string, uint8_t *out, size_t outSize)
+{
+    if (string == NULL) return false;
 
-    size_t index = 0;
-    while (index < slength) {
-        char c = string[index];
-        int value = 0;
-        if(c >= '0' && c <= '9')
-            value = (c - '0');
-        else if (c >= 'A' && c <= 'F')
-            value = (10 + (c - 'A'));
-        else if (c >= 'a' && c <= 'f')
-             value = (10 + (c - 'a'));
-        else
-            return false;
+    size_t length = strlen(string);
+    if (length / 2 > outSize) return false;
+    memset(out, 0, outSize);
+    return Hex_Decode(string, length, out, NULL) == 0;
+}
 
-        data[(index/2)] += value << (((index + 1) % 2) * 4);
+/**
+ * Returns the shared secp256k1 context, creating it on first use.
+ * The context is never modified after creation,
+ * so it is safe to use from multiple threads at once.
+ */
+static secp256k1_context *getSecp256k1Context()
+{
+    static secp256k1_context *ctx = secp256k1_context_create(SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY);
+    return ctx;
+}
 
-        index++;
+/**
+ * Calls `task(i)` for each i in [0, count), spread across worker threads.
+ * A `threads` value of 0 uses one thread per CPU core.
+ */
+template<typename Task>
+static void parallelFor(size_t count, unsigned threads, Task task)
+{
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    if (threads > count) threads = count;
+    if (threads <= 1) {
+        for (size_t i = 0; i < count; ++i) task(i);
+        return;
     }
 
-    return true;
+    // Hand out small chunks, so fast threads can pick up the slack:
+    const size_t chunk = std::max<size_t>(1, count / (threads * 8));
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        STATS_NESTED();
+        for (size_t start = next.fetch_add(chunk); start < count; start = next.fetch_add(chunk)) {
+            size_t end = std::min(count, start + chunk);
+            for (size_t i = start; i < end; ++i) task(i);
+        }
+    };
+
+    // If the system runs out of threads, the ones we have
+    // share out the remaining chunks between them:
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned i = 1; i < threads; ++i) {
+        try {
+            pool.emplace_back(worker);
+        } catch (const std::system_error &) {
+            break;
+        }
+    }
+    worker();
+    for (auto &thread : pool) thread.join();
 }
 
-secp256k1_context *secp256k1ctx = NULL;
+/**
+ * Zeroes a secret on the stack. Calling memset through a volatile pointer
+ * stops the compiler from dropping the store to a dying buffer.
+ */
+static void wipeStack(void *buffer, size_t size)
+{
+    void *(*volatile wipe)(void *, int, size_t) = memset;
+    wipe(buffer, 0, size);
+}
 
 // Must pass a privateKey of length 64 bytes
 void fast_crypto_secp256k1_ec_pubkey_create(const char *szPrivateKeyHex, char *szPublicKeyHex, int compressed)
 {
-    if (secp256k1ctx == NULL) {
-        secp256k1ctx = secp256k1_context_create(SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY);
-    }
+    STATS_SCOPE(STATS_SECP256K1_KEYS, SECRET_KEY_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
 
     int flags = compressed ? SECP256K1_EC_COMPRESSED : SECP256K1_EC_UNCOMPRESSED;
     uint8_t privateKey[PRIVKEY_LENGTH];
     szPublicKeyHex[0] = 0;
 
-    bool success = hexToBytes(szPrivateKeyHex, privateKey);
-    if (!success) {
-        return;
-    }
-
     secp256k1_pubkey public_key;
-    if (secp256k1_ec_pubkey_create(secp256k1ctx, &public_key, privateKey) == 0) {
+    bool success = hexToBytes(szPrivateKeyHex, privateKey, sizeof(privateKey)) &&
+        secp256k1_ec_pubkey_create(secp256k1ctx, &public_key, privateKey) != 0;
+    wipeStack(privateKey, sizeof(privateKey));
+    if (!success) {
         return;
     }
 
     unsigned char output[DECOMPRESSED_PUBKEY_LENGTH];
     size_t output_length = DECOMPRESSED_PUBKEY_LENGTH;
     secp256k1_ec_pubkey_serialize(secp256k1ctx, &output[0], &output_length, &public_key, flags);
-    bytesToHex(output, output_length, szPublicKeyHex);
+    fast_crypto_hex_encode(output, output_length, szPublicKeyHex);
 }
 
 // secp256k1_pubkey public_key;
 
 void fast_crypto_secp256k1_ec_privkey_tweak_add(char *szPrivateKeyHex, const char *szTweak) {
-    if (secp256k1ctx == NULL) {
-        secp256k1ctx = secp256k1_context_create(SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY);
-    }
+    STATS_SCOPE(STATS_SECP256K1_KEYS, SECRET_KEY_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
 
     int privateKeyLen = strlen(szPrivateKeyHex) / 2;
     unsigned char privateKey[DECOMPRESSED_PUBKEY_LENGTH];
     unsigned char tweak[DECOMPRESSED_PUBKEY_LENGTH];
 
-    bool success = hexToBytes(szPrivateKeyHex, privateKey);
-    if (!success) {
-        return;
-    }
-    success = hexToBytes(szTweak, tweak);
-    if (!success) {
-        return;
-    }
-    if (secp256k1_ec_privkey_tweak_add(secp256k1ctx, privateKey, (unsigned char *) tweak) == 1) {
-        bytesToHex((uint8_t *)privateKey, privateKeyLen, szPrivateKeyHex);
+    bool success = hexToBytes(szPrivateKeyHex, privateKey, sizeof(privateKey)) &&
+        hexToBytes(szTweak, tweak, sizeof(tweak)) &&
+        secp256k1_ec_privkey_tweak_add(secp256k1ctx, privateKey, (unsigned char *) tweak) == 1;
+    if (success) {
+        fast_crypto_hex_encode(privateKey, privateKeyLen, szPrivateKeyHex);
     }
+    wipeStack(privateKey, sizeof(privateKey));
+    wipeStack(tweak, sizeof(tweak));
 }
 
 void fast_crypto_secp256k1_ec_pubkey_tweak_add(char *szPublicKeyHex, const char *szTweak, int compressed) {
+    STATS_SCOPE(STATS_SECP256K1_KEYS, COMPRESSED_PUBKEY_LENGTH);
     if (compressed != 1) {
         szPublicKeyHex[0] = 0;
         return;
     }
 
-    if (secp256k1ctx == NULL) {
-        secp256k1ctx = secp256k1_context_create(SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY);
-    }
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
 
     int flags = compressed ? SECP256K1_EC_COMPRESSED : SECP256K1_EC_UNCOMPRESSED;
     int publicKeyLen = compressed ? COMPRESSED_PUBKEY_LENGTH : DECOMPRESSED_PUBKEY_LENGTH;
@@ -138,13 +237,13 @@ void fast_crypto_secp256k1_ec_pubkey_tweak_add(char *szPublicKeyHex, const char
     unsigned char publicKey[DECOMPRESSED_PUBKEY_LENGTH];
     unsigned char tweak[DECOMPRESSED_PUBKEY_LENGTH];
 
-    bool success = hexToBytes(szPublicKeyHex, publicKey);
+    bool success = hexToBytes(szPublicKeyHex, publicKey, sizeof(publicKey));
     if (!success) {
         szPublicKeyHex[0] = 0;
         return;
     }
 
-    success = hexToBytes(szTweak, tweak);
+    success = hexToBytes(szTweak, tweak, sizeof(tweak));
     if (!success) {
         szPublicKeyHex[0] = 0;
         return;
@@ -164,5 +263,2650 @@ void fast_crypto_secp256k1_ec_pubkey_tweak_add(char *szPublicKeyHex, const char
     unsigned char output[DECOMPRESSED_PUBKEY_LENGTH];
     size_t output_length = DECOMPRESSED_PUBKEY_LENGTH;
     secp256k1_ec_pubkey_serialize(secp256k1ctx, &output[0], &output_length, &public_key, flags);
-    bytesToHex((uint8_t *)output, output_length, szPublicKeyHex);
+    fast_crypto_hex_encode(output, output_length, szPublicKeyHex);
+}
+
+size_t fast_crypto_secp256k1_pubkey_create(const uint8_t *privateKey, int compressed,
+    uint8_t *publicKey)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, SECRET_KEY_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_pubkey public_key;
+    if (secp256k1_ec_pubkey_create(secp256k1ctx, &public_key, privateKey) == 0) {
+        return 0;
+    }
+
+    size_t publicKeyLen = compressed ? COMPRESSED_PUBKEY_LENGTH : DECOMPRESSED_PUBKEY_LENGTH;
+    secp256k1_ec_pubkey_serialize(secp256k1ctx, publicKey, &publicKeyLen, &public_key,
+        compressed ? SECP256K1_EC_COMPRESSED : SECP256K1_EC_UNCOMPRESSED);
+    return publicKeyLen;
+}
+
+size_t fast_crypto_secp256k1_pubkey_create_batch(const uint8_t *privateKeys, size_t count,
+    int compressed, unsigned threads, uint8_t *publicKeys, uint8_t *results)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, count * SECRET_KEY_LENGTH);
+    const size_t publicKeyLen = compressed ? COMPRESSED_PUBKEY_LENGTH : DECOMPRESSED_PUBKEY_LENGTH;
+    parallelFor(count, threads, [&](size_t i) {
+        uint8_t *publicKey = publicKeys + i * publicKeyLen;
+        results[i] = fast_crypto_secp256k1_pubkey_create(privateKeys + i * SECRET_KEY_LENGTH,
+            compressed, publicKey) != 0;
+        if (!results[i]) memset(publicKey, 0, publicKeyLen);
+    });
+
+    size_t created = 0;
+    for (size_t i = 0; i < count; ++i) created += results[i];
+    return created;
+}
+
+int fast_crypto_secp256k1_privkey_tweak_add(const uint8_t *privateKey, const uint8_t *tweak,
+    uint8_t *out)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, SECRET_KEY_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    uint8_t result[SECRET_KEY_LENGTH];
+    memcpy(result, privateKey, SECRET_KEY_LENGTH);
+    int success = secp256k1_ec_seckey_tweak_add(secp256k1ctx, result, tweak);
+    if (success) memcpy(out, result, SECRET_KEY_LENGTH);
+    memset(result, 0, sizeof(result));
+    return success;
+}
+
+size_t fast_crypto_secp256k1_privkey_tweak_add_batch(const uint8_t *privateKeys,
+    const uint8_t *tweaks, size_t count, unsigned threads, uint8_t *out, uint8_t *results)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, count * SECRET_KEY_LENGTH);
+    parallelFor(count, threads, [&](size_t i) {
+        uint8_t *tweaked = out + i * SECRET_KEY_LENGTH;
+        results[i] = fast_crypto_secp256k1_privkey_tweak_add(privateKeys + i * SECRET_KEY_LENGTH,
+            tweaks + i * SECRET_KEY_LENGTH, tweaked);
+        if (!results[i]) memset(tweaked, 0, SECRET_KEY_LENGTH);
+    });
+
+    size_t tweaked = 0;
+    for (size_t i = 0; i < count; ++i) tweaked += results[i];
+    return tweaked;
+}
+
+size_t fast_crypto_secp256k1_pubkey_tweak_add(const uint8_t *publicKey, size_t publicKeyLen,
+    const uint8_t *tweak, int compressed, uint8_t *out)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, publicKeyLen);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_pubkey public_key;
+    if (secp256k1_ec_pubkey_parse(secp256k1ctx, &public_key, publicKey, publicKeyLen) == 0 ||
+        secp256k1_ec_pubkey_tweak_add(secp256k1ctx, &public_key, tweak) == 0) {
+        return 0;
+    }
+
+    size_t outLen = compressed ? COMPRESSED_PUBKEY_LENGTH : DECOMPRESSED_PUBKEY_LENGTH;
+    secp256k1_ec_pubkey_serialize(secp256k1ctx, out, &outLen, &public_key,
+        compressed ? SECP256K1_EC_COMPRESSED : SECP256K1_EC_UNCOMPRESSED);
+    return outLen;
+}
+
+int fast_crypto_secp256k1_ecdsa_sign(const uint8_t *privateKey, const uint8_t *msgHash,
+    uint8_t *sig, size_t *sigLen, int der)
+{
+    STATS_SCOPE(STATS_ECDSA, MESSAGE_HASH_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    // libsecp256k1 always produces low-S signatures:
+    secp256k1_ecdsa_signature signature;
+    if (secp256k1_ecdsa_sign(secp256k1ctx, &signature, msgHash, privateKey, NULL, NULL) == 0) {
+        *sigLen = 0;
+        return 0;
+    }
+
+    if (der) {
+        *sigLen = ECDSA_DER_SIGNATURE_MAX_LENGTH;
+        return secp256k1_ecdsa_signature_serialize_der(secp256k1ctx, sig, sigLen, &signature);
+    }
+    *sigLen = ECDSA_COMPACT_SIGNATURE_LENGTH;
+    return secp256k1_ecdsa_signature_serialize_compact(secp256k1ctx, sig, &signature);
+}
+
+static int ecdsaVerifyParsed(secp256k1_context *secp256k1ctx, secp256k1_ecdsa_signature *signature,
+    const uint8_t *msgHash, const uint8_t *publicKey, size_t publicKeyLen, int strict)
+{
+    secp256k1_pubkey public_key;
+    if (secp256k1_ec_pubkey_parse(secp256k1ctx, &public_key, publicKey, publicKeyLen) == 0) {
+        return 0;
+    }
+
+    if (!strict) {
+        secp256k1_ecdsa_signature_normalize(secp256k1ctx, signature, signature);
+    }
+    return secp256k1_ecdsa_verify(secp256k1ctx, signature, msgHash, &public_key);
+}
+
+int fast_crypto_secp256k1_ecdsa_verify(const uint8_t *sig, size_t sigLen, int der,
+    const uint8_t *msgHash, const uint8_t *publicKey, size_t publicKeyLen, int strict)
+{
+    STATS_SCOPE(STATS_ECDSA, MESSAGE_HASH_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_ecdsa_signature signature;
+    int parsed = der ?
+        secp256k1_ecdsa_signature_parse_der(secp256k1ctx, &signature, sig, sigLen) :
+        sigLen == ECDSA_COMPACT_SIGNATURE_LENGTH &&
+            secp256k1_ecdsa_signature_parse_compact(secp256k1ctx, &signature, sig);
+    if (!parsed) {
+        return 0;
+    }
+
+    return ecdsaVerifyParsed(secp256k1ctx, &signature, msgHash, publicKey, publicKeyLen, strict);
+}
+
+size_t fast_crypto_secp256k1_ecdsa_verify_batch(const uint8_t *sigs, const uint8_t *msgHashes,
+    const uint8_t *publicKeys, size_t publicKeyLen, size_t count, int strict,
+    unsigned threads, uint8_t *results)
+{
+    STATS_SCOPE(STATS_ECDSA, count * MESSAGE_HASH_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    parallelFor(count, threads, [&](size_t i) {
+        secp256k1_ecdsa_signature signature;
+        results[i] =
+            secp256k1_ecdsa_signature_parse_compact(secp256k1ctx, &signature,
+                sigs + i * ECDSA_COMPACT_SIGNATURE_LENGTH) &&
+            ecdsaVerifyParsed(secp256k1ctx, &signature, msgHashes + i * MESSAGE_HASH_LENGTH,
+                publicKeys + i * publicKeyLen, publicKeyLen, strict);
+    });
+
+    size_t valid = 0;
+    for (size_t i = 0; i < count; ++i) valid += results[i];
+    return valid;
+}
+
+int fast_crypto_secp256k1_xonly_pubkey_create(const uint8_t *privateKey, uint8_t *xonlyPublicKey)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, SECRET_KEY_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_keypair keypair;
+    secp256k1_xonly_pubkey public_key;
+    int success =
+        secp256k1_keypair_create(secp256k1ctx, &keypair, privateKey) &&
+        secp256k1_keypair_xonly_pub(secp256k1ctx, &public_key, NULL, &keypair) &&
+        secp256k1_xonly_pubkey_serialize(secp256k1ctx, xonlyPublicKey, &public_key);
+    memset(&keypair, 0, sizeof(keypair));
+    return success;
+}
+
+size_t fast_crypto_secp256k1_xonly_pubkey_create_batch(const uint8_t *privateKeys, size_t count,
+    unsigned threads, uint8_t *xonlyPublicKeys)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, count * SECRET_KEY_LENGTH);
+    std::atomic<size_t> created(0);
+    parallelFor(count, threads, [&](size_t i) {
+        created += fast_crypto_secp256k1_xonly_pubkey_create(privateKeys + i * SECRET_KEY_LENGTH,
+            xonlyPublicKeys + i * XONLY_PUBKEY_LENGTH);
+    });
+    return created;
+}
+
+/**
+ * Computes the BIP341 TapTweak hash for an x-only internal key.
+ */
+static void taprootTweakHash(secp256k1_context *secp256k1ctx, const uint8_t *internalKey,
+    const uint8_t *merkleRoot, uint8_t *tweak)
+{
+    static const char tag[] = "TapTweak";
+    uint8_t data[2 * XONLY_PUBKEY_LENGTH];
+    memcpy(data, internalKey, XONLY_PUBKEY_LENGTH);
+    if (merkleRoot != NULL) memcpy(data + XONLY_PUBKEY_LENGTH, merkleRoot, 32);
+
+    secp256k1_tagged_sha256(secp256k1ctx, tweak, (const uint8_t *)tag, sizeof(tag) - 1,
+        data, merkleRoot != NULL ? sizeof(data) : XONLY_PUBKEY_LENGTH);
+}
+
+int fast_crypto_secp256k1_taproot_tweak_pubkey(const uint8_t *internalKey, const uint8_t *merkleRoot,
+    uint8_t *outputKey, int *parity)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, XONLY_PUBKEY_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_xonly_pubkey internal_key;
+    if (secp256k1_xonly_pubkey_parse(secp256k1ctx, &internal_key, internalKey) == 0) {
+        return 0;
+    }
+
+    uint8_t tweak[32];
+    taprootTweakHash(secp256k1ctx, internalKey, merkleRoot, tweak);
+
+    secp256k1_pubkey output_key;
+    secp256k1_xonly_pubkey output_xonly;
+    return
+        secp256k1_xonly_pubkey_tweak_add(secp256k1ctx, &output_key, &internal_key, tweak) &&
+        secp256k1_xonly_pubkey_from_pubkey(secp256k1ctx, &output_xonly, parity, &output_key) &&
+        secp256k1_xonly_pubkey_serialize(secp256k1ctx, outputKey, &output_xonly);
+}
+
+size_t fast_crypto_secp256k1_taproot_tweak_pubkey_batch(const uint8_t *internalKeys,
+    const uint8_t *merkleRoots, size_t count, unsigned threads,
+    uint8_t *outputKeys, uint8_t *parities)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, count * XONLY_PUBKEY_LENGTH);
+    std::atomic<size_t> tweaked(0);
+    parallelFor(count, threads, [&](size_t i) {
+        int parity = 0;
+        tweaked += fast_crypto_secp256k1_taproot_tweak_pubkey(internalKeys + i * XONLY_PUBKEY_LENGTH,
+            merkleRoots != NULL ? merkleRoots + i * 32 : NULL,
+            outputKeys + i * XONLY_PUBKEY_LENGTH, &parity);
+        if (parities != NULL) parities[i] = parity;
+    });
+    return tweaked;
+}
+
+int fast_crypto_secp256k1_taproot_tweak_privkey(const uint8_t *privateKey, const uint8_t *merkleRoot,
+    uint8_t *tweakedPrivateKey)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, SECRET_KEY_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_keypair keypair;
+    secp256k1_xonly_pubkey internal_key;
+    uint8_t internalKey[XONLY_PUBKEY_LENGTH];
+    uint8_t tweak[32];
+    int success =
+        secp256k1_keypair_create(secp256k1ctx, &keypair, privateKey) &&
+        secp256k1_keypair_xonly_pub(secp256k1ctx, &internal_key, NULL, &keypair) &&
+        secp256k1_xonly_pubkey_serialize(secp256k1ctx, internalKey, &internal_key);
+    if (success) {
+        taprootTweakHash(secp256k1ctx, internalKey, merkleRoot, tweak);
+        success =
+            secp256k1_keypair_xonly_tweak_add(secp256k1ctx, &keypair, tweak) &&
+            secp256k1_keypair_sec(secp256k1ctx, tweakedPrivateKey, &keypair);
+    }
+    memset(&keypair, 0, sizeof(keypair));
+    return success;
+}
+
+size_t fast_crypto_secp256k1_taproot_tweak_privkey_batch(const uint8_t *privateKeys,
+    const uint8_t *merkleRoots, size_t count, unsigned threads, uint8_t *tweakedPrivateKeys)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, count * SECRET_KEY_LENGTH);
+    std::atomic<size_t> tweaked(0);
+    parallelFor(count, threads, [&](size_t i) {
+        tweaked += fast_crypto_secp256k1_taproot_tweak_privkey(privateKeys + i * SECRET_KEY_LENGTH,
+            merkleRoots != NULL ? merkleRoots + i * 32 : NULL,
+            tweakedPrivateKeys + i * SECRET_KEY_LENGTH);
+    });
+    return tweaked;
+}
+
+int fast_crypto_secp256k1_schnorr_sign(const uint8_t *privateKey, const uint8_t *msg,
+    const uint8_t *auxRand, uint8_t *sig)
+{
+    STATS_SCOPE(STATS_SCHNORR, MESSAGE_HASH_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_keypair keypair;
+    int success =
+        secp256k1_keypair_create(secp256k1ctx, &keypair, privateKey) &&
+        secp256k1_schnorrsig_sign32(secp256k1ctx, sig, msg, &keypair, auxRand);
+    memset(&keypair, 0, sizeof(keypair));
+    return success;
+}
+
+size_t fast_crypto_secp256k1_schnorr_sign_batch(const uint8_t *privateKeys, const uint8_t *msgs,
+    const uint8_t *auxRands, size_t count, unsigned threads, uint8_t *sigs)
+{
+    STATS_SCOPE(STATS_SCHNORR, count * MESSAGE_HASH_LENGTH);
+    std::atomic<size_t> signed_count(0);
+    parallelFor(count, threads, [&](size_t i) {
+        signed_count += fast_crypto_secp256k1_schnorr_sign(privateKeys + i * SECRET_KEY_LENGTH,
+            msgs + i * MESSAGE_HASH_LENGTH,
+            auxRands != NULL ? auxRands + i * 32 : NULL,
+            sigs + i * SCHNORR_SIGNATURE_LENGTH);
+    });
+    return signed_count;
+}
+
+int fast_crypto_secp256k1_schnorr_verify(const uint8_t *sig, const uint8_t *msg,
+    const uint8_t *xonlyPublicKey)
+{
+    STATS_SCOPE(STATS_SCHNORR, MESSAGE_HASH_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_xonly_pubkey public_key;
+    return
+        secp256k1_xonly_pubkey_parse(secp256k1ctx, &public_key, xonlyPublicKey) &&
+        secp256k1_schnorrsig_verify(secp256k1ctx, sig, msg, MESSAGE_HASH_LENGTH, &public_key);
+}
+
+size_t fast_crypto_secp256k1_schnorr_verify_batch(const uint8_t *sigs, const uint8_t *msgs,
+    const uint8_t *xonlyPublicKeys, size_t count, unsigned threads, uint8_t *results)
+{
+    STATS_SCOPE(STATS_SCHNORR, count * MESSAGE_HASH_LENGTH);
+    parallelFor(count, threads, [&](size_t i) {
+        results[i] = fast_crypto_secp256k1_schnorr_verify(sigs + i * SCHNORR_SIGNATURE_LENGTH,
+            msgs + i * MESSAGE_HASH_LENGTH, xonlyPublicKeys + i * XONLY_PUBKEY_LENGTH);
+    });
+
+    size_t valid = 0;
+    for (size_t i = 0; i < count; ++i) valid += results[i];
+    return valid;
+}
+
+void fast_crypto_keccak256(const uint8_t *data, size_t dataLen, uint8_t *hash)
+{
+    KECCAK256(data, dataLen, hash);
+}
+
+int fast_crypto_secp256k1_ecdsa_sign_recoverable(const uint8_t *privateKey, const uint8_t *msgHash,
+    uint8_t *sig)
+{
+    STATS_SCOPE(STATS_ECDSA, MESSAGE_HASH_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_ecdsa_recoverable_signature signature;
+    int recid = 0;
+    if (secp256k1_ecdsa_sign_recoverable(secp256k1ctx, &signature, msgHash, privateKey, NULL, NULL) == 0) {
+        return 0;
+    }
+    secp256k1_ecdsa_recoverable_signature_serialize_compact(secp256k1ctx, sig, &recid, &signature);
+    sig[64] = recid;
+    return 1;
+}
+
+size_t fast_crypto_secp256k1_ecdsa_sign_recoverable_batch(const uint8_t *privateKeys,
+    const uint8_t *msgHashes, size_t count, unsigned threads, uint8_t *sigs)
+{
+    STATS_SCOPE(STATS_ECDSA, count * MESSAGE_HASH_LENGTH);
+    std::atomic<size_t> signed_count(0);
+    parallelFor(count, threads, [&](size_t i) {
+        signed_count += fast_crypto_secp256k1_ecdsa_sign_recoverable(privateKeys + i * SECRET_KEY_LENGTH,
+            msgHashes + i * MESSAGE_HASH_LENGTH, sigs + i * RECOVERABLE_SIGNATURE_LENGTH);
+    });
+    return signed_count;
+}
+
+/**
+ * Recovers a signer's public key, accepting Ethereum-style `v` values.
+ */
+static int ecdsaRecover(secp256k1_context *secp256k1ctx, const uint8_t *sig, const uint8_t *msgHash,
+    secp256k1_pubkey *public_key)
+{
+    int recid = sig[64] >= 27 ? sig[64] - 27 : sig[64];
+    if (recid > 3) return 0;
+
+    secp256k1_ecdsa_recoverable_signature signature;
+    return
+        secp256k1_ecdsa_recoverable_signature_parse_compact(secp256k1ctx, &signature, sig, recid) &&
+        secp256k1_ecdsa_recover(secp256k1ctx, public_key, &signature, msgHash);
+}
+
+int fast_crypto_secp256k1_ecdsa_recover(const uint8_t *sig, const uint8_t *msgHash,
+    uint8_t *publicKey, int compressed)
+{
+    STATS_SCOPE(STATS_ECDSA, MESSAGE_HASH_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_pubkey public_key;
+    if (!ecdsaRecover(secp256k1ctx, sig, msgHash, &public_key)) {
+        return 0;
+    }
+
+    size_t output_length = compressed ? COMPRESSED_PUBKEY_LENGTH : DECOMPRESSED_PUBKEY_LENGTH;
+    return secp256k1_ec_pubkey_serialize(secp256k1ctx, publicKey, &output_length, &public_key,
+        compressed ? SECP256K1_EC_COMPRESSED : SECP256K1_EC_UNCOMPRESSED);
+}
+
+size_t fast_crypto_secp256k1_ecdsa_recover_batch(const uint8_t *sigs, const uint8_t *msgHashes,
+    size_t count, int format, unsigned threads, uint8_t *out, uint8_t *results)
+{
+    STATS_SCOPE(STATS_ECDSA, count * MESSAGE_HASH_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+    const size_t stride =
+        format == RECOVER_COMPRESSED_PUBKEY ? COMPRESSED_PUBKEY_LENGTH :
+        format == RECOVER_UNCOMPRESSED_PUBKEY ? DECOMPRESSED_PUBKEY_LENGTH :
+        ETHEREUM_ADDRESS_LENGTH;
+
+    parallelFor(count, threads, [&](size_t i) {
+        uint8_t *item = out + i * stride;
+        secp256k1_pubkey public_key;
+        if (!ecdsaRecover(secp256k1ctx, sigs + i * RECOVERABLE_SIGNATURE_LENGTH,
+                msgHashes + i * MESSAGE_HASH_LENGTH, &public_key)) {
+            memset(item, 0, stride);
+            results[i] = 0;
+            return;
+        }
+
+        if (format == RECOVER_ETHEREUM_ADDRESS) {
+            // The address is the last 20 bytes of the hashed x || y:
+            uint8_t serialized[DECOMPRESSED_PUBKEY_LENGTH];
+            uint8_t hash[32];
+            size_t output_length = DECOMPRESSED_PUBKEY_LENGTH;
+            secp256k1_ec_pubkey_serialize(secp256k1ctx, serialized, &output_length, &public_key,
+                SECP256K1_EC_UNCOMPRESSED);
+            KECCAK256(serialized + 1, DECOMPRESSED_PUBKEY_LENGTH - 1, hash);
+            memcpy(item, hash + 32 - ETHEREUM_ADDRESS_LENGTH, ETHEREUM_ADDRESS_LENGTH);
+        } else {
+            size_t output_length = stride;
+            secp256k1_ec_pubkey_serialize(secp256k1ctx, item, &output_length, &public_key,
+                format == RECOVER_COMPRESSED_PUBKEY ? SECP256K1_EC_COMPRESSED : SECP256K1_EC_UNCOMPRESSED);
+        }
+        results[i] = 1;
+    });
+
+    size_t recovered = 0;
+    for (size_t i = 0; i < count; ++i) recovered += results[i];
+    return recovered;
+}
+
+int fast_crypto_secp256k1_ecdh(const uint8_t *privateKey, const uint8_t *publicKey,
+    size_t publicKeyLen, uint8_t *secret)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, SECRET_KEY_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_pubkey public_key;
+    return
+        secp256k1_ec_pubkey_parse(secp256k1ctx, &public_key, publicKey, publicKeyLen) &&
+        secp256k1_ecdh(secp256k1ctx, secret, &public_key, privateKey, NULL, NULL);
+}
+
+/**
+ * ECDH "hash" function that returns the compressed shared point as-is,
+ * since BIP352 hashes it together with an output counter.
+ */
+static int ecdhCompressedPoint(unsigned char *output, const unsigned char *x32,
+    const unsigned char *y32, void *)
+{
+    output[0] = 0x02 | (y32[31] & 1);
+    memcpy(output + 1, x32, 32);
+    return 1;
+}
+
+/**
+ * Returns the index of a 33-byte point in the label list, or -1.
+ */
+static int32_t findLabel(secp256k1_context *secp256k1ctx, const secp256k1_pubkey *point,
+    const uint8_t *labels, size_t labelCount)
+{
+    uint8_t serialized[COMPRESSED_PUBKEY_LENGTH];
+    size_t output_length = COMPRESSED_PUBKEY_LENGTH;
+    secp256k1_ec_pubkey_serialize(secp256k1ctx, serialized, &output_length, point, SECP256K1_EC_COMPRESSED);
+    for (size_t i = 0; i < labelCount; ++i) {
+        if (memcmp(serialized, labels + i * COMPRESSED_PUBKEY_LENGTH, COMPRESSED_PUBKEY_LENGTH) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Runs the BIP352 receiver loop for a single transaction.
+ */
+static void silentPaymentsScanTx(secp256k1_context *secp256k1ctx, const uint8_t *scanKey,
+    const secp256k1_pubkey *spend_key, const uint8_t *labels, size_t labelCount,
+    const uint8_t *tweak, const uint8_t *inputHash, const uint8_t *outputKeys, uint32_t outputCount,
+    uint32_t txIndex, std::vector<fast_crypto_silent_payment_match> &matches)
+{
+    static const char tag[] = "BIP0352/SharedSecret";
+
+    // Shared secret = (input_hash * b_scan) * A:
+    secp256k1_pubkey tweak_point;
+    if (secp256k1_ec_pubkey_parse(secp256k1ctx, &tweak_point, tweak, COMPRESSED_PUBKEY_LENGTH) == 0) {
+        return;
+    }
+    uint8_t scalar[SECRET_KEY_LENGTH];
+    memcpy(scalar, scanKey, SECRET_KEY_LENGTH);
+    uint8_t data[COMPRESSED_PUBKEY_LENGTH + 4];
+    int success =
+        (inputHash == NULL || secp256k1_ec_seckey_tweak_mul(secp256k1ctx, scalar, inputHash)) &&
+        secp256k1_ecdh(secp256k1ctx, data, &tweak_point, scalar, ecdhCompressedPoint, NULL);
+    memset(scalar, 0, sizeof(scalar));
+    if (!success) return;
+
+    // Lift each x-only output to its even-y point, for label checks:
+    std::vector<secp256k1_pubkey> outputs(labelCount > 0 ? outputCount : 0);
+    std::vector<bool> found(outputCount, false);
+    for (size_t j = 0; j < outputs.size(); ++j) {
+        uint8_t serialized[COMPRESSED_PUBKEY_LENGTH] = { 0x02 };
+        memcpy(serialized + 1, outputKeys + j * XONLY_PUBKEY_LENGTH, XONLY_PUBKEY_LENGTH);
+        if (secp256k1_ec_pubkey_parse(secp256k1ctx, &outputs[j], serialized, sizeof(serialized)) == 0) {
+            found[j] = true;
+        }
+    }
+
+    for (uint32_t k = 0; k < outputCount; ++k) {
+        // t_k = hash(ser_P(shared) || ser_32(k)), P_k = B_spend + t_k * G:
+        data[COMPRESSED_PUBKEY_LENGTH + 0] = k >> 24;
+        data[COMPRESSED_PUBKEY_LENGTH + 1] = k >> 16;
+        data[COMPRESSED_PUBKEY_LENGTH + 2] = k >> 8;
+        data[COMPRESSED_PUBKEY_LENGTH + 3] = k;
+        fast_crypto_silent_payment_match match;
+        secp256k1_tagged_sha256(secp256k1ctx, match.tweak, (const uint8_t *)tag, sizeof(tag) - 1,
+            data, sizeof(data));
+
+        secp256k1_pubkey output_key = *spend_key;
+        secp256k1_xonly_pubkey output_xonly;
+        uint8_t outputX[XONLY_PUBKEY_LENGTH];
+        if (!secp256k1_ec_pubkey_tweak_add(secp256k1ctx, &output_key, match.tweak) ||
+            !secp256k1_xonly_pubkey_from_pubkey(secp256k1ctx, &output_xonly, NULL, &output_key) ||
+            !secp256k1_xonly_pubkey_serialize(secp256k1ctx, outputX, &output_xonly)) {
+            break;
+        }
+
+        secp256k1_pubkey negated = output_key;
+        if (labelCount > 0) secp256k1_ec_pubkey_negate(secp256k1ctx, &negated);
+
+        bool matched = false;
+        for (uint32_t j = 0; j < outputCount && !matched; ++j) {
+            if (found[j]) continue;
+
+            match.labelIndex = -1;
+            if (memcmp(outputX, outputKeys + j * XONLY_PUBKEY_LENGTH, XONLY_PUBKEY_LENGTH) == 0) {
+                matched = true;
+            } else if (labelCount > 0) {
+                // Check whether output - P_k or -output - P_k is a label:
+                secp256k1_pubkey candidates[2] = { outputs[j], outputs[j] };
+                secp256k1_ec_pubkey_negate(secp256k1ctx, &candidates[1]);
+                for (int c = 0; c < 2 && !matched; ++c) {
+                    const secp256k1_pubkey *ins[2] = { &candidates[c], &negated };
+                    secp256k1_pubkey difference;
+                    if (secp256k1_ec_pubkey_combine(secp256k1ctx, &difference, ins, 2)) {
+                        match.labelIndex = findLabel(secp256k1ctx, &difference, labels, labelCount);
+                        matched = match.labelIndex >= 0;
+                    }
+                }
+            }
+
+            if (matched) {
+                found[j] = true;
+                match.txIndex = txIndex;
+                match.outputIndex = j;
+                matches.push_back(match);
+            }
+        }
+        if (!matched) break;
+    }
+}
+
+size_t fast_crypto_silent_payments_scan(const uint8_t *scanKey, const uint8_t *spendPublicKey,
+    const uint8_t *labels, size_t labelCount,
+    const uint8_t *tweaks, const uint8_t *inputHashes, size_t txCount,
+    const uint8_t *outputKeys, const uint32_t *outputCounts, unsigned threads,
+    fast_crypto_silent_payment_match *matches, size_t maxMatches)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, statsTotal(outputCounts, txCount) * XONLY_PUBKEY_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+    if (labels == NULL) labelCount = 0;
+
+    secp256k1_pubkey spend_key;
+    if (secp256k1_ec_pubkey_parse(secp256k1ctx, &spend_key, spendPublicKey, COMPRESSED_PUBKEY_LENGTH) == 0) {
+        return 0;
+    }
+
+    // Find where each transaction's outputs start:
+    std::vector<size_t> outputStarts(txCount);
+    size_t outputTotal = 0;
+    for (size_t i = 0; i < txCount; ++i) {
+        outputStarts[i] = outputTotal;
+        outputTotal += outputCounts[i];
+    }
+
+    std::vector<std::vector<fast_crypto_silent_payment_match> > txMatches(txCount);
+    parallelFor(txCount, threads, [&](size_t i) {
+        silentPaymentsScanTx(secp256k1ctx, scanKey, &spend_key, labels, labelCount,
+            tweaks + i * COMPRESSED_PUBKEY_LENGTH,
+            inputHashes != NULL ? inputHashes + i * 32 : NULL,
+            outputKeys + outputStarts[i] * XONLY_PUBKEY_LENGTH, outputCounts[i],
+            i, txMatches[i]);
+    });
+
+    size_t total = 0;
+    for (size_t i = 0; i < txCount; ++i) {
+        for (size_t j = 0; j < txMatches[i].size(); ++j, ++total) {
+            if (total < maxMatches) matches[total] = txMatches[i][j];
+        }
+    }
+    return total;
+}
+
+/**
+ * A bounded, thread-safe table of opaque handles with LRU eviction.
+ * Handle numbers are never reused until the counter wraps,
+ * so stale handles fail instead of pointing at some other entry.
+ * The entries live in the secure arena, like any other secret.
+ */
+template <class Entry>
+class HandleCache {
+public:
+    explicit HandleCache(size_t capacity): capacity(capacity) {}
+
+    uint32_t insert(const Entry &entry)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        while (entries.size() >= capacity) {
+            erase(order.back());
+        }
+
+        // Stay below 2^31, since Java only has signed integers.
+        // Once the counter wraps, skip handles that are still live,
+        // so an old handle never ends up pointing at a new entry:
+        uint32_t handle;
+        do {
+            handle = nextHandle;
+            nextHandle = nextHandle >= 0x7fffffff ? 1 : nextHandle + 1;
+        } while (entries.count(handle) != 0);
+        order.push_front(handle);
+        Slot &slot = entries[handle];
+        slot.entry = entry;
+        slot.position = order.begin();
+        return handle;
+    }
+
+    bool lookup(uint32_t handle, Entry &out)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(handle);
+        if (it == entries.end()) return false;
+        order.splice(order.begin(), order, it->second.position);
+        out = it->second.entry;
+        return true;
+    }
+
+    /**
+     * Copies out an entry and erases it in the same step,
+     * so only one caller can ever get it.
+     */
+    bool take(uint32_t handle, Entry &out)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(handle);
+        if (it == entries.end()) return false;
+        out = it->second.entry;
+        erase(handle);
+        return true;
+    }
+
+    void release(uint32_t handle)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        erase(handle);
+    }
+
+private:
+    struct Slot {
+        Entry entry;
+        std::list<uint32_t, SecureAllocator<uint32_t>>::iterator position;
+    };
+
+    void erase(uint32_t handle)
+    {
+        auto it = entries.find(handle);
+        if (it == entries.end()) return;
+        memset(&it->second.entry, 0, sizeof(it->second.entry));
+        order.erase(it->second.position);
+        entries.erase(it);
+    }
+
+    const size_t capacity;
+    std::mutex mutex;
+    std::unordered_map<uint32_t, Slot, std::hash<uint32_t>, std::equal_to<uint32_t>,
+        SecureAllocator<std::pair<const uint32_t, Slot>>> entries;
+    std::list<uint32_t, SecureAllocator<uint32_t>> order; // Most recently used first
+    uint32_t nextHandle = 1;
+};
+
+static_assert(sizeof(secp256k1_musig_keyagg_cache) == MUSIG_KEYAGG_CACHE_LENGTH, "keyagg cache size");
+
+/**
+ * Secret nonces never leave native code, since using one twice with
+ * different messages reveals the private key.
+ */
+static HandleCache<secp256k1_musig_secnonce> &getMusigNonceCache()
+{
+    static HandleCache<secp256k1_musig_secnonce> cache(MUSIG_NONCE_CACHE_SIZE);
+    return cache;
+}
+
+/**
+ * Parses and aggregates a set of compressed public keys.
+ */
+static int musigPubkeyAgg(secp256k1_context *secp256k1ctx, const uint8_t *publicKeys, size_t count,
+    int sort, secp256k1_xonly_pubkey *aggregate_key, secp256k1_musig_keyagg_cache *cache)
+{
+    std::vector<secp256k1_pubkey> keys(count);
+    std::vector<const secp256k1_pubkey *> pointers(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (secp256k1_ec_pubkey_parse(secp256k1ctx, &keys[i],
+                publicKeys + i * COMPRESSED_PUBKEY_LENGTH, COMPRESSED_PUBKEY_LENGTH) == 0) {
+            return 0;
+        }
+        pointers[i] = &keys[i];
+    }
+    if (sort && secp256k1_ec_pubkey_sort(secp256k1ctx, pointers.data(), count) == 0) {
+        return 0;
+    }
+    return secp256k1_musig_pubkey_agg(secp256k1ctx, aggregate_key, cache, pointers.data(), count);
+}
+
+/**
+ * Rebuilds the signing session from the aggregate nonce and message.
+ */
+static int musigSession(secp256k1_context *secp256k1ctx, const uint8_t *keyaggCache,
+    const uint8_t *aggnonce, const uint8_t *msg, secp256k1_musig_session *session)
+{
+    secp256k1_musig_keyagg_cache cache;
+    secp256k1_musig_aggnonce agg_nonce;
+    memcpy(&cache, keyaggCache, sizeof(cache));
+    return
+        secp256k1_musig_aggnonce_parse(secp256k1ctx, &agg_nonce, aggnonce) &&
+        secp256k1_musig_nonce_process(secp256k1ctx, session, &agg_nonce, msg, &cache);
+}
+
+int fast_crypto_musig_pubkey_agg(const uint8_t *publicKeys, size_t count, int sort,
+    uint8_t *aggregateKey, uint8_t *keyaggCache)
+{
+    STATS_SCOPE(STATS_SCHNORR, count * COMPRESSED_PUBKEY_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_xonly_pubkey aggregate_key;
+    secp256k1_musig_keyagg_cache cache;
+    if (!musigPubkeyAgg(secp256k1ctx, publicKeys, count, sort, &aggregate_key, &cache)) {
+        return 0;
+    }
+    memcpy(keyaggCache, &cache, sizeof(cache));
+    return secp256k1_xonly_pubkey_serialize(secp256k1ctx, aggregateKey, &aggregate_key);
+}
+
+size_t fast_crypto_musig_pubkey_agg_batch(const uint8_t *publicKeySets, size_t keysPerSet,
+    size_t setCount, int sort, unsigned threads, uint8_t *aggregateKeys)
+{
+    STATS_SCOPE(STATS_SCHNORR, setCount * keysPerSet * COMPRESSED_PUBKEY_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    std::atomic<size_t> aggregated(0);
+    parallelFor(setCount, threads, [&](size_t i) {
+        secp256k1_xonly_pubkey aggregate_key;
+        secp256k1_musig_keyagg_cache cache;
+        aggregated +=
+            musigPubkeyAgg(secp256k1ctx, publicKeySets + i * keysPerSet * COMPRESSED_PUBKEY_LENGTH,
+                keysPerSet, sort, &aggregate_key, &cache) &&
+            secp256k1_xonly_pubkey_serialize(secp256k1ctx, aggregateKeys + i * XONLY_PUBKEY_LENGTH,
+                &aggregate_key);
+    });
+    return aggregated;
+}
+
+int fast_crypto_musig_pubkey_tweak_add(uint8_t *keyaggCache, const uint8_t *tweak, int xonly,
+    uint8_t *tweakedKey)
+{
+    STATS_SCOPE(STATS_SCHNORR, SECRET_KEY_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_musig_keyagg_cache cache;
+    secp256k1_pubkey tweaked_key;
+    memcpy(&cache, keyaggCache, sizeof(cache));
+    int success = xonly ?
+        secp256k1_musig_pubkey_xonly_tweak_add(secp256k1ctx, &tweaked_key, &cache, tweak) :
+        secp256k1_musig_pubkey_ec_tweak_add(secp256k1ctx, &tweaked_key, &cache, tweak);
+    if (!success) {
+        return 0;
+    }
+
+    size_t output_length = COMPRESSED_PUBKEY_LENGTH;
+    memcpy(keyaggCache, &cache, sizeof(cache));
+    return secp256k1_ec_pubkey_serialize(secp256k1ctx, tweakedKey, &output_length, &tweaked_key,
+        SECP256K1_EC_COMPRESSED);
+}
+
+uint32_t fast_crypto_musig_nonce_gen(const uint8_t *sessionRand, const uint8_t *privateKey,
+    const uint8_t *publicKey, const uint8_t *msg, const uint8_t *keyaggCache,
+    uint8_t *pubnonce)
+{
+    STATS_SCOPE(STATS_SCHNORR, MESSAGE_HASH_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_pubkey public_key;
+    if (secp256k1_ec_pubkey_parse(secp256k1ctx, &public_key, publicKey, COMPRESSED_PUBKEY_LENGTH) == 0) {
+        return 0;
+    }
+    secp256k1_musig_keyagg_cache cache;
+    if (keyaggCache != NULL) memcpy(&cache, keyaggCache, sizeof(cache));
+
+    // libsecp256k1 wipes the session randomness to prevent reuse:
+    uint8_t rand[32];
+    memcpy(rand, sessionRand, sizeof(rand));
+
+    secp256k1_musig_secnonce sec_nonce;
+    secp256k1_musig_pubnonce pub_nonce;
+    int success =
+        secp256k1_musig_nonce_gen(secp256k1ctx, &sec_nonce, &pub_nonce, rand, privateKey, &public_key,
+            msg, keyaggCache != NULL ? &cache : NULL, NULL) &&
+        secp256k1_musig_pubnonce_serialize(secp256k1ctx, pubnonce, &pub_nonce);
+    uint32_t handle = success ? getMusigNonceCache().insert(sec_nonce) : 0;
+    memset(&sec_nonce, 0, sizeof(sec_nonce));
+    memset(rand, 0, sizeof(rand));
+    return handle;
+}
+
+int fast_crypto_musig_nonce_agg(const uint8_t *pubnonces, size_t count, uint8_t *aggnonce)
+{
+    STATS_SCOPE(STATS_SCHNORR, count * MUSIG_PUBNONCE_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    std::vector<secp256k1_musig_pubnonce> nonces(count);
+    std::vector<const secp256k1_musig_pubnonce *> pointers(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (secp256k1_musig_pubnonce_parse(secp256k1ctx, &nonces[i], pubnonces + i * MUSIG_PUBNONCE_LENGTH) == 0) {
+            return 0;
+        }
+        pointers[i] = &nonces[i];
+    }
+
+    secp256k1_musig_aggnonce agg_nonce;
+    return
+        secp256k1_musig_nonce_agg(secp256k1ctx, &agg_nonce, pointers.data(), count) &&
+        secp256k1_musig_aggnonce_serialize(secp256k1ctx, aggnonce, &agg_nonce);
+}
+
+int fast_crypto_musig_partial_sign(uint32_t nonceHandle, const uint8_t *privateKey,
+    const uint8_t *keyaggCache, const uint8_t *aggnonce, const uint8_t *msg,
+    uint8_t *partialSig)
+{
+    STATS_SCOPE(STATS_SCHNORR, MESSAGE_HASH_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_musig_session session;
+    secp256k1_musig_keyagg_cache cache;
+    secp256k1_musig_secnonce sec_nonce;
+    secp256k1_keypair keypair;
+    secp256k1_musig_partial_sig partial_sig;
+
+    // Taking the nonce erases it, so the handle fails if used again:
+    if (!getMusigNonceCache().take(nonceHandle, sec_nonce)) {
+        return 0;
+    }
+    memcpy(&cache, keyaggCache, sizeof(cache));
+
+    int success =
+        musigSession(secp256k1ctx, keyaggCache, aggnonce, msg, &session) &&
+        secp256k1_keypair_create(secp256k1ctx, &keypair, privateKey) &&
+        secp256k1_musig_partial_sign(secp256k1ctx, &partial_sig, &sec_nonce, &keypair, &cache, &session) &&
+        secp256k1_musig_partial_sig_serialize(secp256k1ctx, partialSig, &partial_sig);
+    memset(&sec_nonce, 0, sizeof(sec_nonce));
+    memset(&keypair, 0, sizeof(keypair));
+    return success;
+}
+
+void fast_crypto_musig_nonce_release(uint32_t nonceHandle)
+{
+    STATS_SCOPE(STATS_SCHNORR, 0);
+    getMusigNonceCache().release(nonceHandle);
+}
+
+int fast_crypto_musig_partial_verify(const uint8_t *partialSig, const uint8_t *pubnonce,
+    const uint8_t *publicKey, const uint8_t *keyaggCache, const uint8_t *aggnonce,
+    const uint8_t *msg)
+{
+    STATS_SCOPE(STATS_SCHNORR, MESSAGE_HASH_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_musig_session session;
+    secp256k1_musig_keyagg_cache cache;
+    secp256k1_musig_partial_sig partial_sig;
+    secp256k1_musig_pubnonce pub_nonce;
+    secp256k1_pubkey public_key;
+    memcpy(&cache, keyaggCache, sizeof(cache));
+    return
+        musigSession(secp256k1ctx, keyaggCache, aggnonce, msg, &session) &&
+        secp256k1_musig_partial_sig_parse(secp256k1ctx, &partial_sig, partialSig) &&
+        secp256k1_musig_pubnonce_parse(secp256k1ctx, &pub_nonce, pubnonce) &&
+        secp256k1_ec_pubkey_parse(secp256k1ctx, &public_key, publicKey, COMPRESSED_PUBKEY_LENGTH) &&
+        secp256k1_musig_partial_sig_verify(secp256k1ctx, &partial_sig, &pub_nonce, &public_key, &cache, &session);
+}
+
+int fast_crypto_musig_partial_sig_agg(const uint8_t *partialSigs, size_t count,
+    const uint8_t *keyaggCache, const uint8_t *aggnonce, const uint8_t *msg, uint8_t *sig)
+{
+    STATS_SCOPE(STATS_SCHNORR, count * MUSIG_PARTIAL_SIG_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    secp256k1_musig_session session;
+    if (!musigSession(secp256k1ctx, keyaggCache, aggnonce, msg, &session)) {
+        return 0;
+    }
+
+    std::vector<secp256k1_musig_partial_sig> sigs(count);
+    std::vector<const secp256k1_musig_partial_sig *> pointers(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (secp256k1_musig_partial_sig_parse(secp256k1ctx, &sigs[i],
+                partialSigs + i * MUSIG_PARTIAL_SIG_LENGTH) == 0) {
+            return 0;
+        }
+        pointers[i] = &sigs[i];
+    }
+    return secp256k1_musig_partial_sig_agg(secp256k1ctx, sig, &session, pointers.data(), count);
+}
+
+/**
+ * A parsed key stored behind a handle. Private-key entries also carry
+ * their public key, so they can be turned into public handles cheaply.
+ */
+struct KeyHandleEntry {
+    bool isPrivate;
+    uint8_t privateKey[SECRET_KEY_LENGTH];
+    secp256k1_pubkey publicKey;
+};
+
+static HandleCache<KeyHandleEntry> &getKeyHandleCache()
+{
+    static HandleCache<KeyHandleEntry> cache(KEY_HANDLE_CACHE_SIZE);
+    return cache;
+}
+
+/**
+ * Stores a public key in a new handle.
+ */
+static uint32_t insertPublicKey(const secp256k1_pubkey &publicKey)
+{
+    KeyHandleEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    entry.isPrivate = false;
+    entry.publicKey = publicKey;
+    return getKeyHandleCache().insert(entry);
+}
+
+uint32_t fast_crypto_secp256k1_pubkey_handle_create(const uint8_t *publicKey, size_t publicKeyLen)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, publicKeyLen);
+    secp256k1_pubkey public_key;
+    if (secp256k1_ec_pubkey_parse(getSecp256k1Context(), &public_key, publicKey, publicKeyLen) == 0) {
+        return 0;
+    }
+    return insertPublicKey(public_key);
+}
+
+uint32_t fast_crypto_secp256k1_privkey_handle_create(const uint8_t *privateKey)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, SECRET_KEY_LENGTH);
+    KeyHandleEntry entry;
+    entry.isPrivate = true;
+    memcpy(entry.privateKey, privateKey, SECRET_KEY_LENGTH);
+    uint32_t handle = 0;
+    if (secp256k1_ec_pubkey_create(getSecp256k1Context(), &entry.publicKey, entry.privateKey)) {
+        handle = getKeyHandleCache().insert(entry);
+    }
+    memset(&entry, 0, sizeof(entry));
+    return handle;
+}
+
+uint32_t fast_crypto_secp256k1_handle_pubkey(uint32_t handle)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, SECRET_KEY_LENGTH);
+    KeyHandleEntry entry;
+    if (!getKeyHandleCache().lookup(handle, entry)) {
+        return 0;
+    }
+    memset(entry.privateKey, 0, sizeof(entry.privateKey));
+    return entry.isPrivate ? insertPublicKey(entry.publicKey) : 0;
+}
+
+uint32_t fast_crypto_secp256k1_handle_tweak_add(uint32_t handle, const uint8_t *tweak)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, SECRET_KEY_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    KeyHandleEntry entry;
+    if (!getKeyHandleCache().lookup(handle, entry)) {
+        return 0;
+    }
+
+    uint32_t out = 0;
+    if (entry.isPrivate) {
+        if (secp256k1_ec_seckey_tweak_add(secp256k1ctx, entry.privateKey, tweak) &&
+            secp256k1_ec_pubkey_create(secp256k1ctx, &entry.publicKey, entry.privateKey)) {
+            out = getKeyHandleCache().insert(entry);
+        }
+    } else if (secp256k1_ec_pubkey_tweak_add(secp256k1ctx, &entry.publicKey, tweak)) {
+        out = getKeyHandleCache().insert(entry);
+    }
+    memset(&entry, 0, sizeof(entry));
+    return out;
+}
+
+uint32_t fast_crypto_secp256k1_handle_combine(const uint32_t *handles, size_t count)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, count * COMPRESSED_PUBKEY_LENGTH);
+    if (count == 0) return 0;
+
+    std::vector<secp256k1_pubkey> keys(count);
+    std::vector<const secp256k1_pubkey *> pointers(count);
+    for (size_t i = 0; i < count; ++i) {
+        KeyHandleEntry entry;
+        if (!getKeyHandleCache().lookup(handles[i], entry) || entry.isPrivate) {
+            memset(&entry, 0, sizeof(entry));
+            return 0;
+        }
+        keys[i] = entry.publicKey;
+        pointers[i] = &keys[i];
+    }
+
+    secp256k1_pubkey sum;
+    if (secp256k1_ec_pubkey_combine(getSecp256k1Context(), &sum, pointers.data(), count) == 0) {
+        return 0;
+    }
+    return insertPublicKey(sum);
+}
+
+size_t fast_crypto_secp256k1_handle_serialize(uint32_t handle, int compressed, uint8_t *out)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, 0);
+    KeyHandleEntry entry;
+    if (!getKeyHandleCache().lookup(handle, entry)) {
+        return 0;
+    }
+
+    size_t outLen = 0;
+    if (entry.isPrivate) {
+        memcpy(out, entry.privateKey, SECRET_KEY_LENGTH);
+        outLen = SECRET_KEY_LENGTH;
+    } else {
+        outLen = DECOMPRESSED_PUBKEY_LENGTH;
+        secp256k1_ec_pubkey_serialize(getSecp256k1Context(), out, &outLen, &entry.publicKey,
+            compressed ? SECP256K1_EC_COMPRESSED : SECP256K1_EC_UNCOMPRESSED);
+    }
+    memset(&entry, 0, sizeof(entry));
+    return outLen;
+}
+
+void fast_crypto_secp256k1_handle_release(uint32_t handle)
+{
+    STATS_SCOPE(STATS_SECP256K1_KEYS, 0);
+    getKeyHandleCache().release(handle);
+}
+
+/**
+ * Derives a non-hardened BIP32 child public key.
+ */
+static int deriveChildPubkey(secp256k1_context *secp256k1ctx, const uint8_t *chainCode,
+    const secp256k1_pubkey *parent, uint32_t index, secp256k1_pubkey *child)
+{
+    uint8_t data[COMPRESSED_PUBKEY_LENGTH + 4];
+    size_t dataLen = COMPRESSED_PUBKEY_LENGTH;
+    secp256k1_ec_pubkey_serialize(secp256k1ctx, data, &dataLen, parent, SECP256K1_EC_COMPRESSED);
+    data[33] = index >> 24;
+    data[34] = index >> 16;
+    data[35] = index >> 8;
+    data[36] = index;
+
+    // The left half is the tweak, and the right half is the child chain code:
+    uint8_t hmac[64];
+    HMAC_SHA512(chainCode, 32, data, sizeof(data), hmac);
+    *child = *parent;
+    return secp256k1_ec_pubkey_tweak_add(secp256k1ctx, child, hmac);
+}
+
+size_t fast_crypto_multisig_derive_batch(const uint8_t *xpubs, size_t n, size_t m,
+    uint32_t startIndex, size_t count, int scriptType, unsigned threads, uint8_t *hashes)
+{
+    STATS_SCOPE(STATS_ADDRESS, count * n * COMPRESSED_PUBKEY_LENGTH);
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+
+    // OP_1 through OP_16 limit the key counts,
+    // and the 520-byte push limit leaves room for 15 keys in P2SH:
+    if (scriptType < MULTISIG_P2SH || scriptType > MULTISIG_P2SH_P2WSH) return 0;
+    if (n == 0 || n > (scriptType == MULTISIG_P2SH ? 15u : 16u) || m == 0 || m > n) return 0;
+    if (startIndex >= 0x80000000 || count > 0x80000000 - startIndex) return 0;
+    const size_t hashLen = scriptType == MULTISIG_P2WSH ? 32 : 20;
+
+    // Parse the parents once, rather than once per child:
+    std::vector<secp256k1_pubkey> parents(n);
+    for (size_t i = 0; i < n; ++i) {
+        if (secp256k1_ec_pubkey_parse(secp256k1ctx, &parents[i], xpubs + i * XPUB_LENGTH + 32,
+                COMPRESSED_PUBKEY_LENGTH) == 0) {
+            return 0;
+        }
+    }
+
+    std::atomic<size_t> derived(0);
+    parallelFor(count, threads, [&](size_t i) {
+        uint8_t *hash = hashes + i * hashLen;
+        uint32_t index = startIndex + i;
+
+        // Public keys need no wiping, so keep them on the stack,
+        // and sort an index rather than moving the rows:
+        uint8_t keys[16][COMPRESSED_PUBKEY_LENGTH];
+        uint8_t order[16];
+        for (size_t j = 0; j < n; ++j) {
+            secp256k1_pubkey child;
+            if (!deriveChildPubkey(secp256k1ctx, xpubs + j * XPUB_LENGTH, &parents[j], index, &child)) {
+                memset(hash, 0, hashLen);
+                return;
+            }
+            size_t keyLen = COMPRESSED_PUBKEY_LENGTH;
+            secp256k1_ec_pubkey_serialize(secp256k1ctx, keys[j], &keyLen, &child,
+                SECP256K1_EC_COMPRESSED);
+            order[j] = j;
+        }
+        std::sort(order, order + n, [&](uint8_t a, uint8_t b) {
+            return memcmp(keys[a], keys[b], COMPRESSED_PUBKEY_LENGTH) < 0;
+        });
+
+        uint8_t script[3 + 16 * (1 + COMPRESSED_PUBKEY_LENGTH)];
+        size_t scriptLen = 0;
+        script[scriptLen++] = 0x50 + m; // OP_m
+        for (size_t j = 0; j < n; ++j) {
+            script[scriptLen++] = COMPRESSED_PUBKEY_LENGTH;
+            memcpy(script + scriptLen, keys[order[j]], COMPRESSED_PUBKEY_LENGTH);
+            scriptLen += COMPRESSED_PUBKEY_LENGTH;
+        }
+        script[scriptLen++] = 0x50 + n; // OP_n
+        script[scriptLen++] = 0xae; // OP_CHECKMULTISIG
+
+        if (scriptType == MULTISIG_P2SH) {
+            HASH160(script, scriptLen, hash);
+        } else {
+            // The P2WSH program is OP_0 <sha256(script)>:
+            uint8_t program[34] = { 0x00, 0x20 };
+            SHA256_CTX ctx;
+            SHA256_Init(&ctx);
+            SHA256_Update(&ctx, script, scriptLen);
+            SHA256_Final(program + 2, &ctx);
+            if (scriptType == MULTISIG_P2WSH) {
+                memcpy(hash, program + 2, 32);
+            } else {
+                HASH160(program, sizeof(program), hash);
+            }
+        }
+        ++derived;
+    });
+    return derived;
+}
+
+static_assert(AES_IMPLEMENTATION_AUTO == AES_IMPL_AUTO, "AES implementation ids");
+static_assert(AES_IMPLEMENTATION_BITSLICED == AES_IMPL_BITSLICED, "AES implementation ids");
+static_assert(AES_IMPLEMENTATION_AESNI == AES_IMPL_AESNI, "AES implementation ids");
+static_assert(AES_IMPLEMENTATION_ARMV8 == AES_IMPL_ARMV8, "AES implementation ids");
+
+int fast_crypto_aes256_cbc_encrypt(const uint8_t *key, const uint8_t *iv,
+    const uint8_t *in, size_t inLen, int pad, uint8_t *out, size_t *outLen)
+{
+    STATS_SCOPE(STATS_AES, inLen);
+    if (!pad && inLen % AES_BLOCK_LENGTH != 0) return 0;
+
+    AES256_CTX ctx;
+    uint8_t chain[AES_BLOCK_LENGTH];
+    size_t whole = inLen / AES_BLOCK_LENGTH;
+    AES256_Init(&ctx, key);
+    memcpy(chain, iv, AES_BLOCK_LENGTH);
+    AES256_CBC_Encrypt(&ctx, chain, in, out, whole);
+
+    *outLen = whole * AES_BLOCK_LENGTH;
+    if (pad) {
+        // PKCS#7 always adds between 1 and 16 bytes:
+        uint8_t last[AES_BLOCK_LENGTH];
+        size_t rest = inLen - *outLen;
+        memcpy(last, in + *outLen, rest);
+        memset(last + rest, (int)(AES_BLOCK_LENGTH - rest), AES_BLOCK_LENGTH - rest);
+        AES256_CBC_Encrypt(&ctx, chain, last, out + *outLen, 1);
+        *outLen += AES_BLOCK_LENGTH;
+        memset(last, 0, sizeof(last));
+    }
+    AES256_Clear(&ctx);
+    return 1;
+}
+
+/**
+ * Decrypts CBC data and strips its PKCS#7 padding, checking every
+ * padding byte without branching on the plaintext, so bad padding
+ * takes as long to reject as good padding. The length must be a
+ * non-zero multiple of the block size. Zeroes `out` on failure.
+ */
+static bool aesCbcDecryptPadded(const AES256_CTX *ctx, const uint8_t *iv,
+    const uint8_t *in, size_t inLen, uint8_t *out, size_t *outLen)
+{
+    uint8_t chain[AES_BLOCK_LENGTH];
+    memcpy(chain, iv, AES_BLOCK_LENGTH);
+    AES256_CBC_Decrypt(ctx, chain, in, out, inLen / AES_BLOCK_LENGTH);
+
+    const uint8_t *last = out + inLen - AES_BLOCK_LENGTH;
+    unsigned padLen = last[AES_BLOCK_LENGTH - 1];
+    unsigned bad = (unsigned)(padLen - 1) >> 8 | (unsigned)(AES_BLOCK_LENGTH - padLen) >> 8;
+    for (unsigned i = 0; i < AES_BLOCK_LENGTH; ++i) {
+        unsigned inPad = (unsigned)(AES_BLOCK_LENGTH - 1 - i - padLen) >> 8 & 1;
+        bad |= inPad & (last[i] ^ padLen);
+    }
+    if (bad) {
+        memset(out, 0, inLen);
+        return false;
+    }
+    *outLen = inLen - padLen;
+    return true;
+}
+
+int fast_crypto_aes256_cbc_decrypt(const uint8_t *key, const uint8_t *iv,
+    const uint8_t *in, size_t inLen, int pad, uint8_t *out, size_t *outLen)
+{
+    STATS_SCOPE(STATS_AES, inLen);
+    if (inLen % AES_BLOCK_LENGTH != 0) return 0;
+    if (pad && inLen == 0) return 0;
+
+    AES256_CTX ctx;
+    AES256_Init(&ctx, key);
+    int success = 1;
+    if (pad) {
+        success = aesCbcDecryptPadded(&ctx, iv, in, inLen, out, outLen);
+    } else {
+        uint8_t chain[AES_BLOCK_LENGTH];
+        memcpy(chain, iv, AES_BLOCK_LENGTH);
+        AES256_CBC_Decrypt(&ctx, chain, in, out, inLen / AES_BLOCK_LENGTH);
+        *outLen = inLen;
+    }
+    AES256_Clear(&ctx);
+    return success;
+}
+
+void fast_crypto_aes256_gcm_encrypt(const uint8_t *key, const uint8_t *iv,
+    const uint8_t *aad, size_t aadLen, const uint8_t *in, size_t inLen,
+    uint8_t *out, uint8_t *tag)
+{
+    STATS_SCOPE(STATS_AES, aadLen + inLen);
+    AES256_GCM_Encrypt(key, iv, aad, aadLen, in, inLen, out, tag);
+}
+
+int fast_crypto_aes256_gcm_decrypt(const uint8_t *key, const uint8_t *iv,
+    const uint8_t *aad, size_t aadLen, const uint8_t *in, size_t inLen,
+    const uint8_t *tag, uint8_t *out)
+{
+    STATS_SCOPE(STATS_AES, aadLen + inLen);
+    return AES256_GCM_Decrypt(key, iv, aad, aadLen, in, inLen, tag, out) == 0;
+}
+
+int fast_crypto_aes_set_implementation(int implementation)
+{
+    return AES_SetImplementation(implementation) == 0;
+}
+
+int fast_crypto_aes_get_implementation(void)
+{
+    return AES_GetImplementation();
+}
+
+static_assert(CHACHA20_IMPLEMENTATION_AUTO == CHACHA20_IMPL_AUTO, "ChaCha20 implementation ids");
+static_assert(CHACHA20_IMPLEMENTATION_PORTABLE == CHACHA20_IMPL_PORTABLE, "ChaCha20 implementation ids");
+static_assert(CHACHA20_IMPLEMENTATION_SSE2 == CHACHA20_IMPL_SSE2, "ChaCha20 implementation ids");
+static_assert(CHACHA20_IMPLEMENTATION_AVX2 == CHACHA20_IMPL_AVX2, "ChaCha20 implementation ids");
+static_assert(CHACHA20_IMPLEMENTATION_NEON == CHACHA20_IMPL_NEON, "ChaCha20 implementation ids");
+
+/**
+ * Starts a ChaCha20-Poly1305 or XChaCha20-Poly1305 operation,
+ * depending on the nonce length.
+ */
+static bool chacha20Poly1305Init(CHACHA20POLY1305_CTX *ctx, const uint8_t *key,
+    const uint8_t *nonce, size_t nonceLen, const uint8_t *aad, size_t aadLen)
+{
+    if (nonceLen == CHACHA20_POLY1305_NONCE_LENGTH) {
+        ChaCha20Poly1305_Init(ctx, key, nonce);
+    } else if (nonceLen == XCHACHA20_POLY1305_NONCE_LENGTH) {
+        XChaCha20Poly1305_Init(ctx, key, nonce);
+    } else {
+        return false;
+    }
+    ChaCha20Poly1305_AAD(ctx, aad, aadLen);
+    return true;
+}
+
+int fast_crypto_chacha20_poly1305_encrypt(const uint8_t *key, const uint8_t *nonce,
+    size_t nonceLen, const uint8_t *aad, size_t aadLen, const uint8_t *in, size_t inLen,
+    uint8_t *out, uint8_t *tag)
+{
+    STATS_SCOPE(STATS_CHACHA20_POLY1305, aadLen + inLen);
+    CHACHA20POLY1305_CTX ctx;
+    if (!chacha20Poly1305Init(&ctx, key, nonce, nonceLen, aad, aadLen)) return 0;
+    ChaCha20Poly1305_Encrypt(&ctx, in, out, inLen);
+    ChaCha20Poly1305_Final(&ctx, tag);
+    return 1;
+}
+
+int fast_crypto_chacha20_poly1305_decrypt(const uint8_t *key, const uint8_t *nonce,
+    size_t nonceLen, const uint8_t *aad, size_t aadLen, const uint8_t *in, size_t inLen,
+    const uint8_t *tag, uint8_t *out)
+{
+    STATS_SCOPE(STATS_CHACHA20_POLY1305, aadLen + inLen);
+    CHACHA20POLY1305_CTX ctx;
+    if (!chacha20Poly1305Init(&ctx, key, nonce, nonceLen, aad, aadLen)) return 0;
+    ChaCha20Poly1305_Decrypt(&ctx, in, out, inLen);
+    if (ChaCha20Poly1305_Verify(&ctx, tag) != 0) {
+        memset(out, 0, inLen);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * An open AEAD stream. The lock keeps chunks from the same stream
+ * in order, while separate streams can run in parallel.
+ */
+struct AeadStream {
+    std::mutex mutex;
+    CHACHA20POLY1305_CTX ctx;
+    bool decrypt;
+
+    ~AeadStream() { memset(&ctx, 0, sizeof(ctx)); }
+};
+
+class AeadStreamTable {
+public:
+    uint32_t insert(const std::shared_ptr<AeadStream> &stream)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (streams.size() >= AEAD_STREAM_LIMIT) return 0;
+
+        // Stay below 2^31, since Java only has signed integers:
+        uint32_t handle;
+        do {
+            handle = nextHandle;
+            nextHandle = nextHandle >= 0x7fffffff ? 1 : nextHandle + 1;
+        } while (streams.count(handle) != 0);
+        streams[handle] = stream;
+        return handle;
+    }
+
+    std::shared_ptr<AeadStream> lookup(uint32_t handle)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = streams.find(handle);
+        return it == streams.end() ? nullptr : it->second;
+    }
+
+    std::shared_ptr<AeadStream> remove(uint32_t handle)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = streams.find(handle);
+        if (it == streams.end()) return nullptr;
+        std::shared_ptr<AeadStream> stream = it->second;
+        streams.erase(it);
+        return stream;
+    }
+
+private:
+    std::mutex mutex;
+    std::unordered_map<uint32_t, std::shared_ptr<AeadStream>> streams;
+    uint32_t nextHandle = 1;
+};
+
+static AeadStreamTable &getAeadStreamTable()
+{
+    static AeadStreamTable table;
+    return table;
+}
+
+uint32_t fast_crypto_chacha20_poly1305_stream_create(const uint8_t *key, const uint8_t *nonce,
+    size_t nonceLen, const uint8_t *aad, size_t aadLen, int decrypt)
+{
+    std::shared_ptr<AeadStream> stream = std::make_shared<AeadStream>();
+    if (!chacha20Poly1305Init(&stream->ctx, key, nonce, nonceLen, aad, aadLen)) return 0;
+    stream->decrypt = decrypt != 0;
+    return getAeadStreamTable().insert(stream);
+}
+
+int fast_crypto_chacha20_poly1305_stream_update(uint32_t stream, const uint8_t *in,
+    size_t inLen, uint8_t *out)
+{
+    STATS_SCOPE(STATS_CHACHA20_POLY1305, inLen);
+    std::shared_ptr<AeadStream> entry = getAeadStreamTable().lookup(stream);
+    if (!entry) return 0;
+
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    if (entry->decrypt) {
+        ChaCha20Poly1305_Decrypt(&entry->ctx, in, out, inLen);
+    } else {
+        ChaCha20Poly1305_Encrypt(&entry->ctx, in, out, inLen);
+    }
+    return 1;
+}
+
+int fast_crypto_chacha20_poly1305_stream_final(uint32_t stream, uint8_t *tag)
+{
+    std::shared_ptr<AeadStream> entry = getAeadStreamTable().remove(stream);
+    if (!entry) return 0;
+
+    // Wait for any update that looked the stream up before we removed it:
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    if (entry->decrypt) {
+        return ChaCha20Poly1305_Verify(&entry->ctx, tag) == 0;
+    }
+    ChaCha20Poly1305_Final(&entry->ctx, tag);
+    return 1;
+}
+
+void fast_crypto_chacha20_poly1305_stream_release(uint32_t stream)
+{
+    getAeadStreamTable().remove(stream);
+}
+
+int fast_crypto_chacha20_set_implementation(int implementation)
+{
+    return ChaCha20_SetImplementation(implementation) == 0;
+}
+
+int fast_crypto_chacha20_get_implementation(void)
+{
+    return ChaCha20_GetImplementation();
+}
+
+/**
+ * Checks and decrypts one storage record. The HMAC context already
+ * holds the MAC key, and is copied rather than set up again.
+ */
+static int recordDecrypt(const AES256_CTX *aes, const HMAC_SHA256_CTX *hmac,
+    const uint8_t *record, size_t recordLen, uint8_t *out, size_t *outLen)
+{
+    *outLen = 0;
+    if (recordLen < RECORD_IV_LENGTH + AES_BLOCK_LENGTH + RECORD_MAC_LENGTH) return RECORD_BAD_LENGTH;
+    size_t dataLen = recordLen - RECORD_IV_LENGTH - RECORD_MAC_LENGTH;
+    if (dataLen % AES_BLOCK_LENGTH != 0) return RECORD_BAD_LENGTH;
+
+    HMAC_SHA256_CTX ctx = *hmac;
+    uint8_t mac[RECORD_MAC_LENGTH];
+    HMAC_SHA256_Update(&ctx, record, RECORD_IV_LENGTH + dataLen);
+    HMAC_SHA256_Final(mac, &ctx);
+
+    // Constant-time comparison:
+    const uint8_t *expected = record + RECORD_IV_LENGTH + dataLen;
+    uint8_t diff = 0;
+    for (size_t i = 0; i < RECORD_MAC_LENGTH; ++i) diff |= mac[i] ^ expected[i];
+    if (diff != 0) return RECORD_BAD_MAC;
+
+    if (!aesCbcDecryptPadded(aes, record, record + RECORD_IV_LENGTH, dataLen, out, outLen)) {
+        return RECORD_BAD_PADDING;
+    }
+    return RECORD_OK;
+}
+
+size_t fast_crypto_records_decrypt_batch(const uint8_t *key,
+    const uint8_t *records, const uint32_t *recordLens, size_t count, unsigned threads,
+    uint8_t *plaintexts, uint32_t *plaintextLens, uint8_t *statuses)
+{
+    STATS_SCOPE(STATS_RECORDS, statsTotal(recordLens, count));
+    std::vector<size_t> offsets(count);
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        offsets[i] = total;
+        total += recordLens[i];
+    }
+
+    // Both key schedules are shared, read-only, by every worker:
+    AES256_CTX aes;
+    AES256_Init(&aes, key);
+    HMAC_SHA256_CTX hmac;
+    HMAC_SHA256_Init(&hmac, key + AES256_KEY_LENGTH, RECORD_KEY_LENGTH - AES256_KEY_LENGTH);
+
+    std::atomic<size_t> successes(0);
+    parallelFor(count, threads, [&](size_t i) {
+        uint8_t *out = plaintexts + offsets[i];
+        size_t outLen;
+        int status = recordDecrypt(&aes, &hmac, records + offsets[i], recordLens[i], out, &outLen);
+        if (status != RECORD_OK) memset(out, 0, recordLens[i]);
+        statuses[i] = status;
+        plaintextLens[i] = outLen;
+        if (status == RECORD_OK) successes.fetch_add(1);
+    });
+
+    AES256_Clear(&aes);
+    memset(&hmac, 0, sizeof(hmac));
+    return successes.load();
+}
+
+size_t fast_crypto_records_decrypt_batch_scrypt(const uint8_t *passwd, size_t passwdlen,
+    const uint8_t *salt, size_t saltlen, uint64_t N, uint32_t r, uint32_t p,
+    const uint8_t *records, const uint32_t *recordLens, size_t count, unsigned threads,
+    uint8_t *plaintexts, uint32_t *plaintextLens, uint8_t *statuses)
+{
+    STATS_SCOPE(STATS_RECORDS, statsTotal(recordLens, count));
+    uint8_t key[RECORD_KEY_LENGTH];
+
+    if (crypto_scrypt(passwd, passwdlen, salt, saltlen, N, r, p, key, sizeof(key)) != 0) {
+        for (size_t i = 0; i < count; ++i) {
+            statuses[i] = RECORD_KDF_FAILED;
+            plaintextLens[i] = 0;
+        }
+        return 0;
+    }
+    size_t successes = fast_crypto_records_decrypt_batch(key, records, recordLens, count, threads,
+        plaintexts, plaintextLens, statuses);
+    memset(key, 0, sizeof(key));
+    return successes;
+}
+
+void fast_crypto_ed25519_pubkey_create(const uint8_t *privateKey, uint8_t *publicKey)
+{
+    STATS_SCOPE(STATS_ED25519, ED25519_PRIVKEY_LENGTH);
+    Ed25519_PublicKey(privateKey, publicKey);
+}
+
+size_t fast_crypto_ed25519_pubkey_create_batch(const uint8_t *privateKeys, size_t count,
+    unsigned threads, uint8_t *publicKeys)
+{
+    STATS_SCOPE(STATS_ED25519, count * ED25519_PRIVKEY_LENGTH);
+    parallelFor(count, threads, [&](size_t i) {
+        Ed25519_PublicKey(privateKeys + i * ED25519_PRIVKEY_LENGTH,
+            publicKeys + i * ED25519_PUBKEY_LENGTH);
+    });
+    return count;
+}
+
+void fast_crypto_ed25519_sign(const uint8_t *privateKey, const uint8_t *msg, size_t msgLen,
+    uint8_t *sig)
+{
+    STATS_SCOPE(STATS_ED25519, msgLen);
+    uint8_t publicKey[ED25519_PUBKEY_LENGTH];
+    Ed25519_PublicKey(privateKey, publicKey);
+    Ed25519_Sign(privateKey, publicKey, msg, msgLen, sig);
+}
+
+int fast_crypto_ed25519_verify(const uint8_t *sig, const uint8_t *msg, size_t msgLen,
+    const uint8_t *publicKey)
+{
+    STATS_SCOPE(STATS_ED25519, msgLen);
+    return Ed25519_Verify(sig, publicKey, msg, msgLen) == 0;
+}
+
+size_t fast_crypto_ed25519_verify_batch(const uint8_t *sigs, const uint8_t *msgs,
+    const uint32_t *msgLens, const uint8_t *publicKeys, size_t count, unsigned threads,
+    uint8_t *results)
+{
+    STATS_SCOPE(STATS_ED25519, statsTotal(msgLens, count));
+    std::vector<size_t> offsets(count);
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        offsets[i] = total;
+        total += msgLens[i];
+    }
+
+    parallelFor(count, threads, [&](size_t i) {
+        results[i] = fast_crypto_ed25519_verify(sigs + i * ED25519_SIGNATURE_LENGTH,
+            msgs + offsets[i], msgLens[i], publicKeys + i * ED25519_PUBKEY_LENGTH);
+    });
+
+    size_t valid = 0;
+    for (size_t i = 0; i < count; ++i) valid += results[i];
+    return valid;
+}
+
+/**
+ * Follows a SLIP-0010 Ed25519 path from a key, where `node` holds the
+ * private key followed by the chain code, as HMAC-SHA512 produces them.
+ */
+static int slip10Ed25519Descend(uint8_t *node, const uint32_t *path, size_t pathLen)
+{
+    for (size_t i = 0; i < pathLen; ++i) {
+        if ((path[i] & SLIP10_HARDENED) == 0) return 0;
+    }
+
+    uint8_t data[1 + ED25519_PRIVKEY_LENGTH + 4];
+    data[0] = 0;
+    for (size_t i = 0; i < pathLen; ++i) {
+        memcpy(data + 1, node, ED25519_PRIVKEY_LENGTH);
+        data[33] = path[i] >> 24;
+        data[34] = path[i] >> 16;
+        data[35] = path[i] >> 8;
+        data[36] = path[i];
+        HMAC_SHA512(node + ED25519_PRIVKEY_LENGTH, 32, data, sizeof(data), node);
+    }
+    memset(data, 0, sizeof(data));
+    return 1;
+}
+
+static void slip10Ed25519Master(const uint8_t *seed, size_t seedLen, uint8_t *node)
+{
+    static const char key[] = "ed25519 seed";
+    HMAC_SHA512(key, sizeof(key) - 1, seed, seedLen, node);
+}
+
+int fast_crypto_slip10_ed25519_derive(const uint8_t *seed, size_t seedLen,
+    const uint32_t *path, size_t pathLen, uint8_t *privateKey, uint8_t *chainCode)
+{
+    STATS_SCOPE(STATS_ED25519, seedLen);
+    uint8_t node[64];
+    slip10Ed25519Master(seed, seedLen, node);
+    int success = slip10Ed25519Descend(node, path, pathLen);
+    if (success) {
+        memcpy(privateKey, node, ED25519_PRIVKEY_LENGTH);
+        if (chainCode != NULL) memcpy(chainCode, node + ED25519_PRIVKEY_LENGTH, 32);
+    }
+    memset(node, 0, sizeof(node));
+    return success;
+}
+
+size_t fast_crypto_slip10_ed25519_derive_batch(const uint8_t *seed, size_t seedLen,
+    const uint32_t *paths, const uint32_t *pathLens, size_t count, unsigned threads,
+    uint8_t *privateKeys, uint8_t *publicKeys)
+{
+    STATS_SCOPE(STATS_ED25519, statsTotal(pathLens, count) * 4);
+    std::vector<size_t> offsets(count);
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        offsets[i] = total;
+        total += pathLens[i];
+    }
+
+    // Every path starts from the same master key:
+    uint8_t master[64];
+    slip10Ed25519Master(seed, seedLen, master);
+
+    std::atomic<size_t> derived(0);
+    parallelFor(count, threads, [&](size_t i) {
+        uint8_t *privateKey = privateKeys + i * ED25519_PRIVKEY_LENGTH;
+        uint8_t *publicKey = publicKeys != NULL ? publicKeys + i * ED25519_PUBKEY_LENGTH : NULL;
+        uint8_t node[64];
+        memcpy(node, master, sizeof(node));
+        if (slip10Ed25519Descend(node, paths + offsets[i], pathLens[i])) {
+            memcpy(privateKey, node, ED25519_PRIVKEY_LENGTH);
+            if (publicKey != NULL) Ed25519_PublicKey(privateKey, publicKey);
+            derived.fetch_add(1);
+        } else {
+            memset(privateKey, 0, ED25519_PRIVKEY_LENGTH);
+            if (publicKey != NULL) memset(publicKey, 0, ED25519_PUBKEY_LENGTH);
+        }
+        memset(node, 0, sizeof(node));
+    });
+
+    memset(master, 0, sizeof(master));
+    return derived.load();
+}
+
+/**
+ * Holds a fixed number of threads at a sync point,
+ * releasing them once the last one arrives.
+ */
+class Barrier {
+public:
+    explicit Barrier(unsigned count): count(count) {}
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        unsigned arrival = generation;
+        if (++waiting == count) {
+            waiting = 0;
+            ++generation;
+            released.notify_all();
+            return;
+        }
+        released.wait(lock, [&]() { return generation != arrival; });
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable released;
+    unsigned count;
+    unsigned waiting = 0;
+    unsigned generation = 0;
+};
+
+static_assert(ARGON2_IMPLEMENTATION_AUTO == ARGON2_IMPL_AUTO, "Argon2 implementation ids");
+static_assert(ARGON2_IMPLEMENTATION_PORTABLE == ARGON2_IMPL_PORTABLE, "Argon2 implementation ids");
+static_assert(ARGON2_IMPLEMENTATION_SSSE3 == ARGON2_IMPL_SSSE3, "Argon2 implementation ids");
+static_assert(ARGON2_IMPLEMENTATION_AVX2 == ARGON2_IMPL_AVX2, "Argon2 implementation ids");
+static_assert(ARGON2_IMPLEMENTATION_NEON == ARGON2_IMPL_NEON, "Argon2 implementation ids");
+
+int fast_crypto_argon2id(const uint8_t *passwd, size_t passwdlen, const uint8_t *salt,
+    size_t saltlen, uint32_t t, uint32_t m, uint32_t p, unsigned threads,
+    uint8_t *out, size_t outlen)
+{
+    STATS_SCOPE(STATS_ARGON2ID, outlen);
+    size_t blocks = Argon2id_Blocks(m, p);
+    if (blocks == 0 || blocks > SIZE_MAX / ARGON2_BLOCK_SIZE) return 0;
+    const size_t size = blocks * ARGON2_BLOCK_SIZE;
+
+    // The arena keeps released mappings for the next call of the same
+    // size, which skips the mmap and guard page setup. Their pages were
+    // given back, though, so every derivation faults them in again:
+    uint64_t *memory = static_cast<uint64_t *>(Arena_Alloc(size));
+    if (memory == NULL) return 0;
+
+    ARGON2_CTX ctx;
+    if (Argon2id_Init(&ctx, passwd, passwdlen, salt, saltlen, NULL, 0, NULL, 0,
+            t, m, p, outlen, memory) != 0) {
+        Arena_Free(memory, size);
+        return 0;
+    }
+
+    // Each worker owns every `threads`-th lane, and all of them
+    // have to finish a slice before any lane starts the next one:
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    if (threads > p) threads = p;
+
+    // The lanes are split by the number of threads that actually
+    // started, so workers wait to hear that number before filling:
+    std::mutex startMutex;
+    std::condition_variable started;
+    std::unique_ptr<Barrier> barrier;
+    auto worker = [&](unsigned id) {
+        {
+            std::unique_lock<std::mutex> lock(startMutex);
+            started.wait(lock, [&]() { return barrier != nullptr; });
+        }
+        for (uint32_t pass = 0; pass < t; ++pass) {
+            for (uint32_t slice = 0; slice < ARGON2_SYNC_POINTS; ++slice) {
+                for (uint32_t lane = id; lane < p; lane += threads) {
+                    Argon2id_FillSegment(&ctx, pass, slice, lane);
+                }
+                barrier->wait();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (unsigned i = 1; i < threads; ++i) {
+        try {
+            workers.emplace_back(worker, i);
+        } catch (const std::system_error &) {
+            break;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(startMutex);
+        threads = workers.size() + 1;
+        barrier.reset(new Barrier(threads));
+    }
+    started.notify_all();
+    worker(0);
+    for (auto &thread : workers) thread.join();
+
+    Argon2id_Final(&ctx, out);
+    Arena_Free(memory, size);
+    return 1;
+}
+
+int fast_crypto_argon2_set_implementation(int implementation)
+{
+    return Argon2_SetImplementation(implementation) == 0;
+}
+
+int fast_crypto_argon2_get_implementation(void)
+{
+    return Argon2_GetImplementation();
+}
+
+/**
+ * NFKD-normalizes some UTF-8 text into `out`, after an ASCII `prefix`.
+ * Returns false if the text is not valid UTF-8.
+ */
+static bool bip39Normalize(const uint8_t *in, size_t inLen, SecureBytes &out,
+    const char *prefix = "")
+{
+    size_t normalizedLen = NFKD_Length(in, inLen);
+    if (normalizedLen == (size_t)-1) return false;
+
+    // Size the buffer once, so no stray copies get left behind:
+    size_t prefixLen = strlen(prefix);
+    out.resize(prefixLen + normalizedLen);
+    memcpy(out.data(), prefix, prefixLen);
+    NFKD(in, inLen, out.data() + prefixLen);
+    return true;
+}
+
+/**
+ * Splits normalized text at each `separator`, calling `word(start, len)`
+ * for each piece. Stops early if `word` returns false.
+ */
+template<typename Word>
+static bool bip39Split(const SecureBytes &text, uint8_t separator, Word word)
+{
+    size_t start = 0;
+    for (size_t i = 0; i <= text.size(); ++i) {
+        if (i < text.size() && text[i] != separator) continue;
+        if (!word(text.data() + start, i - start)) return false;
+        start = i + 1;
+    }
+    return true;
+}
+
+/**
+ * Normalizes a mnemonic and checks its words, word count, and checksum.
+ * Returns a BIP39_* code.
+ */
+static int bip39Prepare(const uint8_t *mnemonic, size_t mnemonicLen,
+    const uint8_t *wordlist, size_t wordlistLen, SecureBytes &normalized)
+{
+    if (!bip39Normalize(mnemonic, mnemonicLen, normalized)) return BIP39_BAD_UTF8;
+
+    // Other wordlists get normalized the same way, then indexed:
+    std::unordered_map<std::string, uint16_t> words;
+    if (wordlist != NULL) {
+        SecureBytes list;
+        if (!bip39Normalize(wordlist, wordlistLen, list)) return BIP39_BAD_WORDLIST;
+        if (!list.empty() && list.back() == '\n') list.pop_back();
+        bip39Split(list, '\n', [&](const uint8_t *word, size_t len) {
+            uint16_t index = words.size();
+            return words.emplace(std::string((const char *)word, len), index).second;
+        });
+        if (words.size() != BIP39_WORDLIST_LENGTH) return BIP39_BAD_WORDLIST;
+    }
+
+    // Each word holds 11 bits, and the last `count / 3` bits are the checksum:
+    size_t count = std::count(normalized.begin(), normalized.end(), ' ') + 1;
+    if (count < 12 || count > 24 || count % 3 != 0) return BIP39_BAD_LENGTH;
+    uint8_t bits[33] = { 0 };
+    size_t bit = 0;
+    bool found = bip39Split(normalized, ' ', [&](const uint8_t *word, size_t len) {
+        int index;
+        if (wordlist == NULL) {
+            index = BIP39_EnglishIndex(word, len);
+        } else {
+            auto it = words.find(std::string((const char *)word, len));
+            index = it == words.end() ? -1 : it->second;
+        }
+        if (index < 0) return false;
+        for (int i = 10; i >= 0; --i, ++bit) {
+            if ((index >> i) & 1) bits[bit / 8] |= 0x80 >> (bit % 8);
+        }
+        return true;
+    });
+
+    int status = BIP39_BAD_WORD;
+    if (found) {
+        size_t checksumBits = count / 3;
+        size_t entropyLen = (count * 11 - checksumBits) / 8;
+        uint8_t hash[32];
+        SHA256_CTX ctx;
+        SHA256_Init(&ctx);
+        SHA256_Update(&ctx, bits, entropyLen);
+        SHA256_Final(hash, &ctx);
+        status = (hash[0] ^ bits[entropyLen]) >> (8 - checksumBits) == 0 ? BIP39_OK : BIP39_BAD_CHECKSUM;
+        memset(hash, 0, sizeof(hash));
+    }
+    memset(bits, 0, sizeof(bits));
+    return status;
+}
+
+/**
+ * Derives the seed and BIP32 master key for a prepared mnemonic
+ * and one passphrase. Returns a BIP39_* code.
+ */
+static int bip39Derive(const SecureBytes &mnemonic, const uint8_t *passphrase,
+    size_t passphraseLen, uint8_t *seed, uint8_t *xprv)
+{
+    SecureBytes salt;
+    if (!bip39Normalize(passphrase, passphraseLen, salt, "mnemonic")) {
+        if (seed != NULL) memset(seed, 0, BIP39_SEED_LENGTH);
+        if (xprv != NULL) memset(xprv, 0, XPRV_LENGTH);
+        return BIP39_BAD_UTF8;
+    }
+
+    uint8_t node[BIP39_SEED_LENGTH];
+    PBKDF2_SHA512(mnemonic.data(), mnemonic.size(), salt.data(), salt.size(), 2048,
+        node, sizeof(node));
+    memset(salt.data(), 0, salt.size());
+
+    int status = BIP39_OK;
+    if (xprv != NULL) {
+        // The left half is the private key, and the right half is the chain code:
+        static const char key[] = "Bitcoin seed";
+        uint8_t master[64];
+        HMAC_SHA512(key, sizeof(key) - 1, node, sizeof(node), master);
+        if (secp256k1_ec_seckey_verify(getSecp256k1Context(), master)) {
+            memcpy(xprv, master + 32, 32);
+            memcpy(xprv + 32, master, 32);
+        } else {
+            memset(xprv, 0, XPRV_LENGTH);
+            status = BIP39_BAD_MASTER_KEY;
+        }
+        memset(master, 0, sizeof(master));
+    }
+    if (seed != NULL) {
+        if (status == BIP39_OK) memcpy(seed, node, sizeof(node));
+        else memset(seed, 0, BIP39_SEED_LENGTH);
+    }
+    memset(node, 0, sizeof(node));
+    return status;
+}
+
+int fast_crypto_bip39_mnemonic_to_seed(const uint8_t *mnemonic, size_t mnemonicLen,
+    const uint8_t *passphrase, size_t passphraseLen, const uint8_t *wordlist, size_t wordlistLen,
+    uint8_t *seed, uint8_t *xprv)
+{
+    STATS_SCOPE(STATS_BIP39, mnemonicLen);
+    SecureBytes normalized;
+    int status = bip39Prepare(mnemonic, mnemonicLen, wordlist, wordlistLen, normalized);
+    if (status == BIP39_OK) {
+        status = bip39Derive(normalized, passphrase, passphraseLen, seed, xprv);
+    } else {
+        if (seed != NULL) memset(seed, 0, BIP39_SEED_LENGTH);
+        if (xprv != NULL) memset(xprv, 0, XPRV_LENGTH);
+    }
+    memset(normalized.data(), 0, normalized.size());
+    return status;
+}
+
+size_t fast_crypto_bip39_mnemonic_to_seed_batch(const uint8_t *mnemonic, size_t mnemonicLen,
+    const uint8_t *passphrases, const uint32_t *passphraseLens, size_t count,
+    const uint8_t *wordlist, size_t wordlistLen, unsigned threads,
+    uint8_t *seeds, uint8_t *xprvs, uint8_t *statuses)
+{
+    STATS_SCOPE(STATS_BIP39, count * mnemonicLen);
+    SecureBytes normalized;
+    int status = bip39Prepare(mnemonic, mnemonicLen, wordlist, wordlistLen, normalized);
+    if (status != BIP39_OK) {
+        for (size_t i = 0; i < count; ++i) statuses[i] = status;
+        if (seeds != NULL) memset(seeds, 0, count * BIP39_SEED_LENGTH);
+        if (xprvs != NULL) memset(xprvs, 0, count * XPRV_LENGTH);
+        memset(normalized.data(), 0, normalized.size());
+        return 0;
+    }
+
+    std::vector<size_t> offsets(count);
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        offsets[i] = total;
+        total += passphraseLens[i];
+    }
+
+    std::atomic<size_t> successes(0);
+    parallelFor(count, threads, [&](size_t i) {
+        statuses[i] = bip39Derive(normalized, passphrases + offsets[i], passphraseLens[i],
+            seeds != NULL ? seeds + i * BIP39_SEED_LENGTH : NULL,
+            xprvs != NULL ? xprvs + i * XPRV_LENGTH : NULL);
+        if (statuses[i] == BIP39_OK) successes.fetch_add(1);
+    });
+
+    memset(normalized.data(), 0, normalized.size());
+    return successes.load();
+}
+
+static_assert(SEGWIT_ADDRESS_MAX < ADDRESS_MAX_LENGTH, "segwit address size");
+static_assert(SEGWIT_PROGRAM_MAX <= ADDRESS_PAYLOAD_MAX_LENGTH, "segwit program size");
+static_assert(CASHADDR_HASH_MAX <= ADDRESS_PAYLOAD_MAX_LENGTH, "cashaddr hash size");
+// Each base58 character holds less than 3/4 of a byte:
+static_assert(ADDRESS_MAX_LENGTH * 3 / 4 <= ADDRESS_PAYLOAD_MAX_LENGTH, "base58 payload size");
+
+/**
+ * Encodes one address as a NUL-terminated string into `out`,
+ * which holds ADDRESS_MAX_LENGTH bytes.
+ * Returns false if the payload cannot be encoded, or would not fit.
+ */
+static bool addressEncode(int format, const uint8_t *prefix, size_t prefixLen, uint32_t version,
+    const uint8_t *payload, size_t payloadLen, char *out)
+{
+    const char *text = (const char *)prefix;
+    size_t len = 0;
+    bool ok = false;
+    if (format == ADDRESS_BASE58CHECK) {
+        // The 4-byte checksum goes on the end:
+        uint8_t data[ADDRESS_PAYLOAD_MAX_LENGTH];
+        size_t dataLen = prefixLen + payloadLen;
+        if (dataLen <= sizeof(data) && BASE58_ENCODED_MAX(dataLen + 4) < ADDRESS_MAX_LENGTH) {
+            memcpy(data, prefix, prefixLen);
+            memcpy(data + prefixLen, payload, payloadLen);
+            len = Base58Check_Encode(data, dataLen, out);
+            ok = len > 0;
+            memset(data, 0, sizeof(data));
+        }
+    } else if (format == ADDRESS_SEGWIT) {
+        ok = version <= 16 &&
+            Segwit_Encode(out, &len, text, prefixLen, version, payload, payloadLen) == 0;
+    } else if (format == ADDRESS_CASHADDR) {
+        ok = version <= 15 && CASHADDR_ADDRESS_MAX(prefixLen) < ADDRESS_MAX_LENGTH &&
+            CashAddr_Encode(out, &len, text, prefixLen, version, payload, payloadLen) == 0;
+    }
+    out[ok ? len : 0] = '\0';
+    return ok;
+}
+
+/**
+ * Decodes one address into `payload`, which holds
+ * ADDRESS_PAYLOAD_MAX_LENGTH bytes.
+ * Returns false if the address is invalid.
+ */
+static bool addressDecode(int format, const uint8_t *prefix, size_t prefixLen,
+    const char *address, size_t addressLen, uint8_t *payload, uint32_t *payloadLen,
+    int32_t *version)
+{
+    const char *text = (const char *)prefix;
+    size_t len = 0;
+    int type = 0;
+    bool ok = false;
+    if (format == ADDRESS_BASE58CHECK) {
+        // The version bytes have to match, and are not part of the payload:
+        uint8_t data[ADDRESS_MAX_LENGTH];
+        if (addressLen < sizeof(data) &&
+            Base58Check_Decode(address, addressLen, data, &len) == 0 && len >= prefixLen &&
+            memcmp(data, prefix, prefixLen) == 0) {
+            len -= prefixLen;
+            memcpy(payload, data + prefixLen, len);
+            ok = true;
+        }
+        memset(data, 0, sizeof(data));
+    } else if (format == ADDRESS_SEGWIT) {
+        ok = Segwit_Decode(&type, payload, &len, text, prefixLen, address, addressLen) == 0;
+    } else if (format == ADDRESS_CASHADDR) {
+        ok = CashAddr_Decode(&type, payload, &len, text, prefixLen, address, addressLen) == 0;
+    }
+    *payloadLen = ok ? len : 0;
+    *version = ok ? type : -1;
+    return ok;
+}
+
+size_t fast_crypto_address_encode_batch(int format, const uint8_t *prefix, size_t prefixLen,
+    uint32_t version, const uint8_t *payloads, const uint32_t *payloadLens, size_t count,
+    unsigned threads, char *addresses)
+{
+    STATS_SCOPE(STATS_ADDRESS, statsTotal(payloadLens, count));
+    std::vector<size_t> offsets(count);
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        offsets[i] = total;
+        total += payloadLens[i];
+    }
+
+    std::atomic<size_t> successes(0);
+    parallelFor(count, threads, [&](size_t i) {
+        if (addressEncode(format, prefix, prefixLen, version, payloads + offsets[i],
+            payloadLens[i], addresses + i * ADDRESS_MAX_LENGTH)) {
+            successes.fetch_add(1);
+        }
+    });
+    return successes.load();
+}
+
+size_t fast_crypto_address_decode_batch(int format, const uint8_t *prefix, size_t prefixLen,
+    const char *addresses, const uint32_t *addressLens, size_t count, unsigned threads,
+    uint8_t *payloads, uint32_t *payloadLens, int32_t *versions)
+{
+    STATS_SCOPE(STATS_ADDRESS, statsTotal(addressLens, count));
+    std::vector<size_t> offsets(count);
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        offsets[i] = total;
+        total += addressLens[i];
+    }
+
+    std::atomic<size_t> successes(0);
+    parallelFor(count, threads, [&](size_t i) {
+        if (addressDecode(format, prefix, prefixLen, addresses + offsets[i], addressLens[i],
+            payloads + i * ADDRESS_PAYLOAD_MAX_LENGTH, &payloadLens[i], &versions[i])) {
+            successes.fetch_add(1);
+        }
+    });
+    return successes.load();
+}
+
+/**
+ * Each thread keeps its own DRBG, so requests never contend for a lock.
+ * The state is wiped when the thread exits.
+ */
+struct ThreadDrbg {
+    DRBG_CTX ctx;
+    ThreadDrbg() { DRBG_Init(&ctx); }
+    ~ThreadDrbg() { DRBG_Clear(&ctx); }
+};
+
+static DRBG_CTX *getThreadDrbg()
+{
+    static thread_local ThreadDrbg drbg;
+    return &drbg.ctx;
+}
+
+int fast_crypto_random_bytes(uint8_t *out, size_t len)
+{
+    STATS_SCOPE(STATS_RANDOM, len);
+    return DRBG_Generate(getThreadDrbg(), out, len) == 0;
+}
+
+/**
+ * Returns the public key size for a KEYGEN_* type, or 0 if it is unknown.
+ */
+static size_t keygenPublicKeyLength(int keyType)
+{
+    switch (keyType) {
+    case KEYGEN_SECP256K1_COMPRESSED: return COMPRESSED_PUBKEY_LENGTH;
+    case KEYGEN_SECP256K1_UNCOMPRESSED: return DECOMPRESSED_PUBKEY_LENGTH;
+    case KEYGEN_SECP256K1_XONLY: return XONLY_PUBKEY_LENGTH;
+    case KEYGEN_ED25519: return ED25519_PUBKEY_LENGTH;
+    default: return 0;
+    }
+}
+
+/**
+ * Turns random bytes into a valid private key, drawing again in the
+ * unlikely case they are not one, then creates its public key.
+ * Returns false if the OS entropy source failed.
+ */
+static bool keygenCreate(secp256k1_context *secp256k1ctx, int keyType, uint8_t *privateKey,
+    uint8_t *publicKey)
+{
+    if (keyType == KEYGEN_ED25519) {
+        if (publicKey != NULL) Ed25519_PublicKey(privateKey, publicKey);
+        return true;
+    }
+
+    while (!secp256k1_ec_seckey_verify(secp256k1ctx, privateKey)) {
+        if (!fast_crypto_random_bytes(privateKey, SECRET_KEY_LENGTH)) return false;
+    }
+    if (publicKey == NULL) return true;
+    if (keyType == KEYGEN_SECP256K1_XONLY) {
+        return fast_crypto_secp256k1_xonly_pubkey_create(privateKey, publicKey);
+    }
+
+    secp256k1_pubkey pubkey;
+    size_t publicKeyLen = keygenPublicKeyLength(keyType);
+    return secp256k1_ec_pubkey_create(secp256k1ctx, &pubkey, privateKey) &&
+        secp256k1_ec_pubkey_serialize(secp256k1ctx, publicKey, &publicKeyLen, &pubkey,
+            keyType == KEYGEN_SECP256K1_COMPRESSED ? SECP256K1_EC_COMPRESSED : SECP256K1_EC_UNCOMPRESSED);
+}
+
+size_t fast_crypto_keys_generate_batch(int keyType, size_t count, unsigned threads,
+    uint8_t *privateKeys, uint8_t *publicKeys)
+{
+    STATS_SCOPE(STATS_RANDOM, count * SECRET_KEY_LENGTH);
+    size_t publicKeyLen = keygenPublicKeyLength(keyType);
+    if (publicKeyLen == 0) return 0;
+
+    // A single request covers every key, so the workers only create public keys:
+    if (!fast_crypto_random_bytes(privateKeys, count * SECRET_KEY_LENGTH)) {
+        if (publicKeys != NULL) memset(publicKeys, 0, count * publicKeyLen);
+        return 0;
+    }
+
+    secp256k1_context *secp256k1ctx = getSecp256k1Context();
+    std::atomic<size_t> successes(0);
+    parallelFor(count, threads, [&](size_t i) {
+        uint8_t *privateKey = privateKeys + i * SECRET_KEY_LENGTH;
+        uint8_t *publicKey = publicKeys != NULL ? publicKeys + i * publicKeyLen : NULL;
+        if (keygenCreate(secp256k1ctx, keyType, privateKey, publicKey)) {
+            successes.fetch_add(1);
+        } else {
+            memset(privateKey, 0, SECRET_KEY_LENGTH);
+            if (publicKey != NULL) memset(publicKey, 0, publicKeyLen);
+        }
+    });
+    return successes.load();
+}
+
+static_assert(CODEC_IMPLEMENTATION_AUTO == CODEC_IMPL_AUTO, "Codec implementation ids");
+static_assert(CODEC_IMPLEMENTATION_PORTABLE == CODEC_IMPL_PORTABLE, "Codec implementation ids");
+static_assert(CODEC_IMPLEMENTATION_SSSE3 == CODEC_IMPL_SSSE3, "Codec implementation ids");
+static_assert(CODEC_IMPLEMENTATION_AVX2 == CODEC_IMPL_AVX2, "Codec implementation ids");
+static_assert(CODEC_IMPLEMENTATION_NEON == CODEC_IMPL_NEON, "Codec implementation ids");
+
+size_t fast_crypto_base64_encode(const uint8_t *in, size_t inLen, char *out)
+{
+    STATS_SCOPE(STATS_CODEC, inLen);
+    size_t outLen = BASE64_ENCODED_LENGTH(inLen);
+    Base64_Encode(in, inLen, out);
+    out[outLen] = 0;
+    return outLen;
+}
+
+int fast_crypto_base64_decode(const char *in, size_t inLen, uint8_t *out, size_t *outLen,
+    size_t *errorPos)
+{
+    STATS_SCOPE(STATS_CODEC, inLen);
+    return Base64_Decode(in, inLen, out, outLen, errorPos) == 0;
+}
+
+size_t fast_crypto_hex_encode(const uint8_t *in, size_t inLen, char *out)
+{
+    STATS_SCOPE(STATS_CODEC, inLen);
+    Hex_Encode(in, inLen, out);
+    out[2 * inLen] = 0;
+    return 2 * inLen;
+}
+
+int fast_crypto_hex_decode(const char *in, size_t inLen, uint8_t *out, size_t *errorPos)
+{
+    STATS_SCOPE(STATS_CODEC, inLen);
+    return Hex_Decode(in, inLen, out, errorPos) == 0;
+}
+
+int fast_crypto_codec_set_implementation(int implementation)
+{
+    return Codec_SetImplementation(implementation) == 0;
+}
+
+int fast_crypto_codec_get_implementation(void)
+{
+    return Codec_GetImplementation();
+}
+
+static_assert(POOL_PRIORITY_INTERACTIVE == POOL_INTERACTIVE, "Pool priority ids");
+static_assert(POOL_PRIORITY_BACKGROUND == POOL_BACKGROUND, "Pool priority ids");
+
+int fast_crypto_pool_submit(int priority, void (*task)(void *context), void *context)
+{
+    return Pool_Submit(priority, task, context) == 0;
+}
+
+int fast_crypto_pool_configure(int priority, unsigned threads, size_t queueLimit,
+    const int *cpus, size_t cpuCount)
+{
+    return Pool_Configure(priority, threads, queueLimit, cpus, cpuCount) == 0;
+}
+
+size_t fast_crypto_pool_pending(int priority)
+{
+    return Pool_Pending(priority);
+}
+
+void *fast_crypto_secure_alloc(size_t size)
+{
+    return Arena_Alloc(size);
+}
+
+void fast_crypto_secure_free(void *memory, size_t size)
+{
+    Arena_Free(memory, size);
+}
+
+void fast_crypto_get_secure_memory_stats(fast_crypto_secure_memory_stats *stats)
+{
+    struct arena_stats counts;
+    Arena_GetStats(&counts);
+    stats->allocs = counts.allocs;
+    stats->frees = counts.frees;
+    stats->maps = counts.maps;
+    stats->unmaps = counts.unmaps;
+    stats->unlocked = counts.unlocked;
+    stats->inUse = counts.inuse;
+    stats->peak = counts.peak;
+    stats->mapped = counts.mapped;
+}
+
+static_assert(STATS_OP_SCRYPT == STATS_SCRYPT, "Stats operation ids");
+static_assert(STATS_OP_ARGON2ID == STATS_ARGON2ID, "Stats operation ids");
+static_assert(STATS_OP_BIP39 == STATS_BIP39, "Stats operation ids");
+static_assert(STATS_OP_PIPELINE == STATS_PIPELINE, "Stats operation ids");
+static_assert(STATS_OP_RECORDS == STATS_RECORDS, "Stats operation ids");
+static_assert(STATS_OP_AES == STATS_AES, "Stats operation ids");
+static_assert(STATS_OP_CHACHA20_POLY1305 == STATS_CHACHA20_POLY1305, "Stats operation ids");
+static_assert(STATS_OP_SECP256K1_KEYS == STATS_SECP256K1_KEYS, "Stats operation ids");
+static_assert(STATS_OP_ECDSA == STATS_ECDSA, "Stats operation ids");
+static_assert(STATS_OP_SCHNORR == STATS_SCHNORR, "Stats operation ids");
+static_assert(STATS_OP_ED25519 == STATS_ED25519, "Stats operation ids");
+static_assert(STATS_OP_ADDRESS == STATS_ADDRESS, "Stats operation ids");
+static_assert(STATS_OP_CODEC == STATS_CODEC, "Stats operation ids");
+static_assert(STATS_OP_RANDOM == STATS_RANDOM, "Stats operation ids");
+static_assert(STATS_OP_COUNT == STATS_OPS, "Stats operation ids");
+static_assert(STATS_HISTOGRAM_BUCKETS == STATS_BUCKETS, "Stats histogram buckets");
+
+int fast_crypto_get_stats(fast_crypto_op_stats *ops, size_t count)
+{
+    memset(ops, 0, count * sizeof(fast_crypto_op_stats));
+#if FAST_CRYPTO_STATS
+    for (size_t i = 0; i < count && i < STATS_OP_COUNT; ++i) {
+        struct stats_op op;
+        Stats_Get(i, &op);
+        ops[i].calls = op.calls;
+        ops[i].bytes = op.bytes;
+        ops[i].totalNs = op.totalns;
+        ops[i].maxNs = op.maxns;
+        memcpy(ops[i].histogram, op.histogram, sizeof(ops[i].histogram));
+    }
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+void fast_crypto_stats_snapshot(uint8_t *out)
+{
+    fast_crypto_op_stats ops[STATS_OP_COUNT];
+    fast_crypto_secure_memory_stats memory;
+    memset(out, 0, STATS_SNAPSHOT_LENGTH);
+    out[0] = (uint8_t) fast_crypto_get_stats(ops, STATS_OP_COUNT);
+    fast_crypto_get_secure_memory_stats(&memory);
+
+    uint64_t header[3] = { memory.inUse, memory.peak, memory.unlocked };
+    memcpy(out + 8, header, sizeof(header));
+    uint8_t *p = out + 32;
+    for (const fast_crypto_op_stats &op : ops) {
+        uint64_t fields[4] = { op.calls, op.bytes, op.totalNs, op.maxNs };
+        memcpy(p, fields, sizeof(fields));
+        memcpy(p + sizeof(fields), op.histogram, sizeof(op.histogram));
+        p += sizeof(fields) + sizeof(op.histogram);
+    }
+}
+
+void fast_crypto_reset_stats(void)
+{
+#if FAST_CRYPTO_STATS
+    Stats_Reset();
+#endif
+    Arena_ResetPeak();
+}
+
+int fast_crypto_trace_start(size_t maxEvents)
+{
+#if FAST_CRYPTO_STATS
+    return Stats_TraceStart(maxEvents) == 0;
+#else
+    (void) maxEvents;
+    return 0;
+#endif
+}
+
+size_t fast_crypto_trace_stop(char *json, size_t jsonLen)
+{
+#if FAST_CRYPTO_STATS
+    Stats_TraceStop();
+    return Stats_TraceJson(json, jsonLen);
+#else
+    if (jsonLen != 0) json[0] = '\0';
+    return 0;
+#endif
+}
+
+/**
+ * One decoded pipeline step.
+ */
+struct PipelineStep {
+    unsigned op;
+    unsigned dst;
+    unsigned src[3];
+    uint32_t params[4];
+};
+
+/**
+ * The sources each pipeline op reads, and whether it writes its
+ * destination, indexed by op.
+ */
+static const struct {
+    unsigned sources;
+    bool writes;
+} pipelineOps[] = {
+    {2, true}, // PIPELINE_SCRYPT
+    {2, true}, // PIPELINE_ARGON2ID
+    {1, true}, // PIPELINE_SHA256
+    {2, true}, // PIPELINE_HMAC_SHA256
+    {2, true}, // PIPELINE_HMAC_SHA512
+    {1, true}, // PIPELINE_SLICE
+    {2, true}, // PIPELINE_CONCAT
+    {2, false}, // PIPELINE_VERIFY
+    {3, true}, // PIPELINE_AES256_CBC_ENCRYPT
+    {3, true}, // PIPELINE_AES256_CBC_DECRYPT
+};
+
+static_assert(sizeof(pipelineOps) / sizeof(pipelineOps[0]) == PIPELINE_AES256_CBC_DECRYPT + 1,
+    "Pipeline ops");
+
+static uint32_t readLe32(const uint8_t *bytes)
+{
+    return (uint32_t)bytes[0] | (uint32_t)bytes[1] << 8 |
+        (uint32_t)bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+}
+
+/**
+ * Returns how long a pipeline step's output can be, given upper bounds
+ * on its sources' lengths, or 0 if the step can never succeed.
+ * Outputs that can legitimately be empty report 1, since the bound only
+ * needs to be big enough.
+ */
+static size_t pipelineStepBound(const PipelineStep &step, const size_t *bounds)
+{
+    const uint32_t *p = step.params;
+    size_t a = bounds[step.src[0]];
+    size_t b = bounds[step.src[1]];
+    size_t c = bounds[step.src[2]];
+    switch (step.op) {
+    case PIPELINE_SCRYPT:
+        // N must be a power of two, and r or p of 0 would divide by zero:
+        if (p[0] < 2 || (p[0] & (p[0] - 1)) != 0 || p[1] == 0 || p[2] == 0) return 0;
+        return p[3] <= PIPELINE_MAX_LENGTH ? p[3] : 0;
+    case PIPELINE_ARGON2ID: {
+        // The limits Argon2id_Init and fast_crypto_argon2id check,
+        // so a bad step fails before any earlier KDF step runs:
+        size_t blocks = Argon2id_Blocks(p[1], p[2]);
+        if (p[0] == 0 || blocks == 0 || blocks > SIZE_MAX / ARGON2_BLOCK_SIZE || p[3] < 4) return 0;
+        return p[3] <= PIPELINE_MAX_LENGTH ? p[3] : 0;
+    }
+    case PIPELINE_SHA256:
+    case PIPELINE_HMAC_SHA256:
+        return 32;
+    case PIPELINE_HMAC_SHA512:
+        return 64;
+    case PIPELINE_SLICE:
+        if ((uint64_t)p[0] + p[1] > a) return 0;
+        return std::max<size_t>(p[1], 1);
+    case PIPELINE_CONCAT:
+        if (a + b > PIPELINE_MAX_LENGTH) return 0;
+        return std::max<size_t>(a + b, 1);
+    case PIPELINE_VERIFY:
+        return 1;
+    case PIPELINE_AES256_CBC_ENCRYPT:
+        if (p[0] > 1 || a < AES256_KEY_LENGTH || b < AES_BLOCK_LENGTH) return 0;
+        c = p[0] ? c / AES_BLOCK_LENGTH * AES_BLOCK_LENGTH + AES_BLOCK_LENGTH : c;
+        if (c > PIPELINE_MAX_LENGTH) return 0;
+        return std::max<size_t>(c, 1);
+    case PIPELINE_AES256_CBC_DECRYPT:
+        if (p[0] > 1 || a < AES256_KEY_LENGTH || b < AES_BLOCK_LENGTH) return 0;
+        return std::max<size_t>(c, 1);
+    }
+    return 0;
+}
+
+/**
+ * Decodes and checks a pipeline program, tracking an upper bound on
+ * each slot's length as the steps run, so bad programs fail before
+ * any expensive step starts.
+ */
+static int pipelinePlan(const uint8_t *steps, size_t stepCount,
+    const uint32_t *inputLens, size_t inputCount, unsigned outputSlot,
+    std::vector<PipelineStep> &program, size_t *outSize, size_t *failedStep)
+{
+    *failedStep = 0;
+    if (inputCount > PIPELINE_SLOTS) return PIPELINE_BAD_STEP;
+    bool filled[PIPELINE_SLOTS] = {};
+    size_t bounds[PIPELINE_SLOTS] = {};
+    for (size_t i = 0; i < inputCount; ++i) {
+        if (inputLens[i] > PIPELINE_MAX_LENGTH) return PIPELINE_BAD_STEP;
+        filled[i] = true;
+        bounds[i] = inputLens[i];
+    }
+
+    if (stepCount > PIPELINE_MAX_STEPS) {
+        *failedStep = PIPELINE_MAX_STEPS;
+        return PIPELINE_BAD_STEP;
+    }
+    program.resize(stepCount);
+    for (size_t i = 0; i < stepCount; ++i) {
+        const uint8_t *bytes = steps + i * PIPELINE_STEP_LENGTH;
+        PipelineStep &step = program[i];
+        *failedStep = i;
+
+        step.op = bytes[0];
+        step.dst = bytes[1];
+        for (unsigned j = 0; j < 3; ++j) step.src[j] = bytes[2 + j];
+        for (unsigned j = 0; j < 4; ++j) step.params[j] = readLe32(bytes + 8 + 4 * j);
+        if (bytes[5] != 0 || bytes[6] != 0 || bytes[7] != 0) return PIPELINE_BAD_STEP;
+        if (step.op >= sizeof(pipelineOps) / sizeof(pipelineOps[0])) return PIPELINE_BAD_STEP;
+
+        // Unused sources are ignored, so point them at slot 0:
+        for (unsigned j = 0; j < 3; ++j) {
+            if (j >= pipelineOps[step.op].sources) {
+                step.src[j] = 0;
+            } else if (step.src[j] >= PIPELINE_SLOTS || !filled[step.src[j]]) {
+                return PIPELINE_BAD_STEP;
+            }
+        }
+        if (step.dst >= PIPELINE_SLOTS) return PIPELINE_BAD_STEP;
+
+        size_t bound = pipelineStepBound(step, bounds);
+        if (bound == 0) return PIPELINE_BAD_STEP;
+        if (pipelineOps[step.op].writes) {
+            filled[step.dst] = true;
+            bounds[step.dst] = bound;
+        }
+    }
+
+    *failedStep = stepCount;
+    if (outputSlot >= PIPELINE_SLOTS || !filled[outputSlot]) return PIPELINE_BAD_STEP;
+    *outSize = bounds[outputSlot];
+    return PIPELINE_OK;
+}
+
+/**
+ * Zeroes a buffer, including any capacity it has been trimmed from.
+ */
+static void wipeBytes(SecureBytes &bytes)
+{
+    bytes.resize(bytes.capacity());
+    if (!bytes.empty()) memset(bytes.data(), 0, bytes.size());
+    bytes.clear();
+}
+
+/**
+ * The values a pipeline works on, which are wiped as they are replaced.
+ * The arena wipes whatever is left when the pipeline finishes.
+ */
+struct PipelineSlots {
+    SecureBytes slots[PIPELINE_SLOTS];
+
+    void store(unsigned dst, SecureBytes &value) {
+        wipeBytes(slots[dst]);
+        slots[dst].swap(value);
+    }
+};
+
+/**
+ * Runs one step of a checked pipeline, writing its output into `out`.
+ */
+static int pipelineStep(const PipelineStep &step, const PipelineSlots &values,
+    SecureBytes &out)
+{
+    const uint32_t *p = step.params;
+    const SecureBytes &a = values.slots[step.src[0]];
+    const SecureBytes &b = values.slots[step.src[1]];
+    const SecureBytes &c = values.slots[step.src[2]];
+    switch (step.op) {
+    case PIPELINE_SCRYPT:
+        out.resize(p[3]);
+        if (crypto_scrypt(a.data(), a.size(), b.data(), b.size(), p[0], p[1], p[2],
+                out.data(), out.size()) != 0) {
+            return PIPELINE_KDF_FAILED;
+        }
+        return PIPELINE_OK;
+
+    case PIPELINE_ARGON2ID:
+        out.resize(p[3]);
+        if (!fast_crypto_argon2id(a.data(), a.size(), b.data(), b.size(), p[0], p[1], p[2], 0,
+                out.data(), out.size())) {
+            return PIPELINE_KDF_FAILED;
+        }
+        return PIPELINE_OK;
+
+    case PIPELINE_SHA256: {
+        SHA256_CTX ctx;
+        out.resize(32);
+        SHA256_Init(&ctx);
+        SHA256_Update(&ctx, a.data(), a.size());
+        SHA256_Final(out.data(), &ctx);
+        return PIPELINE_OK;
+    }
+
+    case PIPELINE_HMAC_SHA256: {
+        HMAC_SHA256_CTX ctx;
+        out.resize(32);
+        HMAC_SHA256_Init(&ctx, a.data(), a.size());
+        HMAC_SHA256_Update(&ctx, b.data(), b.size());
+        HMAC_SHA256_Final(out.data(), &ctx);
+        memset(&ctx, 0, sizeof(ctx));
+        return PIPELINE_OK;
+    }
+
+    case PIPELINE_HMAC_SHA512:
+        out.resize(64);
+        HMAC_SHA512(a.data(), a.size(), b.data(), b.size(), out.data());
+        return PIPELINE_OK;
+
+    case PIPELINE_SLICE:
+        // Earlier steps may have produced less than their bound:
+        if ((uint64_t)p[0] + p[1] > a.size()) return PIPELINE_BAD_LENGTH;
+        out.assign(a.begin() + p[0], a.begin() + p[0] + p[1]);
+        return PIPELINE_OK;
+
+    case PIPELINE_CONCAT:
+        out.reserve(a.size() + b.size());
+        out.assign(a.begin(), a.end());
+        out.insert(out.end(), b.begin(), b.end());
+        return PIPELINE_OK;
+
+    case PIPELINE_VERIFY: {
+        if (a.size() != b.size()) return PIPELINE_MISMATCH;
+        uint8_t diff = 0;
+        for (size_t i = 0; i < a.size(); ++i) diff |= a[i] ^ b[i];
+        return diff == 0 ? PIPELINE_OK : PIPELINE_MISMATCH;
+    }
+
+    case PIPELINE_AES256_CBC_ENCRYPT:
+    case PIPELINE_AES256_CBC_DECRYPT: {
+        if (a.size() != AES256_KEY_LENGTH || b.size() != AES_BLOCK_LENGTH) return PIPELINE_BAD_LENGTH;
+        if (c.size() % AES_BLOCK_LENGTH != 0 && (step.op == PIPELINE_AES256_CBC_DECRYPT || !p[0])) {
+            return PIPELINE_BAD_LENGTH;
+        }
+        size_t outLen;
+        if (step.op == PIPELINE_AES256_CBC_ENCRYPT) {
+            out.resize(p[0] ? c.size() / AES_BLOCK_LENGTH * AES_BLOCK_LENGTH + AES_BLOCK_LENGTH : c.size());
+            fast_crypto_aes256_cbc_encrypt(a.data(), b.data(), c.data(), c.size(), p[0], out.data(), &outLen);
+        } else {
+            if (p[0] && c.empty()) return PIPELINE_BAD_LENGTH;
+            out.resize(c.size());
+            if (!fast_crypto_aes256_cbc_decrypt(a.data(), b.data(), c.data(), c.size(), p[0],
+                    out.data(), &outLen)) {
+                return PIPELINE_BAD_PADDING;
+            }
+        }
+        out.resize(outLen);
+        return PIPELINE_OK;
+    }
+    }
+    return PIPELINE_BAD_STEP;
+}
+
+int fast_crypto_pipeline_check(const uint8_t *steps, size_t stepCount,
+    const uint32_t *inputLens, size_t inputCount, unsigned outputSlot,
+    size_t *outSize, size_t *failedStep)
+{
+    std::vector<PipelineStep> program;
+    return pipelinePlan(steps, stepCount, inputLens, inputCount, outputSlot,
+        program, outSize, failedStep);
+}
+
+int fast_crypto_pipeline_run(const uint8_t *steps, size_t stepCount,
+    const uint8_t *inputs, const uint32_t *inputLens, size_t inputCount,
+    unsigned outputSlot, uint8_t *out, size_t *outLen, size_t *failedStep)
+{
+    STATS_SCOPE(STATS_PIPELINE, statsTotal(inputLens, inputCount));
+    *outLen = 0;
+    std::vector<PipelineStep> program;
+    size_t outSize;
+    int status = pipelinePlan(steps, stepCount, inputLens, inputCount, outputSlot,
+        program, &outSize, failedStep);
+    if (status != PIPELINE_OK) return status;
+
+    PipelineSlots values;
+    for (size_t i = 0, offset = 0; i < inputCount; offset += inputLens[i++]) {
+        values.slots[i].assign(inputs + offset, inputs + offset + inputLens[i]);
+    }
+
+    // Each step writes into a fresh buffer, so a step can
+    // overwrite one of its own sources:
+    SecureBytes result;
+    for (size_t i = 0; i < program.size(); ++i) {
+        *failedStep = i;
+        status = pipelineStep(program[i], values, result);
+        if (status == PIPELINE_OK && pipelineOps[program[i].op].writes) {
+            values.store(program[i].dst, result);
+        }
+        wipeBytes(result);
+        if (status != PIPELINE_OK) return status;
+    }
+
+    const SecureBytes &output = values.slots[outputSlot];
+    if (!output.empty()) memcpy(out, output.data(), output.size());
+    *outLen = output.size();
+    *failedStep = program.size();
+    return PIPELINE_OK;
 }
@@ -47,13 +47,1089 @@ extern "C" {
 #define COMPRESSED_PUBKEY_LENGTH 33
 #define DECOMPRESSED_PUBKEY_LENGTH 65
 #define PRIVKEY_LENGTH 64
+#define SECRET_KEY_LENGTH 32
+#define MESSAGE_HASH_LENGTH 32
+#define ECDSA_COMPACT_SIGNATURE_LENGTH 64
+#define ECDSA_DER_SIGNATURE_MAX_LENGTH 72
+#define XONLY_PUBKEY_LENGTH 32
+#define SCHNORR_SIGNATURE_LENGTH 64
+#define RECOVERABLE_SIGNATURE_LENGTH 65
+#define ETHEREUM_ADDRESS_LENGTH 20
 
-void fast_crypto_scrypt (const uint8_t *passwd, size_t passwdlen, const uint8_t *salt, size_t saltlen, uint64_t N,
+// Output formats for fast_crypto_secp256k1_ecdsa_recover_batch:
+#define RECOVER_COMPRESSED_PUBKEY 0
+#define RECOVER_UNCOMPRESSED_PUBKEY 1
+#define RECOVER_ETHEREUM_ADDRESS 2
+
+#define MUSIG_KEYAGG_CACHE_LENGTH 197
+#define MUSIG_PUBNONCE_LENGTH 66
+#define MUSIG_PARTIAL_SIG_LENGTH 32
+
+// The most secret nonces alive at once. Creating more evicts the
+// least-recently-used nonce, which then cannot sign:
+#define MUSIG_NONCE_CACHE_SIZE 1024
+
+// The most key handles alive at once. Creating more evicts the
+// least-recently-used handle, which then stops working:
+#define KEY_HANDLE_CACHE_SIZE 4096
+
+// Script types for fast_crypto_multisig_derive_batch:
+#define MULTISIG_P2SH 0
+#define MULTISIG_P2WSH 1
+#define MULTISIG_P2SH_P2WSH 2
+
+// A BIP32 extended public key, as a chain code followed by a public key:
+#define XPUB_LENGTH 65
+
+// A BIP32 extended private key, as a chain code followed by a private key:
+#define XPRV_LENGTH 64
+
+#define AES256_KEY_LENGTH 32
+#define AES_BLOCK_LENGTH 16
+#define AES_GCM_IV_LENGTH 12
+#define AES_GCM_TAG_LENGTH 16
+
+// AES implementations for fast_crypto_aes_set_implementation:
+#define AES_IMPLEMENTATION_AUTO 0
+#define AES_IMPLEMENTATION_BITSLICED 1
+#define AES_IMPLEMENTATION_AESNI 2
+#define AES_IMPLEMENTATION_ARMV8 3
+
+#define CHACHA20_POLY1305_KEY_LENGTH 32
+#define CHACHA20_POLY1305_NONCE_LENGTH 12
+#define XCHACHA20_POLY1305_NONCE_LENGTH 24
+#define CHACHA20_POLY1305_TAG_LENGTH 16
+
+// The most AEAD streams open at once. Creating more fails until
+// some finish or are released:
+#define AEAD_STREAM_LIMIT 256
+
+// ChaCha20 implementations for fast_crypto_chacha20_set_implementation:
+#define CHACHA20_IMPLEMENTATION_AUTO 0
+#define CHACHA20_IMPLEMENTATION_PORTABLE 1
+#define CHACHA20_IMPLEMENTATION_SSE2 2
+#define CHACHA20_IMPLEMENTATION_AVX2 3
+#define CHACHA20_IMPLEMENTATION_NEON 4
+
+// Encrypted storage records are an IV, the AES-256-CBC ciphertext with
+// PKCS#7 padding, and an HMAC-SHA256 of the IV and ciphertext. Their
+// key is the 32-byte AES key followed by the 32-byte HMAC key:
+#define RECORD_KEY_LENGTH 64
+#define RECORD_IV_LENGTH 16
+#define RECORD_MAC_LENGTH 32
+
+// Per-record results from fast_crypto_records_decrypt_batch:
+#define RECORD_OK 0
+#define RECORD_BAD_LENGTH 1
+#define RECORD_BAD_MAC 2
+#define RECORD_BAD_PADDING 3
+#define RECORD_KDF_FAILED 4
+
+#define ED25519_PRIVKEY_LENGTH 32
+#define ED25519_PUBKEY_LENGTH 32
+#define ED25519_SIGNATURE_LENGTH 64
+
+// SLIP-0010 only defines hardened derivation for Ed25519,
+// so every path index needs this bit set:
+#define SLIP10_HARDENED 0x80000000
+
+// Argon2 implementations for fast_crypto_argon2_set_implementation:
+#define ARGON2_IMPLEMENTATION_AUTO 0
+#define ARGON2_IMPLEMENTATION_PORTABLE 1
+#define ARGON2_IMPLEMENTATION_SSSE3 2
+#define ARGON2_IMPLEMENTATION_AVX2 3
+#define ARGON2_IMPLEMENTATION_NEON 4
+
+#define BIP39_SEED_LENGTH 64
+
+// Results from the fast_crypto_bip39_* functions:
+#define BIP39_OK 0
+#define BIP39_BAD_UTF8 1
+#define BIP39_BAD_WORDLIST 2
+#define BIP39_BAD_LENGTH 3
+#define BIP39_BAD_WORD 4
+#define BIP39_BAD_CHECKSUM 5
+#define BIP39_BAD_MASTER_KEY 6
+
+// Address formats for the fast_crypto_address_* functions:
+#define ADDRESS_BASE58CHECK 0
+#define ADDRESS_SEGWIT 1
+#define ADDRESS_CASHADDR 2
+
+// Each address in a batch gets this many bytes, including its NUL,
+// and each decoded payload gets ADDRESS_PAYLOAD_MAX_LENGTH bytes:
+#define ADDRESS_MAX_LENGTH 128
+#define ADDRESS_PAYLOAD_MAX_LENGTH 96
+
+// Key types for fast_crypto_keys_generate_batch, whose public keys are
+// COMPRESSED_PUBKEY_LENGTH, DECOMPRESSED_PUBKEY_LENGTH,
+// XONLY_PUBKEY_LENGTH, and ED25519_PUBKEY_LENGTH bytes:
+#define KEYGEN_SECP256K1_COMPRESSED 0
+#define KEYGEN_SECP256K1_UNCOMPRESSED 1
+#define KEYGEN_SECP256K1_XONLY 2
+#define KEYGEN_ED25519 3
+
+// Buffer sizes for the fast_crypto_base64_* functions, which use the
+// standard alphabet. The encoded length leaves out the NUL terminator:
+#define BASE64_ENCODED_LENGTH(len) (((len) + 2) / 3 * 4)
+#define BASE64_DECODED_MAX_LENGTH(len) (((len) + 3) / 4 * 3)
+
+// Codec implementations for fast_crypto_codec_set_implementation:
+#define CODEC_IMPLEMENTATION_AUTO 0
+#define CODEC_IMPLEMENTATION_PORTABLE 1
+#define CODEC_IMPLEMENTATION_SSSE3 2
+#define CODEC_IMPLEMENTATION_AVX2 3
+#define CODEC_IMPLEMENTATION_NEON 4
+
+// Priority classes for the fast_crypto_pool_* functions.
+// Interactive work is what a user is waiting on, while
+// background work covers key stretching and batches:
+#define POOL_PRIORITY_INTERACTIVE 0
+#define POOL_PRIORITY_BACKGROUND 1
+
+// A pipeline program for fast_crypto_pipeline_run is a list of
+// PIPELINE_STEP_LENGTH-byte steps. Each step holds an op, a destination
+// slot, three source slots, three zero bytes, and four little-endian
+// 32-bit parameters. Slots 0 to inputCount - 1 start out holding the
+// inputs, and the rest start out empty:
+#define PIPELINE_STEP_LENGTH 24
+#define PIPELINE_MAX_STEPS 64
+#define PIPELINE_SLOTS 16
+
+// No slot may grow larger than this many bytes:
+#define PIPELINE_MAX_LENGTH (16 * 1024 * 1024)
+
+// Pipeline ops. The sources are a, b, and c, and the parameters are
+// p0 to p3. Parameters an op does not list should be 0:
+#define PIPELINE_SCRYPT 0 // dst = scrypt(passwd a, salt b), N p0, r p1, p p2, p3 bytes
+#define PIPELINE_ARGON2ID 1 // dst = Argon2id(passwd a, salt b), t p0, m p1, p p2, p3 bytes
+#define PIPELINE_SHA256 2 // dst = SHA-256(a)
+#define PIPELINE_HMAC_SHA256 3 // dst = HMAC-SHA256(key a, data b)
+#define PIPELINE_HMAC_SHA512 4 // dst = HMAC-SHA512(key a, data b)
+#define PIPELINE_SLICE 5 // dst = p1 bytes of a, starting at byte p0
+#define PIPELINE_CONCAT 6 // dst = a followed by b
+#define PIPELINE_VERIFY 7 // stops unless a equals b, compared in constant time
+#define PIPELINE_AES256_CBC_ENCRYPT 8 // dst = encrypt(key a, iv b, data c), PKCS#7 if p0 is 1
+#define PIPELINE_AES256_CBC_DECRYPT 9 // dst = decrypt(key a, iv b, data c), PKCS#7 if p0 is 1
+
+// Results from the fast_crypto_pipeline_* functions:
+#define PIPELINE_OK 0
+#define PIPELINE_BAD_STEP 1
+#define PIPELINE_BAD_LENGTH 2
+#define PIPELINE_MISMATCH 3
+#define PIPELINE_BAD_PADDING 4
+#define PIPELINE_KDF_FAILED 5
+
+/**
+ * A BIP352 silent payment output found by
+ * fast_crypto_silent_payments_scan. The private key for the output is
+ * the spend key plus `tweak`, plus the label tweak if `labelIndex`
+ * is not -1.
+ */
+typedef struct {
+    uint32_t txIndex;
+    uint32_t outputIndex;
+    int32_t labelIndex;
+    uint8_t tweak[32];
+} fast_crypto_silent_payment_match;
+
+/**
+ * Derives `buflen` bytes with scrypt.
+ * Returns 1 on success, or 0 if N is not a power of two, r or p is 0,
+ * the parameters are too large, or the memory could not be allocated.
+ */
+int fast_crypto_scrypt(const uint8_t *passwd, size_t passwdlen, const uint8_t *salt, size_t saltlen, uint64_t N,
     uint32_t r, uint32_t p, uint8_t *buf, size_t buflen);
 void fast_crypto_secp256k1_ec_privkey_tweak_add(char *szPrivateKeyHex, const char *szTweak);
 void fast_crypto_secp256k1_ec_pubkey_tweak_add(char *szPublicKeyHex, const char *szTweak, int compressed);
 void fast_crypto_secp256k1_ec_pubkey_create(const char *szPrivateKeyHex, char *szPublicKeyHex, int compressed);
 
+/**
+ * Creates the public key for a 32-byte private key, in compressed
+ * (33-byte) or uncompressed (65-byte) form.
+ * Returns the length written to `publicKey`,
+ * or 0 if the private key is invalid.
+ */
+size_t fast_crypto_secp256k1_pubkey_create(const uint8_t *privateKey, int compressed,
+    uint8_t *publicKey);
+
+/**
+ * Creates `count` public keys in parallel, packed at 33 or 65 bytes
+ * apiece. Writes 1 or 0 into `results[i]` for each key, and zeroes the
+ * public keys of invalid private keys.
+ * Returns the number of keys created.
+ */
+size_t fast_crypto_secp256k1_pubkey_create_batch(const uint8_t *privateKeys, size_t count,
+    int compressed, unsigned threads, uint8_t *publicKeys, uint8_t *results);
+
+/**
+ * Adds a 32-byte tweak to a 32-byte private key, writing the result
+ * into `out`, which may be the same buffer as `privateKey`.
+ * Returns 1 on success, or 0 if the key, tweak, or result is invalid.
+ */
+int fast_crypto_secp256k1_privkey_tweak_add(const uint8_t *privateKey, const uint8_t *tweak,
+    uint8_t *out);
+
+/**
+ * Adds `count` tweaks to `count` private keys in parallel. Writes 1 or 0
+ * into `results[i]` for each key, and zeroes the failed results.
+ * Returns the number of keys tweaked.
+ */
+size_t fast_crypto_secp256k1_privkey_tweak_add_batch(const uint8_t *privateKeys,
+    const uint8_t *tweaks, size_t count, unsigned threads, uint8_t *out, uint8_t *results);
+
+/**
+ * Adds a 32-byte tweak times G to a compressed or uncompressed public key,
+ * writing the result into `out` in the form `compressed` asks for.
+ * Returns the length written, or 0 if the key, tweak, or result is invalid.
+ */
+size_t fast_crypto_secp256k1_pubkey_tweak_add(const uint8_t *publicKey, size_t publicKeyLen,
+    const uint8_t *tweak, int compressed, uint8_t *out);
+
+/**
+ * Signs a 32-byte message hash with a 32-byte private key.
+ * The signature always has a low S value. If `der` is set,
+ * the signature is DER-encoded (at most 72 bytes), otherwise it is
+ * the 64-byte compact encoding. The actual length goes in `sigLen`.
+ * Returns 1 on success, or 0 if the private key is invalid.
+ */
+int fast_crypto_secp256k1_ecdsa_sign(const uint8_t *privateKey, const uint8_t *msgHash,
+    uint8_t *sig, size_t *sigLen, int der);
+
+/**
+ * Checks a DER or compact signature against a message hash and a
+ * compressed or uncompressed public key. Unless `strict` is set,
+ * high-S signatures are normalized before checking.
+ * Returns 1 if the signature is valid, or 0 otherwise.
+ */
+int fast_crypto_secp256k1_ecdsa_verify(const uint8_t *sig, size_t sigLen, int der,
+    const uint8_t *msgHash, const uint8_t *publicKey, size_t publicKeyLen, int strict);
+
+/**
+ * Checks `count` compact signatures in parallel.
+ * Signatures and message hashes are packed back-to-back at 64 and
+ * 32 bytes apiece, and public keys are packed at `publicKeyLen` bytes
+ * apiece. Writes 1 or 0 into `results[i]` for each signature.
+ * A `threads` value of 0 uses one thread per CPU core.
+ * Returns the number of valid signatures.
+ */
+size_t fast_crypto_secp256k1_ecdsa_verify_batch(const uint8_t *sigs, const uint8_t *msgHashes,
+    const uint8_t *publicKeys, size_t publicKeyLen, size_t count, int strict,
+    unsigned threads, uint8_t *results);
+
+/**
+ * Creates the 32-byte BIP340 x-only public key for a private key.
+ * Returns 1 on success, or 0 if the private key is invalid.
+ */
+int fast_crypto_secp256k1_xonly_pubkey_create(const uint8_t *privateKey, uint8_t *xonlyPublicKey);
+
+/**
+ * Creates `count` x-only public keys in parallel.
+ * Returns the number of keys created, which is less than `count`
+ * if any private key is invalid.
+ */
+size_t fast_crypto_secp256k1_xonly_pubkey_create_batch(const uint8_t *privateKeys, size_t count,
+    unsigned threads, uint8_t *xonlyPublicKeys);
+
+/**
+ * Computes the BIP341 taproot output key for an x-only internal key.
+ * The `merkleRoot` is the 32-byte script tree root, or NULL for a
+ * key-path-only output. The parity of the output key goes in `parity`,
+ * which may be NULL. Returns 1 on success or 0 on failure.
+ */
+int fast_crypto_secp256k1_taproot_tweak_pubkey(const uint8_t *internalKey, const uint8_t *merkleRoot,
+    uint8_t *outputKey, int *parity);
+
+/**
+ * Computes `count` taproot output keys in parallel. The `merkleRoots`
+ * and `parities` arrays may be NULL. Returns the number of keys tweaked.
+ */
+size_t fast_crypto_secp256k1_taproot_tweak_pubkey_batch(const uint8_t *internalKeys,
+    const uint8_t *merkleRoots, size_t count, unsigned threads,
+    uint8_t *outputKeys, uint8_t *parities);
+
+/**
+ * Tweaks a private key to match `fast_crypto_secp256k1_taproot_tweak_pubkey`,
+ * so it can sign for the taproot output key.
+ * Returns 1 on success or 0 on failure.
+ */
+int fast_crypto_secp256k1_taproot_tweak_privkey(const uint8_t *privateKey, const uint8_t *merkleRoot,
+    uint8_t *tweakedPrivateKey);
+
+/**
+ * Tweaks `count` private keys in parallel. The `merkleRoots` array
+ * may be NULL. Returns the number of keys tweaked.
+ */
+size_t fast_crypto_secp256k1_taproot_tweak_privkey_batch(const uint8_t *privateKeys,
+    const uint8_t *merkleRoots, size_t count, unsigned threads, uint8_t *tweakedPrivateKeys);
+
+/**
+ * Creates a 64-byte BIP340 signature over a 32-byte message.
+ * The `auxRand` is 32 bytes of fresh randomness, or NULL.
+ * Returns 1 on success or 0 if the private key is invalid.
+ */
+int fast_crypto_secp256k1_schnorr_sign(const uint8_t *privateKey, const uint8_t *msg,
+    const uint8_t *auxRand, uint8_t *sig);
+
+/**
+ * Creates `count` signatures in parallel. The `auxRands` array
+ * may be NULL. Returns the number of signatures created.
+ */
+size_t fast_crypto_secp256k1_schnorr_sign_batch(const uint8_t *privateKeys, const uint8_t *msgs,
+    const uint8_t *auxRands, size_t count, unsigned threads, uint8_t *sigs);
+
+/**
+ * Checks a BIP340 signature over a 32-byte message.
+ * Returns 1 if the signature is valid, or 0 otherwise.
+ */
+int fast_crypto_secp256k1_schnorr_verify(const uint8_t *sig, const uint8_t *msg,
+    const uint8_t *xonlyPublicKey);
+
+/**
+ * Checks `count` signatures in parallel, writing 1 or 0 into
+ * `results[i]` for each one. Returns the number of valid signatures.
+ */
+size_t fast_crypto_secp256k1_schnorr_verify_batch(const uint8_t *sigs, const uint8_t *msgs,
+    const uint8_t *xonlyPublicKeys, size_t count, unsigned threads, uint8_t *results);
+
+/**
+ * Computes the Keccak-256 hash used by Ethereum.
+ */
+void fast_crypto_keccak256(const uint8_t *data, size_t dataLen, uint8_t *hash);
+
+/**
+ * Signs a 32-byte message hash, producing a 65-byte recoverable
+ * signature laid out as r || s || recovery id (0-3).
+ * Returns 1 on success, or 0 if the private key is invalid.
+ */
+int fast_crypto_secp256k1_ecdsa_sign_recoverable(const uint8_t *privateKey, const uint8_t *msgHash,
+    uint8_t *sig);
+
+/**
+ * Creates `count` recoverable signatures in parallel.
+ * Returns the number of signatures created.
+ */
+size_t fast_crypto_secp256k1_ecdsa_sign_recoverable_batch(const uint8_t *privateKeys,
+    const uint8_t *msgHashes, size_t count, unsigned threads, uint8_t *sigs);
+
+/**
+ * Recovers the public key from a 65-byte recoverable signature.
+ * The last byte may be a raw recovery id (0-3) or an Ethereum-style
+ * `v` value (27-30). Returns 1 on success or 0 on failure.
+ */
+int fast_crypto_secp256k1_ecdsa_recover(const uint8_t *sig, const uint8_t *msgHash,
+    uint8_t *publicKey, int compressed);
+
+/**
+ * Recovers `count` signers in parallel. The `format` is one of the
+ * RECOVER_* values, and sets the size of each item in `out` to 33, 65,
+ * or 20 bytes. Writes 1 or 0 into `results[i]` for each signature.
+ * Returns the number of signers recovered.
+ */
+size_t fast_crypto_secp256k1_ecdsa_recover_batch(const uint8_t *sigs, const uint8_t *msgHashes,
+    size_t count, int format, unsigned threads, uint8_t *out, uint8_t *results);
+
+/**
+ * Computes the standard libsecp256k1 ECDH secret, which is the SHA-256
+ * of the compressed shared point. Returns 1 on success or 0 on failure.
+ */
+int fast_crypto_secp256k1_ecdh(const uint8_t *privateKey, const uint8_t *publicKey,
+    size_t publicKeyLen, uint8_t *secret);
+
+/**
+ * Scans a batch of transactions for BIP352 silent payments.
+ *
+ * Each transaction has a 33-byte `tweaks` entry, which is either the sum
+ * of its eligible input public keys, or that sum already multiplied by
+ * the input hash, as served by silent payment indexers. In the first
+ * case, pass the 32-byte input hashes in `inputHashes`, otherwise NULL.
+ * The transactions' x-only taproot outputs are packed back-to-back in
+ * `outputKeys`, with `outputCounts[i]` outputs per transaction.
+ * `labels` holds `labelCount` 33-byte label points (m * G), or NULL.
+ *
+ * Transactions are spread across worker threads. Matches are written in
+ * transaction order, up to `maxMatches`. Returns the total match count.
+ */
+size_t fast_crypto_silent_payments_scan(const uint8_t *scanKey, const uint8_t *spendPublicKey,
+    const uint8_t *labels, size_t labelCount,
+    const uint8_t *tweaks, const uint8_t *inputHashes, size_t txCount,
+    const uint8_t *outputKeys, const uint32_t *outputCounts, unsigned threads,
+    fast_crypto_silent_payment_match *matches, size_t maxMatches);
+
+/**
+ * Aggregates `count` compressed public keys into a BIP327 MuSig2 key.
+ * If `sort` is set, the keys are sorted first, making the result
+ * independent of their order. Writes the 32-byte x-only aggregate key,
+ * and the key aggregation cache the signing functions need.
+ * Returns 1 on success or 0 on failure.
+ */
+int fast_crypto_musig_pubkey_agg(const uint8_t *publicKeys, size_t count, int sort,
+    uint8_t *aggregateKey, uint8_t *keyaggCache);
+
+/**
+ * Aggregates `setCount` sets of `keysPerSet` compressed public keys,
+ * such as the cosigner keys for a range of address indices, in parallel.
+ * Writes one 32-byte x-only aggregate key per set.
+ * Returns the number of sets aggregated.
+ */
+size_t fast_crypto_musig_pubkey_agg_batch(const uint8_t *publicKeySets, size_t keysPerSet,
+    size_t setCount, int sort, unsigned threads, uint8_t *aggregateKeys);
+
+/**
+ * Applies a BIP32-style (or x-only, for taproot) tweak to the aggregate
+ * key, updating the cache in place and writing the 33-byte tweaked key.
+ * Returns 1 on success or 0 on failure.
+ */
+int fast_crypto_musig_pubkey_tweak_add(uint8_t *keyaggCache, const uint8_t *tweak, int xonly,
+    uint8_t *tweakedKey);
+
+/**
+ * Generates a signing nonce pair. The `sessionRand` must be 32 bytes
+ * of fresh randomness, and is never reused. The private key, message,
+ * and cache are optional extra inputs, and may be NULL.
+ * Writes the 66-byte public nonce. The secret nonce stays in native
+ * memory, behind an opaque handle for fast_crypto_musig_partial_sign.
+ * Returns the handle, or 0 on failure.
+ */
+uint32_t fast_crypto_musig_nonce_gen(const uint8_t *sessionRand, const uint8_t *privateKey,
+    const uint8_t *publicKey, const uint8_t *msg, const uint8_t *keyaggCache,
+    uint8_t *pubnonce);
+
+/**
+ * Combines `count` 66-byte public nonces into an aggregate nonce.
+ * Returns 1 on success or 0 on failure.
+ */
+int fast_crypto_musig_nonce_agg(const uint8_t *pubnonces, size_t count, uint8_t *aggnonce);
+
+/**
+ * Creates a 32-byte partial signature over a 32-byte message, using the
+ * secret nonce behind `nonceHandle`. The nonce is wiped and its handle
+ * released before signing, so it cannot be used again, even on failure.
+ * Returns 1 on success or 0 on failure.
+ */
+int fast_crypto_musig_partial_sign(uint32_t nonceHandle, const uint8_t *privateKey,
+    const uint8_t *keyaggCache, const uint8_t *aggnonce, const uint8_t *msg,
+    uint8_t *partialSig);
+
+/**
+ * Wipes a secret nonce that will not be used, such as after an aborted
+ * signing session, and frees its handle.
+ */
+void fast_crypto_musig_nonce_release(uint32_t nonceHandle);
+
+/**
+ * Checks one signer's partial signature.
+ * Returns 1 if it is valid, or 0 otherwise.
+ */
+int fast_crypto_musig_partial_verify(const uint8_t *partialSig, const uint8_t *pubnonce,
+    const uint8_t *publicKey, const uint8_t *keyaggCache, const uint8_t *aggnonce,
+    const uint8_t *msg);
+
+/**
+ * Combines `count` partial signatures into a 64-byte BIP340 signature.
+ * Returns 1 on success or 0 on failure.
+ */
+int fast_crypto_musig_partial_sig_agg(const uint8_t *partialSigs, size_t count,
+    const uint8_t *keyaggCache, const uint8_t *aggnonce, const uint8_t *msg, uint8_t *sig);
+
+/**
+ * Parses a public key into an opaque native handle, so chained
+ * operations can skip the parse and serialize steps in between.
+ * Returns the new handle, or 0 on failure.
+ */
+uint32_t fast_crypto_secp256k1_pubkey_handle_create(const uint8_t *publicKey, size_t publicKeyLen);
+
+/**
+ * Stores a 32-byte private key in an opaque native handle.
+ * Returns the new handle, or 0 on failure.
+ */
+uint32_t fast_crypto_secp256k1_privkey_handle_create(const uint8_t *privateKey);
+
+/**
+ * Returns a new public key handle for a private key handle,
+ * or 0 on failure.
+ */
+uint32_t fast_crypto_secp256k1_handle_pubkey(uint32_t handle);
+
+/**
+ * Adds a 32-byte tweak to a private key handle, or tweak * G to a
+ * public key handle. The original handle stays valid.
+ * Returns the new handle, or 0 on failure.
+ */
+uint32_t fast_crypto_secp256k1_handle_tweak_add(uint32_t handle, const uint8_t *tweak);
+
+/**
+ * Adds together `count` public key handles.
+ * Returns the new handle, or 0 on failure.
+ */
+uint32_t fast_crypto_secp256k1_handle_combine(const uint32_t *handles, size_t count);
+
+/**
+ * Writes out the key behind a handle. Public keys take up to
+ * DECOMPRESSED_PUBKEY_LENGTH bytes, and private keys SECRET_KEY_LENGTH.
+ * Returns the number of bytes written, or 0 on failure.
+ */
+size_t fast_crypto_secp256k1_handle_serialize(uint32_t handle, int compressed, uint8_t *out);
+
+/**
+ * Frees a handle, wiping any private key it holds.
+ */
+void fast_crypto_secp256k1_handle_release(uint32_t handle);
+
+/**
+ * Derives m-of-n multisig script hashes for the BIP32 child indices
+ * [startIndex, startIndex + count).
+ *
+ * The `n` cosigner keys are packed XPUB_LENGTH entries in `xpubs`.
+ * For each index, this derives every cosigner's non-hardened child,
+ * sorts the children by BIP67, builds `OP_m <keys> OP_n CHECKMULTISIG`,
+ * and hashes that script according to `scriptType`:
+ * - MULTISIG_P2SH: HASH160 of the script (20 bytes).
+ * - MULTISIG_P2WSH: SHA-256 of the script (32 bytes).
+ * - MULTISIG_P2SH_P2WSH: HASH160 of the P2WSH program (20 bytes).
+ *
+ * Indices are spread across worker threads. Indices whose derivation
+ * fails get an all-zero hash. Returns the number of indices derived.
+ */
+size_t fast_crypto_multisig_derive_batch(const uint8_t *xpubs, size_t n, size_t m,
+    uint32_t startIndex, size_t count, int scriptType, unsigned threads, uint8_t *hashes);
+
+/**
+ * Encrypts `inLen` bytes with AES-256-CBC. If `pad` is set, this adds
+ * PKCS#7 padding, so `out` needs room for `inLen + AES_BLOCK_LENGTH`
+ * bytes. Otherwise `inLen` must be a multiple of AES_BLOCK_LENGTH.
+ * The actual length goes in `outLen`.
+ * Returns 1 on success, or 0 if the input length is invalid.
+ */
+int fast_crypto_aes256_cbc_encrypt(const uint8_t *key, const uint8_t *iv,
+    const uint8_t *in, size_t inLen, int pad, uint8_t *out, size_t *outLen);
+
+/**
+ * Decrypts `inLen` bytes with AES-256-CBC, removing PKCS#7 padding if
+ * `pad` is set. The actual length goes in `outLen`.
+ * Returns 1 on success, or 0 if the length or padding is invalid.
+ */
+int fast_crypto_aes256_cbc_decrypt(const uint8_t *key, const uint8_t *iv,
+    const uint8_t *in, size_t inLen, int pad, uint8_t *out, size_t *outLen);
+
+/**
+ * Encrypts `inLen` bytes with AES-256-GCM and a 12-byte IV,
+ * authenticating `aad` as well. The ciphertext is the same length as
+ * the input, and the 16-byte tag goes in `tag`.
+ */
+void fast_crypto_aes256_gcm_encrypt(const uint8_t *key, const uint8_t *iv,
+    const uint8_t *aad, size_t aadLen, const uint8_t *in, size_t inLen,
+    uint8_t *out, uint8_t *tag);
+
+/**
+ * Checks the tag and decrypts `inLen` bytes with AES-256-GCM.
+ * Returns 1 on success, or 0 if the tag does not match.
+ */
+int fast_crypto_aes256_gcm_decrypt(const uint8_t *key, const uint8_t *iv,
+    const uint8_t *aad, size_t aadLen, const uint8_t *in, size_t inLen,
+    const uint8_t *tag, uint8_t *out);
+
+/**
+ * Picks the AES implementation, so benchmarks can compare them.
+ * AES_IMPLEMENTATION_AUTO picks the fastest one this CPU supports.
+ * Returns 1 on success, or 0 if this CPU lacks the implementation.
+ */
+int fast_crypto_aes_set_implementation(int implementation);
+
+/**
+ * Returns the AES implementation in use, which is never
+ * AES_IMPLEMENTATION_AUTO.
+ */
+int fast_crypto_aes_get_implementation(void);
+
+/**
+ * Encrypts `inLen` bytes with ChaCha20-Poly1305, authenticating `aad`
+ * as well. A `nonceLen` of CHACHA20_POLY1305_NONCE_LENGTH selects the
+ * RFC 8439 construction, and XCHACHA20_POLY1305_NONCE_LENGTH selects
+ * XChaCha20-Poly1305. The ciphertext is the same length as the input,
+ * and the 16-byte tag goes in `tag`.
+ * Returns 1 on success, or 0 if the nonce length is invalid.
+ */
+int fast_crypto_chacha20_poly1305_encrypt(const uint8_t *key, const uint8_t *nonce,
+    size_t nonceLen, const uint8_t *aad, size_t aadLen, const uint8_t *in, size_t inLen,
+    uint8_t *out, uint8_t *tag);
+
+/**
+ * Decrypts `inLen` bytes with ChaCha20-Poly1305 or XChaCha20-Poly1305,
+ * depending on `nonceLen`, and checks the tag.
+ * Returns 1 on success, or 0 if the nonce length or tag is invalid,
+ * in which case `out` is zeroed.
+ */
+int fast_crypto_chacha20_poly1305_decrypt(const uint8_t *key, const uint8_t *nonce,
+    size_t nonceLen, const uint8_t *aad, size_t aadLen, const uint8_t *in, size_t inLen,
+    const uint8_t *tag, uint8_t *out);
+
+/**
+ * Opens a ChaCha20-Poly1305 or XChaCha20-Poly1305 stream, so a large
+ * message can pass through in chunks instead of all at once.
+ * Returns the new stream, or 0 if the nonce length is invalid or
+ * AEAD_STREAM_LIMIT streams are already open.
+ */
+uint32_t fast_crypto_chacha20_poly1305_stream_create(const uint8_t *key, const uint8_t *nonce,
+    size_t nonceLen, const uint8_t *aad, size_t aadLen, int decrypt);
+
+/**
+ * Encrypts or decrypts the next `inLen` bytes of a stream into `out`.
+ * Chunks can be any size. Decrypted chunks are not authentic until
+ * fast_crypto_chacha20_poly1305_stream_final succeeds.
+ * Returns 1 on success, or 0 if the stream does not exist.
+ */
+int fast_crypto_chacha20_poly1305_stream_update(uint32_t stream, const uint8_t *in,
+    size_t inLen, uint8_t *out);
+
+/**
+ * Finishes a stream and closes it. Encrypting streams write their tag
+ * into `tag`, and decrypting streams check their tag against it.
+ * Returns 1 on success, or 0 if the stream does not exist or the tag
+ * does not match.
+ */
+int fast_crypto_chacha20_poly1305_stream_final(uint32_t stream, uint8_t *tag);
+
+/**
+ * Closes a stream without finishing it.
+ */
+void fast_crypto_chacha20_poly1305_stream_release(uint32_t stream);
+
+/**
+ * Picks the ChaCha20 implementation, so benchmarks can compare them.
+ * CHACHA20_IMPLEMENTATION_AUTO picks the fastest one this CPU supports.
+ * Returns 1 on success, or 0 if this CPU lacks the implementation.
+ */
+int fast_crypto_chacha20_set_implementation(int implementation);
+
+/**
+ * Returns the ChaCha20 implementation in use, which is never
+ * CHACHA20_IMPLEMENTATION_AUTO.
+ */
+int fast_crypto_chacha20_get_implementation(void);
+
+/**
+ * Checks and decrypts a batch of encrypted storage records.
+ *
+ * The records are packed back-to-back in `records`, with `recordLens[i]`
+ * bytes each. Each plaintext is written to `plaintexts` at the same
+ * offset as its record, so `plaintexts` needs as much room as `records`.
+ * Each record gets its plaintext length in `plaintextLens` and a
+ * RECORD_* code in `statuses`. Records that fail get a length of 0,
+ * and their plaintext area is zeroed.
+ *
+ * The MAC is checked before decrypting. Records are spread across worker
+ * threads. Returns the number of records that decrypted successfully.
+ */
+size_t fast_crypto_records_decrypt_batch(const uint8_t *key,
+    const uint8_t *records, const uint32_t *recordLens, size_t count, unsigned threads,
+    uint8_t *plaintexts, uint32_t *plaintextLens, uint8_t *statuses);
+
+/**
+ * Same as fast_crypto_records_decrypt_batch, but derives the
+ * RECORD_KEY_LENGTH-byte key with scrypt first, so the key never leaves
+ * native code. If scrypt rejects its parameters or runs out of memory,
+ * every record fails with RECORD_KDF_FAILED instead.
+ */
+size_t fast_crypto_records_decrypt_batch_scrypt(const uint8_t *passwd, size_t passwdlen,
+    const uint8_t *salt, size_t saltlen, uint64_t N, uint32_t r, uint32_t p,
+    const uint8_t *records, const uint32_t *recordLens, size_t count, unsigned threads,
+    uint8_t *plaintexts, uint32_t *plaintextLens, uint8_t *statuses);
+
+/**
+ * Creates the 32-byte Ed25519 public key for a 32-byte private key,
+ * which is the RFC 8032 seed.
+ */
+void fast_crypto_ed25519_pubkey_create(const uint8_t *privateKey, uint8_t *publicKey);
+
+/**
+ * Creates `count` Ed25519 public keys in parallel.
+ * Returns the number of keys created.
+ */
+size_t fast_crypto_ed25519_pubkey_create_batch(const uint8_t *privateKeys, size_t count,
+    unsigned threads, uint8_t *publicKeys);
+
+/**
+ * Creates a 64-byte Ed25519 signature over a message of any length.
+ */
+void fast_crypto_ed25519_sign(const uint8_t *privateKey, const uint8_t *msg, size_t msgLen,
+    uint8_t *sig);
+
+/**
+ * Checks an Ed25519 signature. Non-canonical signatures and
+ * public keys are rejected.
+ * Returns 1 if the signature is valid, or 0 otherwise.
+ */
+int fast_crypto_ed25519_verify(const uint8_t *sig, const uint8_t *msg, size_t msgLen,
+    const uint8_t *publicKey);
+
+/**
+ * Checks `count` Ed25519 signatures in parallel. The messages are packed
+ * back-to-back in `msgs`, with `msgLens[i]` bytes each. Writes 1 or 0
+ * into `results[i]` for each signature.
+ * Returns the number of valid signatures.
+ */
+size_t fast_crypto_ed25519_verify_batch(const uint8_t *sigs, const uint8_t *msgs,
+    const uint32_t *msgLens, const uint8_t *publicKeys, size_t count, unsigned threads,
+    uint8_t *results);
+
+/**
+ * Derives a SLIP-0010 Ed25519 private key and chain code from a seed,
+ * following `pathLen` indices from the master key. The `chainCode`
+ * may be NULL. Returns 1 on success, or 0 if any index is missing
+ * the SLIP10_HARDENED bit.
+ */
+int fast_crypto_slip10_ed25519_derive(const uint8_t *seed, size_t seedLen,
+    const uint32_t *path, size_t pathLen, uint8_t *privateKey, uint8_t *chainCode);
+
+/**
+ * Derives `count` SLIP-0010 Ed25519 keys from one seed in parallel.
+ * The paths are packed back-to-back in `paths`, with `pathLens[i]`
+ * indices each. Writes each private key and its public key, which may
+ * be NULL. Paths that fail leave zeros in both.
+ * Returns the number of keys derived.
+ */
+size_t fast_crypto_slip10_ed25519_derive_batch(const uint8_t *seed, size_t seedLen,
+    const uint32_t *paths, const uint32_t *pathLens, size_t count, unsigned threads,
+    uint8_t *privateKeys, uint8_t *publicKeys);
+
+/**
+ * Derives `outlen` bytes with Argon2id (RFC 9106), using `t` passes over
+ * `m` KiB of memory split into `p` lanes. The lanes are filled in
+ * parallel, on up to `threads` worker threads.
+ * Returns 1 on success, or 0 if the parameters are invalid
+ * or the memory could not be allocated.
+ */
+int fast_crypto_argon2id(const uint8_t *passwd, size_t passwdlen, const uint8_t *salt,
+    size_t saltlen, uint32_t t, uint32_t m, uint32_t p, unsigned threads,
+    uint8_t *out, size_t outlen);
+
+/**
+ * Picks the Argon2 block implementation, so benchmarks can compare them.
+ * ARGON2_IMPLEMENTATION_AUTO picks the fastest one this CPU supports.
+ * Returns 1 on success, or 0 if this CPU lacks the implementation.
+ */
+int fast_crypto_argon2_set_implementation(int implementation);
+
+/**
+ * Returns the Argon2 implementation in use, which is never
+ * ARGON2_IMPLEMENTATION_AUTO.
+ */
+int fast_crypto_argon2_get_implementation(void);
+
+/**
+ * Turns a BIP39 mnemonic into its seed, without the mnemonic, the
+ * passphrase, or anything derived from them leaving native code.
+ *
+ * The mnemonic and passphrase are UTF-8, and both are NFKD-normalized
+ * first. Every word has to be in `wordlist`, which holds 2048 words
+ * separated by newlines, or is NULL for the English list. The word
+ * count and checksum have to be valid, too. The seed is then 2048 rounds
+ * of PBKDF2-SHA512 over the mnemonic, salted with "mnemonic" and the
+ * passphrase.
+ *
+ * Writes the BIP39_SEED_LENGTH-byte seed to `seed`, and the BIP32 master
+ * key for that seed to `xprv`. Either one may be NULL. Both are zeroed
+ * on failure. Returns a BIP39_* code.
+ */
+int fast_crypto_bip39_mnemonic_to_seed(const uint8_t *mnemonic, size_t mnemonicLen,
+    const uint8_t *passphrase, size_t passphraseLen, const uint8_t *wordlist, size_t wordlistLen,
+    uint8_t *seed, uint8_t *xprv);
+
+/**
+ * Same as fast_crypto_bip39_mnemonic_to_seed, but tries `count`
+ * passphrases against one mnemonic, spread across worker threads.
+ * The passphrases are packed back-to-back in `passphrases`, with
+ * `passphraseLens[i]` bytes each. Each one gets a seed and master key
+ * at its index in `seeds` and `xprvs`, either of which may be NULL,
+ * and a BIP39_* code in `statuses`. If the mnemonic itself is bad,
+ * every passphrase gets its code.
+ * Returns the number of passphrases that succeeded.
+ */
+size_t fast_crypto_bip39_mnemonic_to_seed_batch(const uint8_t *mnemonic, size_t mnemonicLen,
+    const uint8_t *passphrases, const uint32_t *passphraseLens, size_t count,
+    const uint8_t *wordlist, size_t wordlistLen, unsigned threads,
+    uint8_t *seeds, uint8_t *xprvs, uint8_t *statuses);
+
+/**
+ * Encodes `count` payloads as addresses in parallel. The payloads are
+ * packed back-to-back in `payloads`, with `payloadLens[i]` bytes each.
+ * The `prefix` and `version` depend on the `format`:
+ * - ADDRESS_BASE58CHECK: `prefix` holds version bytes to put in front
+ *   of every payload, and `version` is unused.
+ * - ADDRESS_SEGWIT: `prefix` is the human-readable part, such as "bc",
+ *   and `version` is the witness version. Version 0 uses bech32, and
+ *   later versions use bech32m.
+ * - ADDRESS_CASHADDR: `prefix` is the network prefix, such as
+ *   "bitcoincash", and `version` is the type (0 for P2PKH, 1 for P2SH).
+ *
+ * Each address is written as a NUL-terminated string at
+ * `addresses + i * ADDRESS_MAX_LENGTH`. Payloads that cannot be encoded,
+ * or would not fit, get an empty string.
+ * Returns the number of addresses encoded.
+ */
+size_t fast_crypto_address_encode_batch(int format, const uint8_t *prefix, size_t prefixLen,
+    uint32_t version, const uint8_t *payloads, const uint32_t *payloadLens, size_t count,
+    unsigned threads, char *addresses);
+
+/**
+ * Decodes `count` addresses in parallel, checking their checksums.
+ * The addresses are packed back-to-back in `addresses`, with
+ * `addressLens[i]` characters each. The `prefix` is the same as for
+ * fast_crypto_address_encode_batch, and every address has to match it.
+ * For ADDRESS_BASE58CHECK, the version bytes are removed from the
+ * payload, and an empty `prefix` accepts any version. CashAddr
+ * addresses may leave out their prefix.
+ *
+ * Each payload goes at `payloads + i * ADDRESS_PAYLOAD_MAX_LENGTH`, with
+ * its length in `payloadLens`, and its witness version or CashAddr type
+ * in `versions`. Addresses that fail get a length of 0 and a version
+ * of -1. Returns the number of addresses decoded.
+ */
+size_t fast_crypto_address_decode_batch(int format, const uint8_t *prefix, size_t prefixLen,
+    const char *addresses, const uint32_t *addressLens, size_t count, unsigned threads,
+    uint8_t *payloads, uint32_t *payloadLens, int32_t *versions);
+
+/**
+ * Fills `len` bytes from the calling thread's ChaCha20 DRBG, which
+ * seeds itself from the OS, and reseeds periodically and after a fork.
+ * Returns 1 on success, or 0 if the OS entropy source failed,
+ * in which case `out` is zeroed.
+ */
+int fast_crypto_random_bytes(uint8_t *out, size_t len);
+
+/**
+ * Generates `count` fresh private keys and their public keys, without
+ * the random material ever leaving native code. The `keyType` is one
+ * of the KEYGEN_* values. Private keys are SECRET_KEY_LENGTH bytes
+ * apiece, and public keys are sized by the key type. The `publicKeys`
+ * may be NULL. Public keys are created in parallel.
+ * Returns the number of keys generated, which is 0 if the key type is
+ * unknown, or if the OS entropy source failed, leaving both buffers
+ * zeroed.
+ */
+size_t fast_crypto_keys_generate_batch(int keyType, size_t count, unsigned threads,
+    uint8_t *privateKeys, uint8_t *publicKeys);
+
+/**
+ * Encodes `inLen` bytes as padded base64, followed by a NUL, so `out`
+ * needs BASE64_ENCODED_LENGTH(inLen) + 1 characters.
+ * Returns the encoded length, not counting the NUL.
+ */
+size_t fast_crypto_base64_encode(const uint8_t *in, size_t inLen, char *out);
+
+/**
+ * Decodes `inLen` characters of base64, with or without padding, into
+ * `out`, which needs BASE64_DECODED_MAX_LENGTH(inLen) bytes, and puts
+ * the decoded length in `outLen`.
+ * Returns 1 on success, or 0 if the text is not base64. In that case,
+ * `errorPos` gets the offset of the first bad character, or `inLen` if
+ * the text stops partway through a byte. The `errorPos` may be NULL.
+ */
+int fast_crypto_base64_decode(const char *in, size_t inLen, uint8_t *out, size_t *outLen,
+    size_t *errorPos);
+
+/**
+ * Encodes `inLen` bytes as lower-case hex, followed by a NUL,
+ * so `out` needs 2 * inLen + 1 characters.
+ * Returns the encoded length, not counting the NUL.
+ */
+size_t fast_crypto_hex_encode(const uint8_t *in, size_t inLen, char *out);
+
+/**
+ * Decodes `inLen` characters of upper or lower-case hex into `out`,
+ * which needs inLen / 2 bytes.
+ * Returns 1 on success, or 0 if the text is not hex. In that case,
+ * `errorPos` gets the offset of the first bad character, or `inLen` if
+ * the length is odd. The `errorPos` may be NULL.
+ */
+int fast_crypto_hex_decode(const char *in, size_t inLen, uint8_t *out, size_t *errorPos);
+
+/**
+ * Picks the base64 and hex implementation, so benchmarks can compare them.
+ * CODEC_IMPLEMENTATION_AUTO picks the fastest one this CPU supports.
+ * Returns 1 on success, or 0 if this CPU lacks the implementation.
+ */
+int fast_crypto_codec_set_implementation(int implementation);
+
+/**
+ * Returns the base64 and hex implementation in use, which is never
+ * CODEC_IMPLEMENTATION_AUTO.
+ */
+int fast_crypto_codec_get_implementation(void);
+
+/**
+ * Runs `task(context)` on the shared worker pool, so the bridges never
+ * do crypto on the thread that called them. Each POOL_PRIORITY_* class
+ * has its own threads and bounded queue, so interactive work never
+ * waits behind background work, and tasks in a class start in the
+ * order they were submitted.
+ * Returns 1 if the task is queued, or 0 if the priority is unknown or
+ * its queue is full, in which case the task never runs.
+ */
+int fast_crypto_pool_submit(int priority, void (*task)(void *context), void *context);
+
+/**
+ * Gives a priority class `threads` threads and room for `queueLimit`
+ * waiting tasks, and pins its threads to the `cpuCount` CPUs in `cpus`,
+ * so heavy work can stay off efficiency cores. A `cpuCount` of 0 lets
+ * the threads run anywhere. Pinning only works on Android and Linux;
+ * on iOS, both classes run at quality-of-service levels that can use
+ * the performance cores.
+ * Returns 1 on success, or 0 if an argument is out of range.
+ */
+int fast_crypto_pool_configure(int priority, unsigned threads, size_t queueLimit,
+    const int *cpus, size_t cpuCount);
+
+/**
+ * Returns the number of tasks waiting for a thread in a priority class.
+ */
+size_t fast_crypto_pool_pending(int priority);
+
+/**
+ * Counters for the secure memory arena, which holds key material and
+ * KDF scratch space for the native code and the bridges.
+ */
+typedef struct {
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t maps; // Slabs and mappings taken from the system
+    uint64_t unmaps;
+    uint64_t unlocked; // Mappings the system would not lock into RAM
+    size_t inUse;
+    size_t peak; // Most bytes in use since fast_crypto_reset_stats
+    size_t mapped;
+} fast_crypto_secure_memory_stats;
+
+/**
+ * Allocates `size` zeroed bytes from the secure arena. Arena memory sits
+ * between guard pages, stays out of swap wherever the system lets us
+ * lock it, and is wiped when freed. Released blocks go back on
+ * per-size free lists, so repeated calls skip the system allocator.
+ * Returns NULL if the memory could not be allocated.
+ */
+void *fast_crypto_secure_alloc(size_t size);
+
+/**
+ * Wipes and frees memory from fast_crypto_secure_alloc, where `size`
+ * is the size it was allocated with.
+ */
+void fast_crypto_secure_free(void *memory, size_t size);
+
+/**
+ * Copies the secure arena's counters into `stats`.
+ */
+void fast_crypto_get_secure_memory_stats(fast_crypto_secure_memory_stats *stats);
+
+// Operations that fast_crypto_get_stats counts separately. Batches
+// count as one call, and calls made inside other calls do not count:
+#define STATS_OP_SCRYPT 0
+#define STATS_OP_ARGON2ID 1
+#define STATS_OP_BIP39 2
+#define STATS_OP_PIPELINE 3
+#define STATS_OP_RECORDS 4
+#define STATS_OP_AES 5
+#define STATS_OP_CHACHA20_POLY1305 6
+#define STATS_OP_SECP256K1_KEYS 7
+#define STATS_OP_ECDSA 8
+#define STATS_OP_SCHNORR 9
+#define STATS_OP_ED25519 10
+#define STATS_OP_ADDRESS 11
+#define STATS_OP_CODEC 12
+#define STATS_OP_RANDOM 13
+#define STATS_OP_COUNT 14
+
+// Latency histogram buckets. Bucket 0 counts calls under 1us,
+// bucket i counts calls from 2^(i-1) up to 2^i microseconds,
+// and the last bucket also takes anything slower:
+#define STATS_HISTOGRAM_BUCKETS 32
+
+/**
+ * Counters for one operation, from fast_crypto_get_stats.
+ */
+typedef struct {
+    uint64_t calls;
+    uint64_t bytes; // Input bytes, or output bytes for KDFs and key generation
+    uint64_t totalNs;
+    uint64_t maxNs;
+    uint64_t histogram[STATS_HISTOGRAM_BUCKETS];
+} fast_crypto_op_stats;
+
+/**
+ * Copies the counters for the first `count` operations into `ops`,
+ * which is indexed by the STATS_OP_* constants. The counters are only
+ * kept in builds made with FAST_CRYPTO_STATS defined to 1, since timing
+ * every call costs a little; other builds leave everything at zero.
+ * Returns 1 if this build keeps counters, or 0 if it does not.
+ */
+int fast_crypto_get_stats(fast_crypto_op_stats *ops, size_t count);
+
+// Length of a fast_crypto_stats_snapshot: a flag byte padded out to
+// 8 bytes, the secure memory in use, its peak, and the count of mappings
+// left unlocked, then the fast_crypto_op_stats fields for each operation
+// in order, all as 64-bit numbers in host (little-endian) order:
+#define STATS_SNAPSHOT_LENGTH (32 + STATS_OP_COUNT * (4 + STATS_HISTOGRAM_BUCKETS) * 8)
+
+/**
+ * Packs the operation counters and secure memory use into `out`,
+ * which needs STATS_SNAPSHOT_LENGTH bytes, so the bridges can pass
+ * them along in one piece. The flag byte is 1 if this build keeps
+ * operation counters; the memory numbers are always there.
+ */
+void fast_crypto_stats_snapshot(uint8_t *out);
+
+/**
+ * Zeroes the operation counters, and restarts the secure memory peak
+ * from the memory in use right now.
+ */
+void fast_crypto_reset_stats(void);
+
+/**
+ * Starts recording each call as a trace event, keeping up to
+ * `maxEvents` of them and dropping the rest. Any earlier trace is lost.
+ * Returns 1 on success, or 0 if this build does not keep counters
+ * or the events do not fit in memory.
+ */
+int fast_crypto_trace_start(size_t maxEvents);
+
+/**
+ * Stops recording trace events, and writes the ones recorded so far to
+ * `json` as Chrome trace-event JSON, which chrome://tracing and Perfetto
+ * can open. Like snprintf, this writes at most `jsonLen` bytes,
+ * including a terminating NUL, and returns the full length of the JSON,
+ * so callers can pass NULL first to size their buffer.
+ */
+size_t fast_crypto_trace_stop(char *json, size_t jsonLen);
+
+/**
+ * Checks a pipeline program without running it, so callers can size the
+ * output buffer for fast_crypto_pipeline_run. The inputs only need their
+ * lengths here. Writes an upper bound on the length of `outputSlot`
+ * after the last step to `outSize`.
+ * Returns PIPELINE_OK, or PIPELINE_BAD_STEP with the index of the bad
+ * step in `failedStep`. Too many or too long inputs count as step 0,
+ * and a bad `outputSlot` counts as step `stepCount`.
+ */
+int fast_crypto_pipeline_check(const uint8_t *steps, size_t stepCount,
+    const uint32_t *inputLens, size_t inputCount, unsigned outputSlot,
+    size_t *outSize, size_t *failedStep);
+
+/**
+ * Runs a chain of KDF, MAC, and cipher steps in one call, such as a
+ * login that stretches a password, checks a MAC, and decrypts a key.
+ * The intermediate values never leave native memory, and every slot is
+ * wiped before this returns. The inputs are packed back-to-back in
+ * `inputs`, with `inputLens[i]` bytes each.
+ *
+ * On success, copies `outputSlot` into `out`, which needs the room
+ * fast_crypto_pipeline_check reports, and writes its length to `outLen`.
+ * Returns PIPELINE_OK, or another PIPELINE_* code with the index of
+ * the step that stopped the pipeline in `failedStep`.
+ */
+int fast_crypto_pipeline_run(const uint8_t *steps, size_t stepCount,
+    const uint8_t *inputs, const uint32_t *inputLens, size_t inputCount,
+    unsigned outputSlot, uint8_t *out, size_t *outLen, size_t *failedStep);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+extern "C" {
+#include "pool.h"
+}
+
+#if defined(__APPLE__)
+#include <pthread.h>
+#elif defined(__linux__)
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/** How much background threads yield to everything else, on Linux. */
+const int backgroundNice = 5;
+
+struct Task {
+    void (*run)(void *);
+    void *context;
+};
+
+/**
+ * One priority class: a queue, the threads that drain it,
+ * and the settings those threads should be running with.
+ */
+struct PoolClass {
+    PoolClass(int priority, unsigned threads):
+        priority(priority), threads(threads) {}
+
+    const int priority;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<Task> queue;
+
+    unsigned threads;
+    unsigned running = 0;
+    size_t queueLimit = POOL_QUEUE_LIMIT;
+
+    // Bumped whenever the CPU list changes, so threads know to re-pin:
+    std::vector<int> cpus;
+    unsigned generation = 0;
+};
+
+/**
+ * Returns a priority class, or NULL if there is no such class.
+ * The classes are never destroyed, since detached threads
+ * may still be using them while the process exits.
+ */
+PoolClass *getClass(int priority)
+{
+    static PoolClass *classes[POOL_CLASSES] = {
+        new PoolClass(POOL_INTERACTIVE, POOL_INTERACTIVE_THREADS),
+        new PoolClass(POOL_BACKGROUND, POOL_BACKGROUND_THREADS)
+    };
+    if (priority < 0 || priority >= POOL_CLASSES) return NULL;
+    return classes[priority];
+}
+
+/**
+ * Applies the class's scheduling settings to the calling thread.
+ */
+void placeThread(int priority, const std::vector<int> &cpus, bool first)
+{
+#if defined(__APPLE__)
+    // Both classes stay eligible for the performance cores,
+    // which the utility and background classes are not:
+    if (first) {
+        pthread_set_qos_class_self_np(
+            priority == POOL_INTERACTIVE ? QOS_CLASS_USER_INTERACTIVE : QOS_CLASS_USER_INITIATED, 0);
+    }
+    (void) cpus;
+#elif defined(__linux__)
+    // Linux applies nice values to single threads:
+    if (first && priority == POOL_BACKGROUND) {
+        setpriority(PRIO_PROCESS, (id_t) syscall(SYS_gettid), backgroundNice);
+    }
+
+    // New threads inherit the process's CPUs, so only unpin
+    // threads that an earlier configuration pinned:
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (cpus.empty()) {
+        if (first || sched_getaffinity(getpid(), sizeof(set), &set) != 0) return;
+    } else {
+        for (int cpu : cpus) CPU_SET(cpu, &set);
+    }
+    // This fails, leaving the thread where it was,
+    // if none of the CPUs exist or are allowed:
+    sched_setaffinity(0, sizeof(set), &set);
+#else
+    (void) priority;
+    (void) cpus;
+    (void) first;
+#endif
+}
+
+/**
+ * Runs tasks from a class until the class has more threads than it wants.
+ */
+void work(PoolClass *pool)
+{
+    std::vector<int> cpus;
+    unsigned generation = 0;
+    bool first = true;
+
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    while (true) {
+        if (pool->running > pool->threads) break;
+        if (first || generation != pool->generation) {
+            cpus = pool->cpus;
+            generation = pool->generation;
+            lock.unlock();
+            placeThread(pool->priority, cpus, first);
+            first = false;
+            lock.lock();
+            continue;
+        }
+        if (pool->queue.empty()) {
+            pool->wake.wait(lock);
+            continue;
+        }
+
+        Task task = pool->queue.front();
+        pool->queue.pop_front();
+        lock.unlock();
+        task.run(task.context);
+        lock.lock();
+    }
+    --pool->running;
+}
+
+/**
+ * Starts threads until the class has as many as it wants.
+ * Must be called with the class's mutex held.
+ */
+void startThreads(PoolClass *pool)
+{
+    while (pool->running < pool->threads) {
+        try {
+            std::thread(work, pool).detach();
+        } catch (const std::system_error &) {
+            return;
+        }
+        ++pool->running;
+    }
+}
+
+} // namespace
+
+int Pool_Submit(int priority, void (*task)(void *), void *context)
+{
+    PoolClass *pool = getClass(priority);
+    if (pool == NULL || task == NULL) return -1;
+
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    if (pool->queue.size() >= pool->queueLimit) return -1;
+    startThreads(pool);
+    if (pool->running == 0) return -1;
+
+    pool->queue.push_back(Task{task, context});
+    pool->wake.notify_one();
+    return 0;
+}
+
+int Pool_Configure(int priority, unsigned threads, size_t queueLimit, const int *cpus, size_t cpuCount)
+{
+    PoolClass *pool = getClass(priority);
+    if (pool == NULL || threads == 0 || queueLimit == 0) return -1;
+    if (cpuCount > POOL_MAX_CPUS || (cpuCount != 0 && cpus == NULL)) return -1;
+    for (size_t i = 0; i < cpuCount; ++i) {
+        if (cpus[i] < 0) return -1;
+#if defined(__linux__)
+        if (cpus[i] >= CPU_SETSIZE) return -1;
+#endif
+    }
+
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    pool->threads = threads;
+    pool->queueLimit = queueLimit;
+    pool->cpus.assign(cpus, cpus + cpuCount);
+    ++pool->generation;
+
+    // Wake idle threads, so extras can exit and the rest can re-pin.
+    // New threads only start when there is work for them:
+    pool->wake.notify_all();
+    if (!pool->queue.empty()) startThreads(pool);
+    return 0;
+}
+
+size_t Pool_Pending(int priority)
+{
+    PoolClass *pool = getClass(priority);
+    if (pool == NULL) return 0;
+
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    return pool->queue.size();
+}
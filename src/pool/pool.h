@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _POOL_H_
+#define _POOL_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/*
+ * Priority classes. Each class has its own threads and its own bounded
+ * queue, so a backlog of slow background work (key stretching, batches)
+ * never delays the quick calls a user is waiting on. Tasks in a class
+ * start in the order they were submitted.
+ */
+#define POOL_INTERACTIVE	0
+#define POOL_BACKGROUND		1
+#define POOL_CLASSES		2
+
+/* Defaults, until Pool_Configure says otherwise. */
+#define POOL_INTERACTIVE_THREADS	1
+#define POOL_BACKGROUND_THREADS		2
+#define POOL_QUEUE_LIMIT		256
+
+/* The most CPUs Pool_Configure will pin a class to. */
+#define POOL_MAX_CPUS			64
+
+/**
+ * Pool_Submit(priority, task, context):
+ * Queue task(context) to run on one of the priority class's threads.
+ * Return 0 on success, or -1 if the priority is unknown, the class's
+ * queue is full, or no thread could be started. The task does not run
+ * if this fails.
+ */
+int	Pool_Submit(int, void (*)(void *), void *);
+
+/**
+ * Pool_Configure(priority, threads, queuelimit, cpus, ncpus):
+ * Give the priority class threads threads and room for queuelimit
+ * waiting tasks, and pin its threads to the ncpus CPUs listed in cpus,
+ * or let them run anywhere if ncpus is 0. This is how apps keep heavy
+ * work on their performance cores. Pinning only applies on Linux and
+ * Android; Apple systems place threads by their quality-of-service
+ * class. Running tasks finish on their current thread, while idle
+ * threads pick up the new settings before their next task. Return 0 on
+ * success, or -1 if an argument is out of range.
+ */
+int	Pool_Configure(int, unsigned, size_t, const int *, size_t);
+
+/**
+ * Pool_Pending(priority):
+ * Return the number of tasks waiting for a thread in the priority
+ * class, not counting the ones already running.
+ */
+size_t	Pool_Pending(int);
+
+#endif /* !_POOL_H_ */
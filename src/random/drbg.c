@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__APPLE__)
+#include <sys/random.h>
+#elif defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#include "../cipher/chacha20.h"
+
+#include "drbg.h"
+
+/* The most output one request key covers, well inside one nonce. */
+#define DRBG_CHUNK	(1U << 20)
+
+/**
+ * entropy_urandom(buf, buflen):
+ * Fill buf from /dev/urandom, for kernels without getrandom(2).
+ */
+static int
+entropy_urandom(uint8_t * buf, size_t buflen)
+{
+	ssize_t n;
+	int fd;
+
+	if ((fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC)) < 0)
+		return (-1);
+	while (buflen > 0) {
+		if ((n = read(fd, buf, buflen)) < 0) {
+			if (errno == EINTR)
+				continue;
+			close(fd);
+			return (-1);
+		}
+		if (n == 0) {
+			close(fd);
+			return (-1);
+		}
+		buf += n;
+		buflen -= (size_t)n;
+	}
+	close(fd);
+	return (0);
+}
+
+int
+DRBG_Entropy(uint8_t * buf, size_t buflen)
+{
+#if defined(__APPLE__)
+	size_t n;
+
+	/* getentropy(2) hands out at most 256 bytes per call. */
+	while (buflen > 0) {
+		n = buflen < 256 ? buflen : 256;
+		if (getentropy(buf, n))
+			return (-1);
+		buf += n;
+		buflen -= n;
+	}
+	return (0);
+#elif defined(__linux__) && defined(SYS_getrandom)
+	long n;
+
+	/* Older Android libcs lack the wrapper, so make the call directly. */
+	while (buflen > 0) {
+		n = syscall(SYS_getrandom, buf, buflen, 0);
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+			if (errno == ENOSYS)
+				return (entropy_urandom(buf, buflen));
+			return (-1);
+		}
+		buf += n;
+		buflen -= (size_t)n;
+	}
+	return (0);
+#else
+	return (entropy_urandom(buf, buflen));
+#endif
+}
+
+void
+DRBG_Init(DRBG_CTX * ctx)
+{
+
+	memset(ctx, 0, sizeof(*ctx));
+}
+
+/**
+ * drbg_reseed(ctx):
+ * Mix fresh OS entropy into the key. Return 0 on success, or -1 if the
+ * OS entropy source failed.
+ */
+static int
+drbg_reseed(DRBG_CTX * ctx)
+{
+	uint8_t fresh[32];
+	size_t i;
+
+	if (DRBG_Entropy(fresh, sizeof(fresh)))
+		return (-1);
+	for (i = 0; i < sizeof(fresh); i++)
+		ctx->key[i] ^= fresh[i];
+	ctx->generated = 0;
+	ctx->pid = getpid();
+	ctx->seeded = 1;
+
+	/* Clean the stack. */
+	memset(fresh, 0, sizeof(fresh));
+	return (0);
+}
+
+int
+DRBG_Generate(DRBG_CTX * ctx, uint8_t * buf, size_t buflen)
+{
+	static const uint8_t nonce[12] = { 0 };
+	CHACHA20_CTX chacha;
+	uint8_t block[64];
+	size_t n;
+
+	while (buflen > 0) {
+		n = buflen < DRBG_CHUNK ? buflen : DRBG_CHUNK;
+		if (!ctx->seeded || ctx->pid != getpid() ||
+		    ctx->generated >= DRBG_RESEED_INTERVAL) {
+			if (drbg_reseed(ctx)) {
+				memset(buf, 0, buflen);
+				return (-1);
+			}
+		}
+
+		/* The first block is the next key and the request key. */
+		memset(block, 0, sizeof(block));
+		ChaCha20_Init(&chacha, ctx->key, nonce, 0);
+		ChaCha20_XOR(&chacha, block, block, sizeof(block));
+		memcpy(ctx->key, block, 32);
+		ChaCha20_Init(&chacha, &block[32], nonce, 0);
+		memset(buf, 0, n);
+		ChaCha20_XOR(&chacha, buf, buf, n);
+
+		ctx->generated += n;
+		buf += n;
+		buflen -= n;
+	}
+
+	/* Clean the stack. */
+	ChaCha20_Clear(&chacha);
+	memset(block, 0, sizeof(block));
+	return (0);
+}
+
+void
+DRBG_Clear(DRBG_CTX * ctx)
+{
+
+	memset(ctx, 0, sizeof(*ctx));
+}
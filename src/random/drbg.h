@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _DRBG_H_
+#define _DRBG_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/* Mix in fresh OS entropy after this many bytes of output. */
+#define DRBG_RESEED_INTERVAL	(1U << 30)
+
+/*
+ * A fast-key-erasure ChaCha20 generator. Every request first turns the
+ * key into a new key and a one-off request key, so the state that
+ * produced earlier output is gone before the output is used. The key
+ * is seeded from the OS, and reseeded after DRBG_RESEED_INTERVAL bytes
+ * or when the process id changes, so forked children never repeat
+ * their parent's output. A context is not thread-safe; give each thread
+ * its own.
+ */
+typedef struct DRBGContext {
+	uint8_t key[32];
+	uint64_t generated;
+	pid_t pid;
+	int seeded;
+} DRBG_CTX;
+
+/**
+ * DRBG_Entropy(buf, buflen):
+ * Fill buf[0 .. buflen - 1] from the OS entropy source, which is
+ * getrandom(2) on Linux and Android, and getentropy(2) on Apple systems.
+ * Return 0 on success, or -1 if the source failed.
+ */
+int	DRBG_Entropy(uint8_t *, size_t);
+
+/**
+ * DRBG_Init(ctx):
+ * Set up an unseeded context, which seeds itself on first use.
+ */
+void	DRBG_Init(DRBG_CTX *);
+
+/**
+ * DRBG_Generate(ctx, buf, buflen):
+ * Fill buf[0 .. buflen - 1] with random bytes, reseeding first if
+ * needed. Return 0 on success, or -1 if seeding failed, in which case
+ * buf is zeroed.
+ */
+int	DRBG_Generate(DRBG_CTX *, uint8_t *, size_t);
+
+/**
+ * DRBG_Clear(ctx):
+ * Wipe the context, which then seeds itself again on next use.
+ */
+void	DRBG_Clear(DRBG_CTX *);
+
+#endif /* !_DRBG_H_ */
@@ -3,6 +3,8 @@ declare module 'react-native' {
   // things we use.
 
   interface NativeModules {
+    // Bytes cross the bridge as base64 strings (or hex, for the three
+    // secp256k1Ec* methods), but as buffers through the JSI bindings:
     RNFastCrypto: {
       pbkdf2Sha512: (
         dataBase64: string,
@@ -12,13 +14,13 @@ declare module 'react-native' {
       ) => Promise<string>
 
       scrypt: (
-        passwdBase64: string,
-        saltBase64: string,
+        passwd: NativeBytes,
+        salt: NativeBytes,
         N: number,
         r: number,
         p: number,
         size: number
-      ) => Promise<string>
+      ) => NativeResult<NativeBytes>
 
       secp256k1EcPrivkeyTweakAdd: (
         privateKeyHex: string,
@@ -33,7 +35,363 @@ declare module 'react-native' {
         tweakHex: string,
         compressed: boolean
       ) => Promise<string>
+      secp256k1EcPubkeyCreateBatch: (
+        privateKeys: NativeBytes,
+        count: number,
+        compressed: boolean,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      secp256k1EcPrivkeyTweakAddBatch: (
+        privateKeys: NativeBytes,
+        tweaks: NativeBytes,
+        count: number,
+        threads: number
+      ) => NativeResult<NativeBytes>
+
+      secp256k1EcdsaSign: (
+        privateKey: NativeBytes,
+        msgHash: NativeBytes,
+        der: boolean
+      ) => NativeResult<NativeBytes>
+      secp256k1EcdsaVerify: (
+        sig: NativeBytes,
+        der: boolean,
+        msgHash: NativeBytes,
+        publicKey: NativeBytes,
+        strict: boolean
+      ) => NativeResult<boolean>
+      secp256k1EcdsaVerifyBatch: (
+        sigs: NativeBytes,
+        msgHashes: NativeBytes,
+        publicKeys: NativeBytes,
+        count: number,
+        strict: boolean,
+        threads: number
+      ) => NativeResult<NativeBytes>
+
+      secp256k1XonlyPubkeyCreateBatch: (
+        privateKeys: NativeBytes,
+        count: number,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      secp256k1TaprootTweakPubkeyBatch: (
+        internalKeys: NativeBytes,
+        merkleRoots: NativeBytes,
+        count: number,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      secp256k1TaprootTweakPrivkeyBatch: (
+        privateKeys: NativeBytes,
+        merkleRoots: NativeBytes,
+        count: number,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      secp256k1SchnorrSignBatch: (
+        privateKeys: NativeBytes,
+        msgs: NativeBytes,
+        auxRands: NativeBytes,
+        count: number,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      secp256k1SchnorrVerifyBatch: (
+        sigs: NativeBytes,
+        msgs: NativeBytes,
+        publicKeys: NativeBytes,
+        count: number,
+        threads: number
+      ) => NativeResult<NativeBytes>
+
+      secp256k1EcdsaSignRecoverableBatch: (
+        privateKeys: NativeBytes,
+        msgHashes: NativeBytes,
+        count: number,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      secp256k1EcdsaRecoverBatch: (
+        sigs: NativeBytes,
+        msgHashes: NativeBytes,
+        count: number,
+        format: number,
+        threads: number
+      ) => NativeResult<NativeBytes>
+
+      secp256k1Ecdh: (
+        privateKey: NativeBytes,
+        publicKey: NativeBytes
+      ) => NativeResult<NativeBytes>
+      silentPaymentsScan: (
+        scanKey: NativeBytes,
+        spendPublicKey: NativeBytes,
+        labels: NativeBytes,
+        tweaks: NativeBytes,
+        inputHashes: NativeBytes,
+        outputKeys: NativeBytes,
+        outputCounts: NativeBytes,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      musigPubkeyAgg: (
+        publicKeys: NativeBytes,
+        sort: boolean
+      ) => NativeResult<NativeBytes>
+      musigPubkeyAggBatch: (
+        publicKeySets: NativeBytes,
+        keysPerSet: number,
+        setCount: number,
+        sort: boolean,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      musigPubkeyTweakAdd: (
+        keyaggCache: NativeBytes,
+        tweak: NativeBytes,
+        xonly: boolean
+      ) => NativeResult<NativeBytes>
+      musigNonceGen: (
+        sessionRand: NativeBytes,
+        privateKey: NativeBytes,
+        publicKey: NativeBytes,
+        msg: NativeBytes,
+        keyaggCache: NativeBytes
+      ) => NativeResult<NativeBytes>
+      musigNonceAgg: (pubnonces: NativeBytes) => NativeResult<NativeBytes>
+      musigPartialSign: (
+        nonceHandle: number,
+        privateKey: NativeBytes,
+        keyaggCache: NativeBytes,
+        aggnonce: NativeBytes,
+        msg: NativeBytes
+      ) => NativeResult<NativeBytes>
+      musigNonceRelease: (nonceHandle: number) => NativeResult<void>
+      musigPartialVerify: (
+        partialSig: NativeBytes,
+        pubnonce: NativeBytes,
+        publicKey: NativeBytes,
+        keyaggCache: NativeBytes,
+        aggnonce: NativeBytes,
+        msg: NativeBytes
+      ) => NativeResult<boolean>
+      musigPartialSigAgg: (
+        partialSigs: NativeBytes,
+        keyaggCache: NativeBytes,
+        aggnonce: NativeBytes,
+        msg: NativeBytes
+      ) => NativeResult<NativeBytes>
+      secp256k1KeyHandleCreate: (
+        key: NativeBytes,
+        isPrivate: boolean
+      ) => NativeResult<number>
+      secp256k1KeyHandlePublicKey: (handle: number) => NativeResult<number>
+      secp256k1KeyHandleTweakAdd: (
+        handle: number,
+        tweak: NativeBytes
+      ) => NativeResult<number>
+      secp256k1KeyHandleCombine: (handles: number[]) => NativeResult<number>
+      secp256k1KeyHandleSerialize: (
+        handle: number,
+        compressed: boolean
+      ) => NativeResult<NativeBytes>
+      secp256k1KeyHandleRelease: (handle: number) => NativeResult<void>
+      multisigDeriveBatch: (
+        xpubs: NativeBytes,
+        m: number,
+        startIndex: number,
+        count: number,
+        scriptType: number,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      aes256CbcEncrypt: (
+        key: NativeBytes,
+        iv: NativeBytes,
+        data: NativeBytes,
+        pad: boolean
+      ) => NativeResult<NativeBytes>
+      aes256CbcDecrypt: (
+        key: NativeBytes,
+        iv: NativeBytes,
+        data: NativeBytes,
+        pad: boolean
+      ) => NativeResult<NativeBytes>
+      aes256GcmEncrypt: (
+        key: NativeBytes,
+        iv: NativeBytes,
+        aad: NativeBytes,
+        data: NativeBytes
+      ) => NativeResult<NativeBytes>
+      aes256GcmDecrypt: (
+        key: NativeBytes,
+        iv: NativeBytes,
+        aad: NativeBytes,
+        data: NativeBytes
+      ) => NativeResult<NativeBytes>
+      aesSetImplementation: (implementation: number) => NativeResult<boolean>
+      aesGetImplementation: () => NativeResult<number>
+      chacha20Poly1305Encrypt: (
+        key: NativeBytes,
+        nonce: NativeBytes,
+        aad: NativeBytes,
+        data: NativeBytes
+      ) => NativeResult<NativeBytes>
+      chacha20Poly1305Decrypt: (
+        key: NativeBytes,
+        nonce: NativeBytes,
+        aad: NativeBytes,
+        data: NativeBytes
+      ) => NativeResult<NativeBytes>
+      chacha20Poly1305StreamCreate: (
+        key: NativeBytes,
+        nonce: NativeBytes,
+        aad: NativeBytes,
+        decrypt: boolean
+      ) => NativeResult<number>
+      chacha20Poly1305StreamUpdate: (
+        stream: number,
+        data: NativeBytes
+      ) => NativeResult<NativeBytes>
+      chacha20Poly1305StreamFinal: (
+        stream: number,
+        tag: NativeBytes
+      ) => NativeResult<NativeBytes>
+      chacha20Poly1305StreamRelease: (stream: number) => NativeResult<void>
+      chacha20SetImplementation: (implementation: number) => NativeResult<boolean>
+      chacha20GetImplementation: () => NativeResult<number>
+      recordsDecryptBatch: (
+        key: NativeBytes,
+        records: NativeBytes,
+        recordLens: NativeBytes,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      recordsDecryptBatchScrypt: (
+        password: NativeBytes,
+        salt: NativeBytes,
+        N: number,
+        r: number,
+        p: number,
+        records: NativeBytes,
+        recordLens: NativeBytes,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      ed25519PubkeyCreateBatch: (
+        privateKeys: NativeBytes,
+        count: number,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      ed25519Sign: (
+        privateKey: NativeBytes,
+        msg: NativeBytes
+      ) => NativeResult<NativeBytes>
+      ed25519VerifyBatch: (
+        sigs: NativeBytes,
+        msgs: NativeBytes,
+        msgLens: NativeBytes,
+        publicKeys: NativeBytes,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      slip10Ed25519DeriveBatch: (
+        seed: NativeBytes,
+        paths: NativeBytes,
+        pathLens: NativeBytes,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      argon2id: (
+        password: NativeBytes,
+        salt: NativeBytes,
+        t: number,
+        m: number,
+        p: number,
+        threads: number,
+        size: number
+      ) => NativeResult<NativeBytes>
+      argon2SetImplementation: (implementation: number) => NativeResult<boolean>
+      argon2GetImplementation: () => NativeResult<number>
+      bip39MnemonicToSeedBatch: (
+        mnemonic: NativeBytes,
+        passphrases: NativeBytes,
+        passphraseLens: NativeBytes,
+        wordlist: NativeBytes,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      addressEncodeBatch: (
+        format: number,
+        prefix: NativeBytes,
+        version: number,
+        payloads: NativeBytes,
+        payloadLens: NativeBytes,
+        threads: number
+      ) => NativeResult<string>
+      addressDecodeBatch: (
+        format: number,
+        prefix: NativeBytes,
+        addresses: string,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      randomBytes: (size: number) => NativeResult<NativeBytes>
+      keysGenerateBatch: (
+        keyType: number,
+        count: number,
+        threads: number
+      ) => NativeResult<NativeBytes>
+      poolConfigure: (
+        priority: number,
+        threads: number,
+        queueLimit: number,
+        cpus: number[]
+      ) => NativeResult<boolean>
+      pipelineRun: (
+        steps: NativeBytes,
+        inputs: NativeBytes,
+        inputLens: NativeBytes,
+        outputSlot: number
+      ) => NativeResult<NativeBytes>
+
+      statsSnapshot: () => NativeResult<NativeBytes>
+      statsReset: () => NativeResult<void>
+      traceStart: (maxEvents: number) => NativeResult<boolean>
+      traceStop: () => NativeResult<string>
+    }
+
+    // Missing from apps that cannot load the JSI bindings:
+    RNFastCryptoJsi?: {
+      install: () => boolean
     }
   }
   const NativeModules: NativeModules
 }
+
+/**
+ * Bytes as the native methods take and return them.
+ */
+type NativeBytes = string | ArrayBuffer | Uint8Array
+
+/**
+ * The bridge always returns promises,
+ * but quick JSI methods return their results directly.
+ */
+type NativeResult<T> = T | Promise<T>
+
+/**
+ * The JSI bindings take the same arguments as the bridge,
+ * except that the three hex methods take raw bytes too.
+ */
+type FastCryptoJsi = Omit<
+  import('react-native').NativeModules['RNFastCrypto'],
+  | 'pbkdf2Sha512'
+  | 'secp256k1EcPrivkeyTweakAdd'
+  | 'secp256k1EcPubkeyCreate'
+  | 'secp256k1EcPubkeyTweakAdd'
+> & {
+  secp256k1EcPrivkeyTweakAdd: (
+    privateKey: Uint8Array,
+    tweak: Uint8Array
+  ) => ArrayBuffer
+  secp256k1EcPubkeyCreate: (
+    privateKey: Uint8Array,
+    compressed: boolean
+  ) => ArrayBuffer
+  secp256k1EcPubkeyTweakAdd: (
+    publicKey: Uint8Array,
+    tweak: Uint8Array,
+    compressed: boolean
+  ) => ArrayBuffer
+}
+
+// eslint-disable-next-line no-var
+declare var __fastCryptoJsi: FastCryptoJsi | undefined
@@ -33,6 +33,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "../arena/arena.h"
 #include "sha256.h"
 #include "sysendian.h"
 
@@ -223,6 +224,10 @@ crypto_scrypt(const uint8_t * passwd, size_t passwdlen,
 	uint32_t i;
 
 	/* Sanity-check parameters. */
+	if ((r == 0) || (p == 0)) {
+		errno = EINVAL;
+		goto err0;
+	}
 #if SIZE_MAX > UINT32_MAX
 	if (buflen > (((uint64_t)(1) << 32) - 1) * 32) {
 		errno = EFBIG;
@@ -247,11 +252,11 @@ crypto_scrypt(const uint8_t * passwd, size_t passwdlen,
 	}
 
 	/* Allocate memory. */
-	if ((B = malloc(128 * r * p)) == NULL)
+	if ((B = Arena_Alloc(128 * r * p)) == NULL)
 		goto err0;
-	if ((XY = malloc(256 * r)) == NULL)
+	if ((XY = Arena_Alloc(256 * r)) == NULL)
 		goto err1;
-	if ((V = malloc(128UL * r * N)) == NULL)
+	if ((V = Arena_Alloc(128UL * r * N)) == NULL)
 		goto err2;
 
 	/* 1: (B_0 ... B_{p-1}) <-- PBKDF2(P, S, 1, p * MFLen) */
@@ -266,18 +271,18 @@ crypto_scrypt(const uint8_t * passwd, size_t passwdlen,
 	/* 5: DK <-- PBKDF2(P, B, 1, dkLen) */
 	PBKDF2_SHA256(passwd, passwdlen, B, p * 128 * r, 1, buf, buflen);
 
-	/* Free memory. */
-	free(V);
-	free(XY);
-	free(B);
+	/* Wipe and free memory. */
+	Arena_Free(V, 128UL * r * N);
+	Arena_Free(XY, 256 * r);
+	Arena_Free(B, 128 * r * p);
 
 	/* Success! */
 	return (0);
 
 err2:
-	free(XY);
+	Arena_Free(XY, 256 * r);
 err1:
-	free(B);
+	Arena_Free(B, 128 * r * p);
 err0:
 	/* Failure! */
 	return (-1);
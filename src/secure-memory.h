@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef secure_memory_h
+#define secure_memory_h
+
+#include "native-crypto.h"
+
+#include <new>
+#include <vector>
+
+/**
+ * A standard allocator backed by the secure arena, so containers
+ * holding secrets get locked, guarded memory that is wiped on release.
+ */
+template <class T>
+struct SecureAllocator {
+    typedef T value_type;
+
+    SecureAllocator() {}
+    template <class U>
+    SecureAllocator(const SecureAllocator<U> &) {}
+
+    T *allocate(size_t count)
+    {
+        if (count > SIZE_MAX / sizeof(T)) throw std::bad_alloc();
+        void *out = fast_crypto_secure_alloc(count * sizeof(T));
+        if (out == NULL) throw std::bad_alloc();
+        return static_cast<T *>(out);
+    }
+
+    void deallocate(T *memory, size_t count)
+    {
+        fast_crypto_secure_free(memory, count * sizeof(T));
+    }
+};
+
+template <class T, class U>
+bool operator==(const SecureAllocator<T> &, const SecureAllocator<U> &) { return true; }
+template <class T, class U>
+bool operator!=(const SecureAllocator<T> &, const SecureAllocator<U> &) { return false; }
+
+typedef std::vector<uint8_t, SecureAllocator<uint8_t>> SecureBytes;
+typedef std::vector<char, SecureAllocator<char>> SecureChars;
+
+#endif // secure_memory_h
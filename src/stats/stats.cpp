@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+extern "C" {
+#include "stats.h"
+}
+
+#if FAST_CRYPTO_STATS
+
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Trace event names, in the order of the STATS_* ids:
+const char *const opNames[STATS_OPS] = {
+    "scrypt", "argon2id", "bip39", "pipeline", "records", "aes", "chacha20poly1305",
+    "secp256k1Keys", "ecdsa", "schnorr", "ed25519", "address", "codec", "random"
+};
+
+/**
+ * Counters for one operation. Static storage starts them at zero,
+ * and relaxed atomics keep them off the callers' critical paths.
+ */
+struct OpCounters {
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> bytes;
+    std::atomic<uint64_t> totalNs;
+    std::atomic<uint64_t> maxNs;
+    std::atomic<uint64_t> histogram[STATS_BUCKETS];
+};
+
+OpCounters counters[STATS_OPS];
+
+struct TraceEvent {
+    int op;
+    unsigned thread;
+    uint64_t start;
+    uint64_t duration;
+    uint64_t bytes;
+};
+
+/**
+ * The trace buffer. Callers only take the mutex once the flag
+ * says a trace is running.
+ */
+struct Trace {
+    std::atomic<bool> running{false};
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    size_t limit = 0;
+    size_t dropped = 0;
+    uint64_t origin = 0;
+};
+
+Trace &getTrace()
+{
+    // Never destroyed, since worker threads may still record during exit:
+    static Trace *trace = new Trace();
+    return *trace;
+}
+
+/**
+ * Returns a small, stable number for the calling thread,
+ * which reads better in trace viewers than a system thread id.
+ */
+unsigned threadNumber()
+{
+    static std::atomic<unsigned> next(1);
+    thread_local unsigned number = next.fetch_add(1, std::memory_order_relaxed);
+    return number;
+}
+
+unsigned bucketFor(uint64_t ns)
+{
+    uint64_t us = ns / 1000;
+    unsigned bucket = 0;
+    while (us != 0 && bucket < STATS_BUCKETS - 1) {
+        us >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+} // namespace
+
+uint64_t Stats_Now(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Stats_Record(int op, uint64_t bytes, uint64_t start, uint64_t end)
+{
+    if (op < 0 || op >= STATS_OPS) return;
+    const uint64_t ns = end > start ? end - start : 0;
+    const std::memory_order relaxed = std::memory_order_relaxed;
+
+    OpCounters &counter = counters[op];
+    counter.calls.fetch_add(1, relaxed);
+    counter.bytes.fetch_add(bytes, relaxed);
+    counter.totalNs.fetch_add(ns, relaxed);
+    counter.histogram[bucketFor(ns)].fetch_add(1, relaxed);
+    uint64_t max = counter.maxNs.load(relaxed);
+    while (ns > max && !counter.maxNs.compare_exchange_weak(max, ns, relaxed)) {}
+
+    Trace &trace = getTrace();
+    if (!trace.running.load(std::memory_order_acquire)) return;
+    std::lock_guard<std::mutex> lock(trace.mutex);
+    if (!trace.running.load(relaxed) || start < trace.origin) return;
+    if (trace.events.size() < trace.limit) {
+        trace.events.push_back(TraceEvent{op, threadNumber(), start - trace.origin, ns, bytes});
+    } else {
+        ++trace.dropped;
+    }
+}
+
+void Stats_Get(int op, struct stats_op *out)
+{
+    memset(out, 0, sizeof(*out));
+    if (op < 0 || op >= STATS_OPS) return;
+    const std::memory_order relaxed = std::memory_order_relaxed;
+
+    const OpCounters &counter = counters[op];
+    out->calls = counter.calls.load(relaxed);
+    out->bytes = counter.bytes.load(relaxed);
+    out->totalns = counter.totalNs.load(relaxed);
+    out->maxns = counter.maxNs.load(relaxed);
+    for (unsigned i = 0; i < STATS_BUCKETS; ++i) out->histogram[i] = counter.histogram[i].load(relaxed);
+}
+
+void Stats_Reset(void)
+{
+    const std::memory_order relaxed = std::memory_order_relaxed;
+    for (OpCounters &op : counters) {
+        op.calls.store(0, relaxed);
+        op.bytes.store(0, relaxed);
+        op.totalNs.store(0, relaxed);
+        op.maxNs.store(0, relaxed);
+        for (std::atomic<uint64_t> &bucket : op.histogram) bucket.store(0, relaxed);
+    }
+}
+
+int Stats_TraceStart(size_t maxEvents)
+{
+    if (maxEvents == 0) return -1;
+    Trace &trace = getTrace();
+
+    std::lock_guard<std::mutex> lock(trace.mutex);
+    try {
+        std::vector<TraceEvent> events;
+        events.reserve(maxEvents);
+        trace.events.swap(events);
+    } catch (const std::exception &) {
+        return -1;
+    }
+    trace.limit = maxEvents;
+    trace.dropped = 0;
+    trace.origin = Stats_Now();
+    trace.running.store(true, std::memory_order_release);
+    return 0;
+}
+
+void Stats_TraceStop(void)
+{
+    Trace &trace = getTrace();
+    std::lock_guard<std::mutex> lock(trace.mutex);
+    trace.running.store(false, std::memory_order_release);
+}
+
+size_t Stats_TraceJson(char *out, size_t outLen)
+{
+    Trace &trace = getTrace();
+    std::string json = "{\"traceEvents\":[";
+    char event[256];
+
+    std::lock_guard<std::mutex> lock(trace.mutex);
+    for (size_t i = 0; i < trace.events.size(); ++i) {
+        const TraceEvent &e = trace.events[i];
+        snprintf(event, sizeof(event),
+            "%s{\"name\":\"%s\",\"cat\":\"fast-crypto\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+            "\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"bytes\":%llu}}",
+            i == 0 ? "" : ",", opNames[e.op], e.thread, e.start / 1000.0, e.duration / 1000.0,
+            (unsigned long long) e.bytes);
+        json += event;
+    }
+    snprintf(event, sizeof(event), "],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped\":%zu}}",
+        trace.dropped);
+    json += event;
+
+    if (outLen != 0) {
+        size_t copied = json.size() < outLen ? json.size() : outLen - 1;
+        memcpy(out, json.data(), copied);
+        out[copied] = '\0';
+    }
+    return json.size();
+}
+
+#endif
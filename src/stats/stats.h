@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+#ifndef _STATS_H_
+#define _STATS_H_
+
+#include <sys/types.h>
+
+#include <stdint.h>
+
+/*
+ * Operations with their own counters. Everything here compiles to
+ * nothing unless FAST_CRYPTO_STATS is defined to 1, and callers are
+ * expected to skip their calls the same way.
+ */
+#define STATS_SCRYPT		0
+#define STATS_ARGON2ID		1
+#define STATS_BIP39		2
+#define STATS_PIPELINE		3
+#define STATS_RECORDS		4
+#define STATS_AES		5
+#define STATS_CHACHA20_POLY1305	6
+#define STATS_SECP256K1_KEYS	7
+#define STATS_ECDSA		8
+#define STATS_SCHNORR		9
+#define STATS_ED25519		10
+#define STATS_ADDRESS		11
+#define STATS_CODEC		12
+#define STATS_RANDOM		13
+#define STATS_OPS		14
+
+/*
+ * Latency histogram buckets. Bucket 0 counts calls that took under a
+ * microsecond, bucket i counts calls that took from 2^(i-1) up to 2^i
+ * microseconds, and the last bucket also takes anything slower.
+ */
+#define STATS_BUCKETS		32
+
+struct stats_op {
+	uint64_t calls;
+	uint64_t bytes;		/* Bytes the calls processed. */
+	uint64_t totalns;
+	uint64_t maxns;
+	uint64_t histogram[STATS_BUCKETS];
+};
+
+/**
+ * Stats_Now():
+ * Return a monotonic timestamp in nanoseconds, for Stats_Record.
+ */
+uint64_t	Stats_Now(void);
+
+/**
+ * Stats_Record(op, bytes, start, end):
+ * Count one call to op that processed bytes bytes between the
+ * timestamps start and end, and add it to the trace if one is running.
+ * This never takes a lock unless tracing is on.
+ */
+void	Stats_Record(int, uint64_t, uint64_t, uint64_t);
+
+/**
+ * Stats_Get(op, stats):
+ * Store the counters for op in stats. The counters are read one at a
+ * time, so a snapshot taken during calls may be off by those calls.
+ */
+void	Stats_Get(int, struct stats_op *);
+
+/**
+ * Stats_Reset():
+ * Zero every counter.
+ */
+void	Stats_Reset(void);
+
+/**
+ * Stats_TraceStart(maxevents):
+ * Start recording calls as trace events, dropping any earlier trace,
+ * and keep at most maxevents of them. Return 0 on success, or -1 if
+ * maxevents is 0 or too big to allocate.
+ */
+int	Stats_TraceStart(size_t);
+
+/**
+ * Stats_TraceStop():
+ * Stop recording trace events, keeping the ones recorded so far.
+ */
+void	Stats_TraceStop(void);
+
+/**
+ * Stats_TraceJson(out, outlen):
+ * Write the recorded events to out as Chrome trace-event JSON, which
+ * chrome://tracing and Perfetto can open. Like snprintf, write at most
+ * outlen bytes including a terminating NUL, and return the full length
+ * of the JSON without the NUL.
+ */
+size_t	Stats_TraceJson(char *, size_t);
+
+#endif /* !_STATS_H_ */
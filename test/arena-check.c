@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+/*
+ * Checks the secure arena on a Linux desktop: zeroed blocks, reuse
+ * through the free lists and the mapping cache, and guard pages that
+ * stop overruns.
+ */
+
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "arena/arena.h"
+
+static int failures = 0;
+
+static void
+check(int ok, const char * what)
+{
+
+	printf("%s: %s\n", ok ? "pass" : "FAIL", what);
+	if (!ok)
+		failures++;
+}
+
+static int
+iszero(const uint8_t * buf, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		if (buf[i] != 0)
+			return (0);
+	}
+	return (1);
+}
+
+static void
+test_classes(void)
+{
+	static const size_t sizes[] = { 1, 32, 33, 100, 4096, 16384 };
+	struct arena_stats before, after;
+	uint8_t * block, * again;
+	size_t i;
+
+	for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+		block = Arena_Alloc(sizes[i]);
+		check((block != NULL) && iszero(block, sizes[i]),
+		    "small blocks start zeroed");
+		memset(block, 0xa5, sizes[i]);
+		Arena_Free(block, sizes[i]);
+
+		/* The free list hands the same block straight back. */
+		Arena_GetStats(&before);
+		again = Arena_Alloc(sizes[i]);
+		Arena_GetStats(&after);
+		check(again == block, "freed blocks are reused");
+		check(iszero(again, sizes[i]), "freed blocks are wiped");
+		check(after.maps == before.maps, "reuse maps nothing new");
+		Arena_Free(again, sizes[i]);
+	}
+}
+
+static void
+test_large(void)
+{
+	const size_t size = 1024 * 1024 + 3;
+	struct arena_stats before, after;
+	uint8_t * block;
+	int i;
+
+	/* Repeated key stretching should map its memory once. */
+	Arena_GetStats(&before);
+	for (i = 0; i < 20; i++) {
+		block = Arena_Alloc(size);
+		if ((block == NULL) || !iszero(block, size))
+			break;
+		memset(block, 0x5a, size);
+		Arena_Free(block, size);
+	}
+	Arena_GetStats(&after);
+	check(i == 20, "large blocks start zeroed, even from the cache");
+	check(after.maps - before.maps <= 1, "the cache reuses large mappings");
+	check(((uintptr_t)block % 64) == 0, "large blocks are aligned");
+	printf("%llu allocations needed %llu mappings, %llu left unlocked\n",
+	    (unsigned long long)(after.allocs - before.allocs),
+	    (unsigned long long)(after.maps - before.maps),
+	    (unsigned long long)after.unlocked);
+}
+
+/**
+ * faults(size, offset):
+ * Return nonzero if writing offset bytes past the end of a size-byte
+ * block kills the process.
+ */
+static int
+faults(size_t size, size_t offset)
+{
+	uint8_t * block;
+	pid_t pid;
+	int status;
+
+	if ((pid = fork()) == -1)
+		return (0);
+	if (pid == 0) {
+		if ((block = Arena_Alloc(size)) == NULL)
+			_exit(1);
+		block[size + offset] = 1;
+		_exit(0);
+	}
+	if (waitpid(pid, &status, 0) != pid)
+		return (0);
+	return (WIFSIGNALED(status) && ((WTERMSIG(status) == SIGSEGV) ||
+	    (WTERMSIG(status) == SIGBUS)));
+}
+
+static void
+test_guards(void)
+{
+
+	check(!faults(100000, 31), "writes within the alignment slack land");
+	check(faults(100000, 32), "large overruns hit the guard page");
+}
+
+static void
+test_stats(void)
+{
+	struct arena_stats stats;
+
+	Arena_GetStats(&stats);
+	check(stats.allocs == stats.frees, "every allocation was freed");
+	check(stats.inuse == 0, "nothing is left in use");
+}
+
+int
+main(void)
+{
+
+	test_classes();
+	test_large();
+	test_guards();
+	test_stats();
+
+	if (failures != 0) {
+		printf("%d checks failed\n", failures);
+		return (1);
+	}
+	printf("All checks passed\n");
+	return (0);
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+/*
+ * Checks the JSI bindings on a Linux desktop: installs the host object
+ * into a Hermes runtime, calls some quick methods directly, and waits
+ * for scrypt promises to settle from the worker pool, the same way the
+ * apps do except that this thread stands in for the JavaScript thread.
+ */
+
+#include "jsi/jsi-bindings.h"
+
+#include <hermes/hermes.h>
+
+#include <stdio.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+using namespace facebook;
+
+typedef std::chrono::steady_clock Clock;
+
+// The promises should settle long before this:
+const std::chrono::seconds maxWait(10);
+
+static int failures = 0;
+
+static void check(bool ok, const char *what)
+{
+    printf("%s: %s\n", ok ? "pass" : "FAIL", what);
+    if (!ok) ++failures;
+}
+
+/**
+ * The callbacks the bindings hand to their invoker,
+ * waiting to run on the JavaScript thread.
+ */
+struct JsQueue {
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<std::function<void()>> jobs;
+
+    void push(std::function<void()> job) {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(std::move(job));
+        ready.notify_one();
+    }
+
+    /**
+     * Runs the oldest callback, waiting until `deadline` for one to show up.
+     */
+    bool runOne(Clock::time_point deadline) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!ready.wait_until(lock, deadline, [this] { return !jobs.empty(); })) return false;
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+        job();
+        return true;
+    }
+};
+
+// The keys are 1 and 2, so the public keys are G and 2G:
+static const char script[] =
+    "var fastCrypto = globalThis.__fastCryptoJsi;\n"
+    "var results = (globalThis.results = {});\n"
+    "function hex(buffer) {\n"
+    "  var out = '';\n"
+    "  new Uint8Array(buffer).forEach(function (byte) {\n"
+    "    out += (byte < 16 ? '0' : '') + byte.toString(16);\n"
+    "  });\n"
+    "  return out;\n"
+    "}\n"
+    "function bytes(text) {\n"
+    "  var out = new Uint8Array(text.length / 2);\n"
+    "  for (var i = 0; i < out.length; ++i) out[i] = parseInt(text.substr(2 * i, 2), 16);\n"
+    "  return out;\n"
+    "}\n"
+    "var one = bytes('0000000000000000000000000000000000000000000000000000000000000001');\n"
+    "var g = fastCrypto.secp256k1EcPubkeyCreate(one, true);\n"
+    "results.pubkeyCreate = hex(g);\n"
+    "results.privkeyTweak = hex(fastCrypto.secp256k1EcPrivkeyTweakAdd(one, one));\n"
+    "results.pubkeyTweak = hex(fastCrypto.secp256k1EcPubkeyTweakAdd(g, one, true));\n"
+    "try {\n"
+    "  fastCrypto.secp256k1EcPubkeyCreate('01', true);\n"
+    "  results.badArgument = 'returned';\n"
+    "} catch (error) {\n"
+    "  results.badArgument = error.message;\n"
+    "}\n"
+    "var empty = new Uint8Array(0);\n"
+    "fastCrypto.scrypt(empty, empty, 16, 1, 1, 64).then(\n"
+    "  function (out) { results.scrypt = hex(out); },\n"
+    "  function (error) { results.scrypt = 'rejected: ' + error.message; });\n"
+    "fastCrypto.scrypt(empty, empty, 15, 1, 1, 64).then(\n"
+    "  function () { results.badScrypt = 'resolved'; },\n"
+    "  function (error) { results.badScrypt = error.message; });\n";
+
+static std::string getResult(jsi::Runtime &rt, const char *name)
+{
+    jsi::Value value = rt.global().getPropertyAsObject(rt, "results").getProperty(rt, name);
+    return value.isString() ? value.getString(rt).utf8(rt) : std::string();
+}
+
+int main()
+{
+    std::unique_ptr<facebook::hermes::HermesRuntime> runtime = facebook::hermes::makeHermesRuntime(
+        ::hermes::vm::RuntimeConfig::Builder().withMicrotaskQueue(true).build());
+    jsi::Runtime &rt = *runtime;
+
+    JsQueue queue;
+    fastcrypto::installJsi(rt, [&queue](std::function<void()> job) { queue.push(std::move(job)); });
+    rt.evaluateJavaScript(std::make_shared<jsi::StringBuffer>(script), "jsi-host.js");
+    rt.drainMicrotasks();
+
+    check(getResult(rt, "pubkeyCreate") ==
+          "0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798",
+          "secp256k1EcPubkeyCreate returns G for the key 1");
+    check(getResult(rt, "privkeyTweak") ==
+          "0000000000000000000000000000000000000000000000000000000000000002",
+          "secp256k1EcPrivkeyTweakAdd adds the tweak");
+    check(getResult(rt, "pubkeyTweak") ==
+          "02c6047f9441ed7d6d3045406e95c07cd85c778e4b8cef3ca7abac09b95c709ee5",
+          "secp256k1EcPubkeyTweakAdd returns 2G");
+    check(getResult(rt, "badArgument") == "secp256k1EcPubkeyCreate: Invalid argument 1",
+          "a string instead of bytes throws");
+
+    // Run the settled calls until both promises have their results:
+    Clock::time_point deadline = Clock::now() + maxWait;
+    while (getResult(rt, "scrypt").empty() || getResult(rt, "badScrypt").empty()) {
+        if (!queue.runOne(deadline)) break;
+        rt.drainMicrotasks();
+    }
+
+    // RFC 7914, test vector 1:
+    check(getResult(rt, "scrypt") ==
+          "77d6576238657b203b19ca42c18a0497f16b4844e3074ae8dfdffa3fede21442"
+          "fcd0069ded0948f8326a753a0fc81f17e8d3e0fb2e0d3628cf35e20c38d18906",
+          "scrypt resolves from the worker pool");
+    check(getResult(rt, "badScrypt") == "Invalid scrypt parameters",
+          "scrypt rejects when N is not a power of 2");
+
+    if (failures != 0) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
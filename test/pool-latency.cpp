@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026, Edge
+ * All rights reserved.
+ *
+ * See the LICENSE file for more information.
+ */
+
+/*
+ * Checks the worker pool on a Linux desktop: bounded queues, start
+ * order, resizing, and how long interactive tasks wait for a thread
+ * while the background class is saturated with slow work.
+ */
+
+extern "C" {
+#include "pool/pool.h"
+}
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+// Interactive tasks should start within this long, even under load:
+const double maxInteractiveP99Ms = 10;
+
+static int failures = 0;
+
+static void check(bool ok, const char *what)
+{
+    printf("%s: %s\n", ok ? "pass" : "FAIL", what);
+    if (!ok) ++failures;
+}
+
+/**
+ * Busy-waits, standing in for a slow KDF.
+ */
+static void spin(std::chrono::microseconds duration)
+{
+    Clock::time_point end = Clock::now() + duration;
+    while (Clock::now() < end) {}
+}
+
+/**
+ * Counts finished tasks, so the tests can wait for them.
+ */
+struct Latch {
+    std::mutex mutex;
+    std::condition_variable done;
+    size_t count = 0;
+
+    void arrive() {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++count;
+        done.notify_all();
+    }
+    void wait(size_t target) {
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [&]() { return count >= target; });
+    }
+};
+
+struct Timed {
+    Clock::time_point queued;
+    Clock::time_point started;
+    std::chrono::microseconds work;
+    Latch *latch;
+};
+
+static void runTimed(void *context)
+{
+    Timed *task = static_cast<Timed *>(context);
+    task->started = Clock::now();
+    spin(task->work);
+    task->latch->arrive();
+}
+
+static void runSpin(void *context)
+{
+    Latch *latch = static_cast<Latch *>(context);
+    spin(std::chrono::milliseconds(20));
+    latch->arrive();
+}
+
+static void testQueueLimit()
+{
+    Latch latch;
+    check(Pool_Configure(POOL_BACKGROUND, 1, 4, NULL, 0) == 0, "configure background");
+
+    // One task runs while four wait, so the sixth has no room:
+    size_t accepted = 0;
+    for (int i = 0; i < 6; ++i) {
+        if (Pool_Submit(POOL_BACKGROUND, runSpin, &latch) == 0) ++accepted;
+        if (i == 0) std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    check(accepted == 5, "a full queue rejects new tasks");
+    check(Pool_Pending(POOL_BACKGROUND) <= 4, "pending tasks stay within the limit");
+    latch.wait(accepted);
+    check(Pool_Pending(POOL_BACKGROUND) == 0, "the queue drains");
+
+    check(Pool_Submit(POOL_CLASSES, runSpin, &latch) != 0, "unknown priorities are rejected");
+    check(Pool_Configure(POOL_BACKGROUND, 0, 4, NULL, 0) != 0, "zero threads are rejected");
+    int badCpu = -1;
+    check(Pool_Configure(POOL_BACKGROUND, 1, 4, &badCpu, 1) != 0, "negative CPUs are rejected");
+}
+
+static void testOrder()
+{
+    const size_t count = 200;
+    std::vector<Timed> tasks(count);
+    Latch latch;
+
+    check(Pool_Configure(POOL_INTERACTIVE, 1, count, NULL, 0) == 0, "configure interactive");
+    for (Timed &task : tasks) {
+        task.work = std::chrono::microseconds(0);
+        task.latch = &latch;
+        Pool_Submit(POOL_INTERACTIVE, runTimed, &task);
+    }
+    latch.wait(count);
+
+    bool ordered = true;
+    for (size_t i = 1; i < count; ++i) {
+        if (tasks[i].started < tasks[i - 1].started) ordered = false;
+    }
+    check(ordered, "tasks in a class start in submission order");
+}
+
+static void testResize()
+{
+    const size_t count = 64;
+    Latch latch;
+
+    // Grow, then shrink while tasks are still queued:
+    int cpu = 0;
+    check(Pool_Configure(POOL_BACKGROUND, 4, count, &cpu, 1) == 0, "pin background to CPU 0");
+    for (size_t i = 0; i < count / 2; ++i) Pool_Submit(POOL_BACKGROUND, runSpin, &latch);
+    check(Pool_Configure(POOL_BACKGROUND, 1, count, NULL, 0) == 0, "shrink background");
+    for (size_t i = count / 2; i < count; ++i) Pool_Submit(POOL_BACKGROUND, runSpin, &latch);
+    latch.wait(count);
+    check(true, "every task runs across resizes");
+}
+
+/**
+ * Returns the given percentile of some latencies, in milliseconds.
+ */
+static double percentile(std::vector<double> values, double p)
+{
+    std::sort(values.begin(), values.end());
+    size_t index = std::min(values.size() - 1, (size_t) (p / 100 * values.size()));
+    return values[index];
+}
+
+/**
+ * Feeds each class a stream of tasks while the background class stays
+ * saturated with slow ones, and reports how long tasks waited to start.
+ */
+static void testLatency()
+{
+    const unsigned cpus = std::max(1u, std::thread::hardware_concurrency());
+    const size_t probes = 400;
+    Latch backgroundLatch;
+    Latch probeLatch;
+
+    check(Pool_Configure(POOL_INTERACTIVE, 1, POOL_QUEUE_LIMIT, NULL, 0) == 0,
+        "configure interactive");
+    check(Pool_Configure(POOL_BACKGROUND, cpus, 32, NULL, 0) == 0, "configure background");
+
+    // Keep the background queue topped up until the probes finish:
+    std::atomic<bool> loading(true);
+    std::atomic<size_t> loaded(0);
+    std::thread feeder([&]() {
+        while (loading) {
+            if (Pool_Submit(POOL_BACKGROUND, runSpin, &backgroundLatch) == 0) {
+                ++loaded;
+            } else {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // Mixed interactive work, from 50us to 1ms apiece:
+    std::vector<Timed> tasks(probes);
+    for (size_t i = 0; i < probes; ++i) {
+        tasks[i].work = std::chrono::microseconds(50 + (i * 37) % 950);
+        tasks[i].latch = &probeLatch;
+        tasks[i].queued = Clock::now();
+        if (Pool_Submit(POOL_INTERACTIVE, runTimed, &tasks[i]) != 0) {
+            check(false, "interactive submit under load");
+            loading = false;
+            feeder.join();
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    probeLatch.wait(probes);
+    loading = false;
+    feeder.join();
+    size_t backgroundPending = Pool_Pending(POOL_BACKGROUND);
+    backgroundLatch.wait(loaded);
+
+    std::vector<double> waits;
+    for (const Timed &task : tasks) {
+        waits.push_back(std::chrono::duration<double, std::milli>(task.started - task.queued).count());
+    }
+    double p50 = percentile(waits, 50);
+    double p99 = percentile(waits, 99);
+    double worst = percentile(waits, 100);
+    printf("interactive wait with %u busy background threads: p50 %.3f ms, p99 %.3f ms, max %.3f ms\n",
+        cpus, p50, p99, worst);
+    printf("background tasks submitted: %zu, still queued at the end: %zu\n",
+        (size_t) loaded, backgroundPending);
+    check(backgroundPending > 0, "the background class stayed saturated");
+    check(p99 < maxInteractiveP99Ms, "interactive tasks do not wait behind background work");
+}
+
+int main()
+{
+    testQueueLimit();
+    testOrder();
+    testResize();
+    testLatency();
+
+    if (failures != 0) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}